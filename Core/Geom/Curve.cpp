@@ -57,13 +57,13 @@ namespace Geom {
 /*----------------------------------------------------------------------------*/
 const char* Curve::typeNameGeomCurve = "GeomCurve";
 /*----------------------------------------------------------------------------*/
-Curve::Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+Curve::Curve(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
         GeomProperty* gprop, GeomRepresentation* compProp)
 :GeomEntity(ctx, prop, disp, gprop,compProp)
 {
 }
 /*----------------------------------------------------------------------------*/
-Curve::Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+Curve::Curve(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp)
 :GeomEntity(ctx, prop, disp, gprop,compProp)
 {
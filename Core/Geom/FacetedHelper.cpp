@@ -82,29 +82,32 @@ void FacetedHelper::transform(std::vector<gmds::Node>& nodes,
 	}
 }
 /*----------------------------------------------------------------------------*/
-void FacetedHelper::getGMDSNodes(const std::vector<gmds::Face>& poly,
+void FacetedHelper::getGMDSNodes(Utils::MarkVectorPool& marks,
+                                 const std::vector<gmds::Face>& poly,
                                  std::vector<gmds::Node >& ANodes)
 {
     ANodes.clear();
 
     // utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
-    std::map<gmds::TCellID, uint> filtre_nodes;
+    Utils::MarkVectorLease filtre_lease (marks);
+    Utils::MarkVector& filtre_nodes = filtre_lease.marks ( );
 
     for(unsigned int i=0; i<poly.size(); i++) {
         std::vector<gmds::Node> nodes;
 
         poly[i].get(nodes);
         for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-            if (filtre_nodes[nodes[iNode].getID()] == 0){
+            if (!filtre_nodes.isMarked(nodes[iNode].getID())){
                 ANodes.push_back(nodes[iNode]);
 
-                filtre_nodes[nodes[iNode].getID()] = 1;
+                filtre_nodes.set(nodes[iNode].getID(), 1);
             }
         }
     }
 }
 /*----------------------------------------------------------------------------*/
-void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
+void FacetedHelper::buildIsoCurve(Utils::MarkVectorPool& marks,
+                                      const std::vector<gmds::Face>& poly,
                                       std::vector<Utils::Math::Point>& points,
                                       std::vector<size_t>& indices)
 {
@@ -114,7 +117,7 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
 
     // construit la liste des noeuds
     std::vector<gmds::Node>	nodes;
-    getGMDSNodes(poly, nodes);
+    getGMDSNodes(marks, poly, nodes);
 
     // recherche de la boite englobante
     Utils::Math::Point pmin;
@@ -164,7 +167,8 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
 
     // pour une direction donnée, un plan donné, détermine les noeuds d'un côté
     // ou de l'autre, ou à cheval à epsilon près
-    std::map<gmds::TCellID, uint> filtre_nodes;
+    Utils::MarkVectorLease filtre_lease (marks);
+    Utils::MarkVector& filtre_nodes = filtre_lease.marks ( );
     if (nbX) {
         filtre_nodes.clear();
         std::vector<double> coordPlX;
@@ -188,7 +192,7 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
             } // end for i
             if (masqueNd == 0)
                 masqueNd = masqueInterval;
-            filtre_nodes[(*itn).getID()] = masqueNd;
+            filtre_nodes.set((*itn).getID(), masqueNd);
             //std::cout<<" nd "<<(*itn).getID()<<" masque à "<<masqueNd<<std::endl;
         } // end for itn
 
@@ -225,7 +229,7 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
             } // end for i
             if (masqueNd == 0)
                 masqueNd = masqueInterval;
-            filtre_nodes[(*itn).getID()] = masqueNd;
+            filtre_nodes.set((*itn).getID(), masqueNd);
             //std::cout<<" nd "<<(*itn).getID()<<" masque à "<<masqueNd<<std::endl;
         } // end for itn
 
@@ -262,7 +266,7 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
             } // end for i
             if (masqueNd == 0)
                 masqueNd = masqueInterval;
-            filtre_nodes[(*itn).getID()] = masqueNd;
+            filtre_nodes.set((*itn).getID(), masqueNd);
             //std::cout<<" nd "<<(*itn).getID()<<" masque à "<<masqueNd<<std::endl;
         } // end for itn
 
@@ -278,7 +282,7 @@ void FacetedHelper::buildIsoCurve(const std::vector<gmds::Face>& poly,
 
 }
 /*----------------------------------------------------------------------------*/
-void FacetedHelper::sortNodes(std::vector<gmds::Node>& nodes, std::map<gmds::TCellID, uint>& filtre_nodes)
+void FacetedHelper::sortNodes(std::vector<gmds::Node>& nodes, const Utils::MarkVector& filtre_nodes)
 {
     if (nodes.size() != 3)
         throw TkUtil::Exception(TkUtil::UTF8String ("FacetedHelper::sortNodes n'est prévu que pour des triangles.", TkUtil::Charset::UTF_8));
@@ -294,7 +298,7 @@ void FacetedHelper::sortNodes(std::vector<gmds::Node>& nodes, std::map<gmds::TCe
 }
 /*----------------------------------------------------------------------------*/
 void FacetedHelper::addPointsIsoCurve(std::vector<gmds::Node>& nodes,
-        std::map<gmds::TCellID, uint>& filtre_nodes,
+        const Utils::MarkVector& filtre_nodes,
         std::vector<double>& coordPl,
         uint dirPlan,
         std::vector<Utils::Math::Point>& points,
@@ -607,7 +611,7 @@ void FacetedHelper::transformOffset(Mesh::MeshImplementation* mesh, FacetedSurfa
 
     // pour chacun des noeuds de la surface, déplacement en fonction de la normale des polygones adjacents
     std::vector<gmds::Node> nodes;
-    getGMDSNodes(faces, nodes);
+    getGMDSNodes(mesh->getMarks(), faces, nodes);
 
     for (uint i=0; i<nodes.size(); i++){
         gmds::Node node = nodes[i];
@@ -149,7 +149,7 @@ double FacetedSurface::computeCurveArea()
 void FacetedSurface::computeBoundingBox(Utils::Math::Point& pmin,Utils::Math::Point& pmax, double tol) const
 {
 	std::vector<gmds::Node>	nodes;
-	FacetedHelper::getGMDSNodes(m_poly, nodes);
+	FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 	FacetedHelper::computeBoundingBox(nodes, pmin, pmax);
 }
 /*----------------------------------------------------------------------------*/
@@ -250,7 +250,7 @@ void FacetedSurface::getParameters(double& first, double& last)
 void FacetedSurface::translate(const Utils::Math::Vector& V)
 {
 	std::vector<gmds::Node>	nodes;
-    FacetedHelper::getGMDSNodes(m_poly, nodes);
+    FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 
     // création de l'opérateur de translation via OCC
     gp_Trsf transf;
@@ -265,7 +265,7 @@ void FacetedSurface::translate(const Utils::Math::Vector& V)
 void FacetedSurface::scale(const double F, const Utils::Math::Point& center)
 {
 	std::vector<gmds::Node>	nodes;
-    FacetedHelper::getGMDSNodes(m_poly, nodes);
+    FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 
 	// création de l'opérateur d'homothétie via OCC
 	gp_Trsf transf;
@@ -281,7 +281,7 @@ void FacetedSurface::scale(const double factorX,
             const double factorZ)
 {
 	std::vector<gmds::Node>	nodes;
-    FacetedHelper::getGMDSNodes(m_poly, nodes);
+    FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 
     // création de l'opérateur d'homothétie via OCC
     gp_GTrsf transf;
@@ -298,7 +298,7 @@ void FacetedSurface::rotate(const Utils::Math::Point& P1,
         const Utils::Math::Point& P2, double Angle)
 {
 	std::vector<gmds::Node>	nodes;
-    FacetedHelper::getGMDSNodes(m_poly, nodes);
+    FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 
 	// création de l'opérateur de rotation via OCC
     gp_Trsf transf;
@@ -319,7 +319,7 @@ void FacetedSurface::mirror(const Utils::Math::Plane& plane)
 {
     //std::cout<<"FacetedSurface::mirror avec "<<plane<<std::endl;
 	std::vector<gmds::Node>	nodes;
-    FacetedHelper::getGMDSNodes(m_poly, nodes);
+    FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
 
     // création de l'opérateur d'homothétie via OCC
     gp_Trsf transf;
@@ -374,7 +374,7 @@ void FacetedSurface::buildDisplayRepresentation(Utils::DisplayRepresentation& dr
     if (dr.hasRepresentation(Utils::DisplayRepresentation::ISOCURVE)){
 
         // création des lignes internes pour la représentation
-        FacetedHelper::buildIsoCurve(m_poly,
+        FacetedHelper::buildIsoCurve(getMarks(), m_poly,
                 points, indicesFilaire);
 
     }
@@ -385,7 +385,7 @@ void FacetedSurface::buildDisplayRepresentation(Utils::DisplayRepresentation& dr
     	// et une map pour l'indirection entre gmds::Node vers indice local
     	std::vector<gmds::Node>	nodes;
     	std::map<gmds::TCellID, int>	node2id;
-        FacetedHelper::getGMDSNodes(m_poly, nodes);
+        FacetedHelper::getGMDSNodes(getMarks(), m_poly, nodes);
     	for(int iNode=0; iNode<nodes.size(); iNode++) 
     		node2id[nodes[iNode].getID()] = iNode;
 
@@ -543,6 +543,14 @@ void FacetedSurface::update()
     buildAABBTree();
 }
 /*----------------------------------------------------------------------------*/
+Utils::MarkVectorPool& FacetedSurface::getMarks() const
+{
+	Mesh::MeshItf* meshItf = m_context.getMeshManager ( ).getMesh ( );
+	Mesh::MeshImplementation* meshImpl = dynamic_cast<Mesh::MeshImplementation*> (meshItf);
+	CHECK_NULL_PTR_ERROR(meshImpl)
+	return meshImpl->getMarks ( );
+}
+/*----------------------------------------------------------------------------*/
 } // end namespace Geom
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
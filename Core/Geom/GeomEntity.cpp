@@ -44,7 +44,7 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Geom {
 /*----------------------------------------------------------------------------*/
-GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
         GeomProperty* gprop, GeomRepresentation* compProp)
 : Internal::InternalEntity (ctx, prop, disp),
   m_geomProp(gprop), m_computedAreaIsUpToDate(false), m_computedArea(0)
@@ -52,7 +52,7 @@ GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::Dis
 	m_geomRep.push_back(compProp);
 }
 /*----------------------------------------------------------------------------*/
-GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp)
 : Internal::InternalEntity (ctx, prop, disp),
   m_geomProp(gprop), m_computedAreaIsUpToDate(false), m_computedArea(0)
@@ -14,6 +14,7 @@
 /*----------------------------------------------------------------------------*/
 
 #include "Internal/ContextIfc.h"
+#include "Utils/Common.h"
 #include "Geom/GeomManager.h"
 #include "Geom/GeomEntity.h"
 #include "Geom/Volume.h"
@@ -224,15 +225,17 @@ copy(std::vector<std::string>& e, bool withTopo, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 copy(std::vector<GeomEntity*>& e, bool withTopo, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::copy (";
-    for(unsigned int i=0;i<e.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << e[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::copy (";
+        for(unsigned int i=0;i<e.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << e[i]->getName();
+        }
+        message<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
 
@@ -296,15 +299,17 @@ newVolume(std::vector<std::string>& e, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newVolume(std::vector<Surface*>& e, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVolume (";
-    for(unsigned int i=0;i<e.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << e[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newVolume (";
+        for(unsigned int i=0;i<e.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << e[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     CommandNewGeomVolume* command =
             new CommandNewGeomVolume(getLocalContext(),e, groupName);
@@ -352,9 +357,7 @@ newVertex(std::string vertexName,std::string curveName, std::string groupName){
 Internal::M3DCommandResultIfc* GeomManager::
 newVertex(const Vertex* ref,  Curve* curve, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref->getName()<<", "<<curve->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref->getName()<<", "<<curve->getName()<<")");
 
     //creation de la commande de création
     CommandNewVertexByProjection *command =
@@ -381,9 +384,7 @@ newVertex(const Vertex* ref,  Curve* curve, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newVertex(const Vertex* ref,  Surface* surface, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref->getName()<<", "<<surface->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref->getName()<<", "<<surface->getName()<<")");
 
     //creation de la commande de création
     CommandNewVertexByProjection *command =
@@ -417,9 +418,7 @@ newVertex(std::string curveName, const double& param, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newVertex(Curve* curve, const double& param, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<curve->getName()<<", "<<param<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<curve->getName()<<", "<<param<<")");
 
     //creation de la commande de création
     CommandNewVertexByCurveParameterization *command =
@@ -454,9 +453,7 @@ newVertex(std::string vertex1Name, std::string vertex2Name, const double& param,
 Internal::M3DCommandResultIfc* GeomManager::
 newVertex(const Vertex* ref1, const Vertex* ref2, const double& param, std::string groupName)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref1->getName()<<", "<<ref2->getName()<<", "<<param<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref1->getName()<<", "<<ref2->getName()<<", "<<param<<")");
 
     Point p1 = ref1->getPoint();
     Point p2 = ref2->getPoint();
@@ -500,9 +497,7 @@ newVertex(const double& x, const double& y, const double& z, std::string groupNa
 Internal::M3DCommandResultIfc* GeomManager::
 newVertex(const Point& p, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex ("<<p<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVertex ("<<p<<")");
 
     //creation de la commande de création
     CommandNewVertex *command = new CommandNewVertex(getLocalContext(),p, groupName);
@@ -535,9 +530,7 @@ newSegment(std::string n1,std::string n2, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newSegment( Geom::Vertex* v1,  Geom::Vertex* v2, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSegment ("<<v1->getCoord()<<","<<v2->getCoord()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newSegment ("<<v1->getCoord()<<","<<v2->getCoord()<<")");
 
     //creation de la commande de création
     CommandNewSegment*command = new CommandNewSegment(getLocalContext(),v1,v2, groupName);
@@ -573,9 +566,7 @@ newPlanarSurface(std::vector<std::string>& curve_names, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newPlanarSurface(const std::vector<Geom::Curve* >& curves, std::string groupName )
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newPlanarSurface from curves";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newPlanarSurface from curves");
 
     //creation de la commande de création
     CommandNewSurface* command = new CommandNewSurface(getLocalContext(),curves, groupName);
@@ -610,12 +601,14 @@ newSurfaceByOffset(std::string name, const double& offset, std::string groupName
 Internal::M3DCommandResultIfc* GeomManager::
 newSurfaceByOffset(Surface* base, const double& offset, std::string groupName)
 {
-	TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-	message << "GeomManager::newSurfaceByOffset("<<base->getName()<<", "<<offset;
-	if (!groupName.empty())
-		message<<", "<<groupName;
-	message<<")";
-	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	if (isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+		message << "GeomManager::newSurfaceByOffset("<<base->getName()<<", "<<offset;
+		if (!groupName.empty())
+			message<<", "<<groupName;
+		message<<")";
+		log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	}
 
 	Internal::CommandInternal* command = new CommandNewSurfaceByOffset(getLocalContext(), base, offset, groupName);
 
@@ -638,9 +631,7 @@ newSurfaceByOffset(Surface* base, const double& offset, std::string groupName)
 Mgx3D::Internal::M3DCommandResultIfc* GeomManager::
 newVerticesCurvesAndPlanarSurface(std::vector<Point>& points, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVerticesCurvesAndPlanarSurface from points";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newVerticesCurvesAndPlanarSurface from points");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getLocalContext(), "Création d'une surface avec vecteur de points");
@@ -829,9 +820,7 @@ GeomManager::newCurveByCurveProjectionOnSurface(const std::string& curveName, co
 Internal::M3DCommandResultIfc*
 GeomManager::newCurveByCurveProjectionOnSurface(Geom::Curve* curve, Geom::Surface* surface, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCurveByCurveProjectionOnSurface("<<curve->getName()<<", "<<surface->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newCurveByCurveProjectionOnSurface("<<curve->getName()<<", "<<surface->getName()<<")");
 
     CommandNewCurveByCurveProjectionOnSurface *command =
             new CommandNewCurveByCurveProjectionOnSurface(getLocalContext(), curve, surface, groupName);
@@ -867,15 +856,17 @@ destroy(std::vector<std::string>& e_names, bool propagagetDown)
 Internal::M3DCommandResultIfc* GeomManager::
 destroy(std::vector<Geom::GeomEntity*>& entities, bool propagagetDown)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::destroy(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    if(propagagetDown)
-        message <<", true)";
-    else
-        message <<", false)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::destroy(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        if(propagagetDown)
+            message <<", true)";
+        else
+            message <<", false)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -935,15 +926,17 @@ destroyWithTopo(std::vector<std::string>& e_names, bool propagagetDown)
 Internal::M3DCommandResultIfc* GeomManager::
 destroyWithTopo(std::vector<Geom::GeomEntity*>& entities, bool propagagetDown)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::destroyWithTopo(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    if(propagagetDown)
-        message <<", true)";
-    else
-        message <<", false)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::destroyWithTopo(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        if(propagagetDown)
+            message <<", true)";
+        else
+            message <<", false)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -1015,12 +1008,14 @@ scale(std::vector<Geom::GeomEntity*>& entities, const double factor, const Point
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::scale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factor<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1071,9 +1066,7 @@ scale(std::vector<Geom::GeomEntity*>& entities, const double factor, const Point
 Internal::M3DCommandResultIfc* GeomManager::
 scaleAll(const double factor, const Point& pcentre)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scaleAll("<<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::scaleAll("<<factor<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getLocalContext(), "Homothétie de tout");
@@ -1127,12 +1120,14 @@ scale(std::vector<Geom::GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factorX<<", "<<factorY<<", "<<factorZ<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::scale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factorX<<", "<<factorY<<", "<<factorZ<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1183,9 +1178,7 @@ scaleAll(const double factorX,
 		const double factorY,
 		const double factorZ)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scaleAll("<<factorX<<", "<<factorY<<", "<<factorZ<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::scaleAll("<<factorX<<", "<<factorY<<", "<<factorZ<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getLocalContext(), "Homothétie de tout");
@@ -1240,12 +1233,14 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities, const double factor, cons
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndScale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factor<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1311,9 +1306,7 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities, const double factor, cons
 Internal::M3DCommandResultIfc* GeomManager::
 copyAndScaleAll(const double factor, const Point& pcentre, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScaleAll("<<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::copyAndScaleAll("<<factor<<")");
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getLocalContext(), "Homothétie d'une copie de tout");
@@ -1381,12 +1374,14 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factorX<<", "<<factorY<<", "<<factorZ<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndScale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factorX<<", "<<factorY<<", "<<factorZ<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1452,9 +1447,7 @@ copyAndScaleAll(const double factorX,
 		const double factorZ,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScaleAll("<<factorX<<", "<<factorY<<", "<<factorZ<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::copyAndScaleAll("<<factorX<<", "<<factorY<<", "<<factorZ<<")");
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getLocalContext(), "Homothétie d'une copie de tout");
@@ -1511,12 +1504,14 @@ mirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plane)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la symétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::mirror(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<*plane<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::mirror(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<*plane<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1583,12 +1578,14 @@ copyAndMirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plan
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la symétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndMirror(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<*plane<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndMirror(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<*plane<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1654,12 +1651,14 @@ copyAndMirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plan
 Internal::M3DCommandResultIfc* GeomManager::
 newBox(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newBox ("<<pmin<<", "<<pmax;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newBox ("<<pmin<<", "<<pmax;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     //creation de la commande de création
     CommandNewBox *command = new CommandNewBox(getLocalContext(),pmin,pmax, groupName);
@@ -1685,12 +1684,14 @@ Internal::M3DCommandResultIfc* GeomManager::
 newCylinder(const Utils::Math::Point& pcentre, const double& dr,
             const Utils::Math::Vector& dv, const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCylinder *command = new CommandNewCylinder(getLocalContext(), pcentre, dr, dv,da, groupName);
 
@@ -1717,12 +1718,14 @@ Internal::M3DCommandResultIfc* GeomManager::
 newCylinder(const Utils::Math::Point& pcentre, const double& dr,
             const Utils::Math::Vector& dv, const Utils::Portion::Type& dt, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCylinder *command = new CommandNewCylinder(getLocalContext(), pcentre, dr, dv,dt, groupName);
 
@@ -1754,16 +1757,18 @@ newHollowCylinder(
         const double& da,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowCylinder("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<dv<<", "<<da;
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowCylinder("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<dv<<", "<<da;
 
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowCylinder *command =
             new CommandNewHollowCylinder(getLocalContext(), pcentre, dr_int, dr_ext,
@@ -1798,15 +1803,17 @@ newHollowCylinder(
         const Utils::Portion::Type& dt,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowCylinder("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowCylinder("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowCylinder *command =
             new CommandNewHollowCylinder(getLocalContext(), pcentre, dr_int, dr_ext,
@@ -1837,12 +1844,14 @@ Internal::M3DCommandResultIfc* GeomManager::
 newSphere(const Utils::Math::Point& pcentre, const double& dr,
             const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewSphere *command = new CommandNewSphere(getLocalContext(), pcentre, dr,da, groupName);
 
@@ -1867,12 +1876,14 @@ Internal::M3DCommandResultIfc* GeomManager::
 newSphere(const Utils::Math::Point& pcentre, const double& dr,
           const Utils::Portion::Type& dt, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewSphere *command = new CommandNewSphere(getLocalContext(), pcentre, dr,dt, groupName);
     // trace dans le script
@@ -1952,12 +1963,14 @@ newHollowSphere(
         const double& da,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowSphere("<<pcentre<<", "<<dr_int<<", "<<dr_ext<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowSphere("<<pcentre<<", "<<dr_int<<", "<<dr_ext<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowSphere *command =
             new CommandNewHollowSphere(getLocalContext(), pcentre, dr_int, dr_ext,da, groupName);
@@ -1989,15 +2002,17 @@ newHollowSphere(
         const Utils::Portion::Type& dt,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowSphere("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowSphere("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowSphere *command =
             new CommandNewHollowSphere(getLocalContext(), pcentre, dr_int,dr_ext, dt, groupName);
@@ -2024,12 +2039,14 @@ Mgx3D::Internal::M3DCommandResultIfc*
 GeomManager::newCone(const double& dr1, const double& dr2,
    		const Vector& dv, const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCone *command = new CommandNewCone(getLocalContext(), dr1, dr2, dv, da, groupName);
 
@@ -2056,12 +2073,14 @@ Mgx3D::Internal::M3DCommandResultIfc*
 GeomManager::newCone(const double& dr1, const double& dr2,
    		const Vector& dv, const  Utils::Portion::Type& dt, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCone *command = new CommandNewCone(getLocalContext(), dr1, dr2, dv, dt, groupName);
 
@@ -2119,10 +2138,8 @@ newArcCircle(const double& angleDep,
 Internal::M3DCommandResultIfc* GeomManager::
 newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
+            <<", "<<(short)direct<<")");
     Vector normal(0,0,1);
 
     CommandNewArcCircle *command =
@@ -2149,10 +2166,8 @@ newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string
 Internal::M3DCommandResultIfc* GeomManager::
 newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, const Vector& normal, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
+            <<", "<<(short)direct<<")");
 
     CommandNewArcCircle *command =
             new CommandNewArcCircle(getLocalContext(), pc,pd,pe,direct, normal, groupName);
@@ -2221,9 +2236,7 @@ newCircle(std::string p1,std::string p2, std::string p3, std::string groupName)
 Internal::M3DCommandResultIfc* GeomManager::
 newCircle(Vertex* p1, Vertex* p2, Vertex* p3, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCircle("<<*p1<<", "<<*p2<<", "<<*p3<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newCircle("<<*p1<<", "<<*p2<<", "<<*p3<<")");
 
     CommandNewCircle *command =
             new CommandNewCircle(getLocalContext(), p1,p2,p3, groupName);
@@ -2257,10 +2270,8 @@ newArcEllipse(std::string pc,std::string pd, std::string pe, const bool direct,
 Internal::M3DCommandResultIfc* GeomManager::
 newArcEllipse(  Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcEllipse("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newArcEllipse("<<*pc<<", "<<*pd<<", "<<*pe
+            <<", "<<(short)direct<<")");
 
     CommandNewArcEllipse *command =
             new CommandNewArcEllipse(getLocalContext(),pc,pd,pe,direct, groupName);
@@ -2304,13 +2315,11 @@ newBSpline(Vertex* vtx1,
 		int deg_max,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newBSpline("
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::newBSpline("
     		<<vtx1->getName()<<","
 			<< vp.size()<<" Points, "
 			<<vtx2->getName()<<")";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     CommandNewBSpline *command =
             new CommandNewBSpline(getLocalContext(), vtx1, vp, vtx2, deg_min, deg_max, groupName);
@@ -2354,12 +2363,14 @@ newPrism(GeomEntity* base, const Utils::Math::Vector& dv, std::string groupName)
     warning <<"La fonction newPrism est obsolete, il est préférable d'utiliser makeExtrude";
     log (TkUtil::TraceLog (warning, TkUtil::Log::WARNING));
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newPrism("<<base->getName()<<", "<<dv;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newPrism("<<base->getName()<<", "<<dv;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = new CommandNewPrism(getLocalContext(), base, dv,groupName);
 
@@ -2421,12 +2432,14 @@ translate(std::vector<GeomEntity*>& entities, const Vector& dp)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::translate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::translate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<dp<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -2473,9 +2486,7 @@ translate(std::vector<GeomEntity*>& entities, const Vector& dp)
 Internal::M3DCommandResultIfc* GeomManager::
 translateAll(const Vector& dp)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::translateAll("<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::translateAll("<<dp<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getLocalContext(), "Translation de tout");
@@ -2518,12 +2529,14 @@ copyAndTranslate(std::vector<GeomEntity*>& entities, const Vector& dp, bool with
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndTranslate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<dp<<", \""<<groupName<<"\")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndTranslate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<dp<<", \""<<groupName<<"\")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -2587,9 +2600,7 @@ copyAndTranslate(std::vector<GeomEntity*>& entities, const Vector& dp, bool with
 Internal::M3DCommandResultIfc* GeomManager::
 copyAndTranslateAll(const Vector& dp, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndTranslateAll("<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::copyAndTranslateAll("<<dp<<")");
 
     Internal::CommandComposite*   command =
 			new Internal::CommandComposite(getLocalContext(), "Translation d'une copie de tout");
@@ -2641,12 +2652,14 @@ joinCurves(std::vector<std::string>& entities){
 Internal::M3DCommandResultIfc* GeomManager::
 joinCurves(std::vector<GeomEntity*>& entities)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::joinCurves(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::joinCurves(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2710,12 +2723,14 @@ joinSurfaces(std::vector<std::string>& entities){
 Internal::M3DCommandResultIfc* GeomManager::
 joinSurfaces(std::vector<GeomEntity*>& entities)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::joinSurfaces(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::joinSurfaces(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2785,11 +2800,13 @@ rotate( std::vector<GeomEntity*>& entities, const Utils::Math::Rotation& rot)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la rotation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::rotate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::rotate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2841,9 +2858,7 @@ rotate( std::vector<GeomEntity*>& entities, const Utils::Math::Rotation& rot)
 Internal::M3DCommandResultIfc* GeomManager::
 rotateAll(const Utils::Math::Rotation& rot)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::rotateAll("<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::rotateAll("<<rot<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getLocalContext(), "Rotation de tout");
@@ -2892,11 +2907,13 @@ copyAndRotate( std::vector<GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la rotation avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndRotate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndRotate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -2964,9 +2981,7 @@ Internal::M3DCommandResultIfc* GeomManager::
 copyAndRotateAll(const Utils::Math::Rotation& rot,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndRotateAll("<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::copyAndRotateAll("<<rot<<")");
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getLocalContext(), "Rotation d'une copie de tout");
@@ -3021,11 +3036,13 @@ makeRevol( std::vector<GeomEntity*>& entities,
         const Utils::Math::Rotation& rot,
         const bool keep)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeRevol(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<(keep?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeRevol(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<(keep?"True":"False")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandExtrudeRevolution *command =
             new CommandExtrudeRevolution(getLocalContext(), entities,rot,keep);
@@ -3062,11 +3079,13 @@ Internal::M3DCommandResultIfc* GeomManager::
 makeExtrude( std::vector<GeomEntity*>& entities,
 		const Vector& dp, const bool keep)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeExtrude(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeExtrude(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<dp<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandExtrudeDirection *command =
             new CommandExtrudeDirection(getLocalContext(), entities, dp, keep);
@@ -3102,11 +3121,13 @@ makeBlocksByExtrude(std::vector<std::string>& entities,
 Internal::M3DCommandResultIfc* GeomManager::
 makeBlocksByExtrude(std::vector<GeomEntity*>& entities, const Utils::Math::Vector& dv, const bool keep)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeBlocksByExtrude(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<dv<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeBlocksByExtrude(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<dv<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -3172,15 +3193,17 @@ fuse(std::vector<std::string>& entities)
 Internal::M3DCommandResultIfc* GeomManager::
 fuse(std::vector<GeomEntity*>& entities)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::fuse (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::fuse (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -3237,15 +3260,17 @@ common(std::vector<std::string>& entities)
 Internal::M3DCommandResultIfc* GeomManager::
 common(std::vector<Geom::GeomEntity*>& entities)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::common (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::common (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -3391,9 +3416,7 @@ common2DOnCopy(Geom::GeomEntity* entity1, Geom::GeomEntity* entity2, std::string
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::importSTEP(std::string n, const bool testVolumicProperties, const bool splitCompoundCurves)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importSTEP ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importSTEP ("<<n<<")");
 
     //creation de la commande de création
     CommandImportSTEP *command = new CommandImportSTEP(getLocalContext(), n, testVolumicProperties, splitCompoundCurves);
@@ -3416,9 +3439,7 @@ Internal::M3DCommandResultIfc* GeomManager::importSTEP(std::string n, const bool
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::importSTL(std::string n)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importSTL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importSTL ("<<n<<")");
 
     //creation de la commande de création
     CommandImportSTL *command = new CommandImportSTL(getLocalContext(),n);
@@ -3439,9 +3460,7 @@ Internal::M3DCommandResultIfc* GeomManager::importSTL(std::string n)
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::importIGES(std::string n, const bool splitCompoundCurves)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importIGES ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importIGES ("<<n<<")");
 
     //creation de la commande de création
     CommandImportIGES *command = new CommandImportIGES(getLocalContext(),n, splitCompoundCurves);
@@ -3464,9 +3483,7 @@ Internal::M3DCommandResultIfc* GeomManager::importIGES(std::string n, const bool
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResultIfc* GeomManager::importCATIA(std::string n, const bool testVolumicProperties, const bool splitCompoundCurves)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importCATIA ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importCATIA ("<<n<<")");
 
     //creation de la commande de création
     CommandImportCATIA *command = new CommandImportCATIA(getLocalContext(), n, testVolumicProperties, splitCompoundCurves);
@@ -3491,9 +3508,7 @@ Internal::M3DCommandResultIfc* GeomManager::importMDL(std::string n, const bool
 		std::string prefixName, int deg_min, int deg_max)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl =
@@ -3567,9 +3582,7 @@ Internal::M3DCommandResultIfc* GeomManager::importMDL(std::string n, const bool
 Internal::M3DCommandResultIfc* GeomManager::importMDL(std::string n, std::string groupe)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getLocalContext(), n, groupe);
@@ -3634,9 +3647,7 @@ Internal::M3DCommandResultIfc* GeomManager::importMDL(std::string n, std::string
 Internal::M3DCommandResultIfc* GeomManager::importMDL(std::string n, std::vector<std::string>& zones)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getLocalContext(), n, zones);
@@ -4092,15 +4103,17 @@ cut(std::string tokeep,std::vector<std::string>& tocut)
 Internal::M3DCommandResultIfc* GeomManager::
 cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::cut (";
-    for(unsigned int i=0;i<tocut.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tocut[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::cut (";
+        for(unsigned int i=0;i<tocut.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tocut[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -4166,22 +4179,24 @@ Internal::M3DCommandResultIfc* GeomManager::
 cut(std::vector<Geom::GeomEntity*>& tokeep,
         std::vector<Geom::GeomEntity*>& tocut)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::cut ([";
-    for(unsigned int i=0;i<tokeep.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tokeep[i]->getName();
-    }
-    message<<"], [";
-    for(unsigned int i=0;i<tocut.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tocut[i]->getName();
-    }
-    message<<"])";
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::cut ([";
+        for(unsigned int i=0;i<tokeep.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tokeep[i]->getName();
+        }
+        message<<"], [";
+        for(unsigned int i=0;i<tocut.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tocut[i]->getName();
+        }
+        message<<"])";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -4253,15 +4268,17 @@ glue(std::vector<std::string>& entities)
 Internal::M3DCommandResultIfc* GeomManager::glue( std::vector<Geom::GeomEntity*>& entities)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::glue (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::glue (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
 
@@ -4319,15 +4336,17 @@ Internal::M3DCommandResultIfc* GeomManager::section( std::vector<Geom::GeomEntit
     GeomEntity* tool)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::section ([";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::section ([";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<"], "<<tool->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<"], "<<tool->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
 
@@ -4445,15 +4464,17 @@ sectionByPlane( std::vector<Geom::GeomEntity*>& entities,
                 Utils::Math::Plane* tool, std::string planeGroupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::sectionByPlane ([";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::sectionByPlane ([";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<"], "<<tool->getScriptCommand()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<"], "<<tool->getScriptCommand()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     if (entities.empty()){
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour sectionByPlane", TkUtil::Charset::UTF_8));
@@ -4513,9 +4534,7 @@ Internal::M3DCommandResultIfc* GeomManager::splitCurve(std::string entity, const
 Internal::M3DCommandResultIfc* GeomManager::splitCurve(Geom::Curve* crv, const Point& pt)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::splitCurve ("<<crv->getName()<<", "<<pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "GeomManager::splitCurve ("<<crv->getName()<<", "<<pt<<")");
 
     Internal::CommandInternal* command = 0;
 
@@ -5140,15 +5159,17 @@ std::string GeomManager::getLastVertex() const
 Internal::M3DCommandResultIfc* GeomManager::addToGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::addToGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::addToGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -5225,15 +5246,17 @@ Internal::M3DCommandResultIfc* GeomManager::addToGroup(std::vector<std::string>&
 Internal::M3DCommandResultIfc* GeomManager::removeFromGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::removeFromGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::removeFromGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -5310,15 +5333,17 @@ Internal::M3DCommandResultIfc* GeomManager::removeFromGroup(std::vector<std::str
 Internal::M3DCommandResultIfc* GeomManager::setGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::setGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::setGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -14,6 +14,7 @@
 #include "Geom/Volume.h"
 #include "Geom/OCCGeomRepresentation.h"
 #include "Geom/EntityFactory.h"
+#include "Geom/ShapeSignatureIndex.h"
 /*----------------------------------------------------------------------------*/
 #include "Utils/MgxNumeric.h"
 #include <TkUtil/TraceLog.h>
@@ -686,6 +687,12 @@ void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
     std::vector<GeomEntity*>::iterator it= m_removedEntities.begin();
     std::vector<Volume*> removedVolumes;
     std::vector<GeomEntity*> toKeepInFact;
+    // index des entités conservées et créées, par dimension
+    ShapeSignatureIndex keep_index[4], new_index[4];
+    for (uint d=0; d<4; d++){
+        keep_index[d].setExhaustive(getContext().getGeomPairwiseSearch());
+        new_index[d].setExhaustive(getContext().getGeomPairwiseSearch());
+    }
     while(it!=m_removedEntities.end()){
         GeomEntity* rem_entity = *it;
 #ifdef _DEBUG2
@@ -696,21 +703,21 @@ void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
         {
         	Vertex* e = dynamic_cast<Vertex*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	computeReplacedVertex(e);
+        	computeReplacedVertex(e, keep_index[0]);
         }
         break;
         case 1:
         {
         	Curve* e = dynamic_cast<Curve*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	computeReplacedCurve(e);
+        	computeReplacedCurve(e, keep_index[1], new_index[1]);
         }
         break;
         case 2:
         {
         	Surface* e = dynamic_cast<Surface*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
-        	computeReplacedSurface(e);
+        	computeReplacedSurface(e, keep_index[2], new_index[2]);
         }
         break;
         case 3:
@@ -718,7 +725,7 @@ void GeomModificationBaseClass::buildReplacedList(const bool replaceVolumes){
         	Volume* e = dynamic_cast<Volume*>(rem_entity);
         	CHECK_NULL_PTR_ERROR(e);
         	if(replaceVolumes)
-        		computeReplacedVolume(e);
+        		computeReplacedVolume(e, keep_index[3], new_index[3]);
         	else
         		removedVolumes.push_back(e);
         }
@@ -984,7 +991,8 @@ void GeomModificationBaseClass::rebuildAdjacencyLinks()
     //manageAdjacentEntities(volumesToTest);
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedVertex(Vertex* e)
+void GeomModificationBaseClass::computeReplacedVertex(Vertex* e,
+        ShapeSignatureIndex& keep_index)
 {
     //e est une entité supprimée, on cherche celles l'ayant remplacées
     OCCGeomRepresentation* occ_rep =
@@ -994,9 +1002,12 @@ void GeomModificationBaseClass::computeReplacedVertex(Vertex* e)
     //========================================================================
     // Pour un sommet, c'est forcement une entite conservee qui peut remplacer
     // notre sommet
+    keep_index.update(m_toKeepVertices);
+    std::vector<uint> candidates;
+    keep_index.getCandidates(ShapeSignatureIndex::signature(e), candidates);
     bool is_replaced  = false;
-    for(unsigned int i=0;i<m_toKeepVertices.size() && !is_replaced;i++){
-        Vertex* v = m_toKeepVertices[i];
+    for(uint ic=0;ic<candidates.size() && !is_replaced;ic++){
+        Vertex* v = m_toKeepVertices[candidates[ic]];
         OCCGeomRepresentation* occ_rep_v =
                 dynamic_cast<OCCGeomRepresentation*>(v->getComputationalProperty());
         CHECK_NULL_PTR_ERROR(occ_rep_v);
@@ -1010,12 +1021,21 @@ void GeomModificationBaseClass::computeReplacedVertex(Vertex* e)
     }
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedCurve(Curve* e)
+void GeomModificationBaseClass::computeReplacedCurve(Curve* e,
+        ShapeSignatureIndex& keep_index, ShapeSignatureIndex& new_index)
 {
 	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
 #ifdef _DEBUG2
 	std::cout<<" computeReplacedCurve "<<e->getName()<<" avec "<<loc_reps.size()<<" GeomRepresentation"<<std::endl;
 #endif
+	// seules les courbes dont la signature recouvre celle de e peuvent
+	// l'égaler, la contenir ou être contenues
+	const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(e);
+	std::vector<uint> keep_candidates, new_candidates;
+	keep_index.update(m_toKeepCurves);
+	keep_index.getCandidates(signature, keep_candidates);
+	new_index.update(m_newCurves);
+	new_index.getCandidates(signature, new_candidates);
 
 	for (uint j=0; j<loc_reps.size(); j++){
 		OCCGeomRepresentation* occ_rep =
@@ -1031,8 +1051,8 @@ void GeomModificationBaseClass::computeReplacedCurve(Curve* e)
 	#ifdef _DEBUG2
 		std::cout<<"m_toKeepCurves :"<<std::endl;
 	#endif
-		for(unsigned int i=0;i<m_toKeepCurves.size() && !is_fully_replaced;i++){
-			Curve* c = m_toKeepCurves[i];
+		for(uint ic=0;ic<keep_candidates.size() && !is_fully_replaced;ic++){
+			Curve* c = m_toKeepCurves[keep_candidates[ic]];
 	#ifdef _DEBUG2
 			std::cout<<"  "<<c->getName()<<std::endl;
 	#endif
@@ -1063,8 +1083,8 @@ void GeomModificationBaseClass::computeReplacedCurve(Curve* e)
 	#ifdef _DEBUG2
 		std::cout<<"m_newCurves :"<<std::endl;
 	#endif
-		for(unsigned int i=0;i<m_newCurves.size() && !is_fully_replaced;i++){
-			Curve* c = m_newCurves[i];
+		for(uint ic=0;ic<new_candidates.size() && !is_fully_replaced;ic++){
+			Curve* c = m_newCurves[new_candidates[ic]];
 	#ifdef _DEBUG2
 			std::cout<<"  "<<c->getName()<<std::endl;
 	#endif
@@ -1106,7 +1126,8 @@ void GeomModificationBaseClass::computeReplacedCurve(Curve* e)
 #endif
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
+void GeomModificationBaseClass::computeReplacedSurface(Surface* e,
+        ShapeSignatureIndex& keep_index, ShapeSignatureIndex& new_index)
 {
 #ifdef _DEBUG2
 	std::cout<<" computeReplacedSurface("<<e->getName()<<")"<<std::endl;
@@ -1114,6 +1135,13 @@ void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
 
 	std::vector<GeomRepresentation*> loc_reps = e->getComputationalProperties();
 
+	const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(e);
+	std::vector<uint> keep_candidates, new_candidates;
+	keep_index.update(m_toKeepSurfaces);
+	keep_index.getCandidates(signature, keep_candidates);
+	new_index.update(m_newSurfaces);
+	new_index.getCandidates(signature, new_candidates);
+
 	for (uint j=0; j<loc_reps.size(); j++){
 		OCCGeomRepresentation* occ_rep =
 				dynamic_cast<OCCGeomRepresentation*>(loc_reps[j]);
@@ -1124,10 +1152,10 @@ void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
 		// nouvelle
 		bool is_fully_replaced  = false;
 		bool is_partly_replaced = false;
-		for(unsigned int i=0;i<m_toKeepSurfaces.size() && !is_fully_replaced;i++){
-			Surface* s = m_toKeepSurfaces[i];
+		for(uint ic=0;ic<keep_candidates.size() && !is_fully_replaced;ic++){
+			Surface* s = m_toKeepSurfaces[keep_candidates[ic]];
 #ifdef _DEBUG2
-			std::cout<<"  m_toKeepSurfaces["<<i<<"] : "<<s->getName()<<std::endl;
+			std::cout<<"  m_toKeepSurfaces["<<keep_candidates[ic]<<"] : "<<s->getName()<<std::endl;
 #endif
 			std::vector<GeomRepresentation*> loc_reps_s = s->getComputationalProperties();
 			if (loc_reps_s.size() == 1){
@@ -1155,10 +1183,10 @@ void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
 		}
 
 		//========================================================================
-		for(unsigned int i=0;i<m_newSurfaces.size() && !is_fully_replaced;i++){
-			Surface* s = m_newSurfaces[i];
+		for(uint ic=0;ic<new_candidates.size() && !is_fully_replaced;ic++){
+			Surface* s = m_newSurfaces[new_candidates[ic]];
 #ifdef _DEBUG2
-			std::cout<<"  m_newSurfaces["<<i<<"] : "<<s->getName()<<std::endl;
+			std::cout<<"  m_newSurfaces["<<new_candidates[ic]<<"] : "<<s->getName()<<std::endl;
 #endif
 			std::vector<GeomRepresentation*> loc_reps_s = s->getComputationalProperties();
 			if (loc_reps_s.size() == 1){
@@ -1194,7 +1222,8 @@ void GeomModificationBaseClass::computeReplacedSurface(Surface* e)
 #endif
 }
 /*----------------------------------------------------------------------------*/
-void GeomModificationBaseClass::computeReplacedVolume(Volume* e)
+void GeomModificationBaseClass::computeReplacedVolume(Volume* e,
+        ShapeSignatureIndex& keep_index, ShapeSignatureIndex& new_index)
 {
 	//e est une entité supprimée, on cherche celles l'ayant remplacées
 	OCCGeomRepresentation* occ_rep =
@@ -1208,12 +1237,20 @@ void GeomModificationBaseClass::computeReplacedVolume(Volume* e)
 	//========================================================================
 	// Cela peut être une entité conservée (cas d'un glue par exemple) ou
 	// nouvelle
+	const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(e);
+	std::vector<uint> keep_candidates, new_candidates;
+	// m_toKeepVolumes peut avoir été complété par les appels précédents
+	keep_index.update(m_toKeepVolumes);
+	keep_index.getCandidates(signature, keep_candidates);
+	new_index.update(m_newVolumes);
+	new_index.getCandidates(signature, new_candidates);
+
 	bool is_fully_replaced  = false;
 	bool is_partly_replaced = false;
-	for(unsigned int i=0;i<m_toKeepVolumes.size() && !is_fully_replaced;i++){
-		Volume* s = m_toKeepVolumes[i];
+	for(uint ic=0;ic<keep_candidates.size() && !is_fully_replaced;ic++){
+		Volume* s = m_toKeepVolumes[keep_candidates[ic]];
 #ifdef _DEBUG2
-		std::cout<<"  m_toKeepVolumes["<<i<<"] : "<<s->getName()<<std::endl;
+		std::cout<<"  m_toKeepVolumes["<<keep_candidates[ic]<<"] : "<<s->getName()<<std::endl;
 #endif
 		OCCGeomRepresentation* occ_rep_s =
 				dynamic_cast<OCCGeomRepresentation*>(s->getComputationalProperty());
@@ -1236,8 +1273,8 @@ void GeomModificationBaseClass::computeReplacedVolume(Volume* e)
 		}
 	}
 	//========================================================================
-	for(unsigned int i=0;i<m_newVolumes.size() && !is_fully_replaced;i++){
-		Volume* s = m_newVolumes[i];
+	for(uint ic=0;ic<new_candidates.size() && !is_fully_replaced;ic++){
+		Volume* s = m_newVolumes[new_candidates[ic]];
 		OCCGeomRepresentation* occ_rep_s =
 				dynamic_cast<OCCGeomRepresentation*>(s->getComputationalProperty());
 		CHECK_NULL_PTR_ERROR(occ_rep_s);
@@ -1802,6 +1839,14 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
     }
     ordered_vertices.sort(compareOCCVertex);
 
+    // seuls les sommets de signatures voisines sont comparés par areEquals
+    std::vector<GeomEntity*> ref_entities(m_ref_entities[0].begin(), m_ref_entities[0].end());
+    ShapeSignatureIndex ref_index, new_index;
+    ref_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    new_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    ref_index.update(ref_entities);
+    std::vector<uint> candidates;
+
     Vertex *newVertex=0;
     TopoDS_Vertex newOCCVertex;
 
@@ -1820,11 +1865,12 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
 
         // if the ref entities are not kept new cells must be
         // created to replace them
-        std::list<GeomEntity*>::iterator it = m_ref_entities[0].begin();
-        for(;it!=m_ref_entities[0].end() && !to_keep; it++)
+        const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(V);
+        ref_index.getCandidates(signature, candidates);
+        for(uint ic=0; ic<candidates.size() && !to_keep; ic++)
         {
             //SOMMET COURANT
-            Vertex* current = dynamic_cast<Vertex*>(*it);
+            Vertex* current = dynamic_cast<Vertex*>(ref_entities[candidates[ic]]);
             CHECK_NULL_PTR_ERROR(current);
             //REPRESENTION OCC ASSOCIEE
             OCCGeomRepresentation* occ_rep =
@@ -1853,9 +1899,11 @@ void GeomModificationBaseClass::createNewVertices(const TopoDS_Shape& shape,
         {
             /* s'il n'est dans aucune des entités de référence, on vérifie
              * qu'il n'a pas deja ete ajoute precedemment  */
-            for(unsigned int k=0; k<m_newVertices.size() && !found_in_news;k++)
+            new_index.update(m_newVertices);
+            new_index.getCandidates(signature, candidates);
+            for(uint ic=0; ic<candidates.size() && !found_in_news; ic++)
             {
-                Geom::Vertex* current = m_newVertices[k];
+                Geom::Vertex* current = m_newVertices[candidates[ic]];
                 OCCGeomRepresentation* occ_rep =
                         dynamic_cast<OCCGeomRepresentation*>(current->getComputationalProperty());
                 CHECK_NULL_PTR_ERROR(occ_rep);
@@ -1914,6 +1962,14 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
     }
     sorted_entities.sort(compareOCCEdge);
 
+    // seules les courbes de signatures voisines sont comparées par areEquals
+    std::vector<GeomEntity*> ref_entities(m_ref_entities[1].begin(), m_ref_entities[1].end());
+    ShapeSignatureIndex ref_index, new_index;
+    ref_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    new_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    ref_index.update(ref_entities);
+    std::vector<uint> candidates;
+
     for (std::list<TopoDS_Edge>::iterator iter=sorted_entities.begin();
         		iter!=sorted_entities.end(); ++iter)
     {
@@ -1929,11 +1985,11 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
             // pour chaque courbe de la nouvelle shape, on regarde si
             // cette courbe n'existe pas déjà dans une shape de référence
             // if the ref entities are not kept new cells must be created to replace them
-            std::list<GeomEntity*>::iterator it = m_ref_entities[1].begin();
-
-            for(;it!=m_ref_entities[1].end() && !to_keep; it++)
+            const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(E);
+            ref_index.getCandidates(signature, candidates);
+            for(uint ic=0; ic<candidates.size() && !to_keep; ic++)
             {
-                Curve* current = dynamic_cast<Curve*>(*it);
+                Curve* current = dynamic_cast<Curve*>(ref_entities[candidates[ic]]);
                 CHECK_NULL_PTR_ERROR(current);
 
                 std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
@@ -1962,9 +2018,11 @@ void GeomModificationBaseClass::createNewCurves(const TopoDS_Shape& shape,
             bool found_in_news=false;
             if(!to_keep)
             {
-                for(unsigned int k=0; k<m_newCurves.size() && !found_in_news;k++)
+                new_index.update(m_newCurves);
+                new_index.getCandidates(signature, candidates);
+                for(uint ic=0; ic<candidates.size() && !found_in_news; ic++)
                 {
-                    Curve* current = m_newCurves[k];
+                    Curve* current = m_newCurves[candidates[ic]];
                     std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
                     if (loc_reps.size() == 1){
                     	OCCGeomRepresentation* occ_rep =
@@ -2032,6 +2090,14 @@ void GeomModificationBaseClass::createNewSurfaces(
     	OCCGeomRepresentation::buildIncrementalBRepMesh(F, 0.01); // calcul de la triangulation interne
     }
     sorted_entities.sort(compareOCCFace);
+
+    // seules les surfaces de signatures voisines sont comparées par areEquals
+    std::vector<GeomEntity*> ref_entities(m_ref_entities[2].begin(), m_ref_entities[2].end());
+    ShapeSignatureIndex ref_index, new_index;
+    ref_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    new_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    ref_index.update(ref_entities);
+    std::vector<uint> candidates;
 #ifdef _DEBUG2
     std::cout<<" ==== end sorted_entities.sort ===="<<std::endl;
 #endif
@@ -2056,10 +2122,11 @@ void GeomModificationBaseClass::createNewSurfaces(
     		// pour chaque surface de la nouvelle shape, on regarde si
     		// cette surface n'existe pas déjà dans une shape de référence
 
-    		std::list<GeomEntity*>::iterator it = m_ref_entities[2].begin();
-    		for(;it!=m_ref_entities[2].end() && !to_keep; it++)
+    		const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(F);
+    		ref_index.getCandidates(signature, candidates);
+    		for(uint ic=0; ic<candidates.size() && !to_keep; ic++)
     		{
-    			Surface* current = dynamic_cast<Surface*>(*it);
+    			Surface* current = dynamic_cast<Surface*>(ref_entities[candidates[ic]]);
     			CHECK_NULL_PTR_ERROR(current);
 
     			std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
@@ -2089,9 +2156,11 @@ void GeomModificationBaseClass::createNewSurfaces(
     		bool found_in_news = false;
     		if(!to_keep)
     		{
-    			for(unsigned int k=0; k<m_newSurfaces.size() &&!found_in_news;k++)
+    			new_index.update(m_newSurfaces);
+    			new_index.getCandidates(signature, candidates);
+    			for(uint ic=0; ic<candidates.size() && !found_in_news; ic++)
     			{
-    				Surface* current = m_newSurfaces[k];
+    				Surface* current = m_newSurfaces[candidates[ic]];
     				std::vector<GeomRepresentation*> loc_reps = current->getComputationalProperties();
     				if (loc_reps.size() == 1){
     					OCCGeomRepresentation* occ_rep =
@@ -2161,6 +2230,14 @@ void GeomModificationBaseClass::createNewVolumes(
     }
     sorted_entities.sort(compareOCCSolid);
 
+    // seuls les volumes de signatures voisines sont comparés par areEquals
+    std::vector<GeomEntity*> ref_entities(m_ref_entities[3].begin(), m_ref_entities[3].end());
+    ShapeSignatureIndex ref_index, new_index;
+    ref_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    new_index.setExhaustive(getContext().getGeomPairwiseSearch());
+    ref_index.update(ref_entities);
+    std::vector<uint> candidates;
+
     for (std::list<TopoDS_Solid>::iterator iter=sorted_entities.begin();
         		iter!=sorted_entities.end(); ++iter)
     {
@@ -2172,11 +2249,12 @@ void GeomModificationBaseClass::createNewVolumes(
         // pour chaque volume de la nouvelle shape, on regarde si
         // ce volume n'existe pas déjà dans une shape de référence
 
-        std::list<GeomEntity*>::iterator it = m_ref_entities[3].begin();
+        const ShapeSignatureIndex::Signature signature = ShapeSignatureIndex::signature(V);
+        ref_index.getCandidates(signature, candidates);
         int index=0;
-        for(;it!=m_ref_entities[3].end() && !to_keep; it++)
+        for(uint ic=0; ic<candidates.size() && !to_keep; ic++)
         {
-            Volume* current = dynamic_cast<Volume*>(*it);
+            Volume* current = dynamic_cast<Volume*>(ref_entities[candidates[ic]]);
             CHECK_NULL_PTR_ERROR(current);
             OCCGeomRepresentation* occ_rep =
                     dynamic_cast<OCCGeomRepresentation*>(current->getComputationalProperty());
@@ -2210,9 +2288,11 @@ void GeomModificationBaseClass::createNewVolumes(
         bool found_in_news = false;
         if(!to_keep)
         {
-            for(unsigned int k=0; k<m_newVolumes.size() &&!found_in_news;k++)
+            new_index.update(m_newVolumes);
+            new_index.getCandidates(signature, candidates);
+            for(uint ic=0; ic<candidates.size() && !found_in_news; ic++)
             {
-                Volume* current = m_newVolumes[k];
+                Volume* current = m_newVolumes[candidates[ic]];
 
                 OCCGeomRepresentation* occ_rep =
                         dynamic_cast<OCCGeomRepresentation*>(current->getComputationalProperty());
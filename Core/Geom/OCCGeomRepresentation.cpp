@@ -1446,9 +1446,11 @@ void OCCGeomRepresentation::split(std::vector<Surface*>& surf,
         BRepGProp::LinearProperties(E,pb);
         double res = pb.Mass();
         if(res<Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message <<"Une courbe de taille nulle n'a pas ete creee pour l'entité géométrique "<<owner->getName();
-            m_context.getLogDispatcher().log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+            if (m_context.isLogEnabled (TkUtil::Log::TRACE_3)){
+				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                message <<"Une courbe de taille nulle n'a pas ete creee pour l'entité géométrique "<<owner->getName();
+                m_context.getLogDispatcher().log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+            }
             continue;
         }
 
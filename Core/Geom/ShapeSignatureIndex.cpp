@@ -0,0 +1,282 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ShapeSignatureIndex.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Geom/ShapeSignatureIndex.h"
+#include "Geom/GeomEntity.h"
+#include "Geom/OCCGeomRepresentation.h"
+/*----------------------------------------------------------------------------*/
+#include "Utils/MgxNumeric.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+/*----------------------------------------------------------------------------*/
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <gp_Pnt.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+namespace {
+/// bornes des niveaux de la grille (exposants du pas)
+const int MIN_LEVEL = -60;
+const int MAX_LEVEL = 60;
+/// au delà, les indices de cellules ne sont plus représentables
+const double MAX_CELL_INDEX = 1.e15;
+/*----------------------------------------------------------------------------*/
+void addBox(const Bnd_Box& box, ShapeSignatureIndex::Signature& s)
+{
+    if (box.IsVoid())
+        return;
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    s.add(xmin, ymin, zmin);
+    s.add(xmax, ymax, zmax);
+}
+/*----------------------------------------------------------------------------*/
+/// boite de la shape, sans élargissement
+void addShape(const TopoDS_Shape& sh, ShapeSignatureIndex::Signature& s)
+{
+    if (sh.IsNull())
+        return;
+
+    // même boite que dans OCCGeomRepresentation::areSame (qui dépend de la
+    // triangulation lorsqu'elle existe), et celle calculée sur la géométrie
+    Bnd_Box box, geomBox;
+    box.SetGap(0);
+    geomBox.SetGap(0);
+    BRepBndLib::Add(sh, box);
+    BRepBndLib::Add(sh, geomBox, Standard_False);
+    addBox(box, s);
+    addBox(geomBox, s);
+
+    // les sommets, utilisés par areEquals, peuvent être à la tolérance près
+    // hors de la boite des courbes
+    for (TopExp_Explorer exp(sh, TopAbs_VERTEX); exp.More(); exp.Next()){
+        gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(exp.Current()));
+        s.add(pnt.X(), pnt.Y(), pnt.Z());
+    }
+}
+} // end namespace
+/*----------------------------------------------------------------------------*/
+ShapeSignatureIndex::Signature::Signature()
+: m_void(true)
+{
+    for (uint d=0; d<3; d++){
+        m_min[d] = 0.0;
+        m_max[d] = 0.0;
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool ShapeSignatureIndex::Signature::intersects(const Signature& s) const
+{
+    if (m_void || s.m_void)
+        return true;
+    for (uint d=0; d<3; d++)
+        if (s.m_min[d] > m_max[d] || m_min[d] > s.m_max[d])
+            return false;
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void ShapeSignatureIndex::Signature::add(double x, double y, double z)
+{
+    const double pt[3] = {x, y, z};
+    for (uint d=0; d<3; d++){
+        if (m_void || pt[d] < m_min[d])
+            m_min[d] = pt[d];
+        if (m_void || pt[d] > m_max[d])
+            m_max[d] = pt[d];
+    }
+    m_void = false;
+}
+/*----------------------------------------------------------------------------*/
+void ShapeSignatureIndex::Signature::add(const Signature& s)
+{
+    if (s.m_void)
+        return;
+    add(s.m_min[0], s.m_min[1], s.m_min[2]);
+    add(s.m_max[0], s.m_max[1], s.m_max[2]);
+}
+/*----------------------------------------------------------------------------*/
+void ShapeSignatureIndex::Signature::enlarge()
+{
+    if (m_void)
+        return;
+    double diag2 = 0.0;
+    for (uint d=0; d<3; d++)
+        diag2 += (m_max[d]-m_min[d])*(m_max[d]-m_min[d]);
+    // 1/10 de la diagonale, comme la tolérance de areSame
+    const double margin = 0.1*std::sqrt(diag2) + Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon;
+    for (uint d=0; d<3; d++){
+        m_min[d] -= margin;
+        m_max[d] += margin;
+    }
+}
+/*----------------------------------------------------------------------------*/
+ShapeSignatureIndex::Signature ShapeSignatureIndex::signature(const TopoDS_Shape& sh)
+{
+    Signature s;
+    addShape(sh, s);
+    s.enlarge();
+    return s;
+}
+/*----------------------------------------------------------------------------*/
+ShapeSignatureIndex::Signature ShapeSignatureIndex::signature(GeomEntity* e)
+{
+    Signature s;
+    std::vector<GeomRepresentation*> reps = e->getComputationalProperties();
+    for (uint i=0; i<reps.size(); i++){
+        OCCGeomRepresentation* occ_rep = dynamic_cast<OCCGeomRepresentation*>(reps[i]);
+        // représentation non OCC : signature vide, l'entité reste toujours candidate
+        if (0 == occ_rep)
+            return Signature();
+        addShape(occ_rep->getShape(), s);
+    }
+
+    // les tests d'inclusion (contains) se font sur les bornes de l'entité
+    double bounds[6];
+    e->getBounds(bounds);
+    s.add(bounds[0], bounds[2], bounds[4]);
+    s.add(bounds[1], bounds[3], bounds[5]);
+
+    s.enlarge();
+    return s;
+}
+/*----------------------------------------------------------------------------*/
+ShapeSignatureIndex::ShapeSignatureIndex()
+: m_signatures()
+, m_unbounded()
+, m_levels()
+, m_cells()
+, m_exhaustive(false)
+{
+}
+/*----------------------------------------------------------------------------*/
+int ShapeSignatureIndex::levelOf(const Signature& s)
+{
+    double size = 0.0;
+    for (uint d=0; d<3; d++)
+        size = std::max(size, s.m_max[d]-s.m_min[d]);
+    // size < 2^level
+    int level = MIN_LEVEL;
+    if (size > 0.0)
+        std::frexp(size, &level);
+    return std::max(level, MIN_LEVEL);
+}
+/*----------------------------------------------------------------------------*/
+uint64_t ShapeSignatureIndex::cellKey(int level, int64_t i, int64_t j, int64_t k)
+{
+    // les collisions ne font qu'ajouter des candidats, écartés par Signature::intersects
+    uint64_t key = (uint64_t)(level - MIN_LEVEL);
+    key = key*0x9e3779b97f4a7c15ULL ^ (uint64_t)i;
+    key = key*0x9e3779b97f4a7c15ULL ^ (uint64_t)j;
+    key = key*0x9e3779b97f4a7c15ULL ^ (uint64_t)k;
+    return key;
+}
+/*----------------------------------------------------------------------------*/
+bool ShapeSignatureIndex::cellRange(const Signature& s, int level,
+        int64_t first[3], int64_t last[3])
+{
+    for (uint d=0; d<3; d++){
+        const double f = std::floor(std::ldexp(s.m_min[d], -level));
+        const double l = std::floor(std::ldexp(s.m_max[d], -level));
+        if (std::fabs(f) > MAX_CELL_INDEX || std::fabs(l) > MAX_CELL_INDEX)
+            return false;
+        first[d] = (int64_t)f;
+        last[d] = (int64_t)l;
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void ShapeSignatureIndex::add(const Signature& s)
+{
+    const uint idx = m_signatures.size();
+    m_signatures.push_back(s);
+
+    const int level = levelOf(s);
+    int64_t first[3], last[3];
+    if (s.isVoid() || level > MAX_LEVEL || !cellRange(s, level, first, last)){
+        m_unbounded.push_back(idx);
+        return;
+    }
+
+    uint il = 0;
+    while (il<m_levels.size() && m_levels[il].m_level != level)
+        il++;
+    if (il == m_levels.size()){
+        m_levels.push_back(Level());
+        m_levels.back().m_level = level;
+    }
+    m_levels[il].m_items.push_back(idx);
+
+    // au plus 2 cellules par direction
+    for (int64_t i=first[0]; i<=last[0]; i++)
+        for (int64_t j=first[1]; j<=last[1]; j++)
+            for (int64_t k=first[2]; k<=last[2]; k++)
+                m_cells[cellKey(level, i, j, k)].push_back(idx);
+}
+/*----------------------------------------------------------------------------*/
+void ShapeSignatureIndex::getCandidates(const Signature& s, std::vector<uint>& indices) const
+{
+    indices.clear();
+    if (s.isVoid() || m_exhaustive){
+        // pas de boite (ou recherche exhaustive), tous les candidats sont retenus
+        for (uint i=0; i<m_signatures.size(); i++)
+            indices.push_back(i);
+        return;
+    }
+
+    indices.insert(indices.end(), m_unbounded.begin(), m_unbounded.end());
+    for (uint il=0; il<m_levels.size(); il++){
+        const Level& level = m_levels[il];
+        int64_t first[3], last[3];
+        bool byCells = cellRange(s, level.m_level, first, last);
+        if (byCells){
+            double nbCells = 1.0;
+            for (uint d=0; d<3; d++)
+                nbCells *= (double)(last[d]-first[d]+1);
+            // une grande boite devant le pas du niveau : parcours direct
+            byCells = nbCells <= (double)level.m_items.size();
+        }
+
+        if (!byCells){
+            for (uint n=0; n<level.m_items.size(); n++)
+                if (s.intersects(m_signatures[level.m_items[n]]))
+                    indices.push_back(level.m_items[n]);
+            continue;
+        }
+
+        for (int64_t i=first[0]; i<=last[0]; i++)
+            for (int64_t j=first[1]; j<=last[1]; j++)
+                for (int64_t k=first[2]; k<=last[2]; k++){
+                    Utils::IndexedMap<uint64_t, std::vector<uint> >::const_iterator it =
+                            m_cells.find(cellKey(level.m_level, i, j, k));
+                    if (it == m_cells.end())
+                        continue;
+                    const std::vector<uint>& items = it->second;
+                    for (uint n=0; n<items.size(); n++)
+                        if (s.intersects(m_signatures[items[n]]))
+                            indices.push_back(items[n]);
+                }
+    }
+
+    // ordre d'ajout, une signature pouvant occuper plusieurs cellules
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
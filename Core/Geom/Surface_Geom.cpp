@@ -59,14 +59,14 @@ const char* Surface::typeNameGeomSurface = "GeomSurface";
 
 /*----------------------------------------------------------------------------*/
 Surface::Surface(Internal::Context& ctx, Utils::Property* prop,
-        Utils::DisplayProperties* disp,
+        const Utils::DisplayProperties& disp,
         GeomProperty* gprop, GeomRepresentation* compProp)
 :GeomEntity(ctx, prop, disp, gprop,compProp)
 {
 }
 /*----------------------------------------------------------------------------*/
 Surface::Surface(Internal::Context& ctx, Utils::Property* prop,
-        Utils::DisplayProperties* disp,
+        const Utils::DisplayProperties& disp,
         GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp)
 :GeomEntity(ctx, prop, disp, gprop, compProp)
 {
@@ -40,7 +40,7 @@ namespace Geom {
 /*----------------------------------------------------------------------------*/
 const char* Vertex::typeNameGeomVertex = "GeomVertex";
 /*----------------------------------------------------------------------------*/
-Vertex::Vertex(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+Vertex::Vertex(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
         GeomProperty* gprop, GeomRepresentation* compProp)
 : GeomEntity(ctx, prop, disp, gprop,compProp)
 {
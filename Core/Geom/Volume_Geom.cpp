@@ -77,7 +77,7 @@ bool compareVertex(Vertex* v1, Vertex* v2)
     }
 }
 /*----------------------------------------------------------------------------*/
-Volume::Volume(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+Volume::Volume(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
         GeomProperty* gprop, GeomRepresentation* compProp)
 : GeomEntity(ctx, prop, disp, gprop,compProp)
 {
@@ -0,0 +1,29 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file mgx3dGmshWorker.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ *
+ *  Processus de triangulation GMSH lancé par Magix3D (voir
+ *  Mesh::GMSHFaceTriangulator) :
+ *  mgx3dGmshWorker fichier_requêtes fichier_résultats
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/GMSHFaceTriangulator.h"
+
+#include <iostream>
+/*----------------------------------------------------------------------------*/
+int main (int argc, char* argv [])
+{
+	if (3 != argc)
+	{
+		std::cerr << "Usage : " << argv [0]
+		          << " fichier_requêtes fichier_résultats" << std::endl;
+		return 2;
+	}	// if (3 != argc)
+
+	return Mgx3D::Mesh::GMSHFaceTriangulator::workerMain (argv [1], argv [2]);
+}	// main
+/*----------------------------------------------------------------------------*/
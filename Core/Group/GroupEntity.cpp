@@ -23,7 +23,7 @@ namespace Group {
 /*----------------------------------------------------------------------------*/
 GroupEntity::GroupEntity(Internal::Context& ctx,
                        Utils::Property* prop,
-                       Utils::DisplayProperties* disp,
+                       const Utils::DisplayProperties& disp,
 					   bool isDefaultGroup,
 					   uint level)
 : Internal::InternalEntity (ctx, prop, disp)
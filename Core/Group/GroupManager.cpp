@@ -852,8 +852,8 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
 
     // parcours des groupes pour en déduire la plus grande dimension utilisée
     uint dim = 0;
-    std::map<Group::GroupEntity*, Internal::InfoCommand::type>& group_entities_info = icmd->getGroupInfoEntity();
-    for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::iterator iter_grp = group_entities_info.begin();
+    Internal::InfoCommand::GroupInfoMap& group_entities_info = icmd->getGroupInfoEntity();
+    for (Internal::InfoCommand::GroupInfoMap::iterator iter_grp = group_entities_info.begin();
                     iter_grp != group_entities_info.end(); ++iter_grp){
         Group::GroupEntity* grp = iter_grp->first;
         //Internal::InfoCommand::type& t = iter_grp->second;
@@ -867,7 +867,7 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
     std::cout<<" dim (max) = "<<dim<<std::endl;
 #endif
     // les groupes de la plus grande dimension rencontrée sont rendus visibles
-    for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::iterator iter_grp = group_entities_info.begin();
+    for (Internal::InfoCommand::GroupInfoMap::iterator iter_grp = group_entities_info.begin();
     		iter_grp != group_entities_info.end(); ++iter_grp){
     	Group::GroupEntity* grp = iter_grp->first;
     	Internal::InfoCommand::type& t = iter_grp->second;
@@ -904,9 +904,9 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
             ge->getDisplayProperties ( ).setDisplayed(filtre_geom[ge] == 1);
     } // end for i<icmd->getNbGeomInfoEntity()
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd->getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap& topo_entities_info = icmd->getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = (*iter_tei).first;
         Internal::InfoCommand::type t = iter_tei->second;
@@ -1845,27 +1845,25 @@ void GroupManager::get(const std::vector<std::string>& vg, std::vector<Geom::Ver
 /*----------------------------------------------------------------------------*/
 void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::Block*>& blocks)
 {
-	std::set<Topo::Block*> initTopoEntities;
+	std::vector<Topo::Block*> initTopoEntities;
 
 	for (uint i=0; i<vg.size(); i++){
 		Group3D* gr3d = getGroup3D(vg[i], false);
 		if (gr3d){
 			Topo::TopoHelper::get(gr3d->getVolumes(), initTopoEntities);
 			std::vector<Topo::Block*>& te = gr3d->getBlocks();
-			initTopoEntities.insert(te.begin(), te.end());
+			Topo::TopoHelper::addUnique(te, initTopoEntities);
 		}
 	}
 
-	for (std::set<Topo::Block*>::iterator iter = initTopoEntities.begin();
-			iter != initTopoEntities.end(); ++iter)
-		blocks.push_back((*iter));
+	blocks.insert(blocks.end(), initTopoEntities.begin(), initTopoEntities.end());
 }
 /*----------------------------------------------------------------------------*/
 void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::CoFace*>& cofaces)
 {
 	bool propagate = getPropagate();
 
-	std::set<Topo::CoFace*> initTopoEntities;
+	std::vector<Topo::CoFace*> initTopoEntities;
 
 	for (uint i=0; i<vg.size(); i++){
 		Group3D* gr3d = getGroup3D(vg[i], false);
@@ -1878,21 +1876,19 @@ void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::CoF
 			if (gr2d){
 				Topo::TopoHelper::get(gr2d->getSurfaces(), initTopoEntities);
 				std::vector<Topo::CoFace*>& te = gr2d->getCoFaces();
-				initTopoEntities.insert(te.begin(), te.end());
+				Topo::TopoHelper::addUnique(te, initTopoEntities);
 			}
 		}
 	}
 
-	for (std::set<Topo::CoFace*>::iterator iter = initTopoEntities.begin();
-			iter != initTopoEntities.end(); ++iter)
-		cofaces.push_back((*iter));
+	cofaces.insert(cofaces.end(), initTopoEntities.begin(), initTopoEntities.end());
 }
 /*----------------------------------------------------------------------------*/
 void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::CoEdge*>& coedges)
 {
 	bool propagate = getPropagate();
 
-	std::set<Topo::CoEdge*> initTopoEntities;
+	std::vector<Topo::CoEdge*> initTopoEntities;
 
 	for (uint i=0; i<vg.size(); i++){
 		Group3D* gr3d = getGroup3D(vg[i], false);
@@ -1911,22 +1907,20 @@ void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::CoE
 				if (gr1d){
 					Topo::TopoHelper::get(gr1d->getCurves(), initTopoEntities);
 					std::vector<Topo::CoEdge*>& te = gr1d->getCoEdges();
-					initTopoEntities.insert(te.begin(), te.end());
+					Topo::TopoHelper::addUnique(te, initTopoEntities);
 				}
 			}
 		}
 	}
 
-	for (std::set<Topo::CoEdge*>::iterator iter = initTopoEntities.begin();
-			iter != initTopoEntities.end(); ++iter)
-		coedges.push_back((*iter));
+	coedges.insert(coedges.end(), initTopoEntities.begin(), initTopoEntities.end());
 }
 /*----------------------------------------------------------------------------*/
 void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::Vertex*>& vertices)
 {
 	bool propagate = getPropagate();
 
-	std::set<Topo::Vertex*> initTopoEntities;
+	std::vector<Topo::Vertex*> initTopoEntities;
 
 	for (uint i=0; i<vg.size(); i++){
 		Group3D* gr3d = getGroup3D(vg[i], false);
@@ -1951,7 +1945,7 @@ void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::Ver
 					if (gr0d){
 						Topo::TopoHelper::get(gr0d->getVertices(), initTopoEntities);
 						std::vector<Topo::Vertex*>& te = gr0d->getTopoVertices();
-						initTopoEntities.insert(te.begin(), te.end());
+						Topo::TopoHelper::addUnique(te, initTopoEntities);
 					}
 
 				}
@@ -1959,9 +1953,7 @@ void GroupManager::get(const std::vector<std::string>& vg, std::vector<Topo::Ver
 		}
 	}
 
-	for (std::set<Topo::Vertex*>::iterator iter = initTopoEntities.begin();
-			iter != initTopoEntities.end(); ++iter)
-		vertices.push_back((*iter));
+	vertices.insert(vertices.end(), initTopoEntities.begin(), initTopoEntities.end());
 }
 
 /*------------------------------------------------------------------------*/
@@ -2212,43 +2204,30 @@ void GroupManager::addProjectionOnPZ0(const std::string& nom)
 /*----------------------------------------------------------------------------*/
 void GroupManager::addCartesianPerturbation(const std::string& nom, PyObject* py_obj)
 {
-	PyObject* pyName = PyObject_GetAttrString(py_obj, "func_name");
-#ifdef _DEBUG2
-	std::cout<<"GroupManager::addCartesianPerturbation("<<nom<<", "<<PyString_AsString(pyName)<<")"<<std::endl;
-#endif
-	// recherche du groupe 2D ou 3D
-	Group2D* gr2d = getGroup2D(nom, false);
-	Group3D* gr3d = getGroup3D(nom, false);
-
-	if (gr2d==0 && gr3d==0){
-		TkUtil::UTF8String messErr (TkUtil::Charset::UTF_8);
-		messErr <<"On ne trouve pas "<<nom<<" dans le GroupManager parmis les groupes 2D et 3D";
-		throw TkUtil::Exception(messErr);
-	}
-
-	GroupEntity* grp = gr3d;
-	if (gr2d && !gr2d->isDestroyed())
-		grp = gr2d;
-
-	// création de l'objet qui va modifier le maillage
-	Mesh::MeshModificationItf* modif = new Mesh::MeshModificationByPythonFunction(py_obj,
-			Mesh::MeshModificationByPythonFunction::cartesian);
-	CommandAddMeshModification* command = new CommandAddMeshModification(getLocalContext(), grp, modif);
-
-    // trace dans le script
-    TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
-    cmd << getContextAlias() << "." << "getGroupManager().addCartesianPerturbation (\""
-        << nom<<"\", "<<PyString_AsString(pyName)<<")";
-    command->setScriptCommand(cmd);
-
-    getContext().getCommandManager().addCommand(command, Utils::Command::DO);
+	addPythonPerturbation(nom, py_obj, false, false, "addCartesianPerturbation");
 }
 /*----------------------------------------------------------------------------*/
 void GroupManager::addPolarPerturbation(const std::string& nom, PyObject* py_obj)
 {
-	PyObject* pyName = PyObject_GetAttrString(py_obj, "func_name");
+	addPythonPerturbation(nom, py_obj, true, false, "addPolarPerturbation");
+}
+/*----------------------------------------------------------------------------*/
+void GroupManager::addCartesianBatchPerturbation(const std::string& nom, PyObject* py_obj)
+{
+	addPythonPerturbation(nom, py_obj, false, true, "addCartesianBatchPerturbation");
+}
+/*----------------------------------------------------------------------------*/
+void GroupManager::addPolarBatchPerturbation(const std::string& nom, PyObject* py_obj)
+{
+	addPythonPerturbation(nom, py_obj, true, true, "addPolarBatchPerturbation");
+}
+/*----------------------------------------------------------------------------*/
+void GroupManager::addPythonPerturbation(const std::string& nom, PyObject* py_obj,
+		bool polar, bool batch, const std::string& methodName)
+{
+	PyObject* pyName = PyObject_GetAttrString(py_obj, "__name__");
 #ifdef _DEBUG2
-	std::cout<<"GroupManager::addPolarPerturbation("<<nom<<", "<<PyString_AsString(pyName)<<")"<<std::endl;
+	std::cout<<"GroupManager::"<<methodName<<"("<<nom<<", "<<PyString_AsString(pyName)<<")"<<std::endl;
 #endif
 	// recherche du groupe 2D ou 3D
 	Group2D* gr2d = getGroup2D(nom, false);
@@ -2261,17 +2240,18 @@ void GroupManager::addPolarPerturbation(const std::string& nom, PyObject* py_obj
 	}
 
 	GroupEntity* grp = gr3d;
-	if (gr2d)
+	if (gr2d && !gr2d->isDestroyed())
 		grp = gr2d;
 
 	// création de l'objet qui va modifier le maillage
 	Mesh::MeshModificationItf* modif = new Mesh::MeshModificationByPythonFunction(py_obj,
-			Mesh::MeshModificationByPythonFunction::polar);
+			polar ? Mesh::MeshModificationByPythonFunction::polar : Mesh::MeshModificationByPythonFunction::cartesian,
+			batch);
 	CommandAddMeshModification* command = new CommandAddMeshModification(getLocalContext(), grp, modif);
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
-    cmd << getContextAlias() << "." << "getGroupManager().addPolarPerturbation (\""
+    cmd << getContextAlias() << "." << "getGroupManager()." << methodName << " (\""
         << nom<<"\", "<<PyString_AsString(pyName)<<")";
     command->setScriptCommand(cmd);
 
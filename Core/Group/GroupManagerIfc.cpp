@@ -199,6 +199,16 @@ void GroupManagerIfc::addPolarPerturbation(const std::string& nom, PyObject* py_
 	throw TkUtil::Exception ("GroupManagerIfc::addPolarPerturbation should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
+void GroupManagerIfc::addCartesianBatchPerturbation(const std::string& nom, PyObject* py_obj)
+{
+	throw TkUtil::Exception ("GroupManagerIfc::addCartesianBatchPerturbation should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
+void GroupManagerIfc::addPolarBatchPerturbation(const std::string& nom, PyObject* py_obj)
+{
+	throw TkUtil::Exception ("GroupManagerIfc::addPolarBatchPerturbation should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
 void GroupManagerIfc::addSmoothing(const std::string& nom, Mesh::SurfacicSmoothing& sm)
 {
 	throw TkUtil::Exception ("GroupManagerIfc::addSmoothing surfacic should be overloaded.");
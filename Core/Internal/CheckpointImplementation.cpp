@@ -0,0 +1,1710 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CheckpointImplementation.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Internal/CheckpointImplementation.h"
+#include "Internal/CommandRestoreCheckpoint.h"
+#include "Internal/Context.h"
+#include "Internal/InfoCommand.h"
+#include "Internal/NameManager.h"
+#include "Utils/Property.h"
+#include "Geom/GeomManager.h"
+#include "Geom/GeomProperty.h"
+#include "Geom/OCCGeomRepresentation.h"
+#include "Geom/Vertex.h"
+#include "Geom/Curve.h"
+#include "Geom/Surface.h"
+#include "Geom/Volume.h"
+#include "Topo/TopoManager.h"
+#include "Topo/Vertex.h"
+#include "Topo/CoEdge.h"
+#include "Topo/Edge.h"
+#include "Topo/CoFace.h"
+#include "Topo/Face.h"
+#include "Topo/Block.h"
+#include "Topo/EdgeMeshingPropertyUniform.h"
+#include "Topo/EdgeMeshingPropertyGeometric.h"
+#include "Topo/EdgeMeshingPropertyBigeometric.h"
+#include "Topo/EdgeMeshingPropertyHyperbolic.h"
+#include "Topo/EdgeMeshingPropertySpecificSize.h"
+#include "Topo/EdgeMeshingPropertyInterpolate.h"
+#include "Topo/EdgeMeshingPropertyGlobalInterpolate.h"
+#include "Topo/EdgeMeshingPropertyTabulated.h"
+#include "Topo/EdgeMeshingPropertyBeta.h"
+#include "Topo/EdgeMeshingPropertyUniformSmoothFix.h"
+#include "Topo/FaceMeshingPropertyDirectional.h"
+#include "Topo/FaceMeshingPropertyOrthogonal.h"
+#include "Topo/FaceMeshingPropertyRotational.h"
+#include "Topo/FaceMeshingPropertyTransfinite.h"
+#include "Topo/FaceMeshingPropertyDelaunayGMSH.h"
+#include "Topo/FaceMeshingPropertyQuadPairing.h"
+#ifdef USE_MESHGEMS
+#include "Topo/FaceMeshingPropertyMeshGems.h"
+#include "Topo/BlockMeshingPropertyDelaunayMeshGems.h"
+#endif	// USE_MESHGEMS
+#include "Topo/BlockMeshingPropertyDirectional.h"
+#include "Topo/BlockMeshingPropertyOrthogonal.h"
+#include "Topo/BlockMeshingPropertyRotational.h"
+#include "Topo/BlockMeshingPropertyTransfinite.h"
+#include "Topo/BlockMeshingPropertyDelaunayTetgen.h"
+#include "Topo/BlockMeshingPropertyInsertion.h"
+#include "Group/GroupManager.h"
+#include "Group/Group0D.h"
+#include "Group/Group1D.h"
+#include "Group/Group2D.h"
+#include "Group/Group3D.h"
+#include "Mesh/MeshManager.h"
+#include "Mesh/MeshItf.h"
+#include "Mesh/Cloud.h"
+#include "Mesh/Line.h"
+#include "Mesh/Surface.h"
+#include "Mesh/Volume.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IGMesh.h>
+/*----------------------------------------------------------------------------*/
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdint.h>
+#include <set>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+const unsigned int CheckpointImplementation::s_version = 1;
+/*----------------------------------------------------------------------------*/
+/// marque en début de fichier
+static const char s_magic[] = "MGX3DCKP";
+/*----------------------------------------------------------------------------*/
+// Codes stables des méthodes de discrétisation des faces et des blocs,
+// les énumérés de CoFaceMeshingProperty et BlockMeshingProperty
+// dépendant de USE_MESHGEMS
+static const int s_face_directional   = 0;
+static const int s_face_orthogonal    = 1;
+static const int s_face_rotational    = 2;
+static const int s_face_transfinite   = 3;
+static const int s_face_delaunayGMSH  = 4;
+static const int s_face_quadPairing   = 5;
+static const int s_face_meshGems      = 6;
+
+static const int s_block_directional      = 0;
+static const int s_block_orthogonal       = 1;
+static const int s_block_rotational       = 2;
+static const int s_block_transfinite      = 3;
+static const int s_block_delaunayTetgen   = 4;
+static const int s_block_delaunayMeshGems = 5;
+static const int s_block_insertion        = 6;
+/*----------------------------------------------------------------------------*/
+// Les entiers et les réels sont écrits sur une taille fixe, octets de poids
+// faible en premier, quelle que soit la plateforme
+static void writeUInt64(std::ostream& out, uint64_t val)
+{
+    char bytes[8];
+    for (uint i=0; i<8; i++)
+        bytes[i] = (char)((val >> (8*i)) & 0xff);
+    out.write(bytes, 8);
+}
+/*----------------------------------------------------------------------------*/
+static void writeInt(std::ostream& out, int val)
+{
+    uint32_t u = (uint32_t)(int32_t)val;
+    char bytes[4];
+    for (uint i=0; i<4; i++)
+        bytes[i] = (char)((u >> (8*i)) & 0xff);
+    out.write(bytes, 4);
+}
+/*----------------------------------------------------------------------------*/
+static void writeUnsignedLong(std::ostream& out, unsigned long val)
+{
+    writeUInt64(out, (uint64_t)val);
+}
+/*----------------------------------------------------------------------------*/
+static void writeDouble(std::ostream& out, double val)
+{
+    uint64_t u = 0;
+    std::memcpy(&u, &val, sizeof(double));
+    writeUInt64(out, u);
+}
+/*----------------------------------------------------------------------------*/
+static void writeBool(std::ostream& out, bool val)
+{
+    char c = (val?1:0);
+    out.write(&c, 1);
+}
+/*----------------------------------------------------------------------------*/
+static void writeString(std::ostream& out, const std::string& str)
+{
+    writeUnsignedLong(out, str.size());
+    out.write(str.data(), str.size());
+}
+/*----------------------------------------------------------------------------*/
+static void writePoint(std::ostream& out, const Utils::Math::Point& pt)
+{
+    writeDouble(out, pt.getX());
+    writeDouble(out, pt.getY());
+    writeDouble(out, pt.getZ());
+}
+/*----------------------------------------------------------------------------*/
+static void writeStrings(std::ostream& out, const std::vector<std::string>& strs)
+{
+    writeUnsignedLong(out, strs.size());
+    for (uint i=0; i<strs.size(); i++)
+        writeString(out, strs[i]);
+}
+/*----------------------------------------------------------------------------*/
+static void checkStream(std::istream& in)
+{
+    if (!in)
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise tronqué ou illisible", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+static uint64_t readUInt64(std::istream& in)
+{
+    unsigned char bytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    in.read((char*)bytes, 8);
+    checkStream(in);
+    uint64_t val = 0;
+    for (uint i=0; i<8; i++)
+        val |= ((uint64_t)bytes[i]) << (8*i);
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+static int readInt(std::istream& in)
+{
+    unsigned char bytes[4] = {0, 0, 0, 0};
+    in.read((char*)bytes, 4);
+    checkStream(in);
+    uint32_t val = 0;
+    for (uint i=0; i<4; i++)
+        val |= ((uint32_t)bytes[i]) << (8*i);
+    return (int)(int32_t)val;
+}
+/*----------------------------------------------------------------------------*/
+static unsigned long readUnsignedLong(std::istream& in)
+{
+    uint64_t val = readUInt64(in);
+    if (val > (uint64_t)std::numeric_limits<unsigned long>::max())
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (valeur hors limites)", TkUtil::Charset::UTF_8));
+    return (unsigned long)val;
+}
+/*----------------------------------------------------------------------------*/
+static double readDouble(std::istream& in)
+{
+    uint64_t u = readUInt64(in);
+    double val = 0.0;
+    std::memcpy(&val, &u, sizeof(double));
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+/** Lecture d'un nombre d'éléments occupant chacun au moins itemSize octets
+    dans la suite du fichier. Un nombre plus grand que ce que contient la
+    suite du flux est celui d'un fichier tronqué ou corrompu : il est refusé
+    avant toute allocation. Les petits nombres ne sont pas vérifiés, leur
+    allocation étant sans risque.
+ */
+static unsigned long readSize(std::istream& in, unsigned long itemSize)
+{
+    unsigned long size = readUnsignedLong(in);
+    if (size <= 4096)
+        return size;
+
+    std::streampos current = in.tellg();
+    if (current == std::streampos(-1))
+        return size;
+    in.seekg(0, std::ios::end);
+    std::streampos end = in.tellg();
+    in.seekg(current);
+    checkStream(in);
+    if (end == std::streampos(-1))
+        return size;
+    unsigned long remaining = (unsigned long)(end - current);
+    if (size > remaining / itemSize)
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise tronqué ou illisible", TkUtil::Charset::UTF_8));
+    return size;
+}
+/*----------------------------------------------------------------------------*/
+static bool readBool(std::istream& in)
+{
+    char c = 0;
+    in.read(&c, 1);
+    checkStream(in);
+    return c != 0;
+}
+/*----------------------------------------------------------------------------*/
+static std::string readString(std::istream& in)
+{
+    unsigned long size = readSize(in, 1);
+    std::string str(size, '\0');
+    if (size)
+        in.read(&str[0], size);
+    checkStream(in);
+    return str;
+}
+/*----------------------------------------------------------------------------*/
+static Utils::Math::Point readPoint(std::istream& in)
+{
+    double x = readDouble(in);
+    double y = readDouble(in);
+    double z = readDouble(in);
+    return Utils::Math::Point(x, y, z);
+}
+/*----------------------------------------------------------------------------*/
+static std::vector<std::string> readStrings(std::istream& in)
+{
+    std::vector<std::string> strs(readSize(in, 8));
+    for (uint i=0; i<strs.size(); i++)
+        strs[i] = readString(in);
+    return strs;
+}
+/*----------------------------------------------------------------------------*/
+/// lecture d'un indice dans une table, -1 pour l'absence d'entité
+template <typename T>
+static T* readRef(std::istream& in, const std::vector<T*>& table)
+{
+    int ind = readInt(in);
+    if (ind == -1)
+        return 0;
+    if (ind < 0 || ind >= (int)table.size())
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (indice d'entité hors limites)", TkUtil::Charset::UTF_8));
+    return table[ind];
+}
+/*----------------------------------------------------------------------------*/
+template <typename T>
+static void readRefs(std::istream& in, const std::vector<T*>& table, std::vector<T*>& entities)
+{
+    entities.resize(readSize(in, 4));
+    for (uint i=0; i<entities.size(); i++)
+        entities[i] = readRef(in, table);
+}
+/*----------------------------------------------------------------------------*/
+CheckpointImplementation::
+CheckpointImplementation(Internal::Context& c, const std::string& fileName)
+: m_context(c)
+, m_file_name(fileName)
+, m_with_mesh(false)
+, m_length_unit(Utils::Unit::undefined)
+, m_landmark(Utils::Landmark::undefined)
+, m_mesh_dim(Internal::ContextIfc::MESH3D)
+{
+}
+/*----------------------------------------------------------------------------*/
+CheckpointImplementation::~CheckpointImplementation()
+{
+}
+/*----------------------------------------------------------------------------*/
+int CheckpointImplementation::getIndex(const Utils::Entity* e) const
+{
+    if (e == 0)
+        return -1;
+    std::map<const Utils::Entity*, int>::const_iterator iter = m_index.find(e);
+    if (iter == m_index.end())
+        return -1;
+    return iter->second;
+}
+/*----------------------------------------------------------------------------*/
+/// écriture d'une liste d'indices
+template <typename T>
+static void writeRefs(std::ostream& out, const std::vector<T*>& entities,
+        const std::map<const Utils::Entity*, int>& index)
+{
+    writeUnsignedLong(out, entities.size());
+    for (uint i=0; i<entities.size(); i++){
+        std::map<const Utils::Entity*, int>::const_iterator iter = index.find(entities[i]);
+        writeInt(out, iter == index.end() ? -1 : iter->second);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::save(bool withMesh)
+{
+    std::ofstream out(m_file_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Impossible d'ouvrir le fichier de reprise " << m_file_name << " en écriture";
+        throw TkUtil::Exception(message);
+    }
+
+    out.write(s_magic, sizeof(s_magic)-1);
+    writeUnsignedLong(out, s_version);
+    writeInt(out, withMesh?1:0);
+    writeInt(out, (int)m_context.getLengthUnit());
+    writeInt(out, (int)m_context.getLandmark());
+    writeInt(out, (int)m_context.getMeshDim());
+
+    std::vector<unsigned long> stats;
+    m_context.getNameManager().getInternalStats(stats);
+    writeUnsignedLong(out, stats.size());
+    for (uint i=0; i<stats.size(); i++)
+        writeUnsignedLong(out, stats[i]);
+
+    m_index.clear();
+    writeGeom(out);
+    writeTopo(out);
+    writeGroups(out);
+    if (withMesh)
+        writeMesh(out);
+
+    out.close();
+    if (!out){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Erreur lors de l'écriture du fichier de reprise " << m_file_name;
+        throw TkUtil::Exception(message);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::readHeader()
+{
+    m_in.open(m_file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!m_in){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Impossible d'ouvrir le fichier de reprise " << m_file_name;
+        throw TkUtil::Exception(message);
+    }
+
+    char magic[sizeof(s_magic)-1];
+    m_in.read(magic, sizeof(magic));
+    if (!m_in || std::memcmp(magic, s_magic, sizeof(magic)) != 0){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Le fichier " << m_file_name << " n'est pas un fichier de reprise Magix3D";
+        throw TkUtil::Exception(message);
+    }
+
+    unsigned long version = readUnsignedLong(m_in);
+    if (version > s_version){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "Le fichier de reprise " << m_file_name << " est en version " << (long)version
+                << ", cette version de Magix3D ne sait lire que jusqu'à la version " << (long)s_version;
+        throw TkUtil::Exception(message);
+    }
+
+    m_with_mesh = (readInt(m_in) & 1) != 0;
+    m_length_unit = (Utils::Unit::lengthUnit)readInt(m_in);
+    m_landmark = (Utils::Landmark::kind)readInt(m_in);
+    m_mesh_dim = (Internal::ContextIfc::meshDim)readInt(m_in);
+
+    m_name_stats.resize(readSize(m_in, 8));
+    for (uint i=0; i<m_name_stats.size(); i++)
+        m_name_stats[i] = readUnsignedLong(m_in);
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::perform(Internal::CommandRestoreCheckpoint* command)
+{
+    if (!m_in.is_open())
+        throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, CheckpointImplementation::perform sans lecture de l'en-tête", TkUtil::Charset::UTF_8));
+
+    Internal::InfoCommand& icmd = command->getInfoCommand();
+
+    readGeom(m_in, icmd);
+    readTopo(m_in, icmd);
+    readGroups(m_in, icmd);
+    if (m_with_mesh)
+        readMesh(m_in, command);
+
+    // les compteurs de noms sont ceux de la session sauvegardée pour que la suite
+    // du script crée des entités de mêmes noms, les identifiants uniques ne
+    // pouvant que croître
+    std::vector<unsigned long> stats;
+    m_context.getNameManager().getInternalStats(stats);
+    for (uint i=0; i<stats.size() && i<m_name_stats.size(); i++)
+        if (i<2)
+            stats[i] = std::max(stats[i], m_name_stats[i]);
+        else
+            stats[i] = m_name_stats[i];
+    m_context.getNameManager().setInternalStats(stats);
+
+    m_in.close();
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::writeGeom(std::ostream& out)
+{
+    Geom::GeomManager& gm = m_context.getLocalGeomManager();
+    m_geom_entities.clear();
+    std::vector<Geom::Vertex*> vertices = gm.getVerticesObj();
+    m_geom_entities.insert(m_geom_entities.end(), vertices.begin(), vertices.end());
+    std::vector<Geom::Curve*> curves = gm.getCurvesObj();
+    m_geom_entities.insert(m_geom_entities.end(), curves.begin(), curves.end());
+    std::vector<Geom::Surface*> surfaces = gm.getSurfacesObj();
+    m_geom_entities.insert(m_geom_entities.end(), surfaces.begin(), surfaces.end());
+    std::vector<Geom::Volume*> volumes = gm.getVolumesObj();
+    m_geom_entities.insert(m_geom_entities.end(), volumes.begin(), volumes.end());
+
+    // toutes les formes dans un seul composé pour que les sous-formes
+    // partagées entre entités le restent à la relecture
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        Geom::GeomEntity* ge = m_geom_entities[i];
+        m_index[ge] = i;
+        std::vector<Geom::GeomRepresentation*> reps = ge->getComputationalProperties();
+        for (uint j=0; j<reps.size(); j++){
+            Geom::OCCGeomRepresentation* occ_rep = dynamic_cast<Geom::OCCGeomRepresentation*>(reps[j]);
+            if (occ_rep == 0){
+                TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+                message << "La sauvegarde de reprise ne supporte que la géométrie OpenCascade, ce n'est pas le cas pour "
+                        << ge->getName();
+                throw TkUtil::Exception(message);
+            }
+            builder.Add(compound, occ_rep->getShape());
+        }
+    }
+
+    std::ostringstream shapes;
+    BinTools::Write(compound, shapes);
+    writeString(out, shapes.str());
+
+    writeUnsignedLong(out, m_geom_entities.size());
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        Geom::GeomEntity* ge = m_geom_entities[i];
+        writeInt(out, ge->getDim());
+        writeString(out, ge->getName());
+        writeUnsignedLong(out, ge->getComputationalProperties().size());
+    }
+
+    // les relations d'adjacence, une fois toutes les entités indexées
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        std::vector<Geom::GeomEntity*> refs;
+        m_geom_entities[i]->getRefEntities(refs);
+        writeRefs(out, refs, m_index);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::readGeom(std::istream& in, Internal::InfoCommand& icmd)
+{
+    std::istringstream shapes(readString(in));
+    TopoDS_Shape compound;
+    BinTools::Read(compound, shapes);
+    std::vector<TopoDS_Shape> all_shapes;
+    for (TopoDS_Iterator it(compound); it.More(); it.Next())
+        all_shapes.push_back(it.Value());
+
+    uint ind_shape = 0;
+    m_geom_entities.resize(readSize(in, 4));
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        int dim = readInt(in);
+        std::string name = readString(in);
+        unsigned long nb_reps = readUnsignedLong(in);
+        if (nb_reps == 0 || nb_reps > all_shapes.size() - ind_shape)
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (formes géométriques manquantes)", TkUtil::Charset::UTF_8));
+        std::vector<Geom::GeomRepresentation*> reps(nb_reps);
+        for (uint j=0; j<reps.size(); j++)
+            reps[j] = new Geom::OCCGeomRepresentation(m_context, all_shapes[ind_shape++]);
+
+        Geom::GeomEntity* ge = 0;
+        switch(dim){
+        case 0:
+            ge = new Geom::Vertex(m_context, new Utils::Property(name),
+                    m_context.newDisplayProperties(Utils::Entity::GeomVertex),
+                    new Geom::GeomProperty(), reps[0]);
+            break;
+        case 1:
+            if (reps.size() == 1)
+                ge = new Geom::Curve(m_context, new Utils::Property(name),
+                        m_context.newDisplayProperties(Utils::Entity::GeomCurve),
+                        new Geom::GeomProperty(), reps[0]);
+            else
+                ge = new Geom::Curve(m_context, new Utils::Property(name),
+                        m_context.newDisplayProperties(Utils::Entity::GeomCurve),
+                        new Geom::GeomProperty(), reps);
+            break;
+        case 2:
+            if (reps.size() == 1)
+                ge = new Geom::Surface(m_context, new Utils::Property(name),
+                        m_context.newDisplayProperties(Utils::Entity::GeomSurface),
+                        new Geom::GeomProperty(), reps[0]);
+            else
+                ge = new Geom::Surface(m_context, new Utils::Property(name),
+                        m_context.newDisplayProperties(Utils::Entity::GeomSurface),
+                        new Geom::GeomProperty(), reps);
+            break;
+        case 3:
+            ge = new Geom::Volume(m_context, new Utils::Property(name),
+                    m_context.newDisplayProperties(Utils::Entity::GeomVolume),
+                    new Geom::GeomProperty(), reps[0]);
+            if (reps.size() > 1)
+                ge->setComputationalProperties(reps);
+            break;
+        default:
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (dimension d'entité géométrique)", TkUtil::Charset::UTF_8));
+        }
+        m_geom_entities[i] = ge;
+    }
+
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        std::vector<Geom::GeomEntity*> refs;
+        readRefs(in, m_geom_entities, refs);
+        for (uint j=0; j<refs.size(); j++)
+            m_geom_entities[i]->add(refs[j]);
+    }
+
+    for (uint i=0; i<m_geom_entities.size(); i++){
+        Geom::GeomEntity* ge = m_geom_entities[i];
+        // le paramétrage des courbes composites dépend de leurs extrémités
+        Geom::Curve* crv = dynamic_cast<Geom::Curve*>(ge);
+        if (crv){
+            std::vector<Geom::Vertex*> vertices;
+            crv->get(vertices);
+            if (!vertices.empty())
+                crv->computeParams(vertices[0]->getPoint());
+        }
+        m_context.newGraphicalRepresentation(*ge);
+        icmd.addGeomInfoEntity(ge, Internal::InfoCommand::CREATED);
+        m_context.getLocalGeomManager().addEntity(ge);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::writeTopo(std::ostream& out)
+{
+    Topo::TopoManager& tm = m_context.getLocalTopoManager();
+    tm.getVertices(m_vertices);
+    tm.getCoEdges(m_coedges);
+    tm.getCoFaces(m_cofaces);
+    tm.getBlocks(m_blocks);
+
+    // les arêtes et faces ne sont accessibles que depuis les faces communes et les blocs
+    m_edges.clear();
+    std::set<Topo::Edge*> edges_set;
+    for (uint i=0; i<m_cofaces.size(); i++){
+        std::vector<Topo::Edge*> edges;
+        m_cofaces[i]->getEdges(edges);
+        for (uint j=0; j<edges.size(); j++)
+            if (edges_set.insert(edges[j]).second)
+                m_edges.push_back(edges[j]);
+    }
+    m_faces.clear();
+    std::set<Topo::Face*> faces_set;
+    for (uint i=0; i<m_blocks.size(); i++){
+        std::vector<Topo::Face*> faces;
+        m_blocks[i]->getFaces(faces);
+        for (uint j=0; j<faces.size(); j++)
+            if (faces_set.insert(faces[j]).second)
+                m_faces.push_back(faces[j]);
+    }
+
+    for (uint i=0; i<m_vertices.size(); i++)
+        m_index[m_vertices[i]] = i;
+    for (uint i=0; i<m_coedges.size(); i++)
+        m_index[m_coedges[i]] = i;
+    for (uint i=0; i<m_edges.size(); i++)
+        m_index[m_edges[i]] = i;
+    for (uint i=0; i<m_cofaces.size(); i++)
+        m_index[m_cofaces[i]] = i;
+    for (uint i=0; i<m_faces.size(); i++)
+        m_index[m_faces[i]] = i;
+    for (uint i=0; i<m_blocks.size(); i++)
+        m_index[m_blocks[i]] = i;
+
+    writeUnsignedLong(out, m_vertices.size());
+    for (uint i=0; i<m_vertices.size(); i++){
+        Topo::Vertex* vtx = m_vertices[i];
+        writeString(out, vtx->getName());
+        writePoint(out, vtx->getCoord());
+        writeInt(out, getIndex(vtx->getGeomAssociation()));
+    }
+
+    writeUnsignedLong(out, m_coedges.size());
+    for (uint i=0; i<m_coedges.size(); i++){
+        Topo::CoEdge* coedge = m_coedges[i];
+        std::vector<Topo::Vertex*> vertices;
+        coedge->getVertices(vertices);
+        writeString(out, coedge->getName());
+        writeRefs(out, vertices, m_index);
+        writeProperty(out, coedge->getMeshingProperty());
+        writeInt(out, getIndex(coedge->getGeomAssociation()));
+    }
+
+    writeUnsignedLong(out, m_edges.size());
+    for (uint i=0; i<m_edges.size(); i++){
+        Topo::Edge* edge = m_edges[i];
+        std::vector<Topo::Vertex*> vertices;
+        edge->getVertices(vertices);
+        std::vector<Topo::CoEdge*> coedges;
+        edge->getCoEdges(coedges);
+        writeString(out, edge->getName());
+        writeRefs(out, vertices, m_index);
+        writeRefs(out, coedges, m_index);
+        for (uint j=0; j<coedges.size(); j++)
+            writeInt(out, edge->getRatio(coedges[j]));
+    }
+
+    writeUnsignedLong(out, m_cofaces.size());
+    for (uint i=0; i<m_cofaces.size(); i++){
+        Topo::CoFace* coface = m_cofaces[i];
+        std::vector<Topo::Edge*> edges;
+        coface->getEdges(edges);
+        std::vector<Topo::Vertex*> vertices;
+        coface->getVertices(vertices);
+        writeString(out, coface->getName());
+        writeRefs(out, edges, m_index);
+        writeRefs(out, vertices, m_index);
+        writeBool(out, coface->hasHole());
+        writeProperty(out, coface->getCoFaceMeshingProperty());
+        writeInt(out, getIndex(coface->getGeomAssociation()));
+    }
+
+    writeUnsignedLong(out, m_faces.size());
+    for (uint i=0; i<m_faces.size(); i++){
+        Topo::Face* face = m_faces[i];
+        std::vector<Topo::CoFace*> cofaces;
+        face->getCoFaces(cofaces);
+        std::vector<Topo::Vertex*> vertices;
+        face->getVertices(vertices);
+        writeString(out, face->getName());
+        writeRefs(out, cofaces, m_index);
+        writeRefs(out, vertices, m_index);
+        writeBool(out, face->isStructured());
+        for (uint j=0; j<cofaces.size(); j++){
+            writeInt(out, face->getRatio(cofaces[j], 0));
+            writeInt(out, face->getRatio(cofaces[j], 1));
+        }
+    }
+
+    writeUnsignedLong(out, m_blocks.size());
+    for (uint i=0; i<m_blocks.size(); i++){
+        Topo::Block* block = m_blocks[i];
+        std::vector<Topo::Face*> faces;
+        block->getFaces(faces);
+        std::vector<Topo::Vertex*> vertices;
+        block->getVertices(vertices);
+        writeString(out, block->getName());
+        writeRefs(out, faces, m_index);
+        writeRefs(out, vertices, m_index);
+        writeProperty(out, block->getBlockMeshingProperty());
+        writeInt(out, getIndex(block->getGeomAssociation()));
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::readTopo(std::istream& in, Internal::InfoCommand& icmd)
+{
+    Topo::TopoManager& tm = m_context.getLocalTopoManager();
+
+    m_vertices.resize(readSize(in, 4));
+    for (uint i=0; i<m_vertices.size(); i++){
+        std::string name = readString(in);
+        Utils::Math::Point pt = readPoint(in);
+        Geom::GeomEntity* ge = readRef(in, m_geom_entities);
+        Topo::Vertex* vtx = new Topo::Vertex(m_context, pt);
+        delete vtx->setProperties(new Utils::Property(name));
+        if (ge)
+            vtx->setGeomAssociation(ge);
+        icmd.addTopoInfoEntity(vtx, Internal::InfoCommand::CREATED);
+        tm.add(vtx);
+        m_vertices[i] = vtx;
+    }
+
+    m_coedges.resize(readSize(in, 4));
+    for (uint i=0; i<m_coedges.size(); i++){
+        std::string name = readString(in);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        if (vertices.size() != 2)
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (sommets d'une arête)", TkUtil::Charset::UTF_8));
+        Topo::CoEdgeMeshingProperty* emp = readCoEdgeProperty(in);
+        Geom::GeomEntity* ge = readRef(in, m_geom_entities);
+        // la propriété est clonée par le constructeur
+        Topo::CoEdge* coedge = new Topo::CoEdge(m_context, emp, vertices[0], vertices[1]);
+        delete emp;
+        delete coedge->setProperties(new Utils::Property(name));
+        if (ge)
+            coedge->setGeomAssociation(ge);
+        icmd.addTopoInfoEntity(coedge, Internal::InfoCommand::CREATED);
+        tm.add(coedge);
+        m_coedges[i] = coedge;
+    }
+
+    m_edges.resize(readSize(in, 4));
+    for (uint i=0; i<m_edges.size(); i++){
+        std::string name = readString(in);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        std::vector<Topo::CoEdge*> coedges;
+        readRefs(in, m_coedges, coedges);
+        if (vertices.size() != 2)
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (sommets d'une arête)", TkUtil::Charset::UTF_8));
+        Topo::Edge* edge = new Topo::Edge(m_context, vertices[0], vertices[1], coedges);
+        for (uint j=0; j<coedges.size(); j++)
+            edge->setRatio(coedges[j], readInt(in));
+        delete edge->setProperties(new Utils::Property(name));
+        icmd.addTopoInfoEntity(edge, Internal::InfoCommand::CREATED);
+        tm.add(edge);
+        m_edges[i] = edge;
+    }
+
+    m_cofaces.resize(readSize(in, 4));
+    for (uint i=0; i<m_cofaces.size(); i++){
+        std::string name = readString(in);
+        std::vector<Topo::Edge*> edges;
+        readRefs(in, m_edges, edges);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        bool hasHole = readBool(in);
+        Topo::CoFaceMeshingProperty* fmp = readCoFaceProperty(in);
+        Geom::GeomEntity* ge = readRef(in, m_geom_entities);
+        Topo::CoFace* coface = new Topo::CoFace(m_context, edges, vertices, fmp->isStructured(), hasHole);
+        delete coface->setProperty(fmp);
+        delete coface->setProperties(new Utils::Property(name));
+        if (ge)
+            coface->setGeomAssociation(ge);
+        icmd.addTopoInfoEntity(coface, Internal::InfoCommand::CREATED);
+        tm.add(coface);
+        m_cofaces[i] = coface;
+    }
+
+    m_faces.resize(readSize(in, 4));
+    for (uint i=0; i<m_faces.size(); i++){
+        std::string name = readString(in);
+        std::vector<Topo::CoFace*> cofaces;
+        readRefs(in, m_cofaces, cofaces);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        bool isStr = readBool(in);
+        Topo::Face* face = new Topo::Face(m_context, cofaces, vertices, isStr);
+        for (uint j=0; j<cofaces.size(); j++){
+            face->setRatio(cofaces[j], readInt(in), 0);
+            face->setRatio(cofaces[j], readInt(in), 1);
+        }
+        delete face->setProperties(new Utils::Property(name));
+        icmd.addTopoInfoEntity(face, Internal::InfoCommand::CREATED);
+        tm.add(face);
+        m_faces[i] = face;
+    }
+
+    m_blocks.resize(readSize(in, 4));
+    for (uint i=0; i<m_blocks.size(); i++){
+        std::string name = readString(in);
+        std::vector<Topo::Face*> faces;
+        readRefs(in, m_faces, faces);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        Topo::BlockMeshingProperty* bmp = readBlockProperty(in);
+        Geom::GeomEntity* ge = readRef(in, m_geom_entities);
+        Topo::Block* block = new Topo::Block(m_context, faces, vertices, bmp->isStructured());
+        delete block->setProperty(bmp);
+        delete block->setProperties(new Utils::Property(name));
+        if (ge)
+            block->setGeomAssociation(ge);
+        icmd.addTopoInfoEntity(block, Internal::InfoCommand::CREATED);
+        tm.add(block);
+        m_blocks[i] = block;
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::
+writeProperty(std::ostream& out, const Topo::CoEdgeMeshingProperty* emp)
+{
+    writeInt(out, (int)emp->getMeshLaw());
+    writeInt(out, emp->getNbEdges());
+    writeBool(out, emp->getDirect());
+    writeInt(out, emp->getNbLayers());
+    writeBool(out, emp->getNbLayers() ? emp->getSide() == 0 : true);
+    writeBool(out, emp->isPolarCut());
+    writePoint(out, emp->getPolarCenter());
+
+    switch (emp->getMeshLaw()){
+    case Topo::CoEdgeMeshingProperty::geometrique:{
+        const Topo::EdgeMeshingPropertyGeometric* p = dynamic_cast<const Topo::EdgeMeshingPropertyGeometric*>(emp);
+        writeDouble(out, p->getRatio());
+        writeDouble(out, p->m_arm1);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::bigeometrique:{
+        const Topo::EdgeMeshingPropertyBigeometric* p = dynamic_cast<const Topo::EdgeMeshingPropertyBigeometric*>(emp);
+        writeDouble(out, p->getRatio1());
+        writeDouble(out, p->getLength1());
+        writeDouble(out, p->getRatio2());
+        writeDouble(out, p->getLength2());
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::hyperbolique:{
+        const Topo::EdgeMeshingPropertyHyperbolic* p = dynamic_cast<const Topo::EdgeMeshingPropertyHyperbolic*>(emp);
+        writeDouble(out, p->getLength1());
+        writeDouble(out, p->getLength2());
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::specific_size:{
+        const Topo::EdgeMeshingPropertySpecificSize* p = dynamic_cast<const Topo::EdgeMeshingPropertySpecificSize*>(emp);
+        writeDouble(out, p->getEdgeSize());
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::interpolate:{
+        const Topo::EdgeMeshingPropertyInterpolate* p = dynamic_cast<const Topo::EdgeMeshingPropertyInterpolate*>(emp);
+        writeInt(out, (int)p->getType());
+        if (p->getType() == Topo::EdgeMeshingPropertyInterpolate::with_coedge_list)
+            writeStrings(out, p->getCoEdges());
+        else
+            writeString(out, p->getCoFace());
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::globalinterpolate:{
+        const Topo::EdgeMeshingPropertyGlobalInterpolate* p = dynamic_cast<const Topo::EdgeMeshingPropertyGlobalInterpolate*>(emp);
+        writeStrings(out, p->getFirstCoEdges());
+        writeStrings(out, p->getSecondCoEdges());
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::tabulated:{
+        const Topo::EdgeMeshingPropertyTabulated* p = dynamic_cast<const Topo::EdgeMeshingPropertyTabulated*>(emp);
+        std::vector<double> tabulation = p->getTabulations();
+        writeUnsignedLong(out, tabulation.size());
+        for (uint i=0; i<tabulation.size(); i++)
+            writeDouble(out, tabulation[i]);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::beta_resserrement:{
+        const Topo::EdgeMeshingPropertyBeta* p = dynamic_cast<const Topo::EdgeMeshingPropertyBeta*>(emp);
+        writeDouble(out, p->getBeta());
+        break;
+    }
+    default:
+        break;
+    }
+}
+/*----------------------------------------------------------------------------*/
+Topo::CoEdgeMeshingProperty* CheckpointImplementation::
+readCoEdgeProperty(std::istream& in)
+{
+    int law = readInt(in);
+    int nb = readInt(in);
+    bool direct = readBool(in);
+    int nbLayers = readInt(in);
+    bool sideMin = readBool(in);
+    bool polar = readBool(in);
+    Utils::Math::Point center = readPoint(in);
+
+    Topo::CoEdgeMeshingProperty* emp = 0;
+    switch ((Topo::CoEdgeMeshingProperty::meshLaw)law){
+    case Topo::CoEdgeMeshingProperty::uniforme:
+        emp = new Topo::EdgeMeshingPropertyUniform(nb);
+        break;
+    case Topo::CoEdgeMeshingProperty::geometrique:{
+        double ratio = readDouble(in);
+        double arm1 = readDouble(in);
+        emp = new Topo::EdgeMeshingPropertyGeometric(nb, ratio, direct, arm1);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::bigeometrique:{
+        double r1 = readDouble(in);
+        double sp1 = readDouble(in);
+        double r2 = readDouble(in);
+        double sp2 = readDouble(in);
+        emp = new Topo::EdgeMeshingPropertyBigeometric(nb, r1, sp1, r2, sp2, direct);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::hyperbolique:{
+        double sp1 = readDouble(in);
+        double sp2 = readDouble(in);
+        emp = new Topo::EdgeMeshingPropertyHyperbolic(nb, sp1, sp2, direct);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::specific_size:
+        emp = new Topo::EdgeMeshingPropertySpecificSize(readDouble(in));
+        break;
+    case Topo::CoEdgeMeshingProperty::interpolate:{
+        int type = readInt(in);
+        if (type == Topo::EdgeMeshingPropertyInterpolate::with_coedge_list)
+            emp = new Topo::EdgeMeshingPropertyInterpolate(nb, readStrings(in));
+        else
+            emp = new Topo::EdgeMeshingPropertyInterpolate(nb, readString(in));
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::globalinterpolate:{
+        std::vector<std::string> first = readStrings(in);
+        std::vector<std::string> second = readStrings(in);
+        emp = new Topo::EdgeMeshingPropertyGlobalInterpolate(nb, first, second);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::tabulated:{
+        std::vector<double> tabulation(readSize(in, 8));
+        for (uint i=0; i<tabulation.size(); i++)
+            tabulation[i] = readDouble(in);
+        emp = new Topo::EdgeMeshingPropertyTabulated(tabulation);
+        break;
+    }
+    case Topo::CoEdgeMeshingProperty::beta_resserrement:
+        emp = new Topo::EdgeMeshingPropertyBeta(nb, readDouble(in), direct);
+        break;
+    case Topo::CoEdgeMeshingProperty::uniforme_smoothfix:
+        emp = new Topo::EdgeMeshingPropertyUniformSmoothFix(nb);
+        break;
+    default:
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (discrétisation d'arête inconnue)", TkUtil::Charset::UTF_8));
+    }
+
+    emp->setNbEdges(nb);
+    emp->setDirect(direct);
+    emp->setOrthogonal(nbLayers, sideMin);
+    emp->setPolarCut(polar);
+    emp->setPolarCenter(center);
+
+    return emp;
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::
+writeProperty(std::ostream& out, const Topo::CoFaceMeshingProperty* fmp)
+{
+    switch (fmp->getMeshLaw()){
+    case Topo::CoFaceMeshingProperty::directional:{
+        const Topo::FaceMeshingPropertyDirectional* p = dynamic_cast<const Topo::FaceMeshingPropertyDirectional*>(fmp);
+        writeInt(out, s_face_directional);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        break;
+    }
+    case Topo::CoFaceMeshingProperty::orthogonal:{
+        const Topo::FaceMeshingPropertyOrthogonal* p = dynamic_cast<const Topo::FaceMeshingPropertyOrthogonal*>(fmp);
+        writeInt(out, s_face_orthogonal);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        writeInt(out, (int)p->m_side);
+        writeInt(out, p->m_nbLayers);
+        break;
+    }
+    case Topo::CoFaceMeshingProperty::rotational:{
+        const Topo::FaceMeshingPropertyRotational* p = dynamic_cast<const Topo::FaceMeshingPropertyRotational*>(fmp);
+        writeInt(out, s_face_rotational);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        writePoint(out, p->m_axis1);
+        writePoint(out, p->m_axis2);
+        break;
+    }
+    case Topo::CoFaceMeshingProperty::transfinite:
+        writeInt(out, s_face_transfinite);
+        break;
+    case Topo::CoFaceMeshingProperty::delaunayGMSH:{
+        const Topo::FaceMeshingPropertyDelaunayGMSH* p = dynamic_cast<const Topo::FaceMeshingPropertyDelaunayGMSH*>(fmp);
+        writeInt(out, s_face_delaunayGMSH);
+        writeDouble(out, p->m_min);
+        writeDouble(out, p->m_max);
+        writeBool(out, p->m_is_default);
+        break;
+    }
+    case Topo::CoFaceMeshingProperty::quadPairing:{
+        const Topo::FaceMeshingPropertyQuadPairing* p = dynamic_cast<const Topo::FaceMeshingPropertyQuadPairing*>(fmp);
+        writeInt(out, s_face_quadPairing);
+        writeDouble(out, p->m_min);
+        writeDouble(out, p->m_max);
+        writeBool(out, p->m_is_default);
+        break;
+    }
+#ifdef USE_MESHGEMS
+    case Topo::CoFaceMeshingProperty::MeshGems:{
+        const Topo::FaceMeshingPropertyMeshGems* p = dynamic_cast<const Topo::FaceMeshingPropertyMeshGems*>(fmp);
+        writeInt(out, s_face_meshGems);
+        writeDouble(out, p->m_size);
+        writeDouble(out, p->m_gradation);
+        writeBool(out, p->m_is_default);
+        break;
+    }
+#endif	// USE_MESHGEMS
+    default:
+        throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, discrétisation de face commune non prévue pour la reprise", TkUtil::Charset::UTF_8));
+    }
+}
+/*----------------------------------------------------------------------------*/
+Topo::CoFaceMeshingProperty* CheckpointImplementation::
+readCoFaceProperty(std::istream& in)
+{
+    int law = readInt(in);
+    switch (law){
+    case s_face_directional:{
+        Topo::FaceMeshingPropertyDirectional* p = new Topo::FaceMeshingPropertyDirectional(
+                (Topo::CoFaceMeshingProperty::meshDirLaw)readInt(in));
+        p->m_v1 = readPoint(in);
+        p->m_v2 = readPoint(in);
+        return p;
+    }
+    case s_face_orthogonal:{
+        Topo::CoFaceMeshingProperty::meshDirLaw md = (Topo::CoFaceMeshingProperty::meshDirLaw)readInt(in);
+        Utils::Math::Point v1 = readPoint(in);
+        Utils::Math::Point v2 = readPoint(in);
+        Topo::CoFaceMeshingProperty::meshSideLaw side = (Topo::CoFaceMeshingProperty::meshSideLaw)readInt(in);
+        Topo::FaceMeshingPropertyOrthogonal* p = new Topo::FaceMeshingPropertyOrthogonal(md, readInt(in));
+        Topo::FaceMeshingPropertyDirectional* dp = p;
+        dp->m_v1 = v1;
+        dp->m_v2 = v2;
+        p->m_side = side;
+        return p;
+    }
+    case s_face_rotational:{
+        Topo::CoFaceMeshingProperty::meshDirLaw md = (Topo::CoFaceMeshingProperty::meshDirLaw)readInt(in);
+        Utils::Math::Point v1 = readPoint(in);
+        Utils::Math::Point v2 = readPoint(in);
+        Utils::Math::Point axis1 = readPoint(in);
+        Utils::Math::Point axis2 = readPoint(in);
+        Topo::FaceMeshingPropertyRotational* p = new Topo::FaceMeshingPropertyRotational(md, axis1, axis2);
+        p->m_v1 = v1;
+        p->m_v2 = v2;
+        return p;
+    }
+    case s_face_transfinite:
+        return new Topo::FaceMeshingPropertyTransfinite();
+    case s_face_delaunayGMSH:{
+        Topo::FaceMeshingPropertyDelaunayGMSH* p = new Topo::FaceMeshingPropertyDelaunayGMSH();
+        p->m_min = readDouble(in);
+        p->m_max = readDouble(in);
+        p->m_is_default = readBool(in);
+        return p;
+    }
+    case s_face_quadPairing:{
+        Topo::FaceMeshingPropertyQuadPairing* p = new Topo::FaceMeshingPropertyQuadPairing();
+        p->m_min = readDouble(in);
+        p->m_max = readDouble(in);
+        p->m_is_default = readBool(in);
+        return p;
+    }
+#ifdef USE_MESHGEMS
+    case s_face_meshGems:{
+        Topo::FaceMeshingPropertyMeshGems* p = new Topo::FaceMeshingPropertyMeshGems();
+        p->m_size = readDouble(in);
+        p->m_gradation = readDouble(in);
+        p->m_is_default = readBool(in);
+        return p;
+    }
+#endif	// USE_MESHGEMS
+    default:
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent ou discrétisation de face commune non disponible", TkUtil::Charset::UTF_8));
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::
+writeProperty(std::ostream& out, const Topo::BlockMeshingProperty* bmp)
+{
+    switch (bmp->getMeshLaw()){
+    case Topo::BlockMeshingProperty::directional:{
+        const Topo::BlockMeshingPropertyDirectional* p = dynamic_cast<const Topo::BlockMeshingPropertyDirectional*>(bmp);
+        writeInt(out, s_block_directional);
+        writeInt(out, (int)p->m_method);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        writeString(out, p->m_coedge_name);
+        break;
+    }
+    case Topo::BlockMeshingProperty::orthogonal:{
+        const Topo::BlockMeshingPropertyOrthogonal* p = dynamic_cast<const Topo::BlockMeshingPropertyOrthogonal*>(bmp);
+        writeInt(out, s_block_orthogonal);
+        writeInt(out, (int)p->m_method);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        writeString(out, p->m_coedge_name);
+        writeInt(out, (int)p->m_side);
+        writeInt(out, p->m_nbLayers);
+        break;
+    }
+    case Topo::BlockMeshingProperty::rotational:{
+        const Topo::BlockMeshingPropertyRotational* p = dynamic_cast<const Topo::BlockMeshingPropertyRotational*>(bmp);
+        writeInt(out, s_block_rotational);
+        writeInt(out, (int)p->m_method);
+        writeInt(out, (int)p->m_dir);
+        writePoint(out, p->m_v1);
+        writePoint(out, p->m_v2);
+        writePoint(out, p->m_axis1);
+        writePoint(out, p->m_axis2);
+        writeString(out, p->m_coedge_name);
+        break;
+    }
+    case Topo::BlockMeshingProperty::transfinite:
+        writeInt(out, s_block_transfinite);
+        break;
+    case Topo::BlockMeshingProperty::delaunayTetgen:{
+        const Topo::BlockMeshingPropertyDelaunayTetgen* p = dynamic_cast<const Topo::BlockMeshingPropertyDelaunayTetgen*>(bmp);
+        writeInt(out, s_block_delaunayTetgen);
+        writeInt(out, (int)p->m_law);
+        writeBool(out, p->m_verbose);
+        writeBool(out, p->m_is_default);
+        writeDouble(out, p->m_radius_edge_ratio);
+        writeDouble(out, p->m_max_volume);
+        writeDouble(out, p->m_ratio_pyramid_size);
+        break;
+    }
+#ifdef USE_MESHGEMS
+    case Topo::BlockMeshingProperty::delaunayMeshGemsVol:{
+        const Topo::BlockMeshingPropertyDelaunayMeshGems* p = dynamic_cast<const Topo::BlockMeshingPropertyDelaunayMeshGems*>(bmp);
+        writeInt(out, s_block_delaunayMeshGems);
+        writeBool(out, p->m_is_default);
+        writeInt(out, (int)p->m_optimLvl);
+        writeInt(out, p->m_verbosity);
+        writeDouble(out, p->m_gradation);
+        writeDouble(out, p->m_min_size);
+        writeDouble(out, p->m_max_size);
+        writeBool(out, p->m_optimise_worst_elements);
+        writeDouble(out, p->m_ratio_pyramid_size);
+        break;
+    }
+#endif	// USE_MESHGEMS
+    case Topo::BlockMeshingProperty::insertion:{
+        const Topo::BlockMeshingPropertyInsertion* p = dynamic_cast<const Topo::BlockMeshingPropertyInsertion*>(bmp);
+        writeInt(out, s_block_insertion);
+        writeBool(out, p->withRefinement());
+        break;
+    }
+    default:
+        throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, discrétisation de bloc non prévue pour la reprise", TkUtil::Charset::UTF_8));
+    }
+}
+/*----------------------------------------------------------------------------*/
+Topo::BlockMeshingProperty* CheckpointImplementation::
+readBlockProperty(std::istream& in)
+{
+    int law = readInt(in);
+    switch (law){
+    case s_block_directional:{
+        int method = readInt(in);
+        Topo::BlockMeshingPropertyDirectional* p = new Topo::BlockMeshingPropertyDirectional(
+                (Topo::BlockMeshingProperty::meshDirLaw)readInt(in));
+        p->m_method = (Topo::BlockMeshingPropertyDirectional::initMethod)method;
+        p->m_v1 = readPoint(in);
+        p->m_v2 = readPoint(in);
+        p->m_coedge_name = readString(in);
+        return p;
+    }
+    case s_block_orthogonal:{
+        int method = readInt(in);
+        Topo::BlockMeshingProperty::meshDirLaw md = (Topo::BlockMeshingProperty::meshDirLaw)readInt(in);
+        Utils::Math::Point v1 = readPoint(in);
+        Utils::Math::Point v2 = readPoint(in);
+        std::string coedge_name = readString(in);
+        Topo::BlockMeshingProperty::meshSideLaw side = (Topo::BlockMeshingProperty::meshSideLaw)readInt(in);
+        Topo::BlockMeshingPropertyOrthogonal* p = new Topo::BlockMeshingPropertyOrthogonal(v1, v2, readInt(in));
+        Topo::BlockMeshingPropertyDirectional* dp = p;
+        dp->m_method = (Topo::BlockMeshingPropertyDirectional::initMethod)method;
+        dp->m_dir = md;
+        dp->m_coedge_name = coedge_name;
+        p->m_side = side;
+        return p;
+    }
+    case s_block_rotational:{
+        int method = readInt(in);
+        Topo::BlockMeshingProperty::meshDirLaw md = (Topo::BlockMeshingProperty::meshDirLaw)readInt(in);
+        Utils::Math::Point v1 = readPoint(in);
+        Utils::Math::Point v2 = readPoint(in);
+        Utils::Math::Point axis1 = readPoint(in);
+        Utils::Math::Point axis2 = readPoint(in);
+        Topo::BlockMeshingPropertyRotational* p = new Topo::BlockMeshingPropertyRotational(md, axis1, axis2);
+        p->m_method = (Topo::BlockMeshingPropertyRotational::initMethod)method;
+        p->m_v1 = v1;
+        p->m_v2 = v2;
+        p->m_coedge_name = readString(in);
+        return p;
+    }
+    case s_block_transfinite:
+        return new Topo::BlockMeshingPropertyTransfinite();
+    case s_block_delaunayTetgen:{
+        Topo::BlockMeshingPropertyDelaunayTetgen* p = new Topo::BlockMeshingPropertyDelaunayTetgen();
+        p->m_law = (Topo::BlockMeshingPropertyDelaunayTetgen::DelaunayLaw)readInt(in);
+        p->m_verbose = readBool(in);
+        p->m_is_default = readBool(in);
+        p->m_radius_edge_ratio = readDouble(in);
+        p->m_max_volume = readDouble(in);
+        p->m_ratio_pyramid_size = readDouble(in);
+        return p;
+    }
+#ifdef USE_MESHGEMS
+    case s_block_delaunayMeshGems:{
+        Topo::BlockMeshingPropertyDelaunayMeshGems* p = new Topo::BlockMeshingPropertyDelaunayMeshGems();
+        p->m_is_default = readBool(in);
+        p->m_optimLvl = (Topo::BlockMeshingPropertyDelaunayMeshGems::MeshGemsOptimizationLevel)readInt(in);
+        p->m_verbosity = readInt(in);
+        p->m_gradation = readDouble(in);
+        p->m_min_size = readDouble(in);
+        p->m_max_size = readDouble(in);
+        p->m_optimise_worst_elements = readBool(in);
+        p->m_ratio_pyramid_size = readDouble(in);
+        return p;
+    }
+#endif	// USE_MESHGEMS
+    case s_block_insertion:
+        return new Topo::BlockMeshingPropertyInsertion(readBool(in));
+    default:
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent ou discrétisation de bloc non disponible", TkUtil::Charset::UTF_8));
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::writeGroups(std::ostream& out)
+{
+    Group::GroupManager& grm = m_context.getLocalGroupManager();
+
+    std::vector<Group::Group0D*> groups0D;
+    grm.getGroup0D(groups0D, true);
+    writeUnsignedLong(out, groups0D.size());
+    for (uint i=0; i<groups0D.size(); i++){
+        Group::Group0D* grp = groups0D[i];
+        writeString(out, grp->isDefaultGroup() ? std::string() : grp->getName());
+        writeInt(out, grp->getLevel());
+        writeRefs(out, grp->getVertices(), m_index);
+        writeRefs(out, grp->getTopoVertices(), m_index);
+    }
+
+    std::vector<Group::Group1D*> groups1D;
+    grm.getGroup1D(groups1D, true);
+    writeUnsignedLong(out, groups1D.size());
+    for (uint i=0; i<groups1D.size(); i++){
+        Group::Group1D* grp = groups1D[i];
+        writeString(out, grp->isDefaultGroup() ? std::string() : grp->getName());
+        writeInt(out, grp->getLevel());
+        writeRefs(out, grp->getCurves(), m_index);
+        writeRefs(out, grp->getCoEdges(), m_index);
+    }
+
+    std::vector<Group::Group2D*> groups2D;
+    grm.getGroup2D(groups2D, true);
+    writeUnsignedLong(out, groups2D.size());
+    for (uint i=0; i<groups2D.size(); i++){
+        Group::Group2D* grp = groups2D[i];
+        writeString(out, grp->isDefaultGroup() ? std::string() : grp->getName());
+        writeInt(out, grp->getLevel());
+        writeRefs(out, grp->getSurfaces(), m_index);
+        writeRefs(out, grp->getCoFaces(), m_index);
+    }
+
+    std::vector<Group::Group3D*> groups3D;
+    grm.getGroup3D(groups3D, true);
+    writeUnsignedLong(out, groups3D.size());
+    for (uint i=0; i<groups3D.size(); i++){
+        Group::Group3D* grp = groups3D[i];
+        writeString(out, grp->isDefaultGroup() ? std::string() : grp->getName());
+        writeInt(out, grp->getLevel());
+        writeRefs(out, grp->getVolumes(), m_index);
+        writeRefs(out, grp->getBlocks(), m_index);
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// lecture des entités géométriques d'un groupe, de la dimension T
+template <typename T>
+static void readGeomRefs(std::istream& in, const std::vector<Geom::GeomEntity*>& table, std::vector<T*>& entities)
+{
+    std::vector<Geom::GeomEntity*> refs;
+    readRefs(in, table, refs);
+    entities.clear();
+    for (uint i=0; i<refs.size(); i++){
+        T* ent = dynamic_cast<T*>(refs[i]);
+        if (ent == 0)
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (entité géométrique d'un groupe)", TkUtil::Charset::UTF_8));
+        entities.push_back(ent);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::readGroups(std::istream& in, Internal::InfoCommand& icmd)
+{
+    Group::GroupManager& grm = m_context.getLocalGroupManager();
+
+    unsigned long nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        Group::Group0D* grp = grm.getNewGroup0D(readString(in), &icmd);
+        grp->setLevel(readInt(in));
+        std::vector<Geom::Vertex*> vertices;
+        readGeomRefs(in, m_geom_entities, vertices);
+        for (uint j=0; j<vertices.size(); j++){
+            grp->add(vertices[j]);
+            vertices[j]->add(grp);
+        }
+        std::vector<Topo::Vertex*> topo_vertices;
+        readRefs(in, m_vertices, topo_vertices);
+        for (uint j=0; j<topo_vertices.size(); j++){
+            grp->add(topo_vertices[j]);
+            topo_vertices[j]->getGroupsContainer().add(grp);
+        }
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        Group::Group1D* grp = grm.getNewGroup1D(readString(in), &icmd);
+        grp->setLevel(readInt(in));
+        std::vector<Geom::Curve*> curves;
+        readGeomRefs(in, m_geom_entities, curves);
+        for (uint j=0; j<curves.size(); j++){
+            grp->add(curves[j]);
+            curves[j]->add(grp);
+        }
+        std::vector<Topo::CoEdge*> coedges;
+        readRefs(in, m_coedges, coedges);
+        for (uint j=0; j<coedges.size(); j++){
+            grp->add(coedges[j]);
+            coedges[j]->getGroupsContainer().add(grp);
+        }
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        Group::Group2D* grp = grm.getNewGroup2D(readString(in), &icmd);
+        grp->setLevel(readInt(in));
+        std::vector<Geom::Surface*> surfaces;
+        readGeomRefs(in, m_geom_entities, surfaces);
+        for (uint j=0; j<surfaces.size(); j++){
+            grp->add(surfaces[j]);
+            surfaces[j]->add(grp);
+        }
+        std::vector<Topo::CoFace*> cofaces;
+        readRefs(in, m_cofaces, cofaces);
+        for (uint j=0; j<cofaces.size(); j++){
+            grp->add(cofaces[j]);
+            cofaces[j]->getGroupsContainer().add(grp);
+        }
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        Group::Group3D* grp = grm.getNewGroup3D(readString(in), &icmd);
+        grp->setLevel(readInt(in));
+        std::vector<Geom::Volume*> volumes;
+        readGeomRefs(in, m_geom_entities, volumes);
+        for (uint j=0; j<volumes.size(); j++){
+            grp->add(volumes[j]);
+            volumes[j]->add(grp);
+        }
+        std::vector<Topo::Block*> blocks;
+        readRefs(in, m_blocks, blocks);
+        for (uint j=0; j<blocks.size(); j++){
+            grp->add(blocks[j]);
+            blocks[j]->getGroupsContainer().add(grp);
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// indice d'un noeud gmds dans la table des noeuds écrits, ajouté si nécessaire
+static int getNodeIndex(gmds::TCellID id, std::map<gmds::TCellID, int>& nodes_index,
+        std::vector<gmds::TCellID>& nodes)
+{
+    std::map<gmds::TCellID, int>::iterator iter = nodes_index.find(id);
+    if (iter != nodes_index.end())
+        return iter->second;
+    int ind = nodes.size();
+    nodes_index[id] = ind;
+    nodes.push_back(id);
+    return ind;
+}
+/*----------------------------------------------------------------------------*/
+static void writeNodes(std::ostream& out, const std::vector<gmds::TCellID>& ids,
+        std::map<gmds::TCellID, int>& nodes_index, std::vector<gmds::TCellID>& nodes)
+{
+    writeUnsignedLong(out, ids.size());
+    for (uint i=0; i<ids.size(); i++)
+        writeInt(out, getNodeIndex(ids[i], nodes_index, nodes));
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::writeMesh(std::ostream& out)
+{
+    Mesh::MeshManager& mm = m_context.getLocalMeshManager();
+    gmds::IGMesh& gmds_mesh = mm.getMesh()->getGMDSMesh();
+
+    // les mailles sont écrites avant les noeuds, qui ne sont connus qu'à la fin
+    std::ostringstream body;
+    std::map<gmds::TCellID, int> nodes_index;
+    std::vector<gmds::TCellID> nodes;
+
+    for (uint i=0; i<m_vertices.size(); i++){
+        Topo::VertexMeshingData* md = m_vertices[i]->getMeshingData();
+        writeBool(body, md->isMeshed());
+        if (md->isMeshed())
+            writeInt(body, getNodeIndex(md->node(), nodes_index, nodes));
+    }
+
+    for (uint i=0; i<m_coedges.size(); i++){
+        Topo::CoEdgeMeshingData* md = m_coedges[i]->getMeshingData();
+        writeBool(body, md->isMeshed());
+        if (!md->isMeshed())
+            continue;
+        writeNodes(body, md->nodes(), nodes_index, nodes);
+        std::vector<gmds::TCellID>& edges = md->edges();
+        writeUnsignedLong(body, edges.size());
+        for (uint j=0; j<edges.size(); j++){
+            std::vector<gmds::TCellID> ids = gmds_mesh.get<gmds::Edge>(edges[j]).getIDs<gmds::Node>();
+            writeInt(body, getNodeIndex(ids[0], nodes_index, nodes));
+            writeInt(body, getNodeIndex(ids[1], nodes_index, nodes));
+        }
+    }
+
+    for (uint i=0; i<m_cofaces.size(); i++){
+        Topo::CoFaceMeshingData* md = m_cofaces[i]->getMeshingData();
+        writeBool(body, md->isMeshed());
+        if (!md->isMeshed())
+            continue;
+        writeNodes(body, md->nodes(), nodes_index, nodes);
+        std::vector<gmds::TCellID>& faces = md->faces();
+        writeUnsignedLong(body, faces.size());
+        for (uint j=0; j<faces.size(); j++){
+            std::vector<gmds::TCellID> ids = gmds_mesh.get<gmds::Face>(faces[j]).getIDs<gmds::Node>();
+            if (ids.size() != 3 && ids.size() != 4)
+                throw TkUtil::Exception(TkUtil::UTF8String ("La sauvegarde de reprise ne supporte que les triangles et quadrangles", TkUtil::Charset::UTF_8));
+            writeNodes(body, ids, nodes_index, nodes);
+        }
+    }
+
+    for (uint i=0; i<m_blocks.size(); i++){
+        Topo::BlockMeshingData* md = m_blocks[i]->getMeshingData();
+        writeBool(body, md->isMeshed());
+        if (!md->isMeshed())
+            continue;
+        // les noeuds et mailles d'un maillage conservé sous forme IJK sont créés
+        mm.getMesh()->buildStructuredMesh(m_blocks[i]);
+        writeNodes(body, md->nodes(), nodes_index, nodes);
+        std::vector<gmds::TCellID>& regions = md->regions();
+        writeUnsignedLong(body, regions.size());
+        for (uint j=0; j<regions.size(); j++){
+            std::vector<gmds::TCellID> ids = gmds_mesh.get<gmds::Region>(regions[j]).getIDs<gmds::Node>();
+            if (ids.size() != 4 && ids.size() != 5 && ids.size() != 6 && ids.size() != 8)
+                throw TkUtil::Exception(TkUtil::UTF8String ("La sauvegarde de reprise ne supporte que les tétraèdres, pyramides, prismes et hexaèdres", TkUtil::Charset::UTF_8));
+            writeNodes(body, ids, nodes_index, nodes);
+        }
+    }
+
+    writeUnsignedLong(out, nodes.size());
+    for (uint i=0; i<nodes.size(); i++){
+        gmds::Node nd = gmds_mesh.get<gmds::Node>(nodes[i]);
+        writeDouble(out, nd.X());
+        writeDouble(out, nd.Y());
+        writeDouble(out, nd.Z());
+    }
+    out << body.str();
+
+    // les groupes de mailles
+    std::vector<Mesh::Cloud*> clouds;
+    mm.getClouds(clouds);
+    std::vector<Mesh::Cloud*> live_clouds;
+    for (uint i=0; i<clouds.size(); i++)
+        if (!clouds[i]->isDestroyed())
+            live_clouds.push_back(clouds[i]);
+    writeUnsignedLong(out, live_clouds.size());
+    for (uint i=0; i<live_clouds.size(); i++){
+        std::vector<Topo::CoEdge*> coedges;
+        live_clouds[i]->getCoEdges(coedges);
+        std::vector<Topo::Vertex*> vertices;
+        live_clouds[i]->getVertices(vertices);
+        writeString(out, live_clouds[i]->getName());
+        writeRefs(out, coedges, m_index);
+        writeRefs(out, vertices, m_index);
+    }
+
+    std::vector<Mesh::Line*> lines;
+    mm.getLines(lines);
+    std::vector<Mesh::Line*> live_lines;
+    for (uint i=0; i<lines.size(); i++)
+        if (!lines[i]->isDestroyed())
+            live_lines.push_back(lines[i]);
+    writeUnsignedLong(out, live_lines.size());
+    for (uint i=0; i<live_lines.size(); i++){
+        std::vector<Topo::CoEdge*> coedges;
+        live_lines[i]->getCoEdges(coedges);
+        writeString(out, live_lines[i]->getName());
+        writeRefs(out, coedges, m_index);
+    }
+
+    std::vector<Mesh::Surface*> surfaces;
+    mm.getSurfaces(surfaces);
+    std::vector<Mesh::Surface*> live_surfaces;
+    for (uint i=0; i<surfaces.size(); i++)
+        if (!surfaces[i]->isDestroyed())
+            live_surfaces.push_back(surfaces[i]);
+    writeUnsignedLong(out, live_surfaces.size());
+    for (uint i=0; i<live_surfaces.size(); i++){
+        std::vector<Topo::CoFace*> cofaces;
+        live_surfaces[i]->getCoFaces(cofaces);
+        writeString(out, live_surfaces[i]->getName());
+        writeRefs(out, cofaces, m_index);
+    }
+
+    std::vector<Mesh::Volume*> volumes;
+    mm.getVolumes(volumes);
+    std::vector<Mesh::Volume*> live_volumes;
+    for (uint i=0; i<volumes.size(); i++)
+        if (!volumes[i]->isDestroyed())
+            live_volumes.push_back(volumes[i]);
+    writeUnsignedLong(out, live_volumes.size());
+    for (uint i=0; i<live_volumes.size(); i++){
+        std::vector<Topo::Block*> blocks;
+        live_volumes[i]->getBlocks(blocks);
+        writeString(out, live_volumes[i]->getName());
+        writeRefs(out, blocks, m_index);
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// lecture d'une liste d'indices de noeuds, convertis en identifiants gmds
+static void readNodes(std::istream& in, const std::vector<gmds::TCellID>& nodes,
+        std::vector<gmds::TCellID>& ids)
+{
+    ids.resize(readSize(in, 4));
+    for (uint i=0; i<ids.size(); i++){
+        int ind = readInt(in);
+        if (ind < 0 || ind >= (int)nodes.size())
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (indice de noeud hors limites)", TkUtil::Charset::UTF_8));
+        ids[i] = nodes[ind];
+    }
+}
+/*----------------------------------------------------------------------------*/
+void CheckpointImplementation::readMesh(std::istream& in, Internal::CommandRestoreCheckpoint* command)
+{
+    Mesh::MeshManager& mm = m_context.getLocalMeshManager();
+    gmds::IGMesh& gmds_mesh = mm.getMesh()->getGMDSMesh();
+
+    std::vector<gmds::TCellID> nodes(readSize(in, 3*8));
+    for (uint i=0; i<nodes.size(); i++){
+        double x = readDouble(in);
+        double y = readDouble(in);
+        double z = readDouble(in);
+        nodes[i] = gmds_mesh.newNode(x, y, z).getID();
+        command->addCreatedNode(nodes[i]);
+    }
+
+    for (uint i=0; i<m_vertices.size(); i++){
+        if (!readBool(in))
+            continue;
+        int ind = readInt(in);
+        if (ind < 0 || ind >= (int)nodes.size())
+            throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (indice de noeud hors limites)", TkUtil::Charset::UTF_8));
+        Topo::VertexMeshingData* md = m_vertices[i]->getMeshingData();
+        md->setNode(nodes[ind]);
+        md->setMeshed(true);
+        m_vertices[i]->updateMeshStamp();
+    }
+
+    for (uint i=0; i<m_coedges.size(); i++){
+        if (!readBool(in))
+            continue;
+        Topo::CoEdgeMeshingData* md = m_coedges[i]->getMeshingData();
+        readNodes(in, nodes, md->nodes());
+        unsigned long nb = readUnsignedLong(in);
+        for (unsigned long j=0; j<nb; j++){
+            std::vector<gmds::TCellID> ids(2);
+            for (uint k=0; k<2; k++){
+                int ind = readInt(in);
+                if (ind < 0 || ind >= (int)nodes.size())
+                    throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (indice de noeud hors limites)", TkUtil::Charset::UTF_8));
+                ids[k] = nodes[ind];
+            }
+            gmds::TCellID id = gmds_mesh.newEdge(ids[0], ids[1]).getID();
+            md->edges().push_back(id);
+            command->addCreatedEdge(id);
+        }
+        md->setMeshed(true);
+        m_coedges[i]->updateMeshStamp();
+    }
+
+    for (uint i=0; i<m_cofaces.size(); i++){
+        if (!readBool(in))
+            continue;
+        Topo::CoFaceMeshingData* md = m_cofaces[i]->getMeshingData();
+        readNodes(in, nodes, md->nodes());
+        unsigned long nb = readUnsignedLong(in);
+        for (unsigned long j=0; j<nb; j++){
+            std::vector<gmds::TCellID> ids;
+            readNodes(in, nodes, ids);
+            std::vector<gmds::Node> nds;
+            for (uint k=0; k<ids.size(); k++)
+                nds.push_back(gmds_mesh.get<gmds::Node>(ids[k]));
+            gmds::TCellID id;
+            if (nds.size() == 3)
+                id = gmds_mesh.newTriangle(nds[0], nds[1], nds[2]).getID();
+            else if (nds.size() == 4)
+                id = gmds_mesh.newQuad(nds[0], nds[1], nds[2], nds[3]).getID();
+            else
+                throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (type de maille surfacique)", TkUtil::Charset::UTF_8));
+            md->faces().push_back(id);
+            command->addCreatedFace(id);
+        }
+        md->setMeshed(true);
+        m_cofaces[i]->updateMeshStamp();
+    }
+
+    for (uint i=0; i<m_blocks.size(); i++){
+        if (!readBool(in))
+            continue;
+        Topo::BlockMeshingData* md = m_blocks[i]->getMeshingData();
+        readNodes(in, nodes, md->nodes());
+        unsigned long nb = readUnsignedLong(in);
+        for (unsigned long j=0; j<nb; j++){
+            std::vector<gmds::TCellID> ids;
+            readNodes(in, nodes, ids);
+            std::vector<gmds::Node> nds;
+            for (uint k=0; k<ids.size(); k++)
+                nds.push_back(gmds_mesh.get<gmds::Node>(ids[k]));
+            gmds::TCellID id;
+            if (nds.size() == 4)
+                id = gmds_mesh.newTet(nds[0], nds[1], nds[2], nds[3]).getID();
+            else if (nds.size() == 5)
+                id = gmds_mesh.newPyramid(nds[0], nds[1], nds[2], nds[3], nds[4]).getID();
+            else if (nds.size() == 6)
+                id = gmds_mesh.newPrism3(nds[0], nds[1], nds[2], nds[3], nds[4], nds[5]).getID();
+            else if (nds.size() == 8)
+                id = gmds_mesh.newHex(nds[0], nds[1], nds[2], nds[3], nds[4], nds[5], nds[6], nds[7]).getID();
+            else
+                throw TkUtil::Exception(TkUtil::UTF8String ("Fichier de reprise incohérent (type de maille volumique)", TkUtil::Charset::UTF_8));
+            md->regions().push_back(id);
+            command->addCreatedRegion(id);
+        }
+        md->setMeshed(true);
+        m_blocks[i]->updateMeshStamp();
+    }
+
+    // les groupes de mailles
+    unsigned long nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        std::string name = readString(in);
+        std::vector<Topo::CoEdge*> coedges;
+        readRefs(in, m_coedges, coedges);
+        std::vector<Topo::Vertex*> vertices;
+        readRefs(in, m_vertices, vertices);
+        command->addNewCloud(name);
+        Mesh::Cloud* cl = mm.getCloud(name);
+        for (uint j=0; j<coedges.size(); j++)
+            cl->addCoEdge(coedges[j]);
+        for (uint j=0; j<vertices.size(); j++)
+            cl->addVertex(vertices[j]);
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        std::string name = readString(in);
+        std::vector<Topo::CoEdge*> coedges;
+        readRefs(in, m_coedges, coedges);
+        command->addNewLine(name);
+        Mesh::Line* ln = mm.getLine(name);
+        for (uint j=0; j<coedges.size(); j++)
+            ln->addCoEdge(coedges[j]);
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        std::string name = readString(in);
+        std::vector<Topo::CoFace*> cofaces;
+        readRefs(in, m_cofaces, cofaces);
+        command->addNewSurface(name);
+        Mesh::Surface* sf = mm.getSurface(name);
+        for (uint j=0; j<cofaces.size(); j++)
+            sf->addCoFace(cofaces[j]);
+    }
+
+    nb = readUnsignedLong(in);
+    for (unsigned long i=0; i<nb; i++){
+        std::string name = readString(in);
+        std::vector<Topo::Block*> blocks;
+        readRefs(in, m_blocks, blocks);
+        command->addNewVolume(name);
+        Mesh::Volume* vo = mm.getVolume(name);
+        for (uint j=0; j<blocks.size(); j++)
+            vo->addBlock(blocks[j]);
+        m_context.newGraphicalRepresentation(*vo);
+    }
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -71,14 +71,7 @@ internalExecute()
             icmd.addGeomInfoEntity(ge, t);
         }
 
-        std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd_iter.getTopoInfoEntity();
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-                iter_tei != topo_entities_info.end(); ++iter_tei){
-            Topo::TopoEntity* te = iter_tei->first;
-            Internal::InfoCommand::type t = iter_tei->second;
-
-            icmd.addTopoInfoEntity(te, t);
-        }
+        icmd.mergeTopoInfoEntities(icmd_iter.getTopoInfoEntity());
 
         for (uint i=0; i<icmd_iter.getNbMeshInfoEntity(); i++) {
             Mesh::MeshEntity* me = 0;
@@ -88,14 +81,8 @@ internalExecute()
             icmd.addMeshInfoEntity(me, t);
         }
 
-        std::map<Group::GroupEntity*, Internal::InfoCommand::type>& group_entities_info = icmd_iter.getGroupInfoEntity();
-        for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::iterator iter_grp = group_entities_info.begin();
-                iter_grp != group_entities_info.end(); ++iter_grp){
-            Group::GroupEntity* grp = iter_grp->first;
-            InfoCommand::type& t = iter_grp->second;
-
-            icmd.addGroupInfoEntity(grp, t);
-        } // end for ( ... iter ...)
+        Internal::InfoCommand::GroupInfoMap& group_entities_info = icmd_iter.getGroupInfoEntity();
+        icmd.mergeGroupInfoEntities(group_entities_info);
 
         for (uint i=0; i<icmd_iter.getNbSysCoordInfoEntity(); i++) {
         	CoordinateSystem::SysCoord* rep = 0;
@@ -72,6 +72,11 @@ void CommandCreator::log (const TkUtil::Log& l)
 
 }   // CommandCreator::log
 /*----------------------------------------------------------------------------*/
+bool CommandCreator::isLogEnabled (TkUtil::Log::TYPE type) const
+{
+    return (0 != m_context) && m_context->isLogEnabled (type);
+}   // CommandCreator::isLogEnabled
+/*----------------------------------------------------------------------------*/
 TkUtil::LogOutputStream* CommandCreator::getLogStream ( )
 {
     return (m_context?m_context->getLogStream():0);
@@ -55,9 +55,9 @@ CommandInternal::~CommandInternal()
     std::cout<<"CommandInternal::~CommandInternal() pour la commande "<<getScriptComments()<<" uniqueName: "<<getUniqueName()<<std::endl;
 #endif
 
-	std::map<Group::GroupEntity*, Internal::InfoCommand::type>& gei = getInfoCommand().getGroupInfoEntity();
+	Internal::InfoCommand::GroupInfoMap& gei = getInfoCommand().getGroupInfoEntity();
 
-	for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::const_iterator iter = gei.begin();
+	for (Internal::InfoCommand::GroupInfoMap::const_iterator iter = gei.begin();
 			iter != gei.end(); ++iter) {
 		if (iter->second == InfoCommand::DELETED){
 #ifdef _DEBUG_MEMORY
@@ -222,12 +222,6 @@ Utils::Command::status CommandInternal::undo ( )
 {
     TkUtil::AutoMutex	autoMutex (getCommandMutex ( ));
 
-    TkUtil::UTF8String   message1 (TkUtil::Charset::UTF_8), message2 (TkUtil::Charset::UTF_8);
-    message1 << "Annulation de la commande " << getName ( ) << " de nom unique "
-             << getUniqueName ( );
-    message2    = message1;
-    message1 << " en cours.";
-
     if (DONE != getStatus ( ))
     {
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -237,7 +231,8 @@ Utils::Command::status CommandInternal::undo ( )
         throw TkUtil::Exception (message);
     }   // if (DONE != getStatus ( ))
     else
-        log (TkUtil::TraceLog(message1, TkUtil::Log::TRACE_3));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "Annulation de la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ) << " en cours.");
 
 
     getTimer ( ).reset ( );
@@ -252,25 +247,21 @@ Utils::Command::status CommandInternal::undo ( )
     // change le status et fait les callbacks
     setStatus (Command::INITED);
 
-    message2 << " effectué.";
-    log (TkUtil::TraceLog(message2, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "Annulation de la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ) << " effectué.");
 
     return getStatus ( );
 }   // Command::undo
 /*----------------------------------------------------------------------------*/
 Utils::Command::status CommandInternal::redo ( )
 {
-    TkUtil::UTF8String   message1 (TkUtil::Charset::UTF_8), message2 (TkUtil::Charset::UTF_8);
-    message1 << "Rejeu de la commande " << getName ( ) << " de nom unique "
-            << getUniqueName ( );
-    message2    = message1;
-    message1 << " en cours.";
 	getTimer ( ).start ( );
 
     if (Utils::Command::INITED != getStatus ( ))
         throw TkUtil::Exception (TkUtil::UTF8String ("Command::redo impossible, status différent du status initial.", TkUtil::Charset::UTF_8));
     else
-        log (TkUtil::TraceLog(message1, TkUtil::Log::TRACE_3));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "Rejeu de la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ) << " en cours.");
 
     // ce qui est propre à la commande
     internalRedo();
@@ -285,8 +276,8 @@ Utils::Command::status CommandInternal::redo ( )
         setStatus (Command::DONE);
     }
 
-    message2 << " effectué.";
-    log (TkUtil::TraceLog(message2, TkUtil::Log::TRACE_3));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_3, "Rejeu de la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ) << " effectué.");
 
     return getStatus ( );
 } // Command::redo
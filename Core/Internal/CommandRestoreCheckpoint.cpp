@@ -0,0 +1,70 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CommandRestoreCheckpoint.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Internal/CommandRestoreCheckpoint.h"
+#include "Internal/CheckpointImplementation.h"
+#include "Internal/Context.h"
+#include "Geom/GeomManager.h"
+#include "Topo/TopoManager.h"
+#include <TkUtil/Exception.h>
+#include <TkUtil/TraceLog.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+CommandRestoreCheckpoint::
+CommandRestoreCheckpoint(Internal::Context& c, CheckpointImplementation* impl)
+: Mesh::CommandCreateMesh(c, "Reprise de session", 0)
+, m_impl(impl)
+{
+}
+/*----------------------------------------------------------------------------*/
+CommandRestoreCheckpoint::~CommandRestoreCheckpoint()
+{
+}
+/*----------------------------------------------------------------------------*/
+void CommandRestoreCheckpoint::
+internalExecute()
+{
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+    message << "CommandRestoreCheckpoint::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( );
+
+    // les noms des entités reprises ne doivent pas entrer en conflit avec ceux de la session
+    Geom::GeomManager& gm = getContext().getLocalGeomManager();
+    std::vector<Topo::Vertex*> vertices;
+    getContext().getLocalTopoManager().getVertices(vertices);
+    if (gm.getNbVolumes() != 0 || gm.getNbSurfaces() != 0 || gm.getNbCurves() != 0
+    		|| gm.getNbVertices() != 0 || !vertices.empty())
+		throw TkUtil::Exception (TkUtil::UTF8String ("La reprise d'une session ne peut se faire que dans une session vide", TkUtil::Charset::UTF_8));
+
+    m_impl->perform(this);
+
+    // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
+	saveInternalsStats();
+
+	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+}
+/*----------------------------------------------------------------------------*/
+void CommandRestoreCheckpoint::internalUndo()
+{
+	throw TkUtil::Exception (TkUtil::UTF8String ("Erreur, la commande de reprise de session n'est pas annulable", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+void CommandRestoreCheckpoint::internalRedo()
+{
+	throw TkUtil::Exception (TkUtil::UTF8String ("Erreur, la commande de reprise de session n'est pas rejouable", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -21,6 +21,8 @@
 #include "Internal/M3DCommandResult.h"
 #include "Internal/InternalPreferences.h"
 #include "Internal/CommandComposite.h"
+#include "Internal/CheckpointImplementation.h"
+#include "Internal/CommandRestoreCheckpoint.h"
 #include "Internal/PythonWriter.h"
 
 #include "Utils/TypeDedicatedNameManager.h"
@@ -29,6 +31,7 @@
 #include "Utils/DefaultGraphicalRepresentationFactory.h"
 #include "Utils/GraphicalEntityRepresentation.h"
 #include "Utils/Property.h"
+#include "Utils/NameArena.h"
 #include "Utils/DisplayProperties.h"
 #include "Utils/CommandManager.h"
 #include "Utils/Entity.h"
@@ -49,6 +52,7 @@
 
 #include "Mesh/CommandDestroyMesh.h"
 #include "Mesh/CommandChangeMeshDim.h"
+#include "Mesh/GMSHFaceTriangulator.h"
 
 #include "SysCoord/SysCoordManager.h"
 
@@ -56,6 +60,7 @@ extern TkUtil::PythonSession* createMgx3DPythonSession ( );
 
 #include <TkUtil/Mutex.h>
 #include <TkUtil/ErrorLog.h>
+#include <TkUtil/TraceLog.h>
 #include <TkUtil/Exception.h>
 #include <TkUtil/Locale.h>
 #include <TkUtil/MemoryError.h>
@@ -117,6 +122,26 @@ static std::string scriptToMinScript (const std::string& fileName)
 	return userFileName.ascii ( );
 }	// scriptToMinScript
 /*----------------------------------------------------------------------------*/
+static std::string pythonStringLiteral (const std::string& str)
+{
+	// Chaîne Python entre guillemets : le nom de fichier est recopié tel quel
+	// dans le script, hormis les caractères qui y sont interprétés
+	std::string	literal ("\"");
+	for (std::string::size_type i = 0; i < str.length ( ); i++)
+	{
+		switch (str [i])
+		{
+			case '\\'	: literal += "\\\\";	break;
+			case '"'	: literal += "\\\"";	break;
+			case '\n'	: literal += "\\n";	break;
+			case '\r'	: literal += "\\r";	break;
+			default		: literal += str [i];
+		}	// switch (str [i])
+	}	// for (std::string::size_type i = 0; ...
+
+	return literal + '"';
+}	// pythonStringLiteral
+/*----------------------------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 static unsigned char toNormalizedUChar (double value)
@@ -261,6 +286,7 @@ Context::Context(const std::string& name, bool withStdOutputs)
 , m_python_session (0) //new TkUtil::PythonSession ( ))
 , m_geom_manager (new Geom::GeomManager (createName ("GeomManager"), this))
 , m_topo_manager (new Topo::TopoManager (createName ("TopoManager"), this))
+, m_local_topo_manager (dynamic_cast<Topo::TopoManager*>(m_topo_manager))
 , m_mesh_manager (new Mesh::MeshManager (createName ("MeshManager"), this))
 , m_group_manager (new Group::GroupManager (createName ("GroupManager"), this))
 , m_sys_coord_manager (new CoordinateSystem::SysCoordManager (createName ("GroupManager"), this))
@@ -281,6 +307,10 @@ Context::Context(const std::string& name, bool withStdOutputs)
 , m_is_graphical(false)
 , m_preview_mode (false)
 , m_ratio_degrad(1)
+, m_gmsh_workers_num(-1)
+, m_gmsh_worker_path ( )
+, m_geom_pairwise_search(false)
+, m_split_blocks_full_scan(false)
 , m_landmark(Utils::Landmark::undefined)
 , m_length_unit(Utils::Unit::undefined)
 , m_mesh_dim(MESH3D)
@@ -563,6 +593,7 @@ Context::Context (const Context&)
 , m_python_session (0)
 , m_geom_manager (0)
 , m_topo_manager (0)
+, m_local_topo_manager (0)
 , m_mesh_manager (0)
 , m_group_manager (0)
 , m_sys_coord_manager (0)
@@ -583,6 +614,10 @@ Context::Context (const Context&)
 , m_is_graphical(false)
 , m_preview_mode (false)
 , m_ratio_degrad(1)
+, m_gmsh_workers_num(-1)
+, m_gmsh_worker_path ( )
+, m_geom_pairwise_search(false)
+, m_split_blocks_full_scan(false)
 , m_landmark(Utils::Landmark::undefined)
 , m_length_unit(Utils::Unit::undefined)
 , m_mesh_dim(MESH3D)
@@ -660,6 +695,7 @@ Context::~Context()
     delete m_name_manager;			m_name_manager		= 0;
     delete m_geom_manager;			m_geom_manager		= 0;
     delete m_topo_manager;			m_topo_manager		= 0;
+    m_local_topo_manager	= 0;
     delete m_mesh_manager;			m_mesh_manager		= 0;
     delete m_group_manager;			m_group_manager		= 0;
     delete m_sys_coord_manager;     m_sys_coord_manager = 0;
@@ -804,13 +840,13 @@ void Context::setTopoManager (Mgx3D::Topo::TopoManagerIfc* manager)
 {
 	delete m_topo_manager;
 	m_topo_manager	= manager;
+	m_local_topo_manager	= dynamic_cast<Topo::TopoManager*>(manager);
 }
 /*----------------------------------------------------------------------------*/
 Mgx3D::Topo::TopoManager& Context::getLocalTopoManager ( )
 {
-	Topo::TopoManager*	manager	= dynamic_cast<Topo::TopoManager*>(m_topo_manager);
-	CHECK_NULL_PTR_ERROR (manager)
-	return *manager;
+	CHECK_NULL_PTR_ERROR (m_local_topo_manager)
+	return *m_local_topo_manager;
 }
 /*----------------------------------------------------------------------------*/
 Mgx3D::Mesh::MeshManagerIfc& Context::getMeshManager ( )
@@ -967,6 +1003,94 @@ void Context::setLogsMask (TkUtil::Log::TYPE mask)
 	m_logMask	= mask;
 }	// Context::setLogsMask
 /*----------------------------------------------------------------------------*/
+/// les logs de trace détaillés, masqués en production
+static const TkUtil::Log::TYPE	traceLogs	=
+		(TkUtil::Log::TYPE)(TkUtil::Log::TRACE_3 | TkUtil::Log::TRACE_4 |
+		TkUtil::Log::TRACE_5);
+/*----------------------------------------------------------------------------*/
+bool Context::getTraceLogsEnabled ( ) const
+{
+	return 0 != (m_log_dispatcher.getMask ( ) & traceLogs);
+}	// Context::getTraceLogsEnabled
+/*----------------------------------------------------------------------------*/
+void Context::setTraceLogsEnabled (bool enable)
+{
+	if (true == enable)
+		m_log_dispatcher.setMask (
+				(TkUtil::Log::TYPE)(m_log_dispatcher.getMask ( ) | traceLogs));
+	else
+		m_log_dispatcher.setMask (
+				(TkUtil::Log::TYPE)(m_log_dispatcher.getMask ( ) & ~traceLogs));
+}	// Context::setTraceLogsEnabled
+/*----------------------------------------------------------------------------*/
+unsigned long Context::getTraceLogsCount ( ) const
+{
+	return m_log_dispatcher.getTraceLogsCount ( );
+}	// Context::getTraceLogsCount
+/*----------------------------------------------------------------------------*/
+unsigned long Context::getDisplayAttributesSharingCount (Utils::Entity::objectType ot) const
+{
+	std::map<Utils::Entity::objectType, Utils::DisplayProperties>::const_iterator	itm	=
+										m_displayPropertiesModels.find (ot);
+	if (m_displayPropertiesModels.end ( ) == itm)
+		return 0;
+
+	// Le modèle lui-même n'est pas une entité :
+	return itm->second.getAttributesSharingCount ( ) - 1;
+}	// Context::getDisplayAttributesSharingCount
+/*----------------------------------------------------------------------------*/
+long Context::getDisplayAttributesMemorySaved ( ) const
+{
+	unsigned long	sharing	= 0;
+	for (std::map<Utils::Entity::objectType, Utils::DisplayProperties>::const_iterator itm =
+			m_displayPropertiesModels.begin ( ); m_displayPropertiesModels.end ( ) != itm; itm++)
+		sharing	+= getDisplayAttributesSharingCount (itm->first);
+
+	return (long)(sharing * Utils::DisplayProperties::getAttributesMemory ( ));
+}	// Context::getDisplayAttributesMemorySaved
+/*----------------------------------------------------------------------------*/
+long Context::getNamesMemorySaved ( ) const
+{
+	return Utils::NameArena::getSavedMemory ( );
+}	// Context::getNamesMemorySaved
+/*----------------------------------------------------------------------------*/
+unsigned long Context::getInternedNamesCount ( ) const
+{
+	return Utils::NameArena::getNbNames ( );
+}	// Context::getInternedNamesCount
+/*----------------------------------------------------------------------------*/
+Context::TraceCountingLogDispatcher::TraceCountingLogDispatcher ( )
+	: TkUtil::LogDispatcher ( ), m_trace_logs_count (0), m_count_mutex ( )
+{
+}	// TraceCountingLogDispatcher::TraceCountingLogDispatcher
+/*----------------------------------------------------------------------------*/
+Context::TraceCountingLogDispatcher::TraceCountingLogDispatcher (
+												TkUtil::Log::TYPE mask)
+	: TkUtil::LogDispatcher (mask), m_trace_logs_count (0), m_count_mutex ( )
+{
+}	// TraceCountingLogDispatcher::TraceCountingLogDispatcher
+/*----------------------------------------------------------------------------*/
+Context::TraceCountingLogDispatcher::~TraceCountingLogDispatcher ( )
+{
+}	// TraceCountingLogDispatcher::~TraceCountingLogDispatcher
+/*----------------------------------------------------------------------------*/
+void Context::TraceCountingLogDispatcher::log (const TkUtil::Log& log)
+{
+	if (0 != (log.getType ( ) & traceLogs))
+	{
+		TkUtil::AutoMutex	autoMutex (&m_count_mutex);
+		m_trace_logs_count++;
+	}	// if (0 != (log.getType ( ) & traceLogs))
+
+	TkUtil::LogDispatcher::log (log);
+}	// TraceCountingLogDispatcher::log
+/*----------------------------------------------------------------------------*/
+unsigned long Context::TraceCountingLogDispatcher::getTraceLogsCount ( ) const
+{
+	TkUtil::AutoMutex	autoMutex (&m_count_mutex);
+	return m_trace_logs_count;
+}	// TraceCountingLogDispatcher::getTraceLogsCount
+/*----------------------------------------------------------------------------*/
 Internal::ScriptingManager& Context::getScriptingManager()
 {
 	CHECK_NULL_PTR_ERROR (m_scripting_manager)
@@ -1261,10 +1385,9 @@ unsigned long Context::globalMask (Utils::Entity::objectType ot) const
 
 
 /*----------------------------------------------------------------------------*/
-Utils::DisplayProperties* Context::newDisplayProperties(const Utils::Entity::objectType& ot)
+const Utils::DisplayProperties& Context::newDisplayProperties(const Utils::Entity::objectType& ot)
 {
-	Utils::DisplayProperties*	properties	=
-				new Utils::DisplayProperties (globalDisplayProperties (ot));
+	Utils::DisplayProperties	properties (globalDisplayProperties (ot));
 
 	switch (ot)
 	{
@@ -1272,9 +1395,9 @@ Utils::DisplayProperties* Context::newDisplayProperties(const Utils::Entity::obj
 		case Utils::Entity::GeomCurve	:
 		case Utils::Entity::GeomSurface	:
 		case Utils::Entity::GeomVolume	:
-			properties->setCloudColor (m_geom_displayColor);
-			properties->setWireColor (m_geom_displayColor);
-			properties->setSurfacicColor (m_geom_displayColor);
+			properties.setCloudColor (m_geom_displayColor);
+			properties.setWireColor (m_geom_displayColor);
+			properties.setSurfacicColor (m_geom_displayColor);
 			if (false == isPreviewMode ( ))
 				m_geom_displayColor	= nextColor (
 					*this, m_geom_displayColor, -.37, -.05, .18, getBackground ( ));
@@ -1282,14 +1405,14 @@ Utils::DisplayProperties* Context::newDisplayProperties(const Utils::Entity::obj
     	case Utils::Entity::TopoFace		:
     	case Utils::Entity::TopoCoFace		:
     	case Utils::Entity::TopoBlock		:
-			properties->setShrinkFactor(0.9);
+			properties.setShrinkFactor(0.9);
     	case Utils::Entity::TopoVertex		:
     	case Utils::Entity::TopoEdge		:
     	case Utils::Entity::TopoCoEdge		:
-			properties->setCloudColor (m_topo_displayColor);
-			properties->setWireColor (m_topo_displayColor);
-			properties->setSurfacicColor (m_topo_displayColor);
-			properties->setFontColor (m_topo_displayColor);
+			properties.setCloudColor (m_topo_displayColor);
+			properties.setWireColor (m_topo_displayColor);
+			properties.setSurfacicColor (m_topo_displayColor);
+			properties.setFontColor (m_topo_displayColor);
 			break;
     	case Utils::Entity::MeshCloud		:
     	case Utils::Entity::MeshLine		:
@@ -1297,27 +1420,27 @@ Utils::DisplayProperties* Context::newDisplayProperties(const Utils::Entity::obj
         case Utils::Entity::MeshSubSurface	:
         case Utils::Entity::MeshVolume		:
         case Utils::Entity::MeshSubVolume	:
-			properties->setCloudColor (m_mesh_displayColor);
-//			properties->setWireColor (m_mesh_displayColor);
-			properties->setWireColor (TkUtil::Color(255, 255, 255)); 
-			properties->setSurfacicColor (m_mesh_displayColor);
-			properties->setFontColor (m_mesh_displayColor);
+			properties.setCloudColor (m_mesh_displayColor);
+//			properties.setWireColor (m_mesh_displayColor);
+			properties.setWireColor (TkUtil::Color(255, 255, 255)); 
+			properties.setSurfacicColor (m_mesh_displayColor);
+			properties.setFontColor (m_mesh_displayColor);
 			if (false == isPreviewMode ( ))
  			       	m_mesh_displayColor = nextColor (
 					*this, m_mesh_displayColor, .18, -.05, -.37, getBackground ( ));
 			break;
 		case Utils::Entity::StructuredMesh		:
-			properties->setWireColor (TkUtil::Color(255, 255, 255)); 
-			properties->setSurfacicColor (m_mesh_displayColor);
-			properties->setFontColor (m_mesh_displayColor);
+			properties.setWireColor (TkUtil::Color(255, 255, 255)); 
+			properties.setSurfacicColor (m_mesh_displayColor);
+			properties.setFontColor (m_mesh_displayColor);
 			break;
 		case Utils::Entity::Group0D			:
 		case Utils::Entity::Group1D			:
 		case Utils::Entity::Group2D			:
 		case Utils::Entity::Group3D			:
-			properties->setCloudColor (m_mesh_displayColor);
-			properties->setWireColor (m_mesh_displayColor);
-			properties->setSurfacicColor (m_mesh_displayColor);
+			properties.setCloudColor (m_mesh_displayColor);
+			properties.setWireColor (m_mesh_displayColor);
+			properties.setSurfacicColor (m_mesh_displayColor);
 			if (false == isPreviewMode ( ))
         			m_group_displayColor    = nextColor (
 					*this, m_group_displayColor, -.05, -.37, .18, getBackground( ));
@@ -1325,7 +1448,18 @@ Utils::DisplayProperties* Context::newDisplayProperties(const Utils::Entity::obj
 			;
 	}	// switch (ot)
 
-	return properties;
+	// Les entités d'un même type ont souvent les mêmes attributs graphiques
+	// (ex : la topologie), qui sont alors partagés jusqu'à leur modification.
+	// Le modèle n'est remplacé que lorsque ces attributs changent :
+	std::map<Utils::Entity::objectType, Utils::DisplayProperties>::iterator	itm	=
+										m_displayPropertiesModels.find (ot);
+	if (m_displayPropertiesModels.end ( ) == itm)
+		itm	= m_displayPropertiesModels.insert (
+								std::make_pair (ot, properties)).first;
+	else if (false == properties.shareAttributes (itm->second))
+		itm->second	= properties;
+
+	return itm->second;
 }
 /*----------------------------------------------------------------------------*/
 void Context::newGraphicalRepresentation (Utils::Entity& entity)
@@ -1341,10 +1475,13 @@ void Context::newGraphicalRepresentation (Utils::Entity& entity)
 /*----------------------------------------------------------------------------*/
 void Context::undo()
 {
+    // le script doit contenir la commande annulée
+    getScriptingManager().sync();
     getCommandManager().undo();
 }
 void Context::redo()
 {
+    getScriptingManager().sync();
     getCommandManager().redo();
 }
 /*----------------------------------------------------------------------------*/
@@ -1410,6 +1547,11 @@ void Context::setBackground (const TkUtil::Color& color)
 	m_backgroundColor	= color;
 }
 /*----------------------------------------------------------------------------*/
+std::string Context::getGmshWorkerPath ( ) const
+{
+	return Mesh::GMSHFaceTriangulator::getWorkerPath (m_gmsh_worker_path);
+}
+/*----------------------------------------------------------------------------*/
 void Context::beginImportScript()
 {
     // s'il y a des entités de construites, il faut mémoriser les ids actuels
@@ -1428,12 +1570,14 @@ void Context::savePythonScript (std::string fileName, encodageScripts enc, TkUti
 //	std::cout<<"Context::savePythonScript("<<fileName<<", "
 //			<<(withoutEntityName?"true":"false")<<")"<<std::endl;
 
+	getScriptingManager().sync();
+
 	ScriptingManager scripting_manager(this);
 	scripting_manager.setCharset (charset);
 	std::vector<Utils::Command*> commands = getLocalCommandManager().getCommands();
 
 	if (enc == Context::WITHNAMES || enc == Context::WITHIDREF){
-		scripting_manager.initPython(fileName);
+		scripting_manager.initPython(fileName, true, false);
 	}
 
 	if (enc == Context::WITHIDREF) {
@@ -1471,7 +1615,8 @@ void Context::savePythonScript (std::string fileName, encodageScripts enc, TkUti
 		// on fait comme pour le cas WITHNAMES dans un fichier temporaire
 		std::string fileNameTmp = getScriptingManager().getPythonWriter()->getFileName();
 		fileNameTmp = scriptToMinScript(fileNameTmp);
-		scripting_manager.initPython(fileNameTmp);
+		// écriture synchrone, le fichier est relu aussitôt par la version batch
+		scripting_manager.initPython(fileNameTmp, true, false);
 
 		TkUtil::UTF8String   shiftingLine (TkUtil::Charset::UTF_8);
 		shiftingLine << getContextAlias() << ".unactivateShiftingNameId()";
@@ -1587,6 +1732,74 @@ Internal::M3DCommandResultIfc* Context::setMesh2D()
     return cmdResult;
 }
 /*----------------------------------------------------------------------------*/
+void Context::saveCheckpoint(std::string fileName, bool withMesh)
+{
+	if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Sauvegarde de la session dans le fichier de reprise " << fileName;
+		getLogDispatcher ( ).log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	}
+
+	// le script doit être complet au moment de la reprise
+	getScriptingManager().sync();
+
+	// ce n'est pas une commande, l'état de la session n'est pas modifié
+	CheckpointImplementation impl(*this, fileName);
+	impl.save(withMesh);
+}
+/*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* Context::restoreCheckpoint(std::string fileName)
+{
+	if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Reprise de la session depuis le fichier " << fileName;
+		getLogDispatcher ( ).log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	}
+
+	// lecture de l'en-tête pour préparer unité, repère et dimension du maillage
+	CheckpointImplementation* impl = new CheckpointImplementation(*this, fileName);
+	try {
+		impl->readHeader();
+	}
+	catch (...) {
+		delete impl;
+		throw;
+	}
+
+	// creation de la commande composite
+	CommandComposite* command = new CommandComposite(*this, "Reprise de session");
+
+	if (impl->getLengthUnit() != getLengthUnit())
+		command->addCommand(new CommandChangeLengthUnit(*this, impl->getLengthUnit()));
+	if (impl->getLandmark() != getLandmark())
+		command->addCommand(new CommandChangeLandmark(*this, impl->getLandmark()));
+	if (impl->getMeshDim() != getMeshDim())
+		command->addCommand(new Mesh::CommandChangeMeshDim(*this, impl->getMeshDim()));
+	command->addCommand(new CommandRestoreCheckpoint(*this, impl));
+
+	// trace dans le script
+	TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
+	cmd << getContextAlias() << ".restoreCheckpoint(" << pythonStringLiteral (fileName) << ")";
+	command->setScriptCommand(cmd);
+
+    // on passe au gestionnaire de commandes qui exécute la commande en // ou non
+    // et la stocke dans le gestionnaire de undo-redo si c'est une réussite
+	try {
+		getCommandManager().addCommand(command, Utils::Command::DO);
+	}
+	catch (...) {
+		delete impl;
+		throw;
+	}
+
+	// la commande n'étant pas threadable, la lecture est terminée
+	delete impl;
+
+    Internal::M3DCommandResultIfc*  cmdResult   =
+            new Internal::M3DCommandResult (*command);
+    return cmdResult;
+}
+/*----------------------------------------------------------------------------*/
 const std::vector<Utils::Entity*> Context::getAllVisibleEntities()
 {
 	std::vector<Utils::Entity*> entities;
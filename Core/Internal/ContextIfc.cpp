@@ -342,6 +342,46 @@ TkUtil::LogOutputStream* ContextIfc::getLogStream ( )
 	throw TkUtil::Exception ("ContextIfc::getLogStream should be overloaded.");
 }	// ContextIfc::getLogStream
 /*----------------------------------------------------------------------------*/
+bool ContextIfc::isLogEnabled (TkUtil::Log::TYPE) const
+{
+	throw TkUtil::Exception ("ContextIfc::isLogEnabled should be overloaded.");
+}	// ContextIfc::isLogEnabled
+/*----------------------------------------------------------------------------*/
+bool ContextIfc::getTraceLogsEnabled ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getTraceLogsEnabled should be overloaded.");
+}	// ContextIfc::getTraceLogsEnabled
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setTraceLogsEnabled (bool)
+{
+	throw TkUtil::Exception ("ContextIfc::setTraceLogsEnabled should be overloaded.");
+}	// ContextIfc::setTraceLogsEnabled
+/*----------------------------------------------------------------------------*/
+unsigned long ContextIfc::getTraceLogsCount ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getTraceLogsCount should be overloaded.");
+}	// ContextIfc::getTraceLogsCount
+/*----------------------------------------------------------------------------*/
+unsigned long ContextIfc::getDisplayAttributesSharingCount (Utils::Entity::objectType) const
+{
+	throw TkUtil::Exception ("ContextIfc::getDisplayAttributesSharingCount should be overloaded.");
+}	// ContextIfc::getDisplayAttributesSharingCount
+/*----------------------------------------------------------------------------*/
+long ContextIfc::getDisplayAttributesMemorySaved ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getDisplayAttributesMemorySaved should be overloaded.");
+}	// ContextIfc::getDisplayAttributesMemorySaved
+/*----------------------------------------------------------------------------*/
+long ContextIfc::getNamesMemorySaved ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getNamesMemorySaved should be overloaded.");
+}	// ContextIfc::getNamesMemorySaved
+/*----------------------------------------------------------------------------*/
+unsigned long ContextIfc::getInternedNamesCount ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getInternedNamesCount should be overloaded.");
+}	// ContextIfc::getInternedNamesCount
+/*----------------------------------------------------------------------------*/
 Internal::ScriptingManager& ContextIfc::getScriptingManager ( )
 {
 	throw TkUtil::Exception ("ContextIfc::getScriptingManager should be overloaded.");
@@ -407,6 +447,66 @@ void ContextIfc::setRatioDegrad(int ratio)
 	throw TkUtil::Exception ("ContextIfc::setRatioDegrad should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
+bool ContextIfc::getAllowThreadedCommandTasks() const
+{
+	return allowThreadedCommandTasks.getValue();
+}
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setAllowThreadedCommandTasks(bool allow)
+{
+	allowThreadedCommandTasks.setValue(allow);
+}
+/*----------------------------------------------------------------------------*/
+int ContextIfc::getGmshWorkersNum ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getGmshWorkersNum should be overloaded.");
+}	// ContextIfc::getGmshWorkersNum
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setGmshWorkersNum (int)
+{
+	throw TkUtil::Exception ("ContextIfc::setGmshWorkersNum should be overloaded.");
+}	// ContextIfc::setGmshWorkersNum
+/*----------------------------------------------------------------------------*/
+std::string ContextIfc::getGmshWorkerPath ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getGmshWorkerPath should be overloaded.");
+}	// ContextIfc::getGmshWorkerPath
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setGmshWorkerPath (const std::string&)
+{
+	throw TkUtil::Exception ("ContextIfc::setGmshWorkerPath should be overloaded.");
+}	// ContextIfc::setGmshWorkerPath
+/*----------------------------------------------------------------------------*/
+bool ContextIfc::getGeomPairwiseSearch ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getGeomPairwiseSearch should be overloaded.");
+}	// ContextIfc::getGeomPairwiseSearch
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setGeomPairwiseSearch (bool)
+{
+	throw TkUtil::Exception ("ContextIfc::setGeomPairwiseSearch should be overloaded.");
+}	// ContextIfc::setGeomPairwiseSearch
+/*----------------------------------------------------------------------------*/
+bool ContextIfc::getSplitBlocksFullScan ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getSplitBlocksFullScan should be overloaded.");
+}	// ContextIfc::getSplitBlocksFullScan
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setSplitBlocksFullScan (bool)
+{
+	throw TkUtil::Exception ("ContextIfc::setSplitBlocksFullScan should be overloaded.");
+}	// ContextIfc::setSplitBlocksFullScan
+/*----------------------------------------------------------------------------*/
+bool ContextIfc::getMeshQualityPerCell ( ) const
+{
+	throw TkUtil::Exception ("ContextIfc::getMeshQualityPerCell should be overloaded.");
+}	// ContextIfc::getMeshQualityPerCell
+/*----------------------------------------------------------------------------*/
+void ContextIfc::setMeshQualityPerCell (bool)
+{
+	throw TkUtil::Exception ("ContextIfc::setMeshQualityPerCell should be overloaded.");
+}	// ContextIfc::setMeshQualityPerCell
+/*----------------------------------------------------------------------------*/
 void ContextIfc::beginImportScript()
 {
     throw TkUtil::Exception ("ContextIfc::beginImportScript should be overloaded.");
@@ -472,6 +572,16 @@ void ContextIfc::clearSession ()
 	throw TkUtil::Exception ("ContextIfc::clearSession.");
 }	// ContextIfc::clearSession
 /*----------------------------------------------------------------------------*/
+void ContextIfc::saveCheckpoint (std::string, bool)
+{
+	throw TkUtil::Exception ("ContextIfc::saveCheckpoint should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
+Internal::M3DCommandResultIfc* ContextIfc::restoreCheckpoint (std::string)
+{
+	throw TkUtil::Exception ("ContextIfc::restoreCheckpoint should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
 const std::vector<Utils::Entity*> ContextIfc::getAllVisibleEntities ()
 {
 	throw TkUtil::Exception ("ContextIfc::getAllVisibleEntities.");
@@ -206,10 +206,12 @@ void ImportMDL2Commandes::performTopo()
             if (mcdv == 0){
                 if (mcd.type==MdlCutPreCut){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = &mcd;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
+                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    }
                 }
             }
             else { // cas avec un voisin connu
@@ -240,10 +242,12 @@ void ImportMDL2Commandes::performTopo()
                         // nonConforme = true;
                     }
                     else if (ratio > 1) {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                                <<" est détecté comme étant semi-conforme";
-                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+							TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                            message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                    <<" est détecté comme étant semi-conforme";
+                            m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        }
                     }
                     // sinon c'est conforme
 
@@ -432,9 +436,11 @@ Geom::Vertex* ImportMDL2Commandes::getVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     return vtx;
 }
@@ -529,17 +535,19 @@ Geom::Curve* ImportMDL2Commandes::getCurve(const std::string name)
     }
 
 #ifdef _DEBUG
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getCurve("<<name<< ") retourne la Curve "<<crv->getName();
-    std::vector<Geom::Vertex*> vertices;
-    crv->get(vertices);
-    message<<", composée des sommets:";
-    for (uint i=0; i<vertices.size(); i++)
-        message<<" "<<vertices[i]->getName();
-    message<<"\n";
-    for (uint i=0; i<vertices.size(); i++)
-        message<<"   "<<vertices[i]->getName()<<" : "<<*vertices[i]<<"\n";
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getCurve("<<name<< ") retourne la Curve "<<crv->getName();
+        std::vector<Geom::Vertex*> vertices;
+        crv->get(vertices);
+        message<<", composée des sommets:";
+        for (uint i=0; i<vertices.size(); i++)
+            message<<" "<<vertices[i]->getName();
+        message<<"\n";
+        for (uint i=0; i<vertices.size(); i++)
+            message<<"   "<<vertices[i]->getName()<<" : "<<*vertices[i]<<"\n";
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 #endif
 
     return crv;
@@ -564,9 +572,11 @@ Topo::Vertex* ImportMDL2Commandes::getTopoVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     return vtx;
 }
@@ -306,10 +306,12 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
             if (mcdv == 0){
                 if (mcd.type==MdlCutPreCut){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = &mcd;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
+                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    }
                 }
             }
             else { // cas avec un voisin connu
@@ -340,10 +342,12 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
                         // nonConforme = true;
                     }
                     else if (ratio > 1) {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                                <<" est détecté comme étant semi-conforme";
-                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+							TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                            message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                    <<" est détecté comme étant semi-conforme";
+                            m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        }
                     }
                     // sinon c'est conforme
 
@@ -351,10 +355,12 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
 
                 if (nonConforme){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = 0;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est détecté comme étant non-conforme";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                <<" est détecté comme étant non-conforme";
+                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    }
                 }
 
             } // end cas avec un voisin connu
@@ -584,9 +590,11 @@ Geom::Vertex* ImportMDLImplementation::getVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     return vtx;
 }
@@ -753,17 +761,19 @@ Geom::Curve* ImportMDLImplementation::getCurve(const std::string name)
     }
 
 #ifdef _DEBUG
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getCurve("<<name<< ") retourne la Curve "<<crv->getName();
-    std::vector<Geom::Vertex*> vertices;
-    crv->get(vertices);
-    message<<", composée des sommets:";
-    for (uint i=0; i<vertices.size(); i++)
-        message<<" "<<vertices[i]->getName();
-    message<<"\n";
-    for (uint i=0; i<vertices.size(); i++)
-        message<<"   "<<vertices[i]->getName()<<" : "<<*vertices[i]<<"\n";
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_3)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getCurve("<<name<< ") retourne la Curve "<<crv->getName();
+        std::vector<Geom::Vertex*> vertices;
+        crv->get(vertices);
+        message<<", composée des sommets:";
+        for (uint i=0; i<vertices.size(); i++)
+            message<<" "<<vertices[i]->getName();
+        message<<"\n";
+        for (uint i=0; i<vertices.size(); i++)
+            message<<"   "<<vertices[i]->getName()<<" : "<<*vertices[i]<<"\n";
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 #endif
 
     return crv;
@@ -782,9 +792,13 @@ Topo::Vertex* ImportMDLImplementation::getTopoVertex(uint ptId)
         vtx->setGeomAssociation(gtx);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    // appelé pour chaque sommet de chaque zone, le message n'est construit
+    // que si ce niveau de trace est affiché
+    if (m_context.isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
+        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     return vtx;
 }
@@ -20,11 +20,27 @@
 #include <SysCoord/SysCoord.h>
 #include "Structured/StructuredMeshEntity.h"
 
+#include <algorithm>
+
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Internal {
 
+/*----------------------------------------------------------------------------*/
+/// comparaison suivant l'unique id de deux indices d'une table d'entités topologiques
+class TopoIndexComparator {
+public:
+	TopoIndexComparator(const InfoCommand::TopoInfoMap& entities)
+	: m_entities(entities)
+	{ }
+	bool operator()(size_t i1, size_t i2) const
+	{
+		return m_entities.at(i1).first->getUniqueId() < m_entities.at(i2).first->getUniqueId();
+	}
+private:
+	const InfoCommand::TopoInfoMap& m_entities;
+};
 /*----------------------------------------------------------------------------*/
 std::string InfoCommand::type2String(const InfoCommand::type &t)
 {
@@ -46,7 +62,7 @@ std::string InfoCommand::type2String(const InfoCommand::type &t)
 }
 /*----------------------------------------------------------------------------*/
 InfoCommand::InfoCommand()
-	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( )
+	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( ), m_sorted_topo_erasures (0)
 {
 #ifdef _DEBUG2
     std::cout<<"InfoCommand::InfoCommand()"<<std::endl;
@@ -59,7 +75,7 @@ InfoCommand::~InfoCommand()
 #ifdef _DEBUG_MEMORY
     if (!m_topo_entities_info.empty()){
         std::cout<<"InfoCommand::~InfoCommand() libère les TopoEntity :"<<std::endl;
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
+        for (TopoInfoMap::iterator iter_tei = m_topo_entities_info.begin();
                 iter_tei != m_topo_entities_info.end(); ++iter_tei){
             Topo::TopoEntity* te = iter_tei->first;
             std::cout<<te->getName()<<", unique id "<<te->getUniqueId()
@@ -73,7 +89,7 @@ InfoCommand::~InfoCommand()
 }
 /*----------------------------------------------------------------------------*/
 InfoCommand::InfoCommand(const InfoCommand&)
-	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( )
+	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( ), m_sorted_topo_erasures (0)
 {
     MGX_FORBIDDEN("InfoCommand::InfoCommand is not allowed.");
 }
@@ -135,7 +151,21 @@ void InfoCommand::addStructuredMeshInfoEntity(Structured::StructuredMeshEntity*
 bool InfoCommand::addTopoInfoEntity(Topo::TopoEntity* entity, type t)
 {
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
-    type old_t = m_topo_entities_info[entity];
+	return _addTopoInfoEntity(entity, t);
+}
+/*----------------------------------------------------------------------------*/
+void InfoCommand::mergeTopoInfoEntities(const TopoInfoMap& entities)
+{
+	TkUtil::AutoMutex	autoMutex (&m_mutex);
+	m_topo_entities_info.reserve(m_topo_entities_info.size()+entities.size());
+	for (TopoInfoMap::const_iterator iter = entities.begin();
+			iter != entities.end(); ++iter)
+		_addTopoInfoEntity(iter->first, iter->second);
+}
+/*----------------------------------------------------------------------------*/
+bool InfoCommand::_addTopoInfoEntity(Topo::TopoEntity* entity, type t)
+{
+    type& old_t = m_topo_entities_info[entity];
 #ifdef _DEBUG2
     std::cout <<"InfoCommand::addTopoInfoEntity("<<entity->getName()
             <<" t = "<<type2String(old_t)<<" => "<<type2String(t)<<")"<<std::endl;
@@ -144,9 +174,9 @@ bool InfoCommand::addTopoInfoEntity(Topo::TopoEntity* entity, type t)
     if (old_t < t){
         // on ne doit rien faire (pas d'affichage) d'une entité temporaire (le temps de faire la commande)
         if (old_t == CREATED && t == DELETED)
-            m_topo_entities_info[entity] = NONE;
+            old_t = NONE;
         else
-            m_topo_entities_info[entity] = t;
+            old_t = t;
 
         if (entity->getType() == Utils::Entity::TopoCoEdge && t == DISPMODIFIED){
         	Topo::CoEdge* coedge = dynamic_cast<Topo::CoEdge*>(entity);
@@ -154,6 +184,10 @@ bool InfoCommand::addTopoInfoEntity(Topo::TopoEntity* entity, type t)
         	coedge->getMeshingProperty()->updateModificationTime();
         }
 
+        // le maillage éventuel de l'entité n'est plus à jour
+        if (t == DISPMODIFIED)
+        	entity->updateModificationStamp();
+
         return true;
     }
     else
@@ -176,21 +210,14 @@ bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
     // ce qui arrive avec les sous-volumes d'un même matériau
     if (t == DISPMODIFIED){
         // recherche si l'entité y est déjà
-        std::vector <MeshEntityInfo>::iterator iter_found;
-        bool found = false;
-        for (std::vector <MeshEntityInfo>::iterator iter = m_mesh_entities_info.begin();
-                iter != m_mesh_entities_info.end() && !found;
-                ++iter)
-            if (entity == iter->m_mesh_entity){
-                found = true;
-                iter_found = iter;
-            }
-        if (found){
+        const size_t ind = m_mesh_entities_index.indexOf(entity);
+        if (ind != m_mesh_entities_index.npos()){
+            MeshEntityInfo& found = m_mesh_entities_info[m_mesh_entities_index.at(ind).second];
 #ifdef _DEBUG2
-            std::cout<<" déjà présente et de type "<<type2String(iter_found->m_type)<<std::endl;
+            std::cout<<" déjà présente et de type "<<type2String(found.m_type)<<std::endl;
 #endif
-            if (t > iter_found->m_type){
-            	iter_found->m_type = t;
+            if (t > found.m_type){
+            	found.m_type = t;
             	return true;
             }
             else
@@ -199,6 +226,8 @@ bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
     }
 
     MeshEntityInfo mei = {me,t};
+    // seule la première occurrence est indexée
+    m_mesh_entities_index.insert(std::make_pair(me, m_mesh_entities_info.size()));
     m_mesh_entities_info.push_back(mei);
 
 #ifdef _DEBUG2
@@ -211,14 +240,27 @@ bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
 void InfoCommand::addGroupInfoEntity(Group::GroupEntity* entity, type t)
 {
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
+	_addGroupInfoEntity(entity, t);
+}
+/*----------------------------------------------------------------------------*/
+void InfoCommand::mergeGroupInfoEntities(const GroupInfoMap& entities)
+{
+	TkUtil::AutoMutex	autoMutex (&m_mutex);
+	for (GroupInfoMap::const_iterator iter = entities.begin();
+			iter != entities.end(); ++iter)
+		_addGroupInfoEntity(iter->first, iter->second);
+}
+/*----------------------------------------------------------------------------*/
+void InfoCommand::_addGroupInfoEntity(Group::GroupEntity* entity, type t)
+{
 #ifdef _DEBUG2
     std::cout<<"addGroupInfoEntity("<<entity->getName()<<" (id "<<entity->getUniqueId()<<"),"
             <<type2String(m_group_entities_info[entity])<<" => "<<type2String(t)
             <<")"<<std::endl;
 #endif
-    type old_t = m_group_entities_info[entity];
+    type& old_t = m_group_entities_info[entity];
     if (old_t < t)
-        m_group_entities_info[entity] = t;
+        old_t = t;
 }
 /*----------------------------------------------------------------------------*/
 void InfoCommand::getGeomInfoEntity(uint ind, Geom::GeomEntity* &entity, type &t)
@@ -248,18 +290,34 @@ void InfoCommand::getSysCoordInfoEntity(uint ind, CoordinateSystem::SysCoord* &e
 std::vector<InfoCommand::TopoEntityInfo> InfoCommand::getSortedTopoInfoEntity()
 {
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
-	std::list<TopoEntityInfo> l_tie;
+	const size_t nb = m_topo_entities_info.size();
 
-	for (std::map<Topo::TopoEntity*, InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
-			iter_tei != m_topo_entities_info.end(); ++iter_tei){
-		TopoEntityInfo tei = {iter_tei->first, iter_tei->second};
-		l_tie.push_back(tei);
+	// la table a pu être modifiée depuis l'extérieur : une suppression
+	// (cleanTemporaryEntities ...) déplace le dernier couple
+	if (m_topo_entities_info.erasures() != m_sorted_topo_erasures){
+		m_sorted_topo_index.clear();
+		m_sorted_topo_erasures = m_topo_entities_info.erasures();
 	}
 
-	l_tie.sort(InfoCommand::compareTopoEntityInfo);
+	// tri des seules entités ajoutées depuis le dernier appel
+	const size_t nb_sorted = m_sorted_topo_index.size();
+	if (nb_sorted < nb){
+		TopoIndexComparator comp(m_topo_entities_info);
+		m_sorted_topo_index.reserve(nb);
+		for (size_t i=nb_sorted; i<nb; i++)
+			m_sorted_topo_index.push_back(i);
+		std::sort(m_sorted_topo_index.begin()+nb_sorted, m_sorted_topo_index.end(), comp);
+		std::inplace_merge(m_sorted_topo_index.begin(), m_sorted_topo_index.begin()+nb_sorted,
+				m_sorted_topo_index.end(), comp);
+	}
 
 	std::vector<TopoEntityInfo> res;
-	res.insert(res.end(), l_tie.begin(), l_tie.end());
+	res.reserve(nb);
+	for (size_t i=0; i<nb; i++){
+		const TopoInfoMap::value_type& tei = m_topo_entities_info.at(m_sorted_topo_index[i]);
+		TopoEntityInfo info = {tei.first, tei.second};
+		res.push_back(info);
+	}
 	return res;
 }
 /*----------------------------------------------------------------------------*/
@@ -309,7 +367,7 @@ void InfoCommand::permCreatedDeleted()
         }
     } // end for ( ... iter ...)
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
+    for (TopoInfoMap::iterator iter_tei = m_topo_entities_info.begin();
             iter_tei != m_topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         Internal::InfoCommand::type& t = iter_tei->second;
@@ -364,7 +422,7 @@ void InfoCommand::permCreatedDeleted()
         }
     } // end for ( ... iter ...)
 
-    for (std::map<Group::GroupEntity*, type>::iterator iter_grp = m_group_entities_info.begin();
+    for (GroupInfoMap::iterator iter_grp = m_group_entities_info.begin();
     		iter_grp != m_group_entities_info.end(); ++iter_grp){
     	Group::GroupEntity* grp = iter_grp->first;
     	Internal::InfoCommand::type& t = iter_grp->second;
@@ -438,7 +496,9 @@ void InfoCommand::clear()
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
     m_geom_entities_info.clear();
     m_topo_entities_info.clear();
+    m_sorted_topo_index.clear();
     m_mesh_entities_info.clear();
+    m_mesh_entities_index.clear();
     m_group_entities_info.clear();
     m_sys_coord_entities_info.clear();
 }
@@ -456,8 +516,8 @@ TkUtil::UTF8String & operator << (TkUtil::UTF8String & o, const InfoCommand & ic
           <<"\n";
 
     o<< "InfoCommand TopoEntities: "<<"\n";
-    const std::map<Topo::TopoEntity*, InfoCommand::type> topoIE = ic.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = topoIE.begin();
+    const InfoCommand::TopoInfoMap& topoIE = ic.getTopoInfoEntity();
+    for (InfoCommand::TopoInfoMap::const_iterator iter = topoIE.begin();
             iter != topoIE.end(); ++iter)
         o << "  "<<iter->first->getName()<<" : "
           <<InfoCommand::type2String(iter->second)
@@ -476,8 +536,8 @@ TkUtil::UTF8String & operator << (TkUtil::UTF8String & o, const InfoCommand & ic
           <<"\n";
 
     o<< "InfoCommand GroupEntities: "<<"\n";
-    const std::map<Group::GroupEntity*, InfoCommand::type> groupIE = ic.getGroupInfoEntity();
-    for (std::map<Group::GroupEntity*, InfoCommand::type>::const_iterator iter = groupIE.begin();
+    const InfoCommand::GroupInfoMap& groupIE = ic.getGroupInfoEntity();
+    for (InfoCommand::GroupInfoMap::const_iterator iter = groupIE.begin();
             iter != groupIE.end(); ++iter)
         o << "  "<<iter->first->getName()<<" : "
           <<InfoCommand::type2String(iter->second)
@@ -20,7 +20,7 @@ namespace Internal {
 /*----------------------------------------------------------------------------*/
 InternalEntity::InternalEntity(Internal::Context& ctx,
 		Utils::Property* prop,
-		Utils::DisplayProperties* disp)
+		const Utils::DisplayProperties& disp)
 : Entity(ctx.newUniqueId(), prop, disp, ctx.getLogStream())
 , m_context(ctx)
 {
@@ -383,9 +383,9 @@ std::vector<Topo::Block*> M3DCommandResult::getBlocksObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	InfoCommand::TopoInfoMap tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			iter != tei.end(); ++iter) {
 		if (iter->first->getDim() == 3 && iter->second == InfoCommand::CREATED){
 			Topo::Block* ob = dynamic_cast<Topo::Block*>(iter->first);
@@ -448,9 +448,9 @@ std::vector<Topo::CoFace*> M3DCommandResult::getFacesObj ( )
 	//std::cout<<"M3DCommandResult::getFaces () avec getInfoCommand() :"<<std::endl;
 	//std::cout<<ifc<<std::endl;
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	InfoCommand::TopoInfoMap tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			iter != tei.end(); ++iter) {
 		if (iter->first->getDim() == 2 && iter->second == InfoCommand::CREATED){
 			Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(iter->first);
@@ -510,9 +510,9 @@ std::vector<Topo::CoEdge*> M3DCommandResult::getEdgesObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	InfoCommand::TopoInfoMap tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			iter != tei.end(); ++iter) {
 		if (iter->first->getDim() == 1 && iter->second == InfoCommand::CREATED){
 			Topo::CoEdge* ob = dynamic_cast<Topo::CoEdge*>(iter->first);
@@ -572,9 +572,9 @@ std::vector<Topo::Vertex*> M3DCommandResult::getTopoVerticesObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	InfoCommand::TopoInfoMap tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			iter != tei.end(); ++iter) {
 		if (iter->first->getDim() == 0 && iter->second == InfoCommand::CREATED){
 			Topo::Vertex* ob = dynamic_cast<Topo::Vertex*>(iter->first);
@@ -885,9 +885,9 @@ std::vector<Mgx3D::Group::Group0D*> M3DCommandResult::getGroups0DObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Group::GroupEntity*, Internal::InfoCommand::type>& gei = ifc.getGroupInfoEntity();
+	Internal::InfoCommand::GroupInfoMap& gei = ifc.getGroupInfoEntity();
 
-	for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::const_iterator iter = gei.begin();
+	for (Internal::InfoCommand::GroupInfoMap::const_iterator iter = gei.begin();
 			iter != gei.end(); ++iter) {
 		if (iter->first->getDim() == 0 && iter->second == InfoCommand::CREATED){
 			Group::Group0D* ob = dynamic_cast<Group::Group0D*>(iter->first);
@@ -922,9 +922,9 @@ std::vector<Mgx3D::Group::Group1D*> M3DCommandResult::getGroups1DObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Group::GroupEntity*, Internal::InfoCommand::type>& gei = ifc.getGroupInfoEntity();
+	Internal::InfoCommand::GroupInfoMap& gei = ifc.getGroupInfoEntity();
 
-	for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::const_iterator iter = gei.begin();
+	for (Internal::InfoCommand::GroupInfoMap::const_iterator iter = gei.begin();
 			iter != gei.end(); ++iter) {
 		if (iter->first->getDim() == 1 && iter->second == InfoCommand::CREATED){
 			Group::Group1D* ob = dynamic_cast<Group::Group1D*>(iter->first);
@@ -960,9 +960,9 @@ std::vector<Mgx3D::Group::Group2D*> M3DCommandResult::getGroups2DObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Group::GroupEntity*, Internal::InfoCommand::type>& gei = ifc.getGroupInfoEntity();
+	Internal::InfoCommand::GroupInfoMap& gei = ifc.getGroupInfoEntity();
 
-	for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::const_iterator iter = gei.begin();
+	for (Internal::InfoCommand::GroupInfoMap::const_iterator iter = gei.begin();
 			iter != gei.end(); ++iter) {
 		if (iter->first->getDim() == 2 && iter->second == InfoCommand::CREATED){
 			Group::Group2D* ob = dynamic_cast<Group::Group2D*>(iter->first);
@@ -998,9 +998,9 @@ std::vector<Mgx3D::Group::Group3D*> M3DCommandResult::getGroups3DObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Group::GroupEntity*, Internal::InfoCommand::type>& gei = ifc.getGroupInfoEntity();
+	Internal::InfoCommand::GroupInfoMap& gei = ifc.getGroupInfoEntity();
 
-	for (std::map<Group::GroupEntity*, Internal::InfoCommand::type>::const_iterator iter = gei.begin();
+	for (Internal::InfoCommand::GroupInfoMap::const_iterator iter = gei.begin();
 			iter != gei.end(); ++iter) {
 		if (iter->first->getDim() == 3 && iter->second == InfoCommand::CREATED){
 			Group::Group3D* ob = dynamic_cast<Group::Group3D*>(iter->first);
@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file PythonJournal.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Internal/PythonJournal.h"
+#include "Internal/PythonWriter.h"
+
+#include <TkUtil/Exception.h>
+#include <TkUtil/InformationLog.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+/** Les journaux existants, pour les vider en cas d'arrêt brutal. Tableau de
+ * taille fixe consulté sans verrou par le traitement des signaux, un journal
+ * créé alors qu'il est plein n'est pas vidé en cas d'arrêt brutal. */
+static const size_t					journalsCount	= 8;
+static std::atomic<PythonJournal*>	journals [journalsCount];
+/** Protège l'installation des traitements des signaux. */
+static std::mutex					journalsMutex;
+
+/** Les signaux interceptés et les traitements précédemment installés. */
+static const int	crashSignals [ ]	= {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGTERM};
+static const size_t	crashSignalsCount	= sizeof (crashSignals) / sizeof (int);
+static void			(*previousHandlers [crashSignalsCount])(int);
+static bool			crashHandlersInstalled	= false;
+/*----------------------------------------------------------------------------*/
+PythonJournal::
+PythonJournal (PythonWriter& writer, const TkUtil::UTF8String& fileName,
+        const TkUtil::Charset& charset, size_t capacity,
+        size_t flushCount, unsigned long flushDelay)
+: m_writer(writer), m_utf8(TkUtil::Charset::UTF_8 == charset.charset ( ))
+, m_fd(::open(fileName.utf8 ( ).c_str ( ), O_WRONLY | O_APPEND | O_CLOEXEC))
+, m_lines(0 == capacity ? 1 : capacity), m_head(0), m_tail(0)
+, m_flush_count(0 == flushCount ? 1 : flushCount), m_flush_delay(flushDelay)
+, m_stop(false)
+{
+    {
+        std::lock_guard<std::mutex> lock(journalsMutex);
+        for (size_t i=0; i<journalsCount; i++){
+            PythonJournal* empty = 0;
+            if (journals[i].compare_exchange_strong(empty, this))
+                break;
+        }
+        if (false == crashHandlersInstalled){
+            for (size_t i=0; i<crashSignalsCount; i++){
+                previousHandlers[i] = signal(crashSignals[i], crashHandler);
+                if (SIG_ERR == previousHandlers[i])
+                    previousHandlers[i] = SIG_DFL;
+            }
+            crashHandlersInstalled = true;
+        }
+    }
+
+    m_thread = std::thread(&PythonJournal::run, this);
+}
+/*----------------------------------------------------------------------------*/
+PythonJournal::
+~PythonJournal ( )
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+
+    sync();
+
+    for (size_t i=0; i<journalsCount; i++){
+        PythonJournal* self = this;
+        if (journals[i].compare_exchange_strong(self, 0))
+            break;
+    }
+    if (-1 != m_fd)
+        ::close(m_fd);
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+addComment(const TkUtil::UTF8String& cmt)
+{
+    push(true, cmt);
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+addCommand(const TkUtil::UTF8String& cmd)
+{
+    push(false, cmd);
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+push(bool comment, const TkUtil::UTF8String& text)
+{
+    const size_t head = m_head.load(std::memory_order_relaxed);
+
+    // tampon plein : on écrit nous même plutôt que d'attendre le thread dédié
+    if (head - m_tail.load(std::memory_order_acquire) >= m_lines.size())
+        sync();
+
+    // mise en forme dès le dépôt : le traitement des signaux n'a plus qu'à
+    // écrire ces octets
+    Line& line = m_lines[head % m_lines.size()];
+    line.m_comment = comment;
+    line.m_text = text;
+    const TkUtil::UTF8String formatted = comment ?
+            m_writer.formatComment(TkUtil::InformationLog(text)) : text;
+    line.m_bytes = m_utf8 ? formatted.utf8 ( ) : formatted.iso ( );
+    line.m_bytes += '\n';
+    m_head.store(head+1, std::memory_order_release);
+
+    if (head+1 - m_tail.load(std::memory_order_relaxed) >= m_flush_count)
+        m_wake.notify_one();
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+sync ( )
+{
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    drain();
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+drain ( )
+{
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    const size_t head = m_head.load(std::memory_order_acquire);
+
+    for (; tail != head; tail++){
+        Line& line = m_lines[tail % m_lines.size()];
+        if (line.m_comment)
+            m_writer.addComment(line.m_text);
+        else
+            m_writer.addCommand(line.m_text);
+    }
+
+    // les emplacements ne sont rendus au producteur qu'une fois écrits
+    m_tail.store(tail, std::memory_order_release);
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+run ( )
+{
+    // Attention, on est dans un autre thread que le thread principal, toute
+    // exception levée ici serait fatale ...
+    std::unique_lock<std::mutex> lock(m_wake_mutex);
+    while (false == m_stop){
+        m_wake.wait_for(lock, std::chrono::milliseconds(m_flush_delay));
+        lock.unlock();
+        try {
+            sync();
+        }
+        catch (const TkUtil::Exception& exc){
+            std::cerr << "PythonJournal : erreur lors de l'écriture du script : "
+                      << exc.getFullMessage() << std::endl;
+        }
+        catch (...){
+            std::cerr << "PythonJournal : erreur non documentée lors de l'écriture du script."
+                      << std::endl;
+        }
+        lock.lock();
+    }
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+writePending ( ) const
+{
+    if (-1 == m_fd)
+        return;
+
+    // seuls des appels async-signal-safe ici : pas de verrou ni d'allocation,
+    // les emplacements de [tail, head) ne sont pas modifiés par le producteur
+    const size_t head = m_head.load(std::memory_order_acquire);
+    for (size_t tail = m_tail.load(std::memory_order_acquire); tail != head; tail++){
+        const std::string& bytes = m_lines[tail % m_lines.size()].m_bytes;
+        const char* data = bytes.data ( );
+        size_t size = bytes.size ( );
+        while (0 != size){
+            const ssize_t written = ::write(m_fd, data, size);
+            if (-1 == written){
+                if (EINTR == errno)
+                    continue;
+                return;
+            }
+            data += written;
+            size -= written;
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void PythonJournal::
+crashHandler (int sig)
+{
+    const int savedErrno = errno;
+    for (size_t i=0; i<journalsCount; i++){
+        const PythonJournal* journal = journals[i].load(std::memory_order_acquire);
+        if (0 != journal)
+            journal->writePending();
+    }
+    errno = savedErrno;
+
+    // on redonne la main au traitement précédent (éventuellement celui par défaut)
+    for (size_t i=0; i<crashSignalsCount; i++)
+        if (crashSignals[i] == sig){
+            signal(sig, previousHandlers[i]);
+            break;
+        }
+    raise(sig);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
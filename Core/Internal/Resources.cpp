@@ -70,6 +70,7 @@ _logDate ("date", false, "Faut-il faire figurer la date dans les traces (true/fa
 _logTime ("time", false, "Faut-il faire figurer l'heure dans les traces (true/false) ?"),
 _logThreadID ("threadID", false, "Faut-il faire figurer l'identifiant du thread dans les traces (true/false) ?"),
 _useDisplayList ("useDisplayList", true, "True si les display lists Open GL sont utilisées, false dans le cas contraire."),
+_batchedRendering ("batchedRendering", false, "True si les entités topologiques et géométriques sont affichées par lots (un acteur par type d'entité), false si chaque entité a ses propres acteurs."),
 _xyzCancelRoll ("xyzCancelRoll", false, "Une opération de positionnement de la vue dans un plan xOy, xOz, yOz (touches z, y ou x) doit elle être suivie d'une annulation du roulis (true) ou non (false) ?"),
 _updateRefreshRate ("updateRefreshRate", 100, "Fréquence de rafraîchissement de la fenêtre graphique lors d'opérations ajouts/suppressions/modifications d'entités (1 rafraîchissement sur n opérations)."),
 _stillFrameRate ("stillFrameRate", 0.0001, "Nombre d'images/seconde souhaité hors interactions."),	// Défaut VTK 5.10
@@ -97,7 +98,9 @@ _meshDestroyOnHide ("destroyOnHide", true, "True si la représentation graphique
 _organisation ("CEA.DAM.DSSI"),
 _softwareName ("Magix3D"),
 
-_scripts ( )
+_scripts ( ),
+_checkPanelsItems (false),
+_pythonJournalSync (false)
 	
 {
 	Resources::_instance	= this;
@@ -156,6 +159,7 @@ _logDate ("date", false, "Faut-il faire figurer la date dans les traces (true/fa
 _logTime ("time", false, "Faut-il faire figurer l'heure dans les traces (true/false) ?"),
 _logThreadID ("threadID", false, "Faut-il faire figurer l'identifiant du thread dans les traces (true/false) ?"),
 _useDisplayList ("useDisplayList", true, "True si les display lists Open GL sont utilisées, false dans le cas contraire."),
+_batchedRendering ("batchedRendering", false, "True si les entités topologiques et géométriques sont affichées par lots (un acteur par type d'entité), false si chaque entité a ses propres acteurs."),
 _xyzCancelRoll ("xyzCancelRoll", false, "Une opération de positionnement de la vue dans un plan xOy, xOz, yOz (touches z, y ou x) doit elle être suivie d'une annulation du roulis (true) ou non (false) ?"),
 _updateRefreshRate ("updateRefreshRate", 100, "Fréquence de rafraîchissement de la fenêtre graphique lors d'opérations ajouts/suppressions/modifications d'entités (1 rafraîchissement sur n opérations)."),
 _stillFrameRate ("stillFrameRate", 0.0001, "Nombre d'images/seconde souhaité hors interactions."),	// Défaut VTK 5.10
@@ -183,7 +187,9 @@ _meshDestroyOnHide ("destroyOnHide", true, "True si la représentation graphique
 _organisation ("CEA.DAM.DSSI"),
 _softwareName ("Magix3D"),
 
-_scripts ( )
+_scripts ( ),
+_checkPanelsItems (false),
+_pythonJournalSync (false)
 {
 	MGX_FORBIDDEN ("Resources copy constructor is not allowed.");
 }	// Resources::Resources (const Resources&)
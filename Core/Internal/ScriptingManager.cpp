@@ -10,6 +10,7 @@
 #include "Internal/Context.h"
 #include "Internal/ScriptingManager.h"
 #include "Internal/PythonWriter.h"
+#include "Internal/PythonJournal.h"
 #include "Utils/Common.h"
 
 #include "TkUtil/Exception.h"
@@ -25,7 +26,7 @@ namespace Internal {
 /*----------------------------------------------------------------------------*/
 ScriptingManager::
 ScriptingManager (Internal::Context* c)
-: m_python_writer(0), m_context(c), m_charset (TkUtil::Charset (TkUtil::Charset::UTF_8))
+: m_python_writer(0), m_python_journal(0), m_context(c), m_charset (TkUtil::Charset (TkUtil::Charset::UTF_8))
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -40,7 +41,7 @@ void ScriptingManager::setCharset (const TkUtil::Charset& charset)
 }
 /*----------------------------------------------------------------------------*/
 void ScriptingManager::
-initPython(const TkUtil::UTF8String& fileName, bool withHeader)
+initPython(const TkUtil::UTF8String& fileName, bool withHeader, bool asynchronous)
 {
     if (m_python_writer)
         throw TkUtil::Exception(TkUtil::UTF8String("ScriptingManager::initPython déjà effectué", TkUtil::Charset::UTF_8));
@@ -113,11 +114,15 @@ initPython(const TkUtil::UTF8String& fileName, bool withHeader)
 			std::cerr <<"MGX3D_PATH n'est pas définit\n";
 		}
 	} // end if (withHeader)
+
+	// l'en-tête est écrit directement, les commandes passent par le journal
+	if (asynchronous)
+		m_python_journal = new Internal::PythonJournal(*m_python_writer, fileName, m_charset);
 }
 /*----------------------------------------------------------------------------*/
 ScriptingManager::
 ScriptingManager (const ScriptingManager&)
-	: m_python_writer (0), m_context (0), m_charset (TkUtil::Charset::UNKNOWN)
+	: m_python_writer (0), m_python_journal (0), m_context (0), m_charset (TkUtil::Charset::UNKNOWN)
 {
     MGX_FORBIDDEN("ScriptingManager: constructeur par copie interdit");
 }
@@ -132,6 +137,10 @@ operator = (const ScriptingManager&)
 ScriptingManager::
 ~ScriptingManager ( )
 {
+    // arrêt du thread d'écriture et vidage du journal avant la fermeture du fichier
+    delete m_python_journal;
+    m_python_journal = 0;
+
     if (m_python_writer){
     //    m_python_writer->closeTryBlock();
      delete m_python_writer;
@@ -146,13 +155,24 @@ void ScriptingManager::setContext (Internal::Context* context)
 PythonWriter* ScriptingManager::
 getPythonWriter ( )
 {
+	// l'écrivain peut être utilisé directement, ce qui est en attente doit le précéder
+	sync ( );
 	return m_python_writer;
 }	// ScriptingManager::getPythonWriter
 /*----------------------------------------------------------------------------*/
 void ScriptingManager::
+sync ( )
+{
+    if (m_python_journal)
+        m_python_journal->sync();
+}
+/*----------------------------------------------------------------------------*/
+void ScriptingManager::
 addComment(const TkUtil::UTF8String& cmt)
 {
-    if (m_python_writer)
+    if (m_python_journal)
+        m_python_journal->addComment(cmt);
+    else if (m_python_writer)
         m_python_writer->addComment(cmt);
 }
 /*----------------------------------------------------------------------------*/
@@ -164,9 +184,15 @@ addCommand(const TkUtil::UTF8String& cmd)
         if (cmd != cmd2){
             TkUtil::UTF8String cmd3 (TkUtil::Charset::UTF_8);
             cmd3 << "# Commande tappée: " <<cmd;
-            m_python_writer->addCommand(cmd3);
+            if (m_python_journal)
+                m_python_journal->addCommand(cmd3);
+            else
+                m_python_writer->addCommand(cmd3);
         }
-        m_python_writer->addCommand(cmd2);
+        if (m_python_journal)
+            m_python_journal->addCommand(cmd2);
+        else
+            m_python_writer->addCommand(cmd2);
     }
 }
 /*----------------------------------------------------------------------------*/
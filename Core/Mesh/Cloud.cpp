@@ -14,6 +14,7 @@
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
+#include "Utils/MarkVector.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Internal/InfoCommand.h"
 
@@ -31,7 +32,7 @@ namespace Mesh {
 /*----------------------------------------------------------------------------*/
 const char* Cloud::typeNameMeshCloud = "MeshCloud";
 /*----------------------------------------------------------------------------*/
-Cloud::Cloud(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp)
+Cloud::Cloud(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp)
 : MeshEntity(ctx, prop, disp)
 , m_topo_property(new Topo::MeshCloudTopoProperty())
 , m_save_topo_property(0)
@@ -214,14 +215,15 @@ void Cloud::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
     gmds::IGMesh& gmdsMesh = meshImpl->getGMDSMesh();
 
     // ajout d'un filtre pour éviter de mettre 2 fois (ou plus) un même noeud
-    std::map<gmds::TCellID, uint> filtre;
+    Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+    Utils::MarkVector& filtre = filtre_lease.marks ( );
 
     for(unsigned int iVertex=0; iVertex<vertices.size(); iVertex++) {
         gmds::TCellID node  = vertices[iVertex]->getNode();
 
-        if (filtre[node] == 0){
+        if (!filtre.isMarked(node)){
         	ANodes.push_back(gmdsMesh.get<gmds::Node>(node));
-        	filtre[node] = 1;
+        	filtre.set(node, 1);
         }
     }
 
@@ -229,9 +231,9 @@ void Cloud::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
         std::vector<gmds::TCellID> nodes  = coEdges[iCoEdge]->nodes();
 
         for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-            if (filtre[nodes[iNode]] == 0){
+            if (!filtre.isMarked(nodes[iNode])){
                 ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-                filtre[nodes[iNode]] = 1;
+                filtre.set(nodes[iNode], 1);
             }
         }
     }
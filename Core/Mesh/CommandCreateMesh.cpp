@@ -13,6 +13,7 @@
 #include "Mesh/MeshManager.h"
 #include "Mesh/MeshModificationItf.h"
 #include "Mesh/MeshImplementation.h"
+#include "Mesh/FaceTriangulation.h"
 #include "Mesh/MeshModificationByPythonFunction.h"
 #include "Mesh/MeshModificationBySepa.h"
 #include "Mesh/MeshModificationByProjectionOnP0.h"
@@ -21,6 +22,7 @@
 #include "Smoothing/VolumicSmoothing.h"
 
 #include "Utils/Command.h"
+#include "Utils/MarkVector.h"
 #include "Internal/Context.h"
 #include "Internal/InfoCommand.h"
 #include "Group/Group2D.h"
@@ -375,6 +377,28 @@ CommandCreateMesh::~CommandCreateMesh()
 {
     deleteInternalsStats();
     deleteCreatedMeshGroups();
+
+    for (std::map<Topo::CoFace*, FaceTriangulation*>::iterator iter = m_face_triangulations.begin();
+            iter != m_face_triangulations.end(); ++iter)
+        delete iter->second;
+}
+/*----------------------------------------------------------------------------*/
+void CommandCreateMesh::setFaceTriangulation(Topo::CoFace* face, FaceTriangulation* triangulation)
+{
+    FaceTriangulation*& stored = m_face_triangulations[face];
+    if (stored != triangulation)
+        delete stored;
+    stored = triangulation;
+}
+/*----------------------------------------------------------------------------*/
+FaceTriangulation* CommandCreateMesh::takeFaceTriangulation(Topo::CoFace* face)
+{
+    std::map<Topo::CoFace*, FaceTriangulation*>::iterator iter = m_face_triangulations.find(face);
+    if (iter == m_face_triangulations.end())
+        return 0;
+    FaceTriangulation* triangulation = iter->second;
+    m_face_triangulations.erase(iter);
+    return triangulation;
 }
 /*----------------------------------------------------------------------------*/
 MeshManager& CommandCreateMesh::getMeshManager()
@@ -544,6 +568,21 @@ void CommandCreateMesh::preMesh(const std::vector<Topo::CoFace*>& faces)
 		waitTasksExecution ( );
 		evaluateTasksCompletion ( );
 		clearTasks ( );
+
+		// les faces maillées par GMSH sont triangulées dans des processus
+		// mgx3dGmshWorker (état global GMSH), l'ajout à gmds est fait lors
+		// du maillage des faces
+		std::vector<Topo::CoFace*>	delaunayFaces;
+		for (std::vector<Topo::CoFace*>::const_iterator it = faces.begin ( );
+		     faces.end ( ) != it; it++)
+			if (((*it)->getMeshLaw ( ) == Topo::CoFaceMeshingProperty::delaunayGMSH)
+			    && (false == (*it)->isMeshed ( )))
+				delaunayFaces.push_back (*it);
+		MeshImplementation*	meshImpl	=
+			dynamic_cast<MeshImplementation*> (getContext ( ).getMeshManager ( ).getMesh ( ));
+		if ((Command::CANCELED != getStatus ( )) && (0 != meshImpl)
+		    && (1 < delaunayFaces.size ( )))
+			meshImpl->triangulateDelaunayGMSH (this, delaunayFaces);
 	
 #ifdef _DEBUG_THREAD
 		std::cout << "CommandCreateMesh::preMesh. Achèvement avec succès du pré-maillage des faces dans des threads." << std::endl;
@@ -882,8 +921,8 @@ saveInternalsStats()
 {
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         te->saveInternals(this);
@@ -901,9 +940,10 @@ void CommandCreateMesh::
 cancelInternalsStats()
 {
     saveInternalsStats();
+    // avant la permutation, les blocs ont encore leur nouveau maillage
+    deleteCreatedMeshEntities();
     permInternalsStats();
     deleteInternalsStats();
-    deleteCreatedMeshEntities();
     deleteCreatedMeshGroups();
 
     getInfoCommand().clear();
@@ -938,10 +978,15 @@ deleteCreatedMeshEntities()
     if (m_strategy == MeshManager::MODIFIABLE){
 
         // si tous les noeuds sont à détruire, autant vider le maillage
-        if (m_created_nodes.size() == getMeshManager().getMesh()->getNbNodes()){
+        if (m_created_nodes.size() == getMeshManager().getMesh()->getGMDSMesh().getNbNodes()){
             getMeshManager().getMesh()->deleteMesh();
         }
         else {
+            // les noeuds intérieurs et polyèdres des blocs créés à la demande depuis
+            for (std::vector <BlockPropertyInfo>::iterator iter = m_block_property_info.begin();
+                    iter != m_block_property_info.end(); ++iter)
+                getMeshManager().getMesh()->deleteStructuredMesh((*iter).m_entity);
+
             // destruction de ce qui a été créé
             getMeshManager().getMesh()->undoCreatedMesh(this);
         }
@@ -1008,7 +1053,7 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 	// filtre sur les noeuds gmds pour les perturbations:
 	// 0 pour les nouveaux,
 	// 1 pour les anciens (ceux créés avant cette commande)
-	std::map<gmds::TCellID, uint> filtre_nodes_pert;
+	Utils::MarkVector filtre_nodes_pert;
 
 	for (std::list<Topo::CoFace*>::iterator iter1 = list_cofaces.begin();
 			iter1 != list_cofaces.end(); ++iter1){
@@ -1046,16 +1091,19 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 #endif
 
 	gmds::IGMesh& gmds_mesh = getMeshManager().getMesh()->getGMDSMesh();
+	MeshImplementation* meshImpl = dynamic_cast<MeshImplementation*> (getMeshManager().getMesh());
+	CHECK_NULL_PTR_ERROR(meshImpl);
 	// les noeuds déjà dans gmds
 	std::vector<gmds::Node> nodes;
 
 	// on marque les noeuds déjà présents
 	//std::cout<<"Nb Nodes : "<<gmds_mesh.getNbNodes()<<std::endl;
+	filtre_nodes_pert.resize(gmds_mesh.getNbNodes());
 	gmds::IGMesh::node_iterator iter1 = gmds_mesh.nodes_begin();
 
 	for (;!iter1.isDone();iter1.next()){
 		//std::cout<<"Node "<<iter1.value().getID()<<" fixé "<<std::endl;
-		filtre_nodes_pert[iter1.value().getID()] = 1;
+		filtre_nodes_pert.set(iter1.value().getID(), 1);
 	}
 
 	// application de la modif pour chacun des groupes 2D
@@ -1207,7 +1255,8 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 					// filtre sur les noeuds gmds pour les lissages:
 					// 1 pour les nouveaux,
 					// 2 pour les noeuds au bord d'une surface de maillage
-					std::map<gmds::TCellID, uint> filtre_nodes_lisse;
+					Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+					Utils::MarkVector& filtre_nodes_lisse = filtre_lease.marks ( );
 
 					for (std::vector<Topo::CoFace*>::iterator iter3 = meshed_cofaces.begin();
 							iter3 != meshed_cofaces.end(); ++iter3){
@@ -1223,8 +1272,8 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 
 						for (std::vector<gmds::TCellID>::iterator iter4 = l_nds.begin();
 								iter4 != l_nds.end(); ++iter4)
-							if (filtre_nodes_lisse[*iter4] == 0){
-								filtre_nodes_lisse[*iter4] = 1;
+							if (!filtre_nodes_lisse.isMarked(*iter4)){
+								filtre_nodes_lisse.set(*iter4, 1);
 								nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
 						}
 					}
@@ -1239,25 +1288,25 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 						std::vector<gmds::TCellID>& nodes = (*iter3)->nodes();
 						for (std::vector<gmds::TCellID>::iterator iter4 = nodes.begin();
 								iter4 != nodes.end(); ++iter4)
-							filtre_nodes_lisse[*iter4] = 2;
+							filtre_nodes_lisse.set(*iter4, 2);
 					} // end for iter3
 #ifdef _DEBUG2
 					{
 						// stats sur le nombre de noeuds à 1 et ceux à 2
 						uint mq1 = 0;
 						uint mq2 = 0;
-						for (std::map<gmds::TCellID, uint>::iterator iter=filtre_nodes_lisse.begin();
-								iter!=filtre_nodes_lisse.end(); ++iter)
-							if (iter->second == 1)
+						for (uint i=0; i<nodes.size(); i++)
+							if (filtre_nodes_lisse[nodes[i].getID()] == 1)
 								mq1++;
-							else if (iter->second == 2)
+							else if (filtre_nodes_lisse[nodes[i].getID()] == 2)
 								mq2++;
 						std::cout<<"CommandCreateMesh::meshAndModify, filtre_nodes_lisse avec "<<mq1<<" noeuds à bouger et "<<mq2<<" figés"<<std::endl;
 
 					}
 #endif
 					// applique le lissage uniquement aux noeuds internes à la surface (non marqués à 2)
-					lissageSurf->applyModification(nodes, polygones, filtre_nodes_lisse, isPolyInverted, 2, surface);
+					lissageSurf->applyModification(nodes, polygones, filtre_nodes_lisse, isPolyInverted, 2, surface,
+							getContext().allowThreadedCommandTasks.getValue());
 
 				} // end for iter2
 
@@ -1316,6 +1365,8 @@ modify(std::vector<Topo::Block*>& list_blocks)
 #endif
 
 	gmds::IGMesh& gmds_mesh = getMeshManager().getMesh()->getGMDSMesh();
+	MeshImplementation* meshImpl = dynamic_cast<MeshImplementation*> (getMeshManager().getMesh());
+	CHECK_NULL_PTR_ERROR(meshImpl);
 
 	// application de la modif pour chacun des groupes 3D
 	for (std::list<Group::Group3D*>::iterator iter1 = list_grp.begin();
@@ -1385,7 +1436,8 @@ modify(std::vector<Topo::Block*>& list_blocks)
 					// filtre sur les noeuds gmds pour les lissages:
 					// 1 pour les nouveaux,
 					// 2 pour les noeuds au bord d'un volume de maillage
-					std::map<gmds::TCellID, uint> filtre_nodes_lisse;
+					Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+					Utils::MarkVector& filtre_nodes_lisse = filtre_lease.marks ( );
 
 					for (std::vector<Topo::Block*>::iterator iter3 = meshed_blocks.begin();
 							iter3 != meshed_blocks.end(); ++iter3){
@@ -1400,8 +1452,8 @@ modify(std::vector<Topo::Block*>& list_blocks)
 
 						for (std::vector<gmds::TCellID>::iterator iter4 = l_nds.begin();
 								iter4 != l_nds.end(); ++iter4)
-							if (filtre_nodes_lisse[*iter4] == 0){
-								filtre_nodes_lisse[*iter4] = 1;
+							if (!filtre_nodes_lisse.isMarked(*iter4)){
+								filtre_nodes_lisse.set(*iter4, 1);
 								nodes.push_back(gmds_mesh.get<gmds::Node>(*iter4));
 						}
 					}
@@ -1416,11 +1468,12 @@ modify(std::vector<Topo::Block*>& list_blocks)
 						std::vector<gmds::TCellID>& nodes = (*iter3)->nodes();
 						for (std::vector<gmds::TCellID>::iterator iter4 = nodes.begin();
 								iter4 != nodes.end(); ++iter4)
-							filtre_nodes_lisse[*iter4] = 2;
+							filtre_nodes_lisse.set(*iter4, 2);
 					} // end for iter3
 
 					// applique le lissage uniquement aux noeuds internes au volume (non marqués à 2)
-					lissageVol->applyModification(nodes, polygedres, filtre_nodes_lisse, 2, volume);
+					lissageVol->applyModification(nodes, polygedres, filtre_nodes_lisse, 2, volume,
+							getContext().allowThreadedCommandTasks.getValue());
 
 				} // end for iter2
 
@@ -1430,7 +1483,7 @@ modify(std::vector<Topo::Block*>& list_blocks)
 				// filtre sur les noeuds gmds pour les perturbations:
 				// 0 pour les nouveaux,
 				// 1 pour les anciens (ceux créés avant cette commande)
-				std::map<gmds::TCellID, uint> filtre_nodes_pert;
+				Utils::MarkVector filtre_nodes_pert;
 				// actuellement on bouge tous les noeuds ...
 
 				// récupération des noeuds associés à ce groupe
@@ -97,14 +97,14 @@ internalExecute()
     // on marque les blocs et les faces communes internes aux groupes
     // on met à 1 ce qui est maillé conforme et dans le volume
     // on laisse à 0 le reste
-    std::map<Topo::Block*, uint> filtre_block;
-    std::map<Topo::CoFace*, uint> filtre_coface;
+    Utils::IndexedMap<Topo::Block*, uint> filtre_block;
+    Utils::IndexedMap<Topo::CoFace*, uint> filtre_coface;
 
     selectCoFaceAndBlocks(filtre_coface, filtre_block);
 
 
     // pour ne prendre qu'une fois une arête, on les marque suivant la position de la coupe
-    std::map<Topo::CoEdge*, uint> filtre_coedge;
+    Utils::IndexedMap<Topo::CoEdge*, uint> filtre_coedge;
 
     computePosCoEdge(filtre_coface, filtre_coedge);
 
@@ -154,8 +154,8 @@ deleteOldSubVolumes()
 }
 /*----------------------------------------------------------------------------*/
 void CommandMeshExplorer::
-selectCoFaceAndBlocks(std::map<Topo::CoFace*, uint>& filtre_coface,
-        std::map<Topo::Block*, uint>& filtre_block)
+selectCoFaceAndBlocks(Utils::IndexedMap<Topo::CoFace*, uint>& filtre_coface,
+        Utils::IndexedMap<Topo::Block*, uint>& filtre_block)
 {
     // tous les groupes 3D
     std::vector<Group::Group3D*> grp;
@@ -230,8 +230,8 @@ selectCoFaceAndBlocks(std::map<Topo::CoFace*, uint>& filtre_coface,
 }
 /*----------------------------------------------------------------------------*/
 void CommandMeshExplorer::
-computePosCoEdge(std::map<Topo::CoFace*, uint>& filtre_coface,
-            std::map<Topo::CoEdge*, uint> &filtre_coedge)
+computePosCoEdge(Utils::IndexedMap<Topo::CoFace*, uint>& filtre_coface,
+            Utils::IndexedMap<Topo::CoEdge*, uint> &filtre_coedge)
 {
     // on initialise la recherche avec l'arête de départ
     std::list<Topo::CoEdge*> coedges_reserve;
@@ -370,12 +370,12 @@ computePosCoEdge(std::map<Topo::CoFace*, uint>& filtre_coface,
 }
 /*----------------------------------------------------------------------------*/
 void CommandMeshExplorer::
-computePosBlock(std::map<Topo::Block*, uint>& filtre_block,
-        std::map<Topo::CoEdge*, uint> &filtre_coedge,
+computePosBlock(Utils::IndexedMap<Topo::Block*, uint>& filtre_block,
+        Utils::IndexedMap<Topo::CoEdge*, uint> &filtre_coedge,
         std::vector<BlockDirPos>& bloc_dirPos)
 {
 
-    for (std::map<Topo::Block*, uint>::iterator iter = filtre_block.begin();
+    for (Utils::IndexedMap<Topo::Block*, uint>::iterator iter = filtre_block.begin();
             iter != filtre_block.end(); ++iter){
 
         Topo::Block* bloc = iter->first;
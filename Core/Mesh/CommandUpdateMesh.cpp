@@ -0,0 +1,454 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CommandUpdateMesh.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/CommandUpdateMesh.h"
+#include "Mesh/MeshItf.h"
+#include "Mesh/MeshImplementation.h"
+#include "Mesh/SubVolume.h"
+#include "Mesh/SubSurface.h"
+
+#include "Topo/TopoManager.h"
+#include "Topo/Block.h"
+#include "Topo/Face.h"
+#include "Topo/CoFace.h"
+#include "Topo/Edge.h"
+#include "Topo/CoEdge.h"
+#include "Topo/Vertex.h"
+
+#include "Internal/Context.h"
+#include "Utils/MarkVector.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+#include <TkUtil/TraceLog.h>
+#include <TkUtil/UTF8String.h>
+
+#include <GMDS/IG/IGMesh.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+CommandUpdateMesh::
+CommandUpdateMesh(Internal::Context& c, size_t tasksNum)
+: CommandCreateMesh(c, "Mise à jour du maillage", tasksNum)
+{
+    validate();
+}
+/*----------------------------------------------------------------------------*/
+CommandUpdateMesh::~CommandUpdateMesh()
+{
+}
+/*----------------------------------------------------------------------------*/
+bool CommandUpdateMesh::isMeshOutOfDate(Topo::Vertex* ve)
+{
+	return ve->isMeshed() && ve->isModifiedSinceMeshed();
+}
+/*----------------------------------------------------------------------------*/
+bool CommandUpdateMesh::isMeshOutOfDate(Topo::CoEdge* coedge)
+{
+	if (!coedge->isMeshed())
+		return false;
+	if (coedge->isModifiedSinceMeshed())
+		return true;
+	for (uint i=0; i<coedge->getNbVertices(); i++)
+		if (isMeshOutOfDate(coedge->getVertex(i)))
+			return true;
+	return false;
+}
+/*----------------------------------------------------------------------------*/
+bool CommandUpdateMesh::isMeshOutOfDate(Topo::CoFace* coface)
+{
+	if (!coface->isMeshed())
+		return false;
+	if (coface->isModifiedSinceMeshed())
+		return true;
+	for (uint i=0; i<coface->getNbEdges(); i++){
+		const std::vector<Topo::CoEdge* >& coedges = coface->getEdge(i)->getCoEdges();
+		for (uint j=0; j<coedges.size(); j++)
+			if (isMeshOutOfDate(coedges[j]))
+				return true;
+	}
+	return false;
+}
+/*----------------------------------------------------------------------------*/
+bool CommandUpdateMesh::isMeshOutOfDate(Topo::Block* bloc)
+{
+	if (!bloc->isMeshed())
+		return false;
+	if (bloc->isModifiedSinceMeshed())
+		return true;
+	for (uint i=0; i<bloc->getNbFaces(); i++){
+		const std::vector<Topo::CoFace* >& cofaces = bloc->getFace(i)->getCoFaces();
+		for (uint j=0; j<cofaces.size(); j++)
+			if (isMeshOutOfDate(cofaces[j]))
+				return true;
+	}
+	return false;
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::validate()
+{
+	Topo::TopoManager& tm = getContext().getLocalTopoManager();
+
+	std::vector<Topo::Vertex*> vertices;
+	tm.getVertices(vertices);
+	for (std::vector<Topo::Vertex*>::iterator iter = vertices.begin();
+			iter != vertices.end(); ++iter)
+		if (isMeshOutOfDate(*iter))
+			m_vertices.push_back(*iter);
+
+	std::vector<Topo::CoEdge*> coedges;
+	tm.getCoEdges(coedges);
+	for (std::vector<Topo::CoEdge*>::iterator iter = coedges.begin();
+			iter != coedges.end(); ++iter)
+		if (isMeshOutOfDate(*iter))
+			m_coedges.push_back(*iter);
+
+	std::vector<Topo::CoFace*> cofaces;
+	tm.getCoFaces(cofaces);
+	for (std::vector<Topo::CoFace*>::iterator iter = cofaces.begin();
+			iter != cofaces.end(); ++iter)
+		if (isMeshOutOfDate(*iter))
+			m_cofaces.push_back(*iter);
+
+	std::vector<Topo::Block*> blocks;
+	tm.getBlocks(blocks);
+	for (std::vector<Topo::Block*>::iterator iter = blocks.begin();
+			iter != blocks.end(); ++iter)
+		if (isMeshOutOfDate(*iter))
+			m_blocks.push_back(*iter);
+
+	if (m_vertices.empty() && m_coedges.empty() && m_cofaces.empty() && m_blocks.empty())
+		throw TkUtil::Exception (TkUtil::UTF8String ("Il n'y a pas de maillage à mettre à jour (aucune entité maillée n'a été modifiée)", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::
+internalExecute()
+{
+	setStepNum (7);
+	size_t	step	= 0;
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+    message << "CommandUpdateMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( )
+            << ", avec " << (long)m_blocks.size() << " blocs, "
+            << (long)m_cofaces.size() << " faces, "
+            << (long)m_coedges.size() << " arêtes et "
+            << (long)m_vertices.size() << " sommets à remailler";
+
+    setStepProgression (1.);
+	setStep (++step, "Destruction du maillage des entités modifiées", 0.);
+	// les entités sont retirées des groupes avant que leur maillage ne soit détruit,
+	// elles y seront remises lors du remaillage
+	removeFromMeshGroups();
+	unmesh();
+
+	// même enchainement que pour CommandNewBlocksMesh, limité aux entités modifiées
+	setStepProgression (1.);
+	setStep (++step, "Lissage et perturbation des surfaces", 0.);
+	std::list<Topo::CoFace*> list_cofaces(m_cofaces.begin(), m_cofaces.end());
+	meshAndModify(list_cofaces);
+
+	setStepProgression (1.);
+	setStep (++step, "Maillage des sommets et des arêtes", 0.);
+	for (uint i=0; i<m_vertices.size(); i++)
+		mesh(m_vertices[i]);
+	preMesh(m_coedges);
+	for (uint i=0; i<m_coedges.size(); i++)
+		mesh(m_coedges[i]);
+
+	setStepProgression (1.);
+	setStep (++step, "Maillage des faces", 0.);
+	preMesh(m_cofaces);
+	for (uint i=0; i<m_cofaces.size(); i++){
+		mesh(m_cofaces[i]);
+		setStepProgression((double)(i+1)/(double)m_cofaces.size());
+	}
+
+	setStepProgression (1.);
+	setStep (++step, "Maillage des blocs", 0.);
+	preMesh(m_blocks);
+	for (uint i=0; i<m_blocks.size(); i++){
+		mesh(m_blocks[i]);
+		setStepProgression((double)(i+1)/(double)m_blocks.size());
+	}
+
+	setStepProgression (1.);
+	setStep (++step, "Vérifications", 0.);
+	std::vector<std::string> blockCrossed;
+	for (std::vector<Topo::Block*>::iterator iter=m_blocks.begin(); iter!=m_blocks.end(); ++iter)
+		if ((*iter)->getMeshingData()->isMeshCrossed())
+			blockCrossed.push_back((*iter)->getName());
+	if (!blockCrossed.empty()){
+		m_warning_to_pop_up << (short)blockCrossed.size()
+				<< " bloc(s) semble(nt) avoir des mailles croisées :";
+		for (uint i=0; i<blockCrossed.size(); i++)
+			m_warning_to_pop_up<<" "<<blockCrossed[i];
+	}
+
+	setStepProgression (1.);
+	setStep (++step, "Lissage des blocs", 0.);
+	modify(m_blocks);
+
+	// on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
+	saveInternalsStats();
+
+	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::removeFromMeshGroups()
+{
+	Internal::InfoCommand* icmd = &getInfoCommand();
+
+	std::vector<Volume*> volumes;
+	getMeshManager().getVolumes(volumes);
+	for (std::vector<Volume*>::iterator iter1 = volumes.begin();
+			iter1 != volumes.end(); ++iter1){
+		std::vector<Topo::Block*> blocks;
+		(*iter1)->getBlocks(blocks);
+		for (std::vector<Topo::Block*>::iterator iter2 = blocks.begin();
+				iter2 != blocks.end(); ++iter2)
+			if (isMeshOutOfDate(*iter2)){
+				(*iter1)->saveMeshVolumeTopoProperty(icmd);
+				(*iter1)->removeBlock(*iter2);
+			}
+	}
+
+	std::vector<Surface*> surfaces;
+	getMeshManager().getSurfaces(surfaces);
+	for (std::vector<Surface*>::iterator iter1 = surfaces.begin();
+			iter1 != surfaces.end(); ++iter1){
+		std::vector<Topo::CoFace*> cofaces;
+		(*iter1)->getCoFaces(cofaces);
+		for (std::vector<Topo::CoFace*>::iterator iter2 = cofaces.begin();
+				iter2 != cofaces.end(); ++iter2)
+			if (isMeshOutOfDate(*iter2)){
+				(*iter1)->saveMeshSurfaceTopoProperty(icmd);
+				(*iter1)->removeCoFace(*iter2);
+			}
+	}
+
+	std::vector<Line*> lines;
+	getMeshManager().getLines(lines);
+	for (std::vector<Line*>::iterator iter1 = lines.begin();
+			iter1 != lines.end(); ++iter1){
+		std::vector<Topo::CoEdge*> coedges;
+		(*iter1)->getCoEdges(coedges);
+		for (std::vector<Topo::CoEdge*>::iterator iter2 = coedges.begin();
+				iter2 != coedges.end(); ++iter2)
+			if (isMeshOutOfDate(*iter2)){
+				(*iter1)->saveMeshLineTopoProperty(icmd);
+				(*iter1)->removeCoEdge(*iter2);
+			}
+	}
+
+	std::vector<Cloud*> clouds;
+	getMeshManager().getClouds(clouds);
+	for (std::vector<Cloud*>::iterator iter1 = clouds.begin();
+			iter1 != clouds.end(); ++iter1){
+		std::vector<Topo::CoEdge*> coedges;
+		(*iter1)->getCoEdges(coedges);
+		for (std::vector<Topo::CoEdge*>::iterator iter2 = coedges.begin();
+				iter2 != coedges.end(); ++iter2)
+			if (isMeshOutOfDate(*iter2)){
+				(*iter1)->saveMeshCloudTopoProperty(icmd);
+				(*iter1)->removeCoEdge(*iter2);
+			}
+		std::vector<Topo::Vertex*> vertices;
+		(*iter1)->getVertices(vertices);
+		for (std::vector<Topo::Vertex*>::iterator iter2 = vertices.begin();
+				iter2 != vertices.end(); ++iter2)
+			if (isMeshOutOfDate(*iter2)){
+				(*iter1)->saveMeshCloudTopoProperty(icmd);
+				(*iter1)->removeVertex(*iter2);
+			}
+	}
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::unmesh()
+{
+	gmds::IGMesh& gmds_mesh = getMeshManager().getMesh()->getGMDSMesh();
+	MeshImplementation* meshImpl = dynamic_cast<MeshImplementation*> (getMeshManager().getMesh());
+	CHECK_NULL_PTR_ERROR(meshImpl);
+
+	// les mailles à détruire, pour vérifier qu'aucun sous-volume (ou sous-surface)
+	// construit maille par maille n'en dépend
+	Utils::MarkVectorLease filtre_regions_lease (meshImpl->getMarks ( ));
+	Utils::MarkVector& filtre_regions = filtre_regions_lease.marks ( );
+	// accès direct aux blocs, sans créer les noeuds et mailles d'un maillage conservé sous forme IJK
+	for (uint i=0; i<m_blocks.size(); i++){
+		std::vector<gmds::TCellID>& regions = m_blocks[i]->getMeshingData()->regions();
+		for (uint j=0; j<regions.size(); j++)
+			filtre_regions.set(regions[j], 1);
+	}
+	Utils::MarkVectorLease filtre_faces_lease (meshImpl->getMarks ( ));
+	Utils::MarkVector& filtre_faces = filtre_faces_lease.marks ( );
+	for (uint i=0; i<m_cofaces.size(); i++){
+		std::vector<gmds::TCellID>& faces = m_cofaces[i]->faces();
+		for (uint j=0; j<faces.size(); j++)
+			filtre_faces.set(faces[j], 1);
+	}
+
+	std::vector<Volume*> volumes;
+	getMeshManager().getVolumes(volumes);
+	for (std::vector<Volume*>::iterator iter = volumes.begin(); iter != volumes.end(); ++iter){
+		SubVolume* sv = dynamic_cast<SubVolume*>(*iter);
+		if (0 == sv)
+			continue;
+		std::vector<gmds::Region> regions;
+		sv->getGMDSRegions(regions);
+		for (uint j=0; j<regions.size(); j++)
+			if (filtre_regions.isMarked(regions[j].getID())){
+				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+				message << "Mise à jour du maillage impossible, le sous-volume "<<sv->getName()
+						<<" contient des mailles de blocs modifiés";
+				throw TkUtil::Exception (message);
+			}
+	}
+	std::vector<Surface*> surfaces;
+	getMeshManager().getSurfaces(surfaces);
+	for (std::vector<Surface*>::iterator iter = surfaces.begin(); iter != surfaces.end(); ++iter){
+		SubSurface* ss = dynamic_cast<SubSurface*>(*iter);
+		if (0 == ss)
+			continue;
+		std::vector<gmds::Face> faces;
+		ss->getGMDSFaces(faces);
+		for (uint j=0; j<faces.size(); j++)
+			if (filtre_faces.isMarked(faces[j].getID())){
+				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+				message << "Mise à jour du maillage impossible, la sous-surface "<<ss->getName()
+						<<" contient des mailles de faces modifiées";
+				throw TkUtil::Exception (message);
+			}
+	}
+
+	// filtre sur les noeuds gmds :
+	// 1 pour ceux à détruire,
+	// 2 pour ceux des entités conservées au bord des entités à remailler
+	Utils::MarkVectorLease filtre_nodes_lease (meshImpl->getMarks ( ));
+	Utils::MarkVector& filtre_nodes = filtre_nodes_lease.marks ( );
+
+	for (uint i=0; i<m_blocks.size(); i++){
+		std::vector<Topo::CoFace*> cofaces;
+		m_blocks[i]->getCoFaces(cofaces);
+		for (uint j=0; j<cofaces.size(); j++)
+			if (cofaces[j]->isMeshed() && !isMeshOutOfDate(cofaces[j])){
+				std::vector<gmds::TCellID>& nodes = cofaces[j]->nodes();
+				for (uint k=0; k<nodes.size(); k++)
+					filtre_nodes.set(nodes[k], 2);
+			}
+	}
+	for (uint i=0; i<m_cofaces.size(); i++){
+		std::vector<Topo::CoEdge*> coedges;
+		m_cofaces[i]->getCoEdges(coedges, false);
+		for (uint j=0; j<coedges.size(); j++)
+			if (coedges[j]->isMeshed() && !isMeshOutOfDate(coedges[j])){
+				std::vector<gmds::TCellID>& nodes = coedges[j]->nodes();
+				for (uint k=0; k<nodes.size(); k++)
+					filtre_nodes.set(nodes[k], 2);
+			}
+	}
+	for (uint i=0; i<m_coedges.size(); i++)
+		for (uint j=0; j<m_coedges[i]->getNbVertices(); j++){
+			Topo::Vertex* ve = m_coedges[i]->getVertex(j);
+			if (ve->isMeshed() && !isMeshOutOfDate(ve))
+				filtre_nodes.set(ve->getNode(), 2);
+		}
+
+	// les noeuds propres aux entités à remailler
+	std::vector<gmds::TCellID> nodes_to_delete;
+	for (uint i=0; i<m_blocks.size(); i++){
+		// les noeuds intérieurs d'un maillage conservé sous forme IJK n'existent pas
+		std::vector<gmds::TCellID>& nodes = m_blocks[i]->getMeshingData()->nodes();
+		for (uint k=0; k<nodes.size(); k++)
+			if (gmds::NullID != nodes[k] && !filtre_nodes.isMarked(nodes[k])){
+				filtre_nodes.set(nodes[k], 1);
+				nodes_to_delete.push_back(nodes[k]);
+			}
+	}
+	for (uint i=0; i<m_cofaces.size(); i++){
+		std::vector<gmds::TCellID>& nodes = m_cofaces[i]->nodes();
+		for (uint k=0; k<nodes.size(); k++)
+			if (!filtre_nodes.isMarked(nodes[k])){
+				filtre_nodes.set(nodes[k], 1);
+				nodes_to_delete.push_back(nodes[k]);
+			}
+	}
+	for (uint i=0; i<m_coedges.size(); i++){
+		std::vector<gmds::TCellID>& nodes = m_coedges[i]->nodes();
+		for (uint k=0; k<nodes.size(); k++)
+			if (!filtre_nodes.isMarked(nodes[k])){
+				filtre_nodes.set(nodes[k], 1);
+				nodes_to_delete.push_back(nodes[k]);
+			}
+	}
+	for (uint i=0; i<m_vertices.size(); i++){
+		gmds::TCellID node = m_vertices[i]->getNode();
+		if (!filtre_nodes.isMarked(node)){
+			filtre_nodes.set(node, 1);
+			nodes_to_delete.push_back(node);
+		}
+	}
+
+	// destruction des mailles, puis des noeuds, et oubli du maillage par les entités
+	for (uint i=0; i<m_blocks.size(); i++){
+		Topo::BlockMeshingData* md = m_blocks[i]->getMeshingData();
+		for (uint j=0; j<md->regions().size(); j++)
+			gmds_mesh.deleteRegion(md->regions()[j]);
+		md->regions().clear();
+		md->nodes().clear();
+		delete md->structuredMesh();
+		md->structuredMesh() = 0;
+		md->setBuiltOnDemand(false);
+		md->setMeshCrossed(false);
+		bl->getMeshingData()->setPreMeshed(false);
+		bl->getMeshingData()->setMeshed(false);
+	}
+	for (uint i=0; i<m_cofaces.size(); i++){
+		Topo::CoFace* cf = m_cofaces[i];
+		for (uint j=0; j<cf->faces().size(); j++)
+			gmds_mesh.deleteFace(cf->faces()[j]);
+		cf->faces().clear();
+		cf->nodes().clear();
+		cf->getMeshingData()->setPreMeshed(false);
+		cf->getMeshingData()->setMeshed(false);
+	}
+	for (uint i=0; i<m_coedges.size(); i++){
+		Topo::CoEdge* ce = m_coedges[i];
+		for (uint j=0; j<ce->edges().size(); j++)
+			gmds_mesh.deleteEdge(ce->edges()[j]);
+		ce->edges().clear();
+		ce->nodes().clear();
+		ce->getMeshingData()->setMeshed(false);
+	}
+	for (uint i=0; i<m_vertices.size(); i++)
+		m_vertices[i]->getMeshingData()->setMeshed(false);
+
+	for (uint i=0; i<nodes_to_delete.size(); i++)
+		gmds_mesh.deleteNode(nodes_to_delete[i]);
+
+#ifdef _DEBUG2
+	std::cout<<"CommandUpdateMesh::unmesh, "<<nodes_to_delete.size()<<" noeuds détruits"<<std::endl;
+#endif
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::internalUndo()
+{
+	throw TkUtil::Exception (TkUtil::UTF8String ("Erreur, la commande de mise à jour du maillage n'est pas annulable", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+void CommandUpdateMesh::internalRedo()
+{
+	throw TkUtil::Exception (TkUtil::UTF8String ("Erreur, la commande de mise à jour du maillage n'est pas rejouable", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
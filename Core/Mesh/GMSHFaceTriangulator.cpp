@@ -0,0 +1,731 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file GMSHFaceTriangulator.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/GMSHFaceTriangulator.h"
+#include "Geom/OCCGeomRepresentation.h"
+/*----------------------------------------------------------------------------*/
+/// OCC
+#include <BinTools.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+/*----------------------------------------------------------------------------*/
+/// TkUtil
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+/// GMSH
+#include "Context.h"
+#include "Options.h"
+#include "GModel.h"
+#include "OCCEdge.h"
+#include "GModelIO_OCC.h"
+#include "MVertex.h"
+#include "MLine.h"
+#include "meshGFace.h"
+#include "MTriangle.h"
+#include "GmshMessage.h"
+#include "MPoint.h"
+#include "robustPredicates.h"
+/*----------------------------------------------------------------------------*/
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include <errno.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+//#define _DEBUG_MESH
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+const unsigned int GMSHFaceTriangulator::MAX_WORKERS            = 8;
+const unsigned int GMSHFaceTriangulator::MIN_FACES_PER_WORKER   = 2;
+const unsigned int GMSHFaceTriangulator::WORKER_TIMEOUT         = 600;
+/*----------------------------------------------------------------------------*/
+/// marque en début des fichiers d'échange
+static const char s_magic[] = "MGX3DGMSH";
+/// version du format des fichiers d'échange
+static const unsigned long s_version = 1;
+/*----------------------------------------------------------------------------*/
+static void writeInt(std::ostream& out, int val)
+{
+    out.write((const char*)&val, sizeof(int));
+}
+/*----------------------------------------------------------------------------*/
+static void writeUnsignedLong(std::ostream& out, unsigned long val)
+{
+    out.write((const char*)&val, sizeof(unsigned long));
+}
+/*----------------------------------------------------------------------------*/
+static void writeLong(std::ostream& out, long val)
+{
+    out.write((const char*)&val, sizeof(long));
+}
+/*----------------------------------------------------------------------------*/
+static void writeDouble(std::ostream& out, double val)
+{
+    out.write((const char*)&val, sizeof(double));
+}
+/*----------------------------------------------------------------------------*/
+static void writeBool(std::ostream& out, bool val)
+{
+    char c = (val?1:0);
+    out.write(&c, 1);
+}
+/*----------------------------------------------------------------------------*/
+static void writeString(std::ostream& out, const std::string& str)
+{
+    writeUnsignedLong(out, str.size());
+    out.write(str.data(), str.size());
+}
+/*----------------------------------------------------------------------------*/
+static void writePoint(std::ostream& out, const Utils::Math::Point& pt)
+{
+    writeDouble(out, pt.getX());
+    writeDouble(out, pt.getY());
+    writeDouble(out, pt.getZ());
+}
+/*----------------------------------------------------------------------------*/
+static void writeHeader(std::ostream& out)
+{
+    out.write(s_magic, sizeof(s_magic));
+    writeUnsignedLong(out, s_version);
+}
+/*----------------------------------------------------------------------------*/
+static void checkStream(std::istream& in)
+{
+    if (!in)
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier d'échange GMSH tronqué ou illisible", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+static int readInt(std::istream& in)
+{
+    int val = 0;
+    in.read((char*)&val, sizeof(int));
+    checkStream(in);
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+static unsigned long readUnsignedLong(std::istream& in)
+{
+    unsigned long val = 0;
+    in.read((char*)&val, sizeof(unsigned long));
+    checkStream(in);
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+static long readLong(std::istream& in)
+{
+    long val = 0;
+    in.read((char*)&val, sizeof(long));
+    checkStream(in);
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+static double readDouble(std::istream& in)
+{
+    double val = 0.0;
+    in.read((char*)&val, sizeof(double));
+    checkStream(in);
+    return val;
+}
+/*----------------------------------------------------------------------------*/
+static bool readBool(std::istream& in)
+{
+    char c = 0;
+    in.read(&c, 1);
+    checkStream(in);
+    return c != 0;
+}
+/*----------------------------------------------------------------------------*/
+static std::string readString(std::istream& in)
+{
+    unsigned long size = readUnsignedLong(in);
+    std::string str(size, '\0');
+    if (size)
+        in.read(&str[0], size);
+    checkStream(in);
+    return str;
+}
+/*----------------------------------------------------------------------------*/
+static Utils::Math::Point readPoint(std::istream& in)
+{
+    double x = readDouble(in);
+    double y = readDouble(in);
+    double z = readDouble(in);
+    return Utils::Math::Point(x, y, z);
+}
+/*----------------------------------------------------------------------------*/
+static void readHeader(std::istream& in)
+{
+    char magic[sizeof(s_magic)];
+    in.read(magic, sizeof(s_magic));
+    checkStream(in);
+    if (0 != memcmp(magic, s_magic, sizeof(s_magic)) || s_version != readUnsignedLong(in))
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier d'échange GMSH d'un format non reconnu", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+/** association entre un sommet GMSH et le noeud gmds d'un des sommets de l'arête,
+ *  retourne l'indice de ce sommet dans l'arête
+ */
+static uint _addGMDSVertex2GVertex(const GMSHFaceRequest::Edge& edge,
+        GVertex* gv1,
+        std::map<gmds::TCellID, MVertex*>& cor_gmdsNode_gmshVertex,
+        std::map<MVertex*, gmds::TCellID>& cor_gmshVertex_gmdsNode)
+{
+    // on cherche le sommet magix correspondant
+    Utils::Math::Point p1(gv1->point().x(), gv1->point().y(), gv1->point().z());
+    int ind_vtx = -1;
+    for (uint ind=0; ind<2; ind++)
+        if (edge.m_vertex_coords[ind].length(p1) <= edge.m_vertex_precision[ind])
+            ind_vtx = ind;
+
+    if (ind_vtx == -1){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "Pb avec arête "<< edge.m_name
+                << ", on ne trouve pas de sommet correspondant au point géométrique ("
+                <<gv1->point().x()<<", "<<gv1->point().y()<<", "<<gv1->point().z()<<")";
+        throw TkUtil::Exception (message);
+    }
+
+    // le noeud du sommet est le premier ou le dernier de l'arête
+    gmds::TCellID nd = (ind_vtx == 0 ? edge.m_node_ids.front() : edge.m_node_ids.back());
+    MVertex* mvtx = cor_gmdsNode_gmshVertex[nd];
+    if (mvtx == 0){
+        const Utils::Math::Point& pt =
+                (ind_vtx == 0 ? edge.m_node_coords.front() : edge.m_node_coords.back());
+        mvtx = new MVertex(pt.getX(), pt.getY(), pt.getZ(), gv1, 0);
+
+        cor_gmdsNode_gmshVertex[nd] = mvtx;
+        cor_gmshVertex_gmdsNode[mvtx] = nd;
+
+        gv1->addMeshVertex(mvtx);
+        gv1->points.push_back(new MPoint(mvtx));
+    }
+    return (uint)ind_vtx;
+}
+/*----------------------------------------------------------------------------*/
+/// maillage par GMSH de la face du modèle et codage de la triangulation
+static void _triangulate(const GMSHFaceRequest& request, GModel* model,
+        const TopTools_IndexedMapOfShape& mapEdgeOfFace, FaceTriangulation& triangulation)
+{
+    // correspondance entre noeuds GMDS et GMSH pour éviter les doublons
+    std::map<gmds::TCellID, MVertex*> cor_gmdsNode_gmshVertex;
+    std::map<MVertex*, gmds::TCellID> cor_gmshVertex_gmdsNode;
+
+    for (size_t i=0; i<request.m_edges.size(); i++){
+        const GMSHFaceRequest::Edge& edge = request.m_edges[i];
+#ifdef _DEBUG_MESH
+        std::cout <<"--Traitement de l'arête "<<edge.m_name<<std::endl;
+#endif
+        if (edge.m_index_in_face < 1 || edge.m_index_in_face > mapEdgeOfFace.Extent()
+                || edge.m_node_ids.size() < 2){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message << "Pb avec arête "
+                    << edge.m_name
+                    << ", on ne trouve pas d'arête OCC de la face pour courbe "
+                    << edge.m_curve_name;
+            throw TkUtil::Exception (message);
+        }
+        TopoDS_Edge edgeInFace = TopoDS::Edge(mapEdgeOfFace(edge.m_index_in_face));
+
+        // recherche de la gedge dans le model
+        GEdge* gedge = model->getOCCInternals()->getOCCEdgeByNativePtr(model, edgeInFace);
+
+        if (gedge == 0){
+            // recherche avec notre propre identification de la bonne gedge
+            for (GModel::eiter iter = model->firstEdge(); iter != model->lastEdge(); ++iter){
+                GEdge* loc_gedge = *iter;
+
+                OCCEdge* loc_occedge = dynamic_cast<OCCEdge*>(loc_gedge);
+                if (loc_occedge == 0){
+					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                    message << "Erreur interne, conversion en  OCCEdge impossible !";
+                    throw TkUtil::Exception (message);
+                }
+
+                TopoDS_Edge loc_tedge = loc_occedge->getTopoDS_Edge();
+
+                if (Geom::OCCGeomRepresentation::areEquals(loc_tedge, edgeInFace))
+                    gedge = loc_gedge;
+            }
+        }
+
+        if (gedge == 0){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message << "Pb avec arête "
+                    << edge.m_name
+                    << ", on ne trouve pas de GEdge pour courbe "
+                    << edge.m_curve_name;
+            throw TkUtil::Exception (message);
+        }
+#ifdef _DEBUG_MESH
+        std::cout <<"    gedge trouvé... tag "<<gedge->tag()<<std::endl;
+#endif
+
+        // association entre GMSH::GVertex et GMDS::Node
+        GVertex *gv1 = gedge->getBeginVertex();
+        uint ind1 = _addGMDSVertex2GVertex(edge, gv1, cor_gmdsNode_gmshVertex, cor_gmshVertex_gmdsNode);
+        if (!gedge->periodic(0)){
+            GVertex *gv2 = gedge->getEndVertex();
+            _addGMDSVertex2GVertex(edge, gv2, cor_gmdsNode_gmshVertex, cor_gmshVertex_gmdsNode);
+        }
+        std::vector<MVertex*> &mesh_vertices = gedge->mesh_vertices ;
+        std::vector<MLine*> &lines = gedge->lines ;
+
+        // les noeuds sont parcourus depuis le sommet de début de la gedge
+        const size_t nbNodes = edge.m_node_ids.size();
+        std::vector<size_t> order(nbNodes);
+        for (size_t j=0; j<nbNodes; j++)
+            order[j] = (ind1 == 0 ? j : nbNodes-1-j);
+
+        for (size_t j=1; j<nbNodes-1; j++){
+            const gmds::TCellID nd = edge.m_node_ids[order[j]];
+            const Utils::Math::Point& pt = edge.m_node_coords[order[j]];
+
+            // paramétrisation propre à la courbe locale à la face
+            double param = 0.0;
+            Geom::OCCGeomRepresentation::getParameterOnTopoDSEdge(edgeInFace, pt, param);
+
+            MVertex* mvtx = new MEdgeVertex(pt.getX(), pt.getY(),pt.getZ(), gedge, param);
+
+            cor_gmdsNode_gmshVertex[nd] = mvtx;
+            cor_gmshVertex_gmdsNode[mvtx] = nd;
+
+            mesh_vertices.push_back(mvtx);
+        }
+
+        for (size_t j=0; j<nbNodes-1; j++){
+            MVertex* mvtx1 = cor_gmdsNode_gmshVertex[edge.m_node_ids[order[j]]];
+            MVertex* mvtx2 = cor_gmdsNode_gmshVertex[edge.m_node_ids[order[j+1]]];
+            lines.push_back(new MLine(mvtx1, mvtx2));
+        }
+    } // end for i<request.m_edges.size()
+
+
+    // codage des noeuds à créer (voir FaceTriangulation)
+    std::map<MVertex*, long> cor_gmshVertex_code;
+
+    // appel à GMSH pour mailler la surface
+    for(GModel::fiter it = model->firstFace(); it != model->lastFace(); ++it)
+    {
+        if (request.m_periodic){
+#ifdef _DEBUG_MESH
+            std::cout<<"appel à meshGeneratorPeriodic"<<std::endl;
+#endif
+            meshGeneratorPeriodic(*it, // la GFace
+                    false); // debug
+        }
+        else {
+#ifdef _DEBUG_MESH
+            std::cout<<"appel à meshGenerator"<<std::endl;
+#endif
+            meshGenerator(*it, // la GFace
+                    0,     // RECUR_ITER
+                    false, // repairSelfIntersecting1dMesh
+                    false, // onlyInitialMesh
+                    false, // debug
+                    0);    // replacement_edges (list)
+        }
+
+        if (Msg::GetErrorCount()){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message << "GMSH sort en erreur (ErrorCount : "
+                    << (short)Msg::GetErrorCount()
+                    << ") pour la face commune topologique "
+                    << request.m_name;
+            throw TkUtil::Exception (message);
+        }
+
+        // récupération du maillage, les noeuds à créer sont numérotés
+        // dans l'ordre de leur première apparition
+        std::vector<MTriangle*>& triangles = (*it)->triangles;
+
+        triangulation.m_triangles.reserve(triangulation.m_triangles.size()+3*triangles.size());
+        for (uint i=0; i<triangles.size(); i++){
+            MTriangle* tri = triangles[i];
+            for (uint j=0; j<3; j++){
+                MVertex* mvtx = tri->getVertex(j);
+                long code;
+
+                std::map<MVertex*, gmds::TCellID>::iterator iter_gmds = cor_gmshVertex_gmdsNode.find(mvtx);
+                if (iter_gmds != cor_gmshVertex_gmdsNode.end())
+                    code = iter_gmds->second;
+                else {
+                    std::map<MVertex*, long>::iterator iter_code = cor_gmshVertex_code.find(mvtx);
+                    if (iter_code != cor_gmshVertex_code.end())
+                        code = iter_code->second;
+                    else {
+                        code = FaceTriangulation::newPointCode(triangulation.m_points.size());
+                        triangulation.m_points.push_back(Utils::Math::Point(mvtx->x(), mvtx->y(), mvtx->z()));
+                        cor_gmshVertex_code[mvtx] = code;
+                    }
+                }
+                triangulation.m_triangles.push_back(code);
+            }
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::triangulate (
+        const GMSHFaceRequest& request, FaceTriangulation& triangulation)
+{
+    Msg::ResetErrorCounter();
+
+    // init des options GMSH
+    InitOptions(0);
+
+    // Initialize robust predicates
+    robustPredicates::exactinit();
+
+    // récupération des paramètre utilisateur
+    CTX::instance()->mesh.lcMin = request.m_lc_min;
+    CTX::instance()->mesh.lcMax = request.m_lc_max;
+
+    TopoDS_Face face_shape = request.m_shape;
+    TopTools_IndexedMapOfShape  mapEdgeOfFace;
+    TopExp::MapShapes(face_shape,TopAbs_EDGE, mapEdgeOfFace);
+
+    // construction du modèle GMSH à partir de cette shape OCC
+    GModel* model = new GModel(std::string("GModel_")+request.m_name);
+    try {
+        model->importOCCShape(&face_shape);
+        _triangulate(request, model, mapEdgeOfFace, triangulation);
+    }
+    catch (...){
+        delete model;
+        throw;
+    }
+
+    // nettoyage mémoire de ce qui a servi à GMSH
+    delete model;
+}
+/*----------------------------------------------------------------------------*/
+unsigned int GMSHFaceTriangulator::getWorkersNum (size_t facesNum, int requested)
+{
+    unsigned int num = 0;
+    if (requested >= 0)
+        num = (unsigned int)requested;
+    else {
+        long cpuNum = sysconf(_SC_NPROCESSORS_ONLN);
+        num = (cpuNum > 0 ? (unsigned int)cpuNum : 1);
+        if (num > MAX_WORKERS)
+            num = MAX_WORKERS;
+    }
+
+    if (num > facesNum / MIN_FACES_PER_WORKER)
+        num = facesNum / MIN_FACES_PER_WORKER;
+
+    return (num < 2 ? 0 : num);
+}
+/*----------------------------------------------------------------------------*/
+std::string GMSHFaceTriangulator::getWorkerPath (const std::string& requested)
+{
+    std::string path = requested;
+    // exécutable de l'arborescence de compilation (tests), à défaut celui
+    // de l'installation
+#ifdef MGX3D_GMSH_WORKER_BUILD_PATH
+    if (path.empty() && 0 == access(MGX3D_GMSH_WORKER_BUILD_PATH, X_OK))
+        path = MGX3D_GMSH_WORKER_BUILD_PATH;
+#endif
+#ifdef MGX3D_GMSH_WORKER_PATH
+    if (path.empty())
+        path = MGX3D_GMSH_WORKER_PATH;
+#endif
+
+    if (!path.empty() && 0 != access(path.c_str(), X_OK))
+        path.clear();
+
+    return path;
+}
+/*----------------------------------------------------------------------------*/
+/// création d'un fichier temporaire vide, retourne son nom (vide en cas d'échec)
+static std::string _createTemporaryFile()
+{
+    const char* tmpdir = getenv("TMPDIR");
+    std::string name = std::string(0 != tmpdir && 0 != *tmpdir ? tmpdir : "/tmp")
+            + "/mgx3dGmshXXXXXX";
+    int fd = mkstemp(&name[0]);
+    if (fd < 0)
+        return std::string();
+    close(fd);
+    return name;
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::triangulate (
+        const std::vector<GMSHFaceRequest*>& requests,
+        std::vector<FaceTriangulation*>& triangulations,
+        unsigned int workersNum, const std::string& path)
+{
+    triangulations.assign(requests.size(), (FaceTriangulation*)0);
+
+    if (workersNum > requests.size())
+        workersNum = requests.size();
+    if (0 == workersNum || path.empty())
+        return;
+
+    // un processus traite les faces i, i+workersNum, ... l'une après l'autre
+    std::vector<std::string> requestsFiles(workersNum), resultsFiles(workersNum);
+    std::vector<pid_t> pids(workersNum, (pid_t)-1);
+    for (unsigned int w=0; w<workersNum; w++){
+        requestsFiles[w] = _createTemporaryFile();
+        resultsFiles[w]  = _createTemporaryFile();
+        if (requestsFiles[w].empty() || resultsFiles[w].empty())
+            continue;
+
+        std::ofstream out(requestsFiles[w].c_str(), std::ios::binary | std::ios::trunc);
+        writeHeader(out);
+        writeUnsignedLong(out, (requests.size() - w + workersNum - 1) / workersNum);
+        for (size_t i=w; i<requests.size(); i+=workersNum){
+            writeUnsignedLong(out, i);
+            write(out, *requests[i]);
+        }
+        out.close();
+        if (!out)
+            continue;
+
+        // posix_spawn : pas de fork du processus courant (multithreadé), le fils
+        // exécute directement mgx3dGmshWorker
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(path.c_str()));
+        argv.push_back(const_cast<char*>(requestsFiles[w].c_str()));
+        argv.push_back(const_cast<char*>(resultsFiles[w].c_str()));
+        argv.push_back(0);
+        pid_t pid = -1;
+        if (0 == posix_spawn(&pid, path.c_str(), 0, 0, &argv[0], environ))
+            pids[w] = pid;
+    } // for w<workersNum
+
+    // attente des processus, ceux qui dépassent le délai sont arrêtés
+    const std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(WORKER_TIMEOUT);
+    unsigned int running = 0;
+    for (unsigned int w=0; w<workersNum; w++)
+        if (pids[w] > 0)
+            running++;
+    while (running > 0){
+        for (unsigned int w=0; w<workersNum; w++){
+            if (pids[w] <= 0)
+                continue;
+            int status = 0;
+            pid_t ret = waitpid(pids[w], &status, WNOHANG);
+            if (ret == pids[w] || (ret == -1 && errno != EINTR)){
+                pids[w] = -1;
+                running--;
+            }
+        }
+        if (running == 0)
+            break;
+
+        if (std::chrono::steady_clock::now() >= deadline){
+            for (unsigned int w=0; w<workersNum; w++){
+                if (pids[w] <= 0)
+                    continue;
+                kill(pids[w], SIGKILL);
+                int status = 0;
+                while (-1 == waitpid(pids[w], &status, 0) && errno == EINTR)
+                    ;
+                pids[w] = -1;
+            }
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    } // while (running > 0)
+
+    // récupération des triangulations. Chaque enregistrement est écrit en une
+    // fois, seul le dernier peut être incomplet si le processus a été interrompu.
+    for (unsigned int w=0; w<workersNum; w++){
+        if (!resultsFiles[w].empty()){
+            std::ifstream in(resultsFiles[w].c_str(), std::ios::binary);
+            try {
+                readHeader(in);
+                while (in.peek() != std::ifstream::traits_type::eof()){
+                    unsigned long index = readUnsignedLong(in);
+                    if (false == readBool(in))
+                        continue;
+                    FaceTriangulation* triangulation = new FaceTriangulation();
+                    try {
+                        read(in, *triangulation);
+                    }
+                    catch (...){
+                        delete triangulation;
+                        throw;
+                    }
+                    if (index < requests.size() && 0 == triangulations[index])
+                        triangulations[index] = triangulation;
+                    else
+                        delete triangulation;
+                }
+            }
+            catch (...){
+                // fichier absent, vide ou tronqué : les faces manquantes seront
+                // triangulées dans le processus courant
+            }
+            unlink(resultsFiles[w].c_str());
+        }
+        if (!requestsFiles[w].empty())
+            unlink(requestsFiles[w].c_str());
+    } // for w<workersNum
+}
+/*----------------------------------------------------------------------------*/
+int GMSHFaceTriangulator::workerMain (
+        const std::string& requestsFile, const std::string& resultsFile)
+{
+    try {
+        std::ifstream in(requestsFile.c_str(), std::ios::binary);
+        readHeader(in);
+        const unsigned long count = readUnsignedLong(in);
+
+        std::ofstream out(resultsFile.c_str(), std::ios::binary | std::ios::trunc);
+        writeHeader(out);
+        out.flush();
+
+        for (unsigned long i=0; i<count; i++){
+            const unsigned long index = readUnsignedLong(in);
+            GMSHFaceRequest request;
+            read(in, request);
+
+            FaceTriangulation triangulation;
+            bool ok = true;
+            try {
+                triangulate(request, triangulation);
+            }
+            catch (...){
+                // face ignorée, elle sera triangulée (et l'erreur remontée)
+                // par le processus appelant
+                ok = false;
+            }
+
+            // écriture en une fois de l'enregistrement
+            std::ostringstream record;
+            writeUnsignedLong(record, index);
+            writeBool(record, ok);
+            if (ok)
+                write(record, triangulation);
+            const std::string bytes = record.str();
+            out.write(bytes.data(), bytes.size());
+            out.flush();
+            if (!out)
+                return 1;
+        }
+
+        out.close();
+        return (!out ? 1 : 0);
+    }
+    catch (const TkUtil::Exception& exc){
+        std::cerr << "mgx3dGmshWorker : " << exc.getFullMessage() << std::endl;
+    }
+    catch (...){
+        std::cerr << "mgx3dGmshWorker : erreur non documentée." << std::endl;
+    }
+    return 1;
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::write (std::ostream& out, const GMSHFaceRequest& request)
+{
+    writeString(out, request.m_name);
+    writeDouble(out, request.m_lc_min);
+    writeDouble(out, request.m_lc_max);
+
+    // format binaire : pas de perte sur les réels, le résultat est le même
+    // que dans le processus courant
+    std::ostringstream shape;
+    BinTools::Write(request.m_shape, shape);
+    writeString(out, shape.str());
+
+    writeBool(out, request.m_periodic);
+    writeUnsignedLong(out, request.m_edges.size());
+    for (size_t i=0; i<request.m_edges.size(); i++){
+        const GMSHFaceRequest::Edge& edge = request.m_edges[i];
+        writeString(out, edge.m_name);
+        writeString(out, edge.m_curve_name);
+        writeInt(out, edge.m_index_in_face);
+        writeUnsignedLong(out, edge.m_node_ids.size());
+        for (size_t j=0; j<edge.m_node_ids.size(); j++){
+            writeUnsignedLong(out, edge.m_node_ids[j]);
+            writePoint(out, edge.m_node_coords[j]);
+        }
+        for (uint j=0; j<2; j++){
+            writePoint(out, edge.m_vertex_coords[j]);
+            writeDouble(out, edge.m_vertex_precision[j]);
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::read (std::istream& in, GMSHFaceRequest& request)
+{
+    request.m_name   = readString(in);
+    request.m_lc_min = readDouble(in);
+    request.m_lc_max = readDouble(in);
+
+    std::istringstream shape(readString(in));
+    TopoDS_Shape face;
+    BinTools::Read(face, shape);
+    if (face.IsNull() || face.ShapeType() != TopAbs_FACE)
+        throw TkUtil::Exception(TkUtil::UTF8String ("Fichier d'échange GMSH : surface OCC illisible", TkUtil::Charset::UTF_8));
+    request.m_shape = TopoDS::Face(face);
+
+    request.m_periodic = readBool(in);
+    request.m_edges.resize(readUnsignedLong(in));
+    for (size_t i=0; i<request.m_edges.size(); i++){
+        GMSHFaceRequest::Edge& edge = request.m_edges[i];
+        edge.m_name          = readString(in);
+        edge.m_curve_name    = readString(in);
+        edge.m_index_in_face = readInt(in);
+        const unsigned long nbNodes = readUnsignedLong(in);
+        edge.m_node_ids.resize(nbNodes);
+        edge.m_node_coords.resize(nbNodes);
+        for (unsigned long j=0; j<nbNodes; j++){
+            edge.m_node_ids[j]    = readUnsignedLong(in);
+            edge.m_node_coords[j] = readPoint(in);
+        }
+        for (uint j=0; j<2; j++){
+            edge.m_vertex_coords[j]    = readPoint(in);
+            edge.m_vertex_precision[j] = readDouble(in);
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::write (std::ostream& out, const FaceTriangulation& triangulation)
+{
+    writeUnsignedLong(out, triangulation.m_points.size());
+    for (size_t i=0; i<triangulation.m_points.size(); i++)
+        writePoint(out, triangulation.m_points[i]);
+    writeUnsignedLong(out, triangulation.m_triangles.size());
+    for (size_t i=0; i<triangulation.m_triangles.size(); i++)
+        writeLong(out, triangulation.m_triangles[i]);
+}
+/*----------------------------------------------------------------------------*/
+void GMSHFaceTriangulator::read (std::istream& in, FaceTriangulation& triangulation)
+{
+    triangulation.m_points.resize(readUnsignedLong(in));
+    for (size_t i=0; i<triangulation.m_points.size(); i++)
+        triangulation.m_points[i] = readPoint(in);
+    triangulation.m_triangles.resize(readUnsignedLong(in));
+    for (size_t i=0; i<triangulation.m_triangles.size(); i++)
+        triangulation.m_triangles[i] = readLong(in);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -14,6 +14,7 @@
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
+#include "Utils/MarkVector.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Internal/InfoCommand.h"
 
@@ -31,7 +32,7 @@ namespace Mesh {
 /*----------------------------------------------------------------------------*/
 const char* Line::typeNameMeshLine = "MeshLine";
 /*----------------------------------------------------------------------------*/
-Line::Line(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp)
+Line::Line(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp)
 : MeshEntity(ctx, prop, disp)
 , m_topo_property(new Topo::MeshLineTopoProperty())
 , m_save_topo_property(0)
@@ -187,7 +188,6 @@ void Line::getGMDSEdges(std::vector<gmds::Edge >& AEdges) const
 /*----------------------------------------------------------------------------*/
 void Line::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
 {
-	std::map<gmds::TCellID, uint> filtre;
 	std::vector<gmds::Edge> AEdges;
 
     Mesh::MeshItf*              meshItf     = getMeshManager ( ).getMesh ( );
@@ -196,13 +196,16 @@ void Line::getGMDSNodes(std::vector<gmds::Node >& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh& gmdsMesh = meshImpl->getGMDSMesh();
 
+    Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+    Utils::MarkVector& filtre = filtre_lease.marks ( );
+
     for(std::vector<gmds::Edge>::const_iterator iter=AEdges.begin();
 			iter!=AEdges.end();++iter) {
 		std::vector<gmds::TCellID> nodes  = (iter)->getAllIDs<gmds::Node>();
 		for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-			if (filtre[nodes[iNode]] == 0){
+			if (!filtre.isMarked(nodes[iNode])){
 				ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-				filtre[nodes[iNode]] = 1;
+				filtre.set(nodes[iNode], 1);
 			}
 		}
 	}
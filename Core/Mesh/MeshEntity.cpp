@@ -22,7 +22,7 @@ namespace Mesh {
 MeshEntity::
 MeshEntity(Internal::Context& ctx,
                   Utils::Property* prop,
-                  Utils::DisplayProperties* disp)
+                  const Utils::DisplayProperties& disp)
 : Internal::InternalEntity (ctx, prop, disp)
 , m_mesh_manager(&(ctx.getMeshManager())), m_bounds_to_be_calculate(true)
 , m_nodesValuesNames ( ), m_cellsValuesNames ( )
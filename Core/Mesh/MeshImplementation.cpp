@@ -45,6 +45,7 @@
 #include <TkUtil/Exception.h>
 #include <TkUtil/UTF8String.h>
 #include <TkUtil/TraceLog.h>
+#include <TkUtil/ThreadPool.h>
 
 /*----------------------------------------------------------------------------*/
 /// Qualif
@@ -187,7 +188,16 @@ getGMDSMesh (uint id)
 /*----------------------------------------------------------------------------*/
 int MeshImplementation::getNbNodes()
 {
-	return getGMDSMesh().getNbNodes();
+	// les noeuds intérieurs des blocs conservés sous forme IJK
+	size_t nbNodes = 0;
+	std::vector<Topo::Block*> blocks;
+	getContext().getLocalTopoManager().getBlocks(blocks);
+	for (uint i=0; i<blocks.size(); i++){
+		const StructuredBlockMesh* sbm = blocks[i]->getMeshingData()->structuredMesh();
+		if (sbm)
+			nbNodes += sbm->getNbInnerNodes();
+	}
+	return getGMDSMesh().getNbNodes() + nbNodes;
 }
 /*----------------------------------------------------------------------------*/
 int MeshImplementation::getNbEdges()
@@ -202,7 +212,16 @@ int MeshImplementation::getNbFaces()
 /*----------------------------------------------------------------------------*/
 int MeshImplementation::getNbRegions()
 {
-	return getGMDSMesh().getNbRegions();
+	// les hexaèdres des blocs conservés sous forme IJK
+	size_t nbRegions = 0;
+	std::vector<Topo::Block*> blocks;
+	getContext().getLocalTopoManager().getBlocks(blocks);
+	for (uint i=0; i<blocks.size(); i++){
+		const StructuredBlockMesh* sbm = blocks[i]->getMeshingData()->structuredMesh();
+		if (sbm)
+			nbRegions += sbm->getNbCells();
+	}
+	return getGMDSMesh().getNbRegions() + nbRegions;
 }
 /*----------------------------------------------------------------------------*/
 Utils::Math::Point MeshImplementation::getCoordNode(gmds::Node nd)
@@ -327,6 +346,9 @@ bool MeshImplementation::createGMDSGroups()
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::writeMli(std::string nom)
 {
+    // l'écrivain parcourt tout le maillage gmds
+    buildStructuredMeshes();
+
     // on ajoute les groupes de mailles de gmds
     bool isCreateGMDSGroupsOK = createGMDSGroups();
     if(!isCreateGMDSGroupsOK) {
@@ -382,6 +404,9 @@ void MeshImplementation::readVTK(std::string nom, uint id)
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::writeVTK(std::string nom)
 {
+    // l'écrivain parcourt tout le maillage gmds
+    buildStructuredMeshes();
+
     // on ajoute les groupes de mailles de gmds
 	bool isCreateGMDSGroupsOK = createGMDSGroups();
 	if(!isCreateGMDSGroupsOK) {
@@ -406,6 +431,172 @@ void MeshImplementation::writeVTK(std::string nom)
     deleteGMDSGroups();
 }
 /*----------------------------------------------------------------------------*/
+/**
+ * Tâche recopiant les coordonnées d'une plage de noeuds gmds dans les tableaux
+ * d'un StructuredBlockMesh (lecture seule du maillage gmds).
+ */
+class StructuredNodesGatherTask : public TkUtil::ThreadPool::TaskIfc
+{
+	public :
+
+	/**
+	 * \param	Maillage gmds
+	 * \param	Identifiants des noeuds, ids[n] correspondant au noeud n de sbm
+	 * \param	Plage [first, last[ des noeuds à recopier
+	 * \param	Maillage structuré à renseigner
+	 */
+	StructuredNodesGatherTask (gmds::IGMesh& mesh, const gmds::TCellID* ids,
+			size_t first, size_t last, StructuredBlockMesh& sbm)
+		: TkUtil::ThreadPool::TaskIfc ( ),
+		  _mesh (mesh), _ids (ids), _first (first), _last (last), _sbm (sbm),
+		  _message ( )
+	{ }
+	virtual ~StructuredNodesGatherTask ( )
+	{ }
+
+	/**
+	 * \return	Message associé à l'exécution de la tache en cas d'erreur.
+	 */
+	const std::string& getMessage ( ) const
+	{ return _message; }
+
+
+	protected :
+
+	virtual void execute ( )
+	{
+		try
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::RUNNING);
+			for (size_t n = _first; n < _last; n++)
+			{
+				gmds::Node	current	= _mesh.get<gmds::Node>(_ids [n]);
+				_sbm.setPoint (n, current.X ( ), current.Y ( ), current.Z ( ));
+			}	// for (size_t n = _first; n < _last; n++)
+			setStatus (TkUtil::ThreadPool::TaskIfc::COMPLETED);
+		}
+		catch (const TkUtil::Exception& exc)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= exc.getFullMessage ( );
+		}
+		catch (...)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= "Erreur non documentée.";
+		}
+	}	// execute
+
+
+	private :
+
+	StructuredNodesGatherTask (const StructuredNodesGatherTask&);
+	StructuredNodesGatherTask& operator = (const StructuredNodesGatherTask&);
+
+	gmds::IGMesh&			_mesh;
+	const gmds::TCellID*	_ids;
+	size_t					_first, _last;
+	StructuredBlockMesh&	_sbm;
+	std::string				_message;
+};	// class StructuredNodesGatherTask
+/*----------------------------------------------------------------------------*/
+/// nombre de noeuds recopiés par tâche lors de la construction parallèle d'un StructuredBlockMesh
+static const size_t gatherNodesPerTask = 65536;
+/// nombre maximum de noeuds par tranche lors de l'écriture CGNS (24 octets par noeud)
+static const size_t cgnsNodesPerChunk = 4194304;
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::getStructuredBlockMesh(Topo::Block* bl, StructuredBlockMesh& sbm,
+		uint kMin, uint kMax)
+{
+	// nombre de noeuds par direction
+	uint ni, nj, nk;
+	bl->getNbMeshingEdges(ni, nj, nk);
+	ni++; nj++; nk++;
+	if (kMin > kMax || kMax > nk){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur interne dans MeshImplementation::getStructuredBlockMesh, tranche ["
+				<< (long)kMin << ", " << (long)kMax << "[ hors du bloc "<<bl->getName()
+				<< " (nk = " << (long)nk << ")";
+		throw TkUtil::Exception (message);
+	}
+	sbm.resize(ni, nj, kMax-kMin);
+	const size_t nbNoeuds = sbm.getNbNodes();
+	// indice dans le bloc du premier noeud de la tranche
+	const size_t premier = (size_t)ni*nj*kMin;
+
+	// les points calculés et pas encore transformés en noeuds gmds
+	if (bl->isPreMeshed() && 0 != bl->points()){
+		const Utils::Math::Point* l_points = bl->points() + premier;
+		for (size_t i=0; i<nbNoeuds; i++)
+			sbm.setPoint(i, l_points[i]);
+		return;
+	}
+
+	// le maillage conservé sous forme IJK
+	const StructuredBlockMesh* ijk = bl->getMeshingData()->structuredMesh();
+	if (0 != ijk){
+		const double* x = ijk->x() + premier;
+		const double* y = ijk->y() + premier;
+		const double* z = ijk->z() + premier;
+		for (size_t i=0; i<nbNoeuds; i++)
+			sbm.setPoint(i, x[i], y[i], z[i]);
+		return;
+	}
+
+	std::vector<gmds::TCellID>& l_nds = bl->nodes();
+	if (l_nds.size() != (size_t)ni*nj*nk){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur interne dans MeshImplementation::getStructuredBlockMesh, nombre de noeuds différents "
+				<< (long)l_nds.size() << " != "<<(long)ni*nj*nk<<" pour "<<bl->getName();
+		throw TkUtil::Exception (message);
+	}
+	if (0 == nbNoeuds)
+		return;
+	gmds::IGMesh& gmdsMesh = getGMDSMesh();
+	const gmds::TCellID* ids = &l_nds[premier];
+
+	// petite tranche ou parallélisme non autorisé : recopie séquentielle
+	if (nbNoeuds <= gatherNodesPerTask
+			|| false == getContext().allowThreadedCommandTasks.getValue()){
+		for (size_t i=0; i<nbNoeuds; i++){
+			gmds::Node current = gmdsMesh.get<gmds::Node>(ids[i]);
+			sbm.setPoint(i, current.X(), current.Y(), current.Z());
+		}
+		return;
+	}
+
+	// recopie parallèle par plages de noeuds disjointes, le maillage gmds
+	// n'est accédé qu'en lecture
+	std::vector<StructuredNodesGatherTask*> tasks;
+	std::vector<TkUtil::ThreadPool::TaskIfc*> t;
+	for (size_t first=0; first<nbNoeuds; first+=gatherNodesPerTask){
+		size_t last = first+gatherNodesPerTask;
+		if (last > nbNoeuds)
+			last = nbNoeuds;
+		StructuredNodesGatherTask* task = new StructuredNodesGatherTask(gmdsMesh, ids, first, last, sbm);
+		tasks.push_back(task);
+		t.push_back(task);
+	}
+	TkUtil::ThreadPool::instance().addTasks(t);
+	TkUtil::ThreadPool::instance().barrier();
+
+	TkUtil::UTF8String	errors (TkUtil::Charset::UTF_8);
+	for (uint i=0; i<tasks.size(); i++){
+		if (TkUtil::ThreadPool::TaskIfc::IN_ERROR == tasks[i]->getStatus()){
+			if (false == errors.empty())
+				errors << "\n";
+			errors << tasks[i]->getMessage();
+		}
+		delete tasks[i];
+	}
+	if (false == errors.empty()){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur dans MeshImplementation::getStructuredBlockMesh pour "<<bl->getName()
+				<< " :\n" << errors;
+		throw TkUtil::Exception (message);
+	}
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::writeCGNS(std::string nom)
 {
 //#define _DEBUG_CGNS
@@ -416,7 +607,6 @@ void MeshImplementation::writeCGNS(std::string nom)
 
 	std::vector<Topo::Block*> blocks;
 	getContext().getLocalTopoManager().getBlocks(blocks, true);
-	gmds::IGMesh& gmdsMesh = getGMDSMesh();
 
 	int index_file, icelldim, iphysdim, index_base;
 
@@ -451,25 +641,6 @@ void MeshImplementation::writeCGNS(std::string nom)
 			bloc->getNbMeshingEdges(ni, nj, nk);
 			// nombre de noeuds par direction
 			ni++; nj++; nk++;
-			uint nbNoeuds = ni*nj*nk;
-
-			double* xx = new double[nbNoeuds];
-			double* yy = new double[nbNoeuds];
-			double* zz = new double[nbNoeuds];
-
-			std::vector<gmds::TCellID>& l_nds = bloc->nodes();
-			if (l_nds.size() != nbNoeuds){
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-				message << "Erreur interne dans MeshImplementation::writeCGNS, nombre de noeuds différents "
-						<< (short)l_nds.size() << " != "<<(short)nbNoeuds<<" pour "<<bloc->getName();
-				throw TkUtil::Exception (message);
-			}
-			for (uint i=0; i<nbNoeuds; i++){
-				gmds::Node current = gmdsMesh.get<gmds::Node>(l_nds[i]);
-				xx[i] = current.X();
-				yy[i] = current.Y();
-				zz[i] = current.Z();
-			}
 
 			cgsize_t isize[9];
 			char zonename[33];
@@ -500,16 +671,47 @@ void MeshImplementation::writeCGNS(std::string nom)
 			std::cout<<" => index_zone = "<<index_zone<<std::endl;
 #endif
 
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateX",xx,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write xx", TkUtil::Charset::UTF_8));
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateY",yy,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write yy", TkUtil::Charset::UTF_8));
-			if (cg_coord_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateZ",zz,&index_coord))
-				throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_write zz", TkUtil::Charset::UTF_8));
-
-			delete [] xx;
-			delete [] yy;
-			delete [] zz;
+			// coordonnées par composante, directement dans l'ordre IJK,
+			// écrites par tranches de plans k pour borner la mémoire
+			uint nbPlansParTranche = cgnsNodesPerChunk / ((size_t)ni*nj);
+			if (nbPlansParTranche < 1)
+				nbPlansParTranche = 1;
+			// un maillage conservé sous forme IJK est écrit sans recopie
+			const StructuredBlockMesh* ijk = bloc->getMeshingData()->structuredMesh();
+			StructuredBlockMesh sbm;
+			for (uint kMin=0; kMin<nk; kMin+=nbPlansParTranche){
+				uint kMax = kMin+nbPlansParTranche;
+				if (kMax > nk)
+					kMax = nk;
+				const double *x, *y, *z;
+				if (0 != ijk){
+					const size_t premier = (size_t)ni*nj*kMin;
+					x = ijk->x() + premier;
+					y = ijk->y() + premier;
+					z = ijk->z() + premier;
+				}
+				else {
+					getStructuredBlockMesh(bloc, sbm, kMin, kMax);
+					x = sbm.x();
+					y = sbm.y();
+					z = sbm.z();
+				}
+
+				cgsize_t rmin[3], rmax[3];
+				rmin[0] = 1;
+				rmin[1] = 1;
+				rmin[2] = kMin+1;
+				rmax[0] = ni;
+				rmax[1] = nj;
+				rmax[2] = kMax;
+
+				if (cg_coord_partial_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateX",rmin,rmax,x,&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_partial_write xx", TkUtil::Charset::UTF_8));
+				if (cg_coord_partial_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateY",rmin,rmax,y,&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_partial_write yy", TkUtil::Charset::UTF_8));
+				if (cg_coord_partial_write(index_file,index_base,index_zone,CGNS_ENUMV(RealDouble),"CoordinateZ",rmin,rmax,z,&index_coord))
+					throw TkUtil::Exception (TkUtil::UTF8String ("Erreur dans cg_coord_partial_write zz", TkUtil::Charset::UTF_8));
+			} // end for kMin<nk
 
 
 			// les relations avec les autres blocs
@@ -546,10 +748,8 @@ void MeshImplementation::writeCGNS(std::string nom)
 					// recherche des indices pour les 4 sommets et on renseigne ipnts (indices extrémas)
 					for (uint k=0; k<coface_vertices.size(); k++){
 						uint idxI, idxJ, idxK;
-						gmds::TCellID node_id = coface_vertices[k]->getNode();
-
-						_getIndexNode(node_id,
-								bloc->nodes(), ni, nj, nk,
+						_getIndexVertex(coface_vertices[k],
+								bloc, ni, nj, nk,
 								idxI, idxJ, idxK);
 						std::vector<uint> idxIJK;
 						idxIJK.push_back(idxI);
@@ -560,7 +760,7 @@ void MeshImplementation::writeCGNS(std::string nom)
 						std::cout<<" relation entre "<<bloc->getName()
 								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
 								<<" ni "<<ni<<", nj "<<nj<<", nk "<<nk
-								<<" pour sommet "<<coface_vertices[k]->getName()<<" node_id "<<(long)node_id
+								<<" pour sommet "<<coface_vertices[k]->getName()<<" node_id "<<(long)coface_vertices[k]->getNode()
 								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
 								<<std::endl;
 #endif
@@ -594,17 +794,14 @@ void MeshImplementation::writeCGNS(std::string nom)
 					uint ind_min = _getIndiceIJK(idxIJK_vertices, ipnts1);
 					uint ind_max = _getIndiceIJK(idxIJK_vertices, ipnts2);
 
-					gmds::TCellID node_min = coface_vertices[ind_min]->getNode();
-					gmds::TCellID node_max = coface_vertices[ind_max]->getNode();
-
 					// renseigne les ipntsdonor (indices extrémas dans bloc voisin)
 					uint ni_vois, nj_vois, nk_vois;
 					bloc_vois->getNbMeshingEdges(ni_vois, nj_vois, nk_vois);
 					ni_vois++; nj_vois++; nk_vois++;
 					{
 						uint idxI, idxJ, idxK;
-						_getIndexNode(node_min,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
+						_getIndexVertex(coface_vertices[ind_min],
+								bloc_vois, ni_vois, nj_vois, nk_vois,
 								idxI, idxJ, idxK);
 						ipntsdonor[0] = idxI;
 						ipntsdonor[1] = idxJ;
@@ -613,7 +810,7 @@ void MeshImplementation::writeCGNS(std::string nom)
 						std::cout<<" relation réciproque "<<bloc->getName()
 								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
 								<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-								<<" node_min "<<(long)node_min
+								<<" node_min "<<(long)coface_vertices[ind_min]->getNode()
 								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
 								<<std::endl;
 #endif
@@ -621,8 +818,8 @@ void MeshImplementation::writeCGNS(std::string nom)
 					}
 					{
 						uint idxI, idxJ, idxK;
-						_getIndexNode(node_max,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
+						_getIndexVertex(coface_vertices[ind_max],
+								bloc_vois, ni_vois, nj_vois, nk_vois,
 								idxI, idxJ, idxK);
 						ipntsdonor[3+0] = idxI;
 						ipntsdonor[3+1] = idxJ;
@@ -631,7 +828,7 @@ void MeshImplementation::writeCGNS(std::string nom)
 						std::cout<<" relation réciproque "<<bloc->getName()
 								<<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
 								<<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-								<<" node_max "<<(long)node_max
+								<<" node_max "<<(long)coface_vertices[ind_max]->getNode()
 								<<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
 								<<std::endl;
 #endif
@@ -720,16 +917,14 @@ void MeshImplementation::writeCGNS(std::string nom)
 					if (ind_autre == ind_min || ind_autre == ind_max)
 						throw TkUtil::Exception (TkUtil::UTF8String ("Ereur interne dans writeCGNS, on ne trouve pas de 3ème indice", TkUtil::Charset::UTF_8));
 
-					gmds::TCellID node_other = coface_vertices[ind_autre]->getNode();
-
 					ipnts[6+0] = idxIJK_vertices[ind_autre][0]+1;
 					ipnts[6+1] = idxIJK_vertices[ind_autre][1]+1;
 					ipnts[6+2] = idxIJK_vertices[ind_autre][2]+1;
 
 					{
 						uint idxI, idxJ, idxK;
-						_getIndexNode(node_other,
-								bloc_vois->nodes(), ni_vois, nj_vois, nk_vois,
+						_getIndexVertex(coface_vertices[ind_autre],
+								bloc_vois, ni_vois, nj_vois, nk_vois,
 								idxI, idxJ, idxK);
 						ipntsdonor[6+0] = idxI+1;
 						ipntsdonor[6+1] = idxJ+1;
@@ -738,7 +933,7 @@ void MeshImplementation::writeCGNS(std::string nom)
 						std::cout<<" relation réciproque "<<bloc->getName()
 							     <<" et "<<bloc_vois->getName()<<" avec face commune "<<coface->getName()
 							     <<" ni (vois) "<<ni_vois<<", nj "<<nj_vois<<", nk "<<nk_vois
-							     <<" node_other "<<(long)node_other
+							     <<" node_other "<<(long)coface_vertices[ind_autre]->getNode()
 							     <<" donne idxI "<<idxI<<", idxJ "<<idxJ<<", idxK "<<idxK
 							     <<std::endl;
 #endif
@@ -1016,19 +1211,21 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command,
             iter != blocs.end(); ++iter)
         mesh(command, *iter);
 
-	TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
-    message2 <<"Quelques infos sur le maillage généré: \n";
-    message2<< "    Nombre de blocs: "<<(short)blocs.size()<<"\n";
-//TODO Ajouter
-        message2<< "    Nombre de mailles 3D: "<<(short)getGMDSMesh().getNbRegions()<<"\n";
-//    message2<< "     Nombre d'hexaèdres: "<<(short)getGMDSMesh().getNbHexahedra()<<"\n";
-//    message2<< "     Nombre de tétraèdres: "<<(short)getGMDSMesh().getNbTetrahedra()<<"\n";
-//    message2<< "     Nombre de prismes: "<<(short)getGMDSMesh().getNbPrisms3()<<"\n";
-//    message2<< "     Nombre de pyramides: "<<(short)getGMDSMesh().getNbPyramids()<<"\n";
-    message2<< "    Nombre de mailles 2D: "<<(short)getGMDSMesh().getNbFaces()<<"\n";
-    message2<< "     Nombre de quadrangles: "<<(short)getGMDSMesh().getNbQuadrilaterals()<<"\n";
-    message2<< "     Nombre de triangles: "<<(short)getGMDSMesh().getNbTriangles()<<"\n";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_5));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
+        message2 <<"Quelques infos sur le maillage généré: \n";
+        message2<< "    Nombre de blocs: "<<(short)blocs.size()<<"\n";
+    //TODO Ajouter
+            message2<< "    Nombre de mailles 3D: "<<(short)getNbRegions()<<"\n";
+    //    message2<< "     Nombre d'hexaèdres: "<<(short)getGMDSMesh().getNbHexahedra()<<"\n";
+    //    message2<< "     Nombre de tétraèdres: "<<(short)getGMDSMesh().getNbTetrahedra()<<"\n";
+    //    message2<< "     Nombre de prismes: "<<(short)getGMDSMesh().getNbPrisms3()<<"\n";
+    //    message2<< "     Nombre de pyramides: "<<(short)getGMDSMesh().getNbPyramids()<<"\n";
+        message2<< "    Nombre de mailles 2D: "<<(short)getGMDSMesh().getNbFaces()<<"\n";
+        message2<< "     Nombre de quadrangles: "<<(short)getGMDSMesh().getNbQuadrilaterals()<<"\n";
+        message2<< "     Nombre de triangles: "<<(short)getGMDSMesh().getNbTriangles()<<"\n";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_5));
+    }
 }
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::mesh(Mesh::CommandCreateMesh* command,
@@ -1042,12 +1239,14 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command,
             iter != faces.end(); ++iter)
         mesh(command, *iter);
 
-	TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
-    message2 <<"Quelques infos sur le maillage généré: \n";
-    message2<< "    Nombre de mailles 2D: "<<(short)getGMDSMesh().getNbFaces()<<"\n";
-    message2<< "      Nombre de quadrangles: "<<(short)getGMDSMesh().getNbQuadrilaterals()<<"\n";
-    message2<< "      Nombre de triangles: "<<(short)getGMDSMesh().getNbTriangles()<<"\n";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_5));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
+        message2 <<"Quelques infos sur le maillage généré: \n";
+        message2<< "    Nombre de mailles 2D: "<<(short)getGMDSMesh().getNbFaces()<<"\n";
+        message2<< "      Nombre de quadrangles: "<<(short)getGMDSMesh().getNbQuadrilaterals()<<"\n";
+        message2<< "      Nombre de triangles: "<<(short)getGMDSMesh().getNbTriangles()<<"\n";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_5));
+    }
 }
 /*----------------------------------------------------------------------------*/
 /// Construction des points du maillage d'un bloc
@@ -1103,6 +1302,7 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command, Topo::Block* bl)
             throw TkUtil::Exception (TkUtil::UTF8String ("MeshImplementation::mesh(Topo::Block* bl) pour une méthode inconnue", TkUtil::Charset::UTF_8));
         }
         bl->getMeshingData()->setMeshed(true);
+        bl->updateMeshStamp();
     } // end if (!bl->isMeshed())
     else {
         if (bl->getMeshLaw() == Topo::BlockMeshingProperty::insertion) {
@@ -1170,6 +1370,7 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command, Topo::CoFace* fa
             MGX_NOT_YET_IMPLEMENTED("MeshImplementation::mesh(Topo::Face* fa) pour une méthode");
         }
         fa->getMeshingData()->setMeshed(true);
+        fa->updateMeshStamp();
     } // end if (!fa->isMeshed())
 
 }
@@ -1269,6 +1470,7 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command, Topo::CoEdge* ed
 		ed->clearPoints();
         ed->getMeshingData()->setPreMeshed(false);
         ed->getMeshingData()->setMeshed(true);
+        ed->updateMeshStamp();
     } // end if (!ed->isMeshed())
 }
 /*----------------------------------------------------------------------------*/
@@ -1284,6 +1486,7 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command, Topo::Vertex* ve
 
         ve->saveVertexMeshingData(&command->getInfoCommand());
         ve->getMeshingData()->setMeshed(true);
+        ve->updateMeshStamp();
 
         if (ve->getGeomAssociation()){
             Geom::GeomEntity* ge = ve->getGeomAssociation();
@@ -1335,10 +1538,12 @@ void MeshImplementation::_addNodesInClouds(Mesh::CommandCreateMesh* command, Top
 
 
 #ifdef _DEBUG_MESH
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 <<"MeshImplementation::_addNodesInClouds, pour arête "<<ed->getName()
-            <<" avec "<<ed->nodes().size()<<" noeuds à mettre dans "<<groupsName.size()<<" groupes ";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 <<"MeshImplementation::_addNodesInClouds, pour arête "<<ed->getName()
+                <<" avec "<<ed->nodes().size()<<" noeuds à mettre dans "<<groupsName.size()<<" groupes ";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    }
 #endif
 
     // getStrategy() permet l'utilisation pour le cas normal, sinon (cas d'un jalon) on ne fait rien
@@ -1371,10 +1576,12 @@ void MeshImplementation::_addNodesInClouds(Mesh::CommandCreateMesh* command, Top
 
 
 #ifdef _DEBUG_MESH
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 <<"MeshImplementation::_addNodesInClouds, pour sommet "<<ve->getName()
-            <<" avec 1 noeud à mettre dans "<<groupsName.size()<<" groupes ";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 <<"MeshImplementation::_addNodesInClouds, pour sommet "<<ve->getName()
+                <<" avec 1 noeud à mettre dans "<<groupsName.size()<<" groupes ";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    }
 #endif
 
     // getStrategy() permet l'utilisation pour le cas normal, sinon (cas d'un jalon) on ne fait rien
@@ -1407,10 +1614,12 @@ void MeshImplementation::_addEdgesInLines(Mesh::CommandCreateMesh* command, Topo
 
 
 #ifdef _DEBUG_MESH
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 <<"MeshImplementation::_addEdgesInLines, pour arête "<<ed->getName()
-            <<" avec "<<ed->edges().size()<<" bras à mettre dans "<<groupsName.size()<<" groupes ";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 <<"MeshImplementation::_addEdgesInLines, pour arête "<<ed->getName()
+                <<" avec "<<ed->edges().size()<<" bras à mettre dans "<<groupsName.size()<<" groupes ";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5));
+    }
 #endif
 
     // getStrategy() permet l'utilisation pour le cas normal, sinon (cas d'un jalon) on ne fait rien
@@ -1431,6 +1640,24 @@ void MeshImplementation::_addEdgesInLines(Mesh::CommandCreateMesh* command, Topo
         } // end for i<groupsName.size()
 }
 /*----------------------------------------------------------------------------*/
+void MeshImplementation::_getIndexVertex(Topo::Vertex* vtx, Topo::Block* bl,
+		uint ni, uint nj, uint nk,
+		uint &idxI, uint &idxJ, uint &idxK)
+{
+	// le sommet d'indice v du bloc est au coin (v&1 ? ni-1 : 0, v&2 ? nj-1 : 0, v&4 ? nk-1 : 0)
+	if (bl->getNbVertices() == 8)
+		for (uint v=0; v<8; v++)
+			if (bl->getVertex(v) == vtx){
+				idxI = (v&1 ? ni-1 : 0);
+				idxJ = (v&2 ? nj-1 : 0);
+				idxK = (v&4 ? nk-1 : 0);
+				return;
+			}
+
+	// bloc dégénéré : recherche parmi les noeuds des faces
+	_getIndexNode(vtx->getNode(), bl->getMeshingData()->nodes(), ni, nj, nk, idxI, idxJ, idxK);
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::_getIndexNode(gmds::TCellID node, std::vector<gmds::TCellID>& nodes,
 		uint ni, uint nj, uint nk,
 		uint &idxI, uint &idxJ, uint &idxK)
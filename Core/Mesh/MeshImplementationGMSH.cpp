@@ -11,6 +11,8 @@
 
 #include "Mesh/MeshImplementation.h"
 #include "Mesh/CommandCreateMesh.h"
+#include "Mesh/FaceTriangulation.h"
+#include "Mesh/GMSHFaceTriangulator.h"
 
 #include "Topo/Block.h"
 #include "Topo/Face.h"
@@ -49,6 +51,7 @@
 #include "GmshMessage.h"
 #include "MPoint.h"
 #include "robustPredicates.h"
+/*----------------------------------------------------------------------------*/
 
 
 //#define _DEBUG_MESH
@@ -63,22 +66,81 @@ void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo
     std::cout <<"Maillage de la face commune "<<fa->getName()<<" avec la méthode de Delaunay (version GMSH)"<<std::endl;
 #endif
 
-    gmds::IGMesh& gmds_mesh = getGMDSMesh();
-    Msg::ResetErrorCounter();
+    // triangulation éventuellement calculée en parallèle lors du pré-maillage
+    FaceTriangulation* triangulation = command->takeFaceTriangulation(fa);
+    if (triangulation == 0){
+        GMSHFaceRequest request;
+        _prepareDelaunayGMSH(fa, request);
+
+        triangulation = new FaceTriangulation();
+        try {
+            GMSHFaceTriangulator::triangulate(request, *triangulation);
+        }
+        catch (...){
+            delete triangulation;
+            throw;
+        }
+    }
+
+    _addFaceTriangulation(command, fa, *triangulation);
+    delete triangulation;
+
+} // end meshDelaunayGMSH
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::triangulateDelaunayGMSH(Mesh::CommandCreateMesh* command,
+        const std::vector<Topo::CoFace*>& faces)
+{
+    const unsigned int workersNum =
+            GMSHFaceTriangulator::getWorkersNum(faces.size(), getContext().getGmshWorkersNum());
+    const std::string path = getContext().getGmshWorkerPath();
+    if (0 == workersNum || path.empty())
+        return;
+
+    // les données des faces sont extraites ici, les processus mgx3dGmshWorker
+    // n'accèdent ni à la topologie ni à gmds
+    std::vector<GMSHFaceRequest*> requests;
+    std::vector<Topo::CoFace*> prepared;
+    for (size_t i=0; i<faces.size(); i++){
+        GMSHFaceRequest* request = new GMSHFaceRequest();
+        try {
+            _prepareDelaunayGMSH(faces[i], *request);
+        }
+        catch (...){
+            // face ignorée, l'erreur sera remontée par meshDelaunayGMSH
+            delete request;
+            continue;
+        }
+        requests.push_back(request);
+        prepared.push_back(faces[i]);
+    }
+
+    std::vector<FaceTriangulation*> triangulations;
+    try {
+        GMSHFaceTriangulator::triangulate(requests, triangulations, workersNum, path);
+    }
+    catch (...){
+        triangulations.clear();
+    }
+
+    for (size_t i=0; i<requests.size(); i++){
+        if (i < triangulations.size() && triangulations[i] != 0)
+            command->setFaceTriangulation(prepared[i], triangulations[i]);
+        delete requests[i];
+    }
 
+} // end triangulateDelaunayGMSH
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_prepareDelaunayGMSH(Topo::CoFace* fa, GMSHFaceRequest& request)
+{
     Topo::FaceMeshingPropertyDelaunayGMSH* prop =
             dynamic_cast<Topo::FaceMeshingPropertyDelaunayGMSH*>(fa->getCoFaceMeshingProperty());
     CHECK_NULL_PTR_ERROR(prop);
 
-    // init des options GMSH
-    InitOptions(0);
-
-    // Initialize robust predicates
-    robustPredicates::exactinit();
-
     // récupération des paramètre utilisateur
-    CTX::instance()->mesh.lcMin = prop->getMin();
-    CTX::instance()->mesh.lcMax = prop->getMax();
+    request.m_name   = fa->getName();
+    request.m_lc_min = prop->getMin();
+    request.m_lc_max = prop->getMax();
+    request.m_periodic = false;
 
     //Geometrie de la coface
     Geom::GeomEntity*  geo_entity = fa->getGeomAssociation();
@@ -97,45 +159,24 @@ void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo
                 << " ne peut pas être maillée en triangles : absence de shape OCC";
         throw TkUtil::Exception (message);
     }
-    TopoDS_Face face_shape = TopoDS::Face(occ_rep->getShape());
+    request.m_shape = TopoDS::Face(occ_rep->getShape());
 
     TopTools_IndexedMapOfShape  mapEdgeOfFace;
-    TopExp::MapShapes(face_shape,TopAbs_EDGE, mapEdgeOfFace);
-
-#ifdef _DEBUG_MESH
-    std::cout <<"=== new GModel"<<std::endl;
-#endif
-    // construction du modèle GMSH à partir de cette shape OCC
-    GModel* model = new GModel(std::string("GModel_")+fa->getName());
-#ifdef _DEBUG_MESH
-    std::cout <<"=== importOCCShape"<<std::endl;
-#endif
-    model->importOCCShape(&face_shape);
+    TopExp::MapShapes(request.m_shape,TopAbs_EDGE, mapEdgeOfFace);
 
-#ifdef _DEBUG_MESH
-    std::cout <<"=== traitement des arêtes de la face "<<fa->getName()<<std::endl;
-#endif
     // on recupere le maillage des aretes
     std::vector<Topo::Edge* > edges;
     fa->getEdges(edges);
 
-    // correspondance entre noeuds GMDS et GMSH pour éviter les doublons
-    std::map<gmds::TCellID, MVertex*> cor_gmdsNode_gmshVertex;
-    std::map<MVertex*, gmds::TCellID> cor_gmshVertex_gmdsNode;
-    bool have_periodic_edge = false;
-
     std::map<Topo::Edge*, uint> filtre_edges;
 
     for(unsigned int i=0;i<edges.size();i++){
         Topo::Edge* edge =edges[i];
-#ifdef _DEBUG_MESH
-        std::cout <<"--Traitement de l'arête "<<edge->getName()<<std::endl;
-#endif
         std::vector<Topo::Vertex* > v_edge = edge->getVertices();
 
         // cas d'une arête déjà vue
         if (filtre_edges[edge] == 1){
-            have_periodic_edge = true;
+            request.m_periodic = true;
             // on passe le traitement de l'arête, elle a déja été vue
             continue;
         }
@@ -159,10 +200,6 @@ void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo
                     << " n'est pas projetée, ce cas n'est pas prévu pour le cas GMSH ";
             throw TkUtil::Exception (message);
         }
-#ifdef _DEBUG_MESH
-        std::cout <<"    associée à "<<ge->getName()<<" avec "
-        		<<ge->getRefTopo().size()<<" entités topologiques en relation"<<std::endl;
-#endif
         Geom::Curve* curve = dynamic_cast<Geom::Curve*>(ge);
         if (curve == 0){
 			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
@@ -183,265 +220,82 @@ void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo
             throw TkUtil::Exception (message);
         }
 
+        // l'arête OCC de la face correspondant à la courbe
         TopoDS_Edge tedge = TopoDS::Edge(crv_occ_rep->getShape());
-        TopoDS_Edge edgeInFace;
         int         edgeIndexInFace=0;
         for(int j = 1; j <= mapEdgeOfFace.Extent(); j++){
             TopoDS_Edge ej  = TopoDS::Edge(mapEdgeOfFace(j));
             if(Geom::OCCGeomRepresentation::areEquals(tedge,ej))
-            {
-                edgeInFace=ej;
                 edgeIndexInFace=j;
-            }
         }
 
-#ifdef _DEBUG_MESH
-        std::cout<<"*************************************************"<<std::endl;
-        std::cout<<"\t ==> Correspond à l'arête "<<edgeIndexInFace<<" dans la face"<<std::endl;
-#endif
-        BRepAdaptor_Curve curve_adaptor(edgeInFace);
-        double firstInFace = curve_adaptor.FirstParameter();
-        double lastInFace  = curve_adaptor.LastParameter();
-        BRepAdaptor_Curve curve_adaptor2(tedge);
-        double firstInM3D = curve_adaptor2.FirstParameter();
-        double lastInM3D  = curve_adaptor2.LastParameter();
-        bool mustReparamCurve= false;
-        if(firstInFace!=firstInM3D)
-            mustReparamCurve = true;
-
-#ifdef _DEBUG_MESH
-        std::cout<<"\t edge in OCC face -> ("<<firstInFace<<", "<<lastInFace<<")"<<std::endl;
-        std::cout<<"\t edge in M3D model-> ("<<firstInM3D<<", "<<lastInM3D<<")"<<std::endl;
-        std::cout<<"*************************************************"<<std::endl;
-#endif
-        // recherche de la gedge dans le model
-        GEdge* gedge = model->getOCCInternals()->getOCCEdgeByNativePtr(model, tedge);
-
-        if (gedge == 0){
-            // recherche avec notre propre identification de la bonne gedge
-
-            for (GModel::eiter iter = model->firstEdge(); iter != model->lastEdge(); ++iter){
-                GEdge* loc_gedge = *iter;
+        GMSHFaceRequest::Edge edge_request;
+        edge_request.m_name = edge->getName();
+        edge_request.m_curve_name = curve->getName();
+        edge_request.m_index_in_face = edgeIndexInFace;
 
-                OCCEdge* loc_occedge = dynamic_cast<OCCEdge*>(loc_gedge);
-                if (loc_occedge == 0){
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Erreur interne, conversion en  OCCEdge impossible !";
-                    throw TkUtil::Exception (message);
-                }
-
-                TopoDS_Edge loc_tedge = loc_occedge->getTopoDS_Edge();
-
-                if (Geom::OCCGeomRepresentation::areEquals(loc_tedge, tedge))
-                    gedge = loc_gedge;
-            }
+        std::vector<gmds::Node> edge_nodes;
+        edge->getNodes(v_edge[0], v_edge[1], edge_nodes);
+        edge_request.m_node_ids.reserve(edge_nodes.size());
+        edge_request.m_node_coords.reserve(edge_nodes.size());
+        for (uint j=0; j<edge_nodes.size(); j++){
+            edge_request.m_node_ids.push_back(edge_nodes[j].getID());
+            edge_request.m_node_coords.push_back(getCoordNode(edge_nodes[j]));
         }
 
-        if (gedge == 0){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message << "Pb avec arête "
-                    << edge->getName()
-                    << ", on ne trouve pas de GEdge pour courbe "
-                    <<curve->getName();
-            throw TkUtil::Exception (message);
+        for (uint j=0; j<2; j++){
+            edge_request.m_vertex_coords[j] = v_edge[j]->getCoord();
+            edge_request.m_vertex_precision[j] = Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon;
+            if (v_edge[j]->getGeomAssociation())
+                edge_request.m_vertex_precision[j] =
+                        v_edge[j]->getGeomAssociation()->getComputationalProperty()->getPrecision();
         }
-        else {
-#ifdef _DEBUG_MESH
-            std::cout <<"    gedge trouvé... tag "<<gedge->tag()<<std::endl;
-#endif
-
-            // association entre GMSH::GVertex et GMDS::Node
-            GVertex *gv1 = gedge->getBeginVertex();
-            uint ind1 = _addGMDSVertex2GVertex(edge, gv1, cor_gmdsNode_gmshVertex, cor_gmshVertex_gmdsNode);
-            if (!gedge->periodic(0)){
-                GVertex *gv2 = gedge->getEndVertex();
-                _addGMDSVertex2GVertex(edge, gv2, cor_gmdsNode_gmshVertex, cor_gmshVertex_gmdsNode);
-            }
-            else {
-#ifdef _DEBUG_MESH
-                std::cout <<"  gedge périodique"<<std::endl;
-#endif
-            }
-            std::vector<MVertex*> &mesh_vertices = gedge->mesh_vertices ;
-            std::vector<MLine*> &lines = gedge->lines ;
-
-            std::vector<gmds::Node> edge_nodes;
-            if (ind1 == 0)
-                edge->getNodes(v_edge[0], v_edge[1], edge_nodes);
-            else{
-                edge->getNodes(v_edge[1], v_edge[0], edge_nodes);
-
-            }
-
-#ifdef _DEBUG_MESH
-            std::cout <<"    nombre de noeuds: "<<edge_nodes.size()<<std::endl;
-            std::cout <<"    gedge->getBeginVertex() en "
-                    <<gedge->getBeginVertex()->x()<<", "
-                    <<gedge->getBeginVertex()->y()<<", "
-                    <<gedge->getBeginVertex()->z()<<std::endl;
-            std::cout <<"    gedge->getEndVertex() en "
-                    <<gedge->getEndVertex()->x()<<", "
-                    <<gedge->getEndVertex()->y()<<", "
-                    <<gedge->getEndVertex()->z()<<std::endl;
-            std::cout <<"    v_edge[0] en "
-                    <<v_edge[0]->getX()<<", "
-                    <<v_edge[0]->getY()<<", "
-                    <<v_edge[0]->getZ()<<std::endl;
-            std::cout <<"    v_edge[1] en "
-                    <<v_edge[1]->getX()<<", "
-                    <<v_edge[1]->getY()<<", "
-                    <<v_edge[1]->getZ()<<std::endl;
-#endif
-
-
-            for (uint j=1; j<edge_nodes.size()-1; j++){
-                //MVertex* mvtx = cor_gmdsNode_gmshVertex[edge_nodes[j]];
-                //if (mvtx == 0){
-                gmds::Node nd = edge_nodes[j];
-
-                    Utils::Math::Point pt = getCoordNode(nd);
-
-                    double param = 0.0;
-//                    if(mustReparamCurve){
-                        // on doit utiliser une paramétrisation
-                        // propre à la courbe locale à la face et non au
-                        // modèle M3D
-                        Geom::OCCGeomRepresentation::getParameterOnTopoDSEdge(
-                                edgeInFace, pt,param);
-//                    }
-//                    else
-//                        crv_occ_rep->getParameter(pt, param, curve);
-
-                    MVertex* mvtx = new MEdgeVertex(pt.getX(), pt.getY(),pt.getZ(), gedge, param);
 
-                    cor_gmdsNode_gmshVertex[nd.getID()] = mvtx;
-                    cor_gmshVertex_gmdsNode[mvtx] = nd.getID();
-
-                    mesh_vertices.push_back(mvtx);
-                //}
-            }
-
-            for (uint j=0; j<edge_nodes.size()-1; j++){
-                MVertex* mvtx1 = cor_gmdsNode_gmshVertex[edge_nodes[j].getID()];
-                MVertex* mvtx2 = cor_gmdsNode_gmshVertex[edge_nodes[j+1].getID()];
-                lines.push_back(new MLine(mvtx1, mvtx2));
-            }
-#ifdef _DEBUG_MESH
-            gedge->meshStatistics.status = GEdge::DONE;
-            std::cout<<"========================================="<<std::endl;
-            std::cout<<"========================================="<<std::endl;
-            for(unsigned int k=0; k<lines.size();k++){
-                MLine* l = lines[k];
-                MVertex * v0 = l->getVertex(0);
-                MVertex * v1 = l->getVertex(1);
-                std::cout<<"Edge "<<k<<": "<<v0->getNum()<<", "<<v1->getNum()<<" de "
-                        <<"("<<v0->x()<<", "<<v0->y()<<", "<<v0->z()<<")"
-                        <<"("<<v1->x()<<", "<<v1->y()<<", "<<v1->z()<<") - ";
-
-                if(dynamic_cast<MEdgeVertex*>(v0)!=0){
-                    double p;
-                    dynamic_cast<MEdgeVertex*>(v0)->getParameter(0,p);
-                    std::cout<<"curve param 0 :"<<p<<" - ";
-                }
-
-                if(dynamic_cast<MEdgeVertex*>(v1)!=0){
-                    double p;
-                    dynamic_cast<MEdgeVertex*>(v1)->getParameter(0,p);
-                    std::cout<<"curve param 1 :"<<p;
-                }
-
-                std::cout<<std::endl;
-            }
-            std::cout<<"========================================="<<std::endl;
-            std::cout<<"========================================="<<std::endl;
-#endif
-        }
+        request.m_edges.push_back(edge_request);
     } // end for(unsigned int i=0;i<edges.size();i++)
 
+} // end _prepareDelaunayGMSH
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::_addFaceTriangulation(Mesh::CommandCreateMesh* command,
+        Topo::CoFace* fa, const FaceTriangulation& triangulation)
+{
+    gmds::IGMesh& gmds_mesh = getGMDSMesh();
 
-    // appel à GMSH pour mailler la surface
-    for(GModel::fiter it = model->firstFace(); it != model->lastFace(); ++it)
-    {
-        if (have_periodic_edge){
-#ifdef _DEBUG_MESH
-            std::cout<<"appel à meshGeneratorPeriodic"<<std::endl;
-#endif
-            meshGeneratorPeriodic(*it, // la GFace
-                    false); // debug
-        }
-        else {
-#ifdef _DEBUG_MESH
-            std::cout<<"appel à meshGenerator"<<std::endl;
-#endif
-            meshGenerator(*it, // la GFace
-                    0,     // RECUR_ITER
-                    false, // repairSelfIntersecting1dMesh
-                    false, // onlyInitialMesh
-                    false, // debug
-                    0);    // replacement_edges (list)
-        }
+    std::vector<gmds::TCellID>& fa_node_ids = fa->nodes();
+    std::vector<gmds::TCellID>& fa_face_ids = fa->faces();
+
+    // création des noeuds, dans l'ordre de leur première apparition
+    std::vector<gmds::TCellID> new_node_ids(triangulation.m_points.size());
+    for (size_t i=0; i<triangulation.m_points.size(); i++){
+        const Utils::Math::Point& pt = triangulation.m_points[i];
+        gmds::Node nd = gmds_mesh.newNode(pt.getX(), pt.getY(), pt.getZ());
+        new_node_ids[i] = nd.getID();
+        fa_node_ids.push_back(nd.getID());
+        command->addCreatedNode(nd.getID());
+    }
 
-        if (Msg::GetErrorCount()){
-			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message << "GMSH sort en erreur (ErrorCount : "
-                    << (short)Msg::GetErrorCount()
-                    << ") pour la face commune topologique "
-                    << fa->getName();
-            throw TkUtil::Exception (message);
+    // création des triangles
+    for (size_t i=0; i+2<triangulation.m_triangles.size(); i+=3){
+        gmds::TCellID n[3];
+        for (uint j=0; j<3; j++){
+            long code = triangulation.m_triangles[i+j];
+            if (FaceTriangulation::isExistingNode(code))
+                n[j] = (gmds::TCellID)code;
+            else
+                n[j] = new_node_ids[FaceTriangulation::newPointIndex(code)];
         }
-
-        // récupération du maillage pour le passer de gmsh à gmds
-        std::vector<MTriangle*>& triangles = (*it)->triangles;
-
-#ifdef _DEBUG_MESH
-        std::cout<<"###################################################"<<std::endl;
-        std::cout<<"###################################################"<<std::endl;
-        std::cout<<"triangles.size() = "<<triangles.size()<<std::endl;
-#endif
-        std::vector<gmds::TCellID>& fa_node_ids = fa->nodes();
-        std::vector<gmds::TCellID>& fa_face_ids = fa->faces();
-        for (uint i=0; i<triangles.size(); i++){
-            MTriangle* tri = triangles[i];
-            for (uint j=0; j<3; j++){
-                MVertex* mvtx = tri->getVertex(j);
 #ifdef _DEBUG_MESH
-              std::cout<<"Creation of ("<<mvtx->x()<<", "<<mvtx->y()<<", "<<mvtx->z()<<")"<<std::endl;
-#endif
-                gmds::Node nd;
-
-                if(cor_gmshVertex_gmdsNode.find(mvtx)==cor_gmshVertex_gmdsNode.end())
-                {
-                    nd = getGMDSMesh().newNode(mvtx->x(), mvtx->y(), mvtx->z());
-                    fa_node_ids.push_back(nd.getID());
-                    command->addCreatedNode(nd.getID());
-                    cor_gmshVertex_gmdsNode[mvtx] = nd.getID();
-                }
-                else
-                    nd = gmds_mesh.get<gmds::Node>(cor_gmshVertex_gmdsNode[mvtx]);
-            }
-            gmds::TCellID n1 = cor_gmshVertex_gmdsNode[tri->getVertex(0)];
-            gmds::TCellID n2 = cor_gmshVertex_gmdsNode[tri->getVertex(1)];
-            gmds::TCellID n3 = cor_gmshVertex_gmdsNode[tri->getVertex(2)];
-#ifdef _DEBUG_MESH
-            std::cout<<" triangle: "<<std::endl;
-            gmds::Node node1 = gmds_mesh.get<gmds::Node>(n1);
-            gmds::Node node2 = gmds_mesh.get<gmds::Node>(n2);
-            gmds::Node node3 = gmds_mesh.get<gmds::Node>(n3);
-            std::cout<<"  node 1 : "<<node1.X()<<", "<<node1.Y()<<", "<<node1.Z()<<std::endl;
-            std::cout<<"  node 2 : "<<node2.X()<<", "<<node2.Y()<<", "<<node2.Z()<<std::endl;
-            std::cout<<"  node 3 : "<<node3.X()<<", "<<node3.Y()<<", "<<node3.Z()<<std::endl;
-#endif
-
-            gmds::Face t1 = getGMDSMesh().newTriangle(n1,n2,n3);
-            fa_face_ids.push_back(t1.getID());
-            command->addCreatedFace(t1.getID());
+        std::cout<<" triangle: "<<std::endl;
+        for (uint j=0; j<3; j++){
+            gmds::Node node = gmds_mesh.get<gmds::Node>(n[j]);
+            std::cout<<"  node "<<j+1<<" : "<<node.X()<<", "<<node.Y()<<", "<<node.Z()<<std::endl;
         }
+#endif
+        gmds::Face t1 = gmds_mesh.newTriangle(n[0],n[1],n[2]);
+        fa_face_ids.push_back(t1.getID());
+        command->addCreatedFace(t1.getID());
     }
 
-    // nettoyage mémoire de ce qui a servi à GMSH
-    delete model;
-
-
     std::vector<std::string> groupsName;
     fa->getGroupsName(groupsName);
 
@@ -472,7 +326,7 @@ void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo
   //  writeMli("/tmp/brieree/toto.mli");
 #endif
 
-} // end meshDelaunayGMSH
+} // end _addFaceTriangulation
 /*----------------------------------------------------------------------------*/
 uint MeshImplementation::_addGMDSVertex2GVertex(Topo::Edge* edge,
         GVertex* gv1,
@@ -25,6 +25,8 @@
 #include "Topo/BlockMeshingPropertyDirectional.h"
 #include "Topo/BlockMeshingPropertyOrthogonal.h"
 #include "Topo/TopoHelper.h"
+#include "Topo/TopoManager.h"
+#include "Mesh/StructuredBlockMesh.h"
 
 #include "Utils/Common.h"
 #include "Utils/MgxNumeric.h"
@@ -99,20 +101,22 @@ void MeshImplementation::preMeshStrutured(Topo::Block* bl)
     TkUtil::Timer timer(true);
 #endif
 
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 <<"Maillage du bloc structuré "<<bl->getName()<<" avec la méthode "
-            << bl->getMeshLawName();
-    if (bl->getMeshLaw() == Topo::BlockMeshingProperty::rotational
-            || bl->getMeshLaw() == Topo::BlockMeshingProperty::directional
-			|| bl->getMeshLaw() == Topo::BlockMeshingProperty::orthogonal)
-        message1 << " et direction "<<(short)bl->getBlockMeshingProperty()->getDir();
-    std::vector<std::string> groupsName;
-    bl->getGroupsName(groupsName);
-    message1 << "\n GroupsName :";
-    for (uint i=0; i<groupsName.size(); i++)
-    	message1 << " "<<groupsName[i];
-    message1 << "\n";
-    getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5, __FILE__, __LINE__));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 <<"Maillage du bloc structuré "<<bl->getName()<<" avec la méthode "
+                << bl->getMeshLawName();
+        if (bl->getMeshLaw() == Topo::BlockMeshingProperty::rotational
+                || bl->getMeshLaw() == Topo::BlockMeshingProperty::directional
+				|| bl->getMeshLaw() == Topo::BlockMeshingProperty::orthogonal)
+            message1 << " et direction "<<(short)bl->getBlockMeshingProperty()->getDir();
+        std::vector<std::string> groupsName;
+        bl->getGroupsName(groupsName);
+        message1 << "\n GroupsName :";
+        for (uint i=0; i<groupsName.size(); i++)
+        	message1 << " "<<groupsName[i];
+        message1 << "\n";
+        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5, __FILE__, __LINE__));
+    }
 
     // Cas structuré, Transfini
 
@@ -498,18 +502,35 @@ void MeshImplementation::meshStrutured(Mesh::CommandCreateMesh* command, Topo::B
     const uint nbNoeudsJ = nbBrasJ + 1;
     const uint nbNoeudsK = nbBrasK + 1;
 
-    for (uint i=1; i<nbBrasI; i++)
-        for (uint j=1; j<nbBrasJ; j++)
-            for (uint k=1; k<nbBrasK; k++) {
-                Utils::Math::Point &pt = bl->points()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ];
-                gmds::Node nd = getGMDSMesh().newNode(pt.getX(), pt.getY(), pt.getZ());
-                bl->nodes()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ] = nd.getID();
-                command->addCreatedNode(nd.getID());
-            }
+    Topo::BlockMeshingData* md = bl->getMeshingData();
+    if (bl->getNbVertices() == 8){
+        // le maillage est conservé sous forme IJK, les noeuds intérieurs
+        // et les hexaèdres gmds ne seront créés qu'à la demande
+        StructuredBlockMesh* sbm = new StructuredBlockMesh(nbNoeudsI, nbNoeudsJ, nbNoeudsK);
+        const Utils::Math::Point* l_points = bl->points();
+        const size_t nbNoeuds = sbm->getNbNodes();
+        for (size_t n=0; n<nbNoeuds; n++)
+            sbm->setPoint(n, l_points[n]);
+        for (uint i=1; i<nbBrasI; i++)
+            for (uint j=1; j<nbBrasJ; j++)
+                for (uint k=1; k<nbBrasK; k++)
+                    md->nodes()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ] = gmds::NullID;
+        md->structuredMesh() = sbm;
+        md->setBuiltOnDemand(true);
+    }
+    else
+        for (uint i=1; i<nbBrasI; i++)
+            for (uint j=1; j<nbBrasJ; j++)
+                for (uint k=1; k<nbBrasK; k++) {
+                    Utils::Math::Point &pt = bl->points()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ];
+                    gmds::Node nd = getGMDSMesh().newNode(pt.getX(), pt.getY(), pt.getZ());
+                    md->nodes()[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ] = nd.getID();
+                    command->addCreatedNode(nd.getID());
+                }
 
     delete [] bl->points();
     bl->points() = 0;
-    bl->getMeshingData()->setPreMeshed(false);
+    md->setPreMeshed(false);
 
 #ifdef _DEBUG_TIMER
     timer.stop();
@@ -562,10 +583,12 @@ void MeshImplementation::preMeshStrutured(Topo::CoFace* coface)
     TkUtil::Timer timer(true);
 #endif
 
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 <<"Maillage de la face structurée "<<coface->getName()<<" avec la méthode "
-            << coface->getMeshLawName();
-    getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5, __FILE__, __LINE__));
+    if (getContext().isLogEnabled (TkUtil::Log::TRACE_5)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 <<"Maillage de la face structurée "<<coface->getName()<<" avec la méthode "
+                << coface->getMeshLawName();
+        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_5, __FILE__, __LINE__));
+    }
 
 
     // Cas structuré
@@ -1848,6 +1871,16 @@ void MeshImplementation::_setToVal(Utils::Math::Point* uij, uint indCoord, uint
             uij[ii+nbNoeudsI*jj].setCoord(indCoord,val);
 }
 /*----------------------------------------------------------------------------*/
+/// coordonnées du noeud d'indice donné d'un bloc, prises dans sa forme IJK s'il en a une
+static Qualif::Vecteur _getVecteur(gmds::IGMesh& gmds_mesh, const std::vector<gmds::TCellID>& nodes,
+        const StructuredBlockMesh* sbm, size_t index)
+{
+    if (sbm)
+        return Qualif::Vecteur(sbm->x()[index], sbm->y()[index], sbm->z()[index]);
+    gmds::Node nd = gmds_mesh.get<gmds::Node>(nodes[index]);
+    return Qualif::Vecteur(nd.X(), nd.Y(), nd.Z());
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command, Topo::Block* bl,
         uint nbBrasI, uint nbBrasJ, uint nbBrasK)
 //#define _DEBUG2
@@ -1871,10 +1904,13 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
     const uint nbNoeudsJ = nbBrasJ + 1;
     const uint nbNoeudsK = nbBrasK + 1;
 
-    std::vector<gmds::TCellID>& nodes = bl->nodes();
-    std::vector<gmds::TCellID>& elem = bl->regions();
+    // accès direct, sans création des noeuds d'un maillage conservé sous forme IJK
+    std::vector<gmds::TCellID>& nodes = bl->getMeshingData()->nodes();
+    std::vector<gmds::TCellID>& elem = bl->getMeshingData()->regions();
+    StructuredBlockMesh* sbm = bl->getMeshingData()->structuredMesh();
 
 #define nodeIJ(ii,jj,kk) nodes[ii+(jj)*nbNoeudsI+(kk)*nbNoeudsI*nbNoeudsJ]
+#define vecteurIJ(ii,jj,kk) _getVecteur(gmds_mesh, nodes, sbm, ii+(jj)*nbNoeudsI+(kk)*nbNoeudsI*nbNoeudsJ)
 
     uint iBegin = 0, iEnd = nbBrasI;
     uint jBegin = 0, jEnd = nbBrasJ;
@@ -1915,24 +1951,24 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
                 		areRegionsTested = true;
 
                 		nbTests++;
-                        gmds::Node nd1 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k));
-                        gmds::Node nd2 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k));
-                        gmds::Node nd3 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k));
-                        gmds::Node nd4 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k));
-                        gmds::Node nd5 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k+1));
-                        gmds::Node nd6 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k+1));
-                        gmds::Node nd7 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k+1));
-                        gmds::Node nd8 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k+1));
+                        const Qualif::Vecteur v1 = vecteurIJ(i,j,k);
+                        const Qualif::Vecteur v2 = vecteurIJ(i+1,j,k);
+                        const Qualif::Vecteur v3 = vecteurIJ(i+1,j+1,k);
+                        const Qualif::Vecteur v4 = vecteurIJ(i,j+1,k);
+                        const Qualif::Vecteur v5 = vecteurIJ(i,j,k+1);
+                        const Qualif::Vecteur v6 = vecteurIJ(i+1,j,k+1);
+                        const Qualif::Vecteur v7 = vecteurIJ(i+1,j+1,k+1);
+                        const Qualif::Vecteur v8 = vecteurIJ(i,j+1,k+1);
 
                     	Qualif::Vecteur *sommets = new Qualif::Vecteur[8];
-                    	sommets[0] = Qualif::Vecteur(nd1.X(), nd1.Y(), nd1.Z());
-                    	sommets[1] = Qualif::Vecteur(nd2.X(), nd2.Y(), nd2.Z());
-                    	sommets[2] = Qualif::Vecteur(nd3.X(), nd3.Y(), nd3.Z());
-                    	sommets[3] = Qualif::Vecteur(nd4.X(), nd4.Y(), nd4.Z());
-                    	sommets[4] = Qualif::Vecteur(nd5.X(), nd5.Y(), nd5.Z());
-                    	sommets[5] = Qualif::Vecteur(nd6.X(), nd6.Y(), nd6.Z());
-                    	sommets[6] = Qualif::Vecteur(nd7.X(), nd7.Y(), nd7.Z());
-                    	sommets[7] = Qualif::Vecteur(nd8.X(), nd8.Y(), nd8.Z());
+                    	sommets[0] = v1;
+                    	sommets[1] = v2;
+                    	sommets[2] = v3;
+                    	sommets[3] = v4;
+                    	sommets[4] = v5;
+                    	sommets[5] = v6;
+                    	sommets[6] = v7;
+                    	sommets[7] = v8;
 
                     	maille_tmp->Init_Sommets(sommets);
                     	double crit = maille_tmp->AppliqueCritere((Qualif::VALIDITY));
@@ -1946,14 +1982,14 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
                     		// on teste la maille inversée
                     		nbTestsInv++;
 
-                        	sommets[4] = Qualif::Vecteur(nd1.X(), nd1.Y(), nd1.Z());
-                        	sommets[5] = Qualif::Vecteur(nd2.X(), nd2.Y(), nd2.Z());
-                        	sommets[6] = Qualif::Vecteur(nd3.X(), nd3.Y(), nd3.Z());
-                        	sommets[7] = Qualif::Vecteur(nd4.X(), nd4.Y(), nd4.Z());
-                        	sommets[0] = Qualif::Vecteur(nd5.X(), nd5.Y(), nd5.Z());
-                        	sommets[1] = Qualif::Vecteur(nd6.X(), nd6.Y(), nd6.Z());
-                        	sommets[2] = Qualif::Vecteur(nd7.X(), nd7.Y(), nd7.Z());
-                        	sommets[3] = Qualif::Vecteur(nd8.X(), nd8.Y(), nd8.Z());
+                        	sommets[4] = v1;
+                        	sommets[5] = v2;
+                        	sommets[6] = v3;
+                        	sommets[7] = v4;
+                        	sommets[0] = v5;
+                        	sommets[1] = v6;
+                        	sommets[2] = v7;
+                        	sommets[3] = v8;
                         	maille_tmp->Init_Sommets(sommets);
                         	double crit = maille_tmp->AppliqueCritere((Qualif::VALIDITY));
 #ifdef _DEBUG2
@@ -1994,32 +2030,11 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
         delete maille_tmp;
     }
 
-    // les hexaèdres
-    for (uint k=kBegin; k<kEnd; k++) {
-        for (uint j=jBegin; j<jEnd; j++) {
-            for (uint i=iBegin; i<iEnd; i++) {
-                gmds::Node nd1 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k));
-                gmds::Node nd2 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k));
-                gmds::Node nd3 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k));
-                gmds::Node nd4 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k));
-                gmds::Node nd5 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k+1));
-                gmds::Node nd6 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k+1));
-                gmds::Node nd7 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k+1));
-                gmds::Node nd8 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k+1));
-
-                gmds::Region r = gmds::Region();
-
-                if(!areRegionsInverted) {
-                	r = getGMDSMesh().newHex(nd1,nd2,nd3,nd4,nd5,nd6,nd7,nd8);
-                } else {
-                	r = getGMDSMesh().newHex(nd5,nd6,nd7,nd8,nd1,nd2,nd3,nd4);
-                }
-                elem.push_back(r.getID());
-                command->addCreatedRegion(r.getID());
-
-            } // for (uint i=iBegin; i<iEnd; i++) {
-        } // for (uint j=jBegin; j<jEnd; j++) {
-    } // for (uint k=kBegin; k<kEnd; k++) {
+    // les hexaèdres, créés à la demande pour un maillage conservé sous forme IJK
+    if (sbm)
+        sbm->setInverted(areRegionsInverted);
+    else
+        _addHexahedra(command, nodes, elem, nbBrasI, nbBrasJ, kEnd, areRegionsInverted);
 
     // s'il y a une dégénérescence, on traite ici la création d'une couche de mailles
     if (bl->getNbVertices() != 8){  // K MAX
@@ -2215,6 +2230,7 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
 	} // if (bl->getNbVertices() != 8){  // K MAX
 
 #undef nodeIJ
+#undef vecteurIJ
 
     // ajout des polyedres aux volumes
     for (size_t i=0; i<groupsName.size(); i++){
@@ -2248,6 +2264,113 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
 } // end _addRegionsInVolumes
 #undef _DEBUG2
 /*----------------------------------------------------------------------------*/
+void MeshImplementation::_addHexahedra(Mesh::CommandCreateMesh* command,
+        std::vector<gmds::TCellID>& nodes, std::vector<gmds::TCellID>& elem,
+        uint nbBrasI, uint nbBrasJ, uint kEnd, bool inverted)
+{
+    const uint nbNoeudsI = nbBrasI + 1;
+    const uint nbNoeudsJ = nbBrasJ + 1;
+    gmds::IGMesh& gmds_mesh = getGMDSMesh();
+
+#define nodeIJ(ii,jj,kk) nodes[ii+(jj)*nbNoeudsI+(kk)*nbNoeudsI*nbNoeudsJ]
+    for (uint k=0; k<kEnd; k++) {
+        for (uint j=0; j<nbBrasJ; j++) {
+            for (uint i=0; i<nbBrasI; i++) {
+                gmds::Node nd1 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k));
+                gmds::Node nd2 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k));
+                gmds::Node nd3 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k));
+                gmds::Node nd4 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k));
+                gmds::Node nd5 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j,k+1));
+                gmds::Node nd6 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j,k+1));
+                gmds::Node nd7 = gmds_mesh.get<gmds::Node>(nodeIJ(i+1,j+1,k+1));
+                gmds::Node nd8 = gmds_mesh.get<gmds::Node>(nodeIJ(i,j+1,k+1));
+
+                gmds::Region r = gmds::Region();
+
+                if(!inverted) {
+                	r = gmds_mesh.newHex(nd1,nd2,nd3,nd4,nd5,nd6,nd7,nd8);
+                } else {
+                	r = gmds_mesh.newHex(nd5,nd6,nd7,nd8,nd1,nd2,nd3,nd4);
+                }
+                elem.push_back(r.getID());
+                if (command)
+                    command->addCreatedRegion(r.getID());
+
+            } // for (uint i=0; i<nbBrasI; i++) {
+        } // for (uint j=0; j<nbBrasJ; j++) {
+    } // for (uint k=0; k<kEnd; k++) {
+#undef nodeIJ
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::buildStructuredMesh(Topo::Block* bl)
+{
+    Topo::BlockMeshingData* md = bl->getMeshingData();
+    StructuredBlockMesh* sbm = md->structuredMesh();
+    if (0 == sbm)
+        return;
+
+    const uint nbNoeudsI = sbm->ni();
+    const uint nbNoeudsJ = sbm->nj();
+    const uint nbNoeudsK = sbm->nk();
+    std::vector<gmds::TCellID>& nodes = md->nodes();
+
+    // les noeuds de la peau sont ceux des faces communes, déjà dans gmds
+    for (uint k=1; k+1<nbNoeudsK; k++)
+        for (uint j=1; j+1<nbNoeudsJ; j++)
+            for (uint i=1; i+1<nbNoeudsI; i++) {
+                const size_t n = sbm->nodeIndex(i, j, k);
+                gmds::Node nd = getGMDSMesh().newNode(sbm->x()[n], sbm->y()[n], sbm->z()[n]);
+                nodes[n] = nd.getID();
+            }
+
+    _addHexahedra(0, nodes, md->regions(), nbNoeudsI-1, nbNoeudsJ-1, nbNoeudsK-1, sbm->isInverted());
+
+    delete sbm;
+    md->structuredMesh() = 0;
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::buildStructuredMeshes()
+{
+    std::vector<Topo::Block*> blocks;
+    getContext().getLocalTopoManager().getBlocks(blocks);
+    for (uint i=0; i<blocks.size(); i++)
+        buildStructuredMesh(blocks[i]);
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::deleteStructuredMesh(Topo::Block* bl)
+{
+    Topo::BlockMeshingData* md = bl->getMeshingData();
+    if (!md->isBuiltOnDemand())
+        return;
+
+    if (0 != md->structuredMesh()){
+        delete md->structuredMesh();
+        md->structuredMesh() = 0;
+    }
+    else {
+        std::vector<gmds::TCellID>& regions = md->regions();
+        for (uint i=0; i<regions.size(); i++)
+            getGMDSMesh().deleteRegion(regions[i]);
+        regions.clear();
+
+        uint nbBrasI, nbBrasJ, nbBrasK;
+        bl->getNbMeshingEdges(nbBrasI, nbBrasJ, nbBrasK);
+        const uint nbNoeudsI = nbBrasI + 1;
+        const uint nbNoeudsJ = nbBrasJ + 1;
+        std::vector<gmds::TCellID>& nodes = md->nodes();
+        if (nodes.size() == (size_t)nbNoeudsI*nbNoeudsJ*(nbBrasK+1))
+        for (uint k=1; k<nbBrasK; k++)
+            for (uint j=1; j<nbBrasJ; j++)
+                for (uint i=1; i<nbBrasI; i++) {
+                    gmds::TCellID& id = nodes[i+nbNoeudsI*j+k*nbNoeudsI*nbNoeudsJ];
+                    if (gmds::NullID != id)
+                        getGMDSMesh().deleteNode(id);
+                    id = gmds::NullID;
+                }
+    }
+    md->setBuiltOnDemand(false);
+}
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::_addFacesInSurfaces(Mesh::CommandCreateMesh* command, Topo::CoFace* fa)
 {
     std::vector<std::string> groupsName;
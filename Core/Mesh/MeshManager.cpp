@@ -8,11 +8,13 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Internal/ContextIfc.h"
+#include "Utils/Common.h"
 #include "Utils/CommandManager.h"
 #include "Mesh/MeshManager.h"
 #include "Mesh/MeshImplementation.h"
 #include "Mesh/CommandNewBlocksMesh.h"
 #include "Mesh/CommandNewFacesMesh.h"
+#include "Mesh/CommandUpdateMesh.h"
 #include "Mesh/Compare2Meshes.h"
 #include "Mesh/CommandMeshExplorer.h"
 #include "Mesh/CommandReadMLI.h"
@@ -21,7 +23,14 @@
 #include "Mesh/CommandWriteCGNS.h"
 #include "Mesh/CommandModifyMesh.h"
 #include "Mesh/SubVolume.h"
+#include "Mesh/Surface.h"
+#include "Mesh/Volume.h"
+#include "Mesh/MeshQualityKernel.h"
 #include "Topo/Block.h"
+#include "Topo/CoFace.h"
+#include "Topo/CoEdge.h"
+#include "Topo/Vertex.h"
+#include "Topo/TopoManager.h"
 #include "Internal/M3DCommandResult.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -257,9 +266,7 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newBlocksMesh(std::vector<std
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newBlocksMesh(std::vector<Mgx3D::Topo::Block*>& blocks)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newBlocksMesh( liste de "<<blocks.size()<<" blocs )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newBlocksMesh( liste de "<<blocks.size()<<" blocs )");
 
     Mesh::CommandNewBlocksMesh* command = new Mesh::CommandNewBlocksMesh(getLocalContext(), blocks, 0);
 
@@ -290,9 +297,7 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newFacesMesh(std::vector<std:
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newFacesMesh(std::vector<Mgx3D::Topo::CoFace*>& faces)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newFacesMesh( liste de "<<faces.size()<<" faces )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newFacesMesh( liste de "<<faces.size()<<" faces )");
 
     Mesh::CommandNewFacesMesh* command = new Mesh::CommandNewFacesMesh(getLocalContext(), faces, 0);
 
@@ -315,9 +320,7 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newFacesMesh(std::vector<Mgx3
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newAllBlocksMesh()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newAllBlocksMesh()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newAllBlocksMesh()");
 
     Mesh::CommandNewBlocksMesh* command = new Mesh::CommandNewBlocksMesh(getLocalContext(),0);
 
@@ -334,9 +337,7 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newAllBlocksMesh()
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newAllFacesMesh()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newAllFacesMesh()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newAllFacesMesh()");
 
     Mesh::CommandNewFacesMesh* command = new Mesh::CommandNewFacesMesh(getLocalContext(),0);
 
@@ -351,6 +352,23 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManager::newAllFacesMesh()
     return cmdResult;
 }
 /*----------------------------------------------------------------------------*/
+Mgx3D::Internal::M3DCommandResultIfc* MeshManager::updateMesh()
+{
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::updateMesh()");
+
+    Mesh::CommandUpdateMesh* command = new Mesh::CommandUpdateMesh(getLocalContext(),0);
+
+    TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
+    cmd << getContextAlias() << "." << "getMeshManager().updateMesh()";
+    command->setScriptCommand(cmd);
+
+    getCommandManager().addCommand(command, Utils::Command::DO);
+
+    Internal::M3DCommandResultIfc*  cmdResult   =
+    		new Internal::M3DCommandResult (*command);
+    return cmdResult;
+}
+/*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc*
 MeshManager::newSubVolumeBetweenSheets(std::vector<std::string>& blocks_name, std::string narete,
 		int pos1, int pos2, std::string groupName)
@@ -368,9 +386,7 @@ Mgx3D::Internal::M3DCommandResultIfc*
 MeshManager::newSubVolumeBetweenSheets(std::vector<Mgx3D::Topo::Block*>& blocks, Topo::CoEdge* coedge,
 		int pos1, int pos2, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newSubVolumeBetweenSheets( liste de "<<blocks.size()<<" blocs )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newSubVolumeBetweenSheets( liste de "<<blocks.size()<<" blocs )");
 
     Mesh::CommandCreateSubVolumeBetweenSheets* command =
     		new Mesh::CommandCreateSubVolumeBetweenSheets(getLocalContext(), blocks, coedge, pos1, pos2, groupName);
@@ -465,6 +481,8 @@ bool MeshManager::compareWithMesh(std::string nom)
 {
     bool ok = true;
     MeshImplementation* mesh = (MeshImplementation*)m_mesh_itf;
+    // la comparaison porte sur tout le maillage gmds
+    mesh->buildStructuredMeshes();
     gmds::IGMesh& gmdsMesh1 = mesh->getGMDSMesh();
 
     uint id = mesh->createNewGMDSMesh();
@@ -537,6 +555,133 @@ std::string MeshManager::getInfos(const Volume* me) const
             return std::string("Volume non trouvé !");
 }
 /*----------------------------------------------------------------------------*/
+void MeshManager::evaluateQuality(MeshQualityKernel& kernel, const std::string& name, int dim) const
+{
+    std::vector<gmds::TCellID> ids;
+    switch(dim){
+    case(3):{
+        std::vector<gmds::Region> regions;
+        getVolume(name, true)->getGMDSRegions(regions);
+        ids.reserve(regions.size());
+        for (size_t i=0; i<regions.size(); i++)
+            ids.push_back(regions[i].getID());
+        kernel.evaluateRegions(ids);
+    }
+    break;
+    case(2):{
+        std::vector<gmds::Face> faces;
+        getSurface(name, true)->getGMDSFaces(faces);
+        ids.reserve(faces.size());
+        for (size_t i=0; i<faces.size(); i++)
+            ids.push_back(faces[i].getID());
+        kernel.evaluateFaces(ids);
+    }
+    break;
+    default:
+        throw TkUtil::Exception (TkUtil::UTF8String ("dimension non prévue pour MeshManager::evaluateQuality", TkUtil::Charset::UTF_8));
+    }
+}
+/*----------------------------------------------------------------------------*/
+std::vector<double> MeshManager::getQualityStatistics(const std::string& name, int dim, const std::string& criterion) const
+{
+    const MeshQualityKernel::criterion crit = MeshQualityKernel::getCriterion(criterion);
+    MeshQualityKernel kernel(m_mesh_itf->getGMDSMesh(), 0, getContext().allowThreadedCommandTasks.getValue(),
+                             getContext().getMeshQualityPerCell());
+    evaluateQuality(kernel, name, dim);
+
+    const MeshQualityKernel::Statistics& st = kernel.getStatistics(crit);
+    std::vector<double> result;
+    result.push_back((double)st.nbCells);
+    result.push_back(0 == st.nbCells ? 0. : st.min);
+    result.push_back(0 == st.nbCells ? 0. : st.max);
+    result.push_back(st.getMean());
+    result.push_back((double)kernel.getNbInvalid());
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<double> MeshManager::getQualityHistogram(const std::string& name, int dim, const std::string& criterion, int nbClasses) const
+{
+    if (nbClasses <= 0)
+        throw TkUtil::Exception (TkUtil::UTF8String ("Le nombre de classes de l'histogramme doit être strictement positif", TkUtil::Charset::UTF_8));
+    const MeshQualityKernel::criterion crit = MeshQualityKernel::getCriterion(criterion);
+    const bool threaded = getContext().allowThreadedCommandTasks.getValue();
+    const bool perCell = getContext().getMeshQualityPerCell();
+    MeshQualityKernel kernel(m_mesh_itf->getGMDSMesh(), nbClasses, threaded, perCell);
+
+    // le volume n'a pas de domaine a priori, une première passe donne ses extrema
+    if (MeshQualityKernel::VOLUME == crit){
+        MeshQualityKernel bounds(m_mesh_itf->getGMDSMesh(), 0, threaded, perCell);
+        evaluateQuality(bounds, name, dim);
+        const MeshQualityKernel::Statistics& st = bounds.getStatistics(crit);
+        if (0 != st.nbCells)
+            kernel.setDomain(crit, st.min, st.min < st.max ? st.max : st.min + 1.);
+    }
+    evaluateQuality(kernel, name, dim);
+
+    const MeshQualityKernel::Statistics& st = kernel.getStatistics(crit);
+    std::vector<double> result(nbClasses, 0.);
+    for (size_t i=0; i<st.histogram.size(); i++)
+        result[i] = (double)st.histogram[i];
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<double> MeshManager::getTopoNodes(const std::string& name, int dim)
+{
+    Topo::TopoManager& tm = getLocalContext().getLocalTopoManager();
+    bool meshed = false;
+    std::vector<gmds::TCellID> ids;
+    switch(dim){
+    case(0):{
+        Topo::Vertex* vtx = tm.getVertex(name, true);
+        meshed = vtx->isMeshed();
+        if (meshed)
+            ids.push_back(vtx->getNode());
+    }
+    break;
+    case(1):{
+        Topo::CoEdge* coedge = tm.getCoEdge(name, true);
+        meshed = coedge->isMeshed();
+        if (meshed)
+            ids = coedge->nodes();
+    }
+    break;
+    case(2):{
+        Topo::CoFace* coface = tm.getCoFace(name, true);
+        meshed = coface->isMeshed();
+        if (meshed)
+            ids = coface->nodes();
+    }
+    break;
+    case(3):{
+        Topo::Block* bloc = tm.getBlock(name, true);
+        meshed = bloc->isMeshed();
+        if (meshed)
+            ids = bloc->nodes();
+    }
+    break;
+    default:
+        throw TkUtil::Exception (TkUtil::UTF8String ("dimension non prévue pour MeshManager::getTopoNodes", TkUtil::Charset::UTF_8));
+    }
+
+    if (false == meshed){
+        TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "L'entité " << name << " n'est pas maillée";
+        throw TkUtil::Exception (message);
+    }
+
+    gmds::IGMesh& gmds_mesh = m_mesh_itf->getGMDSMesh();
+    std::vector<double> result;
+    result.reserve(4*ids.size());
+    for (size_t i=0; i<ids.size(); i++){
+        const gmds::Node nd = gmds_mesh.get<gmds::Node>(ids[i]);
+        result.push_back((double)ids[i]);
+        result.push_back(nd.X());
+        result.push_back(nd.Y());
+        result.push_back(nd.Z());
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
 int MeshManager::getNbClouds(bool onlyVisible) const
 {
     if (onlyVisible)
@@ -578,9 +723,7 @@ int MeshManager::getNbRegions()
 /*----------------------------------------------------------------------------*/
 CommandMeshExplorer* MeshManager::newExplorer(CommandMeshExplorer* oldExplo, int inc, std::string narete, bool asCommand)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newExplorer()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::newExplorer()");
 
     Mesh::CommandMeshExplorer* command =
             new Mesh::CommandMeshExplorer(
@@ -600,9 +743,7 @@ CommandMeshExplorer* MeshManager::newExplorer(CommandMeshExplorer* oldExplo, int
 /*----------------------------------------------------------------------------*/
 CommandMeshExplorer* MeshManager::endExplorer(CommandMeshExplorer* oldExplo, bool asCommand)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::endExplorer()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_5, "MeshManager::endExplorer()");
 
     Mesh::CommandMeshExplorer* command =
             new Mesh::CommandMeshExplorer(
@@ -123,6 +123,11 @@ Mgx3D::Internal::M3DCommandResultIfc* MeshManagerIfc::newAllFacesMesh()
     throw TkUtil::Exception ("MeshManagerIfc::newAllFacesMesh should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
+Mgx3D::Internal::M3DCommandResultIfc* MeshManagerIfc::updateMesh()
+{
+    throw TkUtil::Exception ("MeshManagerIfc::updateMesh should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc*
 MeshManagerIfc::newSubVolumeBetweenSheets(std::vector<std::string>& blocks_name, std::string narete,
 			int pos1, int pos2, std::string groupName)
@@ -215,6 +220,21 @@ std::string MeshManagerIfc::getInfos(const std::string& name, int dim) const
     throw TkUtil::Exception ("MeshManagerIfc::getInfos should be overloaded.");
 }
 /*----------------------------------------------------------------------------*/
+std::vector<double> MeshManagerIfc::getQualityStatistics(const std::string& name, int dim, const std::string& criterion) const
+{
+    throw TkUtil::Exception ("MeshManagerIfc::getQualityStatistics should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
+std::vector<double> MeshManagerIfc::getQualityHistogram(const std::string& name, int dim, const std::string& criterion, int nbClasses) const
+{
+    throw TkUtil::Exception ("MeshManagerIfc::getQualityHistogram should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
+std::vector<double> MeshManagerIfc::getTopoNodes(const std::string& name, int dim)
+{
+    throw TkUtil::Exception ("MeshManagerIfc::getTopoNodes should be overloaded.");
+}
+/*----------------------------------------------------------------------------*/
 } // end namespace Mesh
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
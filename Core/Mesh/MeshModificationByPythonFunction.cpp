@@ -10,6 +10,8 @@
 // pythonerie à mettre au début (pour permettre ifndef Py_PYTHON_H)
 #include <Python.h>
 #include <memory>				// unique_ptr
+#include <string.h>				// memset, memmove, strcmp
+#include <string>
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshModificationByPythonFunction.h"
 #include "Mesh/MeshImplementation.h"
@@ -30,10 +32,11 @@ namespace Mgx3D {
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
 MeshModificationByPythonFunction::
-MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord)
+MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord, bool batch)
  : MeshModificationItf()
 , m_py_obj(py_obj)
 , m_typeCoord(typeCoord)
+, m_batch(batch)
 {
 
 }
@@ -47,7 +50,7 @@ MeshModificationByPythonFunction::
 void MeshModificationByPythonFunction::
 addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 {
-	PyObject* pyName = PyObject_GetAttrString(m_py_obj, "func_name");
+	PyObject* pyName = PyObject_GetAttrString(m_py_obj, "__name__");
 	std::string strName(PyString_AsString(pyName));
 
 	description->addProperty (
@@ -58,15 +61,30 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 			Utils::SerializedRepresentation::Property (
 					"Type de coordonnées", std::string(m_typeCoord==polar?"polaires":"cartésiennes")));
 
+	description->addProperty (
+			Utils::SerializedRepresentation::Property (
+					"Appel", std::string(m_batch?"par lot":"par noeud")));
+
 }
 /*----------------------------------------------------------------------------*/
 void MeshModificationByPythonFunction::
 applyModification(std::vector<gmds::Node >& gmdsNodes,
-		std::map<gmds::TCellID, uint>& filtre_nodes,
+		const Utils::MarkVector& filtre_nodes,
+		uint maskFixed)
+{
+	if (m_batch)
+		applyModificationByBatch(gmdsNodes, filtre_nodes, maskFixed);
+	else
+		applyModificationByNode(gmdsNodes, filtre_nodes, maskFixed);
+}
+/*----------------------------------------------------------------------------*/
+void MeshModificationByPythonFunction::
+applyModificationByNode(std::vector<gmds::Node >& gmdsNodes,
+		const Utils::MarkVector& filtre_nodes,
 		uint maskFixed)
 {
 #ifdef _DEBUG2
-	std::cout<<"MeshModificationByPythonFunction::applyModification pour "<<gmdsNodes.size()<<" noeuds, maskFixed = "<<maskFixed<<std::endl;
+	std::cout<<"MeshModificationByPythonFunction::applyModificationByNode pour "<<gmdsNodes.size()<<" noeuds, maskFixed = "<<maskFixed<<std::endl;
 	uint nodeCount = 0;
 #endif
 
@@ -154,6 +172,267 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 	std::cout<<"nodeCount = "<<nodeCount<<std::endl;
 #endif
 
+}
+/*----------------------------------------------------------------------------*/
+/// message de l'erreur Python en cours, qui est effacée
+static std::string _pythonError()
+{
+	PyObject *type = 0, *value = 0, *traceback = 0;
+	PyErr_Fetch(&type, &value, &traceback);
+	std::string error;
+	PyObject* str = (0 == value ? 0 : PyObject_Str(value));
+	if (0 != str){
+#if PY_MAJOR_VERSION >= 3
+		const char* utf8 = PyUnicode_AsUTF8(str);
+#else
+		const char* utf8 = PyString_AsString(str);
+#endif	// PY_MAJOR_VERSION >= 3
+		if (0 != utf8)
+			error = utf8;
+		Py_DECREF(str);
+	}
+	PyErr_Clear();
+	Py_XDECREF(type);
+	Py_XDECREF(value);
+	Py_XDECREF(traceback);
+	return error;
+}
+/*----------------------------------------------------------------------------*/
+/// vrai si le format d'un buffer est celui d'un double natif
+static bool _isNativeDouble(const Py_buffer& buffer)
+{
+	if (sizeof(double) != buffer.itemsize)
+		return false;
+	if (0 == buffer.format)	// format implicite 'B' d'un buffer sans format
+		return false;
+	const char* format = buffer.format;
+	const unsigned int one = 1;
+	const bool littleEndian = (1 == *(const unsigned char*)&one);
+	switch (*format){
+		case '@' : case '=' : format++; break;
+		case '<' : if (!littleEndian) return false; format++; break;
+		case '>' : case '!' : if (littleEndian) return false; format++; break;
+	}
+	return 0 == strcmp(format, "d");
+}
+/*----------------------------------------------------------------------------*/
+/** Lecture d'une séquence de N séquences de 3 nombres (listes, tuples ...)
+ *  dans coords. Retourne un message d'erreur, vide en cas de succès */
+static std::string _readSequence(PyObject* R, size_t nbNodes, double* coords)
+{
+	PyObject* rows = PySequence_Fast(R, "séquence attendue");
+	if (0 == rows)
+		return _pythonError();
+	std::string error;
+	if ((Py_ssize_t)nbNodes != PySequence_Fast_GET_SIZE(rows))
+		error = "nombre de lignes différent du nombre de noeuds";
+	for (size_t i=0; i<nbNodes && error.empty(); i++){
+		PyObject* row = PySequence_Fast(PySequence_Fast_GET_ITEM(rows, i), "ligne de 3 coordonnées attendue");
+		if (0 == row){
+			error = _pythonError();
+			break;
+		}
+		if (3 != PySequence_Fast_GET_SIZE(row))
+			error = "ligne de 3 coordonnées attendue";
+		for (int j=0; j<3 && error.empty(); j++){
+			coords[3*i+j] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(row, j));
+			if (0 != PyErr_Occurred())
+				error = _pythonError();
+		}
+		Py_DECREF(row);
+	}
+	Py_DECREF(rows);
+	return error;
+}
+/*----------------------------------------------------------------------------*/
+void MeshModificationByPythonFunction::
+applyModificationByBatch(std::vector<gmds::Node >& gmdsNodes,
+		const Utils::MarkVector& filtre_nodes,
+		uint maskFixed)
+{
+	// sélection des noeuds non marqués
+	std::vector<gmds::Node > freeNodes;
+	freeNodes.reserve(gmdsNodes.size());
+	for (std::vector<gmds::Node >::iterator iter = gmdsNodes.begin();
+			iter != gmdsNodes.end(); ++iter)
+		if (filtre_nodes[iter->getID()] != maskFixed)
+			freeNodes.push_back(*iter);
+
+#ifdef _DEBUG2
+	std::cout<<"MeshModificationByPythonFunction::applyModificationByBatch pour "<<freeNodes.size()
+			<<" noeuds sur "<<gmdsNodes.size()<<", maskFixed = "<<maskFixed<<std::endl;
+#endif
+	const size_t nbNodes = freeNodes.size();
+	if (0 == nbNodes)
+		return;
+
+	// coordonnées contiguës, noeud par noeud, dans un bytearray
+	const Py_ssize_t len = (Py_ssize_t)(3*nbNodes*sizeof(double));
+	PyObject* storage = PyByteArray_FromStringAndSize(0, len);
+	if (0 == storage){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur interne lors de l'allocation des coordonnées : "<<_pythonError().c_str();
+		throw TkUtil::Exception(message);
+	}
+	double* coords = (double*)PyByteArray_AsString(storage);
+	for (size_t i=0; i<nbNodes; i++){
+		const gmds::Node& nd = freeNodes[i];
+		if (m_typeCoord == polar){
+			double rho = std::sqrt(nd.X()*nd.X()+nd.Y()*nd.Y()+nd.Z()*nd.Z());
+			coords[3*i]   = rho;
+			coords[3*i+1] = (Utils::Math::MgxNumeric::isNearlyZero(rho) ? 0 : std::asin(nd.Z()/rho));
+			coords[3*i+2] = std::atan2(nd.Y(), nd.X());
+		}
+		else {
+			coords[3*i]   = nd.X();
+			coords[3*i+1] = nd.Y();
+			coords[3*i+2] = nd.Z();
+		}
+	}
+
+	// mise à disposition du tableau sans recopie, sous forme de memoryview N x 3
+#if PY_MAJOR_VERSION >= 3
+	// vue sur le bytearray : les vues dérivées conservées par la fonction
+	// (cast, numpy.asarray ...) maintiennent le bytearray en vie
+	PyObject* bytes = PyMemoryView_FromObject(storage);
+	PyObject* view = (0 == bytes ? 0 :
+			PyObject_CallMethod(bytes, (char*)"cast", (char*)"s(nn)", "d", (Py_ssize_t)nbNodes, (Py_ssize_t)3));
+	Py_XDECREF(bytes);
+#else
+	Py_ssize_t shape[2]   = {(Py_ssize_t)nbNodes, 3};
+	Py_ssize_t strides[2] = {3*(Py_ssize_t)sizeof(double), (Py_ssize_t)sizeof(double)};
+	Py_buffer buffer;
+	memset(&buffer, 0, sizeof(Py_buffer));
+	buffer.buf      = coords;
+	buffer.obj      = 0;
+	buffer.len      = len;
+	buffer.itemsize = sizeof(double);
+	buffer.readonly = 0;
+	buffer.ndim     = 2;
+	buffer.format   = (char*)"d";
+	buffer.shape    = shape;
+	buffer.strides  = strides;
+	PyObject* view = PyMemoryView_FromBuffer(&buffer);
+#endif	// PY_MAJOR_VERSION >= 3
+	if (0 == view){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur interne lors de la création du memoryview des coordonnées : "<<_pythonError().c_str();
+		Py_DECREF(storage);
+		throw TkUtil::Exception(message);
+	}
+
+	PyObject* T = PyTuple_New(1);
+	Py_INCREF(view);
+	PyTuple_SetItem(T, 0, view);	// T devient propriétaire d'une référence
+	PyObject* R = PyObject_Call(m_py_obj, T, NULL);
+	Py_DECREF(T);
+
+	// None : coordonnées modifiées sur place, sinon tableau N x 3 en retour :
+	// doubles natifs recopiés directement, autres formats et séquences
+	// convertis nombre par nombre
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	bool failed = (0 == R);
+	if (0 == R){
+		message <<"Erreur lors de l'appel à la fonction de perturbation par lot pour "<<(long)nbNodes
+				<<" noeuds : "<<_pythonError().c_str();
+	}
+	else if (R != Py_None){
+		std::string error;
+		Py_buffer result;
+		if (PyObject_CheckBuffer(R) && 0 == PyObject_GetBuffer(R, &result, PyBUF_RECORDS_RO)){
+			const bool isNx3 = (2 == result.ndim) && (0 != result.shape)
+					&& ((Py_ssize_t)nbNodes == result.shape[0]) && (3 == result.shape[1]);
+			if (!isNx3){
+				TkUtil::UTF8String	shapes (TkUtil::Charset::UTF_8);
+				for (int d=0; d<result.ndim && 0 != result.shape; d++)
+					shapes << (0 == d ? "" : ", ") << (long)result.shape[d];
+				error = "tableau de forme (" + shapes.utf8() + ")";
+			}
+			else if (_isNativeDouble(result)){
+				// le tableau retourné peut être coords lui-même (numpy.asarray)
+				if (PyBuffer_IsContiguous(&result, 'C'))
+					memmove(coords, result.buf, len);
+				else if (0 != PyBuffer_ToContiguous(coords, &result, len, 'C'))
+					error = _pythonError();
+			}
+			else {
+				PyObject* list = PyObject_CallMethod(R, (char*)"tolist", NULL);
+				if (0 == list){
+					PyErr_Clear();
+					PyObject* rview = PyMemoryView_FromObject(R);
+					list = (0 == rview ? 0 : PyObject_CallMethod(rview, (char*)"tolist", NULL));
+					Py_XDECREF(rview);
+				}
+				error = (0 == list ? _pythonError() : _readSequence(list, nbNodes, coords));
+				Py_XDECREF(list);
+			}
+			PyBuffer_Release(&result);
+		}
+		else {
+			PyErr_Clear();
+			error = _readSequence(R, nbNodes, coords);
+		}
+		if (false == error.empty()){
+			failed = true;
+			message << "La fonction de perturbation par lot doit retourner None ou un tableau de "
+					<<(long)nbNodes<<" x 3 nombres : "<<error.c_str();
+		}
+	}
+	Py_XDECREF(R);
+
+	// le memoryview ne doit pas survivre à l'appel
+	bool released = true;
+#if PY_MAJOR_VERSION >= 3
+	// échec si un objet exporte encore ce memoryview (BufferError)
+	PyObject* res = PyObject_CallMethod(view, (char*)"release", NULL);
+	if (0 == res){
+		if (failed)
+			message << "\n";
+		failed = true;
+		message << "La fonction de perturbation par lot conserve une référence sur le tableau des coordonnées : "
+				<< _pythonError().c_str();
+	}
+	else
+		Py_DECREF(res);
+#else
+	// memoryview sans propriétaire : le tableau ne peut être libéré s'il est
+	// encore référencé
+	if (1 != Py_REFCNT(view)){
+		released = false;
+		if (failed)
+			message << "\n";
+		failed = true;
+		message << "La fonction de perturbation par lot conserve une référence sur le tableau des coordonnées.";
+	}
+#endif	// PY_MAJOR_VERSION >= 3
+	Py_DECREF(view);
+
+	if (failed){
+		// tableau encore référencé : abandonné à Python plutôt que libéré
+		if (released)
+			Py_DECREF(storage);
+		throw TkUtil::Exception(message);
+	}
+
+	// mise à jour des noeuds en une passe
+	for (size_t i=0; i<nbNodes; i++){
+		double res1 = coords[3*i];
+		double res2 = coords[3*i+1];
+		double res3 = coords[3*i+2];
+		if (m_typeCoord == polar){
+			const double rho   = res1;
+			const double theta = res2;
+			const double phi   = res3;
+			res1 = rho * std::cos(theta) * std::cos(phi);
+			res2 = rho * std::cos(theta) * std::sin(phi);
+			res3 = rho * std::sin(theta);
+		}
+		gmds::Node& nd = freeNodes[i];
+		nd.setX(res1);
+		nd.setY(res2);
+		nd.setZ(res3);
+	}
+	Py_DECREF(storage);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
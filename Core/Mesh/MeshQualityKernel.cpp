@@ -0,0 +1,604 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshQualityKernel.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/MeshQualityKernel.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/ThreadPool.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <GQualif/QualifHelper.h>
+/*----------------------------------------------------------------------------*/
+#include <math.h>
+#include <limits>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// nombre de mailles d'un paquet
+static const size_t cellsPerPack = 64;
+/// nombre de mailles évaluées par tâche
+static const size_t cellsPerTask = 16384;
+/*----------------------------------------------------------------------------*/
+/// sommets voisins de chaque sommet d'un hexaèdre, dans le sens direct
+static const int hexCorners[8][3] = {
+        {1, 3, 4}, {2, 0, 5}, {3, 1, 6}, {0, 2, 7},
+        {7, 5, 0}, {4, 6, 1}, {5, 7, 2}, {6, 4, 3}};
+/// arêtes d'un hexaèdre
+static const int hexEdges[12][2] = {
+        {0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
+        {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+/*----------------------------------------------------------------------------*/
+/**
+ * Paquet de mailles : coordonnées des sommets (un tableau par sommet et par
+ * composante) et valeurs des critères
+ */
+struct QualityPack {
+    size_t nb;
+    double x[8][cellsPerPack], y[8][cellsPerPack], z[8][cellsPerPack];
+    double values[MeshQualityKernel::NB_CRITERIA][cellsPerPack];
+    /// plus petit jacobien (non normalisé)
+    double minJacobian[cellsPerPack];
+};
+/*----------------------------------------------------------------------------*/
+static inline double det3(double ax, double ay, double az,
+        double bx, double by, double bz, double cx, double cy, double cz)
+{
+    return ax*(by*cz - bz*cy) - ay*(bx*cz - bz*cx) + az*(bx*cy - by*cx);
+}
+/*----------------------------------------------------------------------------*/
+static inline double ratio(double num, double den)
+{
+    return den > 0. ? num / den : 0.;
+}
+/*----------------------------------------------------------------------------*/
+/// calcul des critères pour un paquet d'hexaèdres
+static void computeHexahedra(QualityPack& p)
+{
+    const size_t nb = p.nb;
+    double* sj = p.values[MeshQualityKernel::SCALED_JACOBIAN];
+    double* minJ = p.minJacobian;
+    double minL[cellsPerPack], maxL[cellsPerPack];
+
+    for (size_t c=0; c<nb; c++){
+        sj[c] = 1.;
+        minJ[c] = std::numeric_limits<double>::max();
+        minL[c] = std::numeric_limits<double>::max();
+        maxL[c] = 0.;
+    }
+
+    // jacobiens aux sommets
+    for (int k=0; k<8; k++){
+        const int a = hexCorners[k][0], b = hexCorners[k][1], d = hexCorners[k][2];
+        for (size_t c=0; c<nb; c++){
+            const double ax = p.x[a][c]-p.x[k][c], ay = p.y[a][c]-p.y[k][c], az = p.z[a][c]-p.z[k][c];
+            const double bx = p.x[b][c]-p.x[k][c], by = p.y[b][c]-p.y[k][c], bz = p.z[b][c]-p.z[k][c];
+            const double dx = p.x[d][c]-p.x[k][c], dy = p.y[d][c]-p.y[k][c], dz = p.z[d][c]-p.z[k][c];
+            const double j = det3(ax, ay, az, bx, by, bz, dx, dy, dz);
+            const double n = sqrt((ax*ax+ay*ay+az*az) * (bx*bx+by*by+bz*bz) * (dx*dx+dy*dy+dz*dz));
+            const double s = ratio(j, n);
+            sj[c] = s < sj[c] ? s : sj[c];
+            minJ[c] = j < minJ[c] ? j : minJ[c];
+        }
+    }
+
+    // longueurs des arêtes
+    for (int e=0; e<12; e++){
+        const int a = hexEdges[e][0], b = hexEdges[e][1];
+        for (size_t c=0; c<nb; c++){
+            const double dx = p.x[b][c]-p.x[a][c], dy = p.y[b][c]-p.y[a][c], dz = p.z[b][c]-p.z[a][c];
+            const double l = dx*dx+dy*dy+dz*dz;
+            minL[c] = l < minL[c] ? l : minL[c];
+            maxL[c] = l > maxL[c] ? l : maxL[c];
+        }
+    }
+
+    // axes principaux (jacobien au centre)
+    double* skew = p.values[MeshQualityKernel::SKEW];
+    double* ar = p.values[MeshQualityKernel::ASPECT_RATIO];
+    double* vol = p.values[MeshQualityKernel::VOLUME];
+    for (size_t c=0; c<nb; c++){
+        const double x1 = (p.x[1][c]-p.x[0][c]) + (p.x[2][c]-p.x[3][c]) + (p.x[5][c]-p.x[4][c]) + (p.x[6][c]-p.x[7][c]);
+        const double y1 = (p.y[1][c]-p.y[0][c]) + (p.y[2][c]-p.y[3][c]) + (p.y[5][c]-p.y[4][c]) + (p.y[6][c]-p.y[7][c]);
+        const double z1 = (p.z[1][c]-p.z[0][c]) + (p.z[2][c]-p.z[3][c]) + (p.z[5][c]-p.z[4][c]) + (p.z[6][c]-p.z[7][c]);
+        const double x2 = (p.x[3][c]-p.x[0][c]) + (p.x[2][c]-p.x[1][c]) + (p.x[7][c]-p.x[4][c]) + (p.x[6][c]-p.x[5][c]);
+        const double y2 = (p.y[3][c]-p.y[0][c]) + (p.y[2][c]-p.y[1][c]) + (p.y[7][c]-p.y[4][c]) + (p.y[6][c]-p.y[5][c]);
+        const double z2 = (p.z[3][c]-p.z[0][c]) + (p.z[2][c]-p.z[1][c]) + (p.z[7][c]-p.z[4][c]) + (p.z[6][c]-p.z[5][c]);
+        const double x3 = (p.x[4][c]-p.x[0][c]) + (p.x[5][c]-p.x[1][c]) + (p.x[6][c]-p.x[2][c]) + (p.x[7][c]-p.x[3][c]);
+        const double y3 = (p.y[4][c]-p.y[0][c]) + (p.y[5][c]-p.y[1][c]) + (p.y[6][c]-p.y[2][c]) + (p.y[7][c]-p.y[3][c]);
+        const double z3 = (p.z[4][c]-p.z[0][c]) + (p.z[5][c]-p.z[1][c]) + (p.z[6][c]-p.z[2][c]) + (p.z[7][c]-p.z[3][c]);
+        const double l1 = sqrt(x1*x1+y1*y1+z1*z1), l2 = sqrt(x2*x2+y2*y2+z2*z2), l3 = sqrt(x3*x3+y3*y3+z3*z3);
+        const double j = det3(x1, y1, z1, x2, y2, z2, x3, y3, z3);
+        const double s = ratio(j, l1*l2*l3);
+        sj[c] = s < sj[c] ? s : sj[c];
+        minJ[c] = j < minJ[c] ? j : minJ[c];
+
+        const double c12 = fabs(ratio(x1*x2+y1*y2+z1*z2, l1*l2));
+        const double c13 = fabs(ratio(x1*x3+y1*y3+z1*z3, l1*l3));
+        const double c23 = fabs(ratio(x2*x3+y2*y3+z2*z3, l2*l3));
+        const double m = c12 > c13 ? c12 : c13;
+        skew[c] = m > c23 ? m : c23;
+
+        ar[c] = minL[c] > 0. ? sqrt(maxL[c] / minL[c]) : std::numeric_limits<double>::max();
+        vol[c] = j / 64.;
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// calcul des critères pour un paquet de quadrangles
+static void computeQuadrangles(QualityPack& p)
+{
+    const size_t nb = p.nb;
+    double* sj = p.values[MeshQualityKernel::SCALED_JACOBIAN];
+    double* skew = p.values[MeshQualityKernel::SKEW];
+    double* ar = p.values[MeshQualityKernel::ASPECT_RATIO];
+    double* area = p.values[MeshQualityKernel::VOLUME];
+    double* minJ = p.minJacobian;
+
+    for (size_t c=0; c<nb; c++){
+        // normale unitaire suivant les diagonales
+        const double d1x = p.x[2][c]-p.x[0][c], d1y = p.y[2][c]-p.y[0][c], d1z = p.z[2][c]-p.z[0][c];
+        const double d2x = p.x[3][c]-p.x[1][c], d2y = p.y[3][c]-p.y[1][c], d2z = p.z[3][c]-p.z[1][c];
+        double nx = d1y*d2z - d1z*d2y, ny = d1z*d2x - d1x*d2z, nz = d1x*d2y - d1y*d2x;
+        const double ln = sqrt(nx*nx+ny*ny+nz*nz);
+        nx = ratio(nx, ln); ny = ratio(ny, ln); nz = ratio(nz, ln);
+
+        double s = 1., j = std::numeric_limits<double>::max(), sum = 0.;
+        double minL = std::numeric_limits<double>::max(), maxL = 0.;
+        for (int k=0; k<4; k++){
+            const int a = (k+1)%4, b = (k+3)%4;
+            const double ax = p.x[a][c]-p.x[k][c], ay = p.y[a][c]-p.y[k][c], az = p.z[a][c]-p.z[k][c];
+            const double bx = p.x[b][c]-p.x[k][c], by = p.y[b][c]-p.y[k][c], bz = p.z[b][c]-p.z[k][c];
+            const double la = ax*ax+ay*ay+az*az, lb = bx*bx+by*by+bz*bz;
+            const double jk = det3(ax, ay, az, bx, by, bz, nx, ny, nz);
+            const double sk = ratio(jk, sqrt(la*lb));
+            s = sk < s ? sk : s;
+            j = jk < j ? jk : j;
+            sum += jk;
+            minL = la < minL ? la : minL;
+            maxL = la > maxL ? la : maxL;
+        }
+        sj[c] = s;
+        minJ[c] = j;
+        area[c] = sum / 4.;
+        ar[c] = minL > 0. ? sqrt(maxL / minL) : std::numeric_limits<double>::max();
+
+        const double x1 = (p.x[1][c]-p.x[0][c]) + (p.x[2][c]-p.x[3][c]);
+        const double y1 = (p.y[1][c]-p.y[0][c]) + (p.y[2][c]-p.y[3][c]);
+        const double z1 = (p.z[1][c]-p.z[0][c]) + (p.z[2][c]-p.z[3][c]);
+        const double x2 = (p.x[3][c]-p.x[0][c]) + (p.x[2][c]-p.x[1][c]);
+        const double y2 = (p.y[3][c]-p.y[0][c]) + (p.y[2][c]-p.y[1][c]);
+        const double z2 = (p.z[3][c]-p.z[0][c]) + (p.z[2][c]-p.z[1][c]);
+        skew[c] = fabs(ratio(x1*x2+y1*y2+z1*z2,
+                sqrt((x1*x1+y1*y1+z1*z1) * (x2*x2+y2*y2+z2*z2))));
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// cumule les valeurs d'un paquet
+static void accumulate(const QualityPack& p, MeshQualityKernel::Results& results)
+{
+    for (int k=0; k<MeshQualityKernel::NB_CRITERIA; k++){
+        MeshQualityKernel::Statistics& st = results.statistics[k];
+        const double* v = p.values[k];
+        double mn = st.min, mx = st.max, sum = st.sum;
+        for (size_t c=0; c<p.nb; c++){
+            mn = v[c] < mn ? v[c] : mn;
+            mx = v[c] > mx ? v[c] : mx;
+            sum += v[c];
+        }
+        st.min = mn;
+        st.max = mx;
+        st.sum = sum;
+        st.nbCells += p.nb;
+
+        const size_t nbClasses = st.histogram.size();
+        if (0 == nbClasses)
+            continue;
+        const double scale = (double)nbClasses / (st.domainMax - st.domainMin);
+        for (size_t c=0; c<p.nb; c++){
+            const double pos = (v[c] - st.domainMin) * scale;
+            const size_t cl = pos <= 0. ? 0 : (pos >= (double)nbClasses ? nbClasses - 1 : (size_t)pos);
+            st.histogram[cl]++;
+        }
+    }
+
+    for (size_t c=0; c<p.nb; c++)
+        if (p.minJacobian[c] <= 0.)
+            results.nbInvalid++;
+}
+/*----------------------------------------------------------------------------*/
+/** évalue les mailles [first, last[ : les sommets sont recopiés par paquets,
+ *  puis les critères sont calculés et cumulés paquet par paquet */
+static void evaluateRange(gmds::IGMesh& mesh, const gmds::TCellID* ids,
+        size_t first, size_t last, bool volumic, MeshQualityKernel::Results& results)
+{
+    QualityPack* pack = new QualityPack();
+    pack->nb = 0;
+    const size_t nbNodes = volumic ? 8 : 4;
+    std::vector<gmds::TCellID> nodes;
+
+    try {
+        for (size_t i=first; i<last; i++){
+            if (volumic){
+                gmds::Region r = mesh.get<gmds::Region>(ids[i]);
+                if (gmds::GMDS_HEX != r.getType()){
+                    results.nbIgnored++;
+                    continue;
+                }
+                nodes = r.getIDs<gmds::Node>();
+            }
+            else {
+                gmds::Face f = mesh.get<gmds::Face>(ids[i]);
+                if (gmds::GMDS_QUAD != f.getType()){
+                    results.nbIgnored++;
+                    continue;
+                }
+                nodes = f.getIDs<gmds::Node>();
+            }
+
+            const size_t c = pack->nb;
+            for (size_t k=0; k<nbNodes; k++){
+                const gmds::Node nd = mesh.get<gmds::Node>(nodes[k]);
+                pack->x[k][c] = nd.X();
+                pack->y[k][c] = nd.Y();
+                pack->z[k][c] = nd.Z();
+            }
+
+            if (cellsPerPack == ++pack->nb){
+                if (volumic)
+                    computeHexahedra(*pack);
+                else
+                    computeQuadrangles(*pack);
+                accumulate(*pack, results);
+                pack->nb = 0;
+            }
+        }
+
+        if (0 != pack->nb){
+            if (volumic)
+                computeHexahedra(*pack);
+            else
+                computeQuadrangles(*pack);
+            accumulate(*pack, results);
+        }
+    }
+    catch (...){
+        delete pack;
+        throw;
+    }
+    delete pack;
+}
+/*----------------------------------------------------------------------------*/
+/** évalue les mailles [first, last[ une par une avec Qualif : les valeurs
+ *  des critères sont rangées dans un paquet, cumulé comme dans evaluateRange */
+static void evaluateRangeWithQualif(gmds::IGMesh& mesh, const gmds::TCellID* ids,
+        size_t first, size_t last, bool volumic, MeshQualityKernel::Results& results)
+{
+    QualityPack* pack = new QualityPack();
+    pack->nb = 0;
+    const size_t nbNodes = volumic ? 8 : 4;
+    std::vector<gmds::TCellID> nodes;
+    Qualif::Vecteur sommets[8];
+    Qualif::Hexaedre hexaedre;
+    Qualif::Quadrangle quadrangle;
+
+    try {
+        for (size_t i=first; i<last; i++){
+            if (volumic){
+                gmds::Region r = mesh.get<gmds::Region>(ids[i]);
+                if (gmds::GMDS_HEX != r.getType()){
+                    results.nbIgnored++;
+                    continue;
+                }
+                nodes = r.getIDs<gmds::Node>();
+            }
+            else {
+                gmds::Face f = mesh.get<gmds::Face>(ids[i]);
+                if (gmds::GMDS_QUAD != f.getType()){
+                    results.nbIgnored++;
+                    continue;
+                }
+                nodes = f.getIDs<gmds::Node>();
+            }
+
+            for (size_t k=0; k<nbNodes; k++){
+                const gmds::Node nd = mesh.get<gmds::Node>(nodes[k]);
+                sommets[k] = Qualif::Vecteur(nd.X(), nd.Y(), nd.Z());
+            }
+            Qualif::Maille* maille = &quadrangle;
+            if (volumic)
+                maille = &hexaedre;
+            maille->Init_Sommets(sommets);
+
+            // le volume est l'aire pour un quadrangle
+            const size_t c = pack->nb;
+            pack->values[MeshQualityKernel::SCALED_JACOBIAN][c] = maille->AppliqueCritere(Qualif::SCALEDJACOBIAN);
+            pack->values[MeshQualityKernel::SKEW][c] = maille->AppliqueCritere(Qualif::SKEW);
+            pack->values[MeshQualityKernel::ASPECT_RATIO][c] = maille->AppliqueCritere(Qualif::ASPECTRATIO);
+            pack->values[MeshQualityKernel::VOLUME][c] = maille->AppliqueCritere(Qualif::VOLUME);
+            pack->minJacobian[c] = 1. == maille->AppliqueCritere(Qualif::VALIDITY) ? 1. : 0.;
+
+            if (cellsPerPack == ++pack->nb){
+                accumulate(*pack, results);
+                pack->nb = 0;
+            }
+        }
+
+        if (0 != pack->nb)
+            accumulate(*pack, results);
+    }
+    catch (...){
+        delete pack;
+        throw;
+    }
+    delete pack;
+}
+/*----------------------------------------------------------------------------*/
+/**
+ * Tâche évaluant la qualité d'une plage de mailles gmds (lecture seule du
+ * maillage gmds), avec ses propres résultats partiels.
+ */
+class QualityEvaluationTask : public TkUtil::ThreadPool::TaskIfc
+{
+	public :
+
+	/**
+	 * \param	Maillage gmds
+	 * \param	Identifiants des mailles
+	 * \param	Plage [first, last[ des mailles à évaluer
+	 * \param	Vrai pour des polyèdres, faux pour des polygones
+	 * \param	Résultats partiels initialisés
+	 */
+	QualityEvaluationTask (gmds::IGMesh& mesh, const gmds::TCellID* ids,
+			size_t first, size_t last, bool volumic,
+			const MeshQualityKernel::Results& results)
+		: TkUtil::ThreadPool::TaskIfc ( ),
+		  _mesh (mesh), _ids (ids), _first (first), _last (last),
+		  _volumic (volumic), _results (results), _message ( )
+	{ }
+	virtual ~QualityEvaluationTask ( )
+	{ }
+
+	/**
+	 * \return	Les résultats partiels de la tâche.
+	 */
+	const MeshQualityKernel::Results& getResults ( ) const
+	{ return _results; }
+
+	/**
+	 * \return	Message associé à l'exécution de la tache en cas d'erreur.
+	 */
+	const std::string& getMessage ( ) const
+	{ return _message; }
+
+
+	protected :
+
+	virtual void execute ( )
+	{
+		try
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::RUNNING);
+			evaluateRange (_mesh, _ids, _first, _last, _volumic, _results);
+			setStatus (TkUtil::ThreadPool::TaskIfc::COMPLETED);
+		}
+		catch (const TkUtil::Exception& exc)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= exc.getFullMessage ( );
+		}
+		catch (...)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= "Erreur non documentée.";
+		}
+	}	// execute
+
+
+	private :
+
+	QualityEvaluationTask (const QualityEvaluationTask&);
+	QualityEvaluationTask& operator = (const QualityEvaluationTask&);
+
+	gmds::IGMesh&					_mesh;
+	const gmds::TCellID*			_ids;
+	size_t							_first, _last;
+	bool							_volumic;
+	MeshQualityKernel::Results		_results;
+	std::string						_message;
+};	// class QualityEvaluationTask
+/*----------------------------------------------------------------------------*/
+MeshQualityKernel::Statistics::Statistics()
+: nbCells(0)
+, min(std::numeric_limits<double>::max())
+, max(-std::numeric_limits<double>::max())
+, sum(0.)
+, domainMin(0.), domainMax(0.)
+, histogram()
+{
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::Statistics::merge(const Statistics& s)
+{
+    nbCells += s.nbCells;
+    min = s.min < min ? s.min : min;
+    max = s.max > max ? s.max : max;
+    sum += s.sum;
+    for (size_t i=0; i<histogram.size() && i<s.histogram.size(); i++)
+        histogram[i] += s.histogram[i];
+}
+/*----------------------------------------------------------------------------*/
+double MeshQualityKernel::Statistics::getMean() const
+{
+    return 0 == nbCells ? 0. : sum / (double)nbCells;
+}
+/*----------------------------------------------------------------------------*/
+MeshQualityKernel::MeshQualityKernel(gmds::IGMesh& mesh, size_t nbClasses, bool threaded,
+                                     bool perCell)
+: m_mesh(mesh)
+, m_nbClasses(nbClasses)
+, m_threaded(threaded)
+, m_perCell(perCell)
+, m_nbInvalid(0)
+, m_nbIgnored(0)
+{
+    setDomain(SCALED_JACOBIAN, -1., 1.);
+    setDomain(SKEW, 0., 1.);
+    setDomain(ASPECT_RATIO, 1., 10.);
+}
+/*----------------------------------------------------------------------------*/
+MeshQualityKernel::~MeshQualityKernel()
+{
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::setDomain(criterion c, double min, double max)
+{
+    Statistics& st = m_statistics[c];
+    st.domainMin = min;
+    st.domainMax = max;
+    if (min < max)
+        st.histogram.assign(m_nbClasses, 0);
+    else
+        st.histogram.clear();
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::evaluateRegions(const std::vector<gmds::TCellID>& ids)
+{
+    evaluate(ids, true);
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::evaluateFaces(const std::vector<gmds::TCellID>& ids)
+{
+    evaluate(ids, false);
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::reset()
+{
+    for (int k=0; k<NB_CRITERIA; k++){
+        const double min = m_statistics[k].domainMin, max = m_statistics[k].domainMax;
+        m_statistics[k] = Statistics();
+        setDomain((criterion)k, min, max);
+    }
+    m_nbInvalid = 0;
+    m_nbIgnored = 0;
+}
+/*----------------------------------------------------------------------------*/
+const MeshQualityKernel::Statistics& MeshQualityKernel::getStatistics(criterion c) const
+{
+    return m_statistics[c];
+}
+/*----------------------------------------------------------------------------*/
+MeshQualityKernel::criterion MeshQualityKernel::getCriterion(const std::string& name)
+{
+    for (int k=0; k<NB_CRITERIA; k++)
+        if (getCriterionName((criterion)k) == name)
+            return (criterion)k;
+
+    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+    message << "Critère de qualité inconnu : " << name
+            << " (ScaledJacobian, Skew, AspectRatio ou Volume sont attendus)";
+    throw TkUtil::Exception (message);
+}
+/*----------------------------------------------------------------------------*/
+std::string MeshQualityKernel::getCriterionName(criterion c)
+{
+    switch (c){
+    case SCALED_JACOBIAN: return "ScaledJacobian";
+    case SKEW:            return "Skew";
+    case ASPECT_RATIO:    return "AspectRatio";
+    case VOLUME:          return "Volume";
+    default:              break;
+    }
+    throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, critère non prévu dans MeshQualityKernel::getCriterionName", TkUtil::Charset::UTF_8));
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::initResults(Results& results) const
+{
+    for (int k=0; k<NB_CRITERIA; k++){
+        Statistics& st = results.statistics[k];
+        st = Statistics();
+        st.domainMin = m_statistics[k].domainMin;
+        st.domainMax = m_statistics[k].domainMax;
+        st.histogram.assign(m_statistics[k].histogram.size(), 0);
+    }
+    results.nbInvalid = 0;
+    results.nbIgnored = 0;
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::merge(const Results& results)
+{
+    for (int k=0; k<NB_CRITERIA; k++)
+        m_statistics[k].merge(results.statistics[k]);
+    m_nbInvalid += results.nbInvalid;
+    m_nbIgnored += results.nbIgnored;
+}
+/*----------------------------------------------------------------------------*/
+void MeshQualityKernel::evaluate(const std::vector<gmds::TCellID>& ids, bool volumic)
+{
+    const size_t nbCells = ids.size();
+    if (0 == nbCells)
+        return;
+
+    // évaluation de référence, maille par maille
+    if (true == m_perCell){
+        Results results;
+        initResults(results);
+        evaluateRangeWithQualif(m_mesh, &ids[0], 0, nbCells, volumic, results);
+        merge(results);
+        return;
+    }
+
+    // peu de mailles ou parallélisme non autorisé : évaluation séquentielle
+    if (nbCells <= cellsPerTask || false == m_threaded){
+        Results results;
+        initResults(results);
+        evaluateRange(m_mesh, &ids[0], 0, nbCells, volumic, results);
+        merge(results);
+        return;
+    }
+
+    // évaluation parallèle par plages de mailles disjointes, chaque tâche
+    // ayant ses propres résultats, cumulés ensuite
+    Results init;
+    initResults(init);
+    std::vector<QualityEvaluationTask*> tasks;
+    std::vector<TkUtil::ThreadPool::TaskIfc*> t;
+    for (size_t first=0; first<nbCells; first+=cellsPerTask){
+        size_t last = first+cellsPerTask;
+        if (last > nbCells)
+            last = nbCells;
+        QualityEvaluationTask* task = new QualityEvaluationTask(m_mesh, &ids[0], first, last, volumic, init);
+        tasks.push_back(task);
+        t.push_back(task);
+    }
+    TkUtil::ThreadPool::instance().addTasks(t);
+    TkUtil::ThreadPool::instance().barrier();
+
+    TkUtil::UTF8String	errors (TkUtil::Charset::UTF_8);
+    for (size_t i=0; i<tasks.size(); i++){
+        if (TkUtil::ThreadPool::TaskIfc::IN_ERROR == tasks[i]->getStatus()){
+            if (false == errors.empty())
+                errors << "\n";
+            errors << tasks[i]->getMessage();
+        }
+        else
+            merge(tasks[i]->getResults());
+        delete tasks[i];
+    }
+    if (false == errors.empty()){
+        TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "Erreur lors de l'évaluation de la qualité du maillage :\n" << errors;
+        throw TkUtil::Exception (message);
+    }
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
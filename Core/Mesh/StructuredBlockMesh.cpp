@@ -0,0 +1,52 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file StructuredBlockMesh.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/StructuredBlockMesh.h"
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+StructuredBlockMesh::StructuredBlockMesh()
+: m_ni(0), m_nj(0), m_nk(0), m_inverted(false)
+{
+}
+/*----------------------------------------------------------------------------*/
+StructuredBlockMesh::StructuredBlockMesh(const StructuredBlockMesh& sbm)
+: m_ni(sbm.m_ni), m_nj(sbm.m_nj), m_nk(sbm.m_nk), m_inverted(sbm.m_inverted)
+, m_x(sbm.m_x), m_y(sbm.m_y), m_z(sbm.m_z)
+{
+}
+/*----------------------------------------------------------------------------*/
+StructuredBlockMesh::StructuredBlockMesh(uint ni, uint nj, uint nk)
+: m_ni(0), m_nj(0), m_nk(0), m_inverted(false)
+{
+	resize(ni, nj, nk);
+}
+/*----------------------------------------------------------------------------*/
+StructuredBlockMesh::~StructuredBlockMesh()
+{
+}
+/*----------------------------------------------------------------------------*/
+void StructuredBlockMesh::resize(uint ni, uint nj, uint nk)
+{
+	m_ni = ni;
+	m_nj = nj;
+	m_nk = nk;
+	const size_t nbNodes = getNbNodes();
+	// on libère la mémoire d'un éventuel maillage précédent plus grand
+	std::vector<double>(nbNodes).swap(m_x);
+	std::vector<double>(nbNodes).swap(m_y);
+	std::vector<double>(nbNodes).swap(m_z);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -26,7 +26,7 @@ const char* SubSurface::typeNameMeshSubSurface = "MeshSubSurface";
 /*----------------------------------------------------------------------------*/
 SubSurface::SubSurface(Internal::Context& ctx,
 		Utils::Property* prop,
-		Utils::DisplayProperties* disp,
+		const Utils::DisplayProperties& disp,
 		uint gmds_id)
 : Surface(ctx, prop, disp)
 , m_gmds_id (gmds_id)
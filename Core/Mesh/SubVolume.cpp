@@ -26,7 +26,7 @@ const char* SubVolume::typeNameMeshSubVolume = "MeshSubVolume";
 /*----------------------------------------------------------------------------*/
 SubVolume::SubVolume(Internal::Context& ctx,
 		Utils::Property* prop,
-		Utils::DisplayProperties* disp,
+		const Utils::DisplayProperties& disp,
 		uint gmds_id)
 : Volume(ctx, prop, disp)
 , m_gmds_id (gmds_id)
@@ -14,6 +14,7 @@
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
+#include "Utils/MarkVector.h"
 #include "Topo/CoFace.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Internal/InfoCommand.h"
@@ -31,7 +32,7 @@ namespace Mesh {
 /*----------------------------------------------------------------------------*/
 const char* Surface::typeNameMeshSurface = "MeshSurface";
 /*----------------------------------------------------------------------------*/
-Surface::Surface(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp)
+Surface::Surface(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp)
 : MeshEntity(ctx, prop, disp)
 , m_topo_property(new Topo::MeshSurfaceTopoProperty())
 , m_save_topo_property(0)
@@ -279,9 +280,6 @@ void Surface::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
 {
 	ANodes.clear();
 
-	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
-	std::map<gmds::TCellID, uint> filtre_nodes;
-
     std::vector<Topo::CoFace* > coFaces;
     getCoFaces(coFaces);
 
@@ -290,13 +288,17 @@ void Surface::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
 
+    // utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
+    Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+    Utils::MarkVector& filtre_nodes = filtre_lease.marks ( );
+
     for(unsigned int iCoFace=0; iCoFace<coFaces.size(); iCoFace++) {
-    	std::vector<gmds::TCellID> nodes  = coFaces[iCoFace]->nodes();
+    	const std::vector<gmds::TCellID>& nodes  = coFaces[iCoFace]->nodes();
 
     	for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-    		if (filtre_nodes[nodes[iNode]] == 0){
+    		if (!filtre_nodes.isMarked(nodes[iNode])){
     			ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-    			filtre_nodes[nodes[iNode]] = 1;
+    			filtre_nodes.set(nodes[iNode], 1);
     		}
     	}
     }
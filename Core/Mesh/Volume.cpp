@@ -14,6 +14,7 @@
 #include "Mesh/CommandCreateMesh.h"
 #include "Utils/Common.h"
 #include "Utils/Bounds.h"
+#include "Utils/MarkVector.h"
 #include "Topo/CoFace.h"
 #include "Topo/Face.h"
 #include "Topo/Block.h"
@@ -33,7 +34,7 @@ namespace Mesh {
 /*----------------------------------------------------------------------------*/
 const char* Volume::typeNameMeshVolume = "MeshVolume";
 /*----------------------------------------------------------------------------*/
-Volume::Volume(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp)
+Volume::Volume(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp)
 : MeshEntity(ctx, prop, disp)
 , m_topo_property(new Topo::MeshVolumeTopoProperty())
 , m_save_topo_property(0)
@@ -176,8 +177,6 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	{
 	    if (1 == mdr->getDecimationStep ( ))
 	    {
-	        // on passe par GMDS pour récupérer les noeuds et les mailles
-	        gmds::IGMesh& gmdsMesh = meshImpl->getGMDSMesh();
 	        if (false == skin)
 	        {	// Mailles pleines
 	            // Récupération du groupe GMDS
@@ -185,14 +184,13 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	            getGMDSRegions(polyedres);
 
 	            // Constitution d'un vecteur avec les noeuds de la surface
-	            // et une map pour l'indirection entre gmds::Node vers indice
-	            // local
+	            // et une table de marques pour l'indirection entre gmds::Node
+	            // vers indice local (+1, 0 pour un noeud non vu)
 	            std::vector<gmds::Node>	nodes;
-	            std::map<gmds::TCellID, int>    node2id;
+	            Utils::MarkVectorLease	node2id_lease (meshImpl->getMarks ( ));
+	            Utils::MarkVector&	node2id	= node2id_lease.marks ( );
 	            // nombres de références sur les ids dans les polyèdres :
 	            uint	nbRefIds	= 0;
-
-	            gmds::Variable<short>* mark = gmdsMesh.newVariable<short>(gmds::GMDS_NODE,"markVol2");
 	            for (std::vector<gmds::Region>::const_iterator
 	                    iter_p = polyedres.begin(); iter_p != polyedres.end();
 	                    ++iter_p)
@@ -203,19 +201,15 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                        iter_n = nds.begin(); iter_n != nds.end(); ++iter_n)
 	                {
 	                    gmds::Node current = *iter_n;
-	                    if((*mark)[current.getID()]==0)
+	                    if (false == node2id.isMarked (current.getID ( )))
 	                    {
-	                        node2id[current.getID()] = nodes.size();
+	                        node2id.set (current.getID ( ), nodes.size ( ) + 1);
 	                        nodes.push_back(current);
-	                        (*mark)[current.getID()]=1;
 	                    }   // if (!gmdsMesh.isMarked(*iter_n,done))
 
 	                }   // for (std::vector<gmds::Node*>::const_iterator ...
 	                nbRefIds += nds.size();
 	            } // for (std::vector<gmds::Region*>::const_iterator iter_p =
-
-	            // on démarque les noeuds
-	            gmdsMesh.deleteVariable(gmds::GMDS_NODE,mark);
 	            std::vector<Utils::Math::Point>& points	= mdr->getPoints ( );
 	            points.clear();
 	            for (std::vector<gmds::Node>::iterator itn = nodes.begin ( );
@@ -231,7 +225,7 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                const size_t		count   = ndsIDs.size ( );
 	                cells->push_back (count);
 	                for (size_t j = 0; j < count; j++)
-	                    cells->push_back (node2id [ndsIDs [j]]);
+	                    cells->push_back (node2id [ndsIDs [j]] - 1);
 	            }   // for (size_t id = 0; id < polyedreNum; id++)
 	            mdr->setCells (cells, skin);
 	        }	// if (false == skin)
@@ -269,10 +263,10 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	            // on cumule les noeuds, en évitant les doublons
 	            std::vector<gmds::Node>	nodes;
 	            std::vector<gmds::Face>	polygones;
-	            std::map<gmds::TCellID, int>	node2id;
+	            Utils::MarkVectorLease	node2id_lease (meshImpl->getMarks ( ));
+	            Utils::MarkVector&	node2id	= node2id_lease.marks ( );
 	            // nombres de références sur les ids dans les polygones :
 	            uint			nbRefIds	= 0;
-	            gmds::Variable<short>* mark = gmdsMesh.newVariable<short>(gmds::GMDS_NODE,"markVol1");
 	            for (std::map<Topo::CoFace*, int>::iterator
 	                    iter = marque_faces.begin();
 	                    iter != marque_faces.end(); ++iter)
@@ -296,11 +290,10 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                                iter_n != nds.end(); ++iter_n)
 	                        {
 	                            gmds::Node current = *iter_n;
-	                            if((*mark)[current.getID()]==0)
+	                            if (false == node2id.isMarked (current.getID ( )))
 	                            {
-	                                node2id[current.getID()] = nodes.size();
+	                                node2id.set (current.getID ( ), nodes.size ( ) + 1);
 	                                nodes.push_back(current);
-	                                (*mark)[current.getID()]=1;
 	                            }   // if (!gmdsMesh.isMarked(*iter_n,done))
 	                        }	// for (std::vector<gmds::Node*>:: ...
 
@@ -308,9 +301,6 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                    }	// for (std::vector<gmds::Face*>::const_iterator
 	                }	// if (iter->second == 1)
 	            }   // for (std::map<Topo::CoFace*, int>::iterator
-
-	            // on démarque les noeuds
-	            gmdsMesh.deleteVariable(gmds::GMDS_NODE,mark);
 	            std::vector<Utils::Math::Point>& points	= mdr->getPoints ( );
 	            points.clear();
 	            for (std::vector<gmds::Node>::iterator itn = nodes.begin ( );
@@ -328,7 +318,7 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                const size_t		count   = nds.size ( );
 	                cells->push_back (count);
 	                for (size_t j = 0; j < count; j++)
-	                    cells->push_back (node2id [nds [j]]);
+	                    cells->push_back (node2id [nds [j]] - 1);
 	            }   // for (size_t id = 0; id < polygonNum; id++)
 	            mdr->setCells (cells, skin);
 	        }	// else if (false == skin)
@@ -394,9 +384,6 @@ void Volume::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
 {
 	ANodes.clear();
 
-	// utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
-	std::map<gmds::TCellID, uint> filtre_nodes;
-
     std::vector<Topo::Block* > blocks;
     getBlocks(blocks);
 
@@ -405,13 +392,17 @@ void Volume::getGMDSNodes(std::vector<gmds::Node>& ANodes) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::IGMesh&  gmdsMesh = meshImpl->getGMDSMesh();
 
+    // utilisation d'un filtre pour ne pas référencer plusieurs fois un même noeud
+    Utils::MarkVectorLease filtre_lease (meshImpl->getMarks ( ));
+    Utils::MarkVector& filtre_nodes = filtre_lease.marks ( );
+
     for(unsigned int iBlock=0; iBlock<blocks.size(); iBlock++) {
-    	std::vector<gmds::TCellID> nodes  = blocks[iBlock]->nodes();
+    	const std::vector<gmds::TCellID>& nodes  = blocks[iBlock]->nodes();
 
     	for(unsigned int iNode=0; iNode<nodes.size(); iNode++) {
-    		if (filtre_nodes[nodes[iNode]] == 0){
+    		if (!filtre_nodes.isMarked(nodes[iNode])){
     			ANodes.push_back(gmdsMesh.get<gmds::Node>(nodes[iNode]));
-    			filtre_nodes[nodes[iNode]] = 1;
+    			filtre_nodes.set(nodes[iNode], 1);
     		}
     	}
     }
@@ -434,7 +425,7 @@ getDescription (bool alsoComputed) const
     	uint nbMailles = 0;
     	for (uint i=0; i<blocks.size(); i++){
     		Topo::Block* bl = blocks[i];
-    		nbMailles += bl->regions().size();
+    		nbMailles += bl->getMeshingData()->getNbRegions();
     	}
     	meshProprietes.addProperty (
     			Utils::SerializedRepresentation::Property ("Nombre de mailles des blocs", (long)nbMailles));
@@ -0,0 +1,496 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ColoredVolumicSmoother.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Smoothing/ColoredVolumicSmoother.h"
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/ThreadPool.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// nombre de noeuds d'une couleur traités par tâche
+static const size_t smoothNodesPerTask = 2048;
+
+/// pour chaque coin d'un hexaèdre, ses 3 voisins (repère direct pour un hexaèdre bien orienté)
+static const int hexCorners[8][3] = {
+		{1, 3, 4}, {2, 0, 5}, {3, 1, 6}, {0, 2, 7},
+		{7, 5, 0}, {4, 6, 1}, {5, 7, 2}, {6, 4, 3}};
+
+/// pour chaque coin d'un tétraèdre, ses 3 voisins
+static const int tetCorners[4][3] = {
+		{1, 2, 3}, {2, 0, 3}, {0, 1, 3}, {0, 2, 1}};
+
+/// inverse de la matrice des arêtes d'un coin de tétraèdre régulier (par colonnes)
+static const double tetWInv[3][3] = {
+		{1.0, -0.577350269189626, -0.408248290463863},
+		{0.0,  1.154700538379251, -0.408248290463863},
+		{0.0,  0.0,                1.224744871391589}};
+/*----------------------------------------------------------------------------*/
+/**
+ * Tâche lissant une plage de noeuds d'une même couleur.
+ */
+class ColoredSmoothingTask : public TkUtil::ThreadPool::TaskIfc
+{
+	public :
+
+	ColoredSmoothingTask (ColoredVolumicSmoother& smoother, size_t first, size_t last)
+		: TkUtil::ThreadPool::TaskIfc ( ),
+		  _smoother (smoother), _first (first), _last (last), _message ( )
+	{ }
+	virtual ~ColoredSmoothingTask ( )
+	{ }
+
+	/**
+	 * \return	Message associé à l'exécution de la tache en cas d'erreur.
+	 */
+	const std::string& getMessage ( ) const
+	{ return _message; }
+
+
+	protected :
+
+	virtual void execute ( )
+	{
+		try
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::RUNNING);
+			_smoother.smoothRange (_first, _last);
+			setStatus (TkUtil::ThreadPool::TaskIfc::COMPLETED);
+		}
+		catch (const TkUtil::Exception& exc)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= exc.getFullMessage ( );
+		}
+		catch (...)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= "Erreur non documentée.";
+		}
+	}	// execute
+
+
+	private :
+
+	ColoredSmoothingTask (const ColoredSmoothingTask&);
+	ColoredSmoothingTask& operator = (const ColoredSmoothingTask&);
+
+	ColoredVolumicSmoother&	_smoother;
+	size_t					_first, _last;
+	std::string				_message;
+};	// class ColoredSmoothingTask
+/*----------------------------------------------------------------------------*/
+/// qualité d'un coin de Jacobien a (par colonnes), HUGE_VAL si dégénéré ou retourné
+static double cornerObjective(ColoredVolumicSmoother::eObjective objective,
+		const double a[3][3], double sign)
+{
+	// cofacteurs
+	double c00 = a[1][1]*a[2][2]-a[1][2]*a[2][1];
+	double c01 = a[1][2]*a[2][0]-a[1][0]*a[2][2];
+	double c02 = a[1][0]*a[2][1]-a[1][1]*a[2][0];
+	double det = sign*(a[0][0]*c00 + a[0][1]*c01 + a[0][2]*c02);
+	if (det <= 0.0)
+		return HUGE_VAL;
+
+	double normA2 = 0.0;
+	for (uint i=0; i<3; i++)
+		for (uint j=0; j<3; j++)
+			normA2 += a[i][j]*a[i][j];
+
+	if (objective == ColoredVolumicSmoother::inverseMeanRatio)
+		return normA2 / (3.0*std::pow(det, 2.0/3.0));
+
+	double c10 = a[0][2]*a[2][1]-a[0][1]*a[2][2];
+	double c11 = a[0][0]*a[2][2]-a[0][2]*a[2][0];
+	double c12 = a[0][1]*a[2][0]-a[0][0]*a[2][1];
+	double c20 = a[0][1]*a[1][2]-a[0][2]*a[1][1];
+	double c21 = a[0][2]*a[1][0]-a[0][0]*a[1][2];
+	double c22 = a[0][0]*a[1][1]-a[0][1]*a[1][0];
+	double normAdj2 = c00*c00+c01*c01+c02*c02
+			+c10*c10+c11*c11+c12*c12
+			+c20*c20+c21*c21+c22*c22;
+
+	return std::sqrt(normA2*normAdj2) / (3.0*det);
+}
+/*----------------------------------------------------------------------------*/
+ColoredVolumicSmoother::
+ColoredVolumicSmoother(uint nbCells, uint nbNodes,
+		const int* nbNodesCell, const int* cellNodes,
+		const double* weights, const double* relax)
+: m_cellPtr(nbCells+1, 0)
+, m_cellWeights(nbCells, 1.0)
+, m_nodeWeights(nbNodes, 1.0)
+, m_relax(relax, relax+nbNodes)
+, m_threaded(false)
+, m_laplace(true)
+, m_objective(conditionNumber)
+, m_x(0), m_y(0), m_z(0)
+{
+	for (uint c=0; c<nbCells; c++)
+		m_cellPtr[c+1] = m_cellPtr[c] + nbNodesCell[c];
+	m_cellNodes.resize(m_cellPtr[nbCells]);
+	for (size_t i=0; i<m_cellNodes.size(); i++){
+		if (cellNodes[i] < 0 || (uint)cellNodes[i] >= nbNodes){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+			message << "Erreur interne, ColoredVolumicSmoother avec un indice de noeud hors limite ("
+					<< (long)cellNodes[i] << ")";
+			throw TkUtil::Exception (message);
+		}
+		m_cellNodes[i] = cellNodes[i];
+	}
+	m_cellSign.resize(nbCells, 1.0);
+	if (weights){
+		m_cellWeights.assign(weights, weights+nbCells);
+		m_nodeWeights.assign(weights+nbCells, weights+nbCells+nbNodes);
+	}
+
+	buildAdjacencies(nbNodes);
+	buildColors(nbNodes);
+}
+/*----------------------------------------------------------------------------*/
+ColoredVolumicSmoother::
+~ColoredVolumicSmoother()
+{
+}
+/*----------------------------------------------------------------------------*/
+ColoredVolumicSmoother::ColoredVolumicSmoother(const ColoredVolumicSmoother&)
+{
+	MGX_FORBIDDEN("ColoredVolumicSmoother::ColoredVolumicSmoother is not allowed.");
+}
+/*----------------------------------------------------------------------------*/
+ColoredVolumicSmoother& ColoredVolumicSmoother::operator = (const ColoredVolumicSmoother&)
+{
+	MGX_FORBIDDEN("ColoredVolumicSmoother::operator = is not allowed.");
+	return *this;
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+buildAdjacencies(uint nbNodes)
+{
+	uint nbCells = m_cellPtr.size()-1;
+
+	// noeud -> mailles (transposée de maille -> noeuds)
+	m_nodeCellPtr.assign(nbNodes+1, 0);
+	for (size_t i=0; i<m_cellNodes.size(); i++)
+		m_nodeCellPtr[m_cellNodes[i]+1] += 1;
+	for (uint n=0; n<nbNodes; n++)
+		m_nodeCellPtr[n+1] += m_nodeCellPtr[n];
+	m_nodeCells.resize(m_nodeCellPtr[nbNodes]);
+	std::vector<size_t> pos(m_nodeCellPtr.begin(), m_nodeCellPtr.end()-1);
+	for (uint c=0; c<nbCells; c++)
+		for (size_t i=m_cellPtr[c]; i<m_cellPtr[c+1]; i++)
+			m_nodeCells[pos[m_cellNodes[i]]++] = c;
+
+	// noeud -> noeuds voisins par une arête, sans doublon et dans l'ordre croissant
+	m_nodeNbrPtr.assign(nbNodes+1, 0);
+	std::vector<uint> nbrs;
+	for (uint n=0; n<nbNodes; n++){
+		nbrs.clear();
+		for (size_t k=m_nodeCellPtr[n]; k<m_nodeCellPtr[n+1]; k++){
+			uint c = m_nodeCells[k];
+			const uint* cn = &m_cellNodes[m_cellPtr[c]];
+			uint nb = m_cellPtr[c+1]-m_cellPtr[c];
+			uint loc = 0;
+			while (cn[loc] != n)
+				loc++;
+			if (nb == 8)
+				for (uint j=0; j<3; j++)
+					nbrs.push_back(cn[hexCorners[loc][j]]);
+			else
+				for (uint j=0; j<nb; j++)
+					if (j != loc)
+						nbrs.push_back(cn[j]);
+		}
+		std::sort(nbrs.begin(), nbrs.end());
+		nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+		m_nodeNbrs.insert(m_nodeNbrs.end(), nbrs.begin(), nbrs.end());
+		m_nodeNbrPtr[n+1] = m_nodeNbrs.size();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+buildColors(uint nbNodes)
+{
+	// coloration gloutonne des noeuds libres, dans l'ordre des noeuds :
+	// deux noeuds partageant une maille ont des couleurs différentes
+	const uint noColor = (uint)-1;
+	std::vector<uint> colors(nbNodes, noColor);
+	std::vector<uint> forbidden;
+	std::vector<uint> nbByColor;
+
+	for (uint n=0; n<nbNodes; n++){
+		if (m_relax[n] == 0.0)
+			continue;
+		for (size_t k=m_nodeCellPtr[n]; k<m_nodeCellPtr[n+1]; k++){
+			uint c = m_nodeCells[k];
+			for (size_t i=m_cellPtr[c]; i<m_cellPtr[c+1]; i++){
+				uint col = colors[m_cellNodes[i]];
+				if (col != noColor)
+					forbidden[col] = n+1;
+			}
+		}
+		uint col = 0;
+		while (col < forbidden.size() && forbidden[col] == n+1)
+			col++;
+		if (col == forbidden.size()){
+			forbidden.push_back(0);
+			nbByColor.push_back(0);
+		}
+		colors[n] = col;
+		nbByColor[col] += 1;
+	}
+
+	m_colorPtr.assign(nbByColor.size()+1, 0);
+	for (uint col=0; col<nbByColor.size(); col++)
+		m_colorPtr[col+1] = m_colorPtr[col] + nbByColor[col];
+	m_colorNodes.resize(m_colorPtr.back());
+	std::vector<size_t> pos(m_colorPtr.begin(), m_colorPtr.end()-1);
+	for (uint n=0; n<nbNodes; n++)
+		if (colors[n] != noColor)
+			m_colorNodes[pos[colors[n]]++] = n;
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+laplace(double* x, double* y, double* z, int nbIterations)
+{
+	m_laplace = true;
+	m_x = x; m_y = y; m_z = z;
+	for (int iter=0; iter<nbIterations; iter++)
+		sweep();
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+optimize(eObjective objective, double* x, double* y, double* z, int nbIterations)
+{
+	m_laplace = false;
+	m_objective = objective;
+	m_x = x; m_y = y; m_z = z;
+
+	// orientation des mailles, pour ne pas dépendre de la convention de numérotation
+	uint nbCells = m_cellPtr.size()-1;
+	for (uint c=0; c<nbCells; c++){
+		const uint* cn = &m_cellNodes[m_cellPtr[c]];
+		uint nb = m_cellPtr[c+1]-m_cellPtr[c];
+		if (nb != 8 && nb != 4)
+			continue;
+		const int (*corners)[3] = (nb == 8 ? hexCorners : tetCorners);
+		double sum = 0.0;
+		for (uint k=0; k<nb; k++){
+			uint o = cn[k];
+			double a[3][3];
+			for (uint j=0; j<3; j++){
+				uint v = cn[corners[k][j]];
+				a[0][j] = m_x[v]-m_x[o];
+				a[1][j] = m_y[v]-m_y[o];
+				a[2][j] = m_z[v]-m_z[o];
+			}
+			sum += a[0][0]*(a[1][1]*a[2][2]-a[1][2]*a[2][1])
+					- a[0][1]*(a[1][0]*a[2][2]-a[1][2]*a[2][0])
+					+ a[0][2]*(a[1][0]*a[2][1]-a[1][1]*a[2][0]);
+		}
+		m_cellSign[c] = (sum < 0.0 ? -1.0 : 1.0);
+	}
+
+	for (int iter=0; iter<nbIterations; iter++)
+		sweep();
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+sweep()
+{
+	for (uint col=0; col<getNbColors(); col++){
+		size_t first = m_colorPtr[col];
+		size_t last = m_colorPtr[col+1];
+
+		if (!m_threaded || last-first <= smoothNodesPerTask){
+			smoothRange(first, last);
+			continue;
+		}
+
+		// les noeuds d'une même couleur n'ont pas de maille commune,
+		// ils sont déplacés simultanément
+		std::vector<ColoredSmoothingTask*> tasks;
+		std::vector<TkUtil::ThreadPool::TaskIfc*> t;
+		for (size_t f=first; f<last; f+=smoothNodesPerTask){
+			size_t l = f+smoothNodesPerTask;
+			if (l > last)
+				l = last;
+			ColoredSmoothingTask* task = new ColoredSmoothingTask(*this, f, l);
+			tasks.push_back(task);
+			t.push_back(task);
+		}
+		TkUtil::ThreadPool::instance().addTasks(t);
+		TkUtil::ThreadPool::instance().barrier();
+
+		TkUtil::UTF8String	errors (TkUtil::Charset::UTF_8);
+		for (uint i=0; i<tasks.size(); i++){
+			if (TkUtil::ThreadPool::TaskIfc::IN_ERROR == tasks[i]->getStatus()){
+				if (false == errors.empty())
+					errors << "\n";
+				errors << tasks[i]->getMessage();
+			}
+			delete tasks[i];
+		}
+		if (false == errors.empty()){
+			TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+			message << "Erreur lors du lissage volumique :\n" << errors;
+			throw TkUtil::Exception (message);
+		}
+	} // end for col<getNbColors()
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+smoothRange(size_t first, size_t last)
+{
+	if (m_laplace)
+		for (size_t i=first; i<last; i++)
+			laplaceNode(m_colorNodes[i]);
+	else
+		for (size_t i=first; i<last; i++)
+			optimizeNode(m_colorNodes[i]);
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+laplaceNode(uint node)
+{
+	size_t first = m_nodeNbrPtr[node];
+	size_t last = m_nodeNbrPtr[node+1];
+	if (first == last)
+		return;
+
+	double sx = 0.0, sy = 0.0, sz = 0.0, sw = 0.0;
+	for (size_t k=first; k<last; k++){
+		uint v = m_nodeNbrs[k];
+		double w = m_nodeWeights[v];
+		sx += w*m_x[v];
+		sy += w*m_y[v];
+		sz += w*m_z[v];
+		sw += w;
+	}
+	if (sw == 0.0)
+		return;
+	double r = m_relax[node];
+	m_x[node] += r*(sx/sw-m_x[node]);
+	m_y[node] += r*(sy/sw-m_y[node]);
+	m_z[node] += r*(sz/sw-m_z[node]);
+}
+/*----------------------------------------------------------------------------*/
+double ColoredVolumicSmoother::
+cellObjective(uint cell) const
+{
+	const uint* cn = &m_cellNodes[m_cellPtr[cell]];
+	uint nb = m_cellPtr[cell+1]-m_cellPtr[cell];
+	if (nb != 8 && nb != 4)
+		return 0.0;
+
+	const int (*corners)[3] = (nb == 8 ? hexCorners : tetCorners);
+	double sum = 0.0;
+	for (uint k=0; k<nb; k++){
+		uint o = cn[k];
+		double e[3][3];
+		for (uint j=0; j<3; j++){
+			uint v = cn[corners[k][j]];
+			e[0][j] = m_x[v]-m_x[o];
+			e[1][j] = m_y[v]-m_y[o];
+			e[2][j] = m_z[v]-m_z[o];
+		}
+		if (nb == 4){
+			// rapporté au tétraèdre régulier
+			double a[3][3];
+			for (uint i=0; i<3; i++)
+				for (uint j=0; j<3; j++)
+					a[i][j] = e[i][0]*tetWInv[0][j] + e[i][1]*tetWInv[1][j] + e[i][2]*tetWInv[2][j];
+			sum += cornerObjective(m_objective, a, m_cellSign[cell]);
+		}
+		else
+			sum += cornerObjective(m_objective, e, m_cellSign[cell]);
+	}
+	return sum;
+}
+/*----------------------------------------------------------------------------*/
+double ColoredVolumicSmoother::
+nodeObjective(uint node) const
+{
+	double sum = 0.0;
+	for (size_t k=m_nodeCellPtr[node]; k<m_nodeCellPtr[node+1]; k++){
+		uint c = m_nodeCells[k];
+		if (m_cellWeights[c] != 0.0)
+			sum += m_cellWeights[c]*cellObjective(c);
+	}
+	return sum;
+}
+/*----------------------------------------------------------------------------*/
+void ColoredVolumicSmoother::
+optimizeNode(uint node)
+{
+	size_t first = m_nodeNbrPtr[node];
+	size_t last = m_nodeNbrPtr[node+1];
+	if (first == last)
+		return;
+
+	double f0 = nodeObjective(node);
+	if (!(f0 < HUGE_VAL))
+		return; // maille dégénérée, on ne touche à rien
+
+	// longueur caractéristique
+	double length = 0.0;
+	for (size_t k=first; k<last; k++){
+		uint v = m_nodeNbrs[k];
+		double dx = m_x[v]-m_x[node];
+		double dy = m_y[v]-m_y[node];
+		double dz = m_z[v]-m_z[node];
+		length += std::sqrt(dx*dx+dy*dy+dz*dz);
+	}
+	length /= (double)(last-first);
+	if (length == 0.0)
+		return;
+
+	double* coords[3] = {m_x, m_y, m_z};
+	double p0[3] = {m_x[node], m_y[node], m_z[node]};
+
+	// gradient par différences centrées
+	double h = 1.0e-6*length;
+	double grad[3];
+	for (uint d=0; d<3; d++){
+		coords[d][node] = p0[d]+h;
+		double fp = nodeObjective(node);
+		coords[d][node] = p0[d]-h;
+		double fm = nodeObjective(node);
+		coords[d][node] = p0[d];
+		if (!(fp < HUGE_VAL) || !(fm < HUGE_VAL))
+			return;
+		grad[d] = (fp-fm)/(2.0*h);
+	}
+	double norm = std::sqrt(grad[0]*grad[0]+grad[1]*grad[1]+grad[2]*grad[2]);
+	if (norm == 0.0)
+		return;
+
+	// descente avec recherche linéaire par dichotomie
+	double step = 0.1*m_relax[node]*length;
+	for (uint k=0; k<12; k++, step*=0.5){
+		for (uint d=0; d<3; d++)
+			coords[d][node] = p0[d]-step*grad[d]/norm;
+		if (nodeObjective(node) < f0)
+			return;
+	}
+	for (uint d=0; d<3; d++)
+		coords[d][node] = p0[d];
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
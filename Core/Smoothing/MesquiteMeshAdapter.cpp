@@ -8,6 +8,7 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Smoothing/MesquiteMeshAdapter.h"
+#include "Utils/IndexedMap.h"
 /*----------------------------------------------------------------------------*/
 #include "GMDS/IG/Node.h"
 #include "GMDS/IG/Face.h"
@@ -27,7 +28,7 @@ namespace Mesh {
 MesquiteMeshAdapter::
 MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 			std::vector<gmds::Node >& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			std::map<gmds::TCellID, bool>& isPolyInverted,
 			uint maskFixed)
 : m_gmdsNodes(gmdsNodes)
@@ -48,7 +49,8 @@ MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 	MSQ_CHKERR (err);
 
 	// table de correspondance entre noeuds Gmds et indices pour Mesquite
-	std::map<gmds::TCellID, uint> num_insurf;
+	Utils::IndexedMap<gmds::TCellID, uint> num_insurf;
+	num_insurf.reserve(vertexCount);
 
 	for (uint i=0; i<vertexCount; i++){
 		gmds::Node nd = m_gmdsNodes[i];
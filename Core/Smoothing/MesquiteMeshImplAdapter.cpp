@@ -8,6 +8,7 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Smoothing/MesquiteMeshImplAdapter.h"
+#include "Utils/MarkVector.h"
 /*----------------------------------------------------------------------------*/
 //#include "GMDSMesh/Node.h"
 //#include "GMDSMesh/Face.h"
@@ -41,7 +42,7 @@ MesquiteMeshImplAdapter(
 	MSQ_CHKERR (err);
 
 	// table de correspondance entre noeuds Gmds et indices pour Mesquite
-	std::map<gmds::TCellID, uint> num_insurf;
+	Utils::MarkVector num_insurf;
 
 	gmds::IGMesh::node_iterator itn  = gmdsMesh.nodes_begin();
 
@@ -49,7 +50,7 @@ MesquiteMeshImplAdapter(
 	for(;!itn.isDone();itn.next()) {
 		gmds::Node current_node = itn.value();
 
-		num_insurf[current_node.getID()] = iVertexCount;
+		num_insurf.set(current_node.getID(), iVertexCount);
 
 		myMesh->reset_vertex (
 				iVertexCount,
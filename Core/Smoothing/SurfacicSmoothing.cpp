@@ -16,13 +16,21 @@
 #include "Smoothing/DistanceMdlQualityMetric.h"
 
 #include "Mesh/MeshManager.h"
+#include "Mesh/MeshImplementation.h"
+#include "Geom/Surface.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Utils/Common.h"
+#include "Utils/IndexedMap.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+#include <TkUtil/ThreadPool.h>
 #include <TkUtil/UTF8String.h>
 /*----------------------------------------------------------------------------*/
 #include <GMDS/IG/Node.h>
+#include <GMDS/IG/Face.h>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
 /*----------------------------------------------------------------------------*/
 //Mesquite
 #include "InstructionQueue.hpp"
@@ -40,6 +48,73 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+/// nombre minimum de polygones par morceau pour le lissage par morceaux
+static const size_t smoothPolygonsPerPatch = 2000;
+/*----------------------------------------------------------------------------*/
+/// un morceau de surface, lissé indépendamment des autres
+struct SmoothingPatch {
+	SmoothingPatch() : mesh(0), mdl_geom(0) {}
+	std::vector<gmds::Face> polygones;
+	std::vector<gmds::Node> nodes;
+	MesquiteMeshAdapter* mesh;
+	MesquiteDomainAdapter* mdl_geom;
+};
+/*----------------------------------------------------------------------------*/
+/**
+ * Tâche lissant un morceau de surface.
+ */
+class SmoothingPatchTask : public TkUtil::ThreadPool::TaskIfc
+{
+	public :
+
+	SmoothingPatchTask (const SurfacicSmoothing& smoothing, SmoothingPatch& patch)
+		: TkUtil::ThreadPool::TaskIfc ( ),
+		  _smoothing (smoothing), _patch (patch), _message ( )
+	{ }
+	virtual ~SmoothingPatchTask ( )
+	{ }
+
+	/**
+	 * \return	Message associé à l'exécution de la tache en cas d'erreur.
+	 */
+	const std::string& getMessage ( ) const
+	{ return _message; }
+
+	/**
+	 * Lissage du morceau, par le TkUtil::ThreadPool ou directement en
+	 * l'absence de threads.
+	 */
+	virtual void execute ( )
+	{
+		try
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::RUNNING);
+			_smoothing.threadedSmooth (_patch.mesh, _patch.mdl_geom, false);
+			setStatus (TkUtil::ThreadPool::TaskIfc::COMPLETED);
+		}
+		catch (const TkUtil::Exception& exc)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= exc.getFullMessage ( );
+		}
+		catch (...)
+		{
+			setStatus (TkUtil::ThreadPool::TaskIfc::IN_ERROR);
+			_message	= "Erreur non documentée.";
+		}
+	}	// execute
+
+
+	private :
+
+	SmoothingPatchTask (const SmoothingPatchTask&);
+	SmoothingPatchTask& operator = (const SmoothingPatchTask&);
+
+	const SurfacicSmoothing&	_smoothing;
+	SmoothingPatch&				_patch;
+	std::string					_message;
+};	// class SmoothingPatchTask
+/*----------------------------------------------------------------------------*/
 SurfacicSmoothing::
 SurfacicSmoothing()
  : MeshModificationItf()
@@ -47,6 +122,7 @@ SurfacicSmoothing()
 , m_nbIterations(10)
 , m_methodeLissage(surfacicOrthogonalSmoothingElliptic)
 , m_solver(gradientConjugue)
+, m_nbPatches(1)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -57,6 +133,19 @@ SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solv
 , m_nbIterations(nbIterations)
 , m_methodeLissage(methodeLissage)
 , m_solver(solver)
+, m_nbPatches(1)
+{
+}
+/*----------------------------------------------------------------------------*/
+SurfacicSmoothing::
+SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver,
+		int nbPatches)
+ : MeshModificationItf()
+, m_useDefaults(false)
+, m_nbIterations(nbIterations)
+, m_methodeLissage(methodeLissage)
+, m_solver(solver)
+, m_nbPatches(nbPatches < 1 ? 1 : nbPatches)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -71,6 +160,7 @@ SurfacicSmoothing::SurfacicSmoothing(const SurfacicSmoothing& lissage)
 , m_nbIterations(lissage.m_nbIterations)
 , m_methodeLissage(lissage.m_methodeLissage)
 , m_solver(lissage.m_solver)
+, m_nbPatches(lissage.m_nbPatches)
 {
 
 }
@@ -93,6 +183,12 @@ void SurfacicSmoothing::setSolver(eSolver solver)
 	m_solver = solver;
 }
 /*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::setNbPatches(int nbPatches)
+{
+	m_useDefaults = false;
+	m_nbPatches = (nbPatches < 1 ? 1 : nbPatches);
+}
+/*----------------------------------------------------------------------------*/
 SurfacicSmoothing& SurfacicSmoothing::operator = (const SurfacicSmoothing&)
 {
 	MGX_FORBIDDEN("SurfacicSmoothing::operator = is not allowed.");
@@ -123,16 +219,34 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 	description->addProperty (
 			Utils::SerializedRepresentation::Property (
 					"Solver", toString(getSolver())));
+
+	if (getNbPatches() > 1)
+		description->addProperty (
+				Utils::SerializedRepresentation::Property (
+						"Nombre de morceaux", (long)getNbPatches()));
 }
 /*----------------------------------------------------------------------------*/
 void SurfacicSmoothing::
 applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Face>& gmdsPolygones,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			std::map<gmds::TCellID, bool>& isPolyInverted,
 			uint maskFixed,
-			Geom::Surface* surface)
+			Geom::Surface* surface,
+			bool threaded)
 {
+	// nombre de morceaux lissés indépendamment, ne dépend que du paramètre
+	// et de la taille de la surface
+	uint nbPatches = 1;
+	if (m_nbIterations){
+		size_t maxPatches = gmdsPolygones.size()/smoothPolygonsPerPatch;
+		nbPatches = (uint)std::min((size_t)m_nbPatches, maxPatches);
+	}
+	if (nbPatches > 1){
+		applyModificationByPatches(gmdsNodes, gmdsPolygones, filtre_nodes,
+				isPolyInverted, maskFixed, surface, nbPatches, threaded);
+		return;
+	}
 
 	// définition du modèle pour Mesquite
 	MesquiteDomainAdapter* mdl_geom = new MesquiteDomainAdapter(surface);
@@ -141,123 +255,332 @@ applyModification(std::vector<gmds::Node >& gmdsNodes,
 	MesquiteMeshAdapter* mesh = new MesquiteMeshAdapter(gmdsPolygones, gmdsNodes,
 			filtre_nodes, isPolyInverted, maskFixed);
 
-	MeshDomainAssoc myAssoc (mesh, mdl_geom, false, false, true);
-
 	if (m_nbIterations){
 
-		if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic){
+		threadedSmooth(mesh, mdl_geom, true);
 
-			MESQUITE_NS::OrthogonalSmoothing algo(m_nbIterations);
+	} // end if (m_nbIterations)
 
-			const Mesquite2::Settings dummySettings;
-			MESQUITE_NS::MsqError err;
+	else {
+		// on fait juste une projection
+		MESQUITE_NS::MsqError err;
 
-			algo.loop_over_mesh (&myAssoc, &dummySettings, err);
-			MSQ_CHKERR(err);
+		std::vector<MESQUITE_NS::Mesh::VertexHandle> handles;
+		mesh->get_all_vertices(handles, err);
+		MSQ_CHKERR (err);
 
-		} else {
+		std::vector<MESQUITE_NS::MsqVertex> coords(handles.size());
+		mesh->vertices_get_coordinates(&handles[0], &coords[0], handles.size(), err);
+		MESQUITE_NS::Mesh::EntityHandle entity_handle = 0;
+		for (uint i = 0; i < handles.size(); i++)
+		{
+			mdl_geom->snap_to (entity_handle, coords[i]);
+			mesh->vertex_set_coordinates (handles[i], coords[i], err);
+		}
+		MSQ_CHKERR (err);
 
-			MESQUITE_NS::QualityMetric* qual =0;
-			switch (m_methodeLissage){
-			case surfacicNormalSmoothing:    qual = new MESQUITE_NS::NormaleQualityMetric(mdl_geom); break;
-			case surfacicOrthogonalSmoothing: qual = new MESQUITE_NS::OrthogonalQualityMetric; break;
-			}
+	}
 
-			if (qual == 0){
-				TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
-				messErr <<"Erreur Interne, méthode de lissage non initialisée";
-				throw TkUtil::Exception(messErr);
-			}
+	delete mesh;
 
-			// creates an intruction queue
-			MESQUITE_NS::InstructionQueue queue1;
-			MESQUITE_NS::MsqError err;
+	delete mdl_geom;
+}
+/*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::
+threadedSmooth(MesquiteMeshAdapter* mesh, MesquiteDomainAdapter* mdl_geom,
+		bool withAssessment) const
+{
+	MeshDomainAssoc myAssoc (mesh, mdl_geom, false, false, true);
 
-			// ... and builds an objective function with it
-			MESQUITE_NS::LPtoPTemplate obj_func (qual, 2, err);
-			MSQ_CHKERR (err);
+	if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic){
 
-			// distance à la modélisation (juste pour l'affichage de la qualité en terme de distance)
-			DistanceMdlQualityMetric *distqual = new DistanceMdlQualityMetric(mdl_geom);
+		MESQUITE_NS::OrthogonalSmoothing algo(m_nbIterations);
 
-			// Choix de la méthode d'optimisation
-			MESQUITE_NS::VertexMover* pass1 = 0;
-			if (m_solver == gradientConjugue) {
+		const Mesquite2::Settings dummySettings;
+		MESQUITE_NS::MsqError err;
 
-				MESQUITE_NS::ConjugateGradient* cg = new MESQUITE_NS::ConjugateGradient(&obj_func, err);
-				cg->use_global_patch();
-				pass1 = cg;
-			}
-			else if (m_solver == newton) {
-				MESQUITE_NS::FeasibleNewton* fn = new MESQUITE_NS::FeasibleNewton (&obj_func);
+		algo.loop_over_mesh (&myAssoc, &dummySettings, err);
+		MSQ_CHKERR(err);
 
-				fn->use_global_patch();
-				pass1 = fn;
-			}
+	} else {
 
-			if (pass1 == 0){
-				TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
-				messErr <<"Erreur Interne, solver pour lissage non initialisé";
-				throw TkUtil::Exception(messErr);
-			}
+		MESQUITE_NS::QualityMetric* qual =0;
+		switch (m_methodeLissage){
+		case surfacicNormalSmoothing:    qual = new MESQUITE_NS::NormaleQualityMetric(mdl_geom); break;
+		case surfacicOrthogonalSmoothing: qual = new MESQUITE_NS::OrthogonalQualityMetric; break;
+		}
 
-			QualityAssessor qa = MESQUITE_NS::QualityAssessor (qual);
-    		qa.add_quality_assessment(distqual);
+		if (qual == 0){
+			TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
+			messErr <<"Erreur Interne, méthode de lissage non initialisée";
+			throw TkUtil::Exception(messErr);
+		}
 
-			// Critères d'arret
-    		MESQUITE_NS::TerminationCriterion tc_inner;
-			tc_inner.add_iteration_limit (m_nbIterations);
+		// creates an intruction queue
+		MESQUITE_NS::InstructionQueue queue1;
+		MESQUITE_NS::MsqError err;
 
-			MESQUITE_NS::TerminationCriterion tc_outer;
-			tc_outer.add_iteration_limit (1);
+		// ... and builds an objective function with it
+		MESQUITE_NS::LPtoPTemplate obj_func (qual, 2, err);
+		MSQ_CHKERR (err);
 
-			// boucle interne
-			pass1->set_inner_termination_criterion (&tc_inner);
-			// boucle externe
-			pass1->set_outer_termination_criterion (&tc_outer);
+		// distance à la modélisation (juste pour l'affichage de la qualité en terme de distance)
+		DistanceMdlQualityMetric *distqual = new DistanceMdlQualityMetric(mdl_geom);
 
-			// Fait une mesure de la qualité et l'affiche (initiale)
+		// Choix de la méthode d'optimisation
+		MESQUITE_NS::VertexMover* pass1 = 0;
+		if (m_solver == gradientConjugue) {
+
+			MESQUITE_NS::ConjugateGradient* cg = new MESQUITE_NS::ConjugateGradient(&obj_func, err);
+			cg->use_global_patch();
+			pass1 = cg;
+		}
+		else if (m_solver == newton) {
+			MESQUITE_NS::FeasibleNewton* fn = new MESQUITE_NS::FeasibleNewton (&obj_func);
+
+			fn->use_global_patch();
+			pass1 = fn;
+		}
+
+		if (pass1 == 0){
+			TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
+			messErr <<"Erreur Interne, solver pour lissage non initialisé";
+			throw TkUtil::Exception(messErr);
+		}
+
+		QualityAssessor qa = MESQUITE_NS::QualityAssessor (qual);
+		qa.add_quality_assessment(distqual);
+
+		// Critères d'arret
+		MESQUITE_NS::TerminationCriterion tc_inner;
+		tc_inner.add_iteration_limit (m_nbIterations);
+
+		MESQUITE_NS::TerminationCriterion tc_outer;
+		tc_outer.add_iteration_limit (1);
+
+		// boucle interne
+		pass1->set_inner_termination_criterion (&tc_inner);
+		// boucle externe
+		pass1->set_outer_termination_criterion (&tc_outer);
+
+		// Fait une mesure de la qualité et l'affiche (initiale)
+		if (withAssessment){
 			queue1.add_quality_assessor (&qa, err);
 			MSQ_CHKERR (err);
-			// Optimisation <=> lissage
-			queue1.set_master_quality_improver (pass1, err);
-			MSQ_CHKERR (err);
-			// Fait une mesure de la qualité et l'affiche (finale)
+		}
+		// Optimisation <=> lissage
+		queue1.set_master_quality_improver (pass1, err);
+		MSQ_CHKERR (err);
+		// Fait une mesure de la qualité et l'affiche (finale)
+		if (withAssessment){
 			queue1.add_quality_assessor (&qa, err);
 			MSQ_CHKERR (err);
+		}
 
-			// c'est maintenant que l'on fait ce qui est dans queue1
-			MESQUITE_NS::MeshDomainAssoc myAssoc(mesh, mdl_geom);
-			queue1.run_instructions(&myAssoc, err);
-			MSQ_CHKERR (err);
+		// c'est maintenant que l'on fait ce qui est dans queue1
+		MESQUITE_NS::MeshDomainAssoc myAssoc(mesh, mdl_geom);
+		queue1.run_instructions(&myAssoc, err);
+		MSQ_CHKERR (err);
 
-			delete pass1;
-			delete qual;
-		} // end else if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic)
-	} // end if (m_nbIterations)
+		delete pass1;
+		delete qual;
+	} // end else if (m_methodeLissage == surfacicOrthogonalSmoothingElliptic)
+}
+/*----------------------------------------------------------------------------*/
+void SurfacicSmoothing::
+applyModificationByPatches(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const Utils::MarkVector& filtre_nodes,
+			std::map<gmds::TCellID, bool>& isPolyInverted,
+			uint maskFixed,
+			Geom::Surface* surface,
+			uint nbPatches, bool threaded)
+{
+	size_t nbNodes = gmdsNodes.size();
+	size_t nbPolys = gmdsPolygones.size();
+
+	// numérotation locale des noeuds
+	Utils::IndexedMap<gmds::TCellID, uint> num_local;
+	num_local.reserve(nbNodes);
+	for (size_t i=0; i<nbNodes; i++)
+		num_local[gmdsNodes[i].getID()] = i;
+
+	// tables de marques persistantes du maillage
+	Mesh::MeshImplementation* meshImpl =
+			dynamic_cast<Mesh::MeshImplementation*> (surface->getContext().getMeshManager().getMesh());
+	CHECK_NULL_PTR_ERROR(meshImpl);
+
+	// polygones -> noeuds, puis noeuds -> polygones (CSR)
+	std::vector<size_t> polyPtr(nbPolys+1, 0);
+	std::vector<uint> polyNodes;
+	for (size_t i=0; i<nbPolys; i++){
+		std::vector<gmds::TCellID> l_nds = gmdsPolygones[i].getAllIDs<gmds::Node>();
+		for (size_t j=0; j<l_nds.size(); j++)
+			polyNodes.push_back(num_local[l_nds[j]]);
+		polyPtr[i+1] = polyNodes.size();
+	}
+	std::vector<size_t> nodePtr(nbNodes+1, 0);
+	for (size_t k=0; k<polyNodes.size(); k++)
+		nodePtr[polyNodes[k]+1] += 1;
+	for (size_t n=0; n<nbNodes; n++)
+		nodePtr[n+1] += nodePtr[n];
+	std::vector<uint> nodePolys(polyNodes.size());
+	{
+		std::vector<size_t> pos(nodePtr.begin(), nodePtr.end()-1);
+		for (size_t i=0; i<nbPolys; i++)
+			for (size_t k=polyPtr[i]; k<polyPtr[i+1]; k++)
+				nodePolys[pos[polyNodes[k]]++] = i;
+	}
 
-	else {
-		// on fait juste une projection
-		MESQUITE_NS::MsqError err;
+	// parcours en largeur des polygones (par les noeuds), les morceaux sont
+	// des tranches consécutives de ce parcours, donc connexes autant que possible
+	std::vector<uint> order;
+	order.reserve(nbPolys);
+	std::vector<bool> visited(nbPolys, false);
+	for (size_t start=0; start<nbPolys; start++){
+		if (visited[start])
+			continue;
+		visited[start] = true;
+		size_t head = order.size();
+		order.push_back(start);
+		while (head < order.size()){
+			uint poly = order[head++];
+			for (size_t k=polyPtr[poly]; k<polyPtr[poly+1]; k++){
+				uint nd = polyNodes[k];
+				for (size_t l=nodePtr[nd]; l<nodePtr[nd+1]; l++)
+					if (!visited[nodePolys[l]]){
+						visited[nodePolys[l]] = true;
+						order.push_back(nodePolys[l]);
+					}
+			}
+		}
+	}
+	std::vector<uint> patchOfPoly(nbPolys);
+	for (size_t rank=0; rank<nbPolys; rank++)
+		patchOfPoly[order[rank]] = (uint)((rank*nbPatches)/nbPolys);
+
+	// noeuds d'interface : incidents à des polygones de morceaux différents
+	std::vector<bool> isInterface(nbNodes, false);
+	for (size_t n=0; n<nbNodes; n++)
+		for (size_t l=nodePtr[n]+1; l<nodePtr[n+1]; l++)
+			if (patchOfPoly[nodePolys[l]] != patchOfPoly[nodePolys[nodePtr[n]]]){
+				isInterface[n] = true;
+				break;
+			}
 
-		std::vector<MESQUITE_NS::Mesh::VertexHandle> handles;
-		mesh->get_all_vertices(handles, err);
-		MSQ_CHKERR (err);
+	// les noeuds d'interface sont figés pour le lissage des morceaux
+	Utils::MarkVectorLease filtre_patch_lease (meshImpl->getMarks ( ));
+	Utils::MarkVector& filtre_patch = filtre_patch_lease.marks ( );
+	for (size_t n=0; n<nbNodes; n++){
+		gmds::TCellID id = gmdsNodes[n].getID();
+		bool fixed = (filtre_nodes[id] == maskFixed || isInterface[n]);
+		filtre_patch.set(id, fixed ? maskFixed : maskFixed+1);
+	}
 
-		std::vector<MESQUITE_NS::MsqVertex> coords(handles.size());
-		mesh->vertices_get_coordinates(&handles[0], &coords[0], handles.size(), err);
-		MESQUITE_NS::Mesh::EntityHandle entity_handle = 0;
-		for (uint i = 0; i < handles.size(); i++)
-		{
-			mdl_geom->snap_to (entity_handle, coords[i]);
-			mesh->vertex_set_coordinates (handles[i], coords[i], err);
+	// construction des morceaux (séquentielle, isPolyInverted est modifiée)
+	std::vector<SmoothingPatch*> patches;
+	std::vector<uint> lastPatch(nbNodes, (uint)-1);
+	for (uint p=0; p<nbPatches; p++)
+		patches.push_back(new SmoothingPatch());
+	for (size_t i=0; i<nbPolys; i++){
+		uint p = patchOfPoly[i];
+		patches[p]->polygones.push_back(gmdsPolygones[i]);
+		for (size_t k=polyPtr[i]; k<polyPtr[i+1]; k++)
+			if (lastPatch[polyNodes[k]] != p){
+				lastPatch[polyNodes[k]] = p;
+				patches[p]->nodes.push_back(gmdsNodes[polyNodes[k]]);
+			}
+	}
+	for (uint p=0; p<nbPatches; p++){
+		patches[p]->mdl_geom = new MesquiteDomainAdapter(surface);
+		patches[p]->mesh = new MesquiteMeshAdapter(patches[p]->polygones, patches[p]->nodes,
+				filtre_patch, isPolyInverted, maskFixed);
+	}
+
+	// lissage des morceaux, en parallèle ou l'un après l'autre : ils ne
+	// partagent aucun noeud libre, le résultat est le même
+	std::vector<SmoothingPatchTask*> tasks;
+	std::vector<TkUtil::ThreadPool::TaskIfc*> t;
+	for (uint p=0; p<nbPatches; p++){
+		SmoothingPatchTask* task = new SmoothingPatchTask(*this, *patches[p]);
+		tasks.push_back(task);
+		t.push_back(task);
+	}
+	if (threaded){
+		TkUtil::ThreadPool::instance().addTasks(t);
+		TkUtil::ThreadPool::instance().barrier();
+	}
+	else
+		for (uint p=0; p<nbPatches; p++)
+			tasks[p]->execute();
+
+	TkUtil::UTF8String	errors (TkUtil::Charset::UTF_8);
+	for (uint i=0; i<tasks.size(); i++){
+		if (TkUtil::ThreadPool::TaskIfc::IN_ERROR == tasks[i]->getStatus()){
+			if (false == errors.empty())
+				errors << "\n";
+			errors << tasks[i]->getMessage();
 		}
-		MSQ_CHKERR (err);
+		delete tasks[i];
+	}
 
+	// retour vers gmds (destruction des MesquiteMeshAdapter)
+	for (uint p=0; p<nbPatches; p++){
+		delete patches[p]->mesh;
+		delete patches[p]->mdl_geom;
+		delete patches[p];
 	}
 
-	delete mesh;
+	if (false == errors.empty()){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Erreur lors du lissage surfacique de " << surface->getName() << " :\n" << errors;
+		throw TkUtil::Exception (message);
+	}
 
+	// relaxation des interfaces : seuls les noeuds d'interface non figés bougent,
+	// sur l'ensemble des polygones qui leur sont incidents
+	std::vector<gmds::Face> relaxPolygones;
+	std::vector<gmds::Node> relaxNodes;
+	std::vector<bool> polyTaken(nbPolys, false);
+	std::vector<bool> nodeTaken(nbNodes, false);
+	Utils::MarkVectorLease filtre_relax_lease (meshImpl->getMarks ( ));
+	Utils::MarkVector& filtre_relax = filtre_relax_lease.marks ( );
+	for (size_t n=0; n<nbNodes; n++){
+		if (!isInterface[n] || filtre_nodes[gmdsNodes[n].getID()] == maskFixed)
+			continue;
+		for (size_t l=nodePtr[n]; l<nodePtr[n+1]; l++){
+			uint poly = nodePolys[l];
+			if (polyTaken[poly])
+				continue;
+			polyTaken[poly] = true;
+			relaxPolygones.push_back(gmdsPolygones[poly]);
+			for (size_t k=polyPtr[poly]; k<polyPtr[poly+1]; k++){
+				uint nd = polyNodes[k];
+				if (nodeTaken[nd])
+					continue;
+				nodeTaken[nd] = true;
+				relaxNodes.push_back(gmdsNodes[nd]);
+				gmds::TCellID id = gmdsNodes[nd].getID();
+				bool fixed = (!isInterface[nd] || filtre_nodes[id] == maskFixed);
+				filtre_relax.set(id, fixed ? maskFixed : maskFixed+1);
+			}
+		}
+	}
+	if (relaxPolygones.empty())
+		return;
+
+	MesquiteDomainAdapter* mdl_geom = new MesquiteDomainAdapter(surface);
+	MesquiteMeshAdapter* mesh = new MesquiteMeshAdapter(relaxPolygones, relaxNodes,
+			filtre_relax, isPolyInverted, maskFixed);
+	try {
+		threadedSmooth(mesh, mdl_geom, true);
+	}
+	catch (...){
+		delete mesh;
+		delete mdl_geom;
+		throw;
+	}
+	delete mesh;
 	delete mdl_geom;
 }
 /*----------------------------------------------------------------------------*/
@@ -271,6 +594,8 @@ TkUtil::UTF8String SurfacicSmoothing::getScriptCommand() const
 		o << (short)getNbIterations();
 		o <<", "<<getMgx3DAlias()<<".SurfacicSmoothing." <<toString(getMethod());
 		o <<", "<<getMgx3DAlias()<<".SurfacicSmoothing." <<toString(getSolver());
+		if (getNbPatches() > 1)
+			o <<", "<<(short)getNbPatches();
 		o << ")";
 	}
 	return o;
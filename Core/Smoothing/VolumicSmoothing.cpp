@@ -8,8 +8,10 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Smoothing/VolumicSmoothing.h"
+#include "Smoothing/ColoredVolumicSmoother.h"
 #include "Mesh/MeshManager.h"
 #include "Utils/Common.h"
+#include "Utils/IndexedMap.h"
 #include "Geom/Volume.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -100,9 +102,10 @@ addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const
 void VolumicSmoothing::
 applyModification(std::vector<gmds::Node>& gmdsNodes,
 			std::vector<gmds::Region>& gmdsPolyedres,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			uint maskFixed,
-			Geom::Volume* volume)
+			Geom::Volume* volume,
+			bool threaded)
 {
 	uint nb_cells = gmdsPolyedres.size();
 	uint nb_vtx = gmdsNodes.size();
@@ -126,7 +129,8 @@ applyModification(std::vector<gmds::Node>& gmdsNodes,
 			  relax[i] = 1.0;
 
 	  // indirection des gmds::Node vers id dans structure Mesquite
-	  std::map<gmds::TCellID, uint> gmds2mesquite;
+	  Utils::IndexedMap<gmds::TCellID, uint> gmds2mesquite;
+	  gmds2mesquite.reserve(nb_vtx);
 	  for (uint i=0; i<nb_vtx; i++)
 		  gmds2mesquite[gmdsNodes[i].getID()] = i;
 
@@ -157,6 +161,22 @@ applyModification(std::vector<gmds::Node>& gmdsNodes,
 
 	  int err = 0;
 	  switch (m_methodeLissage){
+	  case coloredLaplace:
+	  case coloredConditionNumber:
+	  case coloredInverseMeanRatio:
+	  {
+		  // lisseur natif, par couleurs de noeuds indépendants
+		  ColoredVolumicSmoother smoother(nb_cells, nb_vtx,
+				  nb_node_cell, nodes_number, weights, relax);
+		  smoother.setThreaded(threaded);
+		  if (m_methodeLissage == coloredLaplace)
+			  smoother.laplace(x, y, z, m_nbIterations);
+		  else
+			  smoother.optimize(m_methodeLissage == coloredConditionNumber ?
+					  ColoredVolumicSmoother::conditionNumber : ColoredVolumicSmoother::inverseMeanRatio,
+					  x, y, z, m_nbIterations);
+	  }
+		  break;
 #ifdef USE_SMOOTH3D
 	  case laplace:
 
@@ -244,6 +264,12 @@ std::string VolumicSmoothing::toString(eVolumicMethod method)
 		return "conditionNumber";
 	else if (method == inverseMeanRatio)
 		return "inverseMeanRatio";
+	else if (method == coloredLaplace)
+		return "coloredLaplace";
+	else if (method == coloredConditionNumber)
+		return "coloredConditionNumber";
+	else if (method == coloredInverseMeanRatio)
+		return "coloredInverseMeanRatio";
 	else
 		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, une méthode de lissage volumique n'est pas encore prévue pour toString", TkUtil::Charset::UTF_8));
 }
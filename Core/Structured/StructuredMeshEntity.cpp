@@ -23,7 +23,7 @@ namespace Mgx3D
 namespace Structured
 {
 
-StructuredMeshEntity::StructuredMeshEntity (Context& context, Property* prop, DisplayProperties* disp, Structured::/*??*/StructuredMesh& mesh, const vector<Material*>& materials)
+StructuredMeshEntity::StructuredMeshEntity (Context& context, Property* prop, const DisplayProperties& disp, Structured::/*??*/StructuredMesh& mesh, const vector<Material*>& materials)
 	: InternalEntity (context, prop, disp), _mesh (&mesh), _materials (materials)
 {
 }	// StructuredMeshEntity::StructuredMeshEntity
@@ -63,9 +63,7 @@ StructuredMeshManager::~StructuredMeshManager ( )
 
 M3DCommandResultIfc* StructuredMeshManager::releaseMesh ( )
 {
-	UTF8String message (Charset::UTF_8);
-	message << "StructuredMeshManager::releaseMesh ( )";
-	log (TraceLog (message, TkUtil::Log::TRACE_5));
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_5, "StructuredMeshManager::releaseMesh ( )");
 
 	CommandReleaseStructuredData*	cmd	= new CommandReleaseStructuredData (dynamic_cast<Context&>(getContext ( )), "Déchargement des données structurées");
 	UTF8String script (Charset::UTF_8);
@@ -38,6 +38,8 @@
 #endif	// USE_MESHGEMS
 
 #include "Mesh/CommandCreateMesh.h"
+#include "Mesh/MeshManager.h"
+#include "Mesh/MeshItf.h"
 
 #include "Internal/Context.h"
 #include "Internal/InfoCommand.h"
@@ -115,9 +117,8 @@ Block(Internal::Context& ctx,
 , m_mesh_data(new BlockMeshingData())
 , m_save_mesh_data(0)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Block::Block(), dans le cas quelconque avec "<<faces.size()<<" faces";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4,
+            "Block::Block(), dans le cas quelconque avec "<<faces.size()<<" faces");
 
     if (isStructured){
         m_mesh_property = new BlockMeshingPropertyTransfinite();
@@ -181,9 +182,7 @@ Block(Internal::Context& ctx, int ni, int nj, int nk,
 , m_mesh_data(new BlockMeshingData())
 , m_save_mesh_data(0)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Block::Block(), dans le cas structuré\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Block::Block(), dans le cas structuré\n");
 
     // NB, il manque l'axe de rotation pour construire un BlockMeshingPropertyRotational
     if (ml == BlockMeshingProperty::directional)
@@ -1284,7 +1283,7 @@ getDescription (bool alsoComputed) const
                 Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)m_mesh_data->nodes().size()));
 
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de polyèdres", (long)m_mesh_data->regions().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de polyèdres", (long)m_mesh_data->getNbRegions()));
     }
 
 
@@ -1450,10 +1449,12 @@ structure(Internal::InfoCommand* icmd)
     delete prop;
 
 #ifdef _DEBUG2
-	TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
-    message2 << "Block::structure(), donne comme bloc:\n";
-    message2<<*this;
-    log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message2 (TkUtil::Charset::UTF_8);
+        message2 << "Block::structure(), donne comme bloc:\n";
+        message2<<*this;
+        log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_4));
+    }
 #endif
 }
 /*----------------------------------------------------------------------------*/
@@ -1982,27 +1983,17 @@ saveBlockMeshingProperty(Internal::InfoCommand* icmd)
 {
     if (icmd) {
         bool change = icmd->addTopoInfoEntity(this,Internal::InfoCommand::OTHERMODIFIED);
-        if (change && m_save_mesh_property == 0){
-        	if (isMeshed()){
-				TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        		message << "On ne peut pas modifier un bloc alors qu'il est déjà maillé.";
-        		throw TkUtil::Exception (message);
-        	}
-        	else
-        		m_save_mesh_property = m_mesh_property->clone();
-        }
+        if (change && m_save_mesh_property == 0)
+        	m_save_mesh_property = m_mesh_property->clone();
+
+        // si le bloc est maillé, son maillage sera à mettre à jour (CommandUpdateMesh)
+        updateModificationStamp();
     }
 }
 /*----------------------------------------------------------------------------*/
 void Block::
 switchBlockMeshingProperty(Internal::InfoCommand* icmd, BlockMeshingProperty* prop)
 {
-	if (isMeshed()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-		message << "On ne peut pas modifier un bloc ("<<getName()<<") alors qu'il est déjà maillé.";
-		throw TkUtil::Exception (message);
-	}
-
     if (icmd && m_save_mesh_property == 0)
         m_save_mesh_property = m_mesh_property;
     else
@@ -2014,6 +2005,8 @@ switchBlockMeshingProperty(Internal::InfoCommand* icmd, BlockMeshingProperty* pr
 #endif
     if (icmd)
         icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
+
+    updateModificationStamp();
 }
 /*----------------------------------------------------------------------------*/
 void Block::
@@ -2035,6 +2028,22 @@ saveBlockTopoProperty(Internal::InfoCommand* icmd)
     }
 }
 /*----------------------------------------------------------------------------*/
+std::vector<gmds::TCellID>& Block::
+nodes()
+{
+    if (m_mesh_data->structuredMesh())
+        getContext().getLocalMeshManager().getMesh()->buildStructuredMesh(this);
+    return m_mesh_data->nodes();
+}
+/*----------------------------------------------------------------------------*/
+std::vector<gmds::TCellID>& Block::
+regions()
+{
+    if (m_mesh_data->structuredMesh())
+        getContext().getLocalMeshManager().getMesh()->buildStructuredMesh(this);
+    return m_mesh_data->regions();
+}
+/*----------------------------------------------------------------------------*/
 void Block::
 saveBlockMeshingData(Internal::InfoCommand* icmd)
 {
@@ -3623,7 +3632,7 @@ int Block::
 getNbRegions()
 {
     if (isMeshed())
-        return regions().size();
+        return m_mesh_data->getNbRegions();
 
     if (isStructured()) {
         uint nbBrasI = 0;
@@ -1024,27 +1024,22 @@ void CoEdge::getPoints(std::vector<Utils::Math::Point> &points) const
 	// protection pour éviter les appels concurrents pouvant modifier le preMesh
 	TkUtil::AutoMutex autoMutex (&preMeshMutex);
 
-	// s'il existe des noeuds ou des points, est-ce que la date de création est compatible ?
-	bool pointsUpToDate = (m_mesh_property->getModificationTime() < m_mesh_data->getPointsTime());
-
-	if (isMeshed() && !pointsUpToDate){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-		message<<"Erreur interne, L'arête "<<getName()<<" a été modifiée après qu'elle soit maillée";
-		throw TkUtil::Exception (message);
-	}
+	// une arête modifiée après avoir été maillée donne les points de sa
+	// nouvelle discrétisation, en attendant la mise à jour du maillage
+	const bool meshUpToDate = isMeshed() && !isModifiedSinceMeshed();
 
 	if (!isPreMeshed()){
 		m_mesh_data->points().clear();
 		getPoints(m_mesh_property, m_mesh_data->points(), true);
 		getMeshingData()->setPreMeshed(true);
 #ifdef _DEBUG_GETPOINTS
-		std::cout<<getName()<<" => est prémaillée"<<(pointsUpToDate?"":" (actualisation)")<<std::endl;
+		std::cout<<getName()<<" => est prémaillée"<<(meshUpToDate?"":" (actualisation)")<<std::endl;
 #endif
 
 		getMeshingData()->updatePointsTime();
 	}
 
-	if (isMeshed()){
+	if (meshUpToDate){
 
 	    gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
 
@@ -1368,9 +1363,11 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 						message << "\nLe pb est peut-être lié à une projection sur un demi cercle => couper l'arête en deux";
 
 						// message plus important au niveau des logs
-						TkUtil::UTF8String	messageComplet (TkUtil::Charset::UTF_8);
-						messageComplet<<message<<", message remonté : "<<exc.getMessage();
-						getContext().getLogStream()->log(TkUtil::TraceLog (messageComplet, TkUtil::Log::TRACE_3));
+						if (getContext().isLogEnabled (TkUtil::Log::TRACE_3)){
+							TkUtil::UTF8String	messageComplet (TkUtil::Charset::UTF_8);
+							messageComplet<<message<<", message remonté : "<<exc.getMessage();
+							getContext().getLogStream()->log(TkUtil::TraceLog (messageComplet, TkUtil::Log::TRACE_3));
+						}
 
 						throw TkUtil::Exception (message);
 					}
@@ -1385,9 +1382,11 @@ getPoints(CoEdgeMeshingProperty* dni, std::vector<Utils::Math::Point> &points, b
 					message << "\nLe pb est peut-être lié à une projection en dehors de la surface => découper l'arête et revoir les associations";
 
 					// message plus important au niveau des logs
-					TkUtil::UTF8String	messageComplet (TkUtil::Charset::UTF_8);
-					messageComplet<<message<<", message remonté : "<<exc.getMessage();
-					getContext().getLogStream()->log(TkUtil::TraceLog (messageComplet, TkUtil::Log::TRACE_3));
+					if (getContext().isLogEnabled (TkUtil::Log::TRACE_3)){
+						TkUtil::UTF8String	messageComplet (TkUtil::Charset::UTF_8);
+						messageComplet<<message<<", message remonté : "<<exc.getMessage();
+						getContext().getLogStream()->log(TkUtil::TraceLog (messageComplet, TkUtil::Log::TRACE_3));
+					}
 
 					throw TkUtil::Exception (message);
 				}
@@ -2209,15 +2208,8 @@ void CoEdge::
 saveCoEdgeMeshingProperty(Internal::InfoCommand* icmd)
 {
     if (icmd) {
-        bool change = icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
-
-        //std::cout<<"CoEdge::saveCoEdgeMeshingProperty pour "<<getName()<<", change = "<<(change?"True":"False")<<std::endl;
-
-        if (change && isMeshed()){
-        	TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-        	message << "On ne peut pas modifier une arête alors qu'elle est déjà maillée.";
-        	throw TkUtil::Exception (message);
-        }
+        // si l'arête est maillée, son maillage sera à mettre à jour (CommandUpdateMesh)
+        icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
 
         if (m_save_mesh_property == 0){
         	m_save_mesh_property = m_mesh_property->clone();
@@ -2228,12 +2220,6 @@ saveCoEdgeMeshingProperty(Internal::InfoCommand* icmd)
 void CoEdge::
 switchCoEdgeMeshingProperty(Internal::InfoCommand* icmd, CoEdgeMeshingProperty* prop)
 {
-	if (isMeshed()){
-		TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-		message << "On ne peut pas modifier une arête ("<<getName()<<") alors qu'elle est déjà maillée.";
-		throw TkUtil::Exception (message);
-	}
-
     if (icmd && m_save_mesh_property == 0)
         m_save_mesh_property = m_mesh_property;
     else
@@ -2245,6 +2231,7 @@ switchCoEdgeMeshingProperty(Internal::InfoCommand* icmd, CoEdgeMeshingProperty*
         icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
 
     m_mesh_property->updateModificationTime();
+    updateModificationStamp();
 }
 /*----------------------------------------------------------------------------*/
 void CoEdge::
@@ -2554,9 +2541,7 @@ getNbVertices() const
 {
 #ifdef _DEBUG
     if (isDestroyed()){
-        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-        message << "CoEdge::getNbVertices() pour arête "<<getName()<<" détruite !";
-        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "CoEdge::getNbVertices() pour arête "<<getName()<<" détruite !");
     }
 #endif
     return m_topo_property->getVertexContainer().getNb();
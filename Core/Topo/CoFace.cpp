@@ -1740,9 +1740,7 @@ uint CoFace::getNbVertices() const
 {
 #ifdef _DEBUG
     if (isDestroyed()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message << "CoFace::getNbVertices() pour face "<<getName()<<" DETRUITE !!!";
-        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "CoFace::getNbVertices() pour face "<<getName()<<" DETRUITE !!!");
     }
 #endif
     return m_topo_property->getVertexContainer().getNb();
@@ -1761,12 +1759,14 @@ getEdge(Topo::Vertex* v1, Topo::Vertex* v2) const
     }
 
     // on a échoué
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "CoFace::getEdge("
-            <<v1->getName()<<","
-            <<v2->getName()<<")\n";
-    message1 << "this :"<<*this;
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 << "CoFace::getEdge("
+                <<v1->getName()<<","
+                <<v2->getName()<<")\n";
+        message1 << "this :"<<*this;
+        log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    }
 
 	TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
     messErr << "CoFace::getEdge("<<v1->getName()<<", "<<v2->getName()<<") ne trouve pas l'arête pour ces 2 sommets dans "<<getName();
@@ -2856,16 +2856,18 @@ getNodes(Topo::Vertex* sommet1, Topo::Vertex* sommet2, Topo::Vertex* sommet3, To
 {
     uint nbVtx = getNbVertices();
 #ifdef _DEBUG
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "CoFace::getNodes("
-            <<sommet1->getName()<<","
-            <<sommet2->getName()<<","
-            <<sommet3->getName();
-    if (nbVtx == 4)
-        message1 <<","<<sommet4->getName();
-    message1 <<") pour la face commune "
-            <<getName()<<"\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 << "CoFace::getNodes("
+                <<sommet1->getName()<<","
+                <<sommet2->getName()<<","
+                <<sommet3->getName();
+        if (nbVtx == 4)
+            message1 <<","<<sommet4->getName();
+        message1 <<") pour la face commune "
+                <<getName()<<"\n";
+        log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    }
 #endif
 
     if (!isStructured())
@@ -3112,21 +3114,23 @@ fuse(CoFace* face_B,
 {
 #ifdef _DEBUG
     // LOG
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "CoFace::fuse(...) \n";
-    message1 << "## pour "<<*this;
-    message1 << "## avec  face_B : "<<*face_B;
-    message1 << "l_sommets_A : ";
-    for (std::vector<Topo::Vertex* >::const_iterator iter = l_sommets_A.begin();
-            iter != l_sommets_A.end(); ++iter)
-        message1 << " " << **iter;
-    message1 << "\n";
-    message1 << "l_sommets_B : ";
-    for (std::vector<Topo::Vertex* >::const_iterator iter = l_sommets_B.begin();
-            iter != l_sommets_B.end(); ++iter)
-        message1 << " " << **iter;
-    message1 << "\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+        message1 << "CoFace::fuse(...) \n";
+        message1 << "## pour "<<*this;
+        message1 << "## avec  face_B : "<<*face_B;
+        message1 << "l_sommets_A : ";
+        for (std::vector<Topo::Vertex* >::const_iterator iter = l_sommets_A.begin();
+                iter != l_sommets_A.end(); ++iter)
+            message1 << " " << **iter;
+        message1 << "\n";
+        message1 << "l_sommets_B : ";
+        for (std::vector<Topo::Vertex* >::const_iterator iter = l_sommets_B.begin();
+                iter != l_sommets_B.end(); ++iter)
+            message1 << " " << **iter;
+        message1 << "\n";
+        log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    }
 #endif
 
     // précondition: les listes de sommets doivent être de même taille
@@ -3314,27 +3318,17 @@ saveCoFaceMeshingProperty(Internal::InfoCommand* icmd)
 {
     if (icmd) {
         bool change = icmd->addTopoInfoEntity(this,Internal::InfoCommand::OTHERMODIFIED);
-        if (change && m_save_mesh_property == 0){
-        	if (isMeshed()){
-        		TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-        		message << "On ne peut pas modifier une face alors qu'elle est déjà maillée.";
-        		throw TkUtil::Exception (message);
-        	}
-        	else
-        		m_save_mesh_property = m_mesh_property->clone();
-        }
+        if (change && m_save_mesh_property == 0)
+        	m_save_mesh_property = m_mesh_property->clone();
+
+        // si la face est maillée, son maillage sera à mettre à jour (CommandUpdateMesh)
+        updateModificationStamp();
     }
 }
 /*----------------------------------------------------------------------------*/
 void CoFace::
 switchCoFaceMeshingProperty(Internal::InfoCommand* icmd, CoFaceMeshingProperty* prop)
 {
-	if (isMeshed()){
-		TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-		message << "On ne peut pas modifier une face ("<<getName()<<") alors qu'elle est déjà maillée.";
-		throw TkUtil::Exception (message);
-	}
-
     // propagation aux entités topologiques de niveau supérieur
     if (icmd){
         bool old_strutured = isStructured();
@@ -3361,6 +3355,8 @@ switchCoFaceMeshingProperty(Internal::InfoCommand* icmd, CoFaceMeshingProperty*
 #endif
     if (icmd)
         icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
+
+    updateModificationStamp();
 }
 /*----------------------------------------------------------------------------*/
 void CoFace::
@@ -3465,10 +3461,12 @@ permuteToJmaxEdge(Edge* edge, Internal::InfoCommand* icmd)
 
     // prérequis
     if (getNbVertices() != 4 || getNbEdges() != 4 || !isStructured()){
-		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-        message1 << "CoFace::permuteToJmaxEdge(...) pour "<<*this;
-        message1 << " avec edge : "<<*edge;
-        log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+        if (isLogEnabled (TkUtil::Log::TRACE_4)){
+			TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+            message1 << "CoFace::permuteToJmaxEdge(...) pour "<<*this;
+            message1 << " avec edge : "<<*edge;
+            log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+        }
         throw TkUtil::Exception (TkUtil::UTF8String ("CoFace::permuteToJmaxEdge n'est possible qu'avec une face commune structurée à 4 sommets et 4 arêtes",  TkUtil::Charset::UTF_8));
     }
 
@@ -3526,10 +3524,12 @@ permuteToLastEdge(Edge* edge, Internal::InfoCommand* icmd)
 
     // prérequis
     if (isStructured() && getNbVertices() == getNbEdges()){
-		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-        message1 << "CoFace::permuteToLastEdge(...) pour "<<*this;
-        message1 << " avec edge : "<<*edge;
-        log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+        if (isLogEnabled (TkUtil::Log::TRACE_4)){
+			TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+            message1 << "CoFace::permuteToLastEdge(...) pour "<<*this;
+            message1 << " avec edge : "<<*edge;
+            log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+        }
         throw TkUtil::Exception (TkUtil::UTF8String ("CoFace::permuteToLastEdge n'est possible qu'avec une face commune non-structurée", TkUtil::Charset::UTF_8));
     }
 
@@ -451,9 +451,9 @@ void CommandDestroyTopo::checkInterpolates()
 	std::map<std::string, uint> deletedCoEdges;
 	std::map<std::string, uint> deletedCoFaces;
 	Internal::InfoCommand& ifc = getInfoCommand();
-	std::map<Topo::TopoEntity*, Internal::InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	Internal::InfoCommand::TopoInfoMap tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			iter != tei.end(); ++iter){
 		//std::cout<<" observation pour "<<iter->first->getName()<<" de type "<<Internal::InfoCommand::type2String(iter->second)<<std::endl;
 		if (iter->first->getType() ==  Utils::Entity::TopoCoEdge && iter->second == Internal::InfoCommand::DELETED)
@@ -105,8 +105,8 @@ saveInternalsStats()
 #endif
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         te->saveInternals(this);
@@ -119,9 +119,13 @@ saveInternalsStats()
 void CommandEditTopo::permInternalsStats()
 {
 //    std::cout<<"CommandEditTopo::permInternalsStats()"<<std::endl;
+// les entités retrouvent leur état d'avant (ou d'après) la commande,
+// leur maillage éventuel n'est plus à jour
 #define PERM_PROPERTY(T,L) \
-    for (std::vector <T>::iterator iter = L.begin(); iter != L.end(); ++iter) \
-		(*iter).m_property = (*iter).m_entity->setProperty((*iter).m_property);
+    for (std::vector <T>::iterator iter = L.begin(); iter != L.end(); ++iter){ \
+		(*iter).m_property = (*iter).m_entity->setProperty((*iter).m_property); \
+		(*iter).m_entity->updateModificationStamp(); \
+    }
 
     PERM_PROPERTY (TopoPropertyInfo,          m_topo_property_info);
     PERM_PROPERTY (VertexGeomPropertyInfo,    m_vertex_geom_property_info);
@@ -194,9 +198,9 @@ void CommandEditTopo::deleteCreated()
     // elles avaient été créées avec la commande
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         Internal::InfoCommand::type t = iter_tei->second;
@@ -252,9 +256,9 @@ deleteMarkedDeleted()
     // elles avaient été créées avec la commande
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         Internal::InfoCommand::type t = iter_tei->second;
@@ -273,8 +277,8 @@ cleanTemporaryEntities()
     std::vector<Topo::TopoEntity*> toDelete;
 
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    Internal::InfoCommand::TopoInfoMap& topo_entities_info = icmd.getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         Internal::InfoCommand::type& t = iter_tei->second;
@@ -392,8 +396,8 @@ registerToManagerCreatedEntities()
     std::cout<<getInfoCommand()<<std::endl;
 #endif
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& tie = getInfoCommand().getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter = tie.begin();
+    Internal::InfoCommand::TopoInfoMap& tie = getInfoCommand().getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter = tie.begin();
             iter != tie.end(); ++iter){
         Topo::TopoEntity* te = iter->first;
         Internal::InfoCommand::type t = iter->second;
@@ -534,8 +538,8 @@ previewBegin()
 #ifdef _DEBUG_PREVIEW
     std::cout<<"==== arêtes créées en sortie de previewBegin ===="<<std::endl;
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
     		iter_tei != topo_entities_info.end(); ++iter_tei){
     	Topo::TopoEntity* te = iter_tei->first;
     	Internal::InfoCommand::type t = iter_tei->second;
@@ -577,9 +581,9 @@ getPreviewRepresentationTopoModif(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
     		iter_tei != topo_entities_info.end(); ++iter_tei){
     	Topo::TopoEntity* te = iter_tei->first;
     	Internal::InfoCommand::type t = iter_tei->second;
@@ -631,9 +635,9 @@ getPreviewRepresentationNewCoedges(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
     		iter_tei != topo_entities_info.end(); ++iter_tei){
     	Topo::TopoEntity* te = iter_tei->first;
     	Internal::InfoCommand::type t = iter_tei->second;
@@ -671,9 +675,9 @@ getPreviewRepresentationCoedgeDisplayModified(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
     		iter_tei != topo_entities_info.end(); ++iter_tei){
     	Topo::TopoEntity* te = iter_tei->first;
     	Internal::InfoCommand::type t = iter_tei->second;
@@ -711,9 +715,9 @@ getPreviewRepresentationDeletedTopo(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
     		iter_tei != topo_entities_info.end(); ++iter_tei){
     	Topo::TopoEntity* te = iter_tei->first;
     	Internal::InfoCommand::type t = iter_tei->second;
@@ -55,12 +55,12 @@ internalExecute()
 
     // les cofaces au bord associées au premier volume
     std::vector<CoFace*> cofaces1;
-    std::set<Topo::CoFace*> cofaces;
+    std::vector<Topo::CoFace*> cofaces;
     std::vector<Topo::Block*> blocs;
     m_vol_A->get(blocs);
     Topo::TopoHelper::get(blocs, cofaces);
 
-    for (std::set<Topo::CoFace*>::iterator iter = cofaces.begin();
+    for (std::vector<Topo::CoFace*>::iterator iter = cofaces.begin();
     		iter != cofaces.end(); ++iter)
     	if ((*iter)->getNbBlocks() == 1)
     		cofaces1.push_back(*iter);
@@ -80,7 +80,7 @@ internalExecute()
     m_vol_B->get(blocs);
     Topo::TopoHelper::get(blocs, cofaces);
 
-    for (std::set<Topo::CoFace*>::iterator iter = cofaces.begin();
+    for (std::vector<Topo::CoFace*>::iterator iter = cofaces.begin();
     		iter != cofaces.end(); ++iter)
     	if ((*iter)->getNbBlocks() == 1)
     		cofaces2.push_back(*iter);
@@ -18,6 +18,7 @@
 #include "Utils/Common.h"
 
 #include "Topo/TopoHelper.h"
+#include "Topo/VertexLocator.h"
 #include "Topo/Vertex.h"
 #include "Topo/CoEdge.h"
 #include "Topo/CoFace.h"
@@ -256,12 +257,13 @@ void CommandModificationTopo::MAJCoEdges()
                 		if (coedges1.size() == coedges2.size()){
                 			// Pour chacun des sommets des arêtes, on fait la fusion avec le sommet proche de l'autre groupe
                 			std::vector<Topo::Vertex*> all_vertices2 = getAllVertices(newEntities[0]);
+                			VertexLocator locator2(all_vertices2, tol);
 
                 			std::map<Vertex*, uint> filtre_vertices;
 
                 			for (uint i=0; i<all_vertices.size(); i++){
                 				Topo::Vertex* vtx0 = all_vertices[i];
-                				Topo::Vertex* vtx0new = TopoHelper::getVertexAtPosition(all_vertices2, vtx0->getCoord(), tol);
+                				Topo::Vertex* vtx0new = locator2.find(vtx0->getCoord());
 
                 				if (vtx0new){
 #ifdef _DEBUG_MAJTOPO
@@ -849,11 +851,11 @@ MAJInternalsCoFaces()
     std::cout<<"CommandModificationTopo::MAJInternalsCoFaces()"<<std::endl;
 #endif
     // on parcours les cofaces modifiées à la recherche de celles non structurées, associées à rien et entre 2 blocs
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& tei = getInfoCommand().getTopoInfoEntity();
+    Internal::InfoCommand::TopoInfoMap& tei = getInfoCommand().getTopoInfoEntity();
     std::list<Topo::Block*> l_blocks;
     std::map<Topo::CoFace*, uint> filtre_cofaces;
     std::vector<Topo::CoFace*> v_cofaces_to_delete;
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+    for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
          iter != tei.end(); ++iter) {
         if (iter->first->getDim() == 2 && iter->second == Internal::InfoCommand::DISPMODIFIED){
             Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(iter->first);
@@ -1376,9 +1378,10 @@ fuseInternalCoEdgesAndVertices(Geom::GeomEntity* ge, std::vector<Geom::GeomEntit
 #endif
    	std::map<Vertex*, uint> filtre_vertices;
     	double tol = ge->getArea()*Utils::Math::MgxNumeric::mgxTopoDoubleEpsilon;
+    	VertexLocator locator2(all_vertices2, tol);
     	for (uint i=0; i<internalVertices.size(); i++){
     		Topo::Vertex* vtx0 = internalVertices[i];
-    		Topo::Vertex* vtx0new = TopoHelper::getVertexAtPosition(all_vertices2, vtx0->getCoord(), tol);
+    		Topo::Vertex* vtx0new = locator2.find(vtx0->getCoord());
 
     		if (vtx0new){
 #ifdef _DEBUG_MAJTOPO
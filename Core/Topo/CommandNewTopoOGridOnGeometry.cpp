@@ -584,14 +584,16 @@ createCylinderTopoOGrid()
 
 #ifdef _DEBUG2
     // LOG de la Topo résultante
-	TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
-    std::vector<Block* > blocks;
-    getBlocks(blocks);
-    message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
-    for (std::vector<Block* >::iterator iter = blocks.begin();
-            iter != blocks.end(); ++iter)
-        message_result << **iter;
-    log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
+        std::vector<Block* > blocks;
+        getBlocks(blocks);
+        message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
+        for (std::vector<Block* >::iterator iter = blocks.begin();
+                iter != blocks.end(); ++iter)
+            message_result << **iter;
+        log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    }
 #endif
 }
 /*----------------------------------------------------------------------------*/
@@ -3399,14 +3401,16 @@ createHollowCylinderTopo()
 
 #ifdef _DEBUG2
     // LOG de la Topo résultante
-	TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
-    std::vector<Block* > blocks;
-    getBlocks(blocks);
-    message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
-    for (std::vector<Block* >::iterator iter = blocks.begin();
-            iter != blocks.end(); ++iter)
-        message_result << **iter;
-    log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
+        std::vector<Block* > blocks;
+        getBlocks(blocks);
+        message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
+        for (std::vector<Block* >::iterator iter = blocks.begin();
+                iter != blocks.end(); ++iter)
+            message_result << **iter;
+        log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    }
 #endif
 }
 /*----------------------------------------------------------------------------*/
@@ -4468,14 +4472,16 @@ createConeTopoOGrid()
 
 #ifdef _DEBUG2
     // LOG de la Topo résultante
-	TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
-    std::vector<Block* > blocks;
-    getBlocks(blocks);
-    message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
-    for (std::vector<Block* >::iterator iter = blocks.begin();
-            iter != blocks.end(); ++iter)
-        message_result << **iter;
-    log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message_result (TkUtil::Charset::UTF_8);
+        std::vector<Block* > blocks;
+        getBlocks(blocks);
+        message_result << "CommandNewTopoOGridOnGeometry donne comme topologie: \n";
+        for (std::vector<Block* >::iterator iter = blocks.begin();
+                iter != blocks.end(); ++iter)
+            message_result << **iter;
+        log (TkUtil::TraceLog (message_result, TkUtil::Log::TRACE_4));
+    }
 #endif
 }
 /*----------------------------------------------------------------------------*/
@@ -10,17 +10,98 @@
 #include "Topo/CommandSplitBlocks.h"
 
 #include "Utils/Common.h"
+#include "Utils/IndexedMap.h"
+#include "Utils/MarkVector.h"
 #include "Topo/Block.h"
+#include "Topo/CoEdge.h"
 #include "Topo/TopoHelper.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/UTF8String.h>
 #include <TkUtil/Exception.h>
 /*----------------------------------------------------------------------------*/
+#include <functional>
+#include <queue>
+/*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
+/** Front de propagation de la découpe.
+ *
+ * Lorsqu'une arête est marquée, seuls les blocs qui lui sont incidents sont
+ * ajoutés à la file. La file est ordonnée suivant l'indice des blocs dans
+ * m_blocs, les blocs sont donc découpés dans le même ordre qu'avec un
+ * parcours complet de m_blocs à chaque étape (noms des entités créées
+ * inchangés lors du rejeu d'un script).
+ *
+ * Ce n'est vrai que si un bloc possède ses arêtes marquées dès leur
+ * marquage. C'est le cas des arêtes marquées, communes aux 2 blocs issus
+ * d'une découpe et créées par elle avec les faces qui les portent. Sinon le
+ * parcours complet de secours, fait quand la file est vide, trouve le bloc
+ * plus tard que le parcours de m_blocs à chaque étape.
+ * Le paramètre ContextIfc::getSplitBlocksFullScan impose ce parcours
+ * complet à chaque étape, pour comparaison.
+ */
+struct CommandSplitBlocks::Front {
+	/// état d'un bloc dans m_state
+	enum {NONE = 0, QUEUED, SPLIT};
+
+	Front(const std::vector<Block*>& blocs, bool fullScan)
+	: m_blocs(blocs), m_state(blocs.size())
+	, m_fullScan(fullScan)
+	{
+		m_indices.reserve(blocs.size());
+		for (uint i=0; i<blocs.size(); i++)
+			m_indices.insert(std::make_pair(blocs[i], i));
+	}
+
+	/// marque l'arête et ajoute à la file ses blocs non découpés
+	void mark(CoEdge* coedge)
+	{
+		m_coedges[coedge] = true;
+		if (m_fullScan)
+			return;
+		std::vector<Block*> blocs;
+		coedge->getBlocks(blocs);
+		for (uint i=0; i<blocs.size(); i++){
+			const size_t idx = m_indices.indexOf(blocs[i]);
+			if (idx == Utils::IndexedMap<Block*, uint>::npos())
+				continue;
+			const uint ind = m_indices.at(idx).second;
+			if (m_state.get(ind) == NONE){
+				m_state.set(ind, QUEUED);
+				m_queue.push(ind);
+			}
+		}
+	}
+
+	/// la première arête marquée du bloc, 0 si aucune
+	CoEdge* getMarkedCoEdge(Block* bloc) const
+	{
+		std::vector<CoEdge* > coedges;
+		bloc->getCoEdges(coedges);
+		for (uint i=0; i<coedges.size(); i++)
+			if (m_coedges.indexOf(coedges[i]) != Utils::IndexedMap<CoEdge*, bool>::npos())
+				return coedges[i];
+		return 0;
+	}
+
+	/// les blocs à découper
+	const std::vector<Block*>& m_blocs;
+	/// indice des blocs dans m_blocs
+	Utils::IndexedMap<Block*, uint> m_indices;
+	/// arêtes marquées (table de hachage, pas de table par id unique
+	/// dimensionnée sur toute la session)
+	Utils::IndexedMap<CoEdge*, bool> m_coedges;
+	/// état des blocs, par indice
+	Utils::MarkVector m_state;
+	/// blocs en attente, le plus petit indice en tête
+	std::priority_queue<uint, std::vector<uint>, std::greater<uint> > m_queue;
+	/// vrai pour un parcours complet de m_blocs à chaque étape
+	bool m_fullScan;
+};
+/*----------------------------------------------------------------------------*/
 CommandSplitBlocks::
 CommandSplitBlocks(Internal::Context& c, std::vector<Topo::Block* > &blocs, CoEdge* arete, double ratio)
 :CommandEditTopo(c, std::string("Découpage de plusieurs blocs"))
@@ -156,11 +237,8 @@ internalExecute()
     uint nb_blocs_dep = m_blocs.size();
     uint nb_blocs_split = 0;
 
-    std::set<CoEdge*> filtre_coedges;
-    std::set<Block*> filtre_blocs;
-
-    filtre_coedges.insert(m_arete);
-    //std::cout<<"  filtre_coedges.insert("<<m_arete->getName()<<")\n";
+    Front front(m_blocs, getContext().getSplitBlocksFullScan());
+    front.mark(m_arete);
 
     try {
     	do {
@@ -168,7 +246,7 @@ internalExecute()
     		Block* bloc = 0;
 
     		// recherche d'un bloc suivant avec une arête
-    		findBlockUnmarkedWithCoEdgeMarked(filtre_blocs, filtre_coedges, bloc, arete);
+    		findBlockUnmarkedWithCoEdgeMarked(front, bloc, arete);
 
     		// Les blocs créés
     		std::vector<Block* > newBlocks;
@@ -179,7 +257,6 @@ internalExecute()
     			bloc->split(m_arete, m_ratio, newBlocks, &getInfoCommand());
 
     		nb_blocs_split+=1;
-    		filtre_blocs.insert(bloc);
 
     		// marquer les aretes entre les 2 séries de blocs
     		if (newBlocks.size() != 2){
@@ -190,10 +267,8 @@ internalExecute()
 
     		std::vector<CoEdge*> newCoedges = TopoHelper::getCommonCoEdges(newBlocks[0], newBlocks[1]);
 
-    		for (std::vector<CoEdge*>::iterator iter=newCoedges.begin(); iter!=newCoedges.end(); ++iter){
-    			//std::cout<<"  filtre_coedges.insert("<<(*iter)->getName()<<")\n";
-    			filtre_coedges.insert(*iter);
-    		}
+    		for (std::vector<CoEdge*>::iterator iter=newCoedges.begin(); iter!=newCoedges.end(); ++iter)
+    			front.mark(*iter);
 
     	} while (nb_blocs_dep != nb_blocs_split);
     }
@@ -214,26 +289,37 @@ internalExecute()
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocks::
-findBlockUnmarkedWithCoEdgeMarked(std::set<Block*>& filtre_blocs,
-		std::set<CoEdge*>& filtre_coedges, Block* &bloc, CoEdge* &arete)
+findBlockUnmarkedWithCoEdgeMarked(Front& front, Block* &bloc, CoEdge* &arete)
 {
-	//std::cout<<"findBlockUnmarkedWithCoEdgeMarked ..."<<std::endl;
-	for (std::vector<Block*>::iterator iter1 = m_blocs.begin(); iter1 != m_blocs.end(); ++iter1){
-		// le bloc est-il marqué ?
-		//std::cout<<" bloc "<<(*iter1)->getName()<<std::endl;
-		if (filtre_blocs.find(*iter1) == filtre_blocs.end()){
-			Block* bl = *iter1;
-			//std::cout<<"   pas encore vu, on recherche une arête ..."<<std::endl;
-			// possède-t-il une arête marquée ?
-			std::vector<CoEdge* > coedges;
-			bl->getCoEdges(coedges);
-			for (std::vector<CoEdge*>::iterator iter2 = coedges.begin(); iter2 != coedges.end(); ++iter2){
-				if (filtre_coedges.find(*iter2) != filtre_coedges.end()){
-					arete = *iter2;
-					bloc = bl;
-					return;
-				}
-			}
+	while (!front.m_queue.empty()){
+		const uint ind = front.m_queue.top();
+		front.m_queue.pop();
+		Block* bl = m_blocs[ind];
+		// le bloc a pu perdre son arête marquée depuis son ajout,
+		// il sera remis dans la file par une prochaine arête marquée
+		CoEdge* coedge = front.getMarkedCoEdge(bl);
+		if (coedge){
+			front.m_state.set(ind, Front::SPLIT);
+			arete = coedge;
+			bloc = bl;
+			return;
+		}
+		front.m_state.set(ind, Front::NONE);
+	}
+
+	// file vide : parcours complet, pour le cas d'un bloc qui aurait acquis
+	// une arête marquée sans qu'elle lui soit incidente lors du marquage
+	// (voir Front), ou à chaque étape avec ContextIfc::getSplitBlocksFullScan
+	for (uint ind=0; ind<m_blocs.size(); ind++){
+		// un bloc présent plusieurs fois n'est vu qu'à sa première position
+		if (front.m_indices[m_blocs[ind]] != ind || front.m_state.get(ind) == Front::SPLIT)
+			continue;
+		CoEdge* coedge = front.getMarkedCoEdge(m_blocs[ind]);
+		if (coedge){
+			front.m_state.set(ind, Front::SPLIT);
+			arete = coedge;
+			bloc = m_blocs[ind];
+			return;
 		}
 	}
 	throw FindBlockException(TkUtil::UTF8String ( "On ne trouve pas de couple arête-bloc pour propager la découpe", TkUtil::Charset::UTF_8));
@@ -2234,8 +2234,8 @@ void CommandSplitBlocksWithOgrid::updateNbMeshingEdges()
 	SetNbMeshingEdgesImplementation implementation(&getInfoCommand());
 
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
+    Internal::InfoCommand::TopoInfoMap& topo_entities_info = icmd.getTopoInfoEntity();
+    for (Internal::InfoCommand::TopoInfoMap::iterator iter_tei = topo_entities_info.begin();
             iter_tei != topo_entities_info.end(); ++iter_tei){
         Topo::TopoEntity* te = iter_tei->first;
         Internal::InfoCommand::type& t = iter_tei->second;
@@ -841,12 +841,10 @@ void Edge::
 getNodes(Vertex* v1, Vertex* v2, std::vector<gmds::Node>& vectNd)
 {
 #ifdef _DEBUG2
-	UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "Edge::getNodes( \""
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Edge::getNodes( \""
             << v1->getName() << "\", "
             << v2->getName() << "\") avec l'arête : "
-            << *this;
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+            << *this);
 #endif
 
     vectNd.clear();
@@ -999,9 +997,7 @@ getNbVertices() const
 {
 #ifdef _DEBUG
     if (isDestroyed()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message << "Edge::getNbVertices() pour arête "<<getName()<<" détruite !";
-        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Edge::getNbVertices() pour arête "<<getName()<<" détruite !");
     }
 #endif
     return m_topo_property->getVertexContainer().getNb();
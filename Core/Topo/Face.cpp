@@ -275,9 +275,7 @@ getNbVertices() const
 {
 #ifdef _DEBUG
     if (isDestroyed()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message << "Face::getNbVertices() pour face "<<getName()<<" DETRUITE !!!";
-        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Face::getNbVertices() pour face "<<getName()<<" DETRUITE !!!");
     }
 #endif
     return m_topo_property->getVertexContainer().getNb();
@@ -741,14 +739,12 @@ void Face::
 getNodes(Vertex* sommet1, Vertex* sommet2, Vertex* sommet3, Vertex* sommet4,
         std::vector<gmds::Node> &vectNd)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Face::getNodes("
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Face::getNodes("
             <<sommet1->getName()<<","
             <<sommet2->getName()<<","
             <<sommet3->getName()<<","
             <<sommet4->getName()<<") pour la face "
-            <<getName()<<"\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+            <<getName()<<"\n");
     //std::cout<<*this<<std::endl;
 
     if (!isStructured())
@@ -1041,13 +1037,11 @@ getNodes(uint decalage,
         bool sens_directe,
         std::vector<gmds::Node> &vectNd)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Face::getNodes(decalage: "
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "Face::getNodes(decalage: "
             <<(short)decalage<<","
             <<(sens_directe?"sens normal":"sens inverse")
             <<", vectNd) pour la face "
-            <<getName()<<"\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+            <<getName()<<"\n");
 
     // il n'est prévu de passer par cette fonction que pour le cas dégénéré en 3 sommets
     // avec une seule coface
@@ -2031,10 +2025,12 @@ _permuteToFirstAndLastVertices(Vertex* v1, Vertex* v2, Internal::InfoCommand* ic
 
     if (isStructured()){
         if (getNbVertices() != 4){
-			TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-            message1 << "Face::_permuteToFirstAndLastVertices(...) pour "<<*this;
-            message1 << " avec v1 : "<<*v1<< " et v2 : "<<*v2;
-            log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+            if (isLogEnabled (TkUtil::Log::TRACE_4)){
+				TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+                message1 << "Face::_permuteToFirstAndLastVertices(...) pour "<<*this;
+                message1 << " avec v1 : "<<*v1<< " et v2 : "<<*v2;
+                log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+            }
             throw TkUtil::Exception (TkUtil::UTF8String ("Face::_permuteToFirstAndLastVertices n'est possible qu'avec une face structurée à 4 sommets", TkUtil::Charset::UTF_8));
         }
 
@@ -8,7 +8,9 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Internal/ContextIfc.h"
+#include "Internal/Context.h"
 #include "Topo/TopoEntity.h"
+#include "Topo/TopoManager.h"
 #include "Topo/CommandEditTopo.h"
 #include "Geom/GeomEntity.h"
 #include "Mesh/CommandCreateMesh.h"
@@ -24,12 +26,16 @@ namespace Mgx3D {
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 //#define _DEBUG_MEMORY
+unsigned long TopoEntity::s_stamp = 0;
+/*----------------------------------------------------------------------------*/
 TopoEntity::TopoEntity(Internal::Context& ctx,
                        Utils::Property* prop,
-                       Utils::DisplayProperties* disp)
+                       const Utils::DisplayProperties& disp)
 : Internal::InternalEntity (ctx, prop, disp)
 , m_topo_property(new TopoProperty())
 , m_save_topo_property(0)
+, m_modification_stamp(0)
+, m_mesh_stamp(0)
 {
 #ifdef _DEBUG_MEMORY
     std::cout<<"TopoEntity::TopoEntity() de nom "<<getName()<<std::endl;
@@ -102,6 +108,9 @@ void TopoEntity::setDestroyed(bool b)
 
 
     Entity::setDestroyed(b);
+
+    // le manager tient le compte des entités non détruites
+    getContext().getLocalTopoManager().updateDestroyed(this);
 }
 /*----------------------------------------------------------------------------*/
 void TopoEntity::
@@ -132,6 +141,9 @@ setGeomAssociation(Geom::GeomEntity* ge)
     // la relation Topo vers Geom
     m_topo_property->setGeomAssociation(ge);
 
+    // le maillage dépend de la projection
+    updateModificationStamp();
+
     if (need_update_color)
     	updateDisplayPropertiesColor();
 }
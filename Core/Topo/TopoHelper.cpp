@@ -9,6 +9,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/ContextIfc.h"
 /*----------------------------------------------------------------------------*/
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -31,6 +32,8 @@
 #include "Utils/Point.h"
 #include "Utils/Vector.h"
 #include "Utils/MgxNumeric.h"
+#include "Utils/IndexedMap.h"
+#include "Utils/MarkVector.h"
 #include <TkUtil/MemoryError.h>
 
 /*----------------------------------------------------------------------------*/
@@ -254,17 +257,9 @@ void TopoHelper::getCoEdges(const std::vector<Edge* > & edges,
 void TopoHelper::getCoFaces(const std::vector<Block* > & blocs,
             std::vector<CoFace* > & cofaces)
 {
-	std::list<CoFace*> liste;
-
-	for (std::vector<Block* >::const_iterator iter = blocs.begin();
-				iter != blocs.end(); ++iter){
-			std::vector<CoFace* > l_cofaces;
-			(*iter)->getCoFaces(l_cofaces);
-			liste.insert(liste.end(), l_cofaces.begin(), l_cofaces.end());
-		}
-
-	liste.sort(Utils::Entity::compareEntity);
-	liste.unique();
+	// les entités accessibles, sans doublon et triées suivant l'id unique
+	std::vector<CoFace*> liste;
+	get(blocs, liste);
 
 	cofaces.insert(cofaces.end(), liste.begin(), liste.end());
 }
@@ -272,17 +267,9 @@ void TopoHelper::getCoFaces(const std::vector<Block* > & blocs,
 void TopoHelper::getCoEdges(const std::vector<CoFace* > & faces,
             std::vector<CoEdge* > & coedges)
 {
-	std::list<CoEdge*> liste;
-
-	for (std::vector<CoFace* >::const_iterator iter = faces.begin();
-			iter != faces.end(); ++iter){
-		std::vector<CoEdge* > l_coedges;
-		(*iter)->getCoEdges(l_coedges, false);
-		liste.insert(liste.end(), l_coedges.begin(), l_coedges.end());
-	}
-
-	liste.sort(Utils::Entity::compareEntity);
-	liste.unique();
+	// les entités accessibles, sans doublon et triées suivant l'id unique
+	std::vector<CoEdge*> liste;
+	get(faces, liste);
 
 	coedges.insert(coedges.end(), liste.begin(), liste.end());
 }
@@ -290,17 +277,9 @@ void TopoHelper::getCoEdges(const std::vector<CoFace* > & faces,
 void TopoHelper::getCoEdges(const std::vector<Block* > & blocs,
             std::vector<CoEdge* > & coedges)
 {
-	std::list<CoEdge*> liste;
-
-	for (std::vector<Block* >::const_iterator iter = blocs.begin();
-			iter != blocs.end(); ++iter){
-		std::vector<CoEdge* > l_coedges;
-		(*iter)->getCoEdges(l_coedges, false);
-		liste.insert(liste.end(), l_coedges.begin(), l_coedges.end());
-	}
-
-	liste.sort(Utils::Entity::compareEntity);
-	liste.unique();
+	// les entités accessibles, sans doublon et triées suivant l'id unique
+	std::vector<CoEdge*> liste;
+	get(blocs, liste);
 
 	coedges.insert(coedges.end(), liste.begin(), liste.end());
 }
@@ -341,216 +320,463 @@ void TopoHelper::getVertices(const std::vector<Block* > & blocs,
 	vertices.insert(vertices.end(), liste.begin(), liste.end());
 }
 /*----------------------------------------------------------------------------*/
-void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::Block*>& blocks)
+namespace {
+/*----------------------------------------------------------------------------*/
+/** Marques des parcours sans doublon, indexées par l'id unique des entités.
+ *  Chaque parcours emprunte sa propre table (parcours imbriqués et threads
+ *  possibles), les tables sont conservées d'un parcours à l'autre.
+ */
+Utils::MarkVectorPool s_topo_marks;
+/*----------------------------------------------------------------------------*/
+/** Collecte sans doublon d'entités topologiques dans un vecteur.
+ *  Les entités sont marquées dans une table propre au collecteur, le vecteur
+ *  est trié suivant l'id unique lors de la destruction du collecteur.
+ */
+template <typename T>
+class UniqueCollector {
+public:
+	UniqueCollector(std::vector<T*>& out)
+	: m_out(out), m_lease(s_topo_marks)
+	{
+		// les entités déjà présentes ne seront pas ajoutées de nouveau
+		for (uint i=0; i<m_out.size(); i++)
+			m_lease.marks().set(m_out[i]->getUniqueId(), 1);
+	}
+
+	~UniqueCollector()
+	{
+		std::sort(m_out.begin(), m_out.end(), Utils::Entity::compareEntity);
+	}
+
+	void add(T* te)
+	{
+		Utils::MarkVector& marks = m_lease.marks();
+		if (!marks.isMarked(te->getUniqueId())){
+			marks.set(te->getUniqueId(), 1);
+			m_out.push_back(te);
+		}
+	}
+
+	void add(const std::vector<T*>& tes)
+	{
+		for (uint i=0; i<tes.size(); i++)
+			add(tes[i]);
+	}
+
+private:
+	std::vector<T*>& m_out;
+	Utils::MarkVectorLease m_lease;
+};
+/*----------------------------------------------------------------------------*/
+// parcours partageant un même collecteur (pas de marquage imbriqué)
+void collect(const std::vector<Topo::Block*>& blocks, UniqueCollector<CoFace>& cofaces)
+{
+	std::vector<Topo::CoFace* > loc_cofaces;
+	for (uint k=0; k<blocks.size(); k++){
+		blocks[k]->getCoFaces(loc_cofaces);
+		cofaces.add(loc_cofaces);
+	}
+}
+void collect(const std::vector<Topo::Block*>& blocks, UniqueCollector<CoEdge>& coedges)
+{
+	std::vector<Topo::CoEdge* > loc_coedges;
+	for (uint k=0; k<blocks.size(); k++){
+		// les doublons sont filtrés par le collecteur
+		blocks[k]->getCoEdges(loc_coedges, false);
+		coedges.add(loc_coedges);
+	}
+}
+void collect(const std::vector<Topo::Block*>& blocks, UniqueCollector<Vertex>& vertices)
+{
+	for (uint k=0; k<blocks.size(); k++)
+		vertices.add(blocks[k]->getVertices());
+}
+void collect(const std::vector<Topo::CoFace*>& cofaces, UniqueCollector<CoEdge>& coedges)
+{
+	std::vector<Topo::CoEdge* > loc_coedges;
+	for (uint k=0; k<cofaces.size(); k++){
+		cofaces[k]->getCoEdges(loc_coedges, false);
+		coedges.add(loc_coedges);
+	}
+}
+void collect(const std::vector<Topo::CoFace*>& cofaces, UniqueCollector<Vertex>& vertices)
+{
+	for (uint k=0; k<cofaces.size(); k++)
+		vertices.add(cofaces[k]->getVertices());
+}
+void collect(const std::vector<Topo::CoEdge*>& coedges, UniqueCollector<Vertex>& vertices)
+{
+	for (uint k=0; k<coedges.size(); k++)
+		vertices.add(coedges[k]->getVertices());
+}
+void collect(const std::vector<Geom::Vertex*>& vtx, UniqueCollector<Vertex>& vertices)
+{
+	for (uint k=0; k<vtx.size(); k++){
+		std::vector<Topo::Vertex* > loc_vertices;
+		vtx[k]->get(loc_vertices);
+		vertices.add(loc_vertices);
+	}
+}
+void collect(const std::vector<Geom::Curve*>& curves, UniqueCollector<CoEdge>& coedges)
+{
+	for (uint k=0; k<curves.size(); k++){
+		std::vector<Topo::CoEdge* > loc_coedges;
+		curves[k]->get(loc_coedges);
+		coedges.add(loc_coedges);
+	}
+}
+void collect(const std::vector<Geom::Curve*>& curves, UniqueCollector<Vertex>& vertices, bool propagate)
+{
+	for (uint k=0; k<curves.size(); k++){
+		std::vector<Topo::CoEdge* > loc_coedges;
+		curves[k]->get(loc_coedges);
+		collect(loc_coedges, vertices);
+
+		if (propagate){
+			// on parcours les sommets pour les cas sans arêtes ...
+			std::vector<Geom::Vertex*> vtx;
+			curves[k]->get(vtx);
+			collect(vtx, vertices);
+		}
+	}
+}
+void collect(const std::vector<Geom::Surface*>& surfaces, UniqueCollector<CoFace>& cofaces)
+{
+	for (uint k=0; k<surfaces.size(); k++){
+		std::vector<Topo::CoFace* > loc_cofaces;
+		surfaces[k]->get(loc_cofaces);
+		cofaces.add(loc_cofaces);
+	}
+}
+void collect(const std::vector<Geom::Surface*>& surfaces, UniqueCollector<CoEdge>& coedges, bool propagate)
+{
+	for (uint j=0; j<surfaces.size(); j++){
+		// les coedges depuis les faces
+		std::vector<Topo::CoFace*> cofaces;
+		surfaces[j]->get(cofaces);
+		collect(cofaces, coedges);
+
+		if (propagate){
+			// on parcours les courbes pour les cas sans faces ...
+			std::vector<Geom::Curve*> curves;
+			surfaces[j]->get(curves);
+			collect(curves, coedges);
+		}
+	}
+}
+void collect(const std::vector<Geom::Surface*>& surfaces, UniqueCollector<Vertex>& vertices, bool propagate)
+{
+	for (uint j=0; j<surfaces.size(); j++){
+		// les vertices depuis les faces
+		std::vector<Topo::CoFace*> cofaces;
+		surfaces[j]->get(cofaces);
+		collect(cofaces, vertices);
+
+		if (propagate){
+			// on parcours les courbes pour les cas sans faces ...
+			std::vector<Geom::Curve*> curves;
+			surfaces[j]->get(curves);
+			collect(curves, vertices, propagate);
+
+			// on parcours les sommets pour les cas sans arêtes ...
+			std::vector<Geom::Vertex*> vtx;
+			surfaces[j]->get(vtx);
+			collect(vtx, vertices);
+		}
+	}
+}
+void collect(const std::vector<Geom::Volume*>& volumes, UniqueCollector<Block>& blocks)
 {
 	for (uint j=0; j<volumes.size(); j++){
 		std::vector<Topo::Block*> loc_blocks;
 		volumes[j]->get(loc_blocks);
-		blocks.insert(loc_blocks.begin(), loc_blocks.end());
+		blocks.add(loc_blocks);
 	}
 }
-/*----------------------------------------------------------------------------*/
-void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::CoFace*>& cofaces, bool propagate)
+void collect(const std::vector<Geom::Volume*>& volumes, UniqueCollector<CoFace>& cofaces, bool propagate)
 {
 	for (uint j=0; j<volumes.size(); j++){
 		// les cofaces depuis les blocs
 		std::vector<Topo::Block*> blocs;
 		volumes[j]->get(blocs);
-		Topo::TopoHelper::get(blocs, cofaces);
+		collect(blocs, cofaces);
 
 		if (propagate){
 			// on parcours les surfaces pour les cas sans blocs ...
 			std::vector<Geom::Surface*> surfaces;
 			volumes[j]->get(surfaces);
-			Topo::TopoHelper::get(surfaces, cofaces);
+			collect(surfaces, cofaces);
 		}
 	}
 }
-/*----------------------------------------------------------------------------*/
-void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::CoEdge*>& coedges, bool propagate)
+void collect(const std::vector<Geom::Volume*>& volumes, UniqueCollector<CoEdge>& coedges, bool propagate)
 {
 	for (uint j=0; j<volumes.size(); j++){
 		// les coedges depuis les blocs
 		std::vector<Topo::Block*> blocs;
 		volumes[j]->get(blocs);
-		Topo::TopoHelper::get(blocs, coedges);
+		collect(blocs, coedges);
 
 		if (propagate){
 			// on parcours les surfaces pour les cas sans blocs ...
 			std::vector<Geom::Surface*> surfaces;
 			volumes[j]->get(surfaces);
-			Topo::TopoHelper::get(surfaces, coedges, propagate);
+			collect(surfaces, coedges, propagate);
 
 			// on parcours les courbes pour les cas sans faces ...
 			std::vector<Geom::Curve*> curves;
 			volumes[j]->get(curves);
-			Topo::TopoHelper::get(curves, coedges);
+			collect(curves, coedges);
 		}
 	}
 }
-/*----------------------------------------------------------------------------*/
-void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::Vertex*>& vertices, bool propagate)
+void collect(const std::vector<Geom::Volume*>& volumes, UniqueCollector<Vertex>& vertices, bool propagate)
 {
 	for (uint j=0; j<volumes.size(); j++){
 		// les vertices depuis les blocs
 		std::vector<Topo::Block*> blocs;
 		volumes[j]->get(blocs);
-		Topo::TopoHelper::get(blocs, vertices);
+		collect(blocs, vertices);
 
 		if (propagate){
 			// on parcours les surfaces pour les cas sans blocs ...
 			std::vector<Geom::Surface*> surfaces;
 			volumes[j]->get(surfaces);
-			Topo::TopoHelper::get(surfaces, vertices, propagate);
+			collect(surfaces, vertices, propagate);
 
 			// on parcours les courbes pour les cas sans faces ...
 			std::vector<Geom::Curve*> curves;
 			volumes[j]->get(curves);
-			Topo::TopoHelper::get(curves, vertices, propagate);
+			collect(curves, vertices, propagate);
 
 			// on parcours les sommets pour les cas sans arêtes ...
 			std::vector<Geom::Vertex*> vtx;
 			volumes[j]->get(vtx);
-			Topo::TopoHelper::get(vtx, vertices);
+			collect(vtx, vertices);
 		}
 	}
 }
 /*----------------------------------------------------------------------------*/
+} // end namespace
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::Block*>& blocks)
+{
+	UniqueCollector<Block> collector(blocks);
+	collect(volumes, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::CoFace*>& cofaces, bool propagate)
+{
+	UniqueCollector<CoFace> collector(cofaces);
+	collect(volumes, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::CoEdge*>& coedges, bool propagate)
+{
+	UniqueCollector<CoEdge> collector(coedges);
+	collect(volumes, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::Vertex*>& vertices, bool propagate)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(volumes, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::CoFace*>& cofaces)
+{
+	UniqueCollector<CoFace> collector(cofaces);
+	collect(surfaces, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::CoEdge*>& coedges, bool propagate)
+{
+	UniqueCollector<CoEdge> collector(coedges);
+	collect(surfaces, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::Vertex*>& vertices, bool propagate)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(surfaces, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Curve*>& curves, std::vector<Topo::CoEdge*>& coedges)
+{
+	UniqueCollector<CoEdge> collector(coedges);
+	collect(curves, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Curve*>& curves, std::vector<Topo::Vertex*>& vertices, bool propagate)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(curves, collector, propagate);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Geom::Vertex*>& vtx, std::vector<Topo::Vertex*>& vertices)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(vtx, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::CoFace*>& cofaces)
+{
+	UniqueCollector<CoFace> collector(cofaces);
+	collect(blocks, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::CoEdge*>& coedges)
+{
+	UniqueCollector<CoEdge> collector(coedges);
+	collect(blocks, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::Vertex*>& vertices)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(blocks, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::CoFace*>& cofaces, std::vector<Topo::CoEdge*>& coedges)
+{
+	UniqueCollector<CoEdge> collector(coedges);
+	collect(cofaces, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::CoFace*>& cofaces, std::vector<Topo::Vertex*>& vertices)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(cofaces, collector);
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(const std::vector<Topo::CoEdge*>& coedges, std::vector<Topo::Vertex*>& vertices)
+{
+	UniqueCollector<Vertex> collector(vertices);
+	collect(coedges, collector);
+}
+/*----------------------------------------------------------------------------*/
+template <typename T>
+void TopoHelper::addUnique(const std::vector<T*>& entities, std::vector<T*>& out)
+{
+	UniqueCollector<T> collector(out);
+	collector.add(entities);
+}
+template void TopoHelper::addUnique(const std::vector<Block*>&, std::vector<Block*>&);
+template void TopoHelper::addUnique(const std::vector<CoFace*>&, std::vector<CoFace*>&);
+template void TopoHelper::addUnique(const std::vector<CoEdge*>&, std::vector<CoEdge*>&);
+template void TopoHelper::addUnique(const std::vector<Vertex*>&, std::vector<Vertex*>&);
+/*----------------------------------------------------------------------------*/
+// les variantes avec un std::set s'appuient sur celles avec un vecteur
+void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::Block*>& blocks)
+{
+	std::vector<Topo::Block*> loc_blocks;
+	get(volumes, loc_blocks);
+	blocks.insert(loc_blocks.begin(), loc_blocks.end());
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::CoFace*>& cofaces, bool propagate)
+{
+	std::vector<Topo::CoFace*> loc_cofaces;
+	get(volumes, loc_cofaces, propagate);
+	cofaces.insert(loc_cofaces.begin(), loc_cofaces.end());
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::CoEdge*>& coedges, bool propagate)
+{
+	std::vector<Topo::CoEdge*> loc_coedges;
+	get(volumes, loc_coedges, propagate);
+	coedges.insert(loc_coedges.begin(), loc_coedges.end());
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::get(std::vector<Geom::Volume*>& volumes, std::set<Topo::Vertex*>& vertices, bool propagate)
+{
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(volumes, loc_vertices, propagate);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
+}
+/*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Surface*>& surfaces, std::set<Topo::CoFace*>& cofaces)
 {
-	for (uint k=0; k<surfaces.size(); k++){
-		std::vector<Topo::CoFace* > loc_cofaces;
-		surfaces[k]->get(loc_cofaces);
-		cofaces.insert(loc_cofaces.begin(), loc_cofaces.end());
-	}
+	std::vector<Topo::CoFace*> loc_cofaces;
+	get(surfaces, loc_cofaces);
+	cofaces.insert(loc_cofaces.begin(), loc_cofaces.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Surface*>& surfaces, std::set<Topo::CoEdge*>& coedges, bool propagate)
 {
-	for (uint j=0; j<surfaces.size(); j++){
-		// les coedges depuis les faces
-		std::vector<Topo::CoFace*> cofaces;
-		surfaces[j]->get(cofaces);
-		Topo::TopoHelper::get(cofaces, coedges);
-
-		if (propagate){
-			// on parcours les courbes pour les cas sans faces ...
-			std::vector<Geom::Curve*> curves;
-			surfaces[j]->get(curves);
-			Topo::TopoHelper::get(curves, coedges);
-		}
-	}
+	std::vector<Topo::CoEdge*> loc_coedges;
+	get(surfaces, loc_coedges, propagate);
+	coedges.insert(loc_coedges.begin(), loc_coedges.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Surface*>& surfaces, std::set<Topo::Vertex*>& vertices, bool propagate)
 {
-	for (uint j=0; j<surfaces.size(); j++){
-
-		// les vertices depuis les faces
-		std::vector<Topo::CoFace*> cofaces;
-		surfaces[j]->get(cofaces);
-		Topo::TopoHelper::get(cofaces, vertices);
-
-		if (propagate){
-			// on parcours les courbes pour les cas sans faces ...
-			std::vector<Geom::Curve*> curves;
-			surfaces[j]->get(curves);
-			Topo::TopoHelper::get(curves, vertices, propagate);
-
-			// on parcours les sommets pour les cas sans arêtes ...
-			std::vector<Geom::Vertex*> vtx;
-			surfaces[j]->get(vtx);
-			Topo::TopoHelper::get(vtx, vertices);
-		}
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(surfaces, loc_vertices, propagate);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Curve*>& curves, std::set<Topo::CoEdge*>& coedges)
 {
-	for (uint k=0; k<curves.size(); k++){
-		std::vector<Topo::CoEdge* > loc_coedges;
-		curves[k]->get(loc_coedges);
-		coedges.insert(loc_coedges.begin(), loc_coedges.end());
-	}
+	std::vector<Topo::CoEdge*> loc_coedges;
+	get(curves, loc_coedges);
+	coedges.insert(loc_coedges.begin(), loc_coedges.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Curve*>& curves, std::set<Topo::Vertex*>& vertices, bool propagate)
 {
-	for (uint k=0; k<curves.size(); k++){
-		std::vector<Topo::CoEdge* > loc_coedges;
-		curves[k]->get(loc_coedges);
-		Topo::TopoHelper::get(loc_coedges, vertices);
-
-		if (propagate){
-			// on parcours les sommets pour les cas sans arêtes ...
-			std::vector<Geom::Vertex*> vtx;
-			curves[k]->get(vtx);
-			Topo::TopoHelper::get(vtx, vertices);
-		}
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(curves, loc_vertices, propagate);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Geom::Vertex*>& vtx, std::set<Topo::Vertex*>& vertices)
 {
-	for (uint k=0; k<vtx.size(); k++){
-		std::vector<Topo::Vertex* > loc_vertices;
-		vtx[k]->get(loc_vertices);
-		vertices.insert(loc_vertices.begin(), loc_vertices.end());
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(vtx, loc_vertices);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::Block*>& blocks, std::set<Topo::CoFace*>& cofaces)
 {
-	for (uint k=0; k<blocks.size(); k++){
-		std::vector<Topo::CoFace* > loc_cofaces;
-		blocks[k]->getCoFaces(loc_cofaces);
-		cofaces.insert(loc_cofaces.begin(), loc_cofaces.end());
-	}
+	std::vector<Topo::CoFace*> loc_cofaces;
+	get(blocks, loc_cofaces);
+	cofaces.insert(loc_cofaces.begin(), loc_cofaces.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::Block*>& blocks, std::set<Topo::CoEdge*>& coedges)
 {
-	for (uint k=0; k<blocks.size(); k++){
-		std::vector<Topo::CoEdge* > loc_coedges;
-		blocks[k]->getCoEdges(loc_coedges);
-		coedges.insert(loc_coedges.begin(), loc_coedges.end());
-	}
+	std::vector<Topo::CoEdge*> loc_coedges;
+	get(blocks, loc_coedges);
+	coedges.insert(loc_coedges.begin(), loc_coedges.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::Block*>& blocks, std::set<Topo::Vertex*>& vertices)
 {
-	for (uint k=0; k<blocks.size(); k++){
-		std::vector<Topo::Vertex* > loc_vertices;
-		blocks[k]->getVertices(loc_vertices);
-		vertices.insert(loc_vertices.begin(), loc_vertices.end());
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(blocks, loc_vertices);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::CoFace*>& cofaces, std::set<Topo::CoEdge*>& coedges)
 {
-	for (uint k=0; k<cofaces.size(); k++){
-		std::vector<Topo::CoEdge* > loc_coedges;
-		cofaces[k]->getCoEdges(loc_coedges);
-		coedges.insert(loc_coedges.begin(), loc_coedges.end());
-	}
+	std::vector<Topo::CoEdge*> loc_coedges;
+	get(cofaces, loc_coedges);
+	coedges.insert(loc_coedges.begin(), loc_coedges.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::CoFace*>& cofaces, std::set<Topo::Vertex*>& vertices)
 {
-	for (uint k=0; k<cofaces.size(); k++){
-		std::vector<Topo::Vertex* > loc_vertices;
-		cofaces[k]->getVertices(loc_vertices);
-		vertices.insert(loc_vertices.begin(), loc_vertices.end());
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(cofaces, loc_vertices);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::get(std::vector<Topo::CoEdge*>& coedges, std::set<Topo::Vertex*>& vertices)
 {
-	for (uint k=0; k<coedges.size(); k++){
-		std::vector<Topo::Vertex* > loc_vertices;
-		coedges[k]->getVertices(loc_vertices);
-		vertices.insert(loc_vertices.begin(), loc_vertices.end());
-	}
+	std::vector<Topo::Vertex*> loc_vertices;
+	get(coedges, loc_vertices);
+	vertices.insert(loc_vertices.begin(), loc_vertices.end());
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::permuteVector(std::vector<CoEdge* > & coedges1,
@@ -1481,32 +1707,26 @@ void TopoHelper::splitFaces(std::vector<CoFace* > cofaces,
 
 }
 /*----------------------------------------------------------------------------*/
-void TopoHelper::getMarqued(std::map<CoEdge*, uint> filtre, const uint marque, std::vector<CoEdge*>& out)
+void TopoHelper::getMarqued(const std::map<CoEdge*, uint>& filtre, const uint marque, std::vector<CoEdge*>& out)
 {
     out.clear();
 
-    std::list<CoEdge*> liste;
-    for (std::map<CoEdge*, uint>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
+    for (std::map<CoEdge*, uint>::const_iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
         if (marque == (*iter).second)
-            liste.push_back((*iter).first);
+            out.push_back((*iter).first);
 
-    liste.sort(Utils::Entity::compareEntity);
-
-    out.insert(out.end(), liste.begin(), liste.end());
+    std::sort(out.begin(), out.end(), Utils::Entity::compareEntity);
 }
 /*----------------------------------------------------------------------------*/
-void TopoHelper::getMarqued(std::map<CoFace*, uint> filtre, std::vector<CoFace*>& out)
+void TopoHelper::getMarqued(const std::map<CoFace*, uint>& filtre, std::vector<CoFace*>& out)
 {
     out.clear();
 
-    std::list<CoFace*> liste;
-    for (std::map<CoFace*, uint>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
+    for (std::map<CoFace*, uint>::const_iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
         if ((*iter).second)
-            liste.push_back((*iter).first);
-
-    liste.sort(Utils::Entity::compareEntity);
+            out.push_back((*iter).first);
 
-    out.insert(out.end(), liste.begin(), liste.end());
+    std::sort(out.begin(), out.end(), Utils::Entity::compareEntity);
 }
 /*----------------------------------------------------------------------------*/
 void TopoHelper::saveTopoEntities(std::vector<CoFace*>& cofaces, Internal::InfoCommand* icmd)
@@ -1816,11 +2036,13 @@ std::vector<Vertex*> TopoHelper::getVerticesNeighbour(Vertex* vtx)
 /*----------------------------------------------------------------------------*/
 std::vector<CoEdge*> TopoHelper::getBorder(std::vector<CoFace*>& cofaces)
 {
-	// on marque les coedges suivant le nombre de fois où elles sont référencées par une coface
-	std::map<CoEdge*, uint> filtre_coedges;
+	// on compte le nombre de fois où les coedges sont référencées par une coface
+	// (table de hachage, les coedges sont rangées dans l'ordre de première rencontre)
+	Utils::IndexedMap<CoEdge*, uint> filtre_coedges;
+	filtre_coedges.reserve(4*cofaces.size());
 
+	std::vector<CoEdge* > coedges;
 	for (uint i=0; i<cofaces.size(); i++){
-		std::vector<CoEdge* > coedges;
 		// les coedges qui apparaissent 2 fois dans une même coface ne seront pas au bord
 		cofaces[i]->getCoEdges(coedges, false);
 
@@ -1828,8 +2050,8 @@ std::vector<CoEdge*> TopoHelper::getBorder(std::vector<CoFace*>& cofaces)
 			filtre_coedges[coedges[j]] += 1;
 	}
 
-	std::vector<CoEdge*> coedges;
-	for (std::map<CoEdge*, uint>::iterator iter = filtre_coedges.begin();
+	coedges.clear();
+	for (Utils::IndexedMap<CoEdge*, uint>::const_iterator iter = filtre_coedges.begin();
 			iter != filtre_coedges.end(); ++iter)
 		if (iter->second == 1)
 			coedges.push_back(iter->first);
@@ -1839,20 +2061,20 @@ std::vector<CoEdge*> TopoHelper::getBorder(std::vector<CoFace*>& cofaces)
 /*----------------------------------------------------------------------------*/
 std::vector<Topo::CoFace*> TopoHelper::getBorder(std::vector<Topo::Block*>& blocks)
 {
-	// on marque les cofaces suivant le nombre de fois où elles sont référencées par un bloc
-	std::map<CoFace*, uint> filtre_cofaces;
+	// on compte le nombre de fois où les cofaces sont référencées par un bloc
+	Utils::IndexedMap<CoFace*, uint> filtre_cofaces;
+	filtre_cofaces.reserve(6*blocks.size());
 
+	std::vector<CoFace* > cofaces;
 	for (uint i=0; i<blocks.size(); i++){
-		std::vector<CoFace* > cofaces;
-		// les coedges qui apparaissent 2 fois dans une même coface ne seront pas au bord
 		blocks[i]->getCoFaces(cofaces);
 
 		for (uint j=0; j<cofaces.size(); j++)
 			filtre_cofaces[cofaces[j]] += 1;
 	}
 
-	std::vector<CoFace*> cofaces;
-	for (std::map<CoFace*, uint>::iterator iter = filtre_cofaces.begin();
+	cofaces.clear();
+	for (Utils::IndexedMap<CoFace*, uint>::const_iterator iter = filtre_cofaces.begin();
 			iter != filtre_cofaces.end(); ++iter)
 		if (iter->second == 1)
 			cofaces.push_back(iter->first);
@@ -1863,20 +2085,21 @@ std::vector<Topo::CoFace*> TopoHelper::getBorder(std::vector<Topo::Block*>& bloc
 std::vector<CoEdge*> TopoHelper::getCommonCoEdges(Block* bloc1, Block* bloc2)
 {
 	// on marque les arêtes du premier bloc
-	std::set<CoEdge*> filtre_coedges;
+	Utils::MarkVectorLease lease(s_topo_marks);
+	Utils::MarkVector& marks = lease.marks();
 
 	std::vector<CoEdge* > coedges;
 	bloc1->getCoEdges(coedges);
 
 	for (std::vector<CoEdge*>::iterator iter=coedges.begin(); iter!=coedges.end(); ++iter)
-		filtre_coedges.insert(*iter);
+		marks.set((*iter)->getUniqueId(), 1);
 
 	// on recherche parmis les arêtes du deuxième bloc les arêtes marquées
 	std::vector<CoEdge* > selected_coedges;
 
 	bloc2->getCoEdges(coedges);
 	for (std::vector<CoEdge*>::iterator iter=coedges.begin(); iter!=coedges.end(); ++iter)
-		if (filtre_coedges.find(*iter) != filtre_coedges.end())
+		if (marks.isMarked((*iter)->getUniqueId()))
 			selected_coedges.push_back(*iter);
 
 	return selected_coedges;
@@ -1885,20 +2108,21 @@ std::vector<CoEdge*> TopoHelper::getCommonCoEdges(Block* bloc1, Block* bloc2)
 std::vector<CoEdge*> TopoHelper::getCommonCoEdges(CoFace* face1, CoFace* face2)
 {
 	// on marque les arêtes de la première coface
-	std::set<CoEdge*> filtre_coedges;
+	Utils::MarkVectorLease lease(s_topo_marks);
+	Utils::MarkVector& marks = lease.marks();
 
 	std::vector<CoEdge* > coedges;
 	face1->getCoEdges(coedges);
 
 	for (std::vector<CoEdge*>::iterator iter=coedges.begin(); iter!=coedges.end(); ++iter)
-		filtre_coedges.insert(*iter);
+		marks.set((*iter)->getUniqueId(), 1);
 
 	// on recherche parmis les arêtes de la deuxième coface les arêtes marquées
 	std::vector<CoEdge* > selected_coedges;
 
 	face2->getCoEdges(coedges);
 	for (std::vector<CoEdge*>::iterator iter=coedges.begin(); iter!=coedges.end(); ++iter)
-		if (filtre_coedges.find(*iter) != filtre_coedges.end())
+		if (marks.isMarked((*iter)->getUniqueId()))
 			selected_coedges.push_back(*iter);
 
 	return selected_coedges;
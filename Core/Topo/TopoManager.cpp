@@ -9,6 +9,7 @@
 #include "Internal/ContextIfc.h"
 
 /*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
 #include "Utils/CommandManager.h"
 #include "Utils/MgxNumeric.h"
 #include "Utils/Point.h"
@@ -162,26 +163,9 @@ void TopoManager::clear()
 /*----------------------------------------------------------------------------*/
 void TopoManager::getBlocks(std::vector<Block* > &blocks, bool sort) const
 {
-    blocks.clear();
-
-    if (sort){
-        std::list<Topo::Block*> l_te;
-        const std::vector<Block* >& blks = m_blocks.get();
-        for (std::vector<Block* >::const_iterator iter = blks.begin();
-                iter != blks.end(); ++iter)
-            if (!(*iter)->isDestroyed())
-                l_te.push_back(*iter);
-        l_te.sort(Utils::Entity::compareEntity);
-        l_te.unique();
-        blocks.insert(blocks.end(), l_te.begin(), l_te.end());
-    }
-    else {
-        const std::vector<Block* >& blks = m_blocks.get();
-        for (std::vector<Block* >::const_iterator iter = blks.begin();
-                iter != blks.end(); ++iter)
-            if (!(*iter)->isDestroyed())
-                blocks.push_back(*iter);
-    }
+    // les blocs non détruits sont tenus suivant l'unique id, qu'un tri soit
+    // demandé ou non
+    m_blocks.getVisible(blocks);
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::add(Block* b)
@@ -293,6 +277,32 @@ void TopoManager::remove(Vertex* v)
     m_vertices.remove(v, true);
 }
 /*----------------------------------------------------------------------------*/
+void TopoManager::updateDestroyed(TopoEntity* te)
+{
+    switch (te->getType()){
+    case Utils::Entity::TopoBlock:
+        m_blocks.update(static_cast<Block*>(te));
+        break;
+    case Utils::Entity::TopoFace:
+        m_faces.update(static_cast<Face*>(te));
+        break;
+    case Utils::Entity::TopoCoFace:
+        m_cofaces.update(static_cast<CoFace*>(te));
+        break;
+    case Utils::Entity::TopoEdge:
+        m_edges.update(static_cast<Edge*>(te));
+        break;
+    case Utils::Entity::TopoCoEdge:
+        m_coedges.update(static_cast<CoEdge*>(te));
+        break;
+    case Utils::Entity::TopoVertex:
+        m_vertices.update(static_cast<Vertex*>(te));
+        break;
+    default:
+        break;
+    }
+}
+/*----------------------------------------------------------------------------*/
 Block* TopoManager::getBlock (const std::string& name, const bool exceptionIfNotFound) const
 {
 #ifdef _DEBUG_TIMER
@@ -319,7 +329,9 @@ Block* TopoManager::getBlock (const std::string& name, const bool exceptionIfNot
     const std::vector<Block* >& blocks = m_blocks.get();
     for (std::vector<Block* >::const_iterator iter = blocks.begin();
     		iter != blocks.end(); ++iter)
-    	if (new_name == (*iter)->getName())
+    	// on préfère une entité non détruite à une entité détruite de même nom
+    	// (l'ordre du conteneur est quelconque)
+    	if (new_name == (*iter)->getName() && (bloc == 0 || bloc->isDestroyed()))
     		bloc = (*iter);
 
 #ifdef _DEBUG_TIMER
@@ -345,70 +357,42 @@ std::string TopoManager::getLastBlock()
 {
     const std::vector<Block* >& blocks = m_blocks.get();
 #ifdef _DEBUG
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::getLastBlock ()\n";
-    message << "m_blocks de taille:" << blocks.size() << "\n";
-   for (uint i=0; i<m_blocks.getNb(); i++)
-        message << " bloc "<<blocks[i]->getName()<<(blocks[i]->isDestroyed()?" détruit":" non détruit")<<"\n";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::getLastBlock ()\n";
+        message << "m_blocks de taille:" << blocks.size() << "\n";
+       for (uint i=0; i<m_blocks.getNb(); i++)
+            message << " bloc "<<blocks[i]->getName()<<(blocks[i]->isDestroyed()?" détruit":" non détruit")<<"\n";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 #endif
 
     std::string nom("");
-    if (m_blocks.empty())
-        return nom;
-    // recherche du dernier non détruit, en partant de la fin
-    int i;
-    for (i=blocks.size()-1; i>=0 && blocks[i]->isDestroyed(); i--)
-    {}
-    if (i>=0)
-        nom = blocks[i]->getName();
+    // le dernier créé parmi les non détruits
+    Block* bloc = m_blocks.getLastVisible();
+    if (bloc)
+        nom = bloc->getName();
     return nom;
 }
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbBlocks() const
 {
-	const std::vector<Block* >& blocs = m_blocks.get();
-	int nb = 0;
-	for (uint i=0; i<blocs.size(); i++)
-		if (!blocs[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_blocks.getVisibleNb();
 }
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbFaces() const
 {
-	const std::vector<CoFace* >& cofaces = m_cofaces.get();
-	int nb = 0;
-	for (uint i=0; i<cofaces.size(); i++)
-		if (!cofaces[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_cofaces.getVisibleNb();
 }
 /*----------------------------------------------------------------------------*/
 int TopoManager::getNbEdges() const
 {
-	const std::vector<CoEdge* >& coedges = m_coedges.get();
-	int nb = 0;
-	for (uint i=0; i<coedges.size(); i++)
-		if (!coedges[i]->isDestroyed())
-			nb++;
-	return nb;
+	return m_coedges.getVisibleNb();
 }
 /*----------------------------------------------------------------------------*/
 void TopoManager::getCoFaces(std::vector<Topo::CoFace* >& faces) const
 {
-    faces.clear();
-
-    const std::vector<CoFace* >& cofaces = m_cofaces.get();
-
-    std::list<Topo::CoFace*> l_te;
-    for (std::vector<CoFace* >::const_iterator iter = cofaces.begin();
-            iter != cofaces.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    faces.insert(faces.end(), l_te.begin(), l_te.end());
+    m_cofaces.getVisible(faces);
 }
 /*----------------------------------------------------------------------------*/
 CoFace* TopoManager::getCoFace(const std::string& name, const bool exceptionIfNotFound) const
@@ -437,7 +421,7 @@ CoFace* TopoManager::getCoFace(const std::string& name, const bool exceptionIfNo
     const std::vector<CoFace* >& cofaces = m_cofaces.get();
     for (std::vector<CoFace* >::const_iterator iter3 = cofaces.begin();
     		iter3 != cofaces.end(); ++iter3)
-    	if (new_name == (*iter3)->getName())
+    	if (new_name == (*iter3)->getName() && (face == 0 || face->isDestroyed()))
     		face = (*iter3);
 
     #ifdef _DEBUG_TIMER
@@ -476,7 +460,7 @@ Face* TopoManager::getFace(const std::string& name, const bool exceptionIfNotFou
     if (Face::isA(new_name)){
         const std::vector<Face* >& faces = m_faces.get();
         for (std::vector<Face* >::const_iterator iter2 = faces.begin();
-                iter2 != faces.end() && face == 0; ++iter2){
+                iter2 != faces.end() && (face == 0 || face->isDestroyed()); ++iter2){
             if (new_name == (*iter2)->getName())
                 face = (*iter2);
         }
@@ -508,18 +492,7 @@ Face* TopoManager::getFace(const std::string& name, const bool exceptionIfNotFou
 /*----------------------------------------------------------------------------*/
 void TopoManager::getCoEdges(std::vector<Topo::CoEdge* >& edges) const
 {
-    edges.clear();
-
-    const std::vector<CoEdge* >& coedges = m_coedges.get();
-
-    std::list<Topo::CoEdge*> l_te;
-    for (std::vector<CoEdge* >::const_iterator iter = coedges.begin();
-            iter != coedges.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    edges.insert(edges.end(), l_te.begin(), l_te.end());
+    m_coedges.getVisible(edges);
 }
 /*----------------------------------------------------------------------------*/
 CoEdge* TopoManager::getCoEdge(const std::string& name, const bool exceptionIfNotFound) const
@@ -551,7 +524,7 @@ CoEdge* TopoManager::getCoEdge(const std::string& name, const bool exceptionIfNo
     for (std::vector<CoEdge* >::const_iterator iter4 = coedges.begin();
     		iter4 != coedges.end(); ++iter4)
 
-    	if (new_name == (*iter4)->getName())
+    	if (new_name == (*iter4)->getName() && (edge == 0 || edge->isDestroyed()))
     		edge = (*iter4);
 
 #ifdef _DEBUG_TIMER
@@ -592,7 +565,7 @@ Edge* TopoManager::getEdge(const std::string& name, const bool exceptionIfNotFou
         for (std::vector<Edge* >::const_iterator iter4 = edges.begin();
                 iter4 != edges.end(); ++iter4)
 
-            if (new_name == (*iter4)->getName())
+            if (new_name == (*iter4)->getName() && (edge == 0 || edge->isDestroyed()))
                 edge = (*iter4);
     }
     else if (exceptionIfNotFound){
@@ -623,18 +596,7 @@ Edge* TopoManager::getEdge(const std::string& name, const bool exceptionIfNotFou
 /*----------------------------------------------------------------------------*/
 void TopoManager::getVertices(std::vector<Topo::Vertex* >& vertices) const
 {
-    vertices.clear();
-
-    const std::vector<Vertex* >& vtx = m_vertices.get();
-
-    std::list<Topo::Vertex*> l_te;
-    for (std::vector<Vertex* >::const_iterator iter = vtx.begin();
-            iter != vtx.end(); ++iter)
-        if (!(*iter)->isDestroyed())
-            l_te.push_back(*iter);
-    l_te.sort(Utils::Entity::compareEntity);
-    l_te.unique();
-    vertices.insert(vertices.end(), l_te.begin(), l_te.end());
+    m_vertices.getVisible(vertices);
 }
 /*----------------------------------------------------------------------------*/
 Vertex* TopoManager::getVertex(const std::string& name, const bool exceptionIfNotFound) const
@@ -664,7 +626,7 @@ Vertex* TopoManager::getVertex(const std::string& name, const bool exceptionIfNo
     for (std::vector<Vertex* >::const_iterator iter2 = vertices.begin();
     		iter2 != vertices.end(); ++iter2)
 
-    	if (new_name == (*iter2)->getName())
+    	if (new_name == (*iter2)->getName() && (vertex == 0 || vertex->isDestroyed()))
     		vertex = (*iter2);
 
 #ifdef _DEBUG_TIMER
@@ -827,9 +789,7 @@ TopoManager::newTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoOnGeometry("<<ge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newTopoOnGeometry("<<ge->getName()<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ge,
     		CommandNewTopoOnGeometry::ASSOCIATED_TOPO);
@@ -858,9 +818,7 @@ TopoManager::newStructuredTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newStructuredTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newStructuredTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newStructuredTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ge,
     		CommandNewTopoOnGeometry::STRUCTURED_BLOCK);
@@ -922,9 +880,7 @@ TopoManager::newUnstructuredTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newUnstructuredTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newUnstructuredTopoOnGeometry("<<ge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newUnstructuredTopoOnGeometry("<<ge->getName()<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ge,
     		CommandNewTopoOnGeometry::UNSTRUCTURED_BLOCK);
@@ -953,9 +909,7 @@ TopoManager::newFreeTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newFreeTopoOnGeometry(Geom::GeomEntity* ge)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFreeTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newFreeTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ge,
     		CommandNewTopoOnGeometry::FREE_BLOCK);
@@ -975,9 +929,7 @@ TopoManager::newFreeTopoOnGeometry(Geom::GeomEntity* ge)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newFreeTopoInGroup(std::string ng, int dim)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFreeTopoInGroup("<<ng<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newFreeTopoInGroup("<<ng<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ng, dim);
 
@@ -1002,9 +954,7 @@ TopoManager::newInsertionTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::newInsertionTopoOnGeometry(Geom::GeomEntity* ge)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newInsertionTopoOnGeometry("<<ge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newInsertionTopoOnGeometry("<<ge->getName()<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getLocalContext(), ge,
     		CommandNewTopoOnGeometry::INSERTION_BLOCK);
@@ -1025,12 +975,14 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::
 newBoxWithTopo(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax,
 		bool meshStructured, std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewBox *commandGeom = new Geom::CommandNewBox(getLocalContext(),pmin,pmax,groupName);
@@ -1074,12 +1026,14 @@ newBoxWithTopo(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax,
 		const int ni, const int nj, const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax<<", "<<(short)ni<<", "<<(short)nj<<", "<<(short)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax<<", "<<(short)ni<<", "<<(short)nj<<", "<<(short)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewBox *commandGeom = new Geom::CommandNewBox(getLocalContext(),pmin,pmax,groupName);
@@ -1122,17 +1076,19 @@ newCylinderWithTopo(const Point& pcentre, const double& dr,
         const int naxe, const int ni, const int nr,
         std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newCylinderWithTopo("<<pcentre<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "<<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
-	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newCylinderWithTopo("<<pcentre<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "<<dv<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
+		         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewCylinder *commandGeom = new Geom::CommandNewCylinder(getLocalContext(),pcentre, dr, dv, da, groupName);
@@ -1191,18 +1147,20 @@ newHollowCylinderWithTopo(const Point& pcentre, const double& dr_int, const doub
         const int naxe, const int ni, const int nr,
         std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newHollowCylinderWithTopo("<<pcentre<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
-     	 	 <<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newHollowCylinderWithTopo("<<pcentre<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
+         	 	 <<dv<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+		         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewHollowCylinder *commandGeom =
@@ -1263,19 +1221,21 @@ newConeWithTopo(const double& dr1, const double& dr2,
             const int naxe, const int ni, const int nr,
 			std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newConeWithTopo("
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr1)<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr2)<<", "
-			 <<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
-             <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newConeWithTopo("
+		         <<Utils::Math::MgxNumeric::userRepresentation (dr1)<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (dr2)<<", "
+				 <<dv<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+		         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
+                 <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewCone *commandGeom = new Geom::CommandNewCone(getLocalContext(), dr1, dr2, dv, da, groupName);
@@ -1334,16 +1294,18 @@ newSphereWithTopo(const Point& pcentre,  const double& dr,
                             const int ni, const int nr,
                             std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "
-            <<Utils::Portion::getName(dt)<<", "
-            <<(meshStructured?"True":"False")<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "<<(long)ni<<", "<<(long)nr;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
+		        <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "
+                <<Utils::Portion::getName(dt)<<", "
+                <<(meshStructured?"True":"False")<<", "
+		        <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "<<(long)ni<<", "<<(long)nr;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewSphere *commandGeom = new Geom::CommandNewSphere(getLocalContext(),pcentre, dr, dt, groupName);
@@ -1399,17 +1361,19 @@ newHollowSphereWithTopo(const Point& pcentre,  const double& dr_int,  const doub
                             const int ni, const int nr,
                             std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
-            <<Utils::Portion::getName(dt)<<", "
-            <<(meshStructured?"True":"False")<<", "
-	        <<(long)ni<<", "<<(long)nr;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
+		        <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
+		        <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
+                <<Utils::Portion::getName(dt)<<", "
+                <<(meshStructured?"True":"False")<<", "
+		        <<(long)ni<<", "<<(long)nr;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewHollowSphere *commandGeom =
@@ -1469,16 +1433,18 @@ newSpherePartWithTopo(const double& dr,
 		const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSpherePartWithTopo("
-    		<<Utils::Math::MgxNumeric::userRepresentation (dr)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
-    		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSpherePartWithTopo("
+        		<<Utils::Math::MgxNumeric::userRepresentation (dr)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
+        		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewSpherePart *commandGeom = new Geom::CommandNewSpherePart(getLocalContext(),dr, angleY, angleZ, groupName);
@@ -1526,16 +1492,18 @@ newHollowSpherePartWithTopo(const double& dr_int,
 		const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newHollowSpherePartWithTopo("
-    		<<Utils::Math::MgxNumeric::userRepresentation (dr_int)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
-    		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newHollowSpherePartWithTopo("
+        		<<Utils::Math::MgxNumeric::userRepresentation (dr_int)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
+        		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewHollowSpherePart *commandGeom = new Geom::CommandNewHollowSpherePart(getLocalContext(),dr_int, dr_ext, angleY, angleZ, groupName);
@@ -1577,10 +1545,8 @@ newHollowSpherePartWithTopo(const double& dr_int,
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::
 newIJBoxesWithTopo(int ni, int nj, bool alternateStruture)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newIJBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "
-            <<(alternateStruture?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newIJBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "
+            <<(alternateStruture?"True":"False")<<")");
 
     // creation de la commande composite
     TkUtil::UTF8String titreCmd(TkUtil::Charset::UTF_8);
@@ -1649,10 +1615,8 @@ newIJBoxesWithTopo(int ni, int nj, bool alternateStruture)
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::newIJKBoxesWithTopo(int ni, int nj, int nk, bool alternateStruture)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newIJKBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "<<(int64_t)nk<<", "
-            <<(alternateStruture?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newIJKBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "<<(int64_t)nk<<", "
+            <<(alternateStruture?"True":"False")<<")");
 
     // creation de la commande composite
     TkUtil::UTF8String titreCmd(TkUtil::Charset::UTF_8);
@@ -1732,9 +1696,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::newTopoOGridOnGeometry(std::s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::newTopoOGridOnGeometry(Geom::GeomEntity* ge, const double& rat)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoOGridOnGeometry("<<ge->getName()<<","<<rat<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::newTopoOGridOnGeometry("<<ge->getName()<<","<<rat<<")");
 
     Topo::CommandNewTopoOGridOnGeometry* command = new Topo::CommandNewTopoOGridOnGeometry(getLocalContext(), ge, rat);
 
@@ -1760,15 +1722,17 @@ void TopoManager::destroy(std::vector<std::string>& topo_entities_names, bool pr
 /*----------------------------------------------------------------------------*/
 void TopoManager::destroy(std::vector<Topo::TopoEntity*>& ve, bool propagate)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::destroy([";
-    for (uint i=0; i<ve.size(); i++){
-    	if (i)
-    		message <<", ";
-    	message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::destroy([";
+        for (uint i=0; i<ve.size(); i++){
+        	if (i)
+        		message <<", ";
+        	message << ve[i]->getName();
+        }
+        message <<"],"<<(propagate?"avec propagation":"sans propagation")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<(propagate?"avec propagation":"sans propagation")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandDestroyTopo* command = new Topo::CommandDestroyTopo(getLocalContext(), ve, propagate);
 
@@ -1888,9 +1852,7 @@ TopoManager::insertHole(std::vector<std::string>& face_names)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::insertHole(std::vector<CoFace*>& cofaces)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::insertHole("<<cofaces.size()<<" faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::insertHole("<<cofaces.size()<<" faces)");
 
     Topo::CommandInsertHole* command = new Topo::CommandInsertHole(getLocalContext(), cofaces);
 
@@ -1918,9 +1880,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Edges(std::string na, st
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Edges(CoEdge* edge_A, CoEdge* edge_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Edges("<<edge_A->getName()<<","<<edge_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::fuse2Edges("<<edge_A->getName()<<","<<edge_B->getName()<<")");
 
     Topo::CommandFuse2Edges* command = new Topo::CommandFuse2Edges(getLocalContext(), edge_A, edge_B);
 
@@ -1955,21 +1915,23 @@ TopoManager::fuse2EdgeList(std::vector<std::string>& coedge_names1, std::vector<
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::fuse2EdgeList(std::vector<Topo::CoEdge* > &coedges1, std::vector<Topo::CoEdge* > &coedges2)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2EdgeList([";
-    for (uint i=0; i<coedges1.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges1[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<coedges2.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges2[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::fuse2EdgeList([";
+        for (uint i=0; i<coedges1.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges1[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<coedges2.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges2[i]->getName();
+        }
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandFuse2EdgeList* command = new Topo::CommandFuse2EdgeList(getLocalContext(),
     		coedges1, coedges2);
@@ -2005,9 +1967,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Faces(std::string na, st
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Faces(CoFace* face_A, CoFace* face_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Faces("<<face_A->getName()<<","<<face_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::fuse2Faces("<<face_A->getName()<<","<<face_B->getName()<<")");
 
     Topo::CommandFuse2Faces* command = new Topo::CommandFuse2Faces(getLocalContext(), face_A, face_B);
 
@@ -2042,21 +2002,23 @@ TopoManager::fuse2FaceList(std::vector<std::string>& coface_names1, std::vector<
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::fuse2FaceList(std::vector<Topo::CoFace* > &cofaces1, std::vector<Topo::CoFace* > &cofaces2)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2FaceList([";
-    for (uint i=0; i<cofaces1.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces1[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces2.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces2[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::fuse2FaceList([";
+        for (uint i=0; i<cofaces1.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces1[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces2.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces2[i]->getName();
+        }
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandFuse2FaceList* command = new Topo::CommandFuse2FaceList(getLocalContext(),
     		cofaces1, cofaces2);
@@ -2092,9 +2054,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::glue2Blocks(std::string na, s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::glue2Blocks(Block* bl_A, Block* bl_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::glue2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::glue2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")");
 
     Topo::CommandGlue2Blocks* command = new Topo::CommandGlue2Blocks(getLocalContext(), bl_A, bl_B);
 
@@ -2120,9 +2080,7 @@ Internal::M3DCommandResultIfc* TopoManager::glue2Topo(
 Internal::M3DCommandResultIfc* TopoManager::glue2Topo(
 		Geom::Volume* vol1, Geom::Volume* vol2)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::glue2Topo("<<vol1->getName()<<","<<vol2->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::glue2Topo("<<vol1->getName()<<","<<vol2->getName()<<")");
 
     Topo::CommandGlue2Topo* command = new Topo::CommandGlue2Topo(getLocalContext(), vol1, vol2);
 
@@ -2145,9 +2103,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Vertices(std::string na,
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Vertices(Topo::Vertex* vtx_A, Topo::Vertex* vtx_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Vertices("<<vtx_A->getName()<<","<<vtx_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::fuse2Vertices("<<vtx_A->getName()<<","<<vtx_B->getName()<<")");
 
     Topo::CommandFuse2Vertices* command = new Topo::CommandFuse2Vertices(getLocalContext(), vtx_A, vtx_B);
 
@@ -2170,9 +2126,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitBlock(std::string nbloc,
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitBlock(Block* bloc, CoEdge* arete, const double& ratio)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<ratio<<")");
 
     Topo::CommandSplitBlock* command = new Topo::CommandSplitBlock(getLocalContext(), bloc, arete, ratio);
 
@@ -2190,9 +2144,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitBlock(Block* bloc, CoEdg
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitBlock(Block* bloc, CoEdge* arete, const Point& pt)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<pt<<")");
 
     Topo::CommandSplitBlock* command = new Topo::CommandSplitBlock(getLocalContext(), bloc, arete, pt);
 
@@ -2345,9 +2297,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::extendSplitBlock(std::string
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::extendSplitBlock(Block* bloc, CoEdge* arete)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::extendSplitBlock("<<bloc->getName()<<","<<arete->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::extendSplitBlock("<<bloc->getName()<<","<<arete->getName()<<")");
 
     Topo::CommandExtendSplitBlock* command = new Topo::CommandExtendSplitBlock(getLocalContext(), bloc, arete);
 
@@ -2420,21 +2370,23 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitBlocksWithOgrid(std::vec
 		bool create_internal_vertices,
 		bool propagate_neighbor_block)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlocksWithOgrid([";
-    for (uint i=0; i<blocs.size(); i++){
-        if (i)
-            message <<", ";
-        message << blocs[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitBlocksWithOgrid([";
+        for (uint i=0; i<blocs.size(); i++){
+            if (i)
+                message <<", ";
+            message << blocs[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitBlocksWithOgrid* command = new Topo::CommandSplitBlocksWithOgrid(getLocalContext(),
             blocs, cofaces, ratio_ogrid, nb_bras, create_internal_vertices, propagate_neighbor_block);
@@ -2495,21 +2447,23 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFacesWithOgrid(std::vect
         std::vector<Topo::CoEdge*> &coedges,
         const double& ratio_ogrid, int nb_bras)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFacesWithOgrid([";
-    for (uint i=0; i<coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFacesWithOgrid([";
+        for (uint i=0; i<coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFacesWithOgrid* command = new Topo::CommandSplitFacesWithOgrid(getLocalContext(),
             cofaces, coedges, ratio_ogrid, nb_bras);
@@ -2556,15 +2510,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFaces(std::vector<std::s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFaces(std::vector<Topo::CoFace*  > &cofaces, CoEdge* arete, const double& ratio_dec, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFaces([";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFaces([";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<arete->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<arete->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), cofaces, arete, ratio_dec, ratio_ogrid);
 
@@ -2599,15 +2555,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFaces(std::vector<std::s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFaces(std::vector<Topo::CoFace*  > &cofaces, CoEdge* arete, const Point& pt, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFaces([";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFaces([";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<arete->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<arete->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), cofaces, arete, pt, ratio_ogrid);
 
@@ -2637,10 +2595,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFace(std::string coface_
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFace(Topo::CoFace* coface, CoEdge* coedge, const double& ratio_dec, bool project_on_meshing_edges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-
-    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< ratio_dec<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, 
+    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< ratio_dec<<")");
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), coface, coedge, ratio_dec, project_on_meshing_edges);
 
@@ -2668,10 +2624,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFace(std::string coface_
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitFace(Topo::CoFace* coface, CoEdge* coedge, const Point& pt, bool project_on_meshing_edges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-
-    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, 
+    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< pt<<")");
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), coface, coedge, pt, project_on_meshing_edges);
 
@@ -2701,10 +2655,8 @@ TopoManager::extendSplitFace(std::string coface_name, std::string nsommet)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::extendSplitFace(Topo::CoFace* coface, Vertex* vertex)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-
-    message <<"TopoManager::extendSplitFace("<<coface->getName()<<", "<< vertex->getName() <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, 
+    message <<"TopoManager::extendSplitFace("<<coface->getName()<<", "<< vertex->getName() <<")");
 
     Topo::CommandExtendSplitFace* command = new Topo::CommandExtendSplitFace(getLocalContext(), coface, vertex);
 
@@ -2729,10 +2681,12 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitAllFaces(std::string nar
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitAllFaces(CoEdge* coedge, const double& ratio_dec, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitAllFaces(";
-    message <<coedge->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitAllFaces(";
+        message <<coedge->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), coedge, ratio_dec, ratio_ogrid);
 
@@ -2756,10 +2710,12 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitAllFaces(std::string nar
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitAllFaces(CoEdge* coedge, const Point& pt, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitAllFaces(";
-    message <<coedge->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitAllFaces(";
+        message <<coedge->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getLocalContext(), coedge, pt, ratio_ogrid);
 
@@ -2783,10 +2739,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitEdge(std::string coedge_
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitEdge(CoEdge* coedge, const double& ratio_dec)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-
-    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, 
+    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<")");
 
     Topo::CommandSplitEdge* command = new Topo::CommandSplitEdge(getLocalContext(), coedge, ratio_dec);
 
@@ -2810,10 +2764,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitEdge(std::string coedge_
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitEdge(CoEdge* coedge, const Point& pt)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-
-    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, 
+    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< pt<<")");
 
     Topo::CommandSplitEdge* command = new Topo::CommandSplitEdge(getLocalContext(), coedge, pt);
 
@@ -2832,11 +2784,13 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::splitEdge(CoEdge* coedge, con
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapVertices(std::string nom1, std::string nom2, bool project_on_first)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message <<"TopoManager::snapVertices(";
-     message <<nom1<<","<<nom2
-             <<(project_on_first?", avec projection sur le premier":", avec placement au milieu des sommets")<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message <<"TopoManager::snapVertices(";
+         message <<nom1<<","<<nom2
+                 <<(project_on_first?", avec projection sur le premier":", avec placement au milieu des sommets")<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     }
 
      // trace pour le script
      TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
@@ -2954,15 +2908,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevolWithRatioOgr
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::makeBlocksByRevol(std::vector<CoEdge*>& coedges, const  Utils::Portion::Type& dt, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::makeBlocksByRevol([";
-    for (uint i=0; i<coedges.size(); i++){
-    	if (i)
-    		message <<", ";
-    	message << coedges[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::makeBlocksByRevol([";
+        for (uint i=0; i<coedges.size(); i++){
+        	if (i)
+        		message <<", ";
+        	message << coedges[i]->getName();
+        }
+        message <<"],"<<Utils::Portion::getName(dt)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Portion::getName(dt)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
 	if (dt != Utils::Portion::DEMI
 			&& dt != Utils::Portion::TIERS
@@ -3096,10 +3052,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoEdgeMesh
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoEdgeMeshingProperty& emp, std::vector<CoEdge*>& coedges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<coedges.size()<<" arêtes)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                    <<"),"<<coedges.size()<<" arêtes)");
 
     Topo::CommandSetEdgeMeshingProperty* command = new Topo::CommandSetEdgeMeshingProperty(getLocalContext(), emp, coedges);
 
@@ -3124,10 +3078,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoEdgeMesh
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setAllMeshingProperty(CoEdgeMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"), toutes les arêtes)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setAllMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                    <<"), toutes les arêtes)");
 
     std::vector<Topo::CoEdge* > coedges;
     getCoEdges(coedges);
@@ -3156,10 +3108,8 @@ TopoManager::setParallelMeshingProperty(CoEdgeMeshingProperty& emp, std::string
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::setParallelMeshingProperty(CoEdgeMeshingProperty& emp, Topo::CoEdge* coedge)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<coedge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                    <<"),"<<coedge->getName()<<")");
 
     Topo::CommandSetEdgeMeshingPropertyToParallelCoEdges* command = new Topo::CommandSetEdgeMeshingPropertyToParallelCoEdges(getLocalContext(), emp, coedge);
 
@@ -3190,9 +3140,7 @@ TopoManager::reverseDirection(std::vector<std::string> &coedges_names)
 Mgx3D::Internal::M3DCommandResultIfc*
 TopoManager::reverseDirection(std::vector<CoEdge*>& coedges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::reverseDirection pour "<<coedges.size()<<" arêtes";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::reverseDirection pour "<<coedges.size()<<" arêtes");
 
     Topo::CommandReverseDirection* command = new Topo::CommandReverseDirection(getLocalContext(), coedges);
 
@@ -3225,10 +3173,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoFaceMesh
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoFaceMeshingProperty& emp, std::vector<CoFace*>& cofaces)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<cofaces.size()<<" faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
+                    <<"),"<<cofaces.size()<<" faces)");
 
     Topo::CommandSetFaceMeshingProperty* command = new Topo::CommandSetFaceMeshingProperty(getLocalContext(), emp, cofaces);
 
@@ -3252,10 +3198,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(CoFaceMesh
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setAllMeshingProperty(CoFaceMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"), toutes les faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                    <<"), toutes les faces)");
 
     std::vector<Topo::CoFace* > cofaces;
     getCoFaces(cofaces);
@@ -3286,10 +3230,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(BlockMeshi
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(BlockMeshingProperty& emp, std::vector<Block*>& blocks)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<blocks.size()<<" blocs)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
+                    <<"),"<<blocks.size()<<" blocs)");
 
     Topo::CommandSetBlockMeshingProperty* command = new Topo::CommandSetBlockMeshingProperty(getLocalContext(), emp, blocks);
 
@@ -3313,10 +3255,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setMeshingProperty(BlockMeshi
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setAllMeshingProperty(BlockMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"), toutes les faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                    <<"), toutes les faces)");
 
     std::vector<Topo::Block* > blocks;
     getBlocks(blocks);
@@ -3352,10 +3292,8 @@ TopoManager::getEdgeMeshingProperty(std::string ed)
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setEdgeMeshingProperty(CoEdgeMeshingProperty& emp, CoEdge* ed)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setEdgeMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<ed->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setEdgeMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                    <<"),"<<ed->getName()<<")");
 
     Topo::CommandSetEdgeMeshingProperty* command = new Topo::CommandSetEdgeMeshingProperty(getLocalContext(), emp, ed);
 
@@ -3379,10 +3317,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setFaceMeshingProperty(CoFace
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setFaceMeshingProperty(CoFaceMeshingProperty& emp, CoFace* cf)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setFaceMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<cf->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setFaceMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                    <<"),"<<cf->getName()<<")");
 
     Topo::CommandSetFaceMeshingProperty* command = new Topo::CommandSetFaceMeshingProperty(getLocalContext(), emp, cf);
 
@@ -3405,10 +3341,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setBlockMeshingProperty(Block
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setBlockMeshingProperty(BlockMeshingProperty& emp, Block* bl)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setBlockMeshingProperty(BlockMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<bl->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setBlockMeshingProperty(BlockMeshingProperty("<<emp.getMeshLawName()
+                    <<"),"<<bl->getName()<<")");
 
     Topo::CommandSetBlockMeshingProperty* command = new Topo::CommandSetBlockMeshingProperty(getLocalContext(), emp, bl);
 
@@ -3447,9 +3381,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::unrefine(std::string nbloc, s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::unrefine(Block* bloc, CoEdge* arete, int ratio)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::unrefine("<<bloc->getName()<<","<<arete->getName()<<","<<(short)ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::unrefine("<<bloc->getName()<<","<<arete->getName()<<","<<(short)ratio<<")");
 
     Topo::CommandUnrefineBlock* command = new Topo::CommandUnrefineBlock(getLocalContext(), bloc, arete, ratio);
 
@@ -3467,9 +3399,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::unrefine(Block* bloc, CoEdge*
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::refine(int ratio)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::refine("<<(short)ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::refine("<<(short)ratio<<")");
 
     Topo::CommandRefineAllCoEdges* command = new Topo::CommandRefineAllCoEdges(getLocalContext(), ratio);
 
@@ -3488,9 +3418,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::importMDL(std::string n, cons
 		std::string prefixName,int deg_min, int deg_max)
 {
 #ifdef USE_MDLPARSER
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getLocalContext(), n, all,
@@ -3713,15 +3641,17 @@ fuseEdges(std::vector<std::string> &coedges_names)
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::
 fuseEdges(std::vector<CoEdge*> &coedges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::fuseEdges (";
-    for (uint i=0; i<coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::fuseEdges (";
+        for (uint i=0; i<coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges[i]->getName();
+        }
+        message << ")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << ")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     // récupération des courbes sur lesquelles se font les projections
     std::vector<Geom::GeomEntity*> courbes;
@@ -3793,9 +3723,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Blocks(std::string na, s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::fuse2Blocks(Block* bl_A, Block* bl_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::fuse2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")");
 
     Topo::CommandFuse2Blocks* command = new Topo::CommandFuse2Blocks(getLocalContext(), bl_A, bl_B);
 
@@ -3831,15 +3759,17 @@ setGeomAssociation(std::vector<TopoEntity*> & topo_entities,
 		Geom::GeomEntity* geom_entity,
 		bool move_vertices)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setGeomAssociation ([";
-    for (uint i=0; i<topo_entities.size(); i++){
-        if (i)
-            message <<", ";
-        message << topo_entities[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setGeomAssociation ([";
+        for (uint i=0; i<topo_entities.size(); i++){
+            if (i)
+                message <<", ";
+            message << topo_entities[i]->getName();
+        }
+        message << "], "<< (geom_entity?geom_entity->getName():"") <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< (geom_entity?geom_entity->getName():"") <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     // création de la commande
     Topo::CommandSetGeomAssociation* command =
@@ -4071,16 +4001,18 @@ translate(std::vector<TopoEntity*>& ve, const Vector& dp,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::translate ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::translate ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< dp ;
+        message <<(withGeom?", avec":", sans")<<" translation de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< dp ;
-    message <<(withGeom?", avec":", sans")<<" translation de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4143,16 +4075,18 @@ rotate(std::vector<TopoEntity*>& ve,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour la rotation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::rotate ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::rotate ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<<  rot;
+        message <<(withGeom?", avec":", sans")<<" rotation de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<<  rot;
-    message <<(withGeom?", avec":", sans")<<" rotation de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4228,16 +4162,18 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::scale(std::vector<TopoEntity*
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::scale ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::scale ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< Utils::Math::MgxNumeric::userRepresentation (facteur) ;
+        message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< Utils::Math::MgxNumeric::userRepresentation (facteur) ;
-    message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4306,16 +4242,18 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::scale(std::vector<TopoEntity*
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::scale ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::scale ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< factorX<<", "<<factorY<<", "<<factorZ;
+        message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< factorX<<", "<<factorY<<", "<<factorZ;
-    message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4382,16 +4320,18 @@ TopoManager::mirror(std::vector<TopoEntity*>& ve,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour la ymétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::mirror ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::mirror ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<<  *plane;
+        message <<(withGeom?", avec":", sans")<<" symétrie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<<  *plane;
-    message <<(withGeom?", avec":", sans")<<" symétrie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4476,22 +4416,24 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setVertexLocation(std::vector
         const double& zPos,
 		CoordinateSystem::SysCoord* rep)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
-    }
-    message << "]";
-    if (changeX)
-        message << ", modifie x : "<<Utils::Math::MgxNumeric::userRepresentation (xPos);
-    if (changeY)
-        message << ", modifie y : "<<Utils::Math::MgxNumeric::userRepresentation (yPos);
-    if (changeZ)
-        message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeX)
+            message << ", modifie x : "<<Utils::Math::MgxNumeric::userRepresentation (xPos);
+        if (changeY)
+            message << ", modifie y : "<<Utils::Math::MgxNumeric::userRepresentation (yPos);
+        if (changeZ)
+            message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getLocalContext(),
@@ -4563,22 +4505,24 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setVertexSphericalLocation(st
 		const double& phiPos,
 		CoordinateSystem::SysCoord* rep)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexSphericalLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
-    }
-    message << "]";
-    if (changeRho)
-        message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
-    if (changeTheta)
-        message << ", modifie Theta : "<<Utils::Math::MgxNumeric::userRepresentation (thetaPos);
-    if (changePhi)
-        message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexSphericalLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeRho)
+            message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
+        if (changeTheta)
+            message << ", modifie Theta : "<<Utils::Math::MgxNumeric::userRepresentation (thetaPos);
+        if (changePhi)
+            message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getLocalContext(),
@@ -4650,22 +4594,24 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setVertexCylindricalLocation(
 				const double& zPos,
 				CoordinateSystem::SysCoord* rep)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexCylindricalLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
-    }
-    message << "]";
-    if (changeRho)
-        message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
-    if (changePhi)
-        message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
-    if (changeZ)
-        message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexCylindricalLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeRho)
+            message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
+        if (changePhi)
+            message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
+        if (changeZ)
+            message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getLocalContext(),
@@ -4709,10 +4655,8 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setVertexSameLocation(std::st
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setVertexSameLocation(Vertex* vtx,
 		Vertex* target)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexSameLocation ("<<vtx->getName()<<", "<<target->getName()<<")";
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setVertexSameLocation ("<<vtx->getName()<<", "<<target->getName()<<")";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandChangeVertexSameLocation* command =
             new Topo::CommandChangeVertexSameLocation(getLocalContext(), vtx, target);
@@ -4746,15 +4690,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapProjectedVertices(std::ve
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapProjectedVertices(std::vector<Vertex*>& vertices)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::snapProjectedVertices ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::snapProjectedVertices ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSnapProjectedVertices* command =
             new Topo::CommandSnapProjectedVertices(getLocalContext(), vertices);
@@ -4781,9 +4727,7 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapProjectedVertices(std::ve
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::snapAllProjectedVertices()
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::snapAllProjectedVertices ()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::snapAllProjectedVertices ()");
 
     Topo::CommandSnapProjectedVertices* command =
             new Topo::CommandSnapProjectedVertices(getLocalContext());
@@ -4817,15 +4761,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::alignVertices(std::vector<std
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::alignVertices(std::vector<Vertex*>& vertices)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::alignVertices ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::alignVertices ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandAlignVertices* command =
             new Topo::CommandAlignVertices(getLocalContext(), vertices);
@@ -5016,9 +4962,7 @@ int TopoManager::getDefaultNbMeshingEdges()
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setDefaultNbMeshingEdges(int nb)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setDefaultNbMeshingEdges("<<(unsigned long)nb<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE_IF(*this, TkUtil::Log::TRACE_4, "TopoManager::setDefaultNbMeshingEdges("<<(unsigned long)nb<<")");
 
     Topo::CommandChangeDefaultNbMeshingEdges* command =
             new Topo::CommandChangeDefaultNbMeshingEdges(getLocalContext(), nb);
@@ -5229,16 +5173,18 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setNbMeshingEdges(std::string
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setNbMeshingEdges(CoEdge* coedge, int nb, std::vector<CoEdge*>& frozed_coedges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setNbMeshingEdges("<<coedge->getName()<<", "<<(unsigned long)nb<<", [";
-    for (uint i=0; i<frozed_coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << frozed_coedges[i]->getName();
-    }
-    message <<"])";
+    if (isLogEnabled (TkUtil::Log::TRACE_4)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setNbMeshingEdges("<<coedge->getName()<<", "<<(unsigned long)nb<<", [";
+        for (uint i=0; i<frozed_coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << frozed_coedges[i]->getName();
+        }
+        message <<"])";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetNbMeshingEdges* command = new Topo::CommandSetNbMeshingEdges(getLocalContext(), coedge, nb, frozed_coedges);
 
@@ -5263,15 +5209,17 @@ Mgx3D::Internal::M3DCommandResultIfc* TopoManager::setNbMeshingEdges(CoEdge* coe
 Internal::M3DCommandResultIfc* TopoManager::addToGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::addToGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::addToGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -5348,15 +5296,17 @@ Internal::M3DCommandResultIfc* TopoManager::addToGroup(std::vector<std::string>&
 Internal::M3DCommandResultIfc* TopoManager::removeFromGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::removeFromGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::removeFromGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -5433,15 +5383,17 @@ Internal::M3DCommandResultIfc* TopoManager::removeFromGroup(std::vector<std::str
 Internal::M3DCommandResultIfc* TopoManager::setGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (isLogEnabled (TkUtil::Log::TRACE_3)){
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
 
     Mesh::CommandAddRemoveGroupName* command = 0;
@@ -134,18 +134,12 @@ Vertex::
 }
 /*----------------------------------------------------------------------------*/
 void Vertex::
-setCoord(const Utils::Math::Point & pt, bool acceptMeshed)
+setCoord(const Utils::Math::Point & pt)
 {
 #ifdef _DEBUG2
     std::cout<<"setCoord à "<<pt<<" pour le sommet "<<getName()<<std::endl;
 #endif
 
-    if ((not acceptMeshed) && isMeshed()){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-         message << "On ne peut pas déplacer un sommet ("<<getName()<<") sans avoir détruit le maillage.";
-         throw TkUtil::Exception (message);
-     }
-
     m_geom_property->setCoord(pt);
 
     updateCoEdgeModificationTime();
@@ -637,7 +631,8 @@ getNode()
 Utils::Math::Point Vertex::getCoord() const
 {
 	Utils::Math::Point res;
-	if (isMeshed()){
+	// le noeud d'un sommet déplacé depuis qu'il est maillé n'est plus à jour
+	if (isMeshed() && !isModifiedSinceMeshed()){
 		gmds::IGMesh& gmds_mesh = getContext().getLocalMeshManager().getMesh()->getGMDSMesh();
 		gmds::math::Point pt = gmds_mesh.getPoint(m_mesh_data->node());
 		res.setX(pt.X());
@@ -793,8 +788,12 @@ void Vertex::updateCoEdgeModificationTime()
     getCoEdges(coedges);
 
     for (std::vector<CoEdge* >::iterator iter=coedges.begin();
-            iter != coedges.end(); ++iter)
+            iter != coedges.end(); ++iter){
     	(*iter)->getMeshingProperty()->updateModificationTime();
+    	(*iter)->updateModificationStamp();
+    }
+
+    updateModificationStamp();
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
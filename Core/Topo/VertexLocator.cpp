@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VertexLocator.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Topo/VertexLocator.h"
+#include "Topo/Vertex.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+VertexLocator::VertexLocator(const std::vector<Vertex*>& vertices, double tol)
+: m_vertices(vertices)
+, m_tol(tol)
+, m_tol2(tol*tol)
+, m_step(1.0)
+{
+	m_coords.reserve(m_vertices.size());
+	double max[3] = {0.0, 0.0, 0.0};
+	for (uint d=0; d<3; d++){
+		m_min[d] = 0.0;
+		m_nb[d] = 1;
+	}
+	for (uint i=0; i<m_vertices.size(); i++){
+		m_coords.push_back(m_vertices[i]->getCoord());
+		for (uint d=0; d<3; d++){
+			const double c = m_coords[i].getCoord(d);
+			if (i == 0 || c < m_min[d])
+				m_min[d] = c;
+			if (i == 0 || c > max[d])
+				max[d] = c;
+		}
+	}
+
+	// pas de la grille : environ un sommet par cellule, et au moins la
+	// tolérance pour qu'une recherche ne concerne que 2 cellules par direction
+	double extent = 0.0;
+	for (uint d=0; d<3; d++)
+		extent = std::max(extent, max[d]-m_min[d]);
+	if (!m_vertices.empty())
+		m_step = std::max(m_tol, extent/std::cbrt((double)m_vertices.size()));
+	if (!(m_step > 0.0))
+		m_step = 1.0;
+	for (uint d=0; d<3; d++)
+		m_nb[d] = (uint)std::floor((max[d]-m_min[d])/m_step) + 1;
+
+	// rangement des sommets par cellule (CSR), dans l'ordre du vecteur initial
+	const size_t nbCells = (size_t)m_nb[0]*m_nb[1]*m_nb[2];
+	std::vector<size_t> cells(m_vertices.size());
+	m_cellPtr.assign(nbCells+1, 0);
+	for (uint i=0; i<m_vertices.size(); i++){
+		cells[i] = cellIndex(m_coords[i].getX(), 0)
+				+ (size_t)m_nb[0]*(cellIndex(m_coords[i].getY(), 1)
+				+ (size_t)m_nb[1]*cellIndex(m_coords[i].getZ(), 2));
+		m_cellPtr[cells[i]+1] += 1;
+	}
+	for (size_t c=0; c<nbCells; c++)
+		m_cellPtr[c+1] += m_cellPtr[c];
+	m_cellVertices.resize(m_vertices.size());
+	std::vector<size_t> fill(m_cellPtr.begin(), m_cellPtr.end()-1);
+	for (uint i=0; i<m_vertices.size(); i++)
+		m_cellVertices[fill[cells[i]]++] = i;
+}
+/*----------------------------------------------------------------------------*/
+uint VertexLocator::cellIndex(double coord, uint dir) const
+{
+	const double pos = std::floor((coord-m_min[dir])/m_step);
+	if (pos <= 0.0)
+		return 0;
+	if (pos >= (double)(m_nb[dir]-1))
+		return m_nb[dir]-1;
+	return (uint)pos;
+}
+/*----------------------------------------------------------------------------*/
+Vertex* VertexLocator::find(const Utils::Math::Point& pt) const
+{
+	if (m_vertices.empty())
+		return 0;
+
+	uint first[3], last[3];
+	for (uint d=0; d<3; d++){
+		first[d] = cellIndex(pt.getCoord(d)-m_tol, d);
+		last[d] = cellIndex(pt.getCoord(d)+m_tol, d);
+	}
+
+	// on retient le sommet de plus petit indice, comme une recherche linéaire
+	uint best = m_vertices.size();
+	for (uint k=first[2]; k<=last[2]; k++)
+		for (uint j=first[1]; j<=last[1]; j++)
+			for (uint i=first[0]; i<=last[0]; i++){
+				const size_t c = i + (size_t)m_nb[0]*(j + (size_t)m_nb[1]*k);
+				for (size_t n=m_cellPtr[c]; n<m_cellPtr[c+1]; n++){
+					const uint idx = m_cellVertices[n];
+					if (idx >= best)
+						break; // indices croissants dans une cellule
+					if ((pt-m_coords[idx]).norme2() < m_tol2)
+						best = idx;
+				}
+			}
+
+	return best < m_vertices.size() ? m_vertices[best] : 0;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -54,7 +54,7 @@ public:
      *  \param compProp les propriétés de calcul
      */
 #ifndef SWIG
-    Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    Curve(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, GeomRepresentation* compProp);
 #endif
 
@@ -68,7 +68,7 @@ public:
      *  \param compProp les propriétés de calcul
      */
 #ifndef SWIG
-    Curve(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    Curve(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp);
 #endif
 
@@ -11,6 +11,7 @@
 #define FACETEDHELPER_H_
 /*----------------------------------------------------------------------------*/
 #include "Utils/Point.h"
+#include "Utils/MarkVector.h"
 
 #include <GMDS/IG/Node.h>
 #include <GMDS/IG/Face.h>
@@ -55,17 +56,20 @@ public:
 			gp_GTrsf* transf);
 
 	/// constrction des lignes internes pour la représentatio en filaire
-	static void buildIsoCurve(const std::vector<gmds::Face>& poly,
+	static void buildIsoCurve(Utils::MarkVectorPool& marks,
+            const std::vector<gmds::Face>& poly,
             std::vector<Utils::Math::Point>& points,
             std::vector<size_t>& indices);
 
-    /// Retourne la liste des noeuds GMDS pour un ensemble de polygones
-    static void getGMDSNodes(const std::vector<gmds::Face>& poly,
+    /// Retourne la liste des noeuds GMDS pour un ensemble de polygones,
+    /// marks est la réserve de tables de marques du maillage des polygones
+    static void getGMDSNodes(Utils::MarkVectorPool& marks,
+             const std::vector<gmds::Face>& poly,
              std::vector<gmds::Node >& ANodes);
 
     /// Calcul les couples de points intersections entre un plan et les triangles
     static void addPointsIsoCurve(std::vector<gmds::Node>& nodes,
-             std::map<gmds::TCellID, uint>& filtre_nodes,
+             const Utils::MarkVector& filtre_nodes,
              std::vector<double>& coordPl,
              uint dirPlan,
              std::vector<Utils::Math::Point>& points,
@@ -75,7 +79,7 @@ public:
     static Utils::Math::Point getIntersectionPlan(gmds::Node& nd1, gmds::Node& nd2, double plVal, uint &dirPlan);
 
     /// préparation de la liste des noeuds en mettant en premier ceux qui intersectent le plan
-    static void sortNodes(std::vector<gmds::Node>& nodes, std::map<gmds::TCellID, uint>& filtre_nodes);
+    static void sortNodes(std::vector<gmds::Node>& nodes, const Utils::MarkVector& filtre_nodes);
 
     /// duplique le maillage pour toutes ces entités
     static void duplicateMesh(Mesh::MeshImplementation* mesh, std::vector<FacetedSurface*>& fs, std::vector<FacetedCurve*>& fc, std::vector<FacetedVertex*>& fv);
@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomRepresentation.h"
 #include "Internal/Context.h"
+#include "Utils/MarkVector.h"
 /*----------------------------------------------------------------------------*/
 
 #include <GMDS/IG/Face.h>
@@ -280,6 +281,8 @@ public:
 
 private:
 
+    /// les tables de marques du maillage contenant les polygones
+    Utils::MarkVectorPool& getMarks() const;
 
     /// Construction de l'arbre binaire de boites englobantes (GTS)
     void buildAABBTree();
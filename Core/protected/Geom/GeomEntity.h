@@ -72,7 +72,7 @@ protected:
      *          Une fois une propriété associée à une entité, la mort de
      *          l'entité entrainera celle des propriétés attachées.
      */
-    GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    GeomEntity(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, GeomRepresentation* compProp=0);
 
     /** \brief  Constructeur. Une entité délègue un certain nombre de calculs
@@ -81,7 +81,7 @@ protected:
      *          Une fois une propriété associée à une entité, la mort de
      *          l'entité entrainera celle des propriétés attachées.
      */
-    GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    GeomEntity(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp);
 
 public:
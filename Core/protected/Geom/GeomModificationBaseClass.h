@@ -34,6 +34,7 @@ class Surface;
 class Curve;
 class Vertex;
 class CommandGeomCopy;
+class ShapeSignatureIndex;
 /*----------------------------------------------------------------------------*/
 /**
  * \class GeomModificationBaseClass
@@ -237,10 +238,15 @@ protected:
                   std::vector<Volume*>&      m3d_volumes);
 
      void buildReplacedList(const bool replaceVolumes);
-     void computeReplacedVertex (Vertex*  e);
-     void computeReplacedCurve  (Curve*   e);
-     void computeReplacedSurface(Surface* e);
-     void computeReplacedVolume(Volume* e);
+     /** recherche des entités remplaçant e parmi les entités conservées puis
+      *  créées, seuls les candidats donnés par les index sont testés */
+     void computeReplacedVertex (Vertex*  e, ShapeSignatureIndex& keep_index);
+     void computeReplacedCurve  (Curve*   e, ShapeSignatureIndex& keep_index,
+                                 ShapeSignatureIndex& new_index);
+     void computeReplacedSurface(Surface* e, ShapeSignatureIndex& keep_index,
+                                 ShapeSignatureIndex& new_index);
+     void computeReplacedVolume(Volume* e, ShapeSignatureIndex& keep_index,
+                                ShapeSignatureIndex& new_index);
      void rebuildAdjacencyEntities(const TopoDS_Shape& shape);
      void rebuildAdjacencyLinks();
 
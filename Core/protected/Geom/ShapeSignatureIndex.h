@@ -0,0 +1,153 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ShapeSignatureIndex.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GEOM_SHAPESIGNATUREINDEX_H_
+#define GEOM_SHAPESIGNATUREINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/IndexedMap.h"
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+class GeomEntity;
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Index des entités candidates lors de l'identification des
+ *              entités conservées ou remplacées après une opération booléenne
+ *              (GeomModificationBaseClass).
+ *
+ * Chaque entité (ou shape OCC) est résumée par sa signature : sa boite
+ * englobante (BRepBndLib, comme dans OCCGeomRepresentation::areSame, à
+ * laquelle on ajoute les sommets et les bornes de GeomEntity::getBounds)
+ * élargie de 1/10 de sa diagonale et de mgxGeomDoubleEpsilon.
+ * Deux entités égales au sens de OCCGeomRepresentation::areEquals, ou dont
+ * l'une contient l'autre au sens de Curve/Surface/Volume::contains, ont des
+ * signatures qui se recouvrent : écarter les autres ne change pas le résultat.
+ *
+ * Les signatures sont rangées dans une grille hachée à plusieurs niveaux :
+ * une signature va au niveau dont le pas (une puissance de 2) est juste
+ * supérieur à sa taille, elle n'occupe donc que 8 cellules au plus. On peut
+ * ainsi ajouter des candidats au fur et à mesure sans reconstruire l'index.
+ *
+ * Les candidats sont rendus dans l'ordre d'ajout : un parcours qui s'arrête
+ * au premier candidat trouvé donne le même résultat que sur la liste complète.
+ *
+ * En mode exhaustif (setExhaustive, voir ContextIfc::getGeomPairwiseSearch)
+ * tous les candidats sont rendus (recherche deux à deux sans index), pour
+ * comparaison.
+ */
+class ShapeSignatureIndex
+{
+public:
+    /// boite englobante élargie
+    struct Signature {
+        Signature();
+
+        /// vrai si la boite est vide (aucune géométrie ni sommet)
+        bool isVoid() const {return m_void;}
+
+        /// vrai si les deux boites élargies se recouvrent
+        bool intersects(const Signature& s) const;
+
+        /// ajoute un point à la boite
+        void add(double x, double y, double z);
+
+        /// ajoute une boite à la boite
+        void add(const Signature& s);
+
+        /// élargit la boite de 1/10 de sa diagonale et de mgxGeomDoubleEpsilon
+        void enlarge();
+
+        double m_min[3];
+        double m_max[3];
+        bool m_void;
+    };
+
+    /// signature d'une shape OCC
+    static Signature signature(const TopoDS_Shape& sh);
+
+    /// signature d'une entité, union de celles de ses représentations
+    static Signature signature(GeomEntity* e);
+
+    ShapeSignatureIndex();
+
+    /// rend ou non tous les candidats (recherche deux à deux sans index)
+    void setExhaustive(bool exhaustive) {m_exhaustive = exhaustive;}
+
+    /// nombre de candidats
+    size_t size() const {return m_signatures.size();}
+
+    /// ajoute un candidat, son indice est size()-1
+    void add(const Signature& s);
+
+    /// ajoute une entité candidate
+    void add(GeomEntity* e) {add(signature(e));}
+
+    /** ajoute les entités du vecteur qui ne sont pas encore dans l'index
+     *  (le vecteur ne fait que grandir pendant l'utilisation de l'index) */
+    template <typename T>
+    void update(const std::vector<T*>& entities)
+    {
+        for (size_t i=size(); i<entities.size(); i++)
+            add(entities[i]);
+    }
+
+    /** indices, dans l'ordre croissant, des candidats dont la signature
+     *  recouvre celle donnée */
+    void getCandidates(const Signature& s, std::vector<uint>& indices) const;
+
+private:
+    ShapeSignatureIndex(const ShapeSignatureIndex&);
+    ShapeSignatureIndex& operator = (const ShapeSignatureIndex&);
+
+    /// les candidats d'un niveau de la grille
+    struct Level {
+        int m_level;
+        std::vector<uint> m_items;
+    };
+
+    /// niveau (exposant du pas de la grille) pour une signature
+    static int levelOf(const Signature& s);
+
+    /// clé de hachage d'une cellule
+    static uint64_t cellKey(int level, int64_t i, int64_t j, int64_t k);
+
+    /** indices des cellules couvertes par la signature au niveau donné
+     *  \return faux si ces indices ne sont pas représentables */
+    static bool cellRange(const Signature& s, int level, int64_t first[3], int64_t last[3]);
+
+    /// les signatures des candidats dans l'ordre d'ajout
+    std::vector<Signature> m_signatures;
+
+    /// les candidats sans boite, toujours retenus
+    std::vector<uint> m_unbounded;
+
+    /// les niveaux utilisés
+    std::vector<Level> m_levels;
+
+    /// candidats par cellule
+    Utils::IndexedMap<uint64_t, std::vector<uint> > m_cells;
+
+    /// vrai si tous les candidats sont retenus, voir setExhaustive
+    bool m_exhaustive;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* GEOM_SHAPESIGNATUREINDEX_H_ */
+/*----------------------------------------------------------------------------*/
@@ -59,7 +59,7 @@ public:
      *  \param compProp les propriétés de calcul
      */
 #ifndef SWIG
-    Surface(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    Surface(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, GeomRepresentation* compProp=0);
 #endif
 
@@ -72,7 +72,7 @@ public:
      *  \param compProp les propriétés de calcul des surfaces
      */
 #ifndef SWIG
-    Surface(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    Surface(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, std::vector<GeomRepresentation*>& compProp);
 #endif
 
@@ -50,7 +50,7 @@ public:
      *  \param compProp les propriétés de calcul
      */
 #ifndef SWIG
-    Vertex(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp,
+    Vertex(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp,
             GeomProperty* gprop, GeomRepresentation* compProp);
 #endif
 
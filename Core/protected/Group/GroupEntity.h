@@ -44,7 +44,7 @@ protected:
     /** \brief  Constructeur.
      */
     GroupEntity(Internal::Context& ctx, Utils::Property* prop,
-            Utils::DisplayProperties* disp,
+            const Utils::DisplayProperties& disp,
 			   bool isDefaultGroup,
 			   uint level);
 
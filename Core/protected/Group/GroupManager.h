@@ -482,6 +482,26 @@ public:
      */
     virtual void addPolarPerturbation(const std::string& nom, PyObject* py_obj);
 
+    /*------------------------------------------------------------------------*/
+    /** Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par
+     *  une fonction Python appelée une seule fois pour l'ensemble des noeuds
+     *  Les coordonnées sont cartésiennes
+     *
+     *  \param nom       nom du groupe avec lequel on effectue la perturbation
+     *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     */
+    virtual void addCartesianBatchPerturbation(const std::string& nom, PyObject* py_obj);
+
+    /*------------------------------------------------------------------------*/
+    /** Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par
+     *  une fonction Python appelée une seule fois pour l'ensemble des noeuds
+     *  Les coordonnées sont polaires
+     *
+     *  \param nom       nom du groupe avec lequel on effectue la perturbation
+     *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     */
+    virtual void addPolarBatchPerturbation(const std::string& nom, PyObject* py_obj);
+
     /*------------------------------------------------------------------------*/
     /** Ajoute un lissage surfacique du maillage pour un groupe 2D
      *
@@ -532,6 +552,18 @@ public:
 
 
 private:
+    /** Ajoute une perturbation du maillage par une fonction Python pour un
+     *  groupe (2D ou 3D), commun aux add*Perturbation
+     *
+     *  \param nom        nom du groupe avec lequel on effectue la perturbation
+     *  \param py_obj     l'objet python auquel il est fait appel pour modifier le maillage
+     *  \param polar      vrai si les coordonnées sont polaires
+     *  \param batch      vrai si la fonction est appelée une seule fois pour l'ensemble des noeuds
+     *  \param methodName nom de la méthode appelée, pour la trace dans le script
+     */
+    void addPythonPerturbation(const std::string& nom, PyObject* py_obj,
+            bool polar, bool batch, const std::string& methodName);
+
     /// Conteneur pour les groupes 3D
     std::vector<Group3D*> m_group3D;
 
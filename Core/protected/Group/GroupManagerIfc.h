@@ -177,6 +177,28 @@ public:
      */
     virtual void addPolarPerturbation(const std::string& nom, PyObject* py_obj);
 
+    /** Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par
+     *  une fonction Python appelée une seule fois pour l'ensemble des noeuds
+     *
+     *  La fonction reçoit un memoryview (N x 3 doubles, sans recopie) sur les
+     *  coordonnées cartésiennes des noeuds, et retourne None si elle les a
+     *  modifiées sur place, ou bien un tableau N x 3 de doubles (numpy par exemple)
+     *
+     *  \param nom       nom du groupe avec lequel on effectue la perturbation
+     *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     */
+    virtual void addCartesianBatchPerturbation(const std::string& nom, PyObject* py_obj);
+
+    /** Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par
+     *  une fonction Python appelée une seule fois pour l'ensemble des noeuds
+     *
+     *  Idem addCartesianBatchPerturbation, les coordonnées sont polaires
+     *
+     *  \param nom       nom du groupe avec lequel on effectue la perturbation
+     *  \param py_obj    l'objet python auquel il est fait appel pour modifier le maillage
+     */
+    virtual void addPolarBatchPerturbation(const std::string& nom, PyObject* py_obj);
+
     /*------------------------------------------------------------------------*/
     /** Ajoute un lissage surfacique du maillage pour un groupe 2D
      *
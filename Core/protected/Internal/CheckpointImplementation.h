@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CheckpointImplementation.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef CHECKPOINTIMPLEMENTATION_H_
+#define CHECKPOINTIMPLEMENTATION_H_
+/*----------------------------------------------------------------------------*/
+#include "Internal/ContextIfc.h"
+#include "Utils/Unit.h"
+#include "Utils/Landmark.h"
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+class Entity;
+}
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+class GeomEntity;
+}
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+class Vertex;
+class CoEdge;
+class Edge;
+class CoFace;
+class Face;
+class Block;
+class CoEdgeMeshingProperty;
+class CoFaceMeshingProperty;
+class BlockMeshingProperty;
+}
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+class Context;
+class InfoCommand;
+class CommandRestoreCheckpoint;
+/*----------------------------------------------------------------------------*/
+/**
+ * \class CheckpointImplementation
+ * \brief Ecriture et relecture d'un fichier binaire de reprise de session
+ *
+ *  Le fichier contient, dans un format versionné :
+ *  - les unités, le repère et la dimension du maillage,
+ *  - les compteurs du gestionnaire de noms (pour que les entités créées
+ *  après la reprise aient les mêmes noms que dans la session d'origine),
+ *  - les formes OpenCascade de toutes les entités géométriques (un seul
+ *  composé au format binaire BinTools, les sous-formes partagées le restent)
+ *  et les relations d'adjacence entre entités géométriques,
+ *  - les sommets, arêtes, faces et blocs topologiques avec leurs relations,
+ *  leurs propriétés de discrétisation et leurs associations géométriques,
+ *  - les groupes,
+ *  - optionnellement, le maillage gmds (noeuds et mailles de chaque entité
+ *  topologique) et les groupes de mailles.
+ *
+ *  La relecture recrée directement les entités, sans rejouer les commandes
+ *  qui les ont construites. Seule la géométrie OpenCascade est supportée ;
+ *  les systèmes de coordonnées et les modifications du maillage
+ *  (lissage, perturbation ...) ne sont pas sauvegardés.
+ */
+class CheckpointImplementation {
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur
+     *
+     *  \param c le contexte
+     *  \param fileName le nom du fichier de reprise
+     */
+    CheckpointImplementation(Internal::Context& c, const std::string& fileName);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    virtual ~CheckpointImplementation();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Ecrit la session courante dans le fichier
+     *
+     *  \param withMesh vrai si le maillage doit être sauvegardé
+     */
+    void save(bool withMesh);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Ouvre le fichier et lit son en-tête (version, unités, repère
+     *          et dimension du maillage)
+     */
+    void readHeader();
+
+    /// unité de longueur de la session sauvegardée
+    Utils::Unit::lengthUnit getLengthUnit() const
+    { return m_length_unit; }
+
+    /// repère de la session sauvegardée
+    Utils::Landmark::kind getLandmark() const
+    { return m_landmark; }
+
+    /// dimension du maillage de la session sauvegardée
+    Internal::ContextIfc::meshDim getMeshDim() const
+    { return m_mesh_dim; }
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Lit la suite du fichier et crée les entités, qui sont
+     *          enregistrées dans la commande. readHeader doit avoir été appelé.
+     */
+    void perform(Internal::CommandRestoreCheckpoint* command);
+
+    /*------------------------------------------------------------------------*/
+    /// la version du format écrit
+    static const unsigned int s_version;
+
+private:
+
+    CheckpointImplementation(const CheckpointImplementation&);
+    CheckpointImplementation& operator = (const CheckpointImplementation&);
+
+    /// écriture des entités géométriques, de leurs formes et de leurs relations
+    void writeGeom(std::ostream& out);
+    /// écriture des entités topologiques
+    void writeTopo(std::ostream& out);
+    /// écriture des groupes
+    void writeGroups(std::ostream& out);
+    /// écriture du maillage et des groupes de mailles
+    void writeMesh(std::ostream& out);
+
+    /// lecture et création des entités géométriques
+    void readGeom(std::istream& in, Internal::InfoCommand& icmd);
+    /// lecture et création des entités topologiques
+    void readTopo(std::istream& in, Internal::InfoCommand& icmd);
+    /// lecture et création des groupes
+    void readGroups(std::istream& in, Internal::InfoCommand& icmd);
+    /// lecture et création du maillage et des groupes de mailles
+    void readMesh(std::istream& in, Internal::CommandRestoreCheckpoint* command);
+
+    /// \return l'indice de l'entité dans sa table, -1 si elle n'y est pas
+    int getIndex(const Utils::Entity* e) const;
+
+    /// écriture d'une propriété de discrétisation d'arête
+    static void writeProperty(std::ostream& out, const Topo::CoEdgeMeshingProperty* emp);
+    /// écriture d'une propriété de discrétisation de face commune
+    static void writeProperty(std::ostream& out, const Topo::CoFaceMeshingProperty* fmp);
+    /// écriture d'une propriété de discrétisation de bloc
+    static void writeProperty(std::ostream& out, const Topo::BlockMeshingProperty* bmp);
+
+    /// lecture d'une propriété de discrétisation d'arête
+    static Topo::CoEdgeMeshingProperty* readCoEdgeProperty(std::istream& in);
+    /// lecture d'une propriété de discrétisation de face commune
+    static Topo::CoFaceMeshingProperty* readCoFaceProperty(std::istream& in);
+    /// lecture d'une propriété de discrétisation de bloc
+    static Topo::BlockMeshingProperty* readBlockProperty(std::istream& in);
+
+    /// le contexte
+    Internal::Context& m_context;
+
+    /// le nom du fichier
+    std::string m_file_name;
+
+    /// le fichier en lecture, ouvert par readHeader
+    std::ifstream m_in;
+
+    /** les tables des entités écrites ou relues, les relations entre entités
+     *  sont stockées sous forme d'indices dans ces tables */
+    std::vector<Geom::GeomEntity*> m_geom_entities;
+    std::vector<Topo::Vertex*> m_vertices;
+    std::vector<Topo::CoEdge*> m_coedges;
+    std::vector<Topo::Edge*> m_edges;
+    std::vector<Topo::CoFace*> m_cofaces;
+    std::vector<Topo::Face*> m_faces;
+    std::vector<Topo::Block*> m_blocks;
+
+    /// indice de chaque entité dans sa table (à l'écriture)
+    std::map<const Utils::Entity*, int> m_index;
+
+    /// les compteurs du gestionnaire de noms relus
+    std::vector<unsigned long> m_name_stats;
+
+    /// vrai si le fichier relu contient un maillage
+    bool m_with_mesh;
+
+    /// l'en-tête relu
+    Utils::Unit::lengthUnit m_length_unit;
+    Utils::Landmark::kind m_landmark;
+    Internal::ContextIfc::meshDim m_mesh_dim;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* CHECKPOINTIMPLEMENTATION_H_ */
+/*----------------------------------------------------------------------------*/
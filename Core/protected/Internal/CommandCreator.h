@@ -12,11 +12,11 @@
 
 #include <string>
 
+#include <TkUtil/Log.h>
 
 /*----------------------------------------------------------------------------*/
 namespace TkUtil {
 class LogOutputStream;
-class Log;
 }
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -73,6 +73,13 @@ public:
      */
     virtual void log (const TkUtil::Log& log);
 
+    /**
+     * \return     <I>true</I> si un log du type transmis en argument est
+     *              affiché par le contexte.
+     * \see         MGX_TRACE_IF
+     */
+    virtual bool isLogEnabled (TkUtil::Log::TYPE type) const;
+
     /** retourne le CommandManager */
     virtual Utils::CommandManagerIfc& getCommandManager();
 
@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CommandRestoreCheckpoint.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef COMMANDRESTORECHECKPOINT_H_
+#define COMMANDRESTORECHECKPOINT_H_
+/*----------------------------------------------------------------------------*/
+#include "Mesh/CommandCreateMesh.h"
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+class CheckpointImplementation;
+/*----------------------------------------------------------------------------*/
+/** \class CommandRestoreCheckpoint
+ *  \brief Commande de reprise d'une session à partir d'un fichier binaire
+ *         écrit par Context::saveCheckpoint
+ *
+ *  Les entités géométriques, topologiques, les groupes et le maillage sont
+ *  recréés directement (voir CheckpointImplementation), dans une session
+ *  qui doit être vide. Les commandes suivantes du script peuvent être
+ *  rejouées à la suite de celle-ci.
+ *
+ *  Comme la destruction de tout le maillage, cette commande n'est pas annulable.
+ */
+/*----------------------------------------------------------------------------*/
+class CommandRestoreCheckpoint: public Mesh::CommandCreateMesh{
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur
+     *
+     *  \param c le contexte
+     *  \param impl le lecteur du fichier, dont l'en-tête a été lu
+     */
+    CommandRestoreCheckpoint(Internal::Context& c, CheckpointImplementation* impl);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    virtual ~CommandRestoreCheckpoint();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  exécute la commande
+     */
+    virtual void internalExecute();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  annule la commande
+     */
+    virtual void internalUndo();
+
+    /** \brief  rejoue la commande
+     */
+    virtual void internalRedo();
+
+private:
+
+    /// le lecteur du fichier de reprise
+    CheckpointImplementation* m_impl;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* COMMANDRESTORECHECKPOINT_H_ */
+/*----------------------------------------------------------------------------*/
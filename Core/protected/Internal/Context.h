@@ -262,6 +262,18 @@ public:
     virtual const TkUtil::LogDispatcher& getLogDispatcher ( ) const {return m_log_dispatcher;}
 
     virtual TkUtil::LogOutputStream* getLogStream ( ) {return &m_log_dispatcher; }
+    virtual bool isLogEnabled (TkUtil::Log::TYPE type) const
+    { return 0 != (m_log_dispatcher.getMask ( ) & type); }
+#endif
+    virtual bool getTraceLogsEnabled ( ) const;
+    virtual void setTraceLogsEnabled (bool enable);
+    virtual unsigned long getTraceLogsCount ( ) const;
+    virtual unsigned long getDisplayAttributesSharingCount (
+                                    Utils::Entity::objectType ot) const;
+    virtual long getDisplayAttributesMemorySaved ( ) const;
+    virtual long getNamesMemorySaved ( ) const;
+    virtual unsigned long getInternedNamesCount ( ) const;
+#ifndef SWIG
 	/** \brief	Accesseur sur les flux de logs sur sortie standard et sortie
 	 *			en erreur.
 	 */
@@ -359,11 +371,13 @@ public:
 
     /*------------------------------------------------------------------------*/
     /**
-    * Allocation d'une nouvelle propriété d'affichage pour une entité (la couleur)
+    * Propriétés d'affichage pour une nouvelle entité (la couleur), à copier
+    * par l'entité : la référence retournée n'est valide que jusqu'au prochain
+    * appel pour le même type.
     * \param t le type d'objet
     */
 #ifndef SWIG
-    Utils::DisplayProperties* newDisplayProperties(const Utils::Entity::objectType& ot);
+    const Utils::DisplayProperties& newDisplayProperties(const Utils::Entity::objectType& ot);
 #endif
 
     /** Passage en mode apperçu ou non. En mode apperçu les couleurs fournies
@@ -455,6 +469,36 @@ public:
 	 */
 	virtual void setRatioDegrad(int ratio) {m_ratio_degrad = ratio;}
 
+	/**
+	 * Triangulation des faces delaunayGMSH dans des processus mgx3dGmshWorker.
+	 * \see	ContextIfc::getGmshWorkersNum
+	 */
+	virtual int getGmshWorkersNum ( ) const {return m_gmsh_workers_num;}
+	virtual void setGmshWorkersNum (int num) {m_gmsh_workers_num = num;}
+	virtual std::string getGmshWorkerPath ( ) const;
+	virtual void setGmshWorkerPath (const std::string& path) {m_gmsh_worker_path = path;}
+
+	/**
+	 * Comparaison deux à deux des entités géométriques (collage, booléens).
+	 * \see	ContextIfc::getGeomPairwiseSearch
+	 */
+	virtual bool getGeomPairwiseSearch ( ) const {return m_geom_pairwise_search;}
+	virtual void setGeomPairwiseSearch (bool pairwise) {m_geom_pairwise_search = pairwise;}
+
+	/**
+	 * Parcours complet des blocs à chaque étape de leur découpe.
+	 * \see	ContextIfc::getSplitBlocksFullScan
+	 */
+	virtual bool getSplitBlocksFullScan ( ) const {return m_split_blocks_full_scan;}
+	virtual void setSplitBlocksFullScan (bool fullScan) {m_split_blocks_full_scan = fullScan;}
+
+	/**
+	 * Evaluation de la qualité des mailles maille par maille par Qualif.
+	 * \see	ContextIfc::getMeshQualityPerCell
+	 */
+	virtual bool getMeshQualityPerCell ( ) const {return m_mesh_quality_per_cell;}
+	virtual void setMeshQualityPerCell (bool perCell) {m_mesh_quality_per_cell = perCell;}
+
 	/*------------------------------------------------------------------------*/
     /** \brief  Adapte les Managers pour le cas d'une importation de script.
      *
@@ -499,6 +543,13 @@ public:
      */
     virtual void clearSession();
 
+    /*------------------------------------------------------------------------*/
+    /// sauvegarde l'état de la session dans un fichier binaire de reprise
+    virtual void saveCheckpoint (std::string fileName, bool withMesh=true);
+
+    /// recrée dans une session vide l'état sauvegardé par saveCheckpoint
+    virtual Internal::M3DCommandResultIfc* restoreCheckpoint (std::string fileName);
+
     /** Retourne toutes les entités visibles, y compris celle détruites mais visibles !
      */
     virtual const std::vector<Utils::Entity*> getAllVisibleEntities();
@@ -607,6 +658,8 @@ protected:
     Mgx3D::Geom::GeomManagerIfc*		m_geom_manager;
     /// Manager pour les commandes topologiques
     Mgx3D::Topo::TopoManagerIfc*		m_topo_manager;
+    /// Le même manager, 0 s'il n'est pas un TopoManager (getLocalTopoManager)
+    Mgx3D::Topo::TopoManager*			m_local_topo_manager;
     /// Manager pour le maillage
     Mgx3D::Mesh::MeshManagerIfc*        m_mesh_manager;
     /// Groupes pour les différents types d'entités
@@ -622,9 +675,37 @@ protected:
     /// Manager pour la gestion des noms
     Mgx3D::Internal::NameManager       *m_name_manager;
 
+    /** Gestionnaire de flux qui compte les logs de trace qui lui sont
+     * transmis, qu'ils soient affichés ou non.
+     * \see    getTraceLogsCount
+     */
+    class TraceCountingLogDispatcher : public TkUtil::LogDispatcher
+    {
+        public :
+
+        TraceCountingLogDispatcher ( );
+        TraceCountingLogDispatcher (TkUtil::Log::TYPE mask);
+        virtual ~TraceCountingLogDispatcher ( );
+
+        virtual void log (const TkUtil::Log& log);
+
+        unsigned long getTraceLogsCount ( ) const;
+
+        private :
+
+        TraceCountingLogDispatcher (const TraceCountingLogDispatcher&);
+        TraceCountingLogDispatcher& operator = (const TraceCountingLogDispatcher&);
+
+        /// nombre de logs de trace reçus
+        unsigned long           m_trace_logs_count;
+
+        /// protection du compteur (logs émis par les tâches des commandes)
+        mutable TkUtil::Mutex   m_count_mutex;
+    };
+
     /** Le gestionnaire de flux d'affichage des informations relatives au
      * déroulement de la session. */
-    TkUtil::LogDispatcher               m_log_dispatcher;
+    TraceCountingLogDispatcher          m_log_dispatcher;
 
 	/** Les sorties des logs sur sortie standard et sortie erreurs. */
 	TkUtil::OstreamLogOutputStream*		m_stdout_log_stream;
@@ -677,6 +758,20 @@ protected:
 	 */
 	int m_ratio_degrad;
 
+	/** Nombre de processus mgx3dGmshWorker (-1 : automatique) et chemin de
+	 * l'exécutable (vide : celui de la compilation ou de l'installation) */
+	int m_gmsh_workers_num;
+	std::string m_gmsh_worker_path;
+
+	/** Comparaison deux à deux des entités géométriques, sans index */
+	bool m_geom_pairwise_search;
+
+	/** Parcours complet des blocs lors de leur découpe, sans front */
+	bool m_split_blocks_full_scan;
+
+	/** Evaluation de la qualité des mailles maille par maille, sans lots */
+	bool m_mesh_quality_per_cell;
+
 	/**
 	 * Repère de travail.
 	 */
@@ -728,6 +823,11 @@ protected:
 								m_group3DisplayProperties,
 								m_sysCoordDisplayProperties;
 
+	/** Par type d'entité, les propriétés d'affichage retournées par
+	 * newDisplayProperties. Leurs attributs graphiques sont partagés par
+	 * toutes les entités créées tant qu'ils sont identiques. */
+	std::map<Utils::Entity::objectType, Utils::DisplayProperties>	m_displayPropertiesModels;
+
 	/** Les masques globaux d'affichage. */
 	unsigned long				m_geomVertexMask,
 								m_geomCurveMask,
@@ -330,6 +330,54 @@ public:
     virtual const TkUtil::LogDispatcher& getLogDispatcher ( ) const;
     virtual TkUtil::LogOutputStream* getLogStream ( );
 
+    /** \return  <I>true</I> si les logs du type transmis en argument sont
+     *          affichés par le gestionnaire de flux. A tester avant de
+     *          construire un message coûteux.
+     */
+    virtual bool isLogEnabled (TkUtil::Log::TYPE type) const;
+
+    /** \return  <I>true</I> si les logs de trace (TRACE_3 à TRACE_5) sont
+     *          affichés par le gestionnaire de flux.
+     */
+    virtual bool getTraceLogsEnabled ( ) const;
+
+    /** Active ou désactive l'affichage des logs de trace (TRACE_3 à
+     * TRACE_5) par le gestionnaire de flux.
+     */
+    virtual void setTraceLogsEnabled (bool enable);
+
+    /** \return  Le nombre de logs de trace (TRACE_3 à TRACE_5) transmis au
+     *          gestionnaire de flux depuis la création du contexte, affichés
+     *          ou non. Un log non affiché a été construit inutilement.
+     */
+    virtual unsigned long getTraceLogsCount ( ) const;
+
+    /** \return  Le nombre d'entités du type transmis dont les attributs
+     *          graphiques (couleurs, opacités, ...) sont partagés avec ceux
+     *          des dernières entités créées de ce type, et ne sont donc pas
+     *          dupliqués.
+     */
+    virtual unsigned long getDisplayAttributesSharingCount (
+                                    Utils::Entity::objectType ot) const;
+
+    /** \return  La mémoire économisée, en octets, par le partage des
+     *          attributs graphiques entre entités de même type (tous types
+     *          confondus).
+     */
+    virtual long getDisplayAttributesMemorySaved ( ) const;
+
+    /** \return  La mémoire économisée, en octets, par l'internement des
+     *          noms des entités (Utils::NameArena) par rapport à une
+     *          std::string par entité. Elle peut être négative si les noms
+     *          sont courts et tous distincts.
+     */
+    virtual long getNamesMemorySaved ( ) const;
+
+    /** \return  Le nombre de noms d'entités distincts actuellement
+     *          internés, les noms des entités détruites étant libérés.
+     */
+    virtual unsigned long getInternedNamesCount ( ) const;
+
 	/** <I>true</I> s'il faut afficher les sorties des commandes scripts
 	 * exécutées, <I>false</I> dans le cas contraire.
 	 * \warning		Certaines versions de <I>MPI</I> seraient incompatible avec
@@ -389,6 +437,82 @@ public:
 	 */
 	virtual void setRatioDegrad(int ratio);
 
+	/**
+	 * \return	true si les commandes peuvent utiliser des tâches parallèles
+	 *			(préférence allowThreadedCommandTasks)
+	 */
+	virtual bool getAllowThreadedCommandTasks() const;
+
+	/**
+	 * Autorise ou non les commandes à utiliser des tâches parallèles
+	 * (préférence allowThreadedCommandTasks)
+	 */
+	virtual void setAllowThreadedCommandTasks(bool allow);
+
+	/**
+	 * \return	Le nombre de processus mgx3dGmshWorker demandé pour trianguler
+	 *			les faces delaunayGMSH, -1 pour un nombre automatique (défaut),
+	 *			0 ou 1 pour trianguler dans le processus courant.
+	 * \see		Mesh::GMSHFaceTriangulator
+	 */
+	virtual int getGmshWorkersNum ( ) const;
+
+	/**
+	 * Modifie le nombre de processus mgx3dGmshWorker (-1 : automatique).
+	 */
+	virtual void setGmshWorkersNum (int num);
+
+	/**
+	 * \return	Le chemin de l'exécutable mgx3dGmshWorker utilisé, vide s'il
+	 *			n'est pas disponible.
+	 */
+	virtual std::string getGmshWorkerPath ( ) const;
+
+	/**
+	 * Modifie le chemin de l'exécutable mgx3dGmshWorker, une chaîne vide
+	 * rétablissant celui de la compilation ou de l'installation.
+	 */
+	virtual void setGmshWorkerPath (const std::string& path);
+
+	/**
+	 * \return	true si le collage et les opérations booléennes comparent les
+	 *			entités géométriques deux à deux, sans index spatial
+	 *			(Geom::ShapeSignatureIndex). false par défaut, le mode deux
+	 *			à deux ne sert qu'aux comparaisons.
+	 */
+	virtual bool getGeomPairwiseSearch ( ) const;
+
+	/**
+	 * Active ou non la comparaison deux à deux des entités géométriques.
+	 */
+	virtual void setGeomPairwiseSearch (bool pairwise);
+
+	/**
+	 * \return	true si la découpe de blocs (Topo::CommandSplitBlocks)
+	 *			parcourt tous les blocs à chaque étape au lieu de suivre le
+	 *			front de propagation. false par défaut, le parcours complet
+	 *			ne sert qu'aux comparaisons.
+	 */
+	virtual bool getSplitBlocksFullScan ( ) const;
+
+	/**
+	 * Active ou non le parcours complet des blocs lors de leur découpe.
+	 */
+	virtual void setSplitBlocksFullScan (bool fullScan);
+
+	/**
+	 * \return	true si la qualité des mailles est évaluée maille par maille
+	 *			par Qualif au lieu de l'être par lots (Mesh::MeshQualityKernel).
+	 *			false par défaut, l'évaluation maille par maille ne sert
+	 *			qu'aux comparaisons.
+	 */
+	virtual bool getMeshQualityPerCell ( ) const;
+
+	/**
+	 * Active ou non l'évaluation maille par maille de la qualité.
+	 */
+	virtual void setMeshQualityPerCell (bool perCell);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Adapte les Managers pour le cas d'une importation de script.
      *
@@ -430,6 +554,26 @@ public:
      */
     virtual void clearSession();
 
+	/*------------------------------------------------------------------------*/
+	/**
+	 * Sauvegarde l'état de la session (géométrie, topologie, groupes et
+	 * optionnellement maillage) dans un fichier binaire de reprise. Cette
+	 * opération n'est pas une commande et n'apparaît pas dans le script.
+	 * \param fileName nom du fichier de reprise
+	 * \param withMesh vrai si le maillage doit être sauvegardé
+	 */
+	virtual void saveCheckpoint (std::string fileName, bool withMesh=true);
+	SET_SWIG_COMPLETABLE_METHOD(saveCheckpoint)
+
+	/**
+	 * Recrée, dans une session vide, l'état sauvegardé par saveCheckpoint.
+	 * Les commandes qui suivent dans un script peuvent ensuite être rejouées.
+	 * Cette commande n'est pas annulable.
+	 * \param fileName nom du fichier de reprise
+	 */
+	virtual Internal::M3DCommandResultIfc* restoreCheckpoint (std::string fileName);
+	SET_SWIG_COMPLETABLE_METHOD(restoreCheckpoint)
+
     /** Retourne toutes les entités visibles, y compris celle détruites mais visibles !
      */
     virtual const std::vector<Utils::Entity*> getAllVisibleEntities();
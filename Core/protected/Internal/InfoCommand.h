@@ -9,6 +9,7 @@
 #ifndef INTERNAL_INFOCOMMAND_H_
 #define INTERNAL_INFOCOMMAND_H_
 
+#include "Utils/IndexedMap.h"
 #include <TkUtil/Mutex.h>
 #include <sys/types.h>
 #include <vector>
@@ -40,6 +41,12 @@ namespace Internal {
    On y trouve les listes d'entités crées, modifiées et détruites.
    On y distingue chacun des grands types (Geom, Topo, Mesh et Group)
 
+   Les entités topologiques et les groupes sont indexés par une table de
+   hachage (Utils::IndexedMap) et parcourus dans l'ordre d'enregistrement.
+   Des threads peuvent enregistrer leurs modifications dans un TopoInfoMap
+   local puis les reporter en une seule prise du mutex avec
+   mergeTopoInfoEntities.
+
  */
 class InfoCommand {
 public:
@@ -90,6 +97,12 @@ public:
         type m_type;
     };
 
+    /// les entités topologiques et leur type de modification
+    typedef Utils::IndexedMap<Topo::TopoEntity*, type> TopoInfoMap;
+
+    /// les groupes et leur type de modification
+    typedef Utils::IndexedMap<Group::GroupEntity*, type> GroupInfoMap;
+
     /// Fonction de comparaison suivant l'unique id entre TopoEntityInfo
     static bool compareTopoEntityInfo(TopoEntityInfo& tei1, TopoEntityInfo& tei2)
     {
@@ -111,6 +124,12 @@ public:
      */
     bool addTopoInfoEntity(Topo::TopoEntity* entity, type t);
 
+    /** reporte les informations enregistrées dans une table locale (à un
+     *  thread ou à une sous-commande), avec les mêmes règles que
+     *  addTopoInfoEntity, en ne prenant le mutex qu'une fois
+     */
+    void mergeTopoInfoEntities(const TopoInfoMap& entities);
+
     /** ajoute une information sur le type de modification pour un groupe d'entités de maillage
      *  \return vrai s'il y a eu un changement de type
      */
@@ -119,6 +138,9 @@ public:
     /// ajoute une information sur le type de modification pour un groupe
     void addGroupInfoEntity(Group::GroupEntity* entity, type t);
 
+    /// idem mergeTopoInfoEntities pour les groupes
+    void mergeGroupInfoEntities(const GroupInfoMap& entities);
+
     /// ajoute une information sur le type de modification pour un groupe
     void addSysCoordInfoEntity(CoordinateSystem::SysCoord* entity, type t);
 
@@ -148,8 +170,13 @@ public:
     const std::vector<GeomEntityInfo>& getGeomInfoEntities() const {return m_geom_entities_info;}
 
     /// accès aux entités topologique concernées par une modification et au type de modification
-    std::map<Topo::TopoEntity*, type>& getTopoInfoEntity() {return m_topo_entities_info;}
-    const std::map<Topo::TopoEntity*, type>& getTopoInfoEntity() const {return m_topo_entities_info;}
+    TopoInfoMap& getTopoInfoEntity() {return m_topo_entities_info;}
+    const TopoInfoMap& getTopoInfoEntity() const {return m_topo_entities_info;}
+
+    /** les mêmes, triées suivant l'unique id. Le tri n'est fait que pour les
+     *  entités ajoutées depuis l'appel précédent (fusion avec l'ordre déjà
+     *  calculé)
+     */
     std::vector<InfoCommand::TopoEntityInfo> getSortedTopoInfoEntity();
 
     /// accès aux entités de maillage concernées par une modification et au type de modification
@@ -158,8 +185,8 @@ public:
     const std::vector <MeshEntityInfo>&  getMeshInfoEntities() const {return m_mesh_entities_info;}
 
     /// accès aux entités de type groupe
-    std::map<Group::GroupEntity*, type>& getGroupInfoEntity() {return m_group_entities_info;}
-    const std::map<Group::GroupEntity*, type>& getGroupInfoEntity() const {return m_group_entities_info;}
+    GroupInfoMap& getGroupInfoEntity() {return m_group_entities_info;}
+    const GroupInfoMap& getGroupInfoEntity() const {return m_group_entities_info;}
 
     /// accès aux repères concernés par une modification et au type de modification
     void getSysCoordInfoEntity(uint ind, CoordinateSystem::SysCoord* &entity, type &t);
@@ -202,6 +229,12 @@ protected:
 
 private:
 
+    /// addTopoInfoEntity sans prise du mutex
+    bool _addTopoInfoEntity(Topo::TopoEntity* entity, type t);
+
+    /// addGroupInfoEntity sans prise du mutex
+    void _addGroupInfoEntity(Group::GroupEntity* entity, type t);
+
     /// Mutex pour protéger les les accès concurrents.
     TkUtil::Mutex	m_mutex;
 
@@ -212,13 +245,26 @@ private:
     std::vector <GeomEntityInfo> m_geom_entities_info;
 
     /// ensemble des entités topologiques concernées par la commande et type de modification
-    std::map<Topo::TopoEntity*, type> m_topo_entities_info;
+    TopoInfoMap m_topo_entities_info;
+
+    /** indices dans m_topo_entities_info triés suivant l'unique id,
+     *  pour les m_sorted_topo_index.size() premières entités
+     */
+    std::vector<size_t> m_sorted_topo_index;
+
+    /** nombre de suppressions dans m_topo_entities_info lors du calcul de
+     *  m_sorted_topo_index, qui est à refaire s'il a changé
+     */
+    unsigned long m_sorted_topo_erasures;
 
     /// ensemble des entités de maillage concernées par la commande et type de modification
     std::vector <MeshEntityInfo> m_mesh_entities_info;
 
+    /// indice de la première occurrence de chaque entité dans m_mesh_entities_info
+    Utils::IndexedMap<Mesh::MeshEntity*, size_t> m_mesh_entities_index;
+
     /// ensemble des entités de type groupe concernées par la commande et type de modification
-    std::map<Group::GroupEntity*, type> m_group_entities_info;
+    GroupInfoMap m_group_entities_info;
 
     /// ensemble des repères concernés par la commande et type de modification
     std::vector <SysCoordEntityInfo> m_sys_coord_entities_info;
@@ -40,7 +40,7 @@ protected:
      */
 	InternalEntity(Internal::Context& ctx,
 			Utils::Property* prop,
-			Utils::DisplayProperties* disp);
+			const Utils::DisplayProperties& disp);
 
 public:
     /*------------------------------------------------------------------------*/
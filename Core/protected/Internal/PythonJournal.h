@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file PythonJournal.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_PYTHONJOURNAL_H_
+#define MGX3D_PYTHONJOURNAL_H_
+
+#include <TkUtil/UTF8String.h>
+
+#include <string>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+
+class PythonWriter;
+
+/*----------------------------------------------------------------------------*/
+/** \class PythonJournal
+ *  \brief Journal asynchrone des commandes Python
+ *
+ *  Les lignes (commentaires et commandes) sont déposées par le thread des
+ *  commandes dans un tampon circulaire de capacité fixe, sans verrou
+ *  (un seul producteur). Un thread dédié les transmet par paquets au
+ *  PythonWriter, dès que flushCount lignes sont en attente ou au plus tard
+ *  toutes les flushDelay millisecondes.
+ *
+ *  sync vide le tampon dans le fichier depuis le thread appelant, c'est le
+ *  point de synchronisation utilisé à la sauvegarde, à l'annulation et à
+ *  la destruction du journal. Si le tampon est plein, le producteur le vide
+ *  lui-même.
+ *
+ *  En cas d'arrêt brutal (signaux SIGSEGV, SIGABRT, SIGBUS, SIGFPE et
+ *  SIGTERM), le traitement du signal se limite à des appels à write(2) :
+ *  chaque ligne est mise en forme (octets du fichier, retour chariot
+ *  compris) dès son dépôt, et ces octets sont écrits tels quels à la fin
+ *  du script par un descripteur ouvert à la construction. Une ligne en
+ *  cours de transmission par le thread d'écriture peut alors être écrite
+ *  deux fois, aucune n'est perdue. Le traitement précédemment installé est
+ *  ensuite rappelé.
+ */
+class PythonJournal
+{
+public :
+
+    /**
+     * Constructeur. Lance le thread d'écriture.
+     * \param       l'écrivain dans lequel les lignes sont transmises
+     * \param       le fichier script de l'écrivain
+     * \param       l'encodage du fichier script
+     * \param       le nombre de lignes que peut contenir le tampon
+     * \param       le nombre de lignes en attente déclenchant une écriture
+     * \param       le délai maximum (en millisecondes) avant l'écriture
+     *              des lignes en attente
+     */
+    PythonJournal (PythonWriter& writer, const TkUtil::UTF8String& fileName,
+            const TkUtil::Charset& charset, size_t capacity = 4096,
+            size_t flushCount = 256, unsigned long flushDelay = 500);
+
+    /**
+     * Destructeur. Arrête le thread d'écriture et vide le tampon.
+     */
+    virtual ~PythonJournal ( );
+
+    /** Ajoute au journal un commentaire (ligne sans retour chariot)
+     */
+    virtual void addComment(const TkUtil::UTF8String& cmt);
+
+    /** Ajoute au journal une commande (ligne sans retour chariot)
+     */
+    virtual void addCommand(const TkUtil::UTF8String& cmd);
+
+    /** Ecrit toutes les lignes en attente avant de retourner
+     */
+    virtual void sync ( );
+
+private :
+
+    /**
+     * Constructeur de copie et opérateur =. Interdits.
+     */
+    PythonJournal (const PythonJournal&);
+    PythonJournal& operator = (const PythonJournal&);
+
+    /// une ligne du journal
+    struct Line {
+        bool                m_comment;
+        TkUtil::UTF8String  m_text;
+        /// la ligne telle qu'elle est écrite dans le fichier
+        std::string         m_bytes;
+    };
+
+    /// dépôt d'une ligne dans le tampon (côté producteur)
+    void push(bool comment, const TkUtil::UTF8String& text);
+
+    /// transmet à l'écrivain les lignes en attente, m_drain_mutex doit être pris
+    void drain ( );
+
+    /// boucle du thread d'écriture
+    void run ( );
+
+    /** écrit par write(2) les octets des lignes en attente, sans verrou ni
+     *  allocation (utilisable dans un traitement de signal) */
+    void writePending ( ) const;
+
+    /// traitement des signaux d'arrêt brutal
+    static void crashHandler (int sig);
+
+    /// l'écrivain
+    PythonWriter&               m_writer;
+
+    /// vrai si le script est en UTF-8 (sinon en ISO-8859-1)
+    bool                        m_utf8;
+
+    /// descripteur du script (ajout en fin de fichier), -1 s'il n'a pu être ouvert
+    int                         m_fd;
+
+    /// le tampon circulaire
+    std::vector<Line>           m_lines;
+
+    /// indice (non borné) de la prochaine ligne déposée, modifié par le producteur
+    std::atomic<size_t>         m_head;
+
+    /// indice (non borné) de la prochaine ligne à écrire, modifié sous m_drain_mutex
+    std::atomic<size_t>         m_tail;
+
+    /// le nombre de lignes en attente déclenchant une écriture
+    size_t                      m_flush_count;
+
+    /// le délai maximum avant l'écriture des lignes en attente
+    unsigned long               m_flush_delay;
+
+    /// sérialise les écritures (thread dédié, sync)
+    std::mutex                  m_drain_mutex;
+
+    /// réveil du thread d'écriture
+    std::mutex                  m_wake_mutex;
+    std::condition_variable     m_wake;
+    bool                        m_stop;
+
+    /// le thread d'écriture
+    std::thread                 m_thread;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* MGX3D_PYTHONJOURNAL_H_ */
@@ -23,6 +23,7 @@ class MpiMagix3DBatchRunner;
 namespace Internal {
 
 class ScriptingManager;
+class PythonJournal;
 
 /*----------------------------------------------------------------------------*/
 /** Cette classe gère la sortie dans un fichier des commandes Python
@@ -32,6 +33,7 @@ class ScriptingManager;
 class PythonWriter : public TkUtil::PythonLogOutputStream
 {
 friend class ScriptingManager;
+friend class PythonJournal;
 friend class MpiMagix3D::MpiMagix3DBatchRunner;
 
 public :
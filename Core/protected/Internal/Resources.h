@@ -317,6 +317,13 @@ class Resources
 	 */
 	Preferences::BoolNamedValue					_useDisplayList;
 
+	/**
+	 * Affichage (<I>true</I>) ou non (<I>false</I>) des entités topologiques
+	 * et géométriques par lots : une seule grille et un seul acteur par type
+	 * d'entité au lieu d'acteurs individuels.
+	 */
+	Preferences::BoolNamedValue					_batchedRendering;
+
 	/**
 	 * Si <I>true</I> les évènements claviers de repositionnement dans un plan
 	 * xOy, xOz, yOz provoquent également une annulation du roulis.
@@ -470,6 +477,16 @@ class Resources
 	 * ligne de commande suivant -scripts. */
 	std::vector<std::string>					_scripts;
 
+	/** Faut-il vérifier après chaque commande la cohérence de l'index des
+	 * items des panneaux "Entités" et "Groupes" (argument de ligne de
+	 * commande -checkPanelsItems, pour les tests) ? */
+	bool										_checkPanelsItems;
+
+	/** Faut-il écrire les commandes du script Python directement, sans le
+	 * thread d'écriture du journal (argument de ligne de commande
+	 * -pythonJournalSync, pour comparer les performances) ? */
+	bool										_pythonJournalSync;
+
 	//@}
 
 	
@@ -18,6 +18,7 @@ namespace Mgx3D {
 namespace Internal {
 
 class PythonWriter;
+class PythonJournal;
 class Context;
 
 /*----------------------------------------------------------------------------*/
@@ -41,14 +42,25 @@ public :
     /** Initialise le manager pour les écritures des scripts en Python
      *
      * Si cette initialisation n'est pas faites, les fonctions ne font rien
+     *
+     * Si asynchronous est vrai, les commentaires et commandes sont écrits
+     * par un thread dédié (voir PythonJournal), sinon ils le sont
+     * directement par le thread appelant.
      */
-    virtual void initPython(const TkUtil::UTF8String& fileName, bool withHeader=true);
+    virtual void initPython(const TkUtil::UTF8String& fileName, bool withHeader=true,
+            bool asynchronous=true);
 
 	/**
-	 *\return Un pointeur sur l'écrivain en langage <I>Python</I>.
+	 *\return Un pointeur sur l'écrivain en langage <I>Python</I>, après
+	 * écriture des lignes en attente dans le journal.
 	 */
 	virtual PythonWriter* getPythonWriter ( );
 
+    /** Ecrit dans le script les lignes en attente dans le journal
+     *  asynchrone, à appeler avant toute utilisation du fichier
+     */
+    virtual void sync ( );
+
     /** Ajoute au script un commentaire (ligne sans retour chariot)
      */
     virtual void addComment(const TkUtil::UTF8String& cmt);
@@ -92,6 +104,9 @@ private :
 
     Internal::PythonWriter* m_python_writer;
 
+    /// le journal asynchrone alimentant m_python_writer, 0 en mode synchrone
+    Internal::PythonJournal* m_python_journal;
+
     Internal::Context* m_context;
     /** Le jeu de caractères utilisé pour l'encodage des scripts. */
     TkUtil::Charset m_charset;
@@ -40,7 +40,7 @@ public:
 
     /// Constructeur
 #ifndef SWIG
-    Cloud(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp);
+    Cloud(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp);
 #endif
 
     /// Destructeur
@@ -17,6 +17,8 @@
 #include "Mesh/Line.h"
 #include "Mesh/Surface.h"
 #include "Mesh/Volume.h"
+
+#include <map>
 /*----------------------------------------------------------------------------*/
 namespace gmds {
 class Node;
@@ -32,6 +34,8 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+struct FaceTriangulation;
+/*----------------------------------------------------------------------------*/
 class CommandCreateMesh: public Internal::MultiTaskedCommand {
 
 protected:
@@ -139,6 +143,14 @@ public:
     void addCoFaceInfoMeshingProperty(Topo::CoFace* te, Topo::CoFaceMeshingProperty* tp);
     void addBlockInfoMeshingProperty(Topo::Block* te, Topo::BlockMeshingProperty* tp);
 
+    /*------------------------------------------------------------------------*/
+    /// Confie à la commande la triangulation (calculée à l'avance) d'une face commune
+    void setFaceTriangulation(Topo::CoFace* face, FaceTriangulation* triangulation);
+
+    /** Retourne la triangulation calculée à l'avance pour une face commune (0 si aucune),
+     *  elle est alors à la charge de l'appelant */
+    FaceTriangulation* takeFaceTriangulation(Topo::CoFace* face);
+
 	/* Accès aux méthodes threadedXXX ( ) par une classe extérieure => accès public. */
 	/// Pré-maillage du bloc (appelé depuis un thread).
 	void threadedPreMesh (Topo::Block* block);
@@ -318,6 +330,10 @@ protected:
     Utils::Container<Volume> m_created_volumes;
 
 
+    /// triangulations des faces communes calculées lors du pré-maillage
+    std::map<Topo::CoFace*, FaceTriangulation*> m_face_triangulations;
+
+
     /// Strategie de stockage pour cette commande
     MeshManager::strategy m_strategy;
 };
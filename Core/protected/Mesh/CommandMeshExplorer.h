@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/CommandInternal.h"
 #include "Mesh/SubVolume.h"
+#include "Utils/IndexedMap.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -83,15 +84,15 @@ protected:
     void deleteOldSubVolumes();
 
     /// parcours les volumes, marque les blocs et les faces acceptés
-    void selectCoFaceAndBlocks(std::map<Topo::CoFace*, uint>& filtre_coface,
-            std::map<Topo::Block*, uint>& filtre_block);
+    void selectCoFaceAndBlocks(Utils::IndexedMap<Topo::CoFace*, uint>& filtre_coface,
+            Utils::IndexedMap<Topo::Block*, uint>& filtre_block);
 
     /// on ne prend qu'une fois une arête, on les marque suivant la position de la coupe
-    void computePosCoEdge(std::map<Topo::CoFace*, uint>& filtre_coface,
-            std::map<Topo::CoEdge*, uint> &filtre_coedge);
+    void computePosCoEdge(Utils::IndexedMap<Topo::CoFace*, uint>& filtre_coface,
+            Utils::IndexedMap<Topo::CoEdge*, uint> &filtre_coedge);
 
-    void computePosBlock(std::map<Topo::Block*, uint>& filtre_block,
-            std::map<Topo::CoEdge*, uint> &filtre_coedge,
+    void computePosBlock(Utils::IndexedMap<Topo::Block*, uint>& filtre_block,
+            Utils::IndexedMap<Topo::CoEdge*, uint> &filtre_coedge,
             std::vector<BlockDirPos>& bloc_dirPos);
 
     /// création des sous-volumes suivant la position demandée dans les blocs
@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file CommandUpdateMesh.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef COMMANDUPDATEMESH_H_
+#define COMMANDUPDATEMESH_H_
+/*----------------------------------------------------------------------------*/
+#include "Mesh/CommandCreateMesh.h"
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+class Vertex;
+class CoEdge;
+class CoFace;
+class Block;
+}
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class CommandUpdateMesh
+ *  \brief Commande de mise à jour du maillage des seules entités topologiques
+ *         modifiées depuis qu'elles ont été maillées
+ *
+ *  Une entité maillée est à remailler si elle a été modifiée depuis la
+ *  construction de son maillage (voir TopoEntity::isModifiedSinceMeshed :
+ *  propriété de maillage, association, coordonnées), ou si l'une des entités
+ *  de son bord est à remailler (un sommet pour une arête, une arête pour une
+ *  face, une face pour un bloc).
+ *
+ *  Les mailles de ces entités sont détruites, ainsi que leurs noeuds sauf ceux
+ *  partagés avec les entités conservées (les identifiants des noeuds aux
+ *  interfaces non modifiées sont ainsi conservés). Les entités sont retirées
+ *  des groupes de mailles puis remaillées, comme le fait CommandNewBlocksMesh.
+ *
+ *  Comme la destruction de tout le maillage, cette commande n'est pas annulable.
+ */
+/*----------------------------------------------------------------------------*/
+class CommandUpdateMesh: public Mesh::CommandCreateMesh{
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur, recense les entités à remailler
+     *
+     *  \param c le contexte
+     *  \param nombre de tâches qui seront au maximum lancées en concurrence
+     */
+    CommandUpdateMesh(Internal::Context& c, size_t tasksNum);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    virtual ~CommandUpdateMesh();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  exécute la commande
+     */
+    virtual void internalExecute();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  annule la commande
+     */
+    virtual void internalUndo();
+
+    /** \brief  rejoue la commande
+     */
+    virtual void internalRedo();
+
+    /*------------------------------------------------------------------------*/
+    /**
+     * la commande a vocation à être lancée dans un autre <I>thread</I>.
+     */
+    virtual bool threadable ( ) const
+        { return true; }
+
+    /*------------------------------------------------------------------------*/
+    /// \return vrai si le maillage de l'entité n'est plus à jour
+    static bool isMeshOutOfDate(Topo::Vertex* ve);
+    static bool isMeshOutOfDate(Topo::CoEdge* coedge);
+    static bool isMeshOutOfDate(Topo::CoFace* coface);
+    static bool isMeshOutOfDate(Topo::Block* bloc);
+
+private:
+
+    /*------------------------------------------------------------------------*/
+    /// recense les entités dont le maillage n'est plus à jour
+    void validate();
+
+    /// retire les entités à remailler des groupes de mailles
+    void removeFromMeshGroups();
+
+    /// destruction des mailles et des noeuds propres aux entités à remailler
+    void unmesh();
+
+    /*------------------------------------------------------------------------*/
+    /// les sommets à remailler
+    std::vector<Topo::Vertex*> m_vertices;
+
+    /// les arêtes à remailler
+    std::vector<Topo::CoEdge*> m_coedges;
+
+    /// les faces à remailler
+    std::vector<Topo::CoFace*> m_cofaces;
+
+    /// les blocs à remailler
+    std::vector<Topo::Block*> m_blocks;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* COMMANDUPDATEMESH_H_ */
+/*----------------------------------------------------------------------------*/
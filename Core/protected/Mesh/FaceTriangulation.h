@@ -0,0 +1,56 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file FaceTriangulation.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef PROTECTED_MESH_FACETRIANGULATION_H_
+#define PROTECTED_MESH_FACETRIANGULATION_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Point.h"
+
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Triangulation d'une face commune calculée sans modifier gmds.
+ *
+ * Les sommets des triangles sont soit des noeuds gmds existants (ceux des
+ * arêtes de la face), codés par leur identifiant (valeur positive ou nulle),
+ * soit des noeuds à créer, codés par -(1+i) où i est l'indice du point dans
+ * m_points. Les points à créer sont rangés dans l'ordre de leur première
+ * apparition dans les triangles, ce qui permet de créer les noeuds gmds dans
+ * le même ordre qu'un maillage direct de la face.
+ *
+ * Cette structure sert à calculer les triangulations en dehors du processus
+ * (ou du thread) qui modifie gmds, l'ajout au maillage restant séquentiel.
+ */
+struct FaceTriangulation
+{
+    /// coordonnées des noeuds à créer
+    std::vector<Utils::Math::Point> m_points;
+
+    /// sommets des triangles (3 par triangle), voir le codage ci-dessus
+    std::vector<long> m_triangles;
+
+    /// code d'un noeud à créer à partir de son indice dans m_points
+    static long newPointCode(size_t index) {return -1-(long)index;}
+
+    /// vrai si le sommet code un noeud gmds existant
+    static bool isExistingNode(long code) {return code >= 0;}
+
+    /// indice dans m_points d'un noeud à créer
+    static size_t newPointIndex(long code) {return (size_t)(-1-code);}
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* PROTECTED_MESH_FACETRIANGULATION_H_ */
@@ -0,0 +1,177 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file GMSHFaceTriangulator.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef PROTECTED_MESH_GMSHFACETRIANGULATOR_H_
+#define PROTECTED_MESH_GMSHFACETRIANGULATOR_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Point.h"
+#include "Mesh/FaceTriangulation.h"
+
+#include <GMDS/Utils/CommonTypes.h>
+
+#include <TopoDS_Face.hxx>
+
+#include <iostream>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Données nécessaires à la triangulation GMSH (méthode
+ *              delaunayGMSH) d'une face commune.
+ *
+ * Elles sont extraites de la topologie, de la géométrie et de gmds par
+ * MeshImplementation, la triangulation n'accède ensuite plus qu'à cette
+ * structure. Elle peut ainsi être faite dans un autre processus.
+ */
+struct GMSHFaceRequest
+{
+    /// une arête de la face et son maillage
+    struct Edge {
+        /// nom de l'arête (messages d'erreur)
+        std::string m_name;
+
+        /// nom de la courbe associée (messages d'erreur)
+        std::string m_curve_name;
+
+        /// indice de l'arête parmi celles de la shape de la face (TopExp::MapShapes)
+        int m_index_in_face;
+
+        /// noeuds gmds de l'arête, du premier sommet au second
+        std::vector<gmds::TCellID> m_node_ids;
+
+        /// coordonnées de ces noeuds
+        std::vector<Utils::Math::Point> m_node_coords;
+
+        /// coordonnées des 2 sommets topologiques
+        Utils::Math::Point m_vertex_coords[2];
+
+        /// précision de la géométrie associée à chacun des 2 sommets
+        double m_vertex_precision[2];
+    };
+
+    /// nom de la face commune (messages d'erreur)
+    std::string m_name;
+
+    /// tailles minimale et maximale des mailles
+    double m_lc_min, m_lc_max;
+
+    /// la surface OCC
+    TopoDS_Face m_shape;
+
+    /// les arêtes, chacune une seule fois
+    std::vector<Edge> m_edges;
+
+    /// vrai si une arête est présente 2 fois dans la face
+    bool m_periodic;
+};
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Triangulation GMSH de faces communes.
+ *
+ * GMSH repose sur un état global (CTX::instance(), InitOptions, GModel
+ * courant, numérotation des MVertex), les triangulations ne peuvent pas
+ * être calculées dans plusieurs threads. Pour en calculer plusieurs à la
+ * fois, on lance (posix_spawn, sans fork du processus courant) plusieurs
+ * instances de l'exécutable mgx3dGmshWorker qui font chacune, l'une après
+ * l'autre, les triangulations d'une partie des faces. Les requêtes et les
+ * résultats sont échangés par fichiers temporaires.
+ *
+ * L'exécutable est celui donné par le contexte (setGmshWorkerPath), à
+ * défaut celui de l'arborescence de compilation puis de l'installation.
+ * Le nombre de processus est borné (au plus le nombre de processeurs,
+ * MAX_WORKERS, et un processus pour MIN_FACES_PER_WORKER faces), le
+ * contexte permet de le fixer (setGmshWorkersNum, 0 ou 1 : calcul dans le
+ * processus courant).
+ */
+class GMSHFaceTriangulator
+{
+public :
+
+    /// nombre maximum de processus de triangulation
+    static const unsigned int   MAX_WORKERS;
+
+    /// nombre minimum de faces justifiant un processus
+    static const unsigned int   MIN_FACES_PER_WORKER;
+
+    /// délai (en secondes) au delà duquel un processus est arrêté
+    static const unsigned int   WORKER_TIMEOUT;
+
+    /**
+     * Triangulation d'une face dans le processus courant.
+     * \exception   TkUtil::Exception en cas d'échec de GMSH ou de
+     *              correspondance entre les arêtes et la géométrie.
+     */
+    static void triangulate (
+            const GMSHFaceRequest& request, FaceTriangulation& triangulation);
+
+    /**
+     * Triangulation de plusieurs faces dans des processus mgx3dGmshWorker.
+     * triangulations est dimensionné comme requests, une triangulation
+     * est nulle si elle n'a pas pu être calculée (erreur GMSH, échec ou
+     * délai dépassé pour le processus, absence de l'exécutable). Elle est
+     * alors à faire par triangulate, qui lèvera l'exception appropriée.
+     * Les triangulations retournées sont à détruire par l'appelant.
+     * \param      workersNum  nombre de processus (voir getWorkersNum)
+     * \param      path        chemin de l'exécutable (voir getWorkerPath)
+     */
+    static void triangulate (
+            const std::vector<GMSHFaceRequest*>& requests,
+            std::vector<FaceTriangulation*>& triangulations,
+            unsigned int workersNum, const std::string& path);
+
+    /**
+     * Le nombre de processus à utiliser pour trianguler facesNum faces,
+     * requested étant le nombre demandé (-1 : nombre de processeurs).
+     * 0 si les triangulations sont à faire dans le processus courant.
+     */
+    static unsigned int getWorkersNum (size_t facesNum, int requested);
+
+    /**
+     * Le chemin de l'exécutable mgx3dGmshWorker, requested s'il n'est pas
+     * vide, vide s'il n'est pas disponible.
+     */
+    static std::string getWorkerPath (const std::string& requested);
+
+    /**
+     * Programme principal de mgx3dGmshWorker : triangule les faces du fichier
+     * de requêtes et écrit leurs triangulations dans le fichier de résultats.
+     * \return      0 en cas de succès
+     */
+    static int workerMain (
+            const std::string& requestsFile, const std::string& resultsFile);
+
+    /// écriture/lecture binaire d'une requête
+    static void write (std::ostream& out, const GMSHFaceRequest& request);
+    static void read (std::istream& in, GMSHFaceRequest& request);
+
+    /// écriture/lecture binaire d'une triangulation
+    static void write (std::ostream& out, const FaceTriangulation& triangulation);
+    static void read (std::istream& in, FaceTriangulation& triangulation);
+
+
+private :
+
+    /**
+     * Constructeurs et destructeur. Interdits.
+     */
+    GMSHFaceTriangulator ( );
+    GMSHFaceTriangulator (const GMSHFaceTriangulator&);
+    GMSHFaceTriangulator& operator = (const GMSHFaceTriangulator&);
+    ~GMSHFaceTriangulator ( );
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* PROTECTED_MESH_GMSHFACETRIANGULATOR_H_ */
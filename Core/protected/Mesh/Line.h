@@ -41,7 +41,7 @@ public:
 
     /// Constructeur
 #ifndef SWIG
-    Line(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp);
+    Line(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp);
 #endif
 
     /// Destructeur
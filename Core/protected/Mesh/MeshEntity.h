@@ -46,7 +46,7 @@ protected:
     /** \brief  Constructeur.
      */
     MeshEntity(Internal::Context& ctx, Utils::Property* prop,
-            Utils::DisplayProperties* disp);
+            const Utils::DisplayProperties& disp);
 
 public:
     /*------------------------------------------------------------------------*/
@@ -11,7 +11,9 @@
 #define MGX3D_MESH_MESHIMPLEMENTATION_H_
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshItf.h"
+#include "Mesh/StructuredBlockMesh.h"
 #include "Utils/Point.h"
+#include "Utils/MarkVector.h"
 
 /*----------------------------------------------------------------------------*/
 // GMSH
@@ -41,6 +43,8 @@ namespace Mesh{
 	class Volume;
 	class SubVolume;
 	class Compare2Meshes;
+	struct FaceTriangulation;
+	struct GMSHFaceRequest;
 }
 namespace Geom{
 	class Surface;
@@ -114,7 +118,20 @@ public:
 
 
 
-    /// Retourne le nombre total de noeuds dans le maillage
+    /** Création dans gmds des noeuds intérieurs et des hexaèdres d'un bloc
+     *  structuré dont le maillage n'est conservé que sous forme IJK */
+    virtual void buildStructuredMesh(Topo::Block* bl);
+
+    /** Création dans gmds des noeuds intérieurs et des hexaèdres de tous les
+     *  blocs structurés dont le maillage n'est conservé que sous forme IJK */
+    virtual void buildStructuredMeshes();
+
+    /** Destruction des noeuds intérieurs et des hexaèdres d'un bloc
+     *  structuré créés à la demande (ou de sa forme IJK) */
+    virtual void deleteStructuredMesh(Topo::Block* bl);
+
+    /// Retourne le nombre total de noeuds dans le maillage, y compris ceux
+    /// des blocs conservés sous forme IJK
     virtual int getNbNodes();
 
     /// Retourne le nombre total de bras dans le maillage
@@ -123,7 +140,8 @@ public:
     /// Retourne le nombre total de polygones dans le maillage
     virtual int getNbFaces();
 
-    /// Retourne le nombre total de polyèdres dans le maillage
+    /// Retourne le nombre total de polyèdres dans le maillage, y compris ceux
+    /// des blocs conservés sous forme IJK
     virtual int getNbRegions();
 
     /** Retourne les coordonnées d'un noeud dont on a le pointeur */
@@ -144,6 +162,16 @@ public:
     /// Sauvegarde d'un maillage au format CGNS
     virtual void writeCGNS(std::string nom);
 
+    /** Recopie dans le tampon d'export IJK (coordonnées contiguës) les
+     *  noeuds d'un bloc structuré maillé ou prémaillé dont l'indice k est
+     *  dans [kMin, kMax[, sbm ayant alors kMax-kMin noeuds suivant k.
+     *  Les noeuds sont pris dans la forme IJK du bloc s'il en a une, sans
+     *  créer ses noeuds gmds. La recopie depuis gmds est faite en parallèle
+     *  si les tâches parallèles sont autorisées
+     */
+    virtual void getStructuredBlockMesh(Topo::Block* bl, StructuredBlockMesh& sbm,
+    		uint kMin, uint kMax);
+
     /// Lissage du maillage
     virtual void smooth();
 
@@ -169,6 +197,10 @@ public:
     /// Retourne le ième maillage
     virtual gmds::IGMesh& getGMDSMesh (uint id);
 
+    /// Tables de marques persistantes indexées par les id des cellules (noeuds, polygones ...) du maillage
+    Utils::MarkVectorPool& getMarks ( )
+    { return m_marks; }
+
     /// Ajoute les groupes de mailles de gmds
     bool createGMDSGroups();
 
@@ -207,6 +239,11 @@ private:
     /** Création des polyèdres, des volumes de maillage et y ajoute les polyèdres */
     void _addRegionsInVolumes(Mesh::CommandCreateMesh* command, Topo::Block* bl,
             uint nbBrasI, uint nbBrasJ, uint nbBrasK);
+    /** Création des hexaèdres gmds des couches [0, kEnd[ d'un bloc
+     *  structuré, ajoutés à elem (et à la commande si elle est donnée) */
+    void _addHexahedra(Mesh::CommandCreateMesh* command,
+            std::vector<gmds::TCellID>& nodes, std::vector<gmds::TCellID>& elem,
+            uint nbBrasI, uint nbBrasJ, uint kEnd, bool inverted);
 //    /** Ajoute les polyèdres à un volume */
 //    void _addRegionsInVolume(std::vector<gmds::Region*>& elem, gmds::Mesh<TMask>::volume& vo);
 //    /** Retire les polyèdres du volume */
@@ -241,6 +278,15 @@ private:
 
     /// Création d'un maillage triangulaire de Delaunay pour une face commune (version GMSH)
     virtual void meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo::CoFace* fa);
+
+    /** Calcul des triangulations GMSH (méthode delaunayGMSH) de plusieurs faces communes
+     *  dans des processus mgx3dGmshWorker (voir GMSHFaceTriangulator), sans modification
+     *  de gmds. Les triangulations obtenues sont confiées à la commande, elles seront
+     *  ajoutées au maillage par meshDelaunayGMSH. Les faces en erreur ou non traitées
+     *  ne sont pas triangulées (elles le seront par meshDelaunayGMSH).
+     */
+    virtual void triangulateDelaunayGMSH(Mesh::CommandCreateMesh* command,
+            const std::vector<Topo::CoFace*>& faces);
     /// Création d'un maillage quadrangulaire non structuré pour une face commune
     virtual void meshQuadPairing(Mesh::CommandCreateMesh* command, Topo::CoFace* fa);
 
@@ -363,12 +409,26 @@ private:
     /// met à val une des coordonnées
     void _setToVal(Utils::Math::Point* uij, uint indCoord, uint nbNoeudsI, uint nbNoeudsJ, double val);
 
+    /// extraction des données nécessaires à la triangulation GMSH d'une face commune
+    void _prepareDelaunayGMSH(Topo::CoFace* fa, GMSHFaceRequest& request);
+
+    /// création des noeuds et triangles gmds d'une face commune à partir de sa triangulation
+    void _addFaceTriangulation(Mesh::CommandCreateMesh* command,
+            Topo::CoFace* fa, const FaceTriangulation& triangulation);
+
     /// ajoute un noeud gmds au sommet gmsh en parcourant les sommets d'une Edge, retourne l'indice du sommet dans l'arête
     uint _addGMDSVertex2GVertex(Topo::Edge* edge,
             GVertex* gv1,
             std::map<gmds::TCellID, MVertex*>& cor_gmdsNode_gmshVertex,
             std::map<MVertex*, gmds::TCellID>& cor_gmshVertex_gmdsNode);
 
+    /** indices (idxI, idxJ, idxK) du noeud d'un sommet d'un bloc structuré, déduits
+     *  de la position du sommet dans le bloc (recherche par _getIndexNode si bloc dégénéré)
+    */
+    void _getIndexVertex(Topo::Vertex* vtx, Topo::Block* bl,
+    		uint ni, uint nj, uint nk,
+    		uint &idxI, uint &idxJ, uint &idxK);
+
     /** recherche des indices (idxI, idxJ, idxK) d'un noeud parmi ceux d'un bloc structuré
     */
     void _getIndexNode(gmds::TCellID node, std::vector<gmds::TCellID>& nodes,
@@ -389,6 +449,9 @@ private:
 
     /** Lien sur les structures de maillage GMDS */
     std::vector<gmds::IGMesh*> m_gmds_mesh;
+
+    /** Tables de marques réutilisées d'un parcours à l'autre du maillage */
+    Utils::MarkVectorPool m_marks;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
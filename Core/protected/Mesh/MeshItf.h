@@ -92,6 +92,18 @@ public:
     virtual void mesh(Mesh::CommandCreateMesh* command,
     		Topo::Vertex* sommet) =0;
 
+    /** Création dans gmds des noeuds intérieurs et des polyèdres d'un bloc
+     *  structuré dont le maillage n'est conservé que sous forme IJK */
+    virtual void buildStructuredMesh(Topo::Block* bloc) =0;
+
+    /** Création dans gmds des noeuds intérieurs et des polyèdres de tous les
+     *  blocs structurés dont le maillage n'est conservé que sous forme IJK */
+    virtual void buildStructuredMeshes() =0;
+
+    /** Destruction des noeuds intérieurs et des polyèdres d'un bloc
+     *  structuré créés à la demande (ou de sa forme IJK) */
+    virtual void deleteStructuredMesh(Topo::Block* bloc) =0;
+
     /// Retourne le nombre total de noeuds dans le maillage
     virtual int getNbNodes() =0;
 
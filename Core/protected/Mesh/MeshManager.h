@@ -38,6 +38,7 @@ class Volume;
 class SubVolume;
 
 class CommandMeshExplorer;
+class MeshQualityKernel;
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -120,6 +121,13 @@ public:
     /** \brief  Génère le maillage pour l'ensemble des faces (communes) */
     virtual Mgx3D::Internal::M3DCommandResultIfc* newAllFacesMesh();
 
+    /** \brief  Met à jour le maillage des seules entités topologiques
+     *  modifiées depuis qu'elles ont été maillées (discrétisation,
+     *  association, coordonnées), ainsi que de leurs voisines impactées.
+     *  Cette opération n'est pas annulable.
+     */
+    virtual Mgx3D::Internal::M3DCommandResultIfc* updateMesh();
+
     /*------------------------------------------------------------------------*/
     /** \brief  Construction d'un sous-ensemble d'un volume
      *  constitué des mailles entre 2 feuillets (indices de pos1 à pos2)
@@ -174,6 +182,18 @@ public:
     virtual std::string getInfos(const Surface* me) const;
     virtual std::string getInfos(const Volume* me) const;
 
+    /** Statistiques d'un critère de qualité des mailles d'un volume ou d'une surface */
+    virtual std::vector<double> getQualityStatistics(const std::string& name, int dim, const std::string& criterion) const;
+
+    /** Histogramme d'un critère de qualité des mailles d'un volume ou d'une surface */
+    virtual std::vector<double> getQualityHistogram(const std::string& name, int dim, const std::string& criterion, int nbClasses) const;
+
+    /** Evalue la qualité des mailles d'un volume (dim 3) ou d'une surface (dim 2) */
+    virtual void evaluateQuality(MeshQualityKernel& kernel, const std::string& name, int dim) const;
+
+    /** Noeuds (id et coordonnées) du maillage d'une entité topologique */
+    virtual std::vector<double> getTopoNodes(const std::string& name, int dim);
+
     /*------------------------------------------------------------------------*/
     /** Ajoute un Nuage au manager */
     virtual void add(Cloud* cl);
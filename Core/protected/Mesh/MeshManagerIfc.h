@@ -142,6 +142,13 @@ public:
     /** \brief  Génère le maillage pour l'ensemble des faces (communes) */
     virtual Mgx3D::Internal::M3DCommandResultIfc* newAllFacesMesh();
 
+    /** \brief  Met à jour le maillage des seules entités topologiques
+     *  modifiées depuis qu'elles ont été maillées (discrétisation,
+     *  association, coordonnées), ainsi que de leurs voisines impactées.
+     *  Cette opération n'est pas annulable.
+     */
+    virtual Mgx3D::Internal::M3DCommandResultIfc* updateMesh();
+
     /*------------------------------------------------------------------------*/
     /** \brief  Construction d'un sous-ensemble d'un volume
      *  constitué des mailles entre 2 feuillets (indices de pos1 à pos2)
@@ -223,6 +230,38 @@ public:
     virtual std::string getInfos(const std::string& name, int dim) const;
 	SET_SWIG_COMPLETABLE_METHOD(getInfos)
 
+    /** Retourne les statistiques d'un critère de qualité des mailles d'un
+     *  volume (dim 3, hexaèdres) ou d'une surface (dim 2, quadrangles) :
+     *  [nombre de mailles évaluées, min, max, moyenne, nombre de mailles invalides]
+     *
+     *  \param name nom du volume ou de la surface
+     *  \param dim dimension (3 ou 2)
+     *  \param criterion "ScaledJacobian", "Skew", "AspectRatio" ou "Volume"
+     */
+    virtual std::vector<double> getQualityStatistics(const std::string& name, int dim, const std::string& criterion) const;
+	SET_SWIG_COMPLETABLE_METHOD(getQualityStatistics)
+
+    /** Retourne l'histogramme d'un critère de qualité des mailles d'un volume
+     *  ou d'une surface : nombre de mailles de chacune des nbClasses classes
+     *  réparties sur le domaine du critère ([-1, 1] pour le jacobien normalisé,
+     *  [0, 1] pour le biais, [1, 10] pour le rapport d'aspect, [min, max] pour
+     *  le volume), les valeurs hors domaine étant dans la première ou la
+     *  dernière classe
+     */
+    virtual std::vector<double> getQualityHistogram(const std::string& name, int dim, const std::string& criterion, int nbClasses) const;
+	SET_SWIG_COMPLETABLE_METHOD(getQualityHistogram)
+
+    /** Retourne les noeuds du maillage d'une entité topologique maillée,
+     *  bord compris : [id, x, y, z] pour chaque noeud, dans l'ordre de
+     *  l'entité
+     *
+     *  \param name nom du sommet, de l'arête commune, de la face commune
+     *         ou du bloc
+     *  \param dim dimension de l'entité (0 à 3)
+     */
+    virtual std::vector<double> getTopoNodes(const std::string& name, int dim);
+	SET_SWIG_COMPLETABLE_METHOD(getTopoNodes)
+
 
 private:
 	/**
@@ -11,6 +11,7 @@
 #define MESHMODIFICATIONBYPYTHONFUNCTION_H_
 /*----------------------------------------------------------------------------*/
 #include "Mesh/MeshModificationItf.h"
+#include "Utils/MarkVector.h"
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace gmds{
@@ -26,6 +27,16 @@ namespace Mesh {
  *
  * Objet qui va modifier un maillage suivant une fonction utilisateur en Python
  *
+ * La fonction est appelée soit pour chaque noeud (3 coordonnées en argument,
+ * liste de 3 coordonnées en retour), soit une seule fois pour l'ensemble des
+ * noeuds (mode par lot). Dans ce dernier cas elle reçoit un memoryview
+ * (format 'd', forme N x 3) sur les coordonnées des noeuds, sans recopie
+ * (numpy.asarray(coords) par exemple), et retourne soit None si elle a modifié
+ * ces coordonnées sur place, soit un tableau de même forme : les doubles
+ * natifs (tableau numpy de N x 3 doubles, contigu ou non) sont recopiés
+ * directement, les autres types (float32, entiers, listes de listes ...)
+ * sont convertis nombre par nombre. Les erreurs Python, y compris une vue
+ * sur les coordonnées conservée après l'appel, lèvent une exception.
  */
 class MeshModificationByPythonFunction : public MeshModificationItf {
 public:
@@ -33,7 +44,12 @@ public:
 	/// type de coordonnées, polaires ou cartésiennes
 	enum eTypeCoord {cartesian,polar};
 
-	MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord);
+	/** \param py_obj    fonction utilisateur
+	 *  \param typeCoord type de coordonnées
+	 *  \param batch     vrai si la fonction est appelée une seule fois pour
+	 *                   l'ensemble des noeuds
+	 */
+	MeshModificationByPythonFunction(PyObject* py_obj, eTypeCoord typeCoord, bool batch = false);
 
 	virtual ~MeshModificationByPythonFunction();
 
@@ -41,9 +57,12 @@ public:
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			uint maskFixed);
 
+	/// vrai si la fonction est appelée une seule fois pour l'ensemble des noeuds
+	bool isBatch() const {return m_batch;}
+
 	/** \brief  Fournit une représentation textuelle de l'entité.
 	 * \return	Description, à détruire par l'appelant.
 	 */
@@ -51,7 +70,7 @@ public:
 
 protected:
 	MeshModificationByPythonFunction(const MeshModificationByPythonFunction&)
-    :MeshModificationItf(), m_py_obj(0), m_typeCoord(cartesian)
+    :MeshModificationItf(), m_py_obj(0), m_typeCoord(cartesian), m_batch(false)
     {
         MGX_FORBIDDEN("MeshModificationByPythonFunction::MeshModificationByPythonFunction is not allowed.");
     }
@@ -62,11 +81,24 @@ protected:
         return *this;
     }
 private:
+	/// appel de la fonction pour chacun des noeuds non marqués
+	void applyModificationByNode(std::vector<gmds::Node >& gmdsNodes,
+			const Utils::MarkVector& filtre_nodes,
+			uint maskFixed);
+
+	/// appel de la fonction une seule fois pour tous les noeuds non marqués
+	void applyModificationByBatch(std::vector<gmds::Node >& gmdsNodes,
+			const Utils::MarkVector& filtre_nodes,
+			uint maskFixed);
+
 	/// fonction utilisateur en python de perturbation du maillage
 	PyObject* m_py_obj;
 
 	/// type de coordonnées sur lesquelles doit être utilisé la fonction python
 	eTypeCoord m_typeCoord;
+
+	/// appel de la fonction une seule fois pour l'ensemble des noeuds
+	bool m_batch;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshQualityKernel.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_MESH_MESHQUALITYKERNEL_H_
+#define MGX3D_MESH_MESHQUALITYKERNEL_H_
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class MeshQualityKernel
+ * \brief Evaluation en lot de la qualité des hexaèdres et des quadrangles
+ *        d'un maillage gmds
+ *
+ *  Contrairement à Qualif, qui évalue les critères maille par maille, les
+ *  coordonnées des sommets sont regroupées par paquets de mailles (un tableau
+ *  par sommet et par composante), et les critères sont calculés pour tout un
+ *  paquet par des boucles sans appel virtuel (vectorisables). Les extrema,
+ *  les moyennes et les histogrammes sont cumulés dans la même passe. Les
+ *  paquets sont répartis entre les threads du ThreadPool, le maillage gmds
+ *  n'étant accédé qu'en lecture.
+ *
+ *  Les critères sont ceux de Verdict (utilisés par Qualif) :
+ *  - jacobien normalisé : minimum sur les sommets (et le centre pour un
+ *  hexaèdre) du jacobien calculé avec les arêtes unitaires, dans [-1, 1]
+ *  - biais (skew) : plus grand cosinus entre les axes principaux, dans [0, 1]
+ *  - rapport d'aspect : rapport des longueurs de la plus grande et de la plus
+ *  petite arête, supérieur ou égal à 1
+ *  - volume (aire pour un quadrangle), calculé avec le jacobien au centre
+ *
+ *  Une maille est invalide si l'un de ses jacobiens n'est pas strictement
+ *  positif. Les autres types de mailles (tétraèdres, triangles ...) sont
+ *  ignorées et seulement comptées.
+ *
+ *  Les résultats se cumulent d'un appel à l'autre (plusieurs volumes par
+ *  exemple), jusqu'à l'appel à reset.
+ *
+ *  Le paramètre ContextIfc::getMeshQualityPerCell fait évaluer les critères
+ *  maille par maille par Qualif (séquentiellement), pour comparaison.
+ */
+class MeshQualityKernel {
+public:
+
+    /// les critères évalués
+    enum criterion {
+        SCALED_JACOBIAN = 0,
+        SKEW,
+        ASPECT_RATIO,
+        VOLUME,
+        NB_CRITERIA
+    };
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Statistiques d'un critère
+     */
+    struct Statistics {
+        Statistics();
+
+        /// cumule les statistiques s, de même domaine
+        void merge(const Statistics& s);
+
+        /// \return la moyenne du critère, 0 s'il n'y a pas de maille
+        double getMean() const;
+
+        /// nombre de mailles évaluées
+        size_t nbCells;
+        /// extrema et somme des valeurs
+        double min, max, sum;
+        /// domaine de l'histogramme, vide si domainMin >= domainMax
+        double domainMin, domainMax;
+        /** nombre de mailles par classe, les valeurs hors domaine étant
+         *  comptées dans la première ou la dernière classe */
+        std::vector<size_t> histogram;
+    };
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur
+     *
+     *  \param mesh le maillage gmds (accédé en lecture seule)
+     *  \param nbClasses nombre de classes des histogrammes
+     *  \param threaded vrai si l'évaluation peut être répartie entre les
+     *         threads du ThreadPool
+     *  \param perCell vrai si les critères sont évalués maille par maille
+     *         par Qualif, séquentiellement
+     */
+    MeshQualityKernel(gmds::IGMesh& mesh, size_t nbClasses, bool threaded,
+                      bool perCell);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    virtual ~MeshQualityKernel();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Modifie le domaine de l'histogramme d'un critère (par défaut
+     *          [-1, 1] pour le jacobien normalisé, [0, 1] pour le biais,
+     *          [1, 10] pour le rapport d'aspect, et pas d'histogramme pour
+     *          le volume). A appeler avant les évaluations.
+     */
+    virtual void setDomain(criterion c, double min, double max);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Evalue les polyèdres dont les identifiants sont transmis
+     */
+    virtual void evaluateRegions(const std::vector<gmds::TCellID>& ids);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Evalue les polygones dont les identifiants sont transmis
+     */
+    virtual void evaluateFaces(const std::vector<gmds::TCellID>& ids);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Oublie les évaluations précédentes
+     */
+    virtual void reset();
+
+    /*------------------------------------------------------------------------*/
+    /// \return les statistiques d'un critère
+    virtual const Statistics& getStatistics(criterion c) const;
+
+    /// \return le nombre de mailles invalides
+    virtual size_t getNbInvalid() const
+    { return m_nbInvalid; }
+
+    /// \return le nombre de mailles ignorées (ni hexaèdre, ni quadrangle)
+    virtual size_t getNbIgnored() const
+    { return m_nbIgnored; }
+
+    /*------------------------------------------------------------------------*/
+    /** \return le critère de nom transmis ("ScaledJacobian", "Skew",
+     *          "AspectRatio" ou "Volume"), une exception si le nom est inconnu
+     */
+    static criterion getCriterion(const std::string& name);
+
+    /// \return le nom d'un critère
+    static std::string getCriterionName(criterion c);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Résultats partiels d'une plage de mailles, cumulés ensuite
+     */
+    struct Results {
+        Statistics statistics[NB_CRITERIA];
+        size_t nbInvalid;
+        size_t nbIgnored;
+    };
+
+private:
+    MeshQualityKernel(const MeshQualityKernel&);
+    MeshQualityKernel& operator = (const MeshQualityKernel&);
+
+    /// évaluation des mailles (polyèdres si volumic) par plages, en parallèle ou non
+    void evaluate(const std::vector<gmds::TCellID>& ids, bool volumic);
+
+    /// les résultats initialisés (domaines et histogrammes vides)
+    void initResults(Results& results) const;
+
+    /// cumule des résultats partiels
+    void merge(const Results& results);
+
+    /// le maillage évalué
+    gmds::IGMesh& m_mesh;
+
+    /// nombre de classes des histogrammes
+    size_t m_nbClasses;
+
+    /// vrai si l'évaluation peut être répartie entre les threads
+    bool m_threaded;
+
+    /// vrai si les critères sont évalués maille par maille par Qualif
+    bool m_perCell;
+
+    /// les résultats cumulés
+    Statistics m_statistics[NB_CRITERIA];
+
+    /// nombre de mailles invalides
+    size_t m_nbInvalid;
+
+    /// nombre de mailles ignorées
+    size_t m_nbIgnored;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_MESH_MESHQUALITYKERNEL_H_ */
+/*----------------------------------------------------------------------------*/
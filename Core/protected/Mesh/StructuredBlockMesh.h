@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file StructuredBlockMesh.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef PROTECTED_MESH_STRUCTUREDBLOCKMESH_H_
+#define PROTECTED_MESH_STRUCTUREDBLOCKMESH_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Point.h"
+
+#include <sys/types.h>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Maillage d'un bloc structuré (ou d'une tranche suivant k)
+ *              sous forme de tableaux IJK.
+ *
+ * Les coordonnées des noeuds sont stockées par composante (X, Y puis Z) dans
+ * des tableaux contigus, le noeud (i,j,k) étant à l'indice
+ * i + ni*j + ni*nj*k comme pour Topo::Block::nodes(), ce qui permet de les
+ * écrire directement (export CGNS).
+ *
+ * Un bloc structuré à 8 sommets maillé conserve son maillage sous cette forme
+ * (Topo::BlockMeshingData::structuredMesh()) : seuls les noeuds de sa peau
+ * sont des noeuds gmds (partagés avec les faces communes), les noeuds
+ * intérieurs et les hexaèdres gmds ne sont créés qu'à la première demande
+ * (MeshItf::buildStructuredMesh), soit 24 octets par noeud intérieur et aucun
+ * pour les mailles tant que le maillage n'est qu'exporté.
+ *
+ * Sert également de tampon d'export pour les blocs dont le maillage est dans
+ * gmds (MeshImplementation::getStructuredBlockMesh).
+ */
+class StructuredBlockMesh
+{
+public:
+
+    /** Constructeur d'un maillage vide */
+    StructuredBlockMesh();
+
+    /** Constructeur avec les nombres de noeuds par direction */
+    StructuredBlockMesh(uint ni, uint nj, uint nk);
+
+    /** Constructeur par copie (sauvegarde pour l'annulation) */
+    StructuredBlockMesh(const StructuredBlockMesh& sbm);
+
+    ~StructuredBlockMesh();
+
+    /** Redimensionne le maillage (nombres de noeuds par direction), les
+     *  coordonnées sont perdues */
+    void resize(uint ni, uint nj, uint nk);
+
+    /** Nombres de noeuds par direction */
+    uint ni() const {return m_ni;}
+    uint nj() const {return m_nj;}
+    uint nk() const {return m_nk;}
+
+    /** Nombre de noeuds */
+    size_t getNbNodes() const {return (size_t)m_ni*m_nj*m_nk;}
+
+    /** Nombre de noeuds intérieurs (hors peau) */
+    size_t getNbInnerNodes() const
+    {return m_ni<2 || m_nj<2 || m_nk<2 ? 0 : (size_t)(m_ni-2)*(m_nj-2)*(m_nk-2);}
+
+    /** Nombre d'hexaèdres */
+    size_t getNbCells() const
+    {return m_ni<1 || m_nj<1 || m_nk<1 ? 0 : (size_t)(m_ni-1)*(m_nj-1)*(m_nk-1);}
+
+    /** Vrai si les hexaèdres sont à construire dans l'ordre inverse
+     *  (orientation des mailles suivant k) */
+    bool isInverted() const {return m_inverted;}
+    void setInverted(bool inverted) {m_inverted = inverted;}
+
+    /** Indice du noeud (i,j,k) */
+    size_t nodeIndex(uint i, uint j, uint k) const
+    {return i + (size_t)m_ni*(j + (size_t)m_nj*k);}
+
+    /** Accès aux coordonnées d'un noeud */
+    Utils::Math::Point getPoint(size_t index) const
+    {return Utils::Math::Point(m_x[index], m_y[index], m_z[index]);}
+    void setPoint(size_t index, const Utils::Math::Point& pt)
+    {m_x[index] = pt.getX(); m_y[index] = pt.getY(); m_z[index] = pt.getZ();}
+    void setPoint(size_t index, double x, double y, double z)
+    {m_x[index] = x; m_y[index] = y; m_z[index] = z;}
+
+    /** Tableaux contigus des coordonnées (getNbNodes() valeurs chacun) */
+    const double* x() const {return m_x.empty() ? 0 : &m_x[0];}
+    const double* y() const {return m_y.empty() ? 0 : &m_y[0];}
+    const double* z() const {return m_z.empty() ? 0 : &m_z[0];}
+
+private:
+    StructuredBlockMesh& operator = (const StructuredBlockMesh&);
+
+    /// nombres de noeuds par direction
+    uint m_ni, m_nj, m_nk;
+
+    /// orientation des hexaèdres
+    bool m_inverted;
+
+    /// coordonnées des noeuds, par composante
+    std::vector<double> m_x, m_y, m_z;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* PROTECTED_MESH_STRUCTUREDBLOCKMESH_H_ */
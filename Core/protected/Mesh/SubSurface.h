@@ -30,7 +30,7 @@ public:
     /// Constructeur
     SubSurface(Internal::Context& ctx,
             Utils::Property* prop,
-            Utils::DisplayProperties* disp,
+            const Utils::DisplayProperties& disp,
             uint gmds_id);
 
     /// Destructeur
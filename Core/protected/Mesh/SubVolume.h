@@ -33,7 +33,7 @@ public:
     /// Constructeur
     SubVolume(Internal::Context& ctx,
             Utils::Property* prop,
-            Utils::DisplayProperties* disp,
+            const Utils::DisplayProperties& disp,
             uint gmds_id);
 
     /// Destructeur
@@ -44,7 +44,7 @@ public:
 
     /// Constructeur
 #ifndef SWIG
-    Volume(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp);
+    Volume(Internal::Context& ctx, Utils::Property* prop, const Utils::DisplayProperties& disp);
 #endif
 
     /// Destructeur
@@ -0,0 +1,150 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ColoredVolumicSmoother.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef COLOREDVOLUMICSMOOTHER_H_
+#define COLOREDVOLUMICSMOOTHER_H_
+/*----------------------------------------------------------------------------*/
+#include <sys/types.h>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class ColoredVolumicSmoother
+ *
+ * Lisseur volumique natif travaillant sur des tableaux contigus (indices
+ * denses 0..nbNodes-1), sans passer par Smooth3D.
+ *
+ * Les adjacences noeud->mailles et noeud->noeuds (arêtes des hexaèdres et
+ * tétraèdres, tous les noeuds de la maille pour les autres polyèdres) sont
+ * construites une seule fois au format CSR. Les noeuds libres sont ensuite
+ * colorés de telle sorte que deux noeuds d'une même couleur n'appartiennent
+ * à aucune maille commune : les noeuds d'une couleur peuvent alors être
+ * déplacés simultanément (tâches du TkUtil::ThreadPool), chacun ne lisant que
+ * des noeuds d'autres couleurs.
+ *
+ * Le résultat ne dépend pas du nombre de threads : il est identique à celui
+ * d'un parcours séquentiel des couleurs dans l'ordre, et des noeuds dans
+ * l'ordre croissant au sein de chaque couleur.
+ */
+class ColoredVolumicSmoother {
+public:
+
+	/// les fonctions objectif pour l'optimisation des noeuds
+	enum eObjective {
+		conditionNumber = 0,
+		inverseMeanRatio};
+
+	/** Constructeur à partir de la connectivité des mailles (même format que
+	 *  Smooth3D : nombre de noeuds de chaque maille puis indices des noeuds
+	 *  des mailles les uns à la suite des autres)
+	 *  \param nbCells nombre de mailles
+	 *  \param nbNodes nombre de noeuds
+	 *  \param nbNodesCell nombre de noeuds par maille
+	 *  \param cellNodes indices des noeuds des mailles
+	 *  \param weights poids des mailles puis poids des noeuds (comme pour
+	 *  Smooth3D), 0 pour des poids tous égaux à 1
+	 *  \param relax 0 pour un noeud fixe, sinon facteur de relaxation du
+	 *  déplacement du noeud
+	 */
+	ColoredVolumicSmoother(uint nbCells, uint nbNodes,
+			const int* nbNodesCell, const int* cellNodes,
+			const double* weights, const double* relax);
+
+	~ColoredVolumicSmoother();
+
+	/// utilisation (ou non) du TkUtil::ThreadPool, non par défaut
+	void setThreaded(bool threaded) {m_threaded = threaded;}
+
+	/// nombre de couleurs utilisées pour les noeuds libres
+	uint getNbColors() const {return m_colorPtr.empty() ? 0 : m_colorPtr.size()-1;}
+
+	/** Lissage laplacien : chaque noeud libre est rapproché (suivant sa
+	 *  relaxation) du barycentre de ses voisins par une arête, pondérés par
+	 *  le poids des noeuds */
+	void laplace(double* x, double* y, double* z, int nbIterations);
+
+	/** Lissage par optimisation locale : chaque noeud libre est déplacé de
+	 *  façon à diminuer la somme, sur les coins des mailles qui lui sont
+	 *  incidentes, de la fonction objectif pondérée par le poids des mailles.
+	 *  Le pas initial de la descente est proportionnel à la relaxation.
+	 *  Seuls les coins des hexaèdres et tétraèdres sont évalués.
+	 */
+	void optimize(eObjective objective, double* x, double* y, double* z, int nbIterations);
+
+	/// traitement d'une plage [first, last[ de la couleur courante (appelé depuis un thread)
+	void smoothRange(size_t first, size_t last);
+
+private:
+	ColoredVolumicSmoother(const ColoredVolumicSmoother&);
+	ColoredVolumicSmoother& operator = (const ColoredVolumicSmoother&);
+
+	/// parcours de toutes les couleurs pour une itération
+	void sweep();
+
+	/// déplacement laplacien d'un noeud
+	void laplaceNode(uint node);
+
+	/// déplacement d'un noeud par optimisation
+	void optimizeNode(uint node);
+
+	/// valeur de la fonction objectif pour les mailles incidentes au noeud
+	double nodeObjective(uint node) const;
+
+	/// valeur de la fonction objectif pour les coins d'une maille
+	double cellObjective(uint cell) const;
+
+	/// construction des adjacences CSR
+	void buildAdjacencies(uint nbNodes);
+
+	/// coloration des noeuds libres
+	void buildColors(uint nbNodes);
+
+	/// mailles: m_cellNodes[m_cellPtr[c] .. m_cellPtr[c+1][
+	std::vector<size_t> m_cellPtr;
+	std::vector<uint> m_cellNodes;
+
+	/// poids des mailles et des noeuds
+	std::vector<double> m_cellWeights;
+	std::vector<double> m_nodeWeights;
+
+	/// relaxation des noeuds
+	std::vector<double> m_relax;
+
+	/// orientation (1 ou -1) des mailles, déterminée avant lissage
+	std::vector<double> m_cellSign;
+
+	/// mailles incidentes aux noeuds: m_nodeCells[m_nodeCellPtr[n] .. m_nodeCellPtr[n+1][
+	std::vector<size_t> m_nodeCellPtr;
+	std::vector<uint> m_nodeCells;
+
+	/// voisins des noeuds: m_nodeNbrs[m_nodeNbrPtr[n] .. m_nodeNbrPtr[n+1][
+	std::vector<size_t> m_nodeNbrPtr;
+	std::vector<uint> m_nodeNbrs;
+
+	/// noeuds libres par couleur: m_colorNodes[m_colorPtr[c] .. m_colorPtr[c+1][
+	std::vector<size_t> m_colorPtr;
+	std::vector<uint> m_colorNodes;
+
+	/// état pendant un lissage
+	bool m_threaded;
+	bool m_laplace;
+	eObjective m_objective;
+	double* m_x;
+	double* m_y;
+	double* m_z;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* COLOREDVOLUMICSMOOTHER_H_ */
@@ -13,6 +13,7 @@
 #include <vector>
 #include <map>
 #include <sys/types.h> // pour uint
+#include "Utils/MarkVector.h"
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace gmds{
@@ -35,7 +36,7 @@ public:
 	/// passage de Gmds vers Mesquite dans le cas d'une surface
 	MesquiteMeshAdapter(std::vector<gmds::Face>& gmdsPolygones,
 			std::vector<gmds::Node>& gmdsNodes,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			std::map<gmds::TCellID, bool>& isPolyInverted,
 			uint maskFixed);
 
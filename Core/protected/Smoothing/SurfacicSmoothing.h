@@ -13,6 +13,7 @@
 #include "Mesh/MeshModificationItf.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/UTF8String.h>
+#include "Utils/MarkVector.h"
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace gmds{
@@ -28,6 +29,9 @@ class Surface;
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+class MesquiteDomainAdapter;
+class MesquiteMeshAdapter;
+/*----------------------------------------------------------------------------*/
 /**
  * \class SurfacicSmoothing
  *
@@ -51,6 +55,13 @@ public:
 	/// Constructeur avec paramètres différents du défaut
 	SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver);
 
+	/** Constructeur avec lissage par morceaux
+	 *  \param nbPatches nombre de morceaux lissés indépendamment (1 pour
+	 *  un lissage global)
+	 */
+	SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver,
+			int nbPatches);
+
 	/// change le nombre d'itérations
 	void setNbIterations(int nbIterations);
 
@@ -60,6 +71,10 @@ public:
 	/// change le type de solver utilisé par Mesquite
 	void setSolver(eSolver solver);
 
+	/** change le nombre de morceaux lissés indépendamment, 1 (défaut) pour
+	 *  un lissage global. Ce nombre est réduit pour les petites surfaces. */
+	void setNbPatches(int nbPatches);
+
 	/// accesseur sur le nombre d'itérations
 	int getNbIterations() const {return m_nbIterations;}
 
@@ -69,6 +84,9 @@ public:
 	/// accesseur sur le solver
 	eSolver getSolver() const {return m_solver;}
 
+	/// accesseur sur le nombre de morceaux
+	int getNbPatches() const {return m_nbPatches;}
+
 #ifndef SWIG
 
 	/// converti en chaine de caractères une méthode de lissage
@@ -85,13 +103,21 @@ public:
 
 	/** Fonction d'appel pour modifier un ensemble de noeuds du maillage
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
+	 *  Les morceaux sont lissés dans des tâches du TkUtil::ThreadPool si
+	 *  threaded est vrai, le découpage et le résultat n'en dépendent pas.
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Face>& gmdsPolygones,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			std::map<gmds::TCellID, bool>& isPolyInverted,
 			uint maskFixed,
-			Geom::Surface* surface);
+			Geom::Surface* surface,
+			bool threaded = false);
+
+	/* Accès depuis une tâche du lissage par morceaux => accès public. */
+	/// Lissage d'un maillage Mesquite (appelé depuis un thread)
+	void threadedSmooth(MesquiteMeshAdapter* mesh, MesquiteDomainAdapter* mdl_geom,
+			bool withAssessment) const;
 
 	/** \brief  Fournit une représentation textuelle de l'entité.
 	 * \return	Description, à détruire par l'appelant.
@@ -107,6 +133,18 @@ protected:
 	SurfacicSmoothing& operator = (const SurfacicSmoothing&);
 
 private:
+	/** Lissage par morceaux : les polygones sont répartis en nbPatches morceaux
+	 *  connexes lissés indépendamment (en parallèle si threaded), noeuds des
+	 *  interfaces figés, puis les noeuds des interfaces sont lissés à leur tour
+	 */
+	void applyModificationByPatches(std::vector<gmds::Node >& gmdsNodes,
+			std::vector<gmds::Face>& gmdsPolygones,
+			const Utils::MarkVector& filtre_nodes,
+			std::map<gmds::TCellID, bool>& isPolyInverted,
+			uint maskFixed,
+			Geom::Surface* surface,
+			uint nbPatches, bool threaded);
+
 	/// mémorise le fait que l'utilisateur ait changé un paramètre, pour getScriptCommand
 	bool m_useDefaults;
 
@@ -119,6 +157,9 @@ private:
 	/// le solver pour les algos de Mesquite
 	eSolver m_solver;
 
+	/// nombre de morceaux lissés indépendamment
+	int m_nbPatches;
+
 #endif
 };
 /*----------------------------------------------------------------------------*/
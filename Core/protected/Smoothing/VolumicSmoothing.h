@@ -13,6 +13,7 @@
 #include "Mesh/MeshModificationItf.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/UTF8String.h>
+#include "Utils/MarkVector.h"
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace gmds{
@@ -37,13 +38,19 @@ namespace Mesh {
 class VolumicSmoothing : public MeshModificationItf {
 public:
 
-	/// énuméré sur les différentes méthodes de lissage volumique
+	/** énuméré sur les différentes méthodes de lissage volumique
+	 *  Les méthodes colored* utilisent le lisseur natif (ColoredVolumicSmoother),
+	 *  les autres Smooth3D.
+	 */
 	enum eVolumicMethod {
 		laplace = 0,
 		tipton,
 		jun,
 		conditionNumber,
-		inverseMeanRatio};
+		inverseMeanRatio,
+		coloredLaplace,
+		coloredConditionNumber,
+		coloredInverseMeanRatio};
 
 	/// Constructeur pour fonction de lissage volumique avec les arguments par défaut
 	VolumicSmoothing();
@@ -76,12 +83,15 @@ public:
 
 	/** Fonction d'appel pour modifier un ensemble de noeuds du maillage
 	 *  Ne sont modifiés que ceux dont la valeur est différente de la marque dans le filtre
+	 *  Le lisseur natif (méthodes colored*) est multithreadé si threaded est vrai,
+	 *  le résultat est le même que sans threads.
 	 */
 	virtual void applyModification(std::vector<gmds::Node >& gmdsNodes,
 			std::vector<gmds::Region>& gmdsPolyedres,
-			std::map<gmds::TCellID, uint>& filtre_nodes,
+			const Utils::MarkVector& filtre_nodes,
 			uint maskFixed,
-			Geom::Volume* volume);
+			Geom::Volume* volume,
+			bool threaded = false);
 
 	/** \brief  Fournit une représentation textuelle de l'entité.
 	 * \return	Description, à détruire par l'appelant.
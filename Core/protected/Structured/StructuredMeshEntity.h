@@ -42,7 +42,7 @@ class StructuredMeshEntity : public Mgx3D::Internal::InternalEntity
 	 *		charge leur destruction.</B>
 	 */
 	StructuredMeshEntity (
-		Mgx3D::Internal::Context& context, Mgx3D::Utils::Property* prop, Mgx3D::Utils::DisplayProperties* disp,
+		Mgx3D::Internal::Context& context, Mgx3D::Utils::Property* prop, const Mgx3D::Utils::DisplayProperties& disp,
 		Mgx3D::Structured::StructuredMesh&, const std::vector<Mgx3D::Structured::Material*>& materials);
 
 	/**
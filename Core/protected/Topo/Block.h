@@ -380,11 +380,15 @@ public:
     /** Accesseur sur la liste des points */
     Utils::Math::Point*& points() {return m_mesh_data->points();}
 
-    /** Accesseur sur la liste des noeuds gmds */
-    std::vector<gmds::TCellID>& nodes() {return m_mesh_data->nodes();}
-
-    /** Accesseur sur la liste des polyêdres gmds */
-    std::vector<gmds::TCellID>& regions() {return m_mesh_data->regions();}
+    /** Accesseur sur la liste des noeuds gmds.
+     *  Les noeuds intérieurs et les polyèdres d'un maillage structuré
+     *  conservé sous forme IJK sont alors créés dans gmds
+     *  (getMeshingData()->nodes() pour y accéder sans les créer) */
+    std::vector<gmds::TCellID>& nodes();
+
+    /** Accesseur sur la liste des polyêdres gmds, créés si nécessaire
+     *  comme pour nodes() */
+    std::vector<gmds::TCellID>& regions();
 
     /*------------------------------------------------------------------------*/
     //    /// retourne l'ensemble des arêtes pour une direction donnée
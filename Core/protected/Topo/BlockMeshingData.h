@@ -11,6 +11,7 @@
 #define BLOCKMESHINGDATA_H_
 /*----------------------------------------------------------------------------*/
 #include "Utils/Point.h"
+#include "Mesh/StructuredBlockMesh.h"
 #include <GMDS/Utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -26,7 +27,9 @@ public:
     : m_is_meshed(false)
     , m_is_premeshed(false)
 	, m_is_mesh_crossed(false)
+	, m_is_built_on_demand(false)
 	, m_points(0)
+	, m_structured_mesh(0)
     {
     	//std::cout<<"BlockMeshingData()"<<std::endl;
     }
@@ -34,6 +37,7 @@ public:
     ~BlockMeshingData()
     {
     	//std::cout<<"~BlockMeshingData()"<<std::endl;
+    	delete m_structured_mesh;
     }
 
     BlockMeshingData* clone() {
@@ -41,9 +45,12 @@ public:
         emd->m_is_meshed = m_is_meshed;
         emd->m_is_premeshed = m_is_premeshed;
         emd->m_is_mesh_crossed = m_is_mesh_crossed;
+        emd->m_is_built_on_demand = m_is_built_on_demand;
         emd->m_nodes.insert(emd->m_nodes.end(), m_nodes.begin(), m_nodes.end());
         emd->m_poly.insert(emd->m_poly.end(), m_poly.begin(), m_poly.end());
         emd->m_points =  m_points;
+        if (m_structured_mesh)
+            emd->m_structured_mesh = new Mesh::StructuredBlockMesh(*m_structured_mesh);
         return emd;
     }
 
@@ -67,6 +74,22 @@ public:
     /** Modificateur de l'état du maillage */
     void setMeshCrossed(bool val) { m_is_mesh_crossed = val; }
 
+    /*------------------------------------------------------------------------*/
+    /** Accesseur sur le maillage conservé sous forme IJK, 0 si les noeuds
+     *  intérieurs et les polyèdres sont dans gmds.
+     *  Tant qu'il existe, les noeuds intérieurs valent gmds::NullID dans
+     *  nodes() et regions() est vide */
+    Mesh::StructuredBlockMesh*& structuredMesh() {return m_structured_mesh;}
+
+    /** Vrai si les noeuds intérieurs et les polyèdres sont (ou seront) créés
+     *  à la demande depuis structuredMesh(), et non par la commande de maillage */
+    bool isBuiltOnDemand() const {return m_is_built_on_demand;}
+    void setBuiltOnDemand(bool val) { m_is_built_on_demand = val; }
+
+    /** Nombre de polyèdres, construits ou non */
+    size_t getNbRegions() const
+    {return m_structured_mesh ? m_structured_mesh->getNbCells() : m_poly.size();}
+
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des points */
     Utils::Math::Point*& points() {return m_points;}
@@ -89,6 +112,9 @@ private:
     /// Maillage associé avec maille croisée ou non
     bool m_is_mesh_crossed;
 
+    /// Noeuds intérieurs et polyèdres créés à la demande
+    bool m_is_built_on_demand;
+
     /// Liste des noeuds (gmds) associés
     std::vector<gmds::TCellID> m_nodes;
 
@@ -97,6 +123,9 @@ private:
 
     /// Les points pour le maillage
     Utils::Math::Point* m_points;
+
+    /// Le maillage sous forme IJK en attente de création dans gmds
+    Mesh::StructuredBlockMesh* m_structured_mesh;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
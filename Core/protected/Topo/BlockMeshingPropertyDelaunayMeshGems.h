@@ -19,12 +19,19 @@
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
+namespace Internal {
+class CheckpointImplementation;
+}
+/*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 /**
    @brief Propriété de la discrétisation d'un bloc suivant une direction
  */
 class BlockMeshingPropertyDelaunayMeshGems : public BlockMeshingProperty {
+
+    friend class Internal::CheckpointImplementation;
+
 public:
 
     typedef enum{
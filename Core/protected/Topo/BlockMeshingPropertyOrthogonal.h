@@ -17,6 +17,10 @@
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
+namespace Internal {
+class CheckpointImplementation;
+}
+/*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 /**
@@ -24,6 +28,8 @@ namespace Topo {
  */
 class BlockMeshingPropertyOrthogonal : public BlockMeshingPropertyDirectional {
 
+    friend class Internal::CheckpointImplementation;
+
 public:
 
     /*------------------------------------------------------------------------*/
@@ -87,8 +87,13 @@ public:
 private:
 
     /*------------------------------------------------------------------------*/
-    void findBlockUnmarkedWithCoEdgeMarked(std::set<Block*>& filtre_blocs,
-    		std::set<CoEdge*>& filtre_coedges, Block* &bloc, CoEdge* &arete);
+    /// front de propagation de la découpe (arêtes marquées et blocs à découper)
+    struct Front;
+
+    /** recherche le prochain bloc non découpé possédant une arête marquée,
+     *  celui de plus petit indice dans m_blocs (comme un parcours de m_blocs),
+     *  et la première de ses arêtes marquées */
+    void findBlockUnmarkedWithCoEdgeMarked(Front& front, Block* &bloc, CoEdge* &arete);
 
     /*------------------------------------------------------------------------*/
     /// Vérification de la valeur de m_ratio
@@ -14,6 +14,10 @@
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
+namespace Internal {
+class CheckpointImplementation;
+}
+/*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 /**
@@ -21,6 +25,9 @@ namespace Topo {
    ayant une progression géométrique
  */
 class EdgeMeshingPropertyGeometric : public CoEdgeMeshingProperty {
+
+    friend class Internal::CheckpointImplementation;
+
 public:
 
     /*------------------------------------------------------------------------*/
@@ -19,12 +19,19 @@
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
+namespace Internal {
+class CheckpointImplementation;
+}
+/*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 /**
    @brief Propriété de la discrétisation d'une face commune
  */
 class FaceMeshingPropertyMeshGems : public CoFaceMeshingProperty {
+
+    friend class Internal::CheckpointImplementation;
+
 public:
     /*------------------------------------------------------------------------*/
     /// Constructeur avec paramètres par défaut
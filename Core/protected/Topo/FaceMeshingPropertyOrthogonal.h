@@ -17,12 +17,19 @@
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
+namespace Internal {
+class CheckpointImplementation;
+}
+/*----------------------------------------------------------------------------*/
 namespace Topo {
 /*----------------------------------------------------------------------------*/
 /**
    @brief Propriété de la discrétisation d'une face commune suivant une direction
  */
 class FaceMeshingPropertyOrthogonal : public FaceMeshingPropertyDirectional {
+
+    friend class Internal::CheckpointImplementation;
+
 public:
 
     /*------------------------------------------------------------------------*/
@@ -48,7 +48,7 @@ protected:
     /** \brief  Constructeur.
      */
     TopoEntity(Internal::Context& ctx, Utils::Property* prop,
-            Utils::DisplayProperties* disp);
+            const Utils::DisplayProperties& disp);
 
 public:
     /*------------------------------------------------------------------------*/
@@ -182,6 +182,32 @@ public:
      */
     virtual unsigned long getNbInternalMeshingNodes() {return 0;}
 
+#ifndef SWIG
+    /*------------------------------------------------------------------------*/
+    /** Estampille de la dernière modification ayant une incidence sur le
+     *  maillage (propriété de maillage, association, coordonnées des sommets,
+     *  discrétisation des arêtes adjacentes).
+     *  Les estampilles sont strictement croissantes, elles permettent de
+     *  savoir si l'entité a été modifiée depuis qu'elle a été maillée.
+     */
+    unsigned long getModificationStamp() const {return m_modification_stamp;}
+
+    /// Marque l'entité comme modifiée
+    void updateModificationStamp() {m_modification_stamp = newStamp();}
+
+    /// Estampille du maillage de l'entité (mise à jour lorsqu'elle est maillée)
+    unsigned long getMeshStamp() const {return m_mesh_stamp;}
+
+    /// Marque le maillage de l'entité comme étant à jour
+    void updateMeshStamp() {m_mesh_stamp = newStamp();}
+
+    /** Vrai si l'entité a été modifiée depuis la construction de son maillage
+     *  (sans intérêt si elle n'est pas maillée), voir CommandUpdateMesh */
+    bool isModifiedSinceMeshed() const {return m_modification_stamp > m_mesh_stamp;}
+
+    /// Retourne une nouvelle estampille (les commandes peuvent être threadées)
+    static unsigned long newStamp() {return __sync_add_and_fetch(&s_stamp, 1);}
+#endif
 
 private:
     /// Conteneur des propriétés topologiques
@@ -189,6 +215,15 @@ private:
 
     /// Sauvegarde de m_topo_property
     TopoProperty* m_save_topo_property;
+
+    /// Estampille de la dernière modification, voir getModificationStamp
+    unsigned long m_modification_stamp;
+
+    /// Estampille du maillage de l'entité
+    unsigned long m_mesh_stamp;
+
+    /// Dernière estampille distribuée
+    static unsigned long s_stamp;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
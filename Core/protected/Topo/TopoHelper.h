@@ -169,6 +169,36 @@ public:
     /// remplit le set avec les vertices accessibles depuis les coedges
     static void get(std::vector<Topo::CoEdge*>& coedges, std::set<Topo::Vertex*>& vertices);
 
+    /** \name Variantes des méthodes get ci-dessus retournant des vecteurs
+     *
+     *  Les entités accessibles sont ajoutées au vecteur si elles n'y sont pas
+     *  déjà (détection des doublons par marquage, en temps linéaire), puis le
+     *  vecteur est trié suivant l'id unique des entités.
+     */
+    //@{
+    static void get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::Block*>& blocks);
+    static void get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::CoFace*>& cofaces, bool propagate);
+    static void get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::CoEdge*>& coedges, bool propagate);
+    static void get(const std::vector<Geom::Volume*>& volumes, std::vector<Topo::Vertex*>& vertices, bool propagate);
+    static void get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::CoFace*>& cofaces);
+    static void get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::CoEdge*>& coedges, bool propagate);
+    static void get(const std::vector<Geom::Surface*>& surfaces, std::vector<Topo::Vertex*>& vertices, bool propagate);
+    static void get(const std::vector<Geom::Curve*>& curves, std::vector<Topo::CoEdge*>& coedges);
+    static void get(const std::vector<Geom::Curve*>& curves, std::vector<Topo::Vertex*>& vertices, bool propagate);
+    static void get(const std::vector<Geom::Vertex*>& vtx, std::vector<Topo::Vertex*>& vertices);
+    static void get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::CoFace*>& cofaces);
+    static void get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::CoEdge*>& coedges);
+    static void get(const std::vector<Topo::Block*>& blocks, std::vector<Topo::Vertex*>& vertices);
+    static void get(const std::vector<Topo::CoFace*>& cofaces, std::vector<Topo::CoEdge*>& coedges);
+    static void get(const std::vector<Topo::CoFace*>& cofaces, std::vector<Topo::Vertex*>& vertices);
+    static void get(const std::vector<Topo::CoEdge*>& coedges, std::vector<Topo::Vertex*>& vertices);
+
+    /** ajoute les entités au vecteur si elles n'y sont pas déjà, puis trie le
+     *  vecteur suivant l'id unique (T: Block, CoFace, CoEdge ou Vertex) */
+    template <typename T>
+    static void addUnique(const std::vector<T*>& entities, std::vector<T*>& out);
+    //@}
+
 
     /// permute 2 vecteurs de CoEdges
     static void permuteVector(std::vector<CoEdge* > & coedges1,
@@ -194,10 +224,10 @@ public:
             Internal::InfoCommand* icmd);
 
     /** Constitue la liste des entités marquées à marque */
-    static void getMarqued(std::map<CoEdge*, uint> filtre, const uint marque, std::vector<CoEdge*>& out);
+    static void getMarqued(const std::map<CoEdge*, uint>& filtre, const uint marque, std::vector<CoEdge*>& out);
 
     /** Constitue la liste des entités marquées à autre chose que 0 */
-    static void getMarqued(std::map<CoFace*, uint> filtre, std::vector<CoFace*>& out);
+    static void getMarqued(const std::map<CoFace*, uint>& filtre, std::vector<CoFace*>& out);
 
     /** Sauvegarde des relations topologiques pour toutes les entités
      * et celles de niveau inférieur
@@ -241,7 +271,10 @@ public:
     static std::vector<Geom::GeomEntity*> getGeomEntities(std::vector<Topo::TopoEntity*>& topoEntities);
 
 
-    /** Retourne le sommet qui est à la position géométrique donnée (à la tolérance près) */
+    /** Retourne le sommet qui est à la position géométrique donnée (à la tolérance près)
+     *
+     *  Recherche linéaire, pour des recherches répétées dans un même ensemble
+     *  de sommets voir VertexLocator */
     static Topo::Vertex* getVertexAtPosition(std::vector<Topo::Vertex*>& vertices, const Utils::Math::Point& pt, const double& tol);
 
     /** Retourne tous les sommets reliés à un sommet par une arête */
@@ -250,13 +283,15 @@ public:
 
     /** Retourne la liste des coedges au bord de l'ensemble des cofaces,
      *
-     * Ce sont celles qui ne sont reliées qu'à une coface de la liste passée
+     * Ce sont celles qui ne sont reliées qu'à une coface de la liste passée,
+     * elles sont retournées dans l'ordre de leur première rencontre
      */
     static std::vector<Topo::CoEdge*> getBorder(std::vector<Topo::CoFace*>& cofaces);
 
     /** Retourne la liste des cofaces au bord de l'ensemble des blocs,
      *
-     * Ce sont celles qui ne sont reliées qu'à un bloc de la liste passée
+     * Ce sont celles qui ne sont reliées qu'à un bloc de la liste passée,
+     * elles sont retournées dans l'ordre de leur première rencontre
      */
     static std::vector<Topo::CoFace*> getBorder(std::vector<Topo::Block*>& blocks);
 
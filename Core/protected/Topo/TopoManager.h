@@ -20,6 +20,7 @@
 #include "Topo/TopoManagerIfc.h"
 #include "Topo/TopoInfo.h"
 #include "Utils/Container.h"
+#include "Utils/EntityContainer.h"
 #include "Utils/Plane.h"
 /*----------------------------------------------------------------------------*/
 //#define _DEBUG_TIMER
@@ -1521,6 +1522,11 @@ public:
     /** Enlève un Vertex au manager */
     virtual void remove(Vertex* v);
 
+    /** Met à jour le nombre d'entités non détruites du manager, à appeler
+     *  lorsque l'entité change d'état (voir TopoEntity::setDestroyed)
+     */
+    virtual void updateDestroyed(TopoEntity* te);
+
 	/** Retourne l'entité suivant le nom en argument */
 	virtual TopoEntity* getEntity(const std::string& name, const bool exceptionIfNotFound=true) const;
 
@@ -1580,22 +1586,22 @@ private:
 
 private:
     /** blocs accessibles depuis le manager */
-    Utils::Container<Block> m_blocks;
+    Utils::EntityContainer<Block> m_blocks;
 
     /** faces accessibles depuis le manager */
-    Utils::Container<Face> m_faces;
+    Utils::EntityContainer<Face> m_faces;
 
     /** faces communes accessibles depuis le manager */
-    Utils::Container<CoFace> m_cofaces;
+    Utils::EntityContainer<CoFace> m_cofaces;
 
     /** arêtes accessibles depuis le manager */
-    Utils::Container<Edge> m_edges;
+    Utils::EntityContainer<Edge> m_edges;
 
     /** arêtes communes accessibles depuis le manager */
-    Utils::Container<CoEdge> m_coedges;
+    Utils::EntityContainer<CoEdge> m_coedges;
 
     /** sommets accessibles depuis le manager */
-    Utils::Container<Vertex> m_vertices;
+    Utils::EntityContainer<Vertex> m_vertices;
 
     /// Nombre de bras par défaut pour une arête
     int m_defaultNbMeshingEdges;
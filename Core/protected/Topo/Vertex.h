@@ -105,10 +105,12 @@ public:
     /*------------------------------------------------------------------------*/
     /** Modificateur sur les coordonnées
      *  Attention à sauvegarder pour le undo
+     *  Si le sommet est maillé, son maillage et celui des entités incidentes
+     *  sont à mettre à jour (CommandUpdateMesh)
      *  \see saveVertexTopoProperty
      */
 
-    void setCoord(const Utils::Math::Point & pt, bool acceptMeshed = false);
+    void setCoord(const Utils::Math::Point & pt);
 
 
     /*------------------------------------------------------------------------*/
@@ -387,7 +389,8 @@ public:
     virtual unsigned long getNbInternalMeshingNodes() {return 1;}
 
     /*------------------------------------------------------------------------*/
-    /// met à jour la date (de la représentation) pour les arêtes incidentes
+    /** met à jour la date (de la représentation) pour les arêtes incidentes,
+     *  ainsi que leur estampille de modification et celle du sommet */
     void updateCoEdgeModificationTime();
 
 
@@ -0,0 +1,78 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VertexLocator.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef TOPO_VERTEXLOCATOR_H_
+#define TOPO_VERTEXLOCATOR_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Point.h"
+
+#include <sys/types.h>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+class Vertex;
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief       Recherche de sommets par position dans une grille uniforme.
+ *
+ * Remplace des appels répétés à TopoHelper::getVertexAtPosition sur un même
+ * ensemble de sommets : la grille est construite une fois (tri par cellule),
+ * chaque recherche ne parcourt ensuite que les cellules voisines du point.
+ *
+ * Le résultat est le même que celui de TopoHelper::getVertexAtPosition : le
+ * premier sommet, dans l'ordre du vecteur initial, à une distance inférieure
+ * à la tolérance. Les coordonnées sont relevées à la construction, les
+ * sommets ne doivent donc pas être déplacés pendant l'utilisation.
+ */
+class VertexLocator
+{
+public:
+    /** construction de la grille pour les sommets
+     *  \param vertices les sommets parmi lesquels se feront les recherches
+     *  \param tol la tolérance utilisée pour les recherches
+     */
+    VertexLocator(const std::vector<Vertex*>& vertices, double tol);
+
+    /// retourne le sommet à la position donnée (à la tolérance près), 0 si aucun
+    Vertex* find(const Utils::Math::Point& pt) const;
+
+private:
+    VertexLocator(const VertexLocator&);
+    VertexLocator& operator = (const VertexLocator&);
+
+    /// indice de la cellule suivant une direction, borné à [0, m_nb[dir]-1]
+    uint cellIndex(double coord, uint dir) const;
+
+    /// les sommets et leurs coordonnées
+    std::vector<Vertex*> m_vertices;
+    std::vector<Utils::Math::Point> m_coords;
+
+    /// tolérance et son carré
+    double m_tol;
+    double m_tol2;
+
+    /// coin min de la boite englobante, pas de la grille et nombre de cellules par direction
+    double m_min[3];
+    double m_step;
+    uint m_nb[3];
+
+    /// indices des sommets par cellule: m_cellVertices[m_cellPtr[c] .. m_cellPtr[c+1][
+    std::vector<size_t> m_cellPtr;
+    std::vector<uint> m_cellVertices;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* TOPO_VERTEXLOCATOR_H_ */
+/*----------------------------------------------------------------------------*/
@@ -9,6 +9,7 @@
 #include "Utils/Common.h"
 #include "Internal/EntitiesHelper.h"
 #include "QtComponents/QtEntitiesItemViewPanel.h"
+#include "QtComponents/QtExpansionTreeRestorer.h"
 #include "QtComponents/QtMgx3DApplication.h"
 #include "QtComponents/QtMgx3DMainWindow.h"
 #include <QtUtil/QtErrorManagement.h>
@@ -21,6 +22,7 @@
 #include <TkUtil/MemoryError.h>
 #include <TkUtil/ThreeStates.h>
 #include <QtUtil/QtConfiguration.h>
+#include <QtUtil/QtObjectSignalBlocker.h>
 
 #include <QComboBox>
 #include <QThread>
@@ -28,6 +30,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <memory>
+#include <set>
 
 
 using namespace std;
@@ -173,6 +176,65 @@ void QtEntitiesItemViewPanel::changeRepresentationTypes (const vector<Entity*>&
 }	// QtEntitiesItemViewPanel::changeRepresentationTypes
 
 
+void QtEntitiesItemViewPanel::deleteChildren (
+					QTreeWidgetItem& parent, const vector<QTreeWidgetItem*>& items)
+{
+	// En deçà de ce nombre d'items on les enlève un par un.
+	const size_t	threshold	= 16;
+
+	if (items.size ( ) < threshold)
+	{
+		for (vector<QTreeWidgetItem*>::const_iterator it = items.begin ( );
+		     items.end ( ) != it; it++)
+		{
+			parent.removeChild (*it);
+			delete *it;
+		}	// for (vector<QTreeWidgetItem*>::const_iterator it = ...
+		return;
+	}	// if (items.size ( ) < threshold)
+
+	const set<QTreeWidgetItem*>	removed (items.begin ( ), items.end ( ));
+	QTreeWidget*			treeWidget		= parent.treeWidget ( );
+	QItemSelectionModel*	selectionModel	=
+					0 == treeWidget ? 0 : treeWidget->selectionModel ( );
+	// Les items conservés sont déjà dans l'état voulu (sélection ...) :
+	// pas de signaux lors de leur retrait/remise en place.
+	QtObjectSignalBlocker	blocker (selectionModel);
+	QtExpansionTreeRestorer	restorer;
+	for (int i = 0; i < parent.childCount ( ); i++)
+		if (removed.end ( ) == removed.find (parent.child (i)))
+			restorer.record (*(parent.child (i)));
+
+	QList<QTreeWidgetItem*>	children	= parent.takeChildren ( );
+	QList<QTreeWidgetItem*>	kept;
+	kept.reserve (children.count ( ) - (int)removed.size ( ));
+	for (QList<QTreeWidgetItem*>::iterator it = children.begin ( );
+	     children.end ( ) != it; it++)
+		if (removed.end ( ) == removed.find (*it))
+			kept.append (*it);
+	parent.addChildren (kept);
+	restorer.restore ( );
+
+	for (vector<QTreeWidgetItem*>::const_iterator it = items.begin ( );
+	     items.end ( ) != it; it++)
+		delete *it;
+}	// QtEntitiesItemViewPanel::deleteChildren
+
+
+void QtEntitiesItemViewPanel::getAllItems (
+				const QTreeWidget& tree, vector<const QTreeWidgetItem*>& items)
+{
+	items.clear ( );
+	for (int i = 0; i < tree.topLevelItemCount ( ); i++)
+		items.push_back (tree.topLevelItem (i));
+
+	// Parcours en largeur, les enfants sont ajoutés en fin de vecteur :
+	for (size_t i = 0; i < items.size ( ); i++)
+		for (int c = 0; c < items [i]->childCount ( ); c++)
+			items.push_back (items [i]->child (c));
+}	// QtEntitiesItemViewPanel::getAllItems
+
+
 }	// namespace QtComponents
 
 }	// namespace Mgx3D
@@ -968,7 +968,7 @@ QtEntitiesPanel::QtEntitiesPanel (
 	  _topoVerticesItem (0),
 	  _meshVolumesItem (0), _meshSurfacesItem (0), _meshLinesItem (0),
 	  _meshCloudsItem (0), _sysCoordItem(0), _structuredMeshVolumesItem (0),
-	  _treeViewPopupMenu (0), _treeViewActions ( )
+	  _entitiesItems ( ), _treeViewPopupMenu (0), _treeViewActions ( )
 {
 	createGui ( );
 	createPopupMenu ( );
@@ -987,7 +987,7 @@ QtEntitiesPanel::QtEntitiesPanel (const QtEntitiesPanel& ep)
 	  _topoVerticesItem (0),
 	  _meshVolumesItem (0), _meshSurfacesItem (0), _meshLinesItem (0),
 	  _meshCloudsItem (0), _sysCoordItem(0), _structuredMeshVolumesItem (0),
-	  _treeViewPopupMenu (0), _treeViewActions ( )
+	  _entitiesItems ( ), _treeViewPopupMenu (0), _treeViewActions ( )
 {
 	MGX_FORBIDDEN ("QtEntitiesPanel copy constructor is not allowed.");
 }	// QtEntitiesPanel::QtEntitiesPanel (const QtEntitiesPanel&)
@@ -1078,21 +1078,12 @@ void QtEntitiesPanel::addCADEntities (
 void QtEntitiesPanel::removeCADEntity (Geom::GeomEntity& entity)
 {
 assert (0 && "QtEntitiesPanel::removeCADEntity is deprecated");
-	QTreeWidgetItem*	parent	= getCADEntryItem (entity.getDim ( ));
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtCADEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtCADEntityTreeWidgetItem*>(parent->child (i));	
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	deleteItems (vector<Utils::Entity*> (1, &entity));
 }	// QtEntitiesPanel::removeCADEntity
 
 
@@ -1105,20 +1096,8 @@ void QtEntitiesPanel::removeCADEntities (
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getCADEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtCADEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtCADEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Geom::GeomEntity*>::const_iterator it = entities.begin ( );
+	deleteItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_GEOM);
 
@@ -1185,21 +1164,12 @@ void QtEntitiesPanel::addTopologicEntities (
 void QtEntitiesPanel::removeTopologicEntity (Topo::TopoEntity& entity)
 {
 assert (0 && "QtEntitiesPanel::removeTopologicEntity is deprecated");
-	QTreeWidgetItem*	parent	= getTopologicEntryItem (entity.getDim ( ));
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtTopologicEntityTreeWidgetItem*	item	=
-			dynamic_cast<QtTopologicEntityTreeWidgetItem*>(parent->child (i));	
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	deleteItems (vector<Utils::Entity*> (1, &entity));
 }	// QtEntitiesPanel::removeTopologicEntity
 
 
@@ -1212,20 +1182,8 @@ void QtEntitiesPanel::removeTopologicEntities (
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getTopologicEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtTopologicEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtTopologicEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Topo::TopoEntity*>::const_iterator it = entities.begin ( );
+	deleteItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_TOPO);
 
@@ -1290,21 +1248,12 @@ void QtEntitiesPanel::addMeshEntities (
 void QtEntitiesPanel::removeMeshEntity (Mesh::MeshEntity& entity)
 {
 assert (0 && "QtEntitiesPanel::removeMeshEntity is deprecated");
-	QTreeWidgetItem*	parent	= getMeshEntryItem (entity.getDim ( ));
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtMeshEntityTreeWidgetItem*	item	=
-			dynamic_cast<QtMeshEntityTreeWidgetItem*>(parent->child (i));	
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	deleteItems (vector<Utils::Entity*> (1, &entity));
 }	// QtEntitiesPanel::removeMeshEntity
 
 
@@ -1316,20 +1265,8 @@ void QtEntitiesPanel::removeMeshEntities (const vector<Mesh::MeshEntity*>& entit
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getMeshEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtMeshEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtMeshEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Geom::MeshEntity*>::const_iterator it = entities.begin ( );
+	deleteItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_MESH);
 
@@ -1356,21 +1293,12 @@ void QtEntitiesPanel::addSysCoordEntity (Mgx3D::CoordinateSystem::SysCoord& enti
 
 void QtEntitiesPanel::removeSysCoordEntity (Mgx3D::CoordinateSystem::SysCoord& entity)
 {
-	QTreeWidgetItem*	parent	= getSysCoordEntryItem ();
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtSysCoordEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtSysCoordEntityTreeWidgetItem*>(parent->child (i));
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	deleteItems (vector<Utils::Entity*> (1, &entity));
 }	// QtEntitiesPanel::removeSysCoordEntity
 
 
@@ -1426,21 +1354,12 @@ void QtEntitiesPanel::addStructuredMeshEntities (const vector<Structured::Struct
 void QtEntitiesPanel::removeStructuredMeshEntity (Structured::StructuredMeshEntity& entity)
 {
 assert (0 && "QtEntitiesPanel::removeStructuredMeshEntity is deprecated");
-	QTreeWidgetItem*	parent	= getStructuredMeshEntryItem (entity.getDim ( ));
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtStructuredMeshEntityTreeWidgetItem*	item	=
-			dynamic_cast<QtStructuredMeshEntityTreeWidgetItem*>(parent->child (i));	
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	deleteItems (vector<Utils::Entity*> (1, &entity));
 }	// QtEntitiesPanel::removeStructuredMeshEntity
 
 
@@ -1452,20 +1371,8 @@ void QtEntitiesPanel::removeStructuredMeshEntities (const vector<Structured::Str
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getStructuredMeshEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtStructuredMeshEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtStructuredMeshEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Structured::StructuredMeshEntity*>::const_iterator it = entities.begin ( );
+	deleteItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_STRUCTURED_MESH);
 
@@ -1650,6 +1557,46 @@ const QtEntitiesTreeWidget* QtEntitiesPanel::getTreeWidget ( ) const
 }	// QtEntitiesPanel::getTreeWidget
 
 
+void QtEntitiesPanel::checkItems ( ) const
+{
+	CHECK_NULL_PTR_ERROR (_entitiesWidget)
+	vector<const QTreeWidgetItem*>	items;
+	getAllItems (*_entitiesWidget, items);
+
+	size_t	count	= 0;
+	for (vector<const QTreeWidgetItem*>::const_iterator it = items.begin ( );
+	     items.end ( ) != it; it++)
+	{
+		const QtEntityTreeWidgetItem*	item	=
+							dynamic_cast<const QtEntityTreeWidgetItem*>(*it);
+		if (0 == item)
+			continue;
+
+		count++;
+		const Entity*	entity	= item->getEntity ( );
+		const size_t	index	= _entitiesItems.indexOf (entity);
+		if ((_entitiesItems.npos ( ) == index) ||
+		    (item != _entitiesItems.at (index).second))
+		{
+			UTF8String	message (Charset::UTF_8);
+			message << "QtEntitiesPanel::checkItems. L'item de l'entité "
+			        << (0 == entity ? string ("nulle") : entity->getName ( ))
+			        << " n'est pas référencé par l'index des items.";
+			throw Exception (message);
+		}	// if ((_entitiesItems.npos ( ) == index) || ...
+	}	// for (vector<const QTreeWidgetItem*>::const_iterator it = ...
+
+	if (count != _entitiesItems.size ( ))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "QtEntitiesPanel::checkItems. L'index des items référence "
+		        << (unsigned long)_entitiesItems.size ( ) << " items, "
+		        << "l'arborescence en contient " << (unsigned long)count << ".";
+		throw Exception (message);
+	}	// if (count != _entitiesItems.size ( ))
+}	// QtEntitiesPanel::checkItems
+
+
 void QtEntitiesPanel::createGui ( )
 {
 	BEGIN_QT_TRY_CATCH_BLOCK
@@ -1791,97 +1738,35 @@ void QtEntitiesPanel::selectionChanged (
 
 QtEntityTreeWidgetItem* QtEntitiesPanel::getItem (const Mgx3D::Utils::Entity& entity)
 {
-	QTreeWidgetItem*			parent		= 0;
-	const Geom::GeomEntity*			geomEntity	= dynamic_cast<const Geom::GeomEntity*>(&entity);
-	const Topo::TopoEntity*			topoEntity	= dynamic_cast<const Topo::TopoEntity*>(&entity);
-	const Mesh::MeshEntity*			meshEntity	= dynamic_cast<const Mesh::MeshEntity*>(&entity);
-	const CoordinateSystem::SysCoord*	repEntity	= dynamic_cast<const CoordinateSystem::SysCoord*>(&entity);
-	const Structured::StructuredMeshEntity*	structuredMeshEntity= dynamic_cast<const Structured::StructuredMeshEntity*>(&entity);
-	if (0 != geomEntity)
-	{
-		parent	= _cadItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtCADEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtCADEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// if (0 != geomEntity)
-	else if (0 != topoEntity)
-	{
-		parent	= _topologyItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtTopologicEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtTopologicEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != topoEntity)
-	else if (0 != meshEntity)
-	{
-		parent	= _meshingItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtMeshEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtMeshEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != meshEntity)
-	else if (0 != repEntity)
-	{
-		parent	= _coordinateSystemItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtSysCoordEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtSysCoordEntityTreeWidgetItem*>(group->child (g));
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != repEntity)
-	else if (0 != structuredMeshEntity)
-	{
-		parent	= _structuredMeshingItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtStructuredMeshEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtStructuredMeshEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != structuredMeshEntity)
-
-	return 0;
+	const size_t	index	= _entitiesItems.indexOf (&entity);
+
+	return _entitiesItems.npos ( ) == index ? 0 : _entitiesItems.at (index).second;
 }	// QtEntitiesPanel::getItem
 
 
+void QtEntitiesPanel::deleteItems (const vector<Utils::Entity*>& entities)
+{
+	// Les items à détruire, par entrée :
+	Utils::IndexedMap<QTreeWidgetItem*, vector<QTreeWidgetItem*> >	items;
+
+	for (vector<Utils::Entity*>::const_iterator it = entities.begin ( );
+	     entities.end ( ) != it; it++)
+	{
+		const size_t	index	= _entitiesItems.indexOf (*it);
+		if (_entitiesItems.npos ( ) == index)
+			continue;
+
+		QtEntityTreeWidgetItem*	item	= _entitiesItems.at (index).second;
+		_entitiesItems.erase (*it);
+		CHECK_NULL_PTR_ERROR (item->parent ( ))
+		items [item->parent ( )].push_back (item);
+	}	// for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); ...
+
+	for (size_t i = 0; i < items.size ( ); i++)
+		deleteChildren (*(items.at (i).first), items.at (i).second);
+}	// QtEntitiesPanel::deleteItems
+
+
 QTreeWidgetItem* QtEntitiesPanel::createEntryItem (
 			QTreeWidgetItem& parent, const string& title, unsigned long mask,
 			DisplayRepresentation::display_type entitiesType)
@@ -1908,6 +1793,8 @@ QtCADEntityTreeWidgetItem* QtEntitiesPanel::createCADItem (Geom::GeomEntity& ent
 	// sont pas visibles ???
 	item->setHidden (false);
 
+	_entitiesItems [&entity]	= item;
+
 	return item;
 }	// QtEntitiesPanel::createCADItem
 
@@ -1947,6 +1834,8 @@ QtTopologicEntityTreeWidgetItem* QtEntitiesPanel::createTopologicItem (Topo::Top
 	// la visibilité des enfants invisibles).
 	item->setHidden (false);
 
+	_entitiesItems [&entity]	= item;
+
 	return item;
 }	// QtEntitiesPanel::createTopologicItem
 
@@ -1985,6 +1874,8 @@ QtMeshEntityTreeWidgetItem* QtEntitiesPanel::createMeshItem (Mesh::MeshEntity& e
 	// sont pas visibles ???
 	item->setHidden (false);
 
+	_entitiesItems [&entity]	= item;
+
 	return item;
 }	// QtEntitiesPanel::createMeshItem
 
@@ -2022,6 +1913,8 @@ QtSysCoordEntityTreeWidgetItem* QtEntitiesPanel::createSysCoordItem (Mgx3D::Coor
 	// sont pas visibles ???
 	item->setHidden (false);
 
+	_entitiesItems [&entity]	= item;
+
 	return item;
 }	// QtEntitiesPanel::createSysCoordItem
 
@@ -2046,6 +1939,8 @@ QtStructuredMeshEntityTreeWidgetItem* QtEntitiesPanel::createStructuredMeshItem
 	// sont pas visibles ???
 	item->setHidden (false);
 
+	_entitiesItems [&entity]	= item;
+
 	return item;
 }	// QtEntitiesPanel::createStructuredMeshItem
 
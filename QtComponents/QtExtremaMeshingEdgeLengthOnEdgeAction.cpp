@@ -193,9 +193,9 @@ void QtExtremaMeshingEdgeLengthOnEdgePanel::commandModifiedCallback (
 
 	bool	reinited	= false;
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = infoCommand.getTopoInfoEntity();
+	InfoCommand::TopoInfoMap tei = infoCommand.getTopoInfoEntity();
 	const Topo::CoEdge* coedge = getCoEdge();
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
+	for (Internal::InfoCommand::TopoInfoMap::const_iterator iter = tei.begin();
 			(false == reinited) && (iter != tei.end()); ++iter) {
 		Topo::TopoEntity* te = iter->first;
 		InfoCommand::type  t = iter->second;
@@ -360,6 +360,7 @@ QtGroupsPanel::QtGroupsPanel (
 	  SelectionManagerObserver (&context.getSelectionManager ( )),
 	  _entitiesTypesWidget (0), _entitiesGroupsWidget (0),
 	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ),
+	  _groupsItems ( ),
 	  //_groupsPropagationCheckBox (0),
 	  _typesPopupMenu (0), _groupsPopupMenu (0),
 	  _uncheckedCheckboxes (FilterEntity::NoneEntity)
@@ -379,6 +380,7 @@ QtGroupsPanel::QtGroupsPanel (const QtGroupsPanel& gp)
 	: QtEntitiesItemViewPanel (gp), SelectionManagerObserver (0),
 	  _entitiesTypesWidget (0), _entitiesGroupsWidget (0),
 	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ),
+	  _groupsItems ( ),
 	  //_groupsPropagationCheckBox (0),
 	  _typesPopupMenu (0), _groupsPopupMenu (0),
 	  _uncheckedCheckboxes (FilterEntity::NoneEntity)
@@ -536,33 +538,75 @@ void QtGroupsPanel::addGroups (const vector<Group::GroupEntity*>& groups)
 
 void QtGroupsPanel::removeGroups (const vector<Group::GroupEntity*>& groups)
 {
-	vector<Utils::Entity*>	list;
+	// Les items à détruire, par entrée (une entrée par dimension ou niveau) :
+	Utils::IndexedMap<QTreeWidgetItem*, vector<QTreeWidgetItem*> >	items;
 
 	for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( );
 	     groups.end ( ) != it; it++)
 	{
-		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getGroupEntryItem ((*it)->getDim ( ), (*it)->getLevel ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtGroupTreeWidgetItem*	item	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-			if ((0 != item) && (*it == item->getGroup ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getGroup ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+		const size_t	index	= _groupsItems.indexOf (*it);
+		if (_groupsItems.npos ( ) == index)
+			continue;
+
+		QtGroupTreeWidgetItem*	item	= _groupsItems.at (index).second;
+		_groupsItems.erase (*it);
+		CHECK_NULL_PTR_ERROR (item->parent ( ))
+		items [item->parent ( )].push_back (item);
+	}	// for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( );
+
+	for (size_t i = 0; i < items.size ( ); i++)
+	{
+		QTreeWidgetItem*	parent	= items.at (i).first;
+		deleteChildren (*parent, items.at (i).second);
 		QtGroupLevelTreeWidgetItem*	levelItem	= dynamic_cast<QtGroupLevelTreeWidgetItem*>(parent);
 		if ((0 != levelItem) && (Qt::PartiallyChecked == levelItem->checkState (0)))
 			levelItem->updateState ( );
-	}	// for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( );
+	}	// for (size_t i = 0; i < items.size ( ); i++)
 
 	// sort a priori inutile, ordre conservé.
 }	// QtGroupsPanel::removeGroups
 
 
+void QtGroupsPanel::checkItems ( ) const
+{
+	CHECK_NULL_PTR_ERROR (_entitiesGroupsWidget)
+	vector<const QTreeWidgetItem*>	items;
+	getAllItems (*_entitiesGroupsWidget, items);
+
+	size_t	count	= 0;
+	for (vector<const QTreeWidgetItem*>::const_iterator it = items.begin ( );
+	     items.end ( ) != it; it++)
+	{
+		const QtGroupTreeWidgetItem*	item	=
+							dynamic_cast<const QtGroupTreeWidgetItem*>(*it);
+		if (0 == item)
+			continue;
+
+		count++;
+		const GroupEntity*	group	= item->getGroup ( );
+		const size_t		index	= _groupsItems.indexOf (group);
+		if ((_groupsItems.npos ( ) == index) ||
+		    (item != _groupsItems.at (index).second))
+		{
+			UTF8String	message (Charset::UTF_8);
+			message << "QtGroupsPanel::checkItems. L'item du groupe "
+			        << (0 == group ? string ("nul") : group->getName ( ))
+			        << " n'est pas référencé par l'index des items.";
+			throw Exception (message);
+		}	// if ((_groupsItems.npos ( ) == index) || ...
+	}	// for (vector<const QTreeWidgetItem*>::const_iterator it = ...
+
+	if (count != _groupsItems.size ( ))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "QtGroupsPanel::checkItems. L'index des items référence "
+		        << (unsigned long)_groupsItems.size ( ) << " groupes, "
+		        << "l'arborescence en contient " << (unsigned long)count << ".";
+		throw Exception (message);
+	}	// if (count != _groupsItems.size ( ))
+}	// QtGroupsPanel::checkItems
+
+
 vector<Group::GroupEntity*> QtGroupsPanel::getSelectedGroups ( ) const
 {
 	vector<Group::GroupEntity*>	groups;
@@ -1206,33 +1250,9 @@ QtGroupTreeWidgetItem* QtGroupsPanel::getGroupItem (const Mgx3D::Group::GroupEnt
 		throw Exception (message);
 	}	// if ((0 > group.getDim ( )) || (4 <= group.getDim ( )))
 
-	if (false == Resources::instance ( )._multiLevelGroupsView.getValue ( ))
-	{
-		QTreeWidgetItem* parent		= _groupsEntriesItems [group.getDim ( )];
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtGroupTreeWidgetItem*	groupItem	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-			if ((0 != groupItem) && (&group == groupItem->getGroup ( )))
-				return groupItem;
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// if (false == Resources::instance ( )._multiLevelGroupsView.getValue ( ))
-	else
-	{
-		const map<unsigned long, QTreeWidgetItem*>&	entries	= _levelsEntriesItems [group.getDim ( )];
-		map<unsigned long, QTreeWidgetItem*>::const_iterator	it	= entries.find (group.getLevel ( ));
-		if (entries.end ( ) != it)
-		{
-			QTreeWidgetItem*	parent	= (*it).second;
-			for (size_t i = 0; i < parent->childCount ( ); i++)
-			{
-				QtGroupTreeWidgetItem*	groupItem	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-				if ((0 != groupItem) && (&group == groupItem->getGroup ( )))
-					return groupItem;
-			}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-		}	// if (entries.end ( ) == it)
-	}	// else if (false == QtMgx3DApplication:: ...
-
-	return 0;
+	const size_t	index	= _groupsItems.indexOf (&group);
+
+	return _groupsItems.npos ( ) == index ? 0 : _groupsItems.at (index).second;
 }	// QtGroupsPanel::getGroupItem
 
 
@@ -1257,6 +1277,7 @@ QtGroupTreeWidgetItem* QtGroupsPanel::createGroupItem (Group::GroupEntity& group
 	QtGroupLevelTreeWidgetItem*	levelItem	= dynamic_cast<QtGroupLevelTreeWidgetItem*>(parent);
 	if ((0 != levelItem) && (Qt::Checked == levelItem->checkState (0)))
 		levelItem->updateState ( );
+	_groupsItems [&group]	= item;
 
 	return item;
 }	// QtGroupsPanel::createGroupItem
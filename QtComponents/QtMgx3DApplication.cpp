@@ -566,6 +566,8 @@ void QtMgx3DApplication::parseArgs (int& argc, char* argv [])
 {
 	displayHelp				= Context::getArguments ( ).hasArg ("-help") || Context::getArguments ( ).hasArg ("--help");
 	graphicalWindowFixedSize	= Context::getArguments ( ).hasArg ("-graphicalWindowFixedSize");
+	Resources::instance ( )._checkPanelsItems	= Context::getArguments ( ).hasArg ("-checkPanelsItems");
+	Resources::instance ( )._pythonJournalSync	= Context::getArguments ( ).hasArg ("-pythonJournalSync");
 	if (true == Context::getArguments ( ).hasArg ("-defaultConfig"))
 		Resources::instance ( )._defaultConfigURL		= Context::getArguments ( ).getArgValue ("-defaultConfig");
 	if (true == Context::getArguments ( ).hasArg ("-userConfig"))
@@ -628,6 +630,7 @@ void QtMgx3DApplication::syntax (const string& exe) const
 	     << "[-outCharsetRef àéèùô][-outCharset charset]"
 	     << "[-graphicalWindowWidth largeur][-graphicalWindowHeight hauteur]"
 	     << "[-graphicalWindowFixedSize]"
+	     << "[-checkPanelsItems][-pythonJournalSync]"
 		 << "[-useOCAF]"
 	     << "[-script file1.py][-script file2.py] ... [-script filen.py]"
 	     << endl << endl
@@ -647,6 +650,12 @@ void QtMgx3DApplication::syntax (const string& exe) const
 			<< "affecte hauteur à la hauteur de la fenêtre graphique" << endl
 	     << "-graphicalWindowFixedSize             : "
 			<< "la fenêtre graphique ne peut pas être redimensionnée" << endl
+	     << "-checkPanelsItems                     : "
+			<< "vérifie après chaque commande l'index des items des panneaux "
+			<< "Entités et Groupes (tests)" << endl
+	     << "-pythonJournalSync                    : "
+			<< "écrit les commandes du script Python sans le thread "
+			<< "d'écriture du journal (mesures)" << endl
 		<< " -useOCAF : utilisation d'OCAF pour la gestion du noyau gémétrique."<<endl
 		<< " -scripts fichier python               : exécute le fichier "
 			<< "python transmis en arguments au lancement de l'application." <<endl
@@ -662,6 +671,7 @@ void QtMgx3DApplication::applyConfiguration (const Section& mainSection)
 		Section&	theatreSection	= guiSection.getSection ("theatre");
 		PreferencesHelper::getUnsignedLong (theatreSection, Resources::instance ( )._updateRefreshRate);
 		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._useDisplayList);
+		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._batchedRendering);
 		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._xyzCancelRoll);
 		PreferencesHelper::getDouble (theatreSection, Resources::instance ( )._stillFrameRate);
 		PreferencesHelper::getDouble (theatreSection, Resources::instance ( )._desiredFrameRate);
@@ -975,6 +985,7 @@ void QtMgx3DApplication::saveConfiguration (Section& mainSection)
 	// Théâtre :
 	PreferencesHelper::updateUnsignedLong (theatreSection, Resources::instance ( )._updateRefreshRate);
 	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._useDisplayList);
+	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._batchedRendering);
 	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._xyzCancelRoll);
 	PreferencesHelper::updateDouble (theatreSection, Resources::instance ( )._stillFrameRate);
 	PreferencesHelper::updateDouble (theatreSection, Resources::instance ( )._desiredFrameRate);
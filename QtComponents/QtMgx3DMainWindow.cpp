@@ -1095,7 +1095,7 @@ void QtMgx3DMainWindow::showReady ( )
 			{
 				_pytMinScriptCharset = getDefaultScriptsCharset().charset();
 				getContext().getScriptingManager().setCharset(_pytMinScriptCharset);
-				getContext().getScriptingManager().initPython(getContext().newScriptingFileName());
+				getContext().getScriptingManager().initPython(getContext().newScriptingFileName(), true, !Resources::instance ( )._pythonJournalSync);
 
 				assert(0 != _pythonPanel);
 			}
@@ -4488,9 +4488,9 @@ const SelectionManagerIfc& QtMgx3DMainWindow::getSelectionManager ( ) const
 
 					// Traitement 4 : entités de type groupes :
 					vector < Group::GroupEntity * > groupsAdded, groupsRemoved;
-					map < Group::GroupEntity * , InfoCommand::type > &groupsInfos =
+					InfoCommand::GroupInfoMap&	groupsInfos =
 							                             icmd.getGroupInfoEntity();
-					for (map<Group::GroupEntity *, InfoCommand::type>::const_iterator
+					for (InfoCommand::GroupInfoMap::const_iterator
 							     itg = groupsInfos.begin(); groupsInfos.end() != itg; itg++)
 					{
 						switch ((*itg).second)
@@ -4506,7 +4506,7 @@ const SelectionManagerIfc& QtMgx3DMainWindow::getSelectionManager ( ) const
 							case InfoCommand::DISPMODIFIED    :
 								break;
 						}    // switch ((*itg).second)
-					}    // for (map<Group::GroupEntity*, type>::const_iterator ...
+					}    // for (InfoCommand::GroupInfoMap::const_iterator ...
 					if (0 != groupsAdded.size())
 						getGroupsPanel().addGroups(groupsAdded);
 					if (0 != groupsRemoved.size())
@@ -4599,6 +4599,21 @@ const SelectionManagerIfc& QtMgx3DMainWindow::getSelectionManager ( ) const
 					if (0 != smeshRemoved.size())
 						getEntitiesPanel().removeStructuredMeshEntities(smeshRemoved);
 
+					// Vérification des index d'items des panneaux (tests) :
+					if (true == Resources::instance ( )._checkPanelsItems)
+					{
+						try
+						{
+							getEntitiesPanel ( ).checkItems ( );
+							getGroupsPanel ( ).checkItems ( );
+						}
+						catch (const Exception& exc)
+						{
+							cerr << exc.getFullMessage ( ) << endl;
+							abort ( );
+						}
+					}	// if (true == Resources::instance ( )._checkPanelsItems)
+
 					// Prévenir les panneaux additionnels de l'IHM (explorateur et qualité de maillage, ...) en vue d'une éventuelle actualisation :
 					for (vector<QtMgx3DOperationPanel *>::iterator itap =
 							                                               _additionalPanels.begin();
@@ -514,8 +514,8 @@ void QtMgx3DOperationPanel::previewEdges (
 	const bool		bold    = false,    italic  = false;
 	dp.setFontProperties (fontFamily, fontSize, bold, italic, fontColor);
 
-	map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = infos.getTopoInfoEntity();
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator itei = topo_entities_info.begin();
+	Internal::InfoCommand::TopoInfoMap&  topo_entities_info = infos.getTopoInfoEntity();
+        for (Internal::InfoCommand::TopoInfoMap::iterator itei = topo_entities_info.begin();
                 itei != topo_entities_info.end(); ++itei)
 	{
 		Topo::TopoEntity*	topo_entity	= itei->first;
@@ -114,6 +114,9 @@ QtSmoothVolumeOperationPanel::QtSmoothVolumeOperationPanel (
 		_methodComboBox->addItem("jun");
 		_methodComboBox->addItem("condition number");
 		_methodComboBox->addItem("inverse mean ratio");
+		_methodComboBox->addItem("colored laplace");
+		_methodComboBox->addItem("colored condition number");
+		_methodComboBox->addItem("colored inverse mean ratio");
 		_methodComboBox->setCurrentIndex(0);
 		hlayout->addWidget (_methodComboBox);
 	}
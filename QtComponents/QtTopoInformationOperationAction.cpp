@@ -348,7 +348,7 @@ void QtTopoInformationOperationPanel::autoUpdate ( )
 	    for (std::vector<Topo::Block* >::iterator iter = blocks.begin();
 	    		iter != blocks.end(); ++iter){
 	    	Topo::Block* bloc = *iter;
-	    	size_t nb = bloc->getMeshingData()->regions().size();
+	    	size_t nb = bloc->getMeshingData()->getNbRegions();
 	    	nb_regions_tot += nb;
 	    	if (bloc->getMeshLaw() == Topo::BlockMeshingProperty::directional){
 	    		nb_dom_str_dir += 1;
@@ -14,6 +14,10 @@
 #include "QtComponents/QtRepresentationTypesPanel.h"
 #include "Internal/Context.h"
 
+#include <QTreeWidget>
+
+#include <vector>
+
 
 namespace Mgx3D 
 {
@@ -149,6 +153,27 @@ class QtEntitiesItemViewPanel : public QtGroupBox
 
 	protected :
 
+	/**
+	 * Enlève de <I>parent</I> les items transmis en argument, qui doivent en
+	 * être des enfants, et les détruit.
+	 * Lorsque les items sont nombreux la liste des enfants de <I>parent</I>
+	 * est reconstruite une seule fois (<I>takeChild</I> décale les enfants
+	 * suivants, le coût serait sinon quadratique). Les enfants conservés
+	 * retrouvent leurs caractères sélectionné/expansé/masqué, sans émission
+	 * des signaux de sélection.
+	 */
+	static void deleteChildren (
+				QTreeWidgetItem& parent, const std::vector<QTreeWidgetItem*>& items);
+
+	/**
+	 * \param		En retour, tous les items de l'arborescence transmise en
+	 *				premier argument, quelle que soit leur profondeur.
+	 * \see		QtEntitiesPanel::checkItems
+	 * \see		QtGroupsPanel::checkItems
+	 */
+	static void getAllItems (
+				const QTreeWidget& tree, std::vector<const QTreeWidgetItem*>& items);
+
 	// Opérations interdites :
 	QtEntitiesItemViewPanel (const QtEntitiesItemViewPanel&);
 
@@ -14,6 +14,7 @@
 #include <QTreeWidget>
 
 #include "QtComponents/QtEntitiesItemViewPanel.h"
+#include "Utils/IndexedMap.h"
 #include "Utils/SelectionManager.h"
 #include "Geom/GeomEntity.h"
 #include "Topo/TopoEntity.h"
@@ -801,6 +802,16 @@ class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Utils::SelectionMa
 	virtual QtEntitiesTreeWidget* getTreeWidget ( );
 	virtual const QtEntitiesTreeWidget* getTreeWidget ( ) const;
 
+	/**
+	 * Vérifie que l'index des items par entité correspond à l'arborescence :
+	 * chaque item d'entité de l'arborescence y est référencé pour son
+	 * entité, et l'index n'en contient pas d'autre.
+	 * \exception	Une exception est levée en cas d'incohérence.
+	 * \warning		Méthode avant tout à usage interne (tests), de coût
+	 *				linéaire en le nombre d'items.
+	 */
+	virtual void checkItems ( ) const;
+
 	//@}	// La vue "arborescente".
 
 	/**
@@ -848,6 +859,14 @@ class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Utils::SelectionMa
 	 */
 	virtual QtEntityTreeWidgetItem* getItem(const Mgx3D::Utils::Entity& entity);
 
+	/**
+	 * Détruit les items représentant les entités transmises en argument,
+	 * regroupés par entrée afin que chaque entrée ne soit reconstruite qu'une
+	 * seule fois.
+	 * \see		deleteChildren
+	 */
+	virtual void deleteItems (const std::vector<Mgx3D::Utils::Entity*>& entities);
+
 	/**
 	 * \param		Item parent
 	 * \param		Libellé de l'item
@@ -1060,6 +1079,9 @@ class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Utils::SelectionMa
 	/** Une seule dimension - 3D - (pour l'instant) pour les maillages structurés. */
 	QTreeWidgetItem				*_structuredMeshVolumesItem;
 
+	/** Les items représentant les entités, par entité. */
+	Mgx3D::Utils::IndexedMap<const Mgx3D::Utils::Entity*, QtEntityTreeWidgetItem*>	_entitiesItems;
+
 	/** Le menu contextuel de l'arborescence d'items. */
 	QMenu*					_treeViewPopupMenu;
 	QTreeViewPopupActions			_treeViewActions;
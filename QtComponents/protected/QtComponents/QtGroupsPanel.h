@@ -10,6 +10,7 @@
 #include "Internal/ContextIfc.h"
 
 #include "Group/GroupEntity.h"
+#include "Utils/IndexedMap.h"
 #include "QtComponents/QtEntitiesItemViewPanel.h"
 
 #include <QCheckBox>
@@ -302,6 +303,15 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Utils::SelectionMan
 	 */
 	virtual void removeGroups (const std::vector<Mgx3D::Group::GroupEntity*>& groups);
 
+	/**
+	 * Vérifie que l'index des items par groupe correspond à l'arborescence
+	 * des groupes.
+	 * \exception	Une exception est levée en cas d'incohérence.
+	 * \warning		Méthode avant tout à usage interne (tests).
+	 * \see			QtEntitiesPanel::checkItems
+	 */
+	virtual void checkItems ( ) const;
+
 	/**
 	 * \return		Les groupes sélectionnés.
 	 */
@@ -713,6 +723,9 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Utils::SelectionMan
 	/** Les entrées principales pour chaque niveau. */
 	std::vector<std::map <unsigned long, QTreeWidgetItem*> >	_levelsEntriesItems;
 
+	/** Les items représentant les groupes, par groupe. */
+	Mgx3D::Utils::IndexedMap<const Mgx3D::Group::GroupEntity*, QtGroupTreeWidgetItem*>	_groupsItems;
+
 	/** Le menu contextuel de l'arborescence "Types d'entités". */
 	QMenu*									_typesPopupMenu;
 
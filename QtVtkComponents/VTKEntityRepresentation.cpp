@@ -358,9 +358,12 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 	// On prend ici en compte le mode d'affichage des propriétés : global
 	// ou non (MGXDDD-208) :
 	const unsigned long	usedMask	= getUsedRepresentationMask ( );
+	// Les représentations prises en charge par un lot n'ont pas d'acteur
+	// propre :
+	const unsigned long	batchedMask	= getBatchedRepresentationMask (usedMask);
 	// Rem CP : pas de levée d'exception car en cas d'erreur on introduit un
 	// bogue supplémentaire (non cohérence du mask et des Add/RemoveViewProp
-	if (0 != (usedMask & SURFACES))
+	if ((0 != (usedMask & SURFACES)) && (0 == (batchedMask & SURFACES)))
 	{
 	    if (0 == _surfacicGrid)
 	        createSurfacicRepresentation ( );
@@ -392,7 +395,7 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 				cerr << "Erreur interne en " << __FILE__ << ' ' << __LINE__
 				     << " : _isoWireActor non instancié." << endl;
 	}	// if (0 != (usedMask & ISOCURVES))
-	if ((0 != (usedMask & CURVES)))
+	if ((0 != (usedMask & CURVES)) && (0 == (batchedMask & CURVES)))
 	{
 //		if (0 == _wireGrid)
 // CP : ATTENTION à ce test, selon les cas on instancie ou non _wireGrid,
@@ -435,7 +438,7 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 				_renderer->AddViewProp (_triedronZActor);
 			}
 	}	// if (0 != (usedMask & TRIHEDRON))
-	if (0 != (usedMask & CLOUDS))
+	if ((0 != (usedMask & CLOUDS)) && (0 == (batchedMask & CLOUDS)))
 	{
 		if (0 == _cloudGrid){
 			if (0 == (usedMask & MESH_SHAPE))
@@ -476,6 +479,8 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
     				<< " : _discActor non instancié." << endl;
     }	// if (0 != (usedMask & DISCRETISATIONTYPE))
 
+	updateBatchedRepresentation (batchedMask);
+
 	updateRepresentationProperties ( );
 }	// VTKEntityRepresentation::updateRepresentation
 
@@ -618,7 +623,7 @@ property->SetInterpolationToFlat ( );
 	// correspondre à ceux affichés.
 	if (0 != mapper)
 	{
-    		if ((0 != (mask & NODES_VALUES)) && (0 != pointData))
+    		if ((0 != (mask & NODES_VALUES)) && (0 != pointData) && (0 != points))
 		{
 			// On récupère l'éventuel tableau existant :
 			vtkDataArray*	data	=
@@ -6,6 +6,7 @@
 
 #include "Internal/ContextIfc.h"
 #include "Internal/Resources.h"
+#include "Utils/Common.h"
 
 #include "QtVtkComponents/VTKGMDSEntityRepresentation.h"
 #include "QtVtkComponents/VTKMgx3DEntityRepresentation.h"
@@ -261,10 +262,9 @@ void VTKGMDSEntityRepresentation::createWireRepresentation()
         CHECK_NULL_PTR_ERROR(_surfacicGrid)
     } // if (0 == _surfacicGrid)
 
-    UTF8String	message1 (Charset::UTF_8);
-    message1 << "VTKGMDSEntityRepresentation::createWireRepresentation pour "
-            << getEntity()->getName();
-    getEntity()->log(TkUtil::TraceLog(message1, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*getEntity(), TkUtil::Log::TRACE_5,
+            "VTKGMDSEntityRepresentation::createWireRepresentation pour "
+            << getEntity()->getName());
 
     vtkExtractEdges* edgesExtractor = vtkExtractEdges::New();
 
@@ -689,11 +689,9 @@ void VTKGMDSEntityRepresentation::createMeshEntitySurfacicRepresentation(
         throw exc;
     }
 
-	UTF8String	message1 (Charset::UTF_8);
-    message1
-            << "VTKGMDSEntityRepresentation::createMeshEntitySurfacicRepresentation pour "
-            << meshEntity->getName();
-    getEntity()->log(TkUtil::TraceLog(message1, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*getEntity(), TkUtil::Log::TRACE_5,
+            "VTKGMDSEntityRepresentation::createMeshEntitySurfacicRepresentation pour "
+            << meshEntity->getName());
 
     _surfacicGrid = vtkUnstructuredGrid::New();
     CHECK_NULL_PTR_ERROR(_surfacicGrid)
@@ -1106,11 +1104,9 @@ void VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation(
         throw exc;
     }
 
-	UTF8String	message1 (Charset::UTF_8);
-    message1
-            << "VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation pour "
-            << meshEntity->getName();
-    getEntity()->log(TkUtil::TraceLog(message1, TkUtil::Log::TRACE_5));
+    MGX_TRACE_IF(*getEntity(), TkUtil::Log::TRACE_5,
+            "VTKGMDSEntityRepresentation::createMeshEntityVolumicRepresentation pour "
+            << meshEntity->getName());
 
     _volumicGrid = vtkUnstructuredGrid::New();
     CHECK_NULL_PTR_ERROR(_volumicGrid)
@@ -1,6 +1,7 @@
 #include "Internal/ContextIfc.h"
 
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DEntityBatch.h"
 #include "Utils/DisplayProperties.h"
 #include "Utils/Entity.h"
 
@@ -14,13 +15,13 @@ using namespace Mgx3D::Utils;
 
 
 VTKMgx3DActor::VTKMgx3DActor ( )
-	: vtkLODActor ( ), _entity (0), _representationType ((DisplayRepresentation::type)0)
+	: vtkLODActor ( ), _entity (0), _batch (0), _representationType ((DisplayRepresentation::type)0)
 {
 }	// VTKMgx3DActor::VTKMgx3DActor
 
 
 VTKMgx3DActor::VTKMgx3DActor (const VTKMgx3DActor&)
-	: vtkLODActor ( ), _entity (0), _representationType ((DisplayRepresentation::type)0)
+	: vtkLODActor ( ), _entity (0), _batch (0), _representationType ((DisplayRepresentation::type)0)
 {
 	assert (0 && "VTKMgx3DActor copy constructor is not allowed.");
 }	// VTKMgx3DActor copy constructor
@@ -63,6 +64,10 @@ const char* VTKMgx3DActor::GetClassName ( )
 
 void VTKMgx3DActor::Render (vtkRenderer* renderer, vtkMapper* mapper)
 {
+	// Affichage par lots : les suppressions d'entités sont répercutées une
+	// fois pour toutes avant le tracé.
+	if (0 != _batch)
+		_batch->prepareRender ( );
 //cout << __FILE__ << ' ' << __LINE__ << " VTKMgx3DActor::Render ALLOCATED RENDER TIME = " << AllocatedRenderTime << " ESTIMATED RENDER TIME = " << EstimatedRenderTime << " SAVED ESTIMATED RENDER TIME = " << SavedEstimatedRenderTime << " RENDERER ALLOCATED TIME = " << renderer->GetAllocatedRenderTime ( ) << endl;
 	vtkLODActor::Render (renderer, mapper);
 }	// VTKMgx3DActor::Render
@@ -89,6 +94,36 @@ void VTKMgx3DActor::SetEntity (Entity* entity)
 }	// VTKMgx3DActor::SetEntity
 
 
+Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* VTKMgx3DActor::GetBatch ( )
+{
+	return _batch;
+}	// VTKMgx3DActor::GetBatch
+
+
+const Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* VTKMgx3DActor::GetBatch ( ) const
+{
+	return _batch;
+}	// VTKMgx3DActor::GetBatch
+
+
+void VTKMgx3DActor::SetBatch (Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* batch)
+{
+	_batch	= batch;
+}	// VTKMgx3DActor::SetBatch
+
+
+Entity* VTKMgx3DActor::GetPickedEntity ( )
+{
+	return 0 == _batch ? _entity : _batch->getPickedEntity ( );
+}	// VTKMgx3DActor::GetPickedEntity
+
+
+const Entity* VTKMgx3DActor::GetPickedEntity ( ) const
+{
+	return 0 == _batch ? _entity : _batch->getPickedEntity ( );
+}	// VTKMgx3DActor::GetPickedEntity
+
+
 void VTKMgx3DActor::SetRepresentationType (DisplayRepresentation::type type)
 {
 	_representationType	= type;
@@ -0,0 +1,427 @@
+/**
+ * \file        VTKMgx3DEntityBatch.cpp
+ * \author      Team Magix3D
+ * \date        19/10/2026
+ */
+
+#include "Internal/ContextIfc.h"
+#include "Internal/Resources.h"
+
+#include "QtVtkComponents/VTKMgx3DEntityBatch.h"
+
+#include <TkUtil/InternalError.h>
+#include <TkUtil/MemoryError.h>
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkPoints.h>
+#include <vtkProperty.h>
+
+#include <assert.h>
+
+
+using namespace std;
+using namespace TkUtil;
+using namespace Mgx3D::Utils;
+
+
+namespace Mgx3D
+{
+
+namespace QtVtkComponents
+{
+
+
+// ===========================================================================
+//                      LA CLASSE VTKMgx3DEntityBatch
+// ===========================================================================
+
+const string VTKMgx3DEntityBatch::entityIdsFieldName ("entityIds");
+const string VTKMgx3DEntityBatch::colorsFieldName ("colors");
+
+/** Nombre minimum de mailles masquées avant compactage. */
+static const size_t	minHiddenCellsBeforeCompaction	= 1024;
+
+
+VTKMgx3DEntityBatch::VTKMgx3DEntityBatch (CELL_KIND kind)
+	: _kind (kind), _slots ( ), _cellEntities ( ), _connectivity ( ),
+	  _hiddenCellsNum (0), _pickedEntity (0),
+	  _polyData (0), _points (0), _entityIds (0), _colors (0), _ghosts (0),
+	  _mapper (0), _actor (0)
+{
+	_polyData	= vtkPolyData::New ( );
+	_points		= vtkPoints::New ( );
+	_points->SetDataTypeToDouble ( );
+	_polyData->SetPoints (_points);
+	_entityIds	= vtkIdTypeArray::New ( );
+	_entityIds->SetName (entityIdsFieldName.c_str ( ));
+	_polyData->GetCellData ( )->AddArray (_entityIds);
+	_colors		= vtkUnsignedCharArray::New ( );
+	_colors->SetName (colorsFieldName.c_str ( ));
+	_colors->SetNumberOfComponents (3);
+	_polyData->GetCellData ( )->AddArray (_colors);
+#if VTK_MAJOR_VERSION >= 9
+	// Les mailles des entités enlevées sont masquées, le mapper ne les
+	// représente pas :
+	_ghosts		= vtkUnsignedCharArray::New ( );
+	_ghosts->SetName (vtkDataSetAttributes::GhostArrayName ( ));
+	_polyData->GetCellData ( )->AddArray (_ghosts);
+#endif	// VTK_MAJOR_VERSION >= 9
+	rebuildCells ( );
+
+	_mapper	= vtkPolyDataMapper::New ( );
+#ifndef VTK_5
+	_mapper->SetInputData (_polyData);
+#else	// VTK_5
+	_mapper->SetInput (_polyData);
+#endif	// VTK_5
+	// Couleurs par maille, directement en RGB :
+	_mapper->ScalarVisibilityOn ( );
+	_mapper->SetScalarModeToUseCellFieldData ( );
+	_mapper->SelectColorArray (colorsFieldName.c_str ( ));
+#if (VTK_MAJOR_VERSION > 8) || ((VTK_MAJOR_VERSION == 8) && (VTK_MINOR_VERSION >= 1))
+	_mapper->SetColorModeToDirectScalars ( );
+#else
+	// Mode par défaut : les scalaires de type unsigned char sont des couleurs
+	_mapper->SetColorModeToDefault ( );
+#endif	// VTK >= 8.1
+#if	VTK_MAJOR_VERSION < 8
+	_mapper->SetImmediateModeRendering (!Internal::Resources::instance ( )._useDisplayList);
+#endif	// VTK_MAJOR_VERSION < 8
+
+	_actor	= VTKMgx3DActor::New ( );
+	_actor->SetBatch (this);
+	_actor->SetMapper (_mapper);
+	switch (_kind)
+	{
+		case VERTICES	:
+			_actor->SetRepresentationType ((DisplayRepresentation::type)(
+						DisplayRepresentation::SOLID | DisplayRepresentation::WIRE));
+			_actor->GetProperty ( )->SetRepresentationToPoints ( );
+			break;
+		case LINES		:
+			_actor->SetRepresentationType (DisplayRepresentation::WIRE);
+			_actor->GetProperty ( )->SetRepresentationToSurface ( );
+			_actor->GetProperty ( )->SetInterpolationToFlat ( );
+			break;
+		default			:
+			_actor->SetRepresentationType (DisplayRepresentation::SOLID);
+			_actor->GetProperty ( )->SetRepresentationToSurface ( );
+	}	// switch (_kind)
+}	// VTKMgx3DEntityBatch::VTKMgx3DEntityBatch
+
+
+VTKMgx3DEntityBatch::VTKMgx3DEntityBatch (const VTKMgx3DEntityBatch&)
+	: _kind (LINES), _slots ( ), _cellEntities ( ), _connectivity ( ),
+	  _hiddenCellsNum (0), _pickedEntity (0),
+	  _polyData (0), _points (0), _entityIds (0), _colors (0), _ghosts (0),
+	  _mapper (0), _actor (0)
+{
+	MGX_FORBIDDEN ("VTKMgx3DEntityBatch copy constructor is not allowed.");
+}	// VTKMgx3DEntityBatch::VTKMgx3DEntityBatch
+
+
+VTKMgx3DEntityBatch& VTKMgx3DEntityBatch::operator = (
+												const VTKMgx3DEntityBatch&)
+{
+	MGX_FORBIDDEN ("VTKMgx3DEntityBatch assignment operator is not allowed.");
+	return *this;
+}	// VTKMgx3DEntityBatch::operator =
+
+
+VTKMgx3DEntityBatch::~VTKMgx3DEntityBatch ( )
+{
+	if (0 != _actor)
+	{
+		_actor->SetBatch (0);
+		_actor->Delete ( );
+	}
+	_actor	= 0;
+	if (0 != _mapper)
+		_mapper->Delete ( );
+	_mapper	= 0;
+	if (0 != _entityIds)
+		_entityIds->Delete ( );
+	_entityIds	= 0;
+	if (0 != _colors)
+		_colors->Delete ( );
+	_colors	= 0;
+	if (0 != _ghosts)
+		_ghosts->Delete ( );
+	_ghosts	= 0;
+	if (0 != _points)
+		_points->Delete ( );
+	_points	= 0;
+	if (0 != _polyData)
+		_polyData->Delete ( );
+	_polyData	= 0;
+}	// VTKMgx3DEntityBatch::~VTKMgx3DEntityBatch
+
+
+void VTKMgx3DEntityBatch::addEntity (
+		Entity& entity, const vector<Math::Point>& points,
+		const vector<size_t>& cells, const Color& color)
+{
+	if (true == hasEntity (entity))
+		removeEntity (entity);
+
+	const size_t	kind		= (size_t)_kind;
+	const size_t	cellsNum	=
+				VERTICES == _kind ? points.size ( ) : cells.size ( ) / kind;
+	if (0 == cellsNum)
+		return;
+
+	Slot	slot;
+	slot.entity		= &entity;
+	slot.firstPoint	= _points->GetNumberOfPoints ( );
+	slot.pointsNum	= points.size ( );
+	slot.firstCell	= _cellEntities.size ( );
+	slot.cellsNum	= cellsNum;
+
+	// Les points (InsertNextPoint : croissance amortie du tableau) :
+	for (vector<Math::Point>::const_iterator itp = points.begin ( );
+	     points.end ( ) != itp; itp++)
+		_points->InsertNextPoint ((*itp).getX( ), (*itp).getY( ), (*itp).getZ( ));
+
+	// Les mailles et leurs attributs :
+	vtkCellArray*	cellArray	= VERTICES == _kind ? _polyData->GetVerts ( ) :
+			(LINES == _kind ? _polyData->GetLines ( ) : _polyData->GetPolys( ));
+	CHECK_NULL_PTR_ERROR (cellArray)
+	const unsigned char	rgb [3]	= {
+		(unsigned char)color.getRed ( ), (unsigned char)color.getGreen ( ),
+		(unsigned char)color.getBlue ( ) };
+	vtkIdType			ids [3]	= { 0, 0, 0 };
+	_connectivity.reserve (_connectivity.size ( ) + kind * cellsNum);
+	_cellEntities.reserve (_cellEntities.size ( ) + cellsNum);
+	for (size_t c = 0; c < cellsNum; c++)
+	{
+		for (size_t i = 0; i < kind; i++)
+		{
+			ids [i]	= slot.firstPoint +
+					(vtkIdType)(VERTICES == _kind ? c : cells [kind * c + i]);
+			_connectivity.push_back (ids [i]);
+		}	// for (size_t i = 0; i < kind; i++)
+		cellArray->InsertNextCell ((vtkIdType)kind, ids);
+		_cellEntities.push_back (&entity);
+		_entityIds->InsertNextValue ((vtkIdType)entity.getUniqueId ( ));
+#if VTK_MAJOR_VERSION >= 8
+		_colors->InsertNextTypedTuple (rgb);
+#else	// VTK_MAJOR_VERSION >= 8
+		_colors->InsertNextTupleValue (rgb);
+#endif	// VTK_MAJOR_VERSION >= 8
+		if (0 != _ghosts)
+			_ghosts->InsertNextValue (0);
+	}	// for (size_t c = 0; c < cellsNum; c++)
+
+	_slots.insert (pair<const Entity*, Slot>(&entity, slot));
+	cellArray->Modified ( );
+	_points->Modified ( );
+	_polyData->Modified ( );
+}	// VTKMgx3DEntityBatch::addEntity
+
+
+void VTKMgx3DEntityBatch::removeEntity (const Entity& entity)
+{
+	map<const Entity*, Slot>::iterator	its	= _slots.find (&entity);
+	if (_slots.end ( ) == its)
+		return;
+
+	const Slot	slot	= its->second;
+	_slots.erase (its);
+	if (&entity == _pickedEntity)
+		_pickedEntity	= 0;
+	for (vtkIdType c = slot.firstCell; c < slot.firstCell + slot.cellsNum; c++)
+	{
+		_cellEntities [c]	= 0;
+		if (0 != _ghosts)
+			_ghosts->SetValue (c, vtkDataSetAttributes::HIDDENCELL);
+	}	// for (vtkIdType c = slot.firstCell; ...
+	_hiddenCellsNum	+= slot.cellsNum;
+
+	// Sans tableau fantôme les mailles masquées seraient représentées, elles
+	// seront supprimées avant le prochain tracé (prepareRender) :
+	if (0 == _ghosts)
+		_polyData->Modified ( );
+	else if ((_hiddenCellsNum > minHiddenCellsBeforeCompaction) &&
+	         (_hiddenCellsNum > _cellEntities.size ( ) / 2))
+		compact ( );
+	else
+	{
+		_ghosts->Modified ( );
+		_polyData->Modified ( );
+	}
+}	// VTKMgx3DEntityBatch::removeEntity
+
+
+bool VTKMgx3DEntityBatch::hasEntity (const Entity& entity) const
+{
+	return _slots.end ( ) == _slots.find (&entity) ? false : true;
+}	// VTKMgx3DEntityBatch::hasEntity
+
+
+vector<Entity*> VTKMgx3DEntityBatch::getEntities ( ) const
+{
+	vector<Entity*>	entities;
+	entities.reserve (_slots.size ( ));
+	for (map<const Entity*, Slot>::const_iterator its = _slots.begin ( );
+	     _slots.end ( ) != its; its++)
+		entities.push_back (its->second.entity);
+
+	return entities;
+}	// VTKMgx3DEntityBatch::getEntities
+
+
+void VTKMgx3DEntityBatch::setEntityColor (
+									const Entity& entity, const Color& color)
+{
+	map<const Entity*, Slot>::const_iterator	its	= _slots.find (&entity);
+	if (_slots.end ( ) == its)
+		return;
+
+	const unsigned char	rgb [3]	= {
+		(unsigned char)color.getRed ( ), (unsigned char)color.getGreen ( ),
+		(unsigned char)color.getBlue ( ) };
+	const Slot&	slot	= its->second;
+	for (vtkIdType c = slot.firstCell; c < slot.firstCell + slot.cellsNum; c++)
+#if VTK_MAJOR_VERSION >= 8
+		_colors->SetTypedTuple (c, rgb);
+#else	// VTK_MAJOR_VERSION >= 8
+		_colors->SetTupleValue (c, rgb);
+#endif	// VTK_MAJOR_VERSION >= 8
+	_colors->Modified ( );
+	_polyData->Modified ( );
+}	// VTKMgx3DEntityBatch::setEntityColor
+
+
+Entity* VTKMgx3DEntityBatch::getEntity (vtkIdType cellId) const
+{
+	if ((0 > cellId) || (_cellEntities.size ( ) <= (size_t)cellId))
+		return 0;
+
+	return _cellEntities [cellId];
+}	// VTKMgx3DEntityBatch::getEntity
+
+
+void VTKMgx3DEntityBatch::setPickedCell (vtkIdType cellId)
+{
+	_pickedEntity	= getEntity (cellId);
+}	// VTKMgx3DEntityBatch::setPickedCell
+
+
+void VTKMgx3DEntityBatch::prepareRender ( )
+{
+	if ((0 == _ghosts) && (0 != _hiddenCellsNum))
+		compact ( );
+}	// VTKMgx3DEntityBatch::prepareRender
+
+
+void VTKMgx3DEntityBatch::compact ( )
+{
+	const size_t	kind		= (size_t)_kind;
+	const size_t	oldCellsNum	= _cellEntities.size ( );
+	vtkPoints*		points		= vtkPoints::New ( );
+	points->SetDataTypeToDouble ( );
+	vector<Entity*>		cellEntities;
+	vector<vtkIdType>	connectivity;
+	cellEntities.reserve (oldCellsNum - _hiddenCellsNum);
+	connectivity.reserve (kind * (oldCellsNum - _hiddenCellsNum));
+	vtkIdTypeArray*			entityIds	= vtkIdTypeArray::New ( );
+	vtkUnsignedCharArray*	colors		= vtkUnsignedCharArray::New ( );
+	entityIds->SetName (entityIdsFieldName.c_str ( ));
+	colors->SetName (colorsFieldName.c_str ( ));
+	colors->SetNumberOfComponents (3);
+
+	// On parcourt les emplacements dans l'ordre des mailles afin de
+	// préserver l'ordre de tracé :
+	map<vtkIdType, Slot*>	ordered;
+	for (map<const Entity*, Slot>::iterator its = _slots.begin ( );
+	     _slots.end ( ) != its; its++)
+		ordered.insert (pair<vtkIdType, Slot*>(its->second.firstCell, &its->second));
+	for (map<vtkIdType, Slot*>::iterator ito = ordered.begin ( );
+	     ordered.end ( ) != ito; ito++)
+	{
+		Slot&			slot		= *(ito->second);
+		const vtkIdType	firstPoint	= points->GetNumberOfPoints ( );
+		const vtkIdType	firstCell	= cellEntities.size ( );
+		for (vtkIdType p = 0; p < slot.pointsNum; p++)
+			points->InsertNextPoint (_points->GetPoint (slot.firstPoint + p));
+		for (vtkIdType c = 0; c < slot.cellsNum; c++)
+		{
+			const vtkIdType	oldCell	= slot.firstCell + c;
+			for (size_t i = 0; i < kind; i++)
+				connectivity.push_back (
+					_connectivity [kind * oldCell + i] - slot.firstPoint + firstPoint);
+			cellEntities.push_back (slot.entity);
+			entityIds->InsertNextValue (_entityIds->GetValue (oldCell));
+			colors->InsertNextTuple (_colors->GetTuple (oldCell));
+		}	// for (vtkIdType c = 0; c < slot.cellsNum; c++)
+		slot.firstPoint	= firstPoint;
+		slot.firstCell	= firstCell;
+	}	// for (map<vtkIdType, Slot*>::iterator ito = ordered.begin ( ); ...
+
+	_cellEntities.swap (cellEntities);
+	_connectivity.swap (connectivity);
+	_hiddenCellsNum	= 0;
+
+	_polyData->GetCellData ( )->RemoveArray (entityIdsFieldName.c_str ( ));
+	_polyData->GetCellData ( )->RemoveArray (colorsFieldName.c_str ( ));
+	_entityIds->Delete ( );		_entityIds	= entityIds;
+	_colors->Delete ( );		_colors		= colors;
+	_polyData->GetCellData ( )->AddArray (_entityIds);
+	_polyData->GetCellData ( )->AddArray (_colors);
+	if (0 != _ghosts)
+	{
+		_ghosts->SetNumberOfValues (_cellEntities.size ( ));
+		_ghosts->FillComponent (0, 0);
+	}	// if (0 != _ghosts)
+	_points->Delete ( );
+	_points	= points;
+	_polyData->SetPoints (_points);
+	rebuildCells ( );
+}	// VTKMgx3DEntityBatch::compact
+
+
+VTKMgx3DActor& VTKMgx3DEntityBatch::getActor ( )
+{
+	CHECK_NULL_PTR_ERROR (_actor)
+	return *_actor;
+}	// VTKMgx3DEntityBatch::getActor
+
+
+vtkPolyDataMapper& VTKMgx3DEntityBatch::getMapper ( )
+{
+	CHECK_NULL_PTR_ERROR (_mapper)
+	return *_mapper;
+}	// VTKMgx3DEntityBatch::getMapper
+
+
+vtkPolyData& VTKMgx3DEntityBatch::getPolyData ( )
+{
+	CHECK_NULL_PTR_ERROR (_polyData)
+	return *_polyData;
+}	// VTKMgx3DEntityBatch::getPolyData
+
+
+void VTKMgx3DEntityBatch::rebuildCells ( )
+{
+	const size_t	kind		= (size_t)_kind;
+	const size_t	cellsNum	= _cellEntities.size ( );
+	vtkCellArray*	cellArray	= vtkCellArray::New ( );
+	cellArray->Allocate (cellArray->EstimateSize (cellsNum, kind));
+	for (size_t c = 0; c < cellsNum; c++)
+		cellArray->InsertNextCell ((vtkIdType)kind, &_connectivity [kind * c]);
+	switch (_kind)
+	{
+		case VERTICES	: _polyData->SetVerts (cellArray);	break;
+		case LINES		: _polyData->SetLines (cellArray);	break;
+		default			: _polyData->SetPolys (cellArray);
+	}	// switch (_kind)
+	cellArray->Delete ( );
+	_polyData->Modified ( );
+}	// VTKMgx3DEntityBatch::rebuildCells
+
+
+}	// namespace QtVtkComponents
+
+}	// namespace Mgx3D
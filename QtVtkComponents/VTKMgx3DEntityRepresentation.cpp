@@ -8,6 +8,8 @@
 #include "Internal/Resources.h"
 
 #include "QtVtkComponents/VTKMgx3DEntityRepresentation.h"
+#include "QtVtkComponents/VTKMgx3DEntityBatch.h"
+#include "QtVtkComponents/VTKRenderingManager.h"
 #include "QtComponents/QtMgx3DApplication.h"
 #include <Utils/DisplayProperties.h>
 #include <Utils/MgxNumeric.h>
@@ -73,14 +75,14 @@ static bool sameDirection (vtkTransform& transform, const vector<Point>& vector)
 
 
 VTKMgx3DEntityRepresentation::VTKMgx3DEntityRepresentation (Entity& entity)
-	: VTKEntityRepresentation (entity)
+	: VTKEntityRepresentation (entity), _batchedMask (0)
 {
 }	// VTKMgx3DEntityRepresentation::VTKMgx3DEntityRepresentation
 
 
 VTKMgx3DEntityRepresentation::VTKMgx3DEntityRepresentation (
 											VTKMgx3DEntityRepresentation& ver)
-	: VTKEntityRepresentation (*(ver.getEntity ( )))
+	: VTKEntityRepresentation (*(ver.getEntity ( ))), _batchedMask (0)
 {
 	MGX_FORBIDDEN ("VTKMgx3DEntityRepresentation copy constructor is not allowed.");
 }	// VTKMgx3DEntityRepresentation::VTKMgx3DEntityRepresentation
@@ -822,6 +824,135 @@ switch (getEntity ( )->getDim ( ))
 }	// VTKMgx3DEntityRepresentation::createRefinedRepresentation
 
 
+unsigned long VTKMgx3DEntityRepresentation::getBatchedRepresentationMask (
+											unsigned long usedMask) const
+{
+	const VTKRenderingManager*	renderingManager	=
+			dynamic_cast<const VTKRenderingManager*>(getRenderingManager ( ));
+	if ((0 == getEntity ( )) || (0 == renderingManager) ||
+	    (false == renderingManager->useBatchedRendering ( )))
+		return 0;
+
+	// Représentations spécifiques (projection sur le maillage, valeurs aux
+	// noeuds/mailles) : acteurs propres à l'entité.
+	if (0 != (usedMask & (MESH_SHAPE | NODES_VALUES | CELLS_VALUES)))
+		return 0;
+
+	return usedMask & getBatchableRepresentationMask ( );
+}	// VTKMgx3DEntityRepresentation::getBatchedRepresentationMask
+
+
+void VTKMgx3DEntityRepresentation::updateBatchedRepresentation (
+													unsigned long batchedMask)
+{
+	if (0 == getEntity ( ))
+		return;
+
+	const unsigned long		reps [3]	= { CLOUDS, CURVES, SURFACES };
+	const DisplayProperties	properties	= getDisplayPropertiesAttributes ( );
+	for (size_t i = 0; i < 3; i++)
+	{
+		const unsigned long	rep		= reps [i];
+		VTKMgx3DEntityBatch*	batch	= getEntityBatch (rep);
+		if (0 == batch)
+			continue;
+
+		if (0 == (batchedMask & rep))
+		{
+			if (0 != (_batchedMask & rep))
+				batch->removeEntity (*getEntity ( ));
+			_batchedMask	&= ~rep;
+			continue;
+		}	// if (0 == (batchedMask & rep))
+
+		// destroyRepresentations a été appelé si la représentation doit être
+		// reconstruite : l'entité n'est alors plus dans le lot.
+		if (0 == (_batchedMask & rep))
+		{
+			vector<Point>	points;
+			vector<size_t>	cells;
+			if (false == getBatchedRepresentation (rep, points, cells))
+				continue;
+			batch->addEntity (*getEntity ( ), points, cells, getColor (rep));
+			_batchedMask	|= rep;
+		}	// if (0 == (_batchedMask & rep))
+
+		// Rem : épaisseur des traits et taille des points sont celles du lot.
+		vtkProperty*	property	= batch->getActor ( ).GetProperty ( );
+		if (CLOUDS == rep)
+		{
+			property->SetPointSize (properties.getPointSize ( ));
+			property->SetOpacity (properties.getCloudOpacity ( ));
+		}
+		else if (CURVES == rep)
+		{
+			property->SetLineWidth (properties.getLineWidth ( ));
+			property->SetOpacity (properties.getWireOpacity ( ));
+		}
+		else
+			property->SetOpacity (properties.getSurfacicOpacity ( ));
+	}	// for (size_t i = 0; i < 3; i++)
+}	// VTKMgx3DEntityRepresentation::updateBatchedRepresentation
+
+
+void VTKMgx3DEntityRepresentation::destroyRepresentations (bool realyDestroy)
+{
+	if ((0 != _batchedMask) && (0 != getEntity ( )))
+	{
+		const unsigned long	reps [3]	= { CLOUDS, CURVES, SURFACES };
+		for (size_t i = 0; i < 3; i++)
+		{
+			VTKMgx3DEntityBatch*	batch	= 0 == (_batchedMask & reps [i]) ?
+											0 : getEntityBatch (reps [i]);
+			if (0 != batch)
+				batch->removeEntity (*getEntity ( ));
+		}	// for (size_t i = 0; i < 3; i++)
+	}	// if ((0 != _batchedMask) && (0 != getEntity ( )))
+	_batchedMask	= 0;
+
+	VTKEntityRepresentation::destroyRepresentations (realyDestroy);
+}	// VTKMgx3DEntityRepresentation::destroyRepresentations
+
+
+void VTKMgx3DEntityRepresentation::updateRepresentationProperties ( )
+{
+	VTKEntityRepresentation::updateRepresentationProperties ( );
+
+	if ((0 == _batchedMask) || (0 == getEntity ( )))
+		return;
+
+	const unsigned long	reps [3]	= { CLOUDS, CURVES, SURFACES };
+	for (size_t i = 0; i < 3; i++)
+	{
+		VTKMgx3DEntityBatch*	batch	= 0 == (_batchedMask & reps [i]) ?
+										0 : getEntityBatch (reps [i]);
+		if (0 != batch)
+			batch->setEntityColor (*getEntity ( ), getColor (reps [i]));
+	}	// for (size_t i = 0; i < 3; i++)
+}	// VTKMgx3DEntityRepresentation::updateRepresentationProperties
+
+
+VTKMgx3DEntityBatch* VTKMgx3DEntityRepresentation::getEntityBatch (
+													unsigned long rep) const
+{
+	VTKRenderingManager*	renderingManager	=
+			dynamic_cast<VTKRenderingManager*>(
+				const_cast<VTKMgx3DEntityRepresentation*>(this)->getRenderingManager ( ));
+	if ((0 == renderingManager) || (0 == getEntity ( )))
+		return 0;
+
+	VTKMgx3DEntityBatch::CELL_KIND	kind	= VTKMgx3DEntityBatch::TRIANGLES;
+	if (CLOUDS == rep)
+		kind	= VTKMgx3DEntityBatch::VERTICES;
+	else if (CURVES == rep)
+		kind	= VTKMgx3DEntityBatch::LINES;
+	else if (SURFACES != rep)
+		return 0;
+
+	return &renderingManager->getEntityBatch (getEntity ( )->getType ( ), kind);
+}	// VTKMgx3DEntityRepresentation::getEntityBatch
+
+
 
 // ============================================================================
 //                             FONCTIONS STATIQUES
@@ -129,6 +129,42 @@ void VTKMgx3DGeomEntityRepresentation::createWireRepresentation ( )
 }	// VTKMgx3DGeomEntityRepresentation::createWireRepresentation
 
 
+unsigned long VTKMgx3DGeomEntityRepresentation::getBatchableRepresentationMask ( ) const
+{
+	return CLOUDS | CURVES | SURFACES;
+}	// VTKMgx3DGeomEntityRepresentation::getBatchableRepresentationMask
+
+
+bool VTKMgx3DGeomEntityRepresentation::getBatchedRepresentation (
+		unsigned long rep, vector<Math::Point>& points, vector<size_t>& cells)
+{
+	CHECK_NULL_PTR_ERROR (getEntity ( ))
+	// Mêmes paramètres que createCloud/Surfacic/WireRepresentation :
+	DisplayRepresentation::type	t			= DisplayRepresentation::SOLID;
+	double						deflection	= 0.01;
+	if (CURVES == rep)
+		t			= DisplayRepresentation::WIRE;
+	else if (SURFACES == rep)
+		deflection	= 0.001;
+	else if (CLOUDS != rep)
+		return false;
+
+	GeomDisplayRepresentation	gr (t, deflection);
+	const DisplayProperties	props	= getDisplayPropertiesAttributes ( );
+	gr.setShrink (props.getShrinkFactor ( ));
+	getEntity ( )->getRepresentation (gr, true);
+	points	= gr.getPoints ( );
+	if (CURVES == rep)
+		cells	= gr.getCurveDiscretization ( );
+	else if (SURFACES == rep)
+		cells	= gr.getSurfaceDiscretization ( );
+	else
+		cells.clear ( );
+
+	return true;
+}	// VTKMgx3DGeomEntityRepresentation::getBatchedRepresentation
+
+
 void VTKMgx3DGeomEntityRepresentation::createIsoWireRepresentation ( )
 {
 	if ((0 != _isoWireGrid) || (0 != _isoWireMapper) || (0 != _isoWireActor))
@@ -2,6 +2,7 @@
 
 #include "QtVtkComponents/VTKMgx3DPicker.h"
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DEntityBatch.h"
 #include "QtVtkComponents/VTKConfiguration.h"
 
 #include <TkUtil/MemoryError.h>
@@ -16,6 +17,7 @@
 #include <assert.h>
 #include <iostream>
 #include <map>
+#include <set>
 
 
 using namespace std;
@@ -96,33 +98,27 @@ void VTKMgx3DPicker::CompletePicking ( )
 			others.push_back (*ita);
 	}	// for (vector<vtkActor*>::const_iterator ita ...
 
-	// On enlève les doublons (ex : vue surfacique + vue filaire de la même entité) :
+	// On enlève les doublons (ex : vue surfacique + vue filaire de la même
+	// entité). Les acteurs des lots (affichage par lots) représentent
+	// plusieurs entités : l'entité pointée est celle de la maille pointée.
 	vector<vtkActor*>	tmp;
+	vector<Entity*>		entities;
+	set<const Entity*>	found;
 	for (vector<vtkActor*>::const_iterator ita = resorted.begin ( );
 	     resorted.end ( ) != ita; ita++)
 	{
 		VTKMgx3DActor*	actor	= dynamic_cast<VTKMgx3DActor*>(*ita);
 		CHECK_NULL_PTR_ERROR (actor)
-		const Entity*	entity	= actor->GetEntity ( );
-		bool			founded	= false;
-		for (vector<vtkActor*>::const_iterator itt	= tmp.begin ( );
-		     tmp.end ( ) != itt; itt++)
-		{
-			VTKMgx3DActor*	actor2	= dynamic_cast<VTKMgx3DActor*>(*itt);
-			CHECK_NULL_PTR_ERROR (actor2)
-			const Entity*	entity2	= actor2->GetEntity ( );
-			if (entity == entity2)
-			{
-				founded	= true;
-				break;
-			}
-		}
-
-		if (false == founded)
-			tmp.push_back (*ita);
+		Entity*	entity	= 0 == actor->GetBatch ( ) ?
+						  actor->GetEntity ( ) : GetBatchPickedEntity (*actor);
+		if ((0 != entity) && (false == found.insert (entity).second))
+			continue;
+
+		tmp.push_back (*ita);
+		if (0 != entity)
+			entities.push_back (entity);
 	}	// for (vector<vtkActor*>::const_iterator ita = resorted.begin ( );
 	resorted	= tmp;
-	actors		= resorted;
 	SetPickedActors (resorted);
 
 	if (0 != others.size ( ))
@@ -131,19 +127,41 @@ void VTKMgx3DPicker::CompletePicking ( )
 		     others.end ( ) != ito; ito++)
 			resorted.push_back (*ito);
 		SetPickedActors (resorted);
-		actors	= resorted;
 	}	// if (0 != others.size ( ))
 
-	for (vector<vtkActor*>::const_iterator it = actors.begin ( );
-	     actors.end ( ) != it; it++)
-	{
-		VTKMgx3DActor*	actor	= dynamic_cast<VTKMgx3DActor*>(*it);
-		if ((0 != actor) && (0 != actor->GetEntity ( )))
-			_entities.push_back (actor->GetEntity ( ));
-	}	// for (vector<vtkActor*>::const_iterator it = ...
+	_entities	= entities;
 }	// VTKMgx3DPicker::CompletePicking
 
 
+Entity* VTKMgx3DPicker::GetBatchPickedEntity (VTKMgx3DActor& actor)
+{
+	VTKMgx3DEntityBatch*	batch		= actor.GetBatch ( );
+	vtkRenderer*			renderer	= 0 == GetPicker ( ) ?
+										0 : GetPicker ( )->GetRenderer ( );
+	if ((0 == batch) || (0 == renderer))
+		return 0;
+
+	// On se limite à l'acteur du lot pour connaître la maille pointée :
+	double			point [3]	= { 0., 0., 0. };
+	GetSelectionPoint (point);
+	vtkCellPicker*	picker		= vtkCellPicker::New ( );
+	CHECK_NULL_PTR_ERROR (picker)
+	picker->SetTolerance (GetCellTolerance ( ));
+	picker->PickFromListOn ( );
+	picker->AddPickList (&actor);
+	// La maille pointée est mémorisée par le lot : les services de
+	// sélection, qui ne reçoivent que l'acteur, en déduisent l'entité.
+	if (0 != picker->Pick (point [0], point [1], point [2], renderer))
+		batch->setPickedCell (picker->GetCellId ( ));
+	else
+		batch->setPickedCell (-1);
+	Entity*	entity	= batch->getPickedEntity ( );
+	picker->Delete ( );
+
+	return entity;
+}	// VTKMgx3DPicker::GetBatchPickedEntity
+
+
 }	// namespace QtVtkComponents
 
 }	// namespace Mgx3D
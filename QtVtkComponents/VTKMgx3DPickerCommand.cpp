@@ -57,7 +57,7 @@ string VTKMgx3DPickerCommand::GetName (const vtkActor& actor) const
 	const VTKMgx3DActor*	mgxActor	=
 								dynamic_cast<const VTKMgx3DActor*>(&actor);
 	const Entity*			entity		=
-								0 == mgxActor ? 0 : mgxActor->GetEntity ( );
+								0 == mgxActor ? 0 : mgxActor->GetPickedEntity ( );
 
 	return 0 == entity ? "" : entity->getUniqueName ( );
 }	// VTKMgx3DPickerCommand::GetName
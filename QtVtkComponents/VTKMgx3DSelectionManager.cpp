@@ -103,12 +103,15 @@ void VTKMgx3DSelectionManager::AddToSelection (vtkActor& actor)
 {
 	AutoMutex	autoMutex (&GetMutex ( ));
 
-	// API générique :
-	VTKECMSelectionManager::AddToSelection (actor);
+	VTKMgx3DActor*	mgxActor	= dynamic_cast<VTKMgx3DActor*>(&actor);
+	Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetPickedEntity ( );
+
+	// API générique. Un acteur de lot (affichage par lots) représente
+	// plusieurs entités, seule l'entité pointée est sélectionnée :
+	if ((0 == mgxActor) || (0 == mgxActor->GetBatch ( )))
+		VTKECMSelectionManager::AddToSelection (actor);
 
 	// API Mgx 3D :
-	VTKMgx3DActor*	mgxActor	= dynamic_cast<VTKMgx3DActor*>(&actor);
-	Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetEntity ( );
 	if (0 != entity)
 	{
 		vector<Entity*>	entities;
@@ -125,13 +128,14 @@ void VTKMgx3DSelectionManager::RemoveFromSelection (vtkActor& actor)
 	// Version du 03/08/18 : une entité peut être représentée par plusieurs vecteurs,
 	// et celui transmis en argument n'est pas forcément celui recensé ...
 	VTKMgx3DActor*	mgxActor	= dynamic_cast<VTKMgx3DActor*>(&actor);
-	Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetEntity ( );
+	Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetPickedEntity ( );
+	const bool	batched		= (0 != mgxActor) && (0 != mgxActor->GetBatch ( ));
 
-	if (0 == entity)
+	if ((0 == entity) && (false == batched))
 	{
 		VTKECMSelectionManager::RemoveFromSelection (actor);
 		return;
-	}	// if (0 == entity)
+	}	// if ((0 == entity) && (false == batched))
 
 	if (0 != entity)
 	{
@@ -140,8 +144,9 @@ void VTKMgx3DSelectionManager::RemoveFromSelection (vtkActor& actor)
 		removeFromSelection (entities);
 	}	// if (0 != entity)
 
-	// API générique :
-	VTKECMSelectionManager::RemoveFromSelection (actor);
+	// API générique (un acteur de lot n'y est pas recensé) :
+	if (false == batched)
+		VTKECMSelectionManager::RemoveFromSelection (actor);
 }	// VTKMgx3DSelectionManager::RemoveFromSelection
 
 
@@ -149,16 +154,18 @@ bool VTKMgx3DSelectionManager::IsSelected (const vtkActor& actor) const
 {
 	AutoMutex	autoMutex (&GetMutex ( ));
 	const VTKMgx3DActor*	mgxActor	= dynamic_cast<const VTKMgx3DActor*>(&actor);
-	const Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetEntity ( );
-
-	if (0 == entity)
+	const Entity*		entity		= 0 == mgxActor ? 0 : mgxActor->GetPickedEntity ( );
+
+	if ((0 != mgxActor) && (0 != mgxActor->GetBatch ( )))
+	{	// Acteur de lot : c'est l'entité pointée qui est ou non sélectionnée
+		if (0 == entity)
+			return false;
+	}	// if ((0 != mgxActor) && (0 != mgxActor->GetBatch ( )))
+	else if (0 == entity)
 		return VTKECMSelectionManager::IsSelected (actor);
 
-	const vector<Entity*>	entities	= getEntities ( );
-	for (vector<Entity*>::const_iterator ite = entities.begin ( );
-	     entities.end ( ) != ite; ite++)
-		if (*ite == entity)
-			return true;
+	if (true == isSelected (*entity))
+		return true;
 
 	return VTKECMSelectionManager::IsSelected (actor);
 }	// VTKMgx3DSelectionManager::IsSelected
@@ -180,7 +187,8 @@ string VTKMgx3DSelectionManager::GetName (const vtkActor& actor) const
 {
 	const VTKMgx3DActor*	mgxActor	=
 								dynamic_cast<const VTKMgx3DActor*>(&actor);
-	const Entity*			entity		= 0 == mgxActor ? 0 : mgxActor->GetEntity ( );
+	const Entity*			entity		=
+								0 == mgxActor ? 0 : mgxActor->GetPickedEntity ( );
 
 	return 0 == entity ? string ( ) : entity->getName ( );
 }	// VTKMgx3DSelectionManager::GetName
@@ -12,14 +12,19 @@
 #include <TkUtil/InternalError.h>
 #include <TkUtil/MemoryError.h>
 
-#include <vtkCellArray.h>
 #include <vtkCellData.h>
-#include <vtkDoubleArray.h>
-#include <vtkIdTypeArray.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkFloatArray.h>
 #include <vtkProperty.h>
 #include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkVersion.h>
+#if VTK_MAJOR_VERSION < 7
+#include <vtkThreshold.h>
+#endif	// VTK_MAJOR_VERSION < 7
 
 #include <iostream>
+#include <string.h>
 
 using namespace std;
 using namespace TkUtil;
@@ -41,13 +46,13 @@ namespace QtVtkComponents
 
 
 VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation (StructuredMeshEntity& entity)
-	: QtVtkComponents::VTKMgx3DEntityRepresentation (entity)
+	: QtVtkComponents::VTKMgx3DEntityRepresentation (entity), _rectilinearGrid (0)
 {
 }	// VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation
 
 
 VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation (VTKMgx3DStructuredMeshEntityRepresentation& ver)
-	: QtVtkComponents::VTKMgx3DEntityRepresentation (*(ver.getEntity ( )))
+	: QtVtkComponents::VTKMgx3DEntityRepresentation (*(ver.getEntity ( ))), _rectilinearGrid (0)
 {
 	MGX_FORBIDDEN ("VTKMgx3DStructuredMeshEntityRepresentation copy constructor is not allowed.");
 }	// VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation
@@ -96,8 +101,8 @@ void VTKMgx3DStructuredMeshEntityRepresentation::updateRepresentationProperties
 	int                     colorNum    = USHRT_MAX;
 	if (0 != mapper)
 	{
-		_volumicMapper->GetScalarRange (domain);
-		vtkScalarsToColors* lut = _volumicMapper->GetLookupTable ( );
+		mapper->GetScalarRange (domain);
+		vtkScalarsToColors* lut = mapper->GetLookupTable ( );
 		if (0 != lut)
 		{
 			colorNum    = lut->GetNumberOfAvailableColors ( );
@@ -146,6 +151,11 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createSurfacicRepresentation (
 
 void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation ( )
 {
+	// Rem : _volumicGrid restant nul, on est appelé à chaque actualisation de
+	// la représentation.
+	if (0 != _rectilinearGrid)
+		return;
+
 	createVolumicRepresentation (getStructuredMeshEntity ( ).getMesh ( ));
 }	// VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation
 
@@ -159,21 +169,15 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 	}   // if (0 == getRenderingManager ( ))
 
 	const double	threshold	= getRenderingManager ( )->getStructuredDataThresholdValue ( );
-	if ((0 != _volumicGrid) || (0 != _volumicMapper) || (0 != _volumicActor))
+	if ((0 != _rectilinearGrid) || (0 != _volumicGrid) || (0 != _volumicMapper) || (0 != _volumicActor))
 	{
 		INTERNAL_ERROR (exc, "Représentation déjà créée.",
                "VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation")
 		throw exc;
-	}	// if ((0 != _volumicGrid) || ...
+	}	// if ((0 != _rectilinearGrid) || ...
 
-	_volumicGrid	= vtkUnstructuredGrid::New ( );
-	_volumicMapper	= vtkDataSetMapper::New ( );
-#ifndef VTK_5
-	_volumicMapper->SetInputData (_volumicGrid);
-#else	// VTK_5
-	_volumicMapper->SetInput (_volumicGrid);
-#endif	// VTK_5
-//	_volumicMapper->ScalarVisibilityOff ( );
+	_rectilinearGrid	= vtkRectilinearGrid::New ( );
+	_volumicMapper		= vtkDataSetMapper::New ( );
 #if	VTK_MAJOR_VERSION < 8
 	_volumicMapper->SetImmediateModeRendering (!Internal::Resources::instance ( )._useDisplayList);
 #endif	// VTK_MAJOR_VERSION < 8
@@ -192,105 +196,81 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 	CHECK_NULL_PTR_ERROR (densities)
 	// Dans cette version on impose l'affichage des densités pour valeurs aux mailles :
 	getEntity ( )->getDisplayProperties ( ).setValueName ("densities");
-	const DisplayProperties&	properties  = getEntity ( )->getDisplayProperties ( );
-	const Color&	volumicColor   = properties.getVolumicColor ( );
-//	_volumicActor->GetProperty ( )->SetColor (volumicColor.getRed ( ), volumicColor.getGreen ( ), volumicColor.getBlue ( ));
 	_volumicActor->SetMapper (_volumicMapper);
-	CHECK_NULL_PTR_ERROR (_volumicGrid)
-	vtkPoints*  points  = vtkPoints::New ( );
-	CHECK_NULL_PTR_ERROR (points)
-	_volumicGrid->Initialize ( );
 
+	// La grille : seuls les tableaux de coordonnées sont stockés, en float.
+	// Rem : les abscisses sont selon i, les ordonnées selon j, les élévations
+	// selon k, comme dans la version précédente qui explicitait les sommets.
 	const int	ni	= mesh.ni ( ), nj	= mesh.nj ( ), nk	= mesh.nk ( );
-	const size_t	pointsNum	= (ni+1) * (nj+1) * (nk+1);
-	const size_t	cellsNum	= mesh.cellNum ( );
-	// Les sommets :
-	points->SetDataTypeToDouble ( );
-	points->Allocate ((ni+1) * (nj+1) * (nk+1));
+	const vtkIdType	cellsNum	= (vtkIdType)ni * nj * nk;
+	vtkFloatArray*	xCoords	= vtkFloatArray::New ( );
+	vtkFloatArray*	yCoords	= vtkFloatArray::New ( );
+	vtkFloatArray*	zCoords	= vtkFloatArray::New ( );
+	xCoords->SetNumberOfValues (ni + 1);
+	yCoords->SetNumberOfValues (nj + 1);
+	zCoords->SetNumberOfValues (nk + 1);
 	for (int i = 0; i <= ni; i++)
-	{
-		const vtkIdType iOffset = i * (nj + 1) * (nk + 1);
-		for (int j = 0; j <= nj; j++)
-		{
-			const vtkIdType jOffset = j * (nk + 1);
-			for (int k = 0; k <= nk; k++)
-			{
-				const vtkIdType offset  = iOffset + jOffset + k;
-				// Warum : inverser i et k (issu des tests préliminaires à intégration dans Mgx3D)
-				const double    coords [3]  = { abs [i], ord [j], ele [k] };
-//const double    coords [3]  = { abs [k], ord [j], ele [i] };
-				points->InsertPoint (offset, coords);
-			}	// for (int k = 0; i <= nk; k++)
-		}	// for (int j = 0; j <= nj; j++)
-	}	// for (int i = 0; i <= ni; i++)
-	_volumicGrid->SetPoints (points);
-	points->Delete ( );		points		= 0;
-
-	vtkCellArray*	cellArray	= vtkCellArray::New ( );
-	vtkIdTypeArray*	idArray		= vtkIdTypeArray::New ( );
-	idArray->Allocate (9 * (ni * nj * nk), ni * nj * nk);
-	vtkIdType*	cellsPtr	= idArray->GetPointer (0);
-	int*		cellTypes	= new int [ni * nj * nk];
-	size_t		c		= 0;
-	for (int i = 0; i < ni; i++)
-	{
-		const vtkIdType iOffset		= i * (nj + 1) * (nk + 1);
-		const vtkIdType ip1Offset	= (i + 1) * (nj + 1) * (nk + 1);
-		for (int j = 0; j < nj; j++)
-		{
-			const vtkIdType jOffset		= j * (nk + 1);
-			const vtkIdType jp1Offset	= (j + 1) * (nk + 1);
-			for (int k = 0; k < nk; k++)
-			{
-				const int	id	= k * nj * ni + j * ni + i;
-				if (densities [id] < threshold)
-					continue;
-
-				*cellsPtr++ = 8;    // Hexahedron
-				*cellsPtr++ = iOffset + jOffset + k;
-				*cellsPtr++ = ip1Offset + jOffset + k;
-				*cellsPtr++ = ip1Offset + jp1Offset + k;
-				*cellsPtr++ = iOffset + jp1Offset + k;
-				*cellsPtr++ = iOffset + jOffset + k + 1;
-				*cellsPtr++ = ip1Offset + jOffset + k + 1;
-				*cellsPtr++ = ip1Offset + jp1Offset + k + 1;
-				*cellsPtr++ = iOffset + jp1Offset + k + 1;
-				cellTypes [c++] = VTK_HEXAHEDRON;
-			}	// for (int k = 0; k < nk; k++)
-		}	// for (int j = 0; j < nj; j++)
-	}	// for (int i = 0; i <= ni; i++)
-
-	idArray->SetNumberOfValues (9 * c);
-	cellArray->SetCells (c, idArray);
-	cellArray->Squeeze ( );
-	_volumicGrid->SetCells (cellTypes, cellArray);
-	delete [] cellTypes;	cellTypes	= 0;
-	cellArray->Delete ( );	cellArray	= 0;
-	idArray->Delete ( );	idArray		= 0;
-
-	// Les valeurs aux mailles :
-	vtkSmartPointer<vtkDoubleArray> vdensities  = vtkDoubleArray::New ( );
+		xCoords->SetValue (i, abs [i]);
+	for (int j = 0; j <= nj; j++)
+		yCoords->SetValue (j, ord [j]);
+	for (int k = 0; k <= nk; k++)
+		zCoords->SetValue (k, ele [k]);
+	_rectilinearGrid->SetDimensions (ni + 1, nj + 1, nk + 1);
+	_rectilinearGrid->SetXCoordinates (xCoords);
+	_rectilinearGrid->SetYCoordinates (yCoords);
+	_rectilinearGrid->SetZCoordinates (zCoords);
+	xCoords->Delete ( );	xCoords	= 0;
+	yCoords->Delete ( );	yCoords	= 0;
+	zCoords->Delete ( );	zCoords	= 0;
+
+	// Les valeurs aux mailles. La numérotation des mailles VTK
+	// (i + j * ni + k * ni * nj) est celle des densités, on recopie le
+	// tableau tel quel :
+	vtkSmartPointer<vtkFloatArray>	vdensities  = vtkSmartPointer<vtkFloatArray>::New ( );
 	vdensities->SetName ("densities");
-	vdensities->SetNumberOfValues (ni * nj * nk);
-	c		= 0;
-	int	n	= 0;
-	for (int i = 0; i < ni; i++)
+	vdensities->SetNumberOfValues (cellsNum);
+	memcpy (vdensities->GetPointer (0), densities, cellsNum * sizeof (float));
+	_rectilinearGrid->GetCellData ( )->AddArray (vdensities);
+	_rectilinearGrid->GetCellData ( )->SetActiveAttribute ("densities", vtkDataSetAttributes::SCALARS);
+
+	// Les mailles de densité inférieure au seuil ne sont pas représentées :
+	vtkIdType	visibleNum	= 0;
+#if VTK_MAJOR_VERSION >= 7
+	vtkSmartPointer<vtkUnsignedCharArray>	ghosts	= vtkSmartPointer<vtkUnsignedCharArray>::New ( );
+	ghosts->SetName (vtkDataSetAttributes::GhostArrayName ( ));
+	ghosts->SetNumberOfValues (cellsNum);
+	unsigned char*	ghostsPtr	= ghosts->GetPointer (0);
+	for (vtkIdType c = 0; c < cellsNum; c++)
 	{
-		for (int j = 0; j < nj; j++)
-		{
-			for (int k = 0; k < nk; k++, n++)
-			{
-				const int	    id	= k * nj * ni + j * ni + i;
-				const double	d	= densities [id];
-				if (d < threshold)
-					continue;
-	
-				vdensities->SetValue (c++, d);
-			}	// for (int k = 0; k < nk; k++, n++)
-		}	// for (int j = 0; j < nj; j++)
-	}	// for (int i = 0; i < ni; i++)
-
-	if (0 == c)
+		const bool	hidden	= densities [c] < threshold;
+		ghostsPtr [c]	= true == hidden ? vtkDataSetAttributes::HIDDENCELL : 0;
+		if (false == hidden)
+			visibleNum++;
+	}	// for (vtkIdType c = 0; c < cellsNum; c++)
+	_rectilinearGrid->GetCellData ( )->AddArray (ghosts);
+#ifndef VTK_5
+	_volumicMapper->SetInputData (_rectilinearGrid);
+#else	// VTK_5
+	_volumicMapper->SetInput (_rectilinearGrid);
+#endif	// VTK_5
+#else	// VTK_MAJOR_VERSION >= 7
+	// Pas de masquage de mailles, on passe par un filtre de seuillage :
+	for (vtkIdType c = 0; c < cellsNum; c++)
+		if (densities [c] >= threshold)
+			visibleNum++;
+	vtkThreshold*	thresholdFilter	= vtkThreshold::New ( );
+#ifndef VTK_5
+	thresholdFilter->SetInputData (_rectilinearGrid);
+#else	// VTK_5
+	thresholdFilter->SetInput (_rectilinearGrid);
+#endif	// VTK_5
+	thresholdFilter->SetInputArrayToProcess (0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "densities");
+	thresholdFilter->ThresholdByUpper (threshold);
+	_volumicMapper->SetInputConnection (thresholdFilter->GetOutputPort ( ));
+	thresholdFilter->Delete ( );	thresholdFilter	= 0;
+#endif	// VTK_MAJOR_VERSION >= 7
+
+	if (0 == visibleNum)
 	{
 		_volumicActor->SetMapper (0);
 #ifndef VTK_5
@@ -299,10 +279,6 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 		_volumicMapper->SetInput (0);
 #endif	// VTK_5
 	}
-	vdensities->SetNumberOfValues (c);
-	vdensities->Squeeze ( );
-	_volumicGrid->GetCellData ( )->AddArray (vdensities);
-	_volumicGrid->GetCellData ( )->SetActiveAttribute ("densities", vtkDataSetAttributes::SCALARS);
 	_volumicMapper->SetScalarModeToUseCellData ( );
 	_volumicMapper->ScalarVisibilityOn ( );
 	_volumicMapper->SetColorModeToMapScalars ( );
@@ -347,6 +323,19 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createAssociationVectorRepresen
 }	// VTKMgx3DStructuredMeshEntityRepresentation::createAssociationVectorRepresentation
 
 
+void VTKMgx3DStructuredMeshEntityRepresentation::destroyRepresentations (bool realyDestroy)
+{
+	VTKMgx3DEntityRepresentation::destroyRepresentations (realyDestroy);
+
+	if (true == realyDestroy)
+	{
+		if (0 != _rectilinearGrid)
+			_rectilinearGrid->Delete ( );
+		_rectilinearGrid	= 0;
+	}	// if (true == realyDestroy)
+}	// VTKMgx3DStructuredMeshEntityRepresentation::destroyRepresentations
+
+
 bool VTKMgx3DStructuredMeshEntityRepresentation::getRefinedRepresentation (
 	vector<Math::Point>& points, vector<size_t>& triangles, size_t factor)
 {
@@ -305,6 +305,40 @@ void VTKMgx3DTopoEntityRepresentation::createWireRepresentation ( )
 }	// VTKMgx3DTopoEntityRepresentation::createWireRepresentation
 
 
+unsigned long VTKMgx3DTopoEntityRepresentation::getBatchableRepresentationMask ( ) const
+{
+	return CLOUDS | CURVES | SURFACES;
+}	// VTKMgx3DTopoEntityRepresentation::getBatchableRepresentationMask
+
+
+bool VTKMgx3DTopoEntityRepresentation::getBatchedRepresentation (
+		unsigned long rep, vector<Math::Point>& points, vector<size_t>& cells)
+{
+	CHECK_NULL_PTR_ERROR (getEntity ( ))
+	DisplayRepresentation::type	t	= DisplayRepresentation::WIRE;
+	if (CURVES == rep)
+		t	= (DisplayRepresentation::type)(DisplayRepresentation::WIRE|DisplayRepresentation::MINIMUMWIRE);
+	else if (SURFACES == rep)
+		t	= DisplayRepresentation::SOLID;
+	else if (CLOUDS != rep)
+		return false;
+
+	TopoDisplayRepresentation	tr (t);
+	const DisplayProperties		props	= getDisplayPropertiesAttributes ( );
+	tr.setShrink (props.getShrinkFactor ( ));
+	getEntity ( )->getRepresentation (tr, true);
+	points	= tr.getPoints ( );
+	if (CURVES == rep)
+		cells	= tr.getCurveDiscretization ( );
+	else if (SURFACES == rep)
+		cells	= tr.getSurfaceDiscretization ( );
+	else
+		cells.clear ( );
+
+	return true;
+}	// VTKMgx3DTopoEntityRepresentation::getBatchedRepresentation
+
+
 void VTKMgx3DTopoEntityRepresentation::createMeshShapeCloudRepresentation ( )
 {
 	if ((0 != _cloudGrid) || (0 != _cloudMapper) || (0 != _cloudActor))
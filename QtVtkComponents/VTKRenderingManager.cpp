@@ -662,7 +662,9 @@ VTKRenderingManager::VTKRenderingManager (QtVtkGraphicWidget* vtkWidget, bool of
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _trihedronRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ),
+	  _batchedRendering (Resources::instance ( )._batchedRendering.getValue ( )),
+	  _entityBatches ( )
 {
 	// ==========================================================================================================
 	// IMPORTANT : Si backend OpenGL2 pas de Render prématuré car plante dans la phase d'initialisation 
@@ -759,7 +761,9 @@ VTKRenderingManager::VTKRenderingManager ( )
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _trihedronRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ),
+	  _batchedRendering (false),
+	  _entityBatches ( )
 {
 }	// VTKRenderingManager::VTKRenderingManager
 
@@ -773,7 +777,9 @@ VTKRenderingManager::VTKRenderingManager (const VTKRenderingManager&)
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _trihedronRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ),
+	  _batchedRendering (false),
+	  _entityBatches ( )
 {
 	MGX_FORBIDDEN ("VTKRenderingManager copy constructor is not allowed.");
 }	// VTKRenderingManager::VTKRenderingManager (const VTKRenderingManager&)
@@ -793,6 +799,15 @@ VTKRenderingManager::~VTKRenderingManager ( )
 	while (false == _colorTables.empty ( ))
 		removeColorTable (_colorTables [0]);
 
+	for (map<pair<int, int>, VTKMgx3DEntityBatch*>::iterator itb =
+			_entityBatches.begin ( ); _entityBatches.end ( ) != itb; itb++)
+	{
+		if (true == hasRenderer ( ))
+			getRenderer ( ).RemoveViewProp (&itb->second->getActor ( ));
+		delete itb->second;
+	}	// for (map<pair<int, int>, VTKMgx3DEntityBatch*>::iterator itb = ...
+	_entityBatches.clear ( );
+
 	if (0 != _magix3dPicker)
 	{
 		if (0 != _pickerCommandTag)
@@ -879,6 +894,12 @@ vector<Entity*> VTKRenderingManager::getDisplayedEntities ( )
 		// entity == 0 lors du paramétrage de la discrétisation des arêtes).
 		if ((0 != mgxActor) && (0 != mgxActor->GetEntity ( )))
 			entities.insert (mgxActor->GetEntity ( ));
+		else if ((0 != mgxActor) && (0 != mgxActor->GetBatch ( )))
+		{	// Affichage par lots :
+			const vector<Entity*>	batched	=
+									mgxActor->GetBatch ( )->getEntities ( );
+			entities.insert (batched.begin ( ), batched.end ( ));
+		}	// else if ((0 != mgxActor) && (0 != mgxActor->GetBatch ( )))
 	}	// for (actors->InitTraversal ( ); ...
 
 	vector<Entity*>	uniqueEntities;
@@ -973,6 +994,52 @@ void VTKRenderingManager::useGlobalDisplayProperties (bool global)
 }	// VTKRenderingManager::useGlobalDisplayProperties
 
 
+bool VTKRenderingManager::useBatchedRendering ( ) const
+{
+	return _batchedRendering;
+}	// VTKRenderingManager::useBatchedRendering
+
+
+void VTKRenderingManager::useBatchedRendering (bool batched)
+{
+	if (batched == _batchedRendering)
+		return;
+
+	vector<Entity*>	entities	= getDisplayedEntities ( );
+	_batchedRendering	= batched;
+	for (vector<Entity*>::iterator it = entities.begin ( );
+	     entities.end ( ) !=it; it++)
+	{
+		DisplayProperties::GraphicalRepresentation*	rep	=
+				(*it)->getDisplayProperties ( ).getGraphicalRepresentation ( );
+		if (0 != rep)
+			rep->updateRepresentation (rep->getRepresentationMask ( ), true);
+	}	// for (vector<Entity*>::iterator it = entities.begin ( ); ...
+}	// VTKRenderingManager::useBatchedRendering
+
+
+VTKMgx3DEntityBatch& VTKRenderingManager::getEntityBatch (
+					Entity::objectType type, VTKMgx3DEntityBatch::CELL_KIND kind)
+{
+	const pair<int, int>	key ((int)type, (int)kind);
+	map<pair<int, int>, VTKMgx3DEntityBatch*>::iterator	itb	=
+													_entityBatches.find (key);
+	if (_entityBatches.end ( ) != itb)
+		return *(itb->second);
+
+	VTKMgx3DEntityBatch*	batch	= new VTKMgx3DEntityBatch (kind);
+	CHECK_NULL_PTR_ERROR (batch)
+	_entityBatches.insert (
+			pair<pair<int, int>, VTKMgx3DEntityBatch*>(key, batch));
+	// Le lot est sélectionnable, les entités pointées étant filtrées
+	// ultérieurement par le gestionnaire de sélection :
+	batch->getActor ( ).PickableOn ( );
+	getRenderer ( ).AddViewProp (&batch->getActor ( ));
+
+	return *batch;
+}	// VTKRenderingManager::getEntityBatch
+
+
 void VTKRenderingManager::displayRepresentation (RepresentationID id, bool show)
 {
 	vtkActor*	actor	= (vtkActor*)id;
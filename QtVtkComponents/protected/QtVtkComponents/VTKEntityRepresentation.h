@@ -231,6 +231,25 @@ class VTKEntityRepresentation :
 		std::vector<Utils::Math::Point>& points, std::vector<size_t>& discretization,
 		size_t factor) {return false;}
 
+	/**
+	 * \return	La partie du masque de représentation transmis en argument
+	 *			prise en charge par un lot de représentations (affichage par
+	 *			lots, cf. <I>VTKMgx3DEntityBatch</I>) et pour laquelle aucun
+	 *			acteur propre à l'entité n'est créé. Retourne 0 par défaut.
+	 * \see		updateBatchedRepresentation
+	 */
+	virtual unsigned long getBatchedRepresentationMask (
+											unsigned long usedMask) const
+	{ return 0; }
+
+	/**
+	 * Actualise la représentation de l'entité dans les lots de
+	 * représentations selon le masque transmis en argument (obtenu par
+	 * <I>getBatchedRepresentationMask</I>). Ne fait rien par défaut.
+	 */
+	virtual void updateBatchedRepresentation (unsigned long batchedMask)
+	{ }
+
 	/**
 	 * Détruit la "représentation raffinée".
 	 * \see createRefinedRepresentation
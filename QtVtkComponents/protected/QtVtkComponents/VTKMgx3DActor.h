@@ -17,6 +17,11 @@ namespace Utils
 	class Entity;
 }	// namespace Utils
 
+namespace QtVtkComponents
+{
+	class VTKMgx3DEntityBatch;
+}	// namespace QtVtkComponents
+
 }	// namespace Mgx3D
 
 
@@ -58,6 +63,33 @@ class VTKMgx3DActor : public vtkLODActor
 	 */
 	virtual void SetEntity (Mgx3D::Utils::Entity* entity);
 
+	/**
+	 * \return		L'éventuel lot d'entités représenté par l'acteur (mode
+	 *				d'affichage par lots). En pareil cas <I>GetEntity</I>
+	 *				retourne 0, l'entité pointée s'obtient à partir de la
+	 *				maille pointée.
+	 * \see			SetBatch
+	 * \see			Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch::getEntity
+	 */
+	virtual Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* GetBatch ( );
+	virtual const Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* GetBatch ( ) const;
+
+	/**
+	 * \param		Le lot d'entités représenté par l'acteur.
+	 * \see			GetBatch
+	 */
+	virtual void SetBatch (Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch* batch);
+
+	/**
+	 * \return		L'entité pointée via cet acteur : l'entité associée, ou,
+	 *				pour un acteur de lot, l'entité représentée par la
+	 *				dernière maille pointée.
+	 * \see			GetEntity
+	 * \see			Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch::getPickedEntity
+	 */
+	virtual Mgx3D::Utils::Entity* GetPickedEntity ( );
+	virtual const Mgx3D::Utils::Entity* GetPickedEntity ( ) const;
+
 	/**
 	 * \param		Le type de représentation portée par l'acteur.
 	 * \see			GetRepresentationType
@@ -109,6 +141,9 @@ class VTKMgx3DActor : public vtkLODActor
 	/** L'entité Magix 3D associée.  */
 	Mgx3D::Utils::Entity*						_entity;
 
+	/** L'éventuel lot d'entités représenté. */
+	Mgx3D::QtVtkComponents::VTKMgx3DEntityBatch*	_batch;
+
 	/** Le type de représentation de l'acteur. */
 	Mgx3D::Utils::DisplayRepresentation::type	_representationType;
 };	// class VTKMgx3DActor
@@ -0,0 +1,241 @@
+/**
+ * \file		VTKMgx3DEntityBatch.h
+ * \author		Team Magix3D
+ * \date		19/10/2026
+ */
+#ifndef VTK_MGX3D_ENTITY_BATCH_H
+#define VTK_MGX3D_ENTITY_BATCH_H
+
+#include "QtVtkComponents/VTKMgx3DActor.h"
+
+#include <Utils/Entity.h>
+#include <Utils/Point.h>
+#include <TkUtil/Color.h>
+
+#include <vtkIdTypeArray.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <map>
+#include <vector>
+
+
+namespace Mgx3D
+{
+
+namespace QtVtkComponents
+{
+
+/**
+ * \brief		<P>Lot de représentations graphiques <I>VTK</I> d'entités
+ *				<I>Magix 3D</I> d'un même type (ex : arêtes communes
+ *				topologiques) et d'une même nature (nuage, filaire,
+ *				surfacique).</P>
+ *
+ * <P>L'ensemble des entités du lot est représenté par une unique
+ * <I>vtkPolyData</I>, un unique <I>mapper</I> et un unique acteur, ce qui
+ * ramène à un appel de tracé le rendu de plusieurs dizaines de milliers
+ * d'entités. Chaque maille porte l'identifiant unique de l'entité qu'elle
+ * représente (tableau <I>entityIds</I>) et sa couleur (tableau
+ * <I>colors</I>), ce qui permet de gérer couleurs, sélection, mise en
+ * évidence et pointage entité par entité.
+ * </P>
+ *
+ * <P>Le lot est mis à jour de manière incrémentale : un ajout concatène
+ * les points et mailles de l'entité, une suppression masque ses mailles
+ * (mailles fantômes <I>HIDDENCELL</I>). Les mailles masquées sont
+ * effectivement supprimées lorsqu'elles deviennent majoritaires
+ * (compactage). Avant <I>VTK 9</I>, faute de mailles fantômes, le
+ * compactage est différé jusqu'au prochain tracé (<I>prepareRender</I>),
+ * une suppression en masse ne donne ainsi lieu qu'à un compactage.
+ * </P>
+ */
+class VTKMgx3DEntityBatch
+{
+	public :
+
+	/**
+	 * Nature des mailles du lot.
+	 */
+	enum CELL_KIND { VERTICES = 1, LINES = 2, TRIANGLES = 3 };
+
+	/**
+	 * \param		Nature des mailles du lot.
+	 */
+	VTKMgx3DEntityBatch (CELL_KIND kind);
+
+	/**
+	 * Destructeur. RAS.
+	 */
+	virtual ~VTKMgx3DEntityBatch ( );
+
+	/**
+	 * \return		La nature des mailles du lot.
+	 */
+	virtual CELL_KIND getCellKind ( ) const
+	{ return _kind; }
+
+	/**
+	 * Ajoute (ou remplace) la représentation de l'entité transmise en
+	 * argument.
+	 * \param		Entité représentée
+	 * \param		Points de la représentation
+	 * \param		Indices des points des mailles de la représentation
+	 *				(<I>getCellKind ( )</I> indices par maille). Ignoré pour
+	 *				un lot de type <I>VERTICES</I>, chaque point étant alors
+	 *				une maille.
+	 * \param		Couleur de l'entité.
+	 * \see			removeEntity
+	 */
+	virtual void addEntity (
+				Mgx3D::Utils::Entity& entity,
+				const std::vector<Mgx3D::Utils::Math::Point>& points,
+				const std::vector<size_t>& cells, const TkUtil::Color& color);
+
+	/**
+	 * Enlève la représentation de l'entité transmise en argument. Ne fait
+	 * rien si l'entité n'est pas dans le lot.
+	 * \see			addEntity
+	 */
+	virtual void removeEntity (const Mgx3D::Utils::Entity& entity);
+
+	/**
+	 * \return		<I>true</I> si l'entité transmise en argument est
+	 *				représentée dans le lot, <I>false</I> dans le cas contraire.
+	 */
+	virtual bool hasEntity (const Mgx3D::Utils::Entity& entity) const;
+
+	/**
+	 * \return		Le nombre d'entités représentées dans le lot.
+	 */
+	virtual size_t getEntitiesNum ( ) const
+	{ return _slots.size ( ); }
+
+	/**
+	 * \return		Les entités représentées dans le lot.
+	 */
+	virtual std::vector<Mgx3D::Utils::Entity*> getEntities ( ) const;
+
+	/**
+	 * Actualise la couleur des mailles de l'entité transmise en argument.
+	 */
+	virtual void setEntityColor (
+			const Mgx3D::Utils::Entity& entity, const TkUtil::Color& color);
+
+	/**
+	 * \return		L'entité représentée par la maille dont l'indice est
+	 *				transmis en argument, ou 0 si aucune (maille masquée,
+	 *				indice invalide).
+	 */
+	virtual Mgx3D::Utils::Entity* getEntity (vtkIdType cellId) const;
+
+	/**
+	 * Mémorise l'entité représentée par la maille pointée, ce qui permet
+	 * aux services de sélection, qui ne connaissent que l'acteur pointé,
+	 * de retrouver l'entité.
+	 * \param		Indice de la maille pointée, ou -1.
+	 * \see			getPickedEntity
+	 */
+	virtual void setPickedCell (vtkIdType cellId);
+
+	/**
+	 * \return		L'entité représentée par la dernière maille pointée, ou 0.
+	 * \see			setPickedCell
+	 */
+	virtual Mgx3D::Utils::Entity* getPickedEntity ( ) const
+	{ return _pickedEntity; }
+
+	/**
+	 * Appelé avant le tracé du lot. Compacte le lot s'il reste des mailles
+	 * masquées qui seraient représentées (absence de mailles fantômes).
+	 */
+	virtual void prepareRender ( );
+
+	/**
+	 * Supprime effectivement les mailles masquées et renumérote points et
+	 * mailles. Appelé automatiquement lorsque les mailles masquées sont
+	 * majoritaires.
+	 */
+	virtual void compact ( );
+
+	/**
+	 * Les ressources <I>VTK</I>.
+	 */
+	//@{
+	virtual VTKMgx3DActor& getActor ( );
+	virtual vtkPolyDataMapper& getMapper ( );
+	virtual vtkPolyData& getPolyData ( );
+	//@}
+
+	/** Le nom du tableau (aux mailles) des identifiants uniques des
+	 * entités représentées. */
+	static const std::string	entityIdsFieldName;
+
+	/** Le nom du tableau (aux mailles) des couleurs des entités
+	 * représentées. */
+	static const std::string	colorsFieldName;
+
+
+	private :
+
+	/**
+	 * Constructeur de copie et opérateur = : interdits.
+	 */
+	VTKMgx3DEntityBatch (const VTKMgx3DEntityBatch&);
+	VTKMgx3DEntityBatch& operator = (const VTKMgx3DEntityBatch&);
+
+	/**
+	 * Reconstruit les cellules <I>VTK</I> à partir de <I>_connectivity</I>.
+	 */
+	virtual void rebuildCells ( );
+
+	/**
+	 * Emplacement d'une entité dans le lot : intervalle de points et de
+	 * mailles qui lui sont réservés.
+	 */
+	struct Slot
+	{
+		Slot ( )
+			: entity (0), firstPoint (0), pointsNum (0),
+			  firstCell (0), cellsNum (0)
+		{ }
+		Mgx3D::Utils::Entity*	entity;
+		vtkIdType				firstPoint, pointsNum, firstCell, cellsNum;
+	};	// struct Slot
+
+	/** La nature des mailles. */
+	CELL_KIND								_kind;
+
+	/** Les emplacements des entités représentées. */
+	std::map<const Mgx3D::Utils::Entity*, Slot>	_slots;
+
+	/** L'entité représentée par chaque maille (0 si masquée). */
+	std::vector<Mgx3D::Utils::Entity*>		_cellEntities;
+
+	/** Copie de la connectivité (<I>_kind</I> indices par maille), permet
+	 * le compactage. */
+	std::vector<vtkIdType>					_connectivity;
+
+	/** Le nombre de mailles masquées. */
+	size_t									_hiddenCellsNum;
+
+	/** L'entité représentée par la dernière maille pointée. */
+	Mgx3D::Utils::Entity*					_pickedEntity;
+
+	/** Les ressources <I>VTK</I>. */
+	vtkPolyData*							_polyData;
+	vtkPoints*								_points;
+	vtkIdTypeArray*							_entityIds;
+	vtkUnsignedCharArray*					_colors;
+	vtkUnsignedCharArray*					_ghosts;
+	vtkPolyDataMapper*						_mapper;
+	VTKMgx3DActor*							_actor;
+};	// class VTKMgx3DEntityBatch
+
+
+}	// namespace QtVtkComponents
+
+}	// namespace Mgx3D
+
+#endif	// VTK_MGX3D_ENTITY_BATCH_H
@@ -23,6 +23,8 @@ namespace Mgx3D
 namespace QtVtkComponents
 {
 
+class VTKMgx3DEntityBatch;
+
 /**
  * \brief		Classe <I>représentant graphique d'entité</I> spécialisée pour
  *				un affichage 3D reposant sur <I>VTK</I> d'entité <I>Magix 3D</I>
@@ -147,6 +149,63 @@ class VTKMgx3DEntityRepresentation :
 	 */
 	virtual void createRefinedRepresentation (size_t factor);
 
+	/**
+	 * L'affichage par lots (cf. <I>VTKMgx3DEntityBatch</I>).
+	 */
+	//@{
+
+	/**
+	 * \return	La partie de <I>usedMask</I> prise en charge par les lots de
+	 *			représentations du gestionnaire de rendu : nuage, filaire
+	 *			et surfacique si le gestionnaire est en mode d'affichage par
+	 *			lots, que la représentation n'est pas projetée sur la
+	 *			modélisation et ne porte pas de valeurs aux noeuds/mailles.
+	 * \see		getBatchableRepresentationMask
+	 */
+	virtual unsigned long getBatchedRepresentationMask (
+											unsigned long usedMask) const;
+
+	/**
+	 * Ajoute l'entité aux lots de représentations correspondant au masque
+	 * transmis en argument et l'enlève des autres.
+	 * \see		getBatchedRepresentation
+	 */
+	virtual void updateBatchedRepresentation (unsigned long batchedMask);
+
+	/**
+	 * \return	Les types de représentation (CLOUDS, CURVES, SURFACES)
+	 *			que l'entité sait fournir à un lot. Retourne 0 par défaut.
+	 * \see		getBatchedRepresentation
+	 */
+	virtual unsigned long getBatchableRepresentationMask ( ) const
+	{ return 0; }
+
+	/**
+	 * En retour, les points et mailles (segments ou triangles, ignorées
+	 * pour un nuage) de la représentation de type <I>rep</I> (CLOUDS,
+	 * CURVES, SURFACES) à ajouter à un lot.
+	 * \return	<I>true</I> si la représentation a été fournie,
+	 *			<I>false</I> dans le cas contraire (défaut).
+	 */
+	virtual bool getBatchedRepresentation (
+					unsigned long rep, std::vector<Utils::Math::Point>& points,
+					std::vector<size_t>& cells)
+	{ return false; }
+
+	//@}	// L'affichage par lots
+
+	/**
+	 * Enlève l'entité des lots de représentations puis appelle la méthode
+	 * héritée.
+	 */
+	virtual void destroyRepresentations (bool realyDestroy);
+
+	/**
+	 * Actualise également les couleurs des mailles de l'entité dans les
+	 * lots de représentations (sélection, mise en évidence).
+	 */
+	virtual void updateRepresentationProperties ( );
+
 
 	private :
 
@@ -156,6 +215,16 @@ class VTKMgx3DEntityRepresentation :
 	VTKMgx3DEntityRepresentation (VTKMgx3DEntityRepresentation&);
 	VTKMgx3DEntityRepresentation& operator = (
 										const VTKMgx3DEntityRepresentation&);
+
+	/**
+	 * \return	Le lot de représentations du gestionnaire de rendu associé au
+	 *			type de représentation transmis en argument, ou 0.
+	 */
+	VTKMgx3DEntityBatch* getEntityBatch (unsigned long rep) const;
+
+	/** Les types de représentation actuellement pris en charge par des
+	 * lots. */
+	unsigned long			_batchedMask;
 };	// class VTKMgx3DEntityRepresentation
 
 
@@ -102,6 +102,20 @@ class VTKMgx3DGeomEntityRepresentation :
 		std::vector<Utils::Math::Point>& points, std::vector<size_t>& discretization,
 		size_t factor);
 
+	/**
+	 * \return	CLOUDS | CURVES | SURFACES : ces représentations peuvent être
+	 *			prises en charge par des lots.
+	 */
+	virtual unsigned long getBatchableRepresentationMask ( ) const;
+
+	/**
+	 * Les points et mailles des représentations nuage, filaire et
+	 * surfacique, obtenus comme pour les <I>create*Representation</I>.
+	 */
+	virtual bool getBatchedRepresentation (
+					unsigned long rep, std::vector<Utils::Math::Point>& points,
+					std::vector<size_t>& cells);
+
 
 	private :
 
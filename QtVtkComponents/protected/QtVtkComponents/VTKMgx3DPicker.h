@@ -21,6 +21,8 @@ namespace Mgx3D
 namespace QtVtkComponents
 {
 
+class VTKMgx3DActor;
+
 /**
  * Classe de picker <I>VTK</I> spécialisé pour le logiciel <I>Magix 3D</I>.
  *
@@ -61,6 +63,13 @@ class VTKMgx3DPicker : public VTKECMPicker
 	 * \see			GetPickedEntities
 	 */
 	virtual void CompletePicking ( );
+
+	/**
+	 * \return		L'entité représentée par la maille pointée de l'acteur de
+	 *				lot (affichage par lots) transmis en argument, ou 0.
+	 * \see			VTKMgx3DEntityBatch
+	 */
+	virtual Mgx3D::Utils::Entity* GetBatchPickedEntity (VTKMgx3DActor& actor);
 	
 	/**
 	 * Constructeur par défaut. RAS.
@@ -10,6 +10,8 @@
 
 #include <Structured/StructuredMeshEntity.h>
 
+#include <vtkRectilinearGrid.h>
+
 
 namespace Mgx3D 
 {
@@ -33,10 +35,12 @@ namespace QtVtkComponents
  * \warning	<B>Cette classe permet d'afficher des maillages structurés non issus de ||
  *		Magix3D. Ses mécanismes sont très différents de ceux des entités Magix 3D   ||
  *		types entités géométriques ou topologiques.</B>                             ||
- *		L'implémentation actuelle repose sur la classe vtkUnstructuredGrid.         ||
- *		Intérêt : on n'affiche que les mailles contenant un matériau. C'est d'autant||
- *		plus intéressant en cas de demande de transparence, opération très coûteuse ||
- *		en cas de rendu composite.                                                  ||
+ *		L'implémentation actuelle repose sur la classe vtkRectilinearGrid : seuls   ||
+ *		les tableaux de coordonnées abs/ord/elev et les densités (float) sont       ||
+ *		stockés. Les mailles de densité inférieure au seuil sont masquées           ||
+ *		(HIDDENCELL), on n'affiche ainsi que les mailles contenant un matériau.     ||
+ *		C'est d'autant plus intéressant en cas de demande de transparence,          ||
+ *		opération très coûteuse en cas de rendu composite.                          ||
  * ===========================================================================================
  */
 class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMgx3DEntityRepresentation
@@ -123,6 +127,12 @@ class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMg
 	virtual bool getRefinedRepresentation (
 		std::vector<Utils::Math::Point>& points, std::vector<size_t>& discretization, size_t factor);
 
+	/**
+	 * Détruit les représentations graphiques actuelles, dont la grille
+	 * rectilinéaire si <I>realyDestroy</I> vaut <I>true</I>.
+	 */
+	virtual void destroyRepresentations (bool realyDestroy);
+
 
 	private :
 
@@ -131,6 +141,9 @@ class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMg
 	 */
 	VTKMgx3DStructuredMeshEntityRepresentation (VTKMgx3DStructuredMeshEntityRepresentation&);
 	VTKMgx3DStructuredMeshEntityRepresentation& operator = (const VTKMgx3DStructuredMeshEntityRepresentation&);
+
+	/** La grille représentée (en lieu et place de <I>_volumicGrid</I>). */
+	vtkRectilinearGrid*			_rectilinearGrid;
 };	// class VTKMgx3DStructuredMeshEntityRepresentation
 
 
@@ -179,6 +179,20 @@ class VTKMgx3DTopoEntityRepresentation :
 		std::vector<Utils::Math::Point>& points, std::vector<size_t>& discretization,
 		size_t factor);
 
+	/**
+	 * \return	CLOUDS | CURVES | SURFACES : ces représentations peuvent être
+	 *			prises en charge par des lots.
+	 */
+	virtual unsigned long getBatchableRepresentationMask ( ) const;
+
+	/**
+	 * Les points et mailles des représentations nuage, filaire et
+	 * surfacique, obtenus comme pour les <I>create*Representation</I>.
+	 */
+	virtual bool getBatchedRepresentation (
+					unsigned long rep, std::vector<Utils::Math::Point>& points,
+					std::vector<size_t>& cells);
+
 #ifdef OLD_TOPO_ENTITY_EDGESNUM_REPRESENTATION
 	/**
 	 * Dans le cas d'une arête, créé la représentation 2D du nombre de bras de
@@ -8,6 +8,7 @@
 
 
 #include <QtVtkComponents/vtkMgx3DInteractorStyle.h>
+#include "QtVtkComponents/VTKMgx3DEntityBatch.h"
 #include "QtVtkComponents/VTKMgx3DPicker.h"
 #include "QtVtkComponents/VTKMgx3DPickerCommand.h"
 #include "QtVtkComponents/VTKMgx3DSelectionManager.h"
@@ -95,6 +96,30 @@ class VTKRenderingManager : public QtComponents::RenderingManager
 	 */
 	virtual void useGlobalDisplayProperties (bool global);
 
+	/**
+	 * \return		<I>true</I> si les entités topologiques et géométriques
+	 *				sont représentées par lots (un acteur par type d'entité),
+	 *				<I>false</I> si chaque entité a ses propres acteurs.
+	 * \see			getEntityBatch
+	 */
+	virtual bool useBatchedRendering ( ) const;
+
+	/**
+	 * Passe ou quitte le mode d'affichage par lots. Actualise les
+	 * représentations des entités affichées.
+	 */
+	virtual void useBatchedRendering (bool batched);
+
+	/**
+	 * \return		Le lot de représentations des entités du type et de la
+	 *				nature de mailles transmis en arguments. Le créé et
+	 *				l'affiche si nécessaire.
+	 * \see			useBatchedRendering
+	 */
+	virtual VTKMgx3DEntityBatch& getEntityBatch (
+						Mgx3D::Utils::Entity::objectType type,
+						VTKMgx3DEntityBatch::CELL_KIND kind);
+
 	//@}	// Les entités représentées.
 
 
@@ -991,6 +1016,11 @@ class VTKRenderingManager : public QtComponents::RenderingManager
 
 	/** Les éventuelles tables de couleur affichées. */
 	std::vector<VTKColorTable*>						_colorTables;
+
+	/** L'affichage par lots et les lots de représentations, par type
+	 * d'entité et nature de mailles. */
+	bool											_batchedRendering;
+	std::map<std::pair<int, int>, VTKMgx3DEntityBatch*>	_entityBatches;
 };	// class VTKRenderingManager
 
 
@@ -134,21 +134,17 @@ Command& Command::operator = (const Command& c)
 
 Command::~Command ( )
 {
-	UTF8String	message1 (Charset::UTF_8), message2 (Charset::UTF_8);
-	message1 << "Destruction de la commande " << getName( ) << " de nom unique "
-	         << getUniqueName ( );
-	message2	= message1;
-	message1 << " en cours.";
-	MGX_TRACE_LOG_3 (trace1, message1)
-	log (trace1);
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_3, "Destruction de la commande "
+	        << getName( ) << " de nom unique " << getUniqueName ( )
+	        << " en cours.");
 
 	delete _remoteObservers;		_remoteObservers	= 0;
 	notifyObserversForDestruction ( );
 	unregisterReferences ( );
 
-	message2 << " effectué.";
-	MGX_TRACE_LOG_3 (trace2, message2)
-	log (trace2);
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_3, "Destruction de la commande "
+	        << getName( ) << " de nom unique " << getUniqueName ( )
+	        << " effectué.");
 }	// Command::~Command
 
 
@@ -501,15 +497,13 @@ void Command::setPlayType (Command::PLAY_TYPE pt)
 {
 	AutoMutex	automutex (getCommandMutex ( ));
 
-	UTF8String	message (Charset::UTF_8);
-	message << "Changement de type de jeu de la commande " << getName ( )
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_5,
+	        "Changement de type de jeu de la commande " << getName ( )
 	        << " de nom unique " << getUniqueName ( ) << " : "
 	        << playTypeToString (getPlayType ( )) << " -> "
-	        << playTypeToString (pt) << ".";
+	        << playTypeToString (pt) << ".");
 
 	_playType	= pt;
-    MGX_TRACE_LOG_5 (trace1, message)
-	log (trace1);
 }	// Command::setPlayType
 
 
@@ -517,14 +511,10 @@ void Command::atCompletion ( )
 {
 	AutoMutex	autoMutex (&_mutex);
 
-	UTF8String	message1 (Charset::UTF_8), message2 (Charset::UTF_8);
-	message1 << "Commande " << getName ( ) << " de nom unique "
-	         << getUniqueName ( )
-	         << " terminée. Exécution des fonctions de fin de tache ";
-	message2	= message1;
-	message1 << " en cours.";
-	MGX_TRACE_LOG_3 (trace1, message1)
-	log (trace1);
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_3, "Commande " << getName ( )
+	        << " de nom unique " << getUniqueName ( )
+	        << " terminée. Exécution des fonctions de fin de tache "
+	        << " en cours.");
 
 	for (map<CommandTask, void*>::iterator it = _completionTasks.begin ( );
 	     _completionTasks.end ( ) != it; it++)
@@ -538,9 +528,10 @@ void Command::atCompletion ( )
 		COMPLETE_TRY_CATCH_BLOCK
 	}	// for (map<CommandTask, void*>::iterator it = ...
 
-	message2 << " effectuée.";
-	MGX_TRACE_LOG_3 (trace2, message2)
-	log (trace2);
+	MGX_TRACE_IF (*this, TkUtil::Log::TRACE_3, "Commande " << getName ( )
+	        << " de nom unique " << getUniqueName ( )
+	        << " terminée. Exécution des fonctions de fin de tache "
+	        << " effectuée.");
 }	// Command::atCompletion
 
 
@@ -560,6 +551,17 @@ void Command::log (const Log& l)
 }	// Command::log
 
 
+bool Command::isLogEnabled (Log::TYPE type) const
+{
+	// getLogStream est surcharg (CommandInternal : flux du contexte) mais
+	// n'est pas const, le flux n'est ici que consult.
+	const LogOutputStream*	stream	=
+						const_cast<Command*>(this)->getLogStream ( );
+
+	return (0 != stream) && (0 != (stream->getMask ( ) & type));
+}	// Command::isLogEnabled
+
+
 void Command::startingOrcompletionLog (bool beginning)
 {
 	AutoMutex	automutex (&_mutex);
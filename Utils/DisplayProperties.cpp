@@ -193,7 +193,7 @@ bool		DisplayProperties::_defaultFontBold	= false;
 bool		DisplayProperties::_defaultFontItalic	= false;
 
 
-DisplayProperties::DisplayProperties ( )
+DisplayProperties::Attributes::Attributes ( )
 	: _cloudColor (0, 0, 0), _wireColor (0, 0, 0),
 	  _solidColor (0, 0, 0),
 	  _cloudOpacity (1.), _wireOpacity (1.), _surfacicOpacity (1.),
@@ -201,24 +201,61 @@ DisplayProperties::DisplayProperties ( )
 	  _pointSize (5.), _lineWidth (2.),
 	  _fontFamily (_defaultFontFamily), _fontSize (_defaultFontSize),
 	  _bold (_defaultFontBold), _italic (_defaultFontItalic),
-	  _fontColor (0, 0, 0), _valueName ( ),
+	  _fontColor (0, 0, 0), _valueName ( ), _count (0)
+{
+}	// Attributes::Attributes
+
+
+DisplayProperties::Attributes::Attributes (const DisplayProperties::Attributes& a)
+	: _cloudColor (a._cloudColor), _wireColor (a._wireColor),
+	  _solidColor (a._solidColor),
+	  _cloudOpacity (a._cloudOpacity), _wireOpacity (a._wireOpacity),
+	  _surfacicOpacity (a._surfacicOpacity),
+	  _volumicOpacity (a._volumicOpacity),
+	  _shrinkFactor (a._shrinkFactor), _arrowComul (a._arrowComul),
+	  _pointSize (a._pointSize), _lineWidth (a._lineWidth),
+	  _fontFamily (a._fontFamily), _fontSize (a._fontSize),
+	  _bold (a._bold), _italic (a._italic),
+	  _fontColor (a._fontColor), _valueName (a._valueName), _count (0)
+{
+}	// Attributes::Attributes
+
+
+DisplayProperties::Attributes& DisplayProperties::Attributes::operator = (const DisplayProperties::Attributes&)
+{
+	MGX_FORBIDDEN ("DisplayProperties::Attributes::operator = is not allowed.");
+	return *this;
+}	// Attributes::operator =
+
+
+bool DisplayProperties::Attributes::operator == (const DisplayProperties::Attributes& a) const
+{
+	return (_cloudColor == a._cloudColor) && (_wireColor == a._wireColor) &&
+	       (_solidColor == a._solidColor) &&
+	       (_cloudOpacity == a._cloudOpacity) &&
+	       (_wireOpacity == a._wireOpacity) &&
+	       (_surfacicOpacity == a._surfacicOpacity) &&
+	       (_volumicOpacity == a._volumicOpacity) &&
+	       (_shrinkFactor == a._shrinkFactor) &&
+	       (_arrowComul == a._arrowComul) &&
+	       (_pointSize == a._pointSize) && (_lineWidth == a._lineWidth) &&
+	       (_fontFamily == a._fontFamily) && (_fontSize == a._fontSize) &&
+	       (_bold == a._bold) && (_italic == a._italic) &&
+	       (_fontColor == a._fontColor) && (_valueName == a._valueName);
+}	// Attributes::operator ==
+
+
+DisplayProperties::DisplayProperties ( )
+	: _attributes (0),
 	  _displayed (false), _graphicalRepresentation (0),
 	  _displayable(true), _views ( )
 {
+	attach (new Attributes ( ));
 }	// DisplayProperties::DisplayProperties
 
 
 DisplayProperties::DisplayProperties (const DisplayProperties& dp)
-	: _cloudColor (dp._cloudColor), _wireColor (dp._wireColor),
-	  _solidColor (dp._solidColor),
-	  _cloudOpacity (dp._cloudOpacity), _wireOpacity (dp._wireOpacity),
-	  _surfacicOpacity (dp._surfacicOpacity),
-	  _volumicOpacity (dp._volumicOpacity),
-	  _shrinkFactor (dp._shrinkFactor), _arrowComul (dp._arrowComul),
-	  _pointSize (dp._pointSize), _lineWidth (dp._lineWidth),
-	  _fontFamily (dp._fontFamily), _fontSize (dp._fontSize),
-	  _bold (dp._bold), _italic (dp._italic),
-	  _fontColor (dp._fontColor), _valueName (dp._valueName),
+	: _attributes (0),
 	  _displayed (dp._displayed),
 // ---------------------------------------------------------------------------
 // IMPORTANT
@@ -231,6 +268,7 @@ DisplayProperties::DisplayProperties (const DisplayProperties& dp)
 	  _graphicalRepresentation (0),
       _displayable(dp._displayable), _views (dp._views)
 {
+	attach (dp._attributes);
 }	// DisplayProperties::DisplayProperties
 
 
@@ -238,23 +276,7 @@ DisplayProperties& DisplayProperties::operator = (const DisplayProperties& dp)
 {
 	if (&dp != this)
 	{
-		_cloudColor				= dp._cloudColor;
-		_wireColor				= dp._wireColor;
-		_solidColor				= dp._solidColor;
-		_cloudOpacity				= dp._cloudOpacity;
-		_wireOpacity				= dp._wireOpacity;
-		_surfacicOpacity			= dp._surfacicOpacity;
-		_volumicOpacity				= dp._volumicOpacity;
-		_shrinkFactor				= dp._shrinkFactor;
-		_arrowComul				= dp._arrowComul;
-		_pointSize				= dp._pointSize;
-		_lineWidth				= dp._lineWidth;
-		_fontFamily				= dp._fontFamily;
-		_fontSize				= dp._fontSize;
-		_bold					= dp._bold;
-		_italic					= dp._italic;
-		_fontColor				= dp._fontColor;
-		_valueName				= dp._valueName;
+		attach (dp._attributes);
 		_displayed      			= dp._displayed;
 // ---------------------------------------------------------------------------
 // IMPORTANT
@@ -276,14 +298,67 @@ DisplayProperties& DisplayProperties::operator = (const DisplayProperties& dp)
 DisplayProperties::~DisplayProperties ( )
 {
 	delete _graphicalRepresentation;	_graphicalRepresentation = 0;
+	detach ( );
 }	// DisplayProperties::~DisplayProperties
 
 
+DisplayProperties::Attributes& DisplayProperties::writableAttributes ( )
+{
+	if (1 != _attributes->_count)
+		attach (new Attributes (*_attributes));
+
+	return *_attributes;
+}	// DisplayProperties::writableAttributes
+
+
+void DisplayProperties::attach (DisplayProperties::Attributes* attributes)
+{
+	if (attributes == _attributes)
+		return;
+
+	__sync_add_and_fetch (&attributes->_count, 1);
+	detach ( );
+	_attributes	= attributes;
+}	// DisplayProperties::attach
+
+
+void DisplayProperties::detach ( )
+{
+	if ((0 != _attributes) && (0 == __sync_sub_and_fetch (&_attributes->_count, 1)))
+		delete _attributes;
+	_attributes	= 0;
+}	// DisplayProperties::detach
+
+
+bool DisplayProperties::shareAttributes (const DisplayProperties& dp)
+{
+	if (dp._attributes == _attributes)
+		return true;
+	if (false == (*(dp._attributes) == *_attributes))
+		return false;
+
+	attach (dp._attributes);
+	return true;
+}	// DisplayProperties::shareAttributes
+
+
+unsigned long DisplayProperties::getAttributesSharingCount ( ) const
+{
+	return _attributes->_count;
+}	// DisplayProperties::getAttributesSharingCount
+
+
+size_t DisplayProperties::getAttributesMemory ( )
+{
+	return sizeof (Attributes);
+}	// DisplayProperties::getAttributesMemory
+
+
 void DisplayProperties::setCloudColor (const Color& color)
 {
-	if (color != _cloudColor)
+	if (color != _attributes->_cloudColor)
 	{
-		_cloudColor	= color;
+		writableAttributes ( )._cloudColor	= color;
 		// Notifier les vues ?
 	}	// if (color != _cloudColor)
 }	// DisplayProperties::setCloudColor
@@ -291,9 +366,9 @@ void DisplayProperties::setCloudColor (const Color& color)
 
 void DisplayProperties::setWireColor (const Color& color)
 {
-	if (color != _wireColor)
+	if (color != _attributes->_wireColor)
 	{
-		_wireColor	= color;
+		writableAttributes ( )._wireColor	= color;
 		// Notifier les vues ?
 	}	// if (color != _wireColor)
 }	// DisplayProperties::setWireColor
@@ -301,9 +376,9 @@ void DisplayProperties::setWireColor (const Color& color)
 
 void DisplayProperties::setSurfacicColor (const Color& color)
 {
-	if (color != _solidColor)
+	if (color != _attributes->_solidColor)
 	{
-		_solidColor	= color;
+		writableAttributes ( )._solidColor	= color;
 		// Notifier les vues ?
 	}	// if (color != _solidColor)
 }	// DisplayProperties::setSurfacicColor
@@ -311,9 +386,9 @@ void DisplayProperties::setSurfacicColor (const Color& color)
 
 void DisplayProperties::setVolumicColor (const Color& color)
 {
-	if (color != _solidColor)
+	if (color != _attributes->_solidColor)
 	{
-		_solidColor	= color;
+		writableAttributes ( )._solidColor	= color;
 		// Notifier les vues ?
 	}	// if (color != _solidColor)
 }	// DisplayProperties::setVolumicColor
@@ -321,9 +396,9 @@ void DisplayProperties::setVolumicColor (const Color& color)
 
 void DisplayProperties::setFontColor (const Color& color)
 {
-	if (color != _fontColor)
+	if (color != _attributes->_fontColor)
 	{
-		_fontColor	= color;
+		writableAttributes ( )._fontColor	= color;
 		// Notifier les vues ?
 	}	// if (color != _fontColor)
 }	// DisplayProperties::setFontColor
@@ -331,9 +406,9 @@ void DisplayProperties::setFontColor (const Color& color)
 
 void DisplayProperties::setValueName (const string& name)
 {
-	if (name != _valueName)
+	if (name != _attributes->_valueName)
 	{
-		_valueName	= name;
+		writableAttributes ( )._valueName	= name;
 		// Notifier les vues ?
 	}	// if (name != _valueName)
 }	// DisplayProperties::setValueName
@@ -341,51 +416,57 @@ void DisplayProperties::setValueName (const string& name)
 
 void DisplayProperties::setCloudOpacity (double opacity)
 {
-	_cloudOpacity	= opacity;
+	if (opacity != _attributes->_cloudOpacity)
+		writableAttributes ( )._cloudOpacity	= opacity;
 }	// DisplayProperties::setCloudOpacity
 
 
 void DisplayProperties::setWireOpacity (double opacity)
 {
-	_wireOpacity	= opacity;
+	if (opacity != _attributes->_wireOpacity)
+		writableAttributes ( )._wireOpacity	= opacity;
 }	// DisplayProperties::setWireOpacity
 
 
 void DisplayProperties::setSurfacicOpacity (double opacity)
 {
-	_surfacicOpacity	= opacity;
+	if (opacity != _attributes->_surfacicOpacity)
+		writableAttributes ( )._surfacicOpacity	= opacity;
 }	// DisplayProperties::setSurfacicOpacity
 
 
 void DisplayProperties::setVolumicOpacity (double opacity)
 {
-	_volumicOpacity	= opacity;
+	if (opacity != _attributes->_volumicOpacity)
+		writableAttributes ( )._volumicOpacity	= opacity;
 }	// DisplayProperties::setVolumicOpacity
 
 
 void DisplayProperties::setShrinkFactor (double factor)
 {
-	_shrinkFactor	= factor;
+	if (factor != _attributes->_shrinkFactor)
+		writableAttributes ( )._shrinkFactor	= factor;
 }	// DisplayProperties::setShrinkFactor
 
 
 void DisplayProperties::setArrowComul (double factor)
 {
-	_arrowComul	= factor;
+	if (factor != _attributes->_arrowComul)
+		writableAttributes ( )._arrowComul	= factor;
 }	// DisplayProperties::setArrowComul
 
 
 float DisplayProperties::getPointSize ( ) const
 {
-	return _pointSize;
+	return _attributes->_pointSize;
 }	// DisplayProperties::getPointSize
 
 
 void DisplayProperties::setPointSize (float size)
 {
-	if (size != _pointSize)
+	if (size != _attributes->_pointSize)
 	{
-		_pointSize	= size;
+		writableAttributes ( )._pointSize	= size;
 		// Notifier les vues ?
 	}	// if (size != _pointSize)
 }	// DisplayProperties::setPointSize
@@ -393,15 +474,15 @@ void DisplayProperties::setPointSize (float size)
 
 float DisplayProperties::getLineWidth ( ) const
 {
-	return _lineWidth;
+	return _attributes->_lineWidth;
 }	// DisplayProperties::getLineWidth
 
 
 void DisplayProperties::setLineWidth (float width)
 {
-	if (width != _lineWidth)
+	if (width != _attributes->_lineWidth)
 	{
-		_lineWidth	= width;
+		writableAttributes ( )._lineWidth	= width;
 		// Notifier les vues ?
 	}	// if (width != _lineWidth)
 }	// DisplayProperties::setLineWidth
@@ -410,22 +491,28 @@ void DisplayProperties::setLineWidth (float width)
 void DisplayProperties::getFontProperties (
 		int& family, int& size, bool& bold, bool& italic, Color& color) const
 {
-	family	= _fontFamily;
-	size	= _fontSize;
-	bold	= _bold;
-	italic	= _italic;
-	color	= _fontColor;
+	family	= _attributes->_fontFamily;
+	size	= _attributes->_fontSize;
+	bold	= _attributes->_bold;
+	italic	= _attributes->_italic;
+	color	= _attributes->_fontColor;
 }	// DisplayProperties::getFontProperties
 
 
 void DisplayProperties::setFontProperties (
 			int family, int size, bool bold, bool italic, const Color& color)
 {
-	_fontFamily	= family;
-	_fontSize	= size;
-	_bold		= bold;
-	_italic		= italic;
-	_fontColor	= color;
+	if ((family == _attributes->_fontFamily) &&
+	    (size == _attributes->_fontSize) && (bold == _attributes->_bold) &&
+	    (italic == _attributes->_italic) && (color == _attributes->_fontColor))
+		return;
+
+	Attributes&	attributes	= writableAttributes ( );
+	attributes._fontFamily	= family;
+	attributes._fontSize	= size;
+	attributes._bold		= bold;
+	attributes._italic		= italic;
+	attributes._fontColor	= color;
 }	// DisplayProperties::setFontProperties
 
 
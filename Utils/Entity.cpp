@@ -224,7 +224,7 @@ int Entity::objectTypeToDimension (objectType t)
 }
 /*----------------------------------------------------------------------------*/
 Entity::Entity(unsigned long id, Property* prop,
-        DisplayProperties* disp, TkUtil::LogOutputStream* logStream)
+        const DisplayProperties& disp, TkUtil::LogOutputStream* logStream)
 : m_destroyed(false)
 , m_unique_id(id)
 , m_prop(prop)
@@ -234,7 +234,6 @@ Entity::Entity(unsigned long id, Property* prop,
 #ifdef _DEBUG_MEMORY
     std::cout<<"Entity::Entity() de "<<getName()<<" (uid "<< m_unique_id<<")"<<std::endl;
 //    std::cout<<"  m_prop en "<<m_prop<<std::endl;
-//    std::cout<<"  m_displayProperties en "<<m_displayProperties<<std::endl;
 #endif
 }
 /*----------------------------------------------------------------------------*/
@@ -243,15 +242,11 @@ Entity::~Entity()
 #ifdef _DEBUG_MEMORY
     std::cout<<"Entity::~Entity() de "<<getName()<<" (uid "<< m_unique_id<<")"<<std::endl;
 //    std::cout<<"  m_prop en "<<m_prop<<std::endl;
-//    std::cout<<"  m_displayProperties en "<<m_displayProperties<<std::endl;
 #endif
 
 	if (0 != m_prop)
 	    delete m_prop;
 	m_prop	= 0;
-	if (0 != m_displayProperties)
-	    delete m_displayProperties;
-	m_displayProperties	= 0;
 }
 /*----------------------------------------------------------------------------*/
 void Entity::getBounds (double bounds[6]) const
@@ -331,18 +326,6 @@ std::string Entity::getSummary ( ) const
 	return "";
 }
 /*----------------------------------------------------------------------------*/
-DisplayProperties* Entity::setDisplayProperties (DisplayProperties* dp)
-{
-    DisplayProperties* old_disp=0;
-    if(dp==0){
-        throw   TkUtil::Exception("Null display property");
-    }
-
-    old_disp = m_displayProperties;
-    m_displayProperties = dp;
-    return old_disp;
-}	// Entity::getDisplayProperties
-/*----------------------------------------------------------------------------*/
 Property* Entity::setProperties (Property* prop)
 {
     Property* old=0;
@@ -505,6 +488,11 @@ void Entity::log (const TkUtil::Log& l) const
 #endif
 }
 /*----------------------------------------------------------------------------*/
+bool Entity::isLogEnabled (TkUtil::Log::TYPE type) const
+{
+    return (0 != getLogStream ( )) && (0 != (getLogStream ( )->getMask ( ) & type));
+}
+/*----------------------------------------------------------------------------*/
 bool Entity::isVisible() const
 {
     return getDisplayProperties().isDisplayed();
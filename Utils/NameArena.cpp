@@ -0,0 +1,245 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NameArena.cpp
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Utils/NameArena.h"
+
+#include <TkUtil/Mutex.h>
+
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/** taille des blocs où sont rangés les noms, qui sont alignés sur cette
+ *  taille : le bloc d'un nom est retrouvé en masquant l'adresse du nom */
+static const size_t			blockSize	= 64 * 1024;
+/// en-tête d'un bloc
+struct BlockHeader {
+    /// nombre de noms référencés dans le bloc
+    size_t live;
+    /// taille allouée
+    size_t size;
+};
+/** un nom est précédé de son nombre de références, les noms sont alignés
+ *  sur la taille de ce compteur */
+typedef uint32_t			RefCount;
+/// le bloc en cours de remplissage
+static BlockHeader*			currentBlock	= 0;
+/// nombre d'octets utilisés dans le bloc courant
+static size_t				blockUsed	= blockSize;
+/// mémoire allouée pour les blocs
+static size_t				blocksMemory	= 0;
+/// table de hachage (adressage ouvert) des noms, 0 pour un emplacement libre
+static std::vector<const char*>	table;
+/// nombre de noms internés
+static size_t				nbNames		= 0;
+/// nombre de références prises sur les noms
+static size_t				nbReferences	= 0;
+/// mémoire qu'occuperaient les références sous forme de std::string
+static size_t				stringsMemory	= 0;
+/// protection des variables précédentes
+static TkUtil::Mutex			arenaMutex;
+/*----------------------------------------------------------------------------*/
+static uint64_t hashName(const char* name, size_t length)
+{
+    // FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i=0; i<length; i++){
+        h ^= (unsigned char)name[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+/*----------------------------------------------------------------------------*/
+/// emplacement du nom dans la table (le sien ou le premier libre)
+static size_t slotOf(const char* name, size_t length)
+{
+    const size_t mask = table.size() - 1;
+    size_t slot = (size_t)hashName(name, length) & mask;
+    while (0 != table[slot]
+           && (0 != strncmp(table[slot], name, length) || '\0' != table[slot][length]))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+/*----------------------------------------------------------------------------*/
+static void rehash(size_t size)
+{
+    std::vector<const char*> old;
+    old.swap(table);
+    table.assign(size, (const char*)0);
+    for (size_t i=0; i<old.size(); i++)
+        if (0 != old[i])
+            table[slotOf(old[i], strlen(old[i]))] = old[i];
+}
+/*----------------------------------------------------------------------------*/
+/// retire de la table le nom de l'emplacement slot (sondage linéaire)
+static void erase(size_t slot)
+{
+    const size_t mask = table.size() - 1;
+    size_t next = slot;
+    for ( ; ; ){
+        next = (next + 1) & mask;
+        if (0 == table[next])
+            break;
+        // un nom ne remonte que s'il ne serait plus trouvé après le trou
+        const size_t home = (size_t)hashName(table[next], strlen(table[next])) & mask;
+        if (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next))
+            continue;
+        table[slot] = table[next];
+        slot = next;
+    }
+    table[slot] = 0;
+}
+/*----------------------------------------------------------------------------*/
+/// mémoire occupée par une std::string contenant le nom
+static size_t stringMemory(size_t length)
+{
+    static const size_t localCapacity = std::string().capacity();
+    return sizeof(std::string) + (length > localCapacity ? length + 1 : 0);
+}
+/*----------------------------------------------------------------------------*/
+static RefCount& refCount(const char* name)
+{
+    return *(RefCount*)(name - sizeof(RefCount));
+}
+/*----------------------------------------------------------------------------*/
+static BlockHeader* allocateBlock(size_t size)
+{
+    void* block = 0;
+    if (0 != posix_memalign(&block, blockSize, size))
+        throw std::bad_alloc();
+    BlockHeader* header = (BlockHeader*)block;
+    header->live = 0;
+    header->size = size;
+    blocksMemory += size;
+    return header;
+}
+/*----------------------------------------------------------------------------*/
+/// copie le nom dans l'arène, avec une référence
+static const char* store(const char* name, size_t length)
+{
+    // le compteur, le nom et son 0 final, arrondis à l'alignement du compteur
+    const size_t entrySize = (sizeof(RefCount) + length + 1 + sizeof(RefCount) - 1)
+                             / sizeof(RefCount) * sizeof(RefCount);
+    const size_t headerSize = (sizeof(BlockHeader) + sizeof(RefCount) - 1)
+                              / sizeof(RefCount) * sizeof(RefCount);
+    BlockHeader* block = 0;
+    char* entry = 0;
+    if (headerSize + entrySize > blockSize){
+        // un nom plus long qu'un bloc a son propre bloc
+        block = allocateBlock(headerSize + entrySize);
+        entry = (char*)block + headerSize;
+    }
+    else{
+        if (blockUsed + entrySize > blockSize){
+            // l'ancien bloc courant est libéré dès qu'il n'a plus de nom
+            if (0 != currentBlock && 0 == currentBlock->live){
+                blocksMemory -= currentBlock->size;
+                free(currentBlock);
+            }
+            currentBlock = allocateBlock(blockSize);
+            blockUsed = headerSize;
+        }
+        block = currentBlock;
+        entry = (char*)block + blockUsed;
+        blockUsed += entrySize;
+    }
+    block->live++;
+
+    char* copy = entry + sizeof(RefCount);
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+    refCount(copy) = 1;
+    return copy;
+}
+/*----------------------------------------------------------------------------*/
+const char* NameArena::intern(const std::string& name)
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+
+    // taux de remplissage de la table d'au plus 3/4
+    if (4 * (nbNames + 1) > 3 * table.size())
+        rehash(table.empty() ? 1024 : 2 * table.size());
+
+    const size_t slot = slotOf(name.c_str(), name.length());
+    if (0 == table[slot]){
+        table[slot] = store(name.c_str(), name.length());
+        nbNames++;
+    }
+    else
+        refCount(table[slot])++;
+    nbReferences++;
+    stringsMemory += stringMemory(name.length());
+    return table[slot];
+}
+/*----------------------------------------------------------------------------*/
+const char* NameArena::acquire(const char* name)
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+
+    refCount(name)++;
+    nbReferences++;
+    stringsMemory += stringMemory(strlen(name));
+    return name;
+}
+/*----------------------------------------------------------------------------*/
+void NameArena::release(const char* name)
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+
+    const size_t length = strlen(name);
+    nbReferences--;
+    stringsMemory -= stringMemory(length);
+    if (0 != --refCount(name))
+        return;
+
+    erase(slotOf(name, length));
+    nbNames--;
+
+    BlockHeader* block = (BlockHeader*)((uintptr_t)name & ~(uintptr_t)(blockSize - 1));
+    if (0 != --block->live)
+        return;
+    if (block == currentBlock){
+        // bloc courant vide : il est réutilisé depuis le début
+        blockUsed = (sizeof(BlockHeader) + sizeof(RefCount) - 1)
+                    / sizeof(RefCount) * sizeof(RefCount);
+        return;
+    }
+    blocksMemory -= block->size;
+    free(block);
+}
+/*----------------------------------------------------------------------------*/
+size_t NameArena::getNbNames()
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+    return nbNames;
+}
+/*----------------------------------------------------------------------------*/
+size_t NameArena::getMemory()
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+    return blocksMemory + table.size() * sizeof(const char*);
+}
+/*----------------------------------------------------------------------------*/
+long NameArena::getSavedMemory()
+{
+    TkUtil::AutoMutex autoMutex(&arenaMutex);
+    return (long)stringsMemory - (long)(nbReferences * sizeof(const char*))
+           - (long)(blocksMemory + table.size() * sizeof(const char*));
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
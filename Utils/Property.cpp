@@ -7,26 +7,45 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Utils/Property.h"
+#include "Utils/NameArena.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Utils {
 /*----------------------------------------------------------------------------*/
 Property::Property(const std::string& name)
-:m_name(name)
+:m_name(NameArena::intern(name))
 {}
 /*----------------------------------------------------------------------------*/
-Property::~Property()
+Property::Property(const Property& prop)
+:m_name(NameArena::acquire(prop.m_name))
 {}
 /*----------------------------------------------------------------------------*/
+Property& Property::operator = (const Property& prop)
+{
+    if (&prop != this){
+        const char* old = m_name;
+        m_name = NameArena::acquire(prop.m_name);
+        NameArena::release(old);
+    }
+    return *this;
+}
+/*----------------------------------------------------------------------------*/
+Property::~Property()
+{
+    NameArena::release(m_name);
+}
+/*----------------------------------------------------------------------------*/
 std::string Property::getName() const
 {
-    return m_name;
+    return std::string(m_name);
 }
 /*----------------------------------------------------------------------------*/
 void Property::setName(const std::string& name)
 {
-    m_name = name;
+    const char* old = m_name;
+    m_name = NameArena::intern(name);
+    NameArena::release(old);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Utils
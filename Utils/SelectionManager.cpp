@@ -125,9 +125,12 @@ Mutex* SelectionManagerObserver::getMutex ( ) const
 // =========================================================================
 
 
+size_t	SelectionManager::maxLoggedNames	= 20;
+
+
 SelectionManager::SelectionManager (const string& name, TkUtil::LogOutputStream* los)
 	: SelectionManagerIfc ( ),
-	  _name (name), _entities ( ), _observers ( ), _mutex (0),
+	  _name (name), _entities ( ), _selected ( ), _observers ( ), _mutex (0),
 	  m_logOutputStream(los)
 {
 	_mutex	= new Mutex ( );
@@ -136,7 +139,7 @@ SelectionManager::SelectionManager (const string& name, TkUtil::LogOutputStream*
 
 SelectionManager::SelectionManager (const SelectionManager&)
 	: SelectionManagerIfc ( ),
-	  _name ("Invalid name"), _entities ( ), _observers ( ), _mutex (0),
+	  _name ("Invalid name"), _entities ( ), _selected ( ), _observers ( ), _mutex (0),
 	  m_logOutputStream (0)
 {
     MGX_FORBIDDEN("SelectionManager::SelectionManager (const SelectionManager&) forbidden.");
@@ -259,41 +262,31 @@ void SelectionManager::addToSelection (const vector<Entity*>& entities)
 	if (0 == entities.size ( ))
 		return;
 
-	bool			hasAlreadySelected	= false, first = true;
-	UTF8String	alreadySelected (Charset::UTF_8);
-	UTF8String   message (Charset::UTF_8);
-	message << (1 == entities.size ( ) ?
-	           "Sélection de l'entité " : "Sélection des entités ");
-
+	// Seules les entités effectivement ajoutées sont notifiées, en une fois :
+	vector<Entity*>	added;
+	added.reserve (entities.size ( ));
 	for (vector<Entity*>::const_iterator it = entities.begin ( );
 	     entities.end ( ) != it; it++)
 	{
 		CHECK_NULL_PTR_ERROR (*it)
 
-		if (true == isSelected (**it))
-		{
-			hasAlreadySelected	= true;
-			if (0 != alreadySelected.length ( ))
-				alreadySelected << ", ";
-			alreadySelected << (*it)->getName ( );
-
-			continue;
-		}	// if (true == isSelected (**it)
+		if (false == _selected.insert (make_pair ((const Entity*)*it, true)).second)
+			continue;	// Déjà sélectionnée
 
 		_entities.push_back (*it);
-		if (false == first)
-			message << ", ";
-		message << (*it)->getName ( );
-		first	= false;
+		added.push_back (*it);
 	}	// for (vector<Entity*>::const_iterator it = entities.begin ( ); ...
 
-	if (0 != m_logOutputStream)
-		m_logOutputStream->log (TraceLog (message, Log::INFORMATION));
+	if (0 == added.size ( ))
+		return;
+
+	logEntities (1 == added.size ( ) ?
+	             "Sélection de l'entité " : "Sélection des entités ", added);
 
 	for (vector<SelectionManagerObserverIfc*>::iterator it = _observers.begin ( ); _observers.end ( ) != it; it++)
 	{
 		(*it)->selectionModified ( );
-		(*it)->entitiesAddedToSelection (entities);
+		(*it)->entitiesAddedToSelection (added);
 	}	// for (vector<SelectionManagerObserverIfc*>::iterator it = ...
 }	// SelectionManager::addToSelection
 
@@ -305,54 +298,41 @@ void SelectionManager::removeFromSelection (const vector<Entity*>& entities)
 	if (0 == entities.size ( ))
 		return;
 
-	bool			hasAlreadyRemoved	= false, first = true;
-	UTF8String	alreadyRemoved (Charset::UTF_8);
-	UTF8String   message (Charset::UTF_8);
-	message << (1 == entities.size ( ) ?
-	           "Désélection de l'entité " : "Désélection des entités ");
-
-	for (vector<Entity*>::const_iterator it1 = entities.begin ( );
-	     entities.end ( ) != it1; it1++)
+	// Retrait de l'index puis compactage de la liste en une seule passe, en
+	// ne gardant que les entités encore indexées :
+	vector<Entity*>		removed;
+	removed.reserve (entities.size ( ));
+	for (vector<Entity*>::const_iterator it = entities.begin ( );
+	     entities.end ( ) != it; it++)
 	{
-		CHECK_NULL_PTR_ERROR (*it1)
+		CHECK_NULL_PTR_ERROR (*it)
 
-		bool	removed	= false;
-		for (vector<Entity*>::iterator it2 = _entities.begin ( );
-		     _entities.end ( ) != it2; it2++)
-		{
-			if (*it1 == *it2)
-			{
-				removed	= true;
-				_entities.erase (it2);
-				break;
-			}	//if (*it1 == *it2)
-		}	// for (vector<Entity*>::iterator it2 = _entities.begin ( );
-
-		if (false == removed)
-		{
-			hasAlreadyRemoved	= true;
-			if (0 != alreadyRemoved.length ( ))
-				alreadyRemoved << ", ";
-			alreadyRemoved << (*it1)->getName ( );
+		if (0 == _selected.erase (*it))
+			continue;	// Non sélectionnée
 
-			continue;
-		}	// if (false == removed)
+		removed.push_back (*it);
+	}	// for (vector<Entity*>::const_iterator it = entities.begin ( ); ...
 
-		if (false == first)
-			message << ", ";
-		message << (*it1)->getName ( );
-		first	= false;
-	}	// for (vector<Entity*>::const_iterator it1 = entities.begin ( ); ...
+	if (0 == removed.size ( ))
+		return;
 
-	if (0 != m_logOutputStream)
-		m_logOutputStream->log (TraceLog (message, Log::INFORMATION));
+	vector<Entity*>::iterator	last	= _entities.begin ( );
+	for (vector<Entity*>::iterator it = _entities.begin ( );
+	     _entities.end ( ) != it; it++)
+		if (0 != _selected.count (*it))
+			*last++	= *it;
+	_entities.erase (last, _entities.end ( ));
+
+	logEntities (1 == removed.size ( ) ?
+	             "Désélection de l'entité " : "Désélection des entités ",
+	             removed);
 
 	for (vector<SelectionManagerObserverIfc*>::iterator it =
 						_observers.begin ( ); _observers.end ( ) != it;
 		it++)
 	{
 		(*it)->selectionModified ( );
-		(*it)->entitiesRemovedFromSelection (entities, false);
+		(*it)->entitiesRemovedFromSelection (removed, false);
 	}	// for (vector<SelectionManagerObserverIfc*>::iterator it = ...
 }	// SelectionManager::removeFromSelection
 
@@ -367,12 +347,7 @@ bool SelectionManager::isSelected (const Entity& entity) const
 	// A priori on ne devrait pas passer ci-dessous :
 	AutoMutex	autoMutex (getMutex ( ));
 
-	for (vector<Entity*>::const_iterator it = _entities.begin ( );
-	     _entities.end ( ) != it; it++)
-			if (*it == &entity)
-				return true;
-
-	return false;
+	return _selected.end ( ) == _selected.find (&entity) ? false : true;
 }	// SelectionManager::isSelected
 
 
@@ -389,8 +364,9 @@ void SelectionManager::clearSelection ( )
 	// évenement au niveau de l'IHM.
 	if (0 != _entities.size ( ))
 	{
-		vector<Entity*>	unselected	= _entities;
-		_entities.clear ( );
+		vector<Entity*>	unselected;
+		unselected.swap (_entities);
+		_selected.clear ( );
 		for (vector<SelectionManagerObserverIfc*>::iterator	its	= _observers.begin ( ); _observers.end ( ) != its; its++)
 		{
 			(*its)->selectionModified ( );
@@ -447,6 +423,30 @@ void SelectionManager::log (const TkUtil::Log& log)
 }	// SelectionManager::log
 
 
+void SelectionManager::logEntities (
+						const string& header, const vector<Entity*>& entities)
+{
+	if (0 == m_logOutputStream)
+		return;
+
+	UTF8String	message (Charset::UTF_8);
+	message << header;
+	const size_t	count	=
+		entities.size ( ) <= maxLoggedNames ? entities.size ( ) : maxLoggedNames;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (0 != i)
+			message << ", ";
+		message << entities [i]->getName ( );
+	}	// for (size_t i = 0; i < count; i++)
+	if (count < entities.size ( ))
+		message << ", ... (" << (unsigned long)entities.size ( )
+		        << " entités au total)";
+
+	m_logOutputStream->log (TraceLog (message, Log::INFORMATION));
+}	// SelectionManager::logEntities
+
+
 void SelectionManager::notifyObserversForNewPolicy (void* smp)
 {
 	AutoMutex	autoMutex (getMutex ( ));
@@ -306,6 +306,13 @@ class Command : public Utils::CommandIfc, public TkUtil::ReferencedNamedObject
      */
     virtual TkUtil::LogOutputStream* getLogStream ( )
     { return _logStream; }
+
+    /**
+     * \return      <I>true</I> si un log du type transmis en argument est
+     *              affiché par le gestionnaire de message de la commande.
+     * \see         MGX_TRACE_IF
+     */
+    virtual bool isLogEnabled (TkUtil::Log::TYPE type) const;
     //@}
 
 
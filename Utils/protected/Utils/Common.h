@@ -69,6 +69,27 @@ TkUtil::TraceLog	name (TkUtil::UTF8String (text, TkUtil::Charset::UTF_8), Log::T
 #define MGX_TRACE_LOG_5(name, text)                                              \
 TkUtil::TraceLog	name (TkUtil::UTF8String (text, TkUtil::Charset::UTF_8), Log::TRACE_5, TkUtil::UTF8String (__FILE__, TkUtil::Charset::UTF_8), __LINE__);
 
+/**
+ * Envoi d'un log de type Trace dont le message n'est construit que si ce
+ * niveau de trace est affich. Evite la mise en forme (par exemple
+ * << *this) des messages masqus lors des oprations sur un grand nombre
+ * d'entits.
+ * @param		emitter est l'metteur du log (entit, commande, contexte ...)
+ *				qui offre les services isLogEnabled et log
+ * @param		type est le niveau de trace souhait
+ * @param		expr est le message, sous forme d'une suite d'oprandes de
+ *				l'oprateur << (ex : "Bloc " << getName ( ))
+ */
+#define MGX_TRACE_IF(emitter, type, expr)                                        \
+do {                                                                             \
+	if ((emitter).isLogEnabled (type))                                           \
+	{                                                                            \
+		TkUtil::UTF8String	mgx_trace_message (TkUtil::Charset::UTF_8);          \
+		mgx_trace_message << expr;                                               \
+		(emitter).log (TkUtil::TraceLog (mgx_trace_message, type));              \
+	}                                                                            \
+} while (0)
+
 
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
@@ -86,7 +86,7 @@ class DisplayProperties
 	 * \see			getVolumicColor
 	 */
 	virtual const TkUtil::Color& getCloudColor ( ) const
-	{ return _cloudColor; }
+	{ return _attributes->_cloudColor; }
 
 	/**
 	 * \param		La nouvelle couleur utilisée en mode "nuage".
@@ -106,7 +106,7 @@ class DisplayProperties
 	 * \see			getVolumicColor
 	 */
 	virtual const TkUtil::Color& getWireColor ( ) const
-	{ return _wireColor; }
+	{ return _attributes->_wireColor; }
 
 	/**
 	 * \param		La nouvelle couleur utilisée en mode filaire.
@@ -127,7 +127,7 @@ class DisplayProperties
 	 *				surfacique et volumique sont portées par le même attribut.
 	 */
 	virtual const TkUtil::Color& getSurfacicColor ( ) const
-	{ return _solidColor; }
+	{ return _attributes->_solidColor; }
 
 	/**
 	 * \param		La nouvelle couleur utilisée en mode surfacique.
@@ -152,7 +152,7 @@ class DisplayProperties
 	 *				surfacique et volumique sont portées par le même attribut.
 	 */
 	virtual const TkUtil::Color& getVolumicColor ( ) const
-	{ return _solidColor; }
+	{ return _attributes->_solidColor; }
 
 	/**
 	 * \param		La nouvelle couleur utilisée en mode volumique.
@@ -173,7 +173,7 @@ class DisplayProperties
 	 * \see			getFontProperties
 	 */
 	virtual const TkUtil::Color& getFontColor ( ) const
-	{ return _fontColor; }
+	{ return _attributes->_fontColor; }
 
 	/**
 	 * \param		La nouvelle couleur utilisée pour les textes 2D.
@@ -189,7 +189,7 @@ class DisplayProperties
 	 * \see			setValueName
 	 */
 	virtual const std::string& getValueName ( ) const
-	{ return _valueName; }
+	{ return _attributes->_valueName; }
 
 	/**
 	 * \param		Le nom de l'éventuelle valeur (aux noeuds/aux mailles)
@@ -205,7 +205,7 @@ class DisplayProperties
 	 * \see			getSurfacicOpacity
 	 */
 	virtual double getCloudOpacity ( ) const
-	{ return _cloudOpacity; }
+	{ return _attributes->_cloudOpacity; }
 
 	/**
 	 * \param		La nouvelle opacité utilisée en mode "filaire".
@@ -222,7 +222,7 @@ class DisplayProperties
 	 * \see			getSurfacicOpacity
 	 */
 	virtual double getWireOpacity ( ) const
-	{ return _wireOpacity; }
+	{ return _attributes->_wireOpacity; }
 
 	/**
 	 * \param		La nouvelle opacité utilisée en mode "surfacique".
@@ -240,7 +240,7 @@ class DisplayProperties
 	 * \see			getCloudOpacity
 	 */
 	virtual double getSurfacicOpacity ( ) const
-	{ return _surfacicOpacity; }
+	{ return _attributes->_surfacicOpacity; }
 
 	/**
 	 * \param		La nouvelle opacité utilisée en mode "surfacique".
@@ -258,7 +258,7 @@ class DisplayProperties
 	 * \see			getCloudOpacity
 	 */
 	virtual double getVolumicOpacity ( ) const
-	{ return _volumicOpacity; }
+	{ return _attributes->_volumicOpacity; }
 
 	/**
 	 * \param		Le nouveau facteur de rétrécissement (compris entre 0
@@ -272,7 +272,7 @@ class DisplayProperties
 	 * \see			setShrinkFactor
 	 */
 	virtual double getShrinkFactor ( ) const
-	{ return _shrinkFactor; }
+	{ return _attributes->_shrinkFactor; }
 
 	/**
 	 * \param		Le nouveau facteur facteur d'agrandissement des flèches 
@@ -286,7 +286,7 @@ class DisplayProperties
 	 * \see			setArrowComul
 	 */
 	virtual double getArrowComul ( ) const
-	{ return _arrowComul; }
+	{ return _attributes->_arrowComul; }
 
 	/**
 	 * \param		La nouvelle opacité utilisée en mode "volumique".
@@ -536,6 +536,39 @@ class DisplayProperties
 	//@}	// Les vues "non graphiques".
 	
 
+	/**
+	 * Partage des attributs graphiques (couleurs, opacités, fonte, ...).
+	 * Ces attributs sont partagés par les copies d'une instance tant qu'ils
+	 * ne sont pas modifiés (copie sur écriture), ce qui évite de les dupliquer
+	 * pour chacune des entités d'un même type (ex : la topologie).
+	 */
+	//@{
+
+	/**
+	 * Partage les attributs graphiques de l'instance transmise en argument
+	 * s'ils sont égaux à ceux de cette instance.
+	 * \return		<I>true</I> si les attributs sont désormais partagés,
+	 *				<I>false</I> s'ils diffèrent.
+	 * \see			Context::newDisplayProperties
+	 */
+	virtual bool shareAttributes (const DisplayProperties& dp);
+
+	/**
+	 * \return		Le nombre d'instances partageant les attributs graphiques
+	 *				de cette instance (elle comprise).
+	 */
+	virtual unsigned long getAttributesSharingCount ( ) const;
+
+	/**
+	 * \return		La taille d'un jeu d'attributs graphiques, en octets,
+	 *				économisée par chaque instance qui partage ceux d'une
+	 *				autre.
+	 */
+	static size_t getAttributesMemory ( );
+
+	//@}	// Partage des attributs graphiques.
+
+
 	/**
 	 * Opérations de comparaison.
 	 */
@@ -564,40 +597,80 @@ class DisplayProperties
 
 	private :
 
-	/** Couleur d'affichage en mode "nuage". */
-	TkUtil::Color				_cloudColor;
+	/**
+	 * Les attributs graphiques, éventuellement partagés entre plusieurs
+	 * instances de <I>DisplayProperties</I>.
+	 */
+	struct Attributes
+	{
+		Attributes ( );
+		Attributes (const Attributes&);
+		bool operator == (const Attributes&) const;
+
+		/** Couleur d'affichage en mode "nuage". */
+		TkUtil::Color				_cloudColor;
+
+		/** Couleur d'affichage en mode filaire. */
+		TkUtil::Color				_wireColor;
+
+		/** Couleur d'affichage en mode surfacique et volumique. */
+		TkUtil::Color				_solidColor;
+
+		/** L'opacité dans les différents modes. */
+		double					_cloudOpacity, _wireOpacity, _surfacicOpacity,
+							_volumicOpacity;
+
+		/** L'éventuel facteur de rétrécissement, compris entre 0 et 1.
+		 * 1 : affichage normal. */
+		double					_shrinkFactor;
+
+		/** L'éventuel facteur d'agrandissement des flèches association,
+		 * compris entre 0.1 et 10., 1. : affichage normal. */
+		double					_arrowComul;
+
+		/** L'épaisseur des points. */
+		float					_pointSize;
 
-	/** Couleur d'affichage en mode filaire. */
-	TkUtil::Color				_wireColor;
+		/** L'épaisseur des lignes. */
+		float					_lineWidth;
 
-	/** Couleur d'affichage en mode surfacique et volumique. */
-	TkUtil::Color				_solidColor;
+		/** Le texte 2D. */
+		unsigned short				_fontFamily, _fontSize;
+		bool					_bold, _italic;
+		TkUtil::Color				_fontColor;
 
-	/** L'opacité dans les différents modes. */
-	double					_cloudOpacity, _wireOpacity, _surfacicOpacity,
-						_volumicOpacity;
+		/** Le nom de l'éventuelle valeur (aux noeuds/aux mailles) représentée. */
+		std::string				_valueName;
 
-	/** L'éventuel facteur de rétrécissement, compris entre 0 et 1.
-	 * 1 : affichage normal. */
-	double					_shrinkFactor;
+		/** Le nombre d'instances de DisplayProperties partageant ces
+		 * attributs (modifié de manière atomique). */
+		unsigned long				_count;
 
-	/** L'éventuel facteur d'agrandissement des flèches association,
-	 * compris entre 0.1 et 10., 1. : affichage normal. */
-	double					_arrowComul;
+		private :
+
+		Attributes& operator = (const Attributes&);
+	};	// struct Attributes
 
-	/** L'épaisseur des points. */
-	float					_pointSize;
+	/**
+	 * \return		Les attributs graphiques de l'instance, dupliqués au
+	 *				préalable s'ils sont partagés. A appeler avant toute
+	 *				modification de ces attributs.
+	 */
+	Attributes& writableAttributes ( );
 
-	/** L'épaisseur des lignes. */
-	float					_lineWidth;
+	/**
+	 * Partage les attributs transmis en argument (et abandonne les
+	 * précédents).
+	 */
+	void attach (Attributes* attributes);
 
-	/** Le texte 2D. */
-	unsigned short				_fontFamily, _fontSize;
-	bool					_bold, _italic;
-	TkUtil::Color				_fontColor;
+	/**
+	 * Abandonne les attributs actuels, détruits s'ils ne sont plus partagés.
+	 */
+	void detach ( );
 
-	/** Le nom de l'éventuelle valeur (aux noeuds/aux mailles) représentée. */
-	std::string				_valueName;
+	/** Les attributs graphiques. */
+	Attributes*				_attributes;
 
 	/** Visibilité de l'entité dans la vue graphique */
 	bool					_displayed;
@@ -9,13 +9,14 @@
 #ifndef UTIL_ENTITY_H_
 #define UTIL_ENTITY_H_
 /*----------------------------------------------------------------------------*/
+#include "Utils/DisplayProperties.h"
 #include "Utils/DisplayRepresentation.h"
 #include "Utils/SerializedRepresentation.h"
 #include <vector>
 #include <map>
+#include <TkUtil/Log.h>
 /*----------------------------------------------------------------------------*/
 namespace TkUtil {
-class Log;
 class LogOutputStream;
 }
 /*----------------------------------------------------------------------------*/
@@ -24,7 +25,6 @@ namespace Mgx3D {
 namespace Utils {
 
 class Property;
-class DisplayProperties;
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -176,22 +176,10 @@ public:
     /*------------------------------------------------------------------------*/
 	/**
 	 * \return		Les propriétés d'affichage de l'entité.
-	 * \see			setDisplayProperties
 	 */
 #ifndef SWIG
-	virtual DisplayProperties& getDisplayProperties ( ) {return *m_displayProperties;}
-	virtual const DisplayProperties& getDisplayProperties ( ) const {return *m_displayProperties;}
-#endif
-
-    /*------------------------------------------------------------------------*/
-	/**
-	 * \param		Les nouvelles propriétés d'affichage de l'entité.
-	 * \see			getDisplayProperties
-	 * \warning		<B>N'actualise pas les vues courantes.</B>
-	 * \return      retourne l'ancienne propriétés d'affichage
-	 */
-#ifndef SWIG
-	virtual  DisplayProperties* setDisplayProperties (DisplayProperties* disp);
+	virtual DisplayProperties& getDisplayProperties ( ) {return m_displayProperties;}
+	virtual const DisplayProperties& getDisplayProperties ( ) const {return m_displayProperties;}
 #endif
 
     /*------------------------------------------------------------------------*/
@@ -336,6 +324,14 @@ public:
      */
     virtual void log (const TkUtil::Log& log) const;
 
+    /**
+     * \return     <I>true</I> si un log du type transmis en argument est
+     *              affiché par le flux de messages associé à l'instance.
+     *              Permet d'éviter la construction de messages ignorés.
+     * \see         MGX_TRACE_IF
+     */
+    virtual bool isLogEnabled (TkUtil::Log::TYPE type) const;
+
     /// Fonction de comparaison suivant l'unique id
     static bool compareEntity(Entity* e1, Entity* e2)
     {
@@ -347,8 +343,9 @@ public:
 
 protected:
 
-    /** Constructeur */
-    Entity(unsigned long id, Property* prop, DisplayProperties* disp,
+    /** Constructeur. Les propriétés d'affichage sont copiées, leurs attributs
+     * graphiques restant partagés avec disp jusqu'à leur modification. */
+    Entity(unsigned long id, Property* prop, const DisplayProperties& disp,
             TkUtil::LogOutputStream* logStream);
 
     /// Destructeur
@@ -366,7 +363,7 @@ private :
 	Property*               m_prop;
 
 	/** Les propriétés d'affichage. */
-	DisplayProperties*		m_displayProperties;
+	DisplayProperties		m_displayProperties;
 
 	/** Le gestionnaire de message */
 	TkUtil::LogOutputStream* m_log_stream;
@@ -0,0 +1,368 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file EntityContainer.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_ENTITYCONTAINER_H_
+#define UTILS_ENTITYCONTAINER_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/IndexedMap.h"
+#include <sys/types.h>
+#include <vector>
+#include <algorithm>
+#include "TkUtil/Exception.h"
+#include "TkUtil/UTF8String.h"
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/** \class EntityContainer
+ *  \brief Conteneur des entités d'un gestionnaire (TopoManager ...)
+ *
+ *  Contrairement à Container, dont l'ordre des entités a un sens (sommets
+ *  d'une arête ...), l'ordre des entités n'est pas conservé : chaque entité
+ *  connait son emplacement (IndexedMap), la recherche et le retrait se font
+ *  en O(1), le retrait remplaçant l'entité par la dernière.
+ *
+ *  Les entités détruites (en attente d'un undo ou de la destruction de la
+ *  commande) restent dans le conteneur, mais le nombre d'entités non
+ *  détruites est tenu à jour, à condition d'appeler update lorsque l'état
+ *  détruit d'une entité change (voir TopoEntity::setDestroyed).
+ *
+ *  Les entités non détruites sont aussi rangées suivant leur unique id.
+ *  Cette liste est compactée (retrait des entités devenues détruites ou
+ *  enlevées, tri après un undo) au moment de la consulter : getVisible
+ *  ne parcourt donc pas toutes les entités détruites de la session.
+ *  Elle l'est aussi périodiquement, dès que le nombre d'entrées à retirer
+ *  atteint la période de compactage (voir setCompactionPeriod), pour
+ *  qu'elle ne grossisse pas si elle n'est pas consultée.
+ */
+/*----------------------------------------------------------------------------*/
+template<class T>
+class EntityContainer{
+
+public:
+    /// période de compactage par défaut
+    static const uint DEFAULT_COMPACTION_PERIOD = 1024;
+
+    EntityContainer()
+    : m_entities(), m_slots(), m_visible(), m_nbVisible(0), m_nbStale(0)
+    , m_sorted(true), m_removedListed(false)
+    , m_compactionPeriod(DEFAULT_COMPACTION_PERIOD)
+    {}
+
+    /*----------------------------------------------------------------------------*/
+    /** nombre d'entrées à retirer de la liste des entités non détruites à
+     *  partir duquel elle est compactée sans attendre d'être consultée,
+     *  0 pour ne la compacter que lorsqu'elle est consultée
+     */
+    void setCompactionPeriod(uint nb)
+    {
+        m_compactionPeriod = nb;
+        compactIfNeeded();
+    }
+
+    uint getCompactionPeriod() const
+    {
+        return m_compactionPeriod;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// ajoute une entité (sans effet si elle est déjà présente)
+    void add(T* entity)
+    {
+        // une entité enlevée mais encore dans la liste des entités non
+        // détruites pourrait avoir la même adresse que la nouvelle
+        if (m_removedListed)
+            compact();
+
+        if (m_slots.indexOf(entity) != m_slots.npos())
+            return;
+
+        Slot slot;
+        slot.m_index = m_entities.size();
+        slot.m_state = 0;
+        m_entities.push_back(entity);
+        if (!entity->isDestroyed()){
+            slot.m_state |= VISIBLE;
+            m_nbVisible++;
+            list(entity, slot);
+        }
+        m_slots.insert(std::make_pair(entity, slot));
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// ajoute un vecteur d'entités
+    void add(const std::vector<T* >& entities)
+    {
+        for (uint i=0; i<entities.size(); i++)
+            add(entities[i]);
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// recherche et enlève l'entité, remplacée par la dernière
+    void remove(T* entity, const bool exceptionIfNotFound)
+    {
+        const size_t idx = m_slots.indexOf(entity);
+        if (idx == m_slots.npos()){
+            if (exceptionIfNotFound){
+                TkUtil::UTF8String   message;
+                message << "Erreur interne (pas d'entité), avec EntityContainer::remove";
+                throw TkUtil::Exception (message);
+            }
+            return;
+        }
+
+        const Slot slot = m_slots.at(idx).second;
+        if (slot.m_state & VISIBLE)
+            m_nbVisible--;
+        if (slot.m_state & LISTED){
+            // l'entrée sera retirée de la liste au prochain compactage
+            if (slot.m_state & VISIBLE)
+                m_nbStale++;
+            m_removedListed = true;
+        }
+
+        T* last = m_entities.back();
+        if (last != entity){
+            m_entities[slot.m_index] = last;
+            m_slots[last].m_index = slot.m_index;
+        }
+        m_entities.pop_back();
+        m_slots.erase(entity);
+
+        compactIfNeeded();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /** met à jour le nombre d'entités non détruites suivant l'état de l'entité,
+     *  à appeler lorsque cet état change (sans effet si l'entité est absente)
+     */
+    void update(T* entity)
+    {
+        const size_t idx = m_slots.indexOf(entity);
+        if (idx == m_slots.npos())
+            return;
+
+        Slot& slot = m_slots.at(idx).second;
+        const bool visible = !entity->isDestroyed();
+        if (visible && !(slot.m_state & VISIBLE)){
+            slot.m_state |= VISIBLE;
+            m_nbVisible++;
+            if (slot.m_state & LISTED)
+                m_nbStale--;
+            else
+                list(entity, slot);
+        }
+        else if (!visible && (slot.m_state & VISIBLE)){
+            slot.m_state &= ~VISIBLE;
+            m_nbVisible--;
+            m_nbStale++;
+            compactIfNeeded();
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// accès directe à toutes les entités, y compris détruites (ordre quelconque)
+    const std::vector<T* >& get() const
+    {
+        return m_entities;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// retourne la ième entité (ordre quelconque)
+    T* get(uint ind) const
+    {
+        return m_entities[ind];
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// copie les entités non détruites, suivant l'ordre des unique id
+    void getVisible(std::vector<T* >& entities) const
+    {
+        compact();
+        entities.assign(m_visible.begin(), m_visible.end());
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return  la dernière entité non détruite (plus grand unique id), ou 0
+    T* getLastVisible() const
+    {
+        compact();
+        return m_visible.empty() ? 0 : m_visible.back();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return  Le nombre d'entités, y compris détruites
+    uint getNb() const
+    {
+        return m_entities.size();
+    }
+
+    /// \return  Le nombre d'entités non détruites
+    uint getVisibleNb() const
+    {
+        return m_nbVisible;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// \return  vrai s'il est vide
+    bool empty() const
+    {
+        return m_entities.empty();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// recherche si une entité est présente ou non
+    bool find(const T* entity) const
+    {
+        return m_slots.indexOf(const_cast<T*>(entity)) != m_slots.npos();
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// retourne l'indice d'une entité, une exception si l'entité n'est pas trouvée
+    uint getIndex(const T* entity) const
+    {
+        const size_t idx = m_slots.indexOf(const_cast<T*>(entity));
+        if (idx == m_slots.npos())
+            throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne avec EntityContainer::getIndex, entité non trouvée", TkUtil::Charset::UTF_8));
+        return m_slots.at(idx).second.m_index;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /** retire de la liste des entités non détruites celles qui ont été
+     *  détruites ou enlevées, et la trie si nécessaire
+     */
+    void compact() const
+    {
+        if (0 == m_nbStale && !m_removedListed && m_sorted)
+            return;
+
+        size_t nb = 0;
+        for (size_t i=0; i<m_visible.size(); i++){
+            const size_t idx = m_slots.indexOf(m_visible[i]);
+            // entité enlevée (peut-être déjà détruite)
+            if (idx == m_slots.npos())
+                continue;
+            Slot& slot = m_slots.at(idx).second;
+            if (slot.m_state & VISIBLE)
+                m_visible[nb++] = m_visible[i];
+            else
+                slot.m_state &= ~LISTED;
+        }
+        m_visible.resize(nb);
+        m_nbStale = 0;
+        m_removedListed = false;
+
+        if (!m_sorted){
+            std::sort(m_visible.begin(), m_visible.end(), compareUniqueId);
+            m_sorted = true;
+        }
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// vide le conteneur
+    void clear()
+    {
+        m_entities.clear();
+        m_slots.clear();
+        m_visible.clear();
+        m_nbVisible = 0;
+        m_nbStale = 0;
+        m_sorted = true;
+        m_removedListed = false;
+    }
+
+    /*----------------------------------------------------------------------------*/
+    /// détruit les entités du conteneur et le vide
+    void deleteAndClear()
+    {
+        // le conteneur est vidé avant, les destructeurs ne le trouvent pas
+        std::vector<T* > entities;
+        entities.swap(m_entities);
+        clear();
+
+        for (uint i = 0; i<entities.size(); ++i)
+            delete entities[i];
+    }
+
+private:
+    EntityContainer(const EntityContainer&);
+    EntityContainer& operator = (const EntityContainer&);
+
+    /// états d'une entité
+    enum {
+        /// entité non détruite
+        VISIBLE = 1,
+        /// entité présente dans m_visible
+        LISTED  = 2
+    };
+
+    /// emplacement et état d'une entité
+    struct Slot {
+        uint m_index;
+        uint m_state;
+    };
+
+    static bool compareUniqueId(const T* e1, const T* e2)
+    {
+        return e1->getUniqueId() < e2->getUniqueId();
+    }
+
+    /// compactage périodique
+    void compactIfNeeded()
+    {
+        if (0 != m_compactionPeriod && m_nbStale >= m_compactionPeriod)
+            compact();
+    }
+
+    /// ajoute l'entité en fin de liste des entités non détruites
+    void list(T* entity, Slot& slot)
+    {
+        // la dernière entrée peut être une entité enlevée (et détruite)
+        if (m_removedListed)
+            compact();
+        if (!m_visible.empty() && !compareUniqueId(m_visible.back(), entity))
+            m_sorted = false;
+        m_visible.push_back(entity);
+        slot.m_state |= LISTED;
+    }
+
+    /// toutes les entités
+    std::vector<T* > m_entities;
+
+    /// emplacement dans m_entities et état de chaque entité
+    mutable IndexedMap<T*, Slot> m_slots;
+
+    /** les entités non détruites suivant les unique id, plus celles
+     *  détruites ou enlevées depuis le dernier compactage
+     */
+    mutable std::vector<T* > m_visible;
+
+    /// nombre d'entités non détruites
+    uint m_nbVisible;
+
+    /// nombre d'entrées de m_visible à retirer
+    mutable uint m_nbStale;
+
+    /// vrai si m_visible est trié
+    mutable bool m_sorted;
+
+    /// vrai si m_visible contient des entités enlevées du conteneur
+    mutable bool m_removedListed;
+
+    /// nombre d'entrées à retirer qui déclenche le compactage, 0 si aucun
+    uint m_compactionPeriod;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+
+#endif /* UTILS_ENTITYCONTAINER_H_ */
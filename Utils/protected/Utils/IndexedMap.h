@@ -0,0 +1,300 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file IndexedMap.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_UTILS_INDEXEDMAP_H_
+#define MGX3D_UTILS_INDEXEDMAP_H_
+/*----------------------------------------------------------------------------*/
+#include <sys/types.h>
+#include <stdint.h>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Association clé (pointeur) -> valeur, en remplacement d'une
+   std::map<K*, V> lorsque l'on ne fait qu'ajouter, rechercher et parcourir.
+
+   Les couples sont rangés dans un vecteur dans l'ordre d'insertion, une table
+   de hachage à adressage ouvert (sondage linéaire) donne l'indice d'une clé
+   dans ce vecteur. Recherche et insertion se font en O(1) en moyenne, le
+   parcours est contigu et ne dépend pas des adresses des objets.
+
+   Comme pour une std::map, l'opérateur [] insère la valeur par défaut V()
+   lorsque la clé est absente. Les itérateurs sont des indices dans le
+   vecteur : ils restent valides lorsque l'on ajoute des couples pendant un
+   parcours (les nouveaux couples sont alors parcourus à leur tour).
+   La suppression d'un couple (erase) le remplace par le dernier couple du
+   vecteur : elle se fait en O(1) mais ne conserve pas l'ordre d'insertion.
+   Le compteur de suppressions (erasures) permet à un index externe sur les
+   indices des couples de savoir s'il est toujours valide.
+ */
+template <typename K, typename V>
+class IndexedMap {
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<K, V> value_type;
+
+    /// itérateur (indice dans le vecteur des couples)
+    template <typename M, typename T>
+    class Iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        Iterator() : m_map(0), m_index(0) { }
+        Iterator(M* map, size_t index) : m_map(map), m_index(index) { }
+        /// conversion iterator -> const_iterator
+        template <typename M2, typename T2>
+        Iterator(const Iterator<M2, T2>& it) : m_map(it.m_map), m_index(it.m_index) { }
+
+        T& operator*() const {return m_map->m_items[m_index];}
+        T* operator->() const {return &m_map->m_items[m_index];}
+        Iterator& operator++() {++m_index; return *this;}
+        Iterator operator++(int) {Iterator it(*this); ++m_index; return it;}
+        bool operator==(const Iterator& it) const
+        {return m_index == it.m_index || (atEnd() && it.atEnd());}
+        bool operator!=(const Iterator& it) const {return !(*this == it);}
+
+        /// indice du couple dans l'ordre d'insertion
+        size_t index() const {return m_index;}
+
+    private:
+        template <typename M2, typename T2> friend class Iterator;
+        bool atEnd() const {return 0 == m_map || m_index >= m_map->m_items.size();}
+        M* m_map;
+        size_t m_index;
+    };
+
+    /** L'itérateur de fin compare l'indice à celui du vecteur au moment de
+     *  chaque comparaison, il suit donc les ajouts faits pendant le parcours.
+     */
+    typedef Iterator<IndexedMap, value_type> iterator;
+    typedef Iterator<const IndexedMap, const value_type> const_iterator;
+
+    IndexedMap() : m_items(), m_table(), m_erasures(0) { }
+
+    /// le compteur de suppressions change, les indices pouvant différer
+    IndexedMap& operator=(const IndexedMap& map)
+    {
+        if (&map != this){
+            m_items = map.m_items;
+            m_table = map.m_table;
+            m_erasures = (m_erasures > map.m_erasures ? m_erasures : map.m_erasures) + 1;
+        }
+        return *this;
+    }
+
+    iterator begin() {return iterator(this, 0);}
+    iterator end() {return iterator(this, npos());}
+    const_iterator begin() const {return const_iterator(this, 0);}
+    const_iterator end() const {return const_iterator(this, npos());}
+
+    size_t size() const {return m_items.size();}
+    bool empty() const {return m_items.empty();}
+
+    /** nombre de suppressions (erase, clear, affectation) depuis la création :
+     *  tant qu'il ne change pas, les couples gardent leurs indices
+     */
+    unsigned long erasures() const {return m_erasures;}
+
+    /// accès direct au couple d'indice i (ordre d'insertion)
+    value_type& at(size_t i) {return m_items[i];}
+    const value_type& at(size_t i) const {return m_items[i];}
+
+    /// indice du couple de clé key, npos() si absent
+    size_t indexOf(const K& key) const
+    {
+        if (m_table.empty())
+            return npos();
+        const size_t mask = m_table.size()-1;
+        for (size_t slot = hash(key) & mask; ; slot = (slot+1) & mask){
+            const size_t idx = m_table[slot];
+            if (0 == idx)
+                return npos();
+            if (m_items[idx-1].first == key)
+                return idx-1;
+        }
+    }
+
+    iterator find(const K& key)
+    {
+        const size_t idx = indexOf(key);
+        return idx == npos() ? end() : iterator(this, idx);
+    }
+
+    const_iterator find(const K& key) const
+    {
+        const size_t idx = indexOf(key);
+        return idx == npos() ? end() : const_iterator(this, idx);
+    }
+
+    size_t count(const K& key) const {return indexOf(key) == npos() ? 0 : 1;}
+
+    /** ajoute le couple si la clé est absente
+     *  \return l'itérateur sur le couple de la clé et vrai s'il a été ajouté
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        size_t idx = indexOf(value.first);
+        if (idx != npos())
+            return std::make_pair(iterator(this, idx), false);
+        idx = append(value);
+        return std::make_pair(iterator(this, idx), true);
+    }
+
+    /// valeur associée à la clé, insertion de V() si absente
+    V& operator[](const K& key)
+    {
+        size_t idx = indexOf(key);
+        if (idx == npos())
+            idx = append(value_type(key, V()));
+        return m_items[idx].second;
+    }
+
+    /// réserve la place pour nb couples
+    void reserve(size_t nb)
+    {
+        m_items.reserve(nb);
+        if (nb*2 > m_table.size())
+            rehash(nb*2);
+    }
+
+    /** enlève le couple de clé key, remplacé dans le vecteur par le dernier
+     *  couple (dont l'indice change donc)
+     *  \return le nombre de couples enlevés (0 ou 1)
+     */
+    size_t erase(const K& key)
+    {
+        const size_t idx = indexOf(key);
+        if (idx == npos())
+            return 0;
+
+        unplace(idx);
+        const size_t last = m_items.size()-1;
+        if (idx != last){
+            m_table[slotOf(last)] = idx+1;
+            m_items[idx] = m_items[last];
+        }
+        m_items.pop_back();
+        m_erasures++;
+        return 1;
+    }
+
+    void clear()
+    {
+        m_items.clear();
+        m_table.clear();
+        m_erasures++;
+    }
+
+    /// indice invalide
+    static size_t npos() {return (size_t)-1;}
+
+private:
+    template <typename M, typename T> friend class Iterator;
+
+    /// mélange des bits de l'adresse (les bits de poids faible sont nuls du fait de l'alignement)
+    static size_t hash(const K& key)
+    {
+        uint64_t h = (uint64_t)(uintptr_t)key;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return (size_t)h;
+    }
+
+    /// ajout d'un couple dont la clé est absente, retourne son indice
+    size_t append(const value_type& value)
+    {
+        // taux de remplissage maintenu sous 1/2
+        if ((m_items.size()+1)*2 > m_table.size())
+            rehash((m_items.size()+1)*2);
+        m_items.push_back(value);
+        place(m_items.size()-1);
+        return m_items.size()-1;
+    }
+
+    /// range l'indice idx dans la table
+    void place(size_t idx)
+    {
+        const size_t mask = m_table.size()-1;
+        size_t slot = hash(m_items[idx].first) & mask;
+        while (m_table[slot] != 0)
+            slot = (slot+1) & mask;
+        m_table[slot] = idx+1;
+    }
+
+    /// emplacement dans la table de l'indice idx
+    size_t slotOf(size_t idx) const
+    {
+        const size_t mask = m_table.size()-1;
+        size_t slot = hash(m_items[idx].first) & mask;
+        while (m_table[slot] != idx+1)
+            slot = (slot+1) & mask;
+        return slot;
+    }
+
+    /** libère l'emplacement de l'indice idx, les suivants de la même suite
+     *  sont recalés pour que les recherches ne s'arrêtent pas sur le trou
+     */
+    void unplace(size_t idx)
+    {
+        const size_t mask = m_table.size()-1;
+        size_t hole = slotOf(idx);
+        for (size_t slot = (hole+1) & mask; m_table[slot] != 0; slot = (slot+1) & mask){
+            const size_t home = hash(m_items[m_table[slot]-1].first) & mask;
+            // l'élément peut remplir le trou si son emplacement de départ
+            // n'est pas dans l'intervalle (hole, slot]
+            const bool between = hole <= slot
+                    ? (hole < home && home <= slot)
+                    : (hole < home || home <= slot);
+            if (!between){
+                m_table[hole] = m_table[slot];
+                hole = slot;
+            }
+        }
+        m_table[hole] = 0;
+    }
+
+    /// reconstruit la table avec au moins nb emplacements (puissance de 2)
+    void rehash(size_t nb)
+    {
+        size_t capacity = 16;
+        while (capacity < nb)
+            capacity *= 2;
+        m_table.assign(capacity, 0);
+        for (size_t i=0; i<m_items.size(); i++)
+            place(i);
+    }
+
+    /// les couples dans l'ordre d'insertion
+    std::vector<value_type> m_items;
+
+    /// table de hachage : indice+1 dans m_items, 0 pour un emplacement libre
+    std::vector<size_t> m_table;
+
+    /// nombre de suppressions
+    unsigned long m_erasures;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_UTILS_INDEXEDMAP_H_ */
+/*----------------------------------------------------------------------------*/
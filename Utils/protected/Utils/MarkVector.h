@@ -0,0 +1,194 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MarkVector.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_UTILS_MARKVECTOR_H_
+#define MGX3D_UTILS_MARKVECTOR_H_
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Mutex.h>
+
+#include <sys/types.h>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Marques (entiers) indexées par un identifiant compact (id de noeud
+   gmds par exemple), en remplacement des filtres du type
+   std::map<gmds::TCellID, uint>.
+
+   Une marque non positionnée vaut 0, comme pour l'opérateur [] d'une
+   std::map<., uint>. Lecture et écriture se font en O(1), sans allocation
+   lorsque la taille est réservée (sinon le tableau est agrandi à la demande).
+   L'effacement de toutes les marques (clear) se fait en O(1) grâce à un
+   numéro de génération associé à chaque emplacement, ce qui permet de
+   réutiliser un même MarkVector pour plusieurs parcours.
+ */
+class MarkVector {
+public:
+    /// Constructeur avec réservation des indices [0, size[
+    MarkVector(size_t size = 0)
+    : m_slots(size), m_generation(1)
+    { }
+
+    /// Nombre d'emplacements réservés
+    size_t size() const
+    { return m_slots.size(); }
+
+    /// Réserve les emplacements pour les indices [0, size[, les marques sont conservées
+    void resize(size_t size)
+    {
+        if (size > m_slots.size())
+            m_slots.resize(size);
+    }
+
+    /// Retourne la marque associée à l'identifiant, 0 si non marqué
+    uint get(size_t id) const
+    {
+        return (id < m_slots.size() && m_slots[id].generation == m_generation)
+                ? m_slots[id].mark : 0;
+    }
+
+    /// Idem get
+    uint operator[](size_t id) const
+    { return get(id); }
+
+    /// Vrai si une marque non nulle est associée à l'identifiant
+    bool isMarked(size_t id) const
+    { return 0 != get(id); }
+
+    /// Associe une marque à l'identifiant
+    void set(size_t id, uint mark)
+    {
+        if (id >= m_slots.size())
+            m_slots.resize(id < m_slots.size()*2 ? m_slots.size()*2 : id+1);
+        m_slots[id].generation = m_generation;
+        m_slots[id].mark = mark;
+    }
+
+    /// Efface toutes les marques
+    void clear()
+    {
+        if (0 == ++m_generation){
+            // rebouclage du numéro de génération, on réinitialise tout
+            for (std::vector<Slot>::iterator iter = m_slots.begin();
+                    iter != m_slots.end(); ++iter)
+                iter->generation = 0;
+            m_generation = 1;
+        }
+    }
+
+private:
+    /// un emplacement, la marque n'est valide que pour la génération courante
+    struct Slot {
+        Slot() : generation(0), mark(0) { }
+        uint generation;
+        uint mark;
+    };
+
+    /// les emplacements, indexés par l'identifiant
+    std::vector<Slot> m_slots;
+
+    /// génération courante (jamais 0)
+    uint m_generation;
+};
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Réserve de MarkVector persistants, associée à un maillage.
+
+   Un MarkVector local à une fonction est dimensionné au plus grand
+   identifiant rencontré, ce qui coûte O(id max) à chaque appel même pour un
+   petit sous-ensemble de noeuds. Les MarkVector de la réserve sont conservés
+   d'un appel à l'autre et remis à zéro par changement de génération (O(1)) :
+   seul le premier parcours paie le dimensionnement.
+
+   Plusieurs tables peuvent être empruntées simultanément (appels imbriqués,
+   threads), chacune par un MarkVectorLease.
+ */
+class MarkVectorPool {
+public:
+    MarkVectorPool()
+    : m_free(), m_mutex()
+    { }
+
+    ~MarkVectorPool()
+    {
+        for (std::vector<MarkVector*>::iterator iter = m_free.begin();
+                iter != m_free.end(); ++iter)
+            delete *iter;
+    }
+
+    /// Emprunte une table, sans marque positionnée
+    MarkVector* acquire()
+    {
+        MarkVector* marks = 0;
+        {
+            TkUtil::AutoMutex autoMutex (&m_mutex);
+            if (false == m_free.empty()){
+                marks = m_free.back();
+                m_free.pop_back();
+            }
+        }
+        if (0 == marks)
+            marks = new MarkVector();
+        marks->clear();
+        return marks;
+    }
+
+    /// Rend une table empruntée par acquire
+    void release(MarkVector* marks)
+    {
+        TkUtil::AutoMutex autoMutex (&m_mutex);
+        m_free.push_back(marks);
+    }
+
+private:
+    /// Constructeur de copie et opérateur =. Interdits.
+    MarkVectorPool(const MarkVectorPool&);
+    MarkVectorPool& operator=(const MarkVectorPool&);
+
+    /// les tables disponibles
+    std::vector<MarkVector*> m_free;
+
+    /// protège m_free
+    TkUtil::Mutex m_mutex;
+};
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Emprunt d'un MarkVector à une réserve pour la durée d'une portée.
+ */
+class MarkVectorLease {
+public:
+    MarkVectorLease(MarkVectorPool& pool)
+    : m_pool(pool), m_marks(pool.acquire())
+    { }
+
+    ~MarkVectorLease()
+    { m_pool.release(m_marks); }
+
+    /// La table empruntée
+    MarkVector& marks()
+    { return *m_marks; }
+
+private:
+    /// Constructeur de copie et opérateur =. Interdits.
+    MarkVectorLease(const MarkVectorLease&);
+    MarkVectorLease& operator=(const MarkVectorLease&);
+
+    MarkVectorPool& m_pool;
+    MarkVector* m_marks;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_UTILS_MARKVECTOR_H_ */
+/*----------------------------------------------------------------------------*/
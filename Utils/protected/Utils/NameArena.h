@@ -0,0 +1,88 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file NameArena.h
+ *
+ *  \author Team Magix3D
+ *
+ *  \date 19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef UTILS_NAMEARENA_H_
+#define UTILS_NAMEARENA_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <stddef.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Utils {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class NameArena
+ * \brief Stockage des noms des entités (voir Property).
+ *
+ *  Chaque nom n'est stocké qu'une fois (internement), à la suite des autres
+ *  dans de grands blocs mémoire, au lieu d'une std::string par entité.
+ *
+ *  Les noms sont comptés par référence : une référence est prise par
+ *  intern ou acquire et rendue par release. Un nom qui n'est plus référencé
+ *  est retiré de la table, et un bloc est libéré dès qu'il ne contient plus
+ *  aucun nom référencé (destructions d'entités au cours d'une longue
+ *  session). Une chaîne rendue reste valide tant qu'elle est référencée.
+ *
+ *  L'accès est protégé par un mutex (les entités sont créées par les
+ *  commandes, éventuellement dans des threads).
+ */
+class NameArena{
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \return la chaîne internée égale à name, avec une référence de plus
+     */
+    static const char* intern(const std::string& name);
+
+    /*------------------------------------------------------------------------*/
+    /** Ajoute une référence à une chaîne rendue par intern
+     *  \return name
+     */
+    static const char* acquire(const char* name);
+
+    /*------------------------------------------------------------------------*/
+    /** Rend une référence prise par intern ou acquire, le nom est libéré
+     *  s'il n'est plus référencé
+     */
+    static void release(const char* name);
+
+    /*------------------------------------------------------------------------*/
+    /** \return le nombre de noms internés (distincts et référencés)
+     */
+    static size_t getNbNames();
+
+    /*------------------------------------------------------------------------*/
+    /** \return la mémoire occupée par l'arène (blocs et table), en octets
+     */
+    static size_t getMemory();
+
+    /*------------------------------------------------------------------------*/
+    /** \return la mémoire économisée, en octets : celle qu'occuperait une
+     *  std::string par référence (avec son éventuelle allocation), moins
+     *  celle de l'arène et des pointeurs des références. Négative lorsque
+     *  les noms sont peu partagés et tous assez courts pour être stockés
+     *  dans la std::string elle-même.
+     */
+    static long getSavedMemory();
+
+private:
+
+    NameArena();
+    NameArena(const NameArena&);
+    NameArena& operator = (const NameArena&);
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Utils
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* UTILS_NAMEARENA_H_ */
+/*----------------------------------------------------------------------------*/
@@ -19,6 +19,11 @@ namespace Utils {
 /**
  * \class Property
  * \brief Propriété commune à toutes les entités (nom ...)
+ *
+ *  Le nom est interné (voir NameArena) : les entités ne stockent qu'un
+ *  pointeur, et les noms identiques (ex : après un undo) ne sont stockés
+ *  qu'une fois. Le nom est rendu à NameArena à la destruction de la
+ *  propriété.
  */
 class Property{
 
@@ -29,6 +34,12 @@ public:
      */
     Property(const std::string& name);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur de copie et opérateur =, le nom est partagé
+     */
+    Property(const Property& prop);
+    Property& operator = (const Property& prop);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Destructeur
      */
@@ -49,8 +60,8 @@ public:
     /*------------------------------------------------------------------------*/
 protected:
 
-    /** nom de l'objet */
-    std::string m_name;
+    /** nom de l'objet, interné dans NameArena */
+    const char* m_name;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Utils
@@ -4,6 +4,7 @@
 
 #include "SelectionManagerIfc.h"
 #include "Entity.h"
+#include "IndexedMap.h"
 
 #include <TkUtil/Mutex.h>
 
@@ -283,6 +284,12 @@ class SelectionManager : public Mgx3D::Utils::SelectionManagerIfc
 
 	//@}	// Les observateurs de sélection.
 
+	/**
+	 * Nombre de noms d'entités au-delà duquel les messages d'ajout/retrait
+	 * de la sélection sont résumés (nombre d'entités et premiers noms).
+	 */
+	static size_t	maxLoggedNames;
+
 
 	protected :
 
@@ -301,6 +308,14 @@ class SelectionManager : public Mgx3D::Utils::SelectionManagerIfc
 	 */
 	 virtual void log (const TkUtil::Log& log);
 
+	/**
+	 * Envoie le log de modification de la sélection (<I>header</I> suivi des
+	 * noms des entités transmises en argument). Au delà de
+	 * <I>maxLoggedNames</I> entités le message est résumé.
+	 */
+	virtual void logEntities (const std::string& header,
+					const std::vector<Mgx3D::Utils::Entity*>& entities);
+
 	/**
 	 * Informe les observateurs d'une modification de la politique de sélection.
 	 * \param	Eventuel pointeur sur des données décrivant ce changement de
@@ -326,9 +341,13 @@ class SelectionManager : public Mgx3D::Utils::SelectionManagerIfc
 	/** Le nom unique du gestionnaire de sélection. */
 	std::string												_name;
 
-	/** Les entités de la sélection. */
+	/** Les entités de la sélection, dans l'ordre de sélection. */
 	std::vector<Mgx3D::Utils::Entity*>						_entities;
 
+	/** Index (table de hachage) des entités de la sélection, pour les
+	 * tests d'appartenance. */
+	Mgx3D::Utils::IndexedMap<const Mgx3D::Utils::Entity*, bool>	_selected;
+
 	/** Les observateurs de la sélection. */
 	std::vector<Mgx3D::Utils::SelectionManagerObserverIfc*>	_observers;
 
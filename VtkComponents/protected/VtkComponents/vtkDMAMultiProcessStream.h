@@ -44,6 +44,8 @@
 #include <vector> // needed for vector.
 #include <string> // needed for string.
 
+class vtkSocket;
+
 //class VTKPARALLELCORE_EXPORT vtkDMAMultiProcessStream
 class vtkDMAMultiProcessStream
 {
@@ -165,6 +167,40 @@ public:
   void SetRawData(const unsigned char*, unsigned int size);
   //@}
 
+  //@{
+  /**
+   * CP : accès sans recopie aux données brutes (même contenu que GetRawData).
+   * Le pointeur retourné n'est valide que jusqu'à la prochaine modification
+   * du flux.
+   */
+  void GetRawDataView(const unsigned char*& data, unsigned int& size);
+
+  /**
+   * CP : ajoute en fin de flux les données brutes d'un autre flux (issues
+   * de GetRawData, de vtkMultiProcessStream::GetRawData, ...).
+   */
+  void AppendRawData(const unsigned char* data, unsigned int size);
+
+  /**
+   * CP : retire size octets en tête du flux.
+   */
+  void Skip(unsigned int size);
+  //@}
+
+  //@{
+  /**
+   * CP : envoi/réception du flux sur une socket connectée (vtkUnixClientSocket,
+   * socket retournée par vtkUnixServerSocket::WaitForConnection, ...) : taille
+   * des données brutes (4 octets, ordre réseau) puis données brutes.
+   * L'envoi transmet en-tête et données en un seul appel système (sendmsg,
+   * scatter/gather) sans les concaténer, la réception se fait directement
+   * dans le tampon du flux.
+   * Retournent 1 en cas de succès, 0 en cas d'erreur.
+   */
+  int Send(vtkSocket* socket);
+  int Receive(vtkSocket* socket);
+  //@}
+
 private:
   class vtkInternals;
   vtkInternals* Internals;
@@ -5,6 +5,10 @@
 #include <vtkSynchronizedRenderers.h>
 #include <vtkCompositeRenderManager.h>
 
+#include <vector>
+
+class vtkRenderWindow;
+class vtkSocket;
 
 /*
  * Classe créé juste pour profiter de la classe
@@ -20,6 +24,126 @@ class vtkDMASynchronizedRenderers : public vtkSynchronizedRenderers
 	static void copyRenderingParameters (vtkRenderer& fromRenderer, vtkDMAMultiProcessStream& serializedMessage);
 	static void copyRenderingParameters (vtkDMAMultiProcessStream& serializedMessage, vtkRenderer& toRenderer);
 
+	/**
+	 * Codages possibles des images (couleurs RGBA ou profondeurs) transmises
+	 * en mode client/serveur, du moins au plus élaboré :
+	 * <UL>
+	 * <LI>RAW_IMAGE : image brute,
+	 * <LI>RLE_IMAGE : image découpée en tuiles compressées par plages
+	 * (<I>run-length encoding</I> sur des pixels entiers),
+	 * <LI>DELTA_RLE_IMAGE : idem, seules les tuiles modifiées depuis l'image
+	 * précédente sont transmises.
+	 * </UL>
+	 * Le codage est choisi pour chaque image parmi ceux autorisés : une
+	 * image que la compression ne réduit pas est transmise brute.
+	 */
+	enum IMAGE_CODEC { RAW_IMAGE = 0, RLE_IMAGE = 1, DELTA_RLE_IMAGE = 2 };
+
+	/**
+	 * Négociation, à l'ouverture de la connexion, du codage le plus élaboré
+	 * connu des deux côtés. Chaque côté appelle cette fonction avec le
+	 * codage le plus élaboré qu'il accepte.
+	 * \return	le codage retenu, RAW_IMAGE si le pair utilise une autre version
+	 * 			du protocole.
+	 * \except	std::runtime_error en cas d'erreur de communication
+	 */
+	static IMAGE_CODEC negotiateImageCodec (vtkSocket& socket, IMAGE_CODEC maxCodec);
+
+	/**
+	 * Codeur d'images successives d'une même connexion (conserve l'image
+	 * précédente pour le codage différentiel).
+	 */
+	class ImageEncoder
+	{
+		public :
+
+		ImageEncoder (IMAGE_CODEC maxCodec = RAW_IMAGE);
+
+		/** Codage négocié. Modifier le codage oublie l'image précédente. */
+		void setCodec (IMAGE_CODEC maxCodec);
+		IMAGE_CODEC getCodec ( ) const
+		{ return _maxCodec; }
+
+		/**
+		 * Ajoute au flux l'image de width x height pixels de components octets
+		 * chacun (4 pour du RGBA en unsigned char ou une profondeur en float).
+		 * \return	le codage utilisé pour cette image
+		 */
+		IMAGE_CODEC encode (const unsigned char* pixels, int width, int height, int components, vtkDMAMultiProcessStream& stream);
+
+		/** Oublie l'image précédente (la suivante est codée sans référence). */
+		void reset ( );
+
+
+		private :
+
+		ImageEncoder (const ImageEncoder&);
+		ImageEncoder& operator = (const ImageEncoder&);
+
+		IMAGE_CODEC					_maxCodec;
+		int							_width, _height, _components;
+		std::vector<unsigned char>	_previous, _payload, _tile;
+	};	// class ImageEncoder
+
+	/**
+	 * Décodeur des images produites par un ImageEncoder. Conserve l'image
+	 * décodée qui sert de référence pour l'image suivante.
+	 */
+	class ImageDecoder
+	{
+		public :
+
+		ImageDecoder ( );
+
+		/**
+		 * Retire du flux une image et la décode.
+		 * \return	les pixels de l'image, valides jusqu'au prochain appel
+		 * \except	std::runtime_error si le flux est invalide
+		 */
+		const unsigned char* decode (vtkDMAMultiProcessStream& stream, int& width, int& height, int& components);
+
+		/** Oublie l'image précédente. */
+		void reset ( );
+
+
+		private :
+
+		ImageDecoder (const ImageDecoder&);
+		ImageDecoder& operator = (const ImageDecoder&);
+
+		int							_width, _height, _components;
+		std::vector<unsigned char>	_frame, _payload, _tile;
+	};	// class ImageDecoder
+
+	/**
+	 * Transfert d'une image sur une socket connectée : l'image est codée par
+	 * encoder (codage négocié par negotiateImageCodec) puis envoyée avec
+	 * vtkDMAMultiProcessStream::Send, en un seul appel système.
+	 * \return	le codage utilisé pour cette image
+	 * \except	std::runtime_error en cas d'erreur de communication
+	 */
+	static IMAGE_CODEC sendImage (vtkSocket& socket, ImageEncoder& encoder, const unsigned char* pixels, int width, int height, int components);
+
+	/**
+	 * Envoi de l'image RGBA affichée par la fenêtre.
+	 */
+	static IMAGE_CODEC sendImage (vtkSocket& socket, ImageEncoder& encoder, vtkRenderWindow& window);
+
+	/**
+	 * Réception d'une image envoyée par sendImage, reçue directement dans le
+	 * tampon du flux puis décodée par decoder.
+	 * \return	les pixels de l'image, valides jusqu'au prochain appel à decoder
+	 * \except	std::runtime_error en cas d'erreur de communication ou d'image
+	 * 			invalide
+	 */
+	static const unsigned char* receiveImage (vtkSocket& socket, ImageDecoder& decoder, int& width, int& height, int& components);
+
+	/**
+	 * Réception d'une image RGBA de la taille de la fenêtre et affichage dans
+	 * celle-ci.
+	 */
+	static void receiveImage (vtkSocket& socket, ImageDecoder& decoder, vtkRenderWindow& window);
+
 
 	private :
 
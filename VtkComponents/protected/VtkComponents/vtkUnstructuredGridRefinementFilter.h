@@ -7,11 +7,15 @@
 #include <vtkUnstructuredGridToUnstructuredGridFilter.h>
 #endif	// VTK_5
 #include <vtkIndent.h>
-#include <vtkCell.h>
 #include <iostream>
 
 
 /** Filtre permettant de raffiner les mailles d'une grille non structure.
+ * Les segments (lignes et polylignes) et triangles (triangles et bandes de
+ * triangles) sont raffins, les autres mailles sont ignores. Les points
+ * crs sur une arte sont partags par les mailles adjacentes.
+ * Le traitement, effectu en plusieurs passes (comptage puis remplissage de
+ * tableaux prallous), est paralllis avec vtkSMPTools.
  *
  * @author		Charles PIGNEROL, CEA/DAM/DSSI
  */
@@ -69,6 +73,8 @@ class vtkUnstructuredGridRefinementFilter :
 
 	/**
 	 * Effectue le traitement de raffinage.
+	 * @warning	Les identifiants des points de la grille en entre doivent
+	 *			tenir sur 32 bits.
 	 */
 #ifndef VTK_5
 	virtual int RequestData (
@@ -78,22 +84,6 @@ class vtkUnstructuredGridRefinementFilter :
 	virtual void Execute ( );
 #endif	// VTK_5
 
-	/**
-	 * Les algorithmes de raffinage.
-	 * @see		AllocateTriangleBuffer
-	 */
-	virtual void refineLine (
-				vtkCell& cell, vtkPoints& points, vtkUnstructuredGrid& grid);
-	virtual void refineTriangle (
-				vtkCell& cell, vtkPoints& points, vtkUnstructuredGrid& grid);
-
-	/** (Des)alloue un tampon de taille
-	 * (_refinementFactor+1) x (_refinementFactor+1) pour le raffinement des
-	 * mailles de type triangle.
-	 */
-	virtual void AllocateTriangleBuffer ( );
-	virtual void DesallocateTriangleBuffer ( );
-
 
 	private :
 
@@ -107,14 +97,6 @@ class vtkUnstructuredGridRefinementFilter :
 
 	/** Le facteur de raffinement. */
 	unsigned int			_refinementFactor;
-
-	/** Tampon pour stocker les ids des noeuds utiliss lors du raffinement
-	 * des triangles. Ce buffer est de dimension
-	 * (_refinementFactor+1) x (_refinementFactor+1).
-	 * @see		AllocateTriangleBuffer
-	 * @see		DesallocateTriangleBuffer
-	 * */
-	vtkIdType**				_triangleBuffer;
 };	// class vtkUnstructuredGridRefinementFilter
 
 
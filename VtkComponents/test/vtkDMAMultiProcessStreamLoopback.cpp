@@ -0,0 +1,229 @@
+/**
+ * Test de débit de vtkDMAMultiProcessStream sur une paire de sockets UNIX :
+ * Send/Receive (envoi scatter/gather, réception dans le tampon du flux)
+ * comparés à l'envoi des données brutes recopiées par GetRawData, puis
+ * transfert d'images compressées (vtkDMASynchronizedRenderers::sendImage et
+ * receiveImage).
+ * Retourne 0 en cas de succès.
+ */
+
+#include "VtkComponents/vtkDMAMultiProcessStream.h"
+#include "VtkComponents/vtkDMASynchronizedRenderers.h"
+
+#include <vtkSocket.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+
+// Socket VTK sur un descripteur existant (socketpair)
+class vtkLoopbackSocket : public vtkSocket
+{
+	public :
+
+	vtkTypeMacro (vtkLoopbackSocket, vtkSocket);
+	static vtkLoopbackSocket* New ( )
+	{
+		vtkLoopbackSocket*	socket	= new vtkLoopbackSocket ( );
+#ifndef VTK_5
+		socket->InitializeObjectBase ( );
+#endif  // VTK_5
+		return socket;
+	}
+	void Attach (int descriptor)
+	{ this->SocketDescriptor	= descriptor; }
+
+
+	protected :
+
+	vtkLoopbackSocket ( )
+		: vtkSocket ( )
+	{ }
+
+
+	private :
+
+	vtkLoopbackSocket (const vtkLoopbackSocket&);
+	vtkLoopbackSocket& operator = (const vtkLoopbackSocket&);
+};	// class vtkLoopbackSocket
+
+
+static const unsigned int	valuesNum	= 8 * 1024 * 1024;	// 64 Mo de doubles
+static const int			loops		= 4;
+
+
+static void fill (vtkDMAMultiProcessStream& stream)
+{
+	std::vector<double>	values (valuesNum);
+	for (unsigned int i = 0; i < valuesNum; i++)
+		values [i]	= 0.5 * i;
+	stream.Reset ( );
+	stream.Push (&values [0], valuesNum);
+}	// fill
+
+
+static bool check (vtkDMAMultiProcessStream& stream)
+{
+	double*			values	= 0;
+	unsigned int	size	= 0;
+	stream.Pop (values, size);
+	bool	ok	= (valuesNum == size) && (0 != values);
+	for (unsigned int i = 0; ok && (i < valuesNum); i++)
+		ok	= (0.5 * i == values [i]);
+	delete [] values;
+
+	return ok;
+}	// check
+
+
+// Envoi par Send, réception par Receive
+static void sendStream (vtkLoopbackSocket* socket, vtkDMAMultiProcessStream* stream)
+{
+	for (int l = 0; l < loops; l++)
+		stream->Send (socket);
+}	// sendStream
+
+
+// Envoi des données brutes recopiées : taille (ordre réseau) puis données
+static void sendRawData (vtkLoopbackSocket* socket, vtkDMAMultiProcessStream* stream)
+{
+	for (int l = 0; l < loops; l++)
+	{
+		std::vector<unsigned char>	raw;
+		stream->GetRawData (raw);
+		const uint32_t	header	= htonl (static_cast<uint32_t>(raw.size ( )));
+		socket->Send (&header, sizeof (header));
+		socket->Send (&raw [0], static_cast<int>(raw.size ( )));
+	}
+}	// sendRawData
+
+
+static const int	imageWidth	= 640;
+static const int	imageHeight	= 480;
+static const int	imagesNum	= 20;
+
+
+// Image RGBA : disque se déplaçant sur un fond uni
+static void drawImage (int frame, std::vector<unsigned char>& pixels)
+{
+	pixels.resize (4 * imageWidth * imageHeight);
+	const int	cx	= 100 + 10 * frame, cy	= 240, r	= 50;
+	for (int y = 0; y < imageHeight; y++)
+		for (int x = 0; x < imageWidth; x++)
+		{
+			unsigned char*	p	= &pixels [4 * (y * imageWidth + x)];
+			const bool		in	= (x - cx) * (x - cx) + (y - cy) * (y - cy) < r * r;
+			p [0]	= in ? 255 : 20;
+			p [1]	= in ? 128 : 20;
+			p [2]	= in ? 0 : 60;
+			p [3]	= 255;
+		}
+}	// drawImage
+
+
+static void sendImages (vtkLoopbackSocket* socket, std::vector<int>* codecs)
+{
+	vtkDMASynchronizedRenderers::ImageEncoder	encoder (vtkDMASynchronizedRenderers::DELTA_RLE_IMAGE);
+	std::vector<unsigned char>	pixels;
+	for (int f = 0; f < imagesNum; f++)
+	{
+		drawImage (f, pixels);
+		codecs->push_back (vtkDMASynchronizedRenderers::sendImage (*socket, encoder, &pixels [0], imageWidth, imageHeight, 4));
+	}
+}	// sendImages
+
+
+int main (int, char*[])
+{
+	int	fds [2]	= { -1, -1 };
+	if (0 != socketpair (AF_UNIX, SOCK_STREAM, 0, fds))
+	{
+		std::cerr << "socketpair impossible." << std::endl;
+		return 1;
+	}
+	vtkLoopbackSocket*	sender		= vtkLoopbackSocket::New ( );
+	vtkLoopbackSocket*	receiver	= vtkLoopbackSocket::New ( );
+	sender->Attach (fds [0]);
+	receiver->Attach (fds [1]);
+
+	vtkDMAMultiProcessStream	sent;
+	fill (sent);
+	bool	ok	= true;
+
+	// Send/Receive
+	std::chrono::steady_clock::time_point	start	= std::chrono::steady_clock::now ( );
+	std::thread	streamThread (sendStream, sender, &sent);
+	for (int l = 0; l < loops; l++)
+	{
+		vtkDMAMultiProcessStream	received;
+		ok	= ok && (1 == received.Receive (receiver)) && check (received);
+	}
+	streamThread.join ( );
+	const double	streamTime	= std::chrono::duration<double>(std::chrono::steady_clock::now ( ) - start).count ( );
+
+	// Données brutes recopiées
+	start	= std::chrono::steady_clock::now ( );
+	std::thread	rawThread (sendRawData, sender, &sent);
+	for (int l = 0; l < loops; l++)
+	{
+		uint32_t	header	= 0;
+		receiver->Receive (&header, sizeof (header), 1);
+		std::vector<unsigned char>	raw (ntohl (header));
+		receiver->Receive (&raw [0], static_cast<int>(raw.size ( )), 1);
+		vtkDMAMultiProcessStream	received;
+		received.SetRawData (&raw [0], raw.size ( ));
+		ok	= ok && check (received);
+	}
+	rawThread.join ( );
+	const double	rawTime	= std::chrono::duration<double>(std::chrono::steady_clock::now ( ) - start).count ( );
+
+	// Images compressées
+	std::vector<int>	codecs;
+	start	= std::chrono::steady_clock::now ( );
+	std::thread	imageThread (sendImages, sender, &codecs);
+	vtkDMASynchronizedRenderers::ImageDecoder	decoder;
+	std::vector<unsigned char>	expected;
+	for (int f = 0; f < imagesNum; f++)
+	{
+		int	width	= 0, height	= 0, components	= 0;
+		const unsigned char*	pixels	=
+			vtkDMASynchronizedRenderers::receiveImage (*receiver, decoder, width, height, components);
+		drawImage (f, expected);
+		ok	= ok && (imageWidth == width) && (imageHeight == height) && (4 == components) &&
+		      (0 == memcmp (pixels, &expected [0], expected.size ( )));
+	}
+	imageThread.join ( );
+	const double	imageTime	= std::chrono::duration<double>(std::chrono::steady_clock::now ( ) - start).count ( );
+	// Première image compressée par plages, les suivantes par différence
+	for (int f = 0; f < imagesNum; f++)
+		ok	= ok && (codecs [f] == (0 == f ? vtkDMASynchronizedRenderers::RLE_IMAGE : vtkDMASynchronizedRenderers::DELTA_RLE_IMAGE));
+
+	sender->Delete ( );
+	receiver->Delete ( );
+
+	const double	megaBytes	= loops * valuesNum * sizeof (double) / (1024. * 1024.);
+	std::cout << megaBytes << " Mo : Send/Receive " << streamTime << "s ("
+	          << megaBytes / streamTime << " Mo/s), GetRawData " << rawTime
+	          << "s (" << megaBytes / rawTime << " Mo/s), " << imagesNum
+	          << " images " << imageWidth << "x" << imageHeight << " : "
+	          << imageTime << "s" << std::endl;
+	if (false == ok)
+	{
+		std::cerr << "Données reçues erronées." << std::endl;
+		return 1;
+	}
+	if (streamTime > rawTime)
+	{
+		std::cerr << "Send/Receive plus lent que l'envoi des données recopiées." << std::endl;
+		return 1;
+	}
+
+	return 0;
+}	// main
@@ -15,17 +15,147 @@
 #include "VtkComponents/vtkDMAMultiProcessStream.h"
 
 #include "vtkObjectFactory.h"
+#include "vtkSocket.h"
 #include "vtkSocketCommunicator.h" // for vtkSwap8 and vtkSwap4 macros.
-#include <deque>
+#include <vector>
 #include <cassert>
+#include <cstring>
 #include <stdexcept>	// CP
 #include <pthread.h>
 #include <stdio.h>
+#include <errno.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 
 class vtkDMAMultiProcessStream::vtkInternals
 {
 public:
-  typedef std::deque<unsigned char> DataType;
+  // CP : tampon contigu en remplacement de std::deque<unsigned char>, avec
+  // la même interface (front, pop_front, push_back, ...) plus des
+  // opérations par blocs (memcpy). Les octets non encore lus sont dans
+  // [Head, Bytes.size()[. L'octet Bytes[Head-1] est toujours disponible et
+  // reçoit l'endianness lors de l'accès sans recopie aux données brutes.
+  class DataType
+  {
+  public:
+    DataType()
+      : Bytes(1), Head(1)
+    {
+    }
+
+    DataType(const DataType& other)
+      : Bytes(1), Head(1)
+    {
+      this->append(other.data(), other.size());
+    }
+
+    DataType& operator=(const DataType& other)
+    {
+      if (this != &other)
+      {
+        this->clear();
+        this->append(other.data(), other.size());
+      }
+      return *this;
+    }
+
+    size_t size() const
+    {
+      return this->Bytes.size() - this->Head;
+    }
+
+    bool empty() const
+    {
+      return this->Bytes.size() == this->Head;
+    }
+
+    void clear()
+    {
+      this->Bytes.resize(1);
+      this->Head = 1;
+    }
+
+    unsigned char front() const
+    {
+      if (this->empty())
+        throw std::runtime_error ("vtkDMAMultiProcessStream. PRE: stream is empty");
+      return this->Bytes[this->Head];
+    }
+
+    void pop_front()
+    {
+      this->skip(1);
+    }
+
+    void push_back(unsigned char value)
+    {
+      this->Bytes.push_back(value);
+    }
+
+    void append(const unsigned char* data, size_t length)
+    {
+      this->Bytes.insert(this->Bytes.end(), data, data + length);
+    }
+
+    void read(unsigned char* data, size_t length)
+    {
+      if (length > this->size())
+        throw std::runtime_error ("vtkDMAMultiProcessStream. PRE: not enough data in stream");
+      if (0 != length)
+        memcpy(data, this->data(), length);
+      this->skip(length);
+    }
+
+    void skip(size_t length)
+    {
+      if (length > this->size())
+        throw std::runtime_error ("vtkDMAMultiProcessStream. PRE: not enough data in stream");
+      this->Head += length;
+      if (this->empty())
+      {
+        this->clear();
+      }
+      else if ((this->Head > 65536) && (2 * this->Head > this->Bytes.size()))
+      {
+        // Compactage : on ne conserve pas indéfiniment les octets lus.
+        this->Bytes.erase(this->Bytes.begin() + 1, this->Bytes.begin() + this->Head);
+        this->Head = 1;
+      }
+    }
+
+    // Données non lues.
+    unsigned char* data()
+    {
+      return &this->Bytes[0] + this->Head;
+    }
+
+    const unsigned char* data() const
+    {
+      return &this->Bytes[0] + this->Head;
+    }
+
+    // Données brutes (endianness puis données non lues), sans recopie.
+    unsigned char* raw(unsigned char endianness)
+    {
+      this->Bytes[this->Head - 1] = endianness;
+      return &this->Bytes[this->Head - 1];
+    }
+
+    // Prépare le tampon à recevoir rawSize octets de données brutes (endianness
+    // compris) et retourne l'adresse où les écrire.
+    unsigned char* prepareRaw(size_t rawSize)
+    {
+      this->Bytes.resize(rawSize > 0 ? rawSize : 1);
+      this->Head = 1;
+      return &this->Bytes[0];
+    }
+
+  private:
+    std::vector<unsigned char> Bytes;
+    size_t Head;
+  };
+
   DataType Data;
 
   enum Types
@@ -44,27 +174,19 @@ public:
 
   void Push(const unsigned char* data, size_t length)
   {
-    for (size_t cc=0; cc < length; cc++)
-    {
-      this->Data.push_back(data[cc]);
-    }
+    this->Data.append(data, length);
   }
 
   void Pop(unsigned char* data, size_t length)
   {
-    for (size_t cc=0; cc < length; cc++)
-    {
-//if (0 == this->Data.size ( ))
-//	throw std::runtime_error ("vtkDMAMultiProcessStream::vtkInternals::Pop. PRE: empty data");
-      data[cc] = this->Data.front();
-      this->Data.pop_front();
-    }
+    this->Data.read(data, length);
   }
 
   void SwapBytes()
   {
-    DataType::iterator iter = this->Data.begin();
-    while (iter != this->Data.end())
+    unsigned char* iter = this->Data.data();
+    unsigned char* end = iter + this->Data.size();
+    while (iter < end)
     {
       unsigned char type = *iter;
       int wordSize = 1;
@@ -84,6 +206,11 @@ public:
         wordSize = sizeof(double);
         break;
 
+      case int64_value:
+      case uint64_value:
+        wordSize = sizeof(vtkTypeInt64);
+        break;
+
       case char_value:
       case uchar_value:
         wordSize = sizeof(char);
@@ -99,31 +226,25 @@ public:
         break;
       }
 
+      if (iter + wordSize > end)
+        throw std::runtime_error ("vtkDMAMultiProcessStream::SwapBytes. Truncated stream");	// CP
+
       switch (wordSize)
       {
         case 1: break;
-        case 4: vtkSwap4(&(*iter)); break;
-        case 8: vtkSwap8(&(*iter)); break;
+        case 4: vtkSwap4(iter); break;
+        case 8: vtkSwap8(iter); break;
       }
 
       // In case of string we don't need to swap char values
       int nbSkip = 0;
       if (type == string_value || type == stream_value)
       {
-        nbSkip = *reinterpret_cast<int*>(&*iter);
+        memcpy(&nbSkip, iter, sizeof(int));
       }
 
-      while (wordSize>0)
-      {
-        iter++;
-        wordSize--;
-      }
-
-      // Skip String chars
-      for (int cc=0; cc < nbSkip; cc++)
-      {
-        iter++;
-      }
+      // Skip the word and the string chars
+      iter += wordSize + nbSkip;
     }
   }
 };
@@ -652,11 +773,8 @@ vtkDMAMultiProcessStream& vtkDMAMultiProcessStream::operator << (const std::stri
                         sizeof(int));
 
   // Set the string content
-  for(int idx=0; idx < size; idx++)
-  {
-    this->Internals->Push( reinterpret_cast<const unsigned char*>(&value[idx]),
-                           sizeof(char));
-  }
+  this->Internals->Push(reinterpret_cast<const unsigned char*>(value.data()),
+                        size);
   return (*this);
 }
 
@@ -670,8 +788,17 @@ vtkDMAMultiProcessStream& vtkDMAMultiProcessStream::operator << (
   this->Internals->Push(reinterpret_cast<unsigned char*>(&size),
     sizeof(unsigned int));
   this->Internals->Data.push_back(value.Endianness);
-  this->Internals->Data.insert(this->Internals->Data.end(),
-    value.Internals->Data.begin(), value.Internals->Data.end());
+  if (&value == this)
+  {
+    // Le tampon source est celui que l'on agrandit
+    vtkInternals::DataType copy (value.Internals->Data);
+    this->Internals->Push(copy.data(), copy.size());
+  }
+  else
+  {
+    this->Internals->Push(value.Internals->Data.data(),
+                          value.Internals->Data.size());
+  }
   return (*this);
 }
 
@@ -687,12 +814,17 @@ if (this->Internals->Data.front()!=vtkInternals::stream_value)
   unsigned int size;
   this->Internals->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
 
-  assert(size>=1);
+  if (size < 1)
+	throw std::runtime_error ("vtkDMAMultiProcessStream::operator >>. PRE: invalid stream size");	// CP
+//  assert(size>=1);
   this->Internals->Pop(&value.Endianness, 1);
   size--;
 
-  value.Internals->Data.resize(size);
-  this->Internals->Pop(&value.Internals->Data[0], size);
+  if (size > this->Internals->Data.size())
+	throw std::runtime_error ("vtkDMAMultiProcessStream::operator >>. PRE: not enough data in stream");	// CP
+  value.Internals->Data.clear();
+  value.Internals->Push(this->Internals->Data.data(), size);
+  this->Internals->Data.skip(size);
   return (*this);
 }
 
@@ -814,7 +946,7 @@ if (this->Internals->Data.front()!=vtkInternals::uint64_value)
 	throw std::runtime_error ("vtkDMAMultiProcessStream::operator >>. PRE: stream data must be of type vtkTypeUint64");	// CP
 //  assert(this->Internals->Data.front() == vtkInternals::uint64_value);
   this->Internals->Data.pop_front();
-  this->Internals->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned int));
+  this->Internals->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(vtkTypeUInt64));
   return (*this);
 }
 
@@ -829,48 +961,35 @@ if (this->Internals->Data.front()!=vtkInternals::string_value)
   int stringSize;
   this->Internals->Pop( reinterpret_cast<unsigned char*>(&stringSize),
                         sizeof(int));
-  char c_value;
-  for(int idx=0; idx < stringSize; idx++)
-  {
-    this->Internals->Pop( reinterpret_cast<unsigned char*>(&c_value),
-                          sizeof(char));
-    value += c_value;
-  }
+  if ((stringSize < 0) ||
+      (static_cast<size_t>(stringSize) > this->Internals->Data.size()))
+    throw std::runtime_error ("vtkDMAMultiProcessStream::operator >>. Invalid string size");	// CP
+  value.assign(reinterpret_cast<const char*>(this->Internals->Data.data()),
+               stringSize);
+  this->Internals->Data.skip(stringSize);
   return (*this);
 }
 
 //----------------------------------------------------------------------------
 void vtkDMAMultiProcessStream::GetRawData(std::vector<unsigned char>& data) const
 {
-  data.clear();
-  data.push_back(this->Endianness);
   data.resize(1 + this->Internals->Data.size());
-  vtkInternals::DataType::iterator iter;
-  int cc=1;
-  for (iter = this->Internals->Data.begin();
-    iter != this->Internals->Data.end(); ++iter, ++cc)
+  data[0] = this->Endianness;
+  if (false == this->Internals->Data.empty())
   {
-    data[cc] = (*iter);
+    memcpy(&data[1], this->Internals->Data.data(), this->Internals->Data.size());
   }
 }
 
 //----------------------------------------------------------------------------
 void vtkDMAMultiProcessStream::SetRawData(const std::vector<unsigned char>& data)
 {
-  this->Internals->Data.clear();
-  unsigned char endianness = data.front();
-  std::vector<unsigned char>::const_iterator iter = data.begin();
-  iter++;
-  this->Internals->Data.resize(data.size()-1);
-  int cc=0;
-  for (;iter != data.end(); iter++, cc++)
-  {
-    this->Internals->Data[cc] = *iter;
-  }
-  if (this->Endianness != endianness)
+  if (data.empty())
   {
-    this->Internals->SwapBytes();
+    this->Internals->Data.clear();
+    return;
   }
+  this->SetRawData(&data[0], static_cast<unsigned int>(data.size()));
 }
 
 //----------------------------------------------------------------------------
@@ -887,13 +1006,7 @@ void vtkDMAMultiProcessStream::GetRawData(
   data = new unsigned char[ size+1 ];
   assert( "pre: cannot allocate raw data buffer" && (data != NULL) );
 
-
-  data[0] = this->Endianness;
-  vtkInternals::DataType::iterator iter = this->Internals->Data.begin();
-  for(int idx=1 ; iter != this->Internals->Data.end(); ++iter, ++idx )
-  {
-    data[ idx ] = *iter;
-  }
+  memcpy(data, this->Internals->Data.raw(this->Endianness), size);
 }
 
 //----------------------------------------------------------------------------
@@ -904,12 +1017,7 @@ void vtkDMAMultiProcessStream::SetRawData(const unsigned char* data,
   if (size > 0)
   {
     unsigned char endianness = data[0];
-    this->Internals->Data.resize(size-1);
-    int cc=0;
-    for (;cc < static_cast<int>(size-1); cc++)
-    {
-      this->Internals->Data[cc] = data[cc+1];
-    }
+    this->Internals->Push(data + 1, size - 1);
     if (this->Endianness != endianness)
     {
       this->Internals->SwapBytes();
@@ -917,3 +1025,120 @@ void vtkDMAMultiProcessStream::SetRawData(const unsigned char* data,
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDMAMultiProcessStream::GetRawDataView(
+    const unsigned char*& data, unsigned int& size)
+{
+  size = static_cast<unsigned int>(this->Internals->Data.size()) + 1;
+  data = this->Internals->Data.raw(this->Endianness);
+}
+
+//----------------------------------------------------------------------------
+void vtkDMAMultiProcessStream::AppendRawData(const unsigned char* data,
+  unsigned int size)
+{
+  if (size <= 1)
+    return;
+
+  if (data[0] == this->Endianness)
+  {
+    this->Internals->Push(data + 1, size - 1);
+  }
+  else
+  {
+    vtkDMAMultiProcessStream swapped;
+    swapped.SetRawData(data, size);
+    this->Internals->Push(swapped.Internals->Data.data(),
+                          swapped.Internals->Data.size());
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDMAMultiProcessStream::Skip(unsigned int size)
+{
+  this->Internals->Data.skip(size);
+}
+
+//----------------------------------------------------------------------------
+int vtkDMAMultiProcessStream::Send(vtkSocket* socket)
+{
+  if ((0 == socket) || (0 == socket->GetConnected()))
+    return 0;
+
+  // En-tête (taille des données brutes), endianness et données sont
+  // transmis en un seul appel système, sans recopie préalable.
+  const size_t dataSize = this->Internals->Data.size();
+  if (dataSize + 1 > 0xffffffffUL)
+    return 0;
+  uint32_t header = htonl(static_cast<uint32_t>(dataSize + 1));
+  struct iovec iov[3];
+  iov[0].iov_base = &header;
+  iov[0].iov_len = sizeof(header);
+  iov[1].iov_base = &this->Endianness;
+  iov[1].iov_len = 1;
+  iov[2].iov_base = this->Internals->Data.data();
+  iov[2].iov_len = dataSize;
+
+  struct iovec* current = iov;
+  int count = 0 == dataSize ? 2 : 3;
+  while (count > 0)
+  {
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = current;
+    message.msg_iovlen = count;
+    const ssize_t written =
+      sendmsg(socket->GetSocketDescriptor(), &message, MSG_NOSIGNAL);
+    if (written < 0)
+    {
+      if (EINTR == errno)
+        continue;
+      return 0;
+    }
+    size_t remaining = static_cast<size_t>(written);
+    while ((count > 0) && (remaining >= current->iov_len))
+    {
+      remaining -= current->iov_len;
+      current++;
+      count--;
+    }
+    if (count > 0)
+    {
+      current->iov_base = static_cast<char*>(current->iov_base) + remaining;
+      current->iov_len -= remaining;
+    }
+  }
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkDMAMultiProcessStream::Receive(vtkSocket* socket)
+{
+  if ((0 == socket) || (0 == socket->GetConnected()))
+    return 0;
+
+  uint32_t header = 0;
+  if (static_cast<int>(sizeof(header)) !=
+      socket->Receive(&header, sizeof(header), 1))
+    return 0;
+  const size_t rawSize = ntohl(header);
+  if ((0 == rawSize) || (rawSize > 0x7fffffffUL))
+    return 0;
+
+  // Réception directement dans le tampon du flux
+  unsigned char* raw = this->Internals->Data.prepareRaw(rawSize);
+  if (static_cast<int>(rawSize) !=
+      socket->Receive(raw, static_cast<int>(rawSize), 1))
+  {
+    this->Internals->Data.clear();
+    return 0;
+  }
+
+  if (this->Endianness != raw[0])
+  {
+    this->Internals->SwapBytes();
+  }
+
+  return 1;
+}
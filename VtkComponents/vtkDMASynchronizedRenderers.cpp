@@ -1,6 +1,22 @@
 #include <VtkComponents/vtkDMASynchronizedRenderers.h>
 #include <vtkRenderWindow.h>
 #include <vtkRendererCollection.h>
+#include <vtkMultiProcessStream.h>
+#include <vtkSocket.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string.h>
+#include <vector>
+
+
+// Version du protocole de transfert d'images, à incrémenter à chaque
+// modification du format.
+static const int	imageCodecVersion	= 1;
+
+// Côté des tuiles (en pixels) pour le codage différentiel.
+static const int	imageTileSize		= 32;
 
 
 vtkDMASynchronizedRenderers::vtkDMASynchronizedRenderers ( )
@@ -40,21 +56,421 @@ void vtkDMASynchronizedRenderers::copyRenderingParameters (vtkRenderer& fromRend
 }	// vtkDMASynchronizedRenderers::copyRenderingParameters
 
 
+// Taille des données brutes (endianness comprise) d'un RendererInfo
+// sérialisé, qui ne dépend que de la version de VTK.
+static unsigned int rendererInfoRawSize ( )
+{
+	static unsigned int	size	= 0;
+	if (0 == size)
+	{
+		vtkSynchronizedRenderers::RendererInfo	renInfo;
+		vtkMultiProcessStream		stream;
+		renInfo.Save (stream);
+		std::vector<unsigned char>	raw;
+		stream.GetRawData (raw);
+		size	= raw.size ( );
+	}
+
+	return size;
+}	// rendererInfoRawSize
+
+
 void vtkDMASynchronizedRenderers::copyRenderingParameters (vtkRenderer& fromRenderer, vtkDMAMultiProcessStream& serializedMessage)
 {
 	vtkSynchronizedRenderers::RendererInfo	renInfo;
 	renInfo.ImageReductionFactor	= 1;	// unused
 	renInfo.CopyFrom (&fromRenderer);
-	renInfo.Save ((vtkMultiProcessStream&)serializedMessage);
+	// vtkDMAMultiProcessStream n'a plus la représentation interne de
+	// vtkMultiProcessStream : on passe par ses données brutes.
+	vtkMultiProcessStream		stream;
+	renInfo.Save (stream);
+	std::vector<unsigned char>	raw;
+	stream.GetRawData (raw);
+	serializedMessage.AppendRawData (&raw [0], raw.size ( ));
 }	// vtkDMASynchronizedRenderers::copyRenderingParameters
 
 
 void vtkDMASynchronizedRenderers::copyRenderingParameters (vtkDMAMultiProcessStream& serializedMessage, vtkRenderer& toRenderer)
 {
+	// Accès sans recopie au flux, seuls les octets de RendererInfo (format
+	// de RendererInfo::Save inchangé) passent par un vtkMultiProcessStream.
 	vtkSynchronizedRenderers::RendererInfo	renInfo;
-	renInfo.Restore ((vtkMultiProcessStream&)serializedMessage);
+	const unsigned char*	raw		= 0;
+	unsigned int			rawSize	= 0;
+	serializedMessage.GetRawDataView (raw, rawSize);
+	const unsigned int		infoSize	= rendererInfoRawSize ( );
+	vtkMultiProcessStream	stream;
+	stream.SetRawData (raw, rawSize < infoSize ? rawSize : infoSize);
+	const int	size	= stream.Size ( );
+	renInfo.Restore (stream);
+	serializedMessage.Skip (size - stream.Size ( ));
 	renInfo.CopyTo (&toRenderer);
 }	// vtkDMASynchronizedRenderers::copyRenderingParameters
 
 
+vtkDMASynchronizedRenderers::IMAGE_CODEC vtkDMASynchronizedRenderers::negotiateImageCodec (vtkSocket& socket, IMAGE_CODEC maxCodec)
+{
+	vtkDMAMultiProcessStream	offer, answer;
+	offer << imageCodecVersion << (int)maxCodec;
+	if ((0 == offer.Send (&socket)) || (0 == answer.Receive (&socket)))
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::negotiateImageCodec : erreur de communication.");
+
+	int	version	= 0, peerCodec	= RAW_IMAGE;
+	answer >> version >> peerCodec;
+	if ((imageCodecVersion != version) || (RAW_IMAGE > peerCodec))
+		return RAW_IMAGE;
+
+	return (IMAGE_CODEC)std::min ((int)maxCodec, peerCodec);
+}	// vtkDMASynchronizedRenderers::negotiateImageCodec
+
+
+// ============================================================================
+//                  CODAGE PAR PLAGES DES TUILES D'UNE IMAGE
+// ============================================================================
+
+// Codage par plages (type PackBits) de count pixels de size octets : un octet
+// h <= 127 annonce h+1 pixels recopiés tels quels, un octet h >= 129 annonce
+// h-127 répétitions du pixel qui suit.
+static void encodeRuns (const unsigned char* pixels, size_t count, size_t size, std::vector<unsigned char>& out)
+{
+	size_t	i	= 0;
+	while (i < count)
+	{
+		size_t	run	= 1;
+		while ((i + run < count) && (run < 128) &&
+		       (0 == memcmp (pixels + (i + run) * size, pixels + i * size, size)))
+			run++;
+		if (run >= 2)
+		{
+			out.push_back ((unsigned char)(127 + run));
+			out.insert (out.end ( ), pixels + i * size, pixels + (i + 1) * size);
+			i	+= run;
+			continue;
+		}	// if (run >= 2)
+
+		size_t	literal	= 1;
+		while ((i + literal < count) && (literal < 128))
+		{
+			if ((i + literal + 1 < count) &&
+			    (0 == memcmp (pixels + (i + literal) * size, pixels + (i + literal + 1) * size, size)))
+				break;
+			literal++;
+		}	// while ((i + literal < count) && (literal < 128))
+		out.push_back ((unsigned char)(literal - 1));
+		out.insert (out.end ( ), pixels + i * size, pixels + (i + literal) * size);
+		i	+= literal;
+	}	// while (i < count)
+}	// encodeRuns
+
+
+// Décodage de count pixels de size octets depuis [in, end[. Retourne la
+// position atteinte dans les données codées.
+static const unsigned char* decodeRuns (const unsigned char* in, const unsigned char* end, unsigned char* pixels, size_t count, size_t size)
+{
+	size_t	i	= 0;
+	while (i < count)
+	{
+		if (in >= end)
+			throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder : image tronquée.");
+		const unsigned char	h	= *in++;
+		if (128 == h)
+			throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder : image corrompue.");
+		const size_t	n	= h < 128 ? (size_t)h + 1 : (size_t)h - 127;
+		const size_t	bytes	= h < 128 ? n * size : size;
+		if ((i + n > count) || ((size_t)(end - in) < bytes))
+			throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder : image corrompue.");
+		if (h < 128)
+			memcpy (pixels + i * size, in, bytes);
+		else
+			for (size_t j = 0; j < n; j++)
+				memcpy (pixels + (i + j) * size, in, size);
+		in	+= bytes;
+		i	+= n;
+	}	// while (i < count)
+
+	return in;
+}	// decodeRuns
+
+
+// ============================================================================
+//                     LA CLASSE ImageEncoder
+// ============================================================================
+
+vtkDMASynchronizedRenderers::ImageEncoder::ImageEncoder (IMAGE_CODEC maxCodec)
+	: _maxCodec (maxCodec), _width (0), _height (0), _components (0),
+	  _previous ( ), _payload ( ), _tile ( )
+{
+}	// ImageEncoder::ImageEncoder
+
+
+vtkDMASynchronizedRenderers::ImageEncoder::ImageEncoder (const ImageEncoder&)
+	: _maxCodec (RAW_IMAGE), _width (0), _height (0), _components (0),
+	  _previous ( ), _payload ( ), _tile ( )
+{
+}	// ImageEncoder::ImageEncoder
+
+
+vtkDMASynchronizedRenderers::ImageEncoder& vtkDMASynchronizedRenderers::ImageEncoder::operator = (const ImageEncoder&)
+{
+	return *this;
+}	// ImageEncoder::operator =
+
+
+void vtkDMASynchronizedRenderers::ImageEncoder::setCodec (IMAGE_CODEC maxCodec)
+{
+	_maxCodec	= maxCodec;
+	reset ( );
+}	// ImageEncoder::setCodec
+
+
+void vtkDMASynchronizedRenderers::ImageEncoder::reset ( )
+{
+	_width	= _height	= _components	= 0;
+	_previous.clear ( );
+}	// ImageEncoder::reset
+
+
+vtkDMASynchronizedRenderers::IMAGE_CODEC vtkDMASynchronizedRenderers::ImageEncoder::encode (
+	const unsigned char* pixels, int width, int height, int components, vtkDMAMultiProcessStream& stream)
+{
+	if ((0 > width) || (0 > height) || (0 >= components) || ((0 == pixels) && (0 != width * height)))
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageEncoder::encode : image invalide.");
+
+	const size_t	rowSize		= (size_t)width * components;
+	const size_t	imageSize	= rowSize * height;
+	const bool		delta		= (DELTA_RLE_IMAGE == _maxCodec) &&
+		(width == _width) && (height == _height) && (components == _components);
+	IMAGE_CODEC		codec		= RAW_IMAGE;
+
+	_payload.clear ( );
+	if ((RAW_IMAGE != _maxCodec) && (0 != imageSize))
+	{
+		// Les tuiles, ligne par ligne : un octet 0 pour une tuile inchangée,
+		// 1 suivi des pixels codés par plages sinon.
+		codec	= delta ? DELTA_RLE_IMAGE : RLE_IMAGE;
+		for (int ty = 0; (ty < height) && (_payload.size ( ) < imageSize); ty += imageTileSize)
+		{
+			const int	th	= std::min (imageTileSize, height - ty);
+			for (int tx = 0; tx < width; tx += imageTileSize)
+			{
+				const int		tw			= std::min (imageTileSize, width - tx);
+				const size_t	tileRowSize	= (size_t)tw * components;
+				const size_t	offset		= (size_t)ty * rowSize + (size_t)tx * components;
+				bool			unchanged	= delta;
+				for (int y = 0; unchanged && (y < th); y++)
+					unchanged	= 0 == memcmp (pixels + offset + y * rowSize, &_previous [offset + y * rowSize], tileRowSize);
+				if (true == unchanged)
+				{
+					_payload.push_back (0);
+					continue;
+				}	// if (true == unchanged)
+
+				_tile.resize (tileRowSize * th);
+				for (int y = 0; y < th; y++)
+					memcpy (&_tile [y * tileRowSize], pixels + offset + y * rowSize, tileRowSize);
+				_payload.push_back (1);
+				encodeRuns (&_tile [0], (size_t)tw * th, components, _payload);
+			}	// for (int tx = 0; tx < width; tx += imageTileSize)
+		}	// for (int ty = 0; ty < height; ty += imageTileSize)
+
+		// Compression inefficace (bruit, dégradés, ...) : image brute.
+		if (_payload.size ( ) >= imageSize)
+			codec	= RAW_IMAGE;
+	}	// if ((RAW_IMAGE != _maxCodec) && (0 != imageSize))
+
+	stream << (int)codec << width << height << components;
+	if (RAW_IMAGE == codec)
+	{
+		stream << (unsigned int)imageSize;
+		if (0 != imageSize)
+			stream.Push (const_cast<unsigned char*>(pixels), (unsigned int)imageSize);
+	}
+	else
+	{
+		stream << (unsigned int)_payload.size ( );
+		stream.Push (&_payload [0], (unsigned int)_payload.size ( ));
+	}
+
+	// Référence pour l'image suivante :
+	if (DELTA_RLE_IMAGE == _maxCodec)
+	{
+		_width		= width;
+		_height		= height;
+		_components	= components;
+		_previous.assign (pixels, pixels + imageSize);
+	}	// if (DELTA_RLE_IMAGE == _maxCodec)
+
+	return codec;
+}	// ImageEncoder::encode
+
+
+// ============================================================================
+//                     LA CLASSE ImageDecoder
+// ============================================================================
+
+vtkDMASynchronizedRenderers::ImageDecoder::ImageDecoder ( )
+	: _width (0), _height (0), _components (0), _frame ( ), _payload ( ), _tile ( )
+{
+}	// ImageDecoder::ImageDecoder
+
+
+vtkDMASynchronizedRenderers::ImageDecoder::ImageDecoder (const ImageDecoder&)
+	: _width (0), _height (0), _components (0), _frame ( ), _payload ( ), _tile ( )
+{
+}	// ImageDecoder::ImageDecoder
+
+
+vtkDMASynchronizedRenderers::ImageDecoder& vtkDMASynchronizedRenderers::ImageDecoder::operator = (const ImageDecoder&)
+{
+	return *this;
+}	// ImageDecoder::operator =
+
+
+void vtkDMASynchronizedRenderers::ImageDecoder::reset ( )
+{
+	_width	= _height	= _components	= 0;
+	_frame.clear ( );
+}	// ImageDecoder::reset
+
+
+const unsigned char* vtkDMASynchronizedRenderers::ImageDecoder::decode (
+	vtkDMAMultiProcessStream& stream, int& width, int& height, int& components)
+{
+	int				codec	= RAW_IMAGE;
+	unsigned int	size	= 0;
+	stream >> codec >> width >> height >> components >> size;
+	if ((0 > width) || (0 > height) || (0 >= components) ||
+	    (RAW_IMAGE > codec) || (DELTA_RLE_IMAGE < codec))
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : en-tête d'image invalide.");
+
+	const size_t	rowSize		= (size_t)width * components;
+	const size_t	imageSize	= rowSize * height;
+	if ((DELTA_RLE_IMAGE == codec) &&
+	    ((width != _width) || (height != _height) || (components != _components)))
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : image de référence absente.");
+	_width		= width;
+	_height		= height;
+	_components	= components;
+	_frame.resize (imageSize);
+
+	if (RAW_IMAGE == codec)
+	{
+		if (size != imageSize)
+			throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : taille d'image invalide.");
+		if (0 != size)
+		{
+			unsigned char*	frame	= &_frame [0];
+			stream.Pop (frame, size);
+		}
+		return 0 == imageSize ? 0 : &_frame [0];
+	}	// if (RAW_IMAGE == codec)
+
+	if (0 == size)
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : image vide.");
+	_payload.resize (size);
+	unsigned char*	payload	= &_payload [0];
+	stream.Pop (payload, size);
+
+	const unsigned char*	in	= &_payload [0];
+	const unsigned char*	end	= in + size;
+	for (int ty = 0; ty < height; ty += imageTileSize)
+	{
+		const int	th	= std::min (imageTileSize, height - ty);
+		for (int tx = 0; tx < width; tx += imageTileSize)
+		{
+			if (in >= end)
+				throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : image tronquée.");
+			const unsigned char	flag	= *in++;
+			if ((0 == flag) && (DELTA_RLE_IMAGE == codec))
+				continue;	// Tuile inchangée
+			if (1 != flag)
+				throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : image corrompue.");
+
+			const int		tw			= std::min (imageTileSize, width - tx);
+			const size_t	tileRowSize	= (size_t)tw * components;
+			const size_t	offset		= (size_t)ty * rowSize + (size_t)tx * components;
+			_tile.resize (tileRowSize * th);
+			in	= decodeRuns (in, end, &_tile [0], (size_t)tw * th, components);
+			for (int y = 0; y < th; y++)
+				memcpy (&_frame [offset + y * rowSize], &_tile [y * tileRowSize], tileRowSize);
+		}	// for (int tx = 0; tx < width; tx += imageTileSize)
+	}	// for (int ty = 0; ty < height; ty += imageTileSize)
+	if (in != end)
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::ImageDecoder::decode : image corrompue.");
+
+	return 0 == imageSize ? 0 : &_frame [0];
+}	// ImageDecoder::decode
+
+
+// ============================================================================
+//                  TRANSFERT DES IMAGES SUR UNE SOCKET
+// ============================================================================
+
+vtkDMASynchronizedRenderers::IMAGE_CODEC vtkDMASynchronizedRenderers::sendImage (
+	vtkSocket& socket, ImageEncoder& encoder, const unsigned char* pixels, int width, int height, int components)
+{
+	vtkDMAMultiProcessStream	stream;
+	const IMAGE_CODEC	codec	= encoder.encode (pixels, width, height, components, stream);
+	if (0 == stream.Send (&socket))
+	{
+		// Le pair n'a pas reçu l'image de référence
+		encoder.reset ( );
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::sendImage : erreur de communication.");
+	}
+
+	return codec;
+}	// vtkDMASynchronizedRenderers::sendImage
+
+
+vtkDMASynchronizedRenderers::IMAGE_CODEC vtkDMASynchronizedRenderers::sendImage (
+	vtkSocket& socket, ImageEncoder& encoder, vtkRenderWindow& window)
+{
+	const int*	size	= window.GetSize ( );
+	const int	width	= size [0], height	= size [1];
+	vtkUnsignedCharArray*	pixels	= vtkUnsignedCharArray::New ( );
+	IMAGE_CODEC	codec	= RAW_IMAGE;
+	try
+	{
+		if ((0 < width) && (0 < height))
+			window.GetRGBACharPixelData (0, 0, width - 1, height - 1, 1, pixels);
+		codec	= sendImage (socket, encoder,
+			0 == pixels->GetNumberOfTuples ( ) ? 0 : pixels->GetPointer (0),
+			0 == pixels->GetNumberOfTuples ( ) ? 0 : width,
+			0 == pixels->GetNumberOfTuples ( ) ? 0 : height, 4);
+	}
+	catch (...)
+	{
+		pixels->Delete ( );
+		throw;
+	}
+	pixels->Delete ( );
+
+	return codec;
+}	// vtkDMASynchronizedRenderers::sendImage
+
+
+const unsigned char* vtkDMASynchronizedRenderers::receiveImage (
+	vtkSocket& socket, ImageDecoder& decoder, int& width, int& height, int& components)
+{
+	vtkDMAMultiProcessStream	stream;
+	if (0 == stream.Receive (&socket))
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::receiveImage : erreur de communication.");
+
+	return decoder.decode (stream, width, height, components);
+}	// vtkDMASynchronizedRenderers::receiveImage
+
+
+void vtkDMASynchronizedRenderers::receiveImage (vtkSocket& socket, ImageDecoder& decoder, vtkRenderWindow& window)
+{
+	int	width	= 0, height	= 0, components	= 0;
+	const unsigned char*	pixels	= receiveImage (socket, decoder, width, height, components);
+	if ((0 == pixels) || (0 == width) || (0 == height))
+		return;
+	if (4 != components)
+		throw std::runtime_error ("vtkDMASynchronizedRenderers::receiveImage : image RGBA attendue.");
 
+	const int*	size	= window.GetSize ( );
+	if ((width != size [0]) || (height != size [1]))
+		window.SetSize (width, height);
+	window.SetRGBACharPixelData (0, 0, width - 1, height - 1, const_cast<unsigned char*>(pixels), 1);
+}	// vtkDMASynchronizedRenderers::receiveImage
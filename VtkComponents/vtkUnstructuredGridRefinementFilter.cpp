@@ -2,23 +2,208 @@
 // Rem : algos faits un peu vite. Probablement  optimiser, et idalement
 // utiliser (optionnellement) des splines ou quivalent.
 //
+// Le raffinement se fait en plusieurs passes sur des tableaux contigus :
+// - extraction de la connectivit (sans instancier de vtkCell),
+// - dcomposition des mailles en primitives (segments et triangles),
+// - recensement concurrent des artes (table de hachage sans verrou) afin
+//   que les points crs sur une arte soient partags par les primitives
+//   qui l'utilisent,
+// - comptage des points et mailles crs par chaque primitive,
+// - remplissage des tableaux de sortie prallous.
+// Les passes parallles reposent sur vtkSMPTools. Le rsultat ne dpend pas
+// du nombre de threads : chaque arte est numrote par la premire primitive
+// qui l'utilise.
+//
 #include "VtkComponents/vtkUnstructuredGridRefinementFilter.h"
 
-#include <vtkCell.h>
+#include <vtkCellArray.h>
+#include <vtkCellType.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
+#include <vtkPoints.h>
+#include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
+#ifndef VTK_5
+#include <vtkSMPTools.h>
+#endif	// VTK_5
 #include <assert.h>
+#include <stdint.h>
 #include <string.h>
 
+#include <atomic>
+#include <vector>
+
+
+// ============================================================================
+//                        FONCTIONS ET CLASSES UTILITAIRES
+// ============================================================================
+
+namespace
+{
+
+/** Excute functor (begin, end) sur [0, count[, en parallle si possible. */
+template <typename Functor> void parallelFor (vtkIdType count, Functor functor)
+{
+	if (0 >= count)
+		return;
+#ifndef VTK_5
+	vtkSMPTools::For (0, count, functor);
+#else	// VTK_5
+	functor (0, count);
+#endif	// VTK_5
+}	// parallelFor
+
+
+/** Somme prfixe exclusive : values [i] devient la somme des valeurs qui le
+ * prcdent. Retourne la somme totale. */
+vtkIdType prefixSum (std::vector<vtkIdType>& values)
+{
+	vtkIdType	sum	= 0;
+	for (std::vector<vtkIdType>::iterator it = values.begin ( ); values.end ( ) != it; it++)
+	{
+		const vtkIdType	value	= *it;
+		*it	= sum;
+		sum	+= value;
+	}	// for (std::vector<vtkIdType>::iterator it = ...
+
+	return sum;
+}	// prefixSum
+
+
+/** Cl d'une arte (indpendante de son sens de parcours). Les identifiants
+ * des points doivent tenir sur 32 bits. */
+inline uint64_t edgeKey (vtkIdType a, vtkIdType b)
+{
+	return a < b ? ((uint64_t)a << 32) | (uint64_t)b : ((uint64_t)b << 32) | (uint64_t)a;
+}	// edgeKey
+
+
+/**
+ * Table de hachage concurrente (adressage ouvert, insertion sans verrou par
+ * compare and swap) associant  chaque arte la plus petite primitive qui
+ * l'utilise (sa propritaire), puis son numro.
+ * La table est remplie dans une passe (insert), les numros sont affects
+ * par les propritaires dans une passe ultrieure (setIndex), et lus ensuite
+ * (index).
+ */
+class ConcurrentEdgeTable
+{
+	public :
+
+	ConcurrentEdgeTable (size_t maxEdges)
+		: _mask (capacity (maxEdges) - 1), _keys (capacity (maxEdges)),
+		  _owners (capacity (maxEdges)), _indices (capacity (maxEdges), -1)
+	{
+		for (size_t i = 0; i < _keys.size ( ); i++)
+		{
+			_keys [i].store (emptyKey, std::memory_order_relaxed);
+			_owners [i].store (noOwner, std::memory_order_relaxed);
+		}
+	}
+
+	/** Recense l'arte key pour la primitive owner. */
+	void insert (uint64_t key, vtkIdType owner)
+	{
+		for (size_t slot = hash (key) & _mask; ; slot = (slot + 1) & _mask)
+		{
+			uint64_t	current	= _keys [slot].load (std::memory_order_acquire);
+			if (emptyKey == current)
+			{
+				// En cas d'chec current reoit la cl insre par un autre thread
+				if (true == _keys [slot].compare_exchange_strong (current, key, std::memory_order_acq_rel))
+					current	= key;
+			}	// if (emptyKey == current)
+			if (key == current)
+			{
+				vtkIdType	previous	= _owners [slot].load (std::memory_order_relaxed);
+				while ((owner < previous) &&
+				       (false == _owners [slot].compare_exchange_weak (previous, owner, std::memory_order_relaxed)))
+					;
+				return;
+			}	// if (key == current)
+		}	// for (size_t slot = hash (key) & _mask; ; ...)
+	}	// insert
+
+	/** Emplacement d'une arte recense. */
+	size_t find (uint64_t key) const
+	{
+		size_t	slot	= hash (key) & _mask;
+		while (key != _keys [slot].load (std::memory_order_relaxed))
+			slot	= (slot + 1) & _mask;
+		return slot;
+	}	// find
+
+	vtkIdType owner (size_t slot) const
+	{ return _owners [slot].load (std::memory_order_relaxed); }
+
+	void setIndex (size_t slot, vtkIdType index)
+	{ _indices [slot]	= index; }
+
+	vtkIdType index (size_t slot) const
+	{ return _indices [slot]; }
+
+
+	private :
+
+	static const uint64_t	emptyKey	= ~(uint64_t)0;
+	static const vtkIdType	noOwner		= VTK_ID_MAX;
+
+	static size_t capacity (size_t maxEdges)
+	{
+		size_t	c	= 16;
+		while (c < 2 * maxEdges)
+			c	*= 2;
+		return c;
+	}
+
+	static size_t hash (uint64_t key)
+	{
+		key	^= key >> 33;
+		key	*= 0xff51afd7ed558ccdULL;
+		key	^= key >> 33;
+		return (size_t)key;
+	}
+
+	size_t									_mask;
+	std::vector<std::atomic<uint64_t> >		_keys;
+	std::vector<std::atomic<vtkIdType> >	_owners;
+	std::vector<vtkIdType>					_indices;
+};	// class ConcurrentEdgeTable
+
+const uint64_t	ConcurrentEdgeTable::emptyKey;
+const vtkIdType	ConcurrentEdgeTable::noOwner;
+
+
+/** Nombre de primitives (segments ou triangles) d'une maille. */
+inline vtkIdType primitivesNum (int type, vtkIdType ptsNum)
+{
+	switch (type)
+	{
+		case VTK_LINE			:
+		case VTK_POLY_LINE		: return ptsNum >= 2 ? ptsNum - 1 : 0;
+		case VTK_TRIANGLE		: return ptsNum == 3 ? 1 : 0;
+		case VTK_TRIANGLE_STRIP	: return ptsNum >= 3 ? ptsNum - 2 : 0;
+	}	// switch (type)
+
+	return 0;
+}	// primitivesNum
+
+}	// namespace
+
+
+// ============================================================================
+//                    LA CLASSE vtkUnstructuredGridRefinementFilter
+// ============================================================================
 
 vtkUnstructuredGridRefinementFilter::vtkUnstructuredGridRefinementFilter ( )
 #ifndef VTK_5
 	: vtkUnstructuredGridAlgorithm ( ),
 #else	// VTK_5
-	: vtkUnstructuredGridToUnstructuredGridFilter ( ), 
+	: vtkUnstructuredGridToUnstructuredGridFilter ( ),
 #endif	// VTK_5
-	  _refinementFactor (10), _triangleBuffer (0)
+	  _refinementFactor (10)
 {
 }	// vtkUnstructuredGridRefinementFilter::vtkUnstructuredGridRefinementFilter
 
@@ -30,7 +215,7 @@ vtkUnstructuredGridRefinementFilter::vtkUnstructuredGridRefinementFilter (
 #else	// VTK_5
 	: vtkUnstructuredGridToUnstructuredGridFilter ( ),
 #endif	// VTK_5
-	  _refinementFactor (10), _triangleBuffer (0)
+	  _refinementFactor (10)
 {
 	assert (0 && "vtkUnstructuredGridRefinementFilter copy constructor is not allowed.");
 }	// vtkUnstructuredGridRefinementFilter::vtkUnstructuredGridRefinementFilter
@@ -47,7 +232,6 @@ vtkUnstructuredGridRefinementFilter&
 
 vtkUnstructuredGridRefinementFilter::~vtkUnstructuredGridRefinementFilter ( )
 {
-	DesallocateTriangleBuffer ( );
 }	// vtkUnstructuredGridRefinementFilter::~vtkUnstructuredGridRefinementFilter
 
 
@@ -68,7 +252,6 @@ void vtkUnstructuredGridRefinementFilter::SetRefinementFactor (
 	if (factor == _refinementFactor)
 		return;
 
-	DesallocateTriangleBuffer ( );	// Not usefull because only used by Execute
 	_refinementFactor	= factor;
 	Modified ( );
 }	// vtkUnstructuredGridRefinementFilter::SetId
@@ -94,7 +277,7 @@ int vtkUnstructuredGridRefinementFilter::RequestData (
 void vtkUnstructuredGridRefinementFilter::Execute ( )
 #endif	// VTK_5
 {
-	const unsigned int	factor	= GetRefinementFactor ( );
+	const vtkIdType	factor	= GetRefinementFactor ( );
 	if (0 == factor)
 	{
 		cerr << __FILE__ << ' ' << __LINE__ << " vtkUnstructuredGridRefinementFilter::RequestData has null refinement factor." << endl;
@@ -114,218 +297,330 @@ void vtkUnstructuredGridRefinementFilter::Execute ( )
 		return RD_FAILURE;
 	}
 
-	// On part du principe qu'on raffine des mailles de dimension 2
-	// factor^2 fois plus de mailles et points.
 	const vtkIdType	inPtsNum	= input->GetNumberOfPoints ( );
 	const vtkIdType	inCellsNum	= input->GetNumberOfCells ( );
-	vtkIdType	numPts		= inPtsNum * factor * factor;
-	vtkIdType	numCells	= inCellsNum * factor * factor;
-	vtkPoints*	points		= vtkPoints::New ( );
-	points->SetDataTypeToDouble ( );
-	points->Allocate (numPts, numPts);
-	output->SetPoints (points);
-	output->Allocate (numCells, numCells);
-
-	// Les points existants sont conservs :
-	points->DeepCopy (input->GetPoints ( ));
-
-	// Allocation (ventuellement) requises :
-	AllocateTriangleBuffer ( );
-
-	// On parcourt les mailles et on raffine :
+	if ((vtkIdType)0xffffffff <= inPtsNum)
+	{
+		cerr << __FILE__ << ' ' << __LINE__ << " vtkUnstructuredGridRefinementFilter::RequestData : too many points (" << inPtsNum << ")." << endl;
+		return RD_FAILURE;
+	}	// if ((vtkIdType)0xffffffff <= inPtsNum)
+
+	// Passe 1 (squentielle) : connectivit des mailles, lue directement sans
+	// instancier de vtkCell.
+	std::vector<unsigned char>	cellTypes (inCellsNum);
+	std::vector<vtkIdType>		cellOffsets (inCellsNum + 1, 0);
+	std::vector<vtkIdType>		cellPoints;
+	cellPoints.reserve (3 * inCellsNum);
 	for (vtkIdType i = 0; i < inCellsNum; i++)
 	{
-		vtkCell*	cell	= input->GetCell (i);
-		assert (0 != cell);
-		switch (cell->GetCellType ( ))
-		{
-			case VTK_LINE			:
-			case VTK_POLY_LINE		:
-				refineLine (*cell, *points, *output);
-				break;
-			case VTK_TRIANGLE		:
-			case VTK_TRIANGLE_STRIP	:
-				refineTriangle (*cell, *points, *output);
-				break;
-		}	// switch (cell->GetCellType ( ))
+		vtkIdType			ptsNum	= 0;
+#if VTK_MAJOR_VERSION >= 9
+		const vtkIdType*	pts		= 0;
+#else	// VTK_MAJOR_VERSION >= 9
+		vtkIdType*			pts		= 0;
+#endif	// VTK_MAJOR_VERSION >= 9
+		cellTypes [i]	= (unsigned char)input->GetCellType (i);
+		input->GetCellPoints (i, ptsNum, pts);
+		cellOffsets [i]	= cellPoints.size ( );
+		cellPoints.insert (cellPoints.end ( ), pts, pts + ptsNum);
 	}	// for (vtkIdType i = 0; i < inCellsNum; i++)
+	cellOffsets [inCellsNum]	= cellPoints.size ( );
 
-	// Restitution de la mmoire inutilise :
-	points->Squeeze ( );
-	output->Squeeze ( );
-	DesallocateTriangleBuffer ( );
-
-	return RD_SUCCESS;
-}	// vtkUnstructuredGridRefinementFilter::Execute
-
-
-void vtkUnstructuredGridRefinementFilter::refineLine (
-					vtkCell& cell, vtkPoints& points, vtkUnstructuredGrid& grid)
-{
-	const VTKCellType	type	= (VTKCellType)cell.GetCellType ( );
-	switch (type)
+	// Passe 2 : nombre de primitives de chaque maille.
+	std::vector<vtkIdType>	cellPrimitives (inCellsNum, 0);
+	parallelFor (inCellsNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		case VTK_LINE		:
-		case VTK_POLY_LINE	:
-			break;
-		default				:
-			cerr << __FILE__ << ' ' << __LINE__ << " vtkUnstructuredGridRefinementFilter::refineLine. Invalid cell type (" << (int)type << ")." << endl;
-			return;
-	}	// switch (type)
-
-	const unsigned int	factor	= GetRefinementFactor ( );
-	vtkIdList*	cellPts	= cell.GetPointIds ( );
-	assert (0 != cellPts);
-	const vtkIdType	ptsNum	= cellPts->GetNumberOfIds ( );
-	// Les points utiliss : ceux existants + subdivisions :
-	vtkIdType*	pointset	= new vtkIdType [factor + 1];
-	memset (pointset, 0, (factor + 1) * sizeof (vtkIdType));
-	// On dcoupe chaque segment :
-	for (vtkIdType i = 1; i < ptsNum; i++)
+		for (vtkIdType i = begin; i < end; i++)
+			cellPrimitives [i]	= primitivesNum (cellTypes [i], cellOffsets [i + 1] - cellOffsets [i]);
+	});
+	const vtkIdType	primNum	= prefixSum (cellPrimitives);
+
+	// Passe 3 : les primitives (2 ou 3 sommets) et le recensement des artes.
+	// primPoints [3*p+2] vaut -1 pour un segment.
+	std::vector<vtkIdType>	primPoints (3 * primNum, -1);
+	parallelFor (inCellsNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		vtkIdType	id0	= cellPts->GetId (i - 1), id1	= cellPts->GetId (i);
-		double	pt0 [3]	= { 0., 0., 0. }, pt1 [3] = { 0., 0., 0. };
-		points.GetPoint (id0, pt0);
-		points.GetPoint (id1, pt1);
-		pointset [0]		= id0;
-		pointset [factor]	= id1;
-		double d [3] = { (pt1 [0] - pt0 [0]) / factor,
-				(pt1 [1] - pt0 [1]) / factor, (pt1 [2] - pt0 [2]) / factor };
-
-		// Cration des nouveaux points :
-		for (unsigned int r = 1; r < factor; r++)
+		for (vtkIdType i = begin; i < end; i++)
 		{
-			double	coords [3]	= { 0., 0., 0. };
-			for (int c = 0; c < 3; c++)
-				coords [c]	= pt0 [c] + r * d [c];
-//			pointset [r]	= points.InsertNextPoint (coords);
-			const vtkIdType	pt	= points.InsertNextPoint (coords);
-			pointset [r]	= pt;
-		}	// for (unsigned int r = 1; r < factor - 1; r++)
-
-		// Insertion des segments crs :
-		for (unsigned int s = 0; s < factor; s++)
-			grid.InsertNextCell (VTK_LINE, 2, (pointset + s));
-	}	// for (vtkIdType i = 1; i < ptsNum; i++)
-
-	delete [] pointset;	pointset	= 0;
-}	// vtkUnstructuredGridRefinementFilter::refineLine
-
-
-void vtkUnstructuredGridRefinementFilter::refineTriangle (
-					vtkCell& cell, vtkPoints& points, vtkUnstructuredGrid& grid)
-{
-	assert (0 != _triangleBuffer);
-	const size_t	factor	= GetRefinementFactor ( );
-	const size_t	rows	= factor + 1;
-	const size_t	cols	= factor + 1;
-	vtkIdList*	cellPts	= cell.GetPointIds ( );
-	assert (0 != cellPts);
-	const vtkIdType		ptsNum	= cellPts->GetNumberOfIds ( );
-	if (3 != ptsNum)
-	{
-		cerr << __FILE__ << ' ' << __LINE__ << " vtkUnstructuredGridRefinementFilter::refineTriangle. Invalid cell type (" << (int)cell.GetCellType ( ) << ")." << endl;
-	}	// if (3 != ptsNum)
-	const vtkIdType	idA = cellPts->GetId (0), idB = cellPts->GetId (1), idC = cellPts->GetId (2);
-	double	ptA [3]	= { 0., 0., 0. }, ptB [3] = { 0., 0., 0. }, ptC [3] = { 0., 0., 0. };
-	points.GetPoint (idA, ptA);
-	points.GetPoint (idB, ptB);
-	points.GetPoint (idC, ptC);
-
-	// Les points utiliss : les 3 existants + subdivisions. On transforme le
-	// triangle en quad dgnr de factor lignes x factor colonnes et on
-	// subdivise en quads.
-	// Chacun de ces quads formera 2 triangles :
-	// A        A ________C
-	// |\        |_|_|_|_|C
-	// | \       |_|_|_|_|C
-	// |  \C     |_|_|_|_|C
-	// |  /   => |_|_|_|_|C
-	// | /       |_|_|_|_|C
-	// |/        |_|_|_|_|C
-	// B        B|_|_|_|_|C
-
-	// Les angles :
-	for (vtkIdType r = 0; r < rows; r++)
-		for (vtkIdType c = 0; c < cols; c++)
-			_triangleBuffer [r][c]	= (vtkIdType)-1;
-	_triangleBuffer [0][0]			= idA;
-	_triangleBuffer [rows - 1][0]	= idB;
-	for (vtkIdType r = 0; r < rows; r++)
-		_triangleBuffer [r][cols - 1]	= idC;
-
-	// Progression sur AC et BC :
-	double dAC [3] = { (ptC [0] - ptA [0]) / factor,
-				(ptC [1] - ptA [1]) / factor, (ptC [2] - ptA [2]) / factor };
-	double dBC [3] = { (ptC [0] - ptB [0]) / factor,
-				(ptC [1] - ptB [1]) / factor, (ptC [2] - ptB [2]) / factor };
-
-	// Cration des nouveaux points :
-	for (size_t c = 0; c < cols; c++)
+			const vtkIdType*	pts		= &cellPoints [0] + cellOffsets [i];
+			const vtkIdType		count	= primitivesNum (cellTypes [i], cellOffsets [i + 1] - cellOffsets [i]);
+			vtkIdType*			prim	= &primPoints [0] + 3 * cellPrimitives [i];
+			for (vtkIdType j = 0; j < count; j++, prim += 3)
+			{
+				switch (cellTypes [i])
+				{
+					case VTK_LINE			:
+					case VTK_POLY_LINE		:
+						prim [0]	= pts [j];		prim [1]	= pts [j + 1];
+						break;
+					case VTK_TRIANGLE		:
+						prim [0]	= pts [0];		prim [1]	= pts [1];	prim [2]	= pts [2];
+						break;
+					case VTK_TRIANGLE_STRIP	:	// Orientation alterne
+						prim [0]	= pts [j + (j % 2)];	prim [1]	= pts [j + 1 - (j % 2)];
+						prim [2]	= pts [j + 2];
+						break;
+				}	// switch (cellTypes [i])
+			}	// for (vtkIdType j = 0; j < count; j++, prim += 3)
+		}	// for (vtkIdType i = begin; i < end; i++)
+	});
+	cellPoints.clear ( );
+
+	// Sommets extrmits des artes d'une primitive : AB, AC et BC pour un
+	// triangle (A, B, C), AB pour un segment.
+	static const int	edgeVertices [3][2]	= { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+	ConcurrentEdgeTable	edges (3 * primNum);
+	parallelFor (primNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		double	ptAC [3]	= { 0., 0., 0. };	// Point sur segment AC
-		double	ptBC [3]	= { 0., 0., 0. };	// Point sur segment BC
-		for (int i = 0; i < 3; i++)
+		for (vtkIdType p = begin; p < end; p++)
 		{
-			ptAC [i]	= ptA [i] + c * dAC [i];
-			ptBC [i]	= ptB [i] + c * dBC [i];
-		}	// for (int i = 0; i < 3; i++)
-
-		// A partir de ces 2 points on a un segment qu'on raffine galement :
-		for (size_t r = 0; r < rows; r++)
+			const vtkIdType*	prim	= &primPoints [3 * p];
+			const int			count	= -1 == prim [2] ? 1 : 3;
+			for (int e = 0; e < count; e++)
+				edges.insert (edgeKey (prim [edgeVertices [e][0]], prim [edgeVertices [e][1]]), p);
+		}	// for (vtkIdType p = begin; p < end; p++)
+	});
+
+	// Passe 4 : comptage, par primitive, des artes dont elle est
+	// propritaire, des points intrieurs et des mailles crs.
+	// Un segment donne factor segments, un triangle factor x (2 factor - 1)
+	// triangles et (factor - 1)^2 points intrieurs.
+	std::vector<vtkIdType>	ownedEdges (primNum, 0), innerPoints (primNum, 0);
+	std::vector<vtkIdType>	outCells (primNum, 0), outConnectivity (primNum, 0);
+	parallelFor (primNum, [&] (vtkIdType begin, vtkIdType end)
+	{
+		for (vtkIdType p = begin; p < end; p++)
 		{
-			double d [3] = {(ptBC [0] - ptAC [0]) / factor,
-				(ptBC [1] - ptAC [1]) / factor, (ptBC [2] - ptAC [2]) / factor};
-			if ((vtkIdType)-1 == _triangleBuffer [r][c])
+			const vtkIdType*	prim	= &primPoints [3 * p];
+			const bool			segment	= -1 == prim [2];
+			const int			count	= true == segment ? 1 : 3;
+			uint64_t			keys [3];
+			for (int e = 0; e < count; e++)
 			{
-				double	coords [3]	= { 0., 0., 0. };
-				for (int i = 0; i < 3; i++)
-					coords [i]	= ptAC [i] + r * d [i];
-				const vtkIdType	pt	= points.InsertNextPoint (coords);
-				_triangleBuffer [r][c]	= pt;
-			}	// if ((vtkIdType)-1 == _triangleBuffer [r][c])
-		}	// for (size_t r = 0; r < rows; r++)
-	}	// for (size_t c = 0; c < cols; c++)
-	// On ajoute les triangles crs :
-	for (size_t r = 0; r < rows - 1; r++)
+				keys [e]	= edgeKey (prim [edgeVertices [e][0]], prim [edgeVertices [e][1]]);
+				bool	duplicated	= false;	// Triangle dgnr
+				for (int k = 0; k < e; k++)
+					duplicated	= duplicated || (keys [k] == keys [e]);
+				if ((false == duplicated) && (p == edges.owner (edges.find (keys [e]))))
+					ownedEdges [p]++;
+			}	// for (int e = 0; e < count; e++)
+			innerPoints [p]		= true == segment ? 0 : (factor - 1) * (factor - 1);
+			outCells [p]		= true == segment ? factor : factor * (2 * factor - 1);
+			outConnectivity [p]	= (true == segment ? 2 : 3) * outCells [p];
+		}	// for (vtkIdType p = begin; p < end; p++)
+	});
+	const vtkIdType	edgesNum		= prefixSum (ownedEdges);
+	const vtkIdType	innerPtsNum		= prefixSum (innerPoints);
+	const vtkIdType	outCellsNum		= prefixSum (outCells);
+	const vtkIdType	outConnNum		= prefixSum (outConnectivity);
+	const vtkIdType	edgePtsFirst	= inPtsNum;
+	const vtkIdType	innerPtsFirst	= edgePtsFirst + edgesNum * (factor - 1);
+	const vtkIdType	outPtsNum		= innerPtsFirst + innerPtsNum;
+
+	// Passe 5 : numrotation des artes par leur propritaire.
+	parallelFor (primNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		for (size_t c = 0; c < cols - 1; c++)
+		for (vtkIdType p = begin; p < end; p++)
 		{
-			const vtkIdType	id1	= _triangleBuffer [r][c];
-			const vtkIdType	id2	= _triangleBuffer [r][c + 1];
-			const vtkIdType	id3	= _triangleBuffer [r + 1][c];
-			const vtkIdType	id4	= _triangleBuffer [r + 1][c + 1];
-			vtkIdType	triangle1Ids [3]	= { id1, id2, id3 };
-			vtkIdType	triangle2Ids [3]	= { id2, id4, id3 };
-			grid.InsertNextCell (VTK_TRIANGLE, 3, triangle1Ids);
-			if (cols -1 != c)	// Dernire colonne => dgnrescence
-				grid.InsertNextCell (VTK_TRIANGLE, 3, triangle2Ids);
-		}	// for (size_t c = 0; c < cols; c++)
-	}	// for (size_t r = 0; r < rows; r++)
-}	// vtkUnstructuredGridRefinementFilter::refineTriangle
-
-
-void vtkUnstructuredGridRefinementFilter::AllocateTriangleBuffer ( )
-{
-	const vtkIdType	size	= GetRefinementFactor ( ) + 1;
-	_triangleBuffer	= new vtkIdType* [size];
-	for (vtkIdType i = 0; i < size; i++)
+			const vtkIdType*	prim	= &primPoints [3 * p];
+			const int			count	= -1 == prim [2] ? 1 : 3;
+			vtkIdType			index	= ownedEdges [p];
+			for (int e = 0; e < count; e++)
+			{
+				const size_t	slot	= edges.find (edgeKey (prim [edgeVertices [e][0]], prim [edgeVertices [e][1]]));
+				if ((p == edges.owner (slot)) && (-1 == edges.index (slot)))
+					edges.setIndex (slot, index++);
+			}	// for (int e = 0; e < count; e++)
+		}	// for (vtkIdType p = begin; p < end; p++)
+	});
+
+	// Allocation des tableaux de sortie :
+	vtkPoints*		points		= vtkPoints::New ( );
+	points->SetDataTypeToDouble ( );
+	points->SetNumberOfPoints (outPtsNum);
+	double*			coords		= vtkDoubleArray::SafeDownCast (points->GetData ( ))->GetPointer (0);
+	vtkUnsignedCharArray*	types	= vtkUnsignedCharArray::New ( );
+	types->SetNumberOfValues (outCellsNum);
+	unsigned char*	outTypes	= types->GetPointer (0);
+	vtkCellArray*	cells		= vtkCellArray::New ( );
+#if VTK_MAJOR_VERSION >= 9
+	vtkIdTypeArray*	offsets		= vtkIdTypeArray::New ( );
+	offsets->SetNumberOfValues (outCellsNum + 1);
+	vtkIdType*		outOffsets	= offsets->GetPointer (0);
+	vtkIdTypeArray*	connectivity	= vtkIdTypeArray::New ( );
+	connectivity->SetNumberOfValues (outConnNum);
+	vtkIdType*		outConn		= connectivity->GetPointer (0);
+	outOffsets [outCellsNum]	= outConnNum;
+#else	// VTK_MAJOR_VERSION >= 9
+	// Format historique : nombre de points puis identifiants pour chaque maille
+	vtkIdTypeArray*	legacy		= vtkIdTypeArray::New ( );
+	legacy->SetNumberOfValues (outConnNum + outCellsNum);
+	vtkIdType*		outLegacy	= legacy->GetPointer (0);
+	vtkIdTypeArray*	locations	= vtkIdTypeArray::New ( );
+	locations->SetNumberOfValues (outCellsNum);
+	vtkIdType*		outLocations	= locations->GetPointer (0);
+#endif	// VTK_MAJOR_VERSION >= 9
+
+	// Passe 6 : les points existants sont conservs.
+	parallelFor (inPtsNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		_triangleBuffer	[i]	= new vtkIdType [size];	
-		memset (_triangleBuffer [i], 0, size * sizeof (vtkIdType));
-	}
-}	// vtkUnstructuredGridRefinementFilter::AllocateTriangleBuffer
-
+		for (vtkIdType i = begin; i < end; i++)
+			input->GetPoint (i, coords + 3 * i);
+	});
 
-void vtkUnstructuredGridRefinementFilter::DesallocateTriangleBuffer ( )
-{
-	if (0 != _triangleBuffer)
+	// Passe 7 : cration des points et mailles de chaque primitive.
+	parallelFor (primNum, [&] (vtkIdType begin, vtkIdType end)
 	{
-		const vtkIdType	size	= GetRefinementFactor ( ) + 1;
-		for (vtkIdType i = 0; i < size; i++)
-			delete [] _triangleBuffer [i];
-		delete [] _triangleBuffer;
-		_triangleBuffer	= 0;
-	}	// if (0 != _triangleBuffer)
-}	// vtkUnstructuredGridRefinementFilter::DesallocateTriangleBuffer
+		// Identifiant du r-ime point (0 <= r <= factor) de l'arte (a, b)
+		// parcourue de a vers b.
+		auto	edgePoint	= [&] (vtkIdType a, vtkIdType b, vtkIdType r) -> vtkIdType
+		{
+			if (0 == r)
+				return a;
+			if (factor == r)
+				return b;
+			const vtkIdType	first	= edgePtsFirst + edges.index (edges.find (edgeKey (a, b))) * (factor - 1);
+			return a < b ? first + r - 1 : first + factor - r - 1;
+		};
+		std::vector<vtkIdType>	grid ((factor + 1) * (factor + 1));
+
+		for (vtkIdType p = begin; p < end; p++)
+		{
+			const vtkIdType*	prim		= &primPoints [3 * p];
+			const bool			segment		= -1 == prim [2];
+			const int			count		= true == segment ? 1 : 3;
+			vtkIdType			cell		= outCells [p];
+			vtkIdType			conn		= outConnectivity [p];
+
+			// Points des artes dont la primitive est propritaire, de la plus
+			// petite extrmit vers la plus grande :
+			for (int e = 0; e < count; e++)
+			{
+				const vtkIdType	a	= prim [edgeVertices [e][0]], b	= prim [edgeVertices [e][1]];
+				const size_t	slot	= edges.find (edgeKey (a, b));
+				if (p != edges.owner (slot))
+					continue;
+				const vtkIdType	from	= a < b ? a : b, to	= a < b ? b : a;
+				double*			pt		= coords + 3 * (edgePtsFirst + edges.index (slot) * (factor - 1));
+				double			pt0 [3]	= { 0., 0., 0. }, pt1 [3] = { 0., 0., 0. };
+				input->GetPoint (from, pt0);
+				input->GetPoint (to, pt1);
+				for (vtkIdType r = 1; r < factor; r++, pt += 3)
+					for (int c = 0; c < 3; c++)
+						pt [c]	= pt0 [c] + r * (pt1 [c] - pt0 [c]) / factor;
+			}	// for (int e = 0; e < count; e++)
+
+			if (true == segment)
+			{
+				for (vtkIdType s = 0; s < factor; s++, cell++, conn += 2)
+				{
+					const vtkIdType	ids [2]	= { edgePoint (prim [0], prim [1], s), edgePoint (prim [0], prim [1], s + 1) };
+					outTypes [cell]	= VTK_LINE;
+#if VTK_MAJOR_VERSION >= 9
+					outOffsets [cell]	= conn;
+					memcpy (outConn + conn, ids, 2 * sizeof (vtkIdType));
+#else	// VTK_MAJOR_VERSION >= 9
+					outLocations [cell]	= conn + cell;
+					outLegacy [conn + cell]	= 2;
+					memcpy (outLegacy + conn + cell + 1, ids, 2 * sizeof (vtkIdType));
+#endif	// VTK_MAJOR_VERSION >= 9
+				}	// for (vtkIdType s = 0; s < factor; s++, cell++, conn += 2)
+				continue;
+			}	// if (true == segment)
+
+			// Triangle : on le transforme en quad dgnr de factor lignes x
+			// factor colonnes et on subdivise en quads.
+			// Chacun de ces quads formera 2 triangles :
+			// A        A ________C
+			// |\        |_|_|_|_|C
+			// | \       |_|_|_|_|C
+			// |  \C     |_|_|_|_|C
+			// |  /   => |_|_|_|_|C
+			// | /       |_|_|_|_|C
+			// |/        |_|_|_|_|C
+			// B        B|_|_|_|_|C
+			// La colonne 0 est l'arte AB, la ligne 0 l'arte AC, la dernire
+			// ligne l'arte BC, la dernire colonne est rduite  C.
+			const vtkIdType	idA = prim [0], idB = prim [1], idC = prim [2];
+			double	ptA [3]	= { 0., 0., 0. }, ptB [3] = { 0., 0., 0. }, ptC [3] = { 0., 0., 0. };
+			input->GetPoint (idA, ptA);
+			input->GetPoint (idB, ptB);
+			input->GetPoint (idC, ptC);
+			vtkIdType		inner	= innerPtsFirst + innerPoints [p];
+			for (vtkIdType r = 0; r <= factor; r++)
+			{
+				for (vtkIdType c = 0; c <= factor; c++)
+				{
+					vtkIdType&	id	= grid [r * (factor + 1) + c];
+					if (factor == c)
+						id	= idC;
+					else if (0 == c)
+						id	= edgePoint (idA, idB, r);
+					else if (0 == r)
+						id	= edgePoint (idA, idC, c);
+					else if (factor == r)
+						id	= edgePoint (idB, idC, c);
+					else
+					{
+						// Point intrieur, sur le segment joignant les points
+						// de AC et BC de la colonne c :
+						id	= inner++;
+						double*	pt	= coords + 3 * id;
+						for (int i = 0; i < 3; i++)
+						{
+							const double	ptAC	= ptA [i] + c * (ptC [i] - ptA [i]) / factor;
+							const double	ptBC	= ptB [i] + c * (ptC [i] - ptB [i]) / factor;
+							pt [i]	= ptAC + r * (ptBC - ptAC) / factor;
+						}	// for (int i = 0; i < 3; i++)
+					}
+				}	// for (vtkIdType c = 0; c <= factor; c++)
+			}	// for (vtkIdType r = 0; r <= factor; r++)
+
+			// On ajoute les triangles crs :
+			for (vtkIdType r = 0; r < factor; r++)
+			{
+				for (vtkIdType c = 0; c < factor; c++)
+				{
+					const vtkIdType	id1	= grid [r * (factor + 1) + c];
+					const vtkIdType	id2	= grid [r * (factor + 1) + c + 1];
+					const vtkIdType	id3	= grid [(r + 1) * (factor + 1) + c];
+					const vtkIdType	id4	= grid [(r + 1) * (factor + 1) + c + 1];
+					const vtkIdType	triangles [2][3]	= { { id1, id2, id3 }, { id2, id4, id3 } };
+					// Dernire colonne => le second triangle est dgnr (id2 == id4 == C)
+					const int		trianglesNum		= factor - 1 == c ? 1 : 2;
+					for (int t = 0; t < trianglesNum; t++, cell++, conn += 3)
+					{
+						outTypes [cell]	= VTK_TRIANGLE;
+#if VTK_MAJOR_VERSION >= 9
+						outOffsets [cell]	= conn;
+						memcpy (outConn + conn, triangles [t], 3 * sizeof (vtkIdType));
+#else	// VTK_MAJOR_VERSION >= 9
+						outLocations [cell]	= conn + cell;
+						outLegacy [conn + cell]	= 3;
+						memcpy (outLegacy + conn + cell + 1, triangles [t], 3 * sizeof (vtkIdType));
+#endif	// VTK_MAJOR_VERSION >= 9
+					}	// for (int t = 0; t < trianglesNum; t++, cell++, conn += 3)
+				}	// for (vtkIdType c = 0; c < factor; c++)
+			}	// for (vtkIdType r = 0; r < factor; r++)
+		}	// for (vtkIdType p = begin; p < end; p++)
+	});
+
+	// Transmission  la sortie :
+	output->SetPoints (points);
+	points->Delete ( );
+#if VTK_MAJOR_VERSION >= 9
+	cells->SetData (offsets, connectivity);
+	offsets->Delete ( );
+	connectivity->Delete ( );
+	output->SetCells (types, cells);
+#else	// VTK_MAJOR_VERSION >= 9
+	cells->SetCells (outCellsNum, legacy);
+	legacy->Delete ( );
+	output->SetCells (types, locations, cells);
+	locations->Delete ( );
+#endif	// VTK_MAJOR_VERSION >= 9
+	types->Delete ( );
+	cells->Delete ( );
 
+	return RD_SUCCESS;
+}	// vtkUnstructuredGridRefinementFilter::Execute
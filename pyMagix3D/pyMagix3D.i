@@ -158,6 +158,13 @@ using std::ptrdiff_t;
     delete $1;
 }
 
+%typemap(out) std::vector<double> {
+    $result=PyList_New($1.size() );
+    for(size_t k = 0; k < $1.size(); ++k) {
+        PyList_SetItem($result,k,PyFloat_FromDouble( $1[k] ));
+    }
+}
+
 // ------------------------------- 
 
 %typemap(in) std::vector<Mgx3D::Utils::Math::Point>& { 
@@ -441,6 +441,25 @@ virtual void Mgx3D::Internal::ContextIfc::redo()
 
 Rejoue la dernière commande défaite 
 
+";
+%feature("docstring") Mgx3D::Internal::ContextIfc::restoreCheckpoint "
+virtual Internal::M3DCommandResultIfc* Mgx3D::Internal::ContextIfc::restoreCheckpoint(std::string fileName)
+
+
+Recrée, dans une session vide, l'état sauvegardé par saveCheckpoint. Les commandes suivantes d'un script peuvent ensuite être rejouées. Cette commande n'est pas annulable.
+
+fileName : nom du fichier de reprise
+
+";
+%feature("docstring") Mgx3D::Internal::ContextIfc::saveCheckpoint "
+virtual void Mgx3D::Internal::ContextIfc::saveCheckpoint(std::string fileName, bool withMesh=true)
+
+
+Sauvegarde l'état de la session (géométrie, topologie, groupes et maillage) dans un fichier binaire de reprise. Ce n'est pas une commande, elle n'apparaît pas dans le script.
+
+fileName : nom du fichier de reprise
+withMesh : vrai si le maillage doit être sauvegardé
+
 ";
 %feature("docstring") Mgx3D::Internal::ContextIfc::savePythonScript "
 virtual void Mgx3D::Internal::ContextIfc::savePythonScript(std::string fileName, bool withouEntityName, TkUtil::Charset::CHARSET charset)
@@ -1279,6 +1298,28 @@ Il peut s'agir d'une perturbation sous forme de fonction Python Les coordonnées
 nom : nom du groupe avec lequel on effectue la perturbation 
 py_obj : l'objet python auquel il est fait appel pour modifier le maillage 
 
+";
+%feature("docstring") Mgx3D::Group::GroupManagerIfc::addCartesianBatchPerturbation "
+virtual void Mgx3D::Group::GroupManagerIfc::addCartesianBatchPerturbation(const std::string &nom, PyObject *py_obj)
+
+
+Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par une fonction Python appelée une seule fois pour l'ensemble des noeuds
+La fonction reçoit un memoryview (N x 3 doubles, sans recopie) sur les coordonnées cartésiennes des noeuds, et retourne None si elle les a modifiées sur place, ou bien un tableau N x 3 de nombres (numpy de doubles ou de float32, liste de listes...). La fonction ne doit pas conserver de référence sur le memoryview
+
+nom : nom du groupe avec lequel on effectue la perturbation 
+py_obj : l'objet python auquel il est fait appel pour modifier le maillage 
+
+";
+%feature("docstring") Mgx3D::Group::GroupManagerIfc::addPolarBatchPerturbation "
+virtual void Mgx3D::Group::GroupManagerIfc::addPolarBatchPerturbation(const std::string &nom, PyObject *py_obj)
+
+
+Ajoute une perturbation du maillage pour un groupe (2D ou 3D) par une fonction Python appelée une seule fois pour l'ensemble des noeuds
+Idem addCartesianBatchPerturbation, les coordonnées sont polaires
+
+nom : nom du groupe avec lequel on effectue la perturbation 
+py_obj : l'objet python auquel il est fait appel pour modifier le maillage 
+
 ";
 %feature("docstring") Mgx3D::Group::GroupManagerIfc::addPolarPerturbation "
 virtual void Mgx3D::Group::GroupManagerIfc::addPolarPerturbation(const std::string &nom, PyObject *py_obj)
@@ -1452,6 +1493,24 @@ virtual int Mgx3D::Mesh::MeshManagerIfc::getNbVolumes(bool onlyVisible=true) con
 
 
 
+";
+%feature("docstring") Mgx3D::Mesh::MeshManagerIfc::getQualityHistogram "
+virtual std::vector<double> Mgx3D::Mesh::MeshManagerIfc::getQualityHistogram(const std::string &name, int dim, const std::string &criterion, int nbClasses) const 
+
+
+Retourne l'histogramme d'un critère de qualité des mailles d'un volume ou d'une surface : nombre de mailles de chacune des nbClasses classes réparties sur le domaine du critère ([-1, 1] pour le jacobien normalisé, [0, 1] pour le biais, [1, 10] pour le rapport d'aspect, [min, max] pour le volume), les valeurs hors domaine étant dans la première ou la dernière classe 
+
+";
+%feature("docstring") Mgx3D::Mesh::MeshManagerIfc::getQualityStatistics "
+virtual std::vector<double> Mgx3D::Mesh::MeshManagerIfc::getQualityStatistics(const std::string &name, int dim, const std::string &criterion) const 
+
+
+Retourne les statistiques d'un critère de qualité des mailles d'un volume (dim 3, hexaèdres) ou d'une surface (dim 2, quadrangles) : [nombre de mailles évaluées, min, max, moyenne, nombre de mailles invalides]
+
+name : nom du volume ou de la surface 
+dim : dimension (3 ou 2) 
+criterion : \"ScaledJacobian\", \"Skew\", \"AspectRatio\" ou \"Volume\" 
+
 ";
 %feature("docstring") Mgx3D::Mesh::MeshManagerIfc::getStrategy "
 virtual strategy Mgx3D::Mesh::MeshManagerIfc::getStrategy()
@@ -1500,7 +1559,23 @@ Modificateur de strategie.
 %feature("docstring") Mgx3D::Mesh::MeshManagerIfc::smooth "
 virtual void Mgx3D::Mesh::MeshManagerIfc::smooth()
 
-Lissage du maillage. 
+Lissage du maillage.
+
+";
+%feature("docstring") Mgx3D::Mesh::MeshManagerIfc::getTopoNodes "
+virtual std::vector<double> Mgx3D::Mesh::MeshManagerIfc::getTopoNodes(const std::string &name, int dim)
+
+
+Retourne les noeuds du maillage d'une entité topologique maillée, bord compris : [id, x, y, z] pour chaque noeud, dans l'ordre de l'entité
+
+name : nom du sommet, de l'arête commune, de la face commune ou du bloc 
+dim : dimension de l'entité (0 à 3) 
+
+";
+%feature("docstring") Mgx3D::Mesh::MeshManagerIfc::updateMesh "
+virtual Mgx3D::Internal::M3DCommandResultIfc* Mgx3D::Mesh::MeshManagerIfc::updateMesh()
+
+Met à jour le maillage des seules entités topologiques modifiées depuis qu'elles ont été maillées (discrétisation, association, coordonnées), ainsi que de leurs voisines impactées. Cette opération n'est pas annulable.
 
 ";
 %feature("docstring") Mgx3D::Mesh::MeshManagerIfc::writeMli "
@@ -1850,6 +1925,12 @@ eSolver Mgx3D::Mesh::SurfacicSmoothing::getSolver() const
 
 accesseur sur le solver 
 
+";
+%feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::getNbPatches "
+int Mgx3D::Mesh::SurfacicSmoothing::getNbPatches() const 
+
+accesseur sur le nombre de morceaux 
+
 ";
 %feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::setMethod "
 void Mgx3D::Mesh::SurfacicSmoothing::setMethod(eSurfacicMethod methodeLissage)
@@ -1868,6 +1949,14 @@ void Mgx3D::Mesh::SurfacicSmoothing::setSolver(eSolver solver)
 
 change le type de solver utilisé par Mesquite 
 
+";
+%feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::setNbPatches "
+void Mgx3D::Mesh::SurfacicSmoothing::setNbPatches(int nbPatches)
+
+change le nombre de morceaux lissés indépendamment (parallèlement si 
+allowThreadedCommandTasks), 1 (défaut) pour un lissage global. Ce nombre 
+est réduit pour les petites surfaces. 
+
 ";
 %feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing "
 Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing()
@@ -1880,6 +1969,13 @@ Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing(int nbIterations, eSurfacicMet
 
 Constructeur avec paramètres différents du défaut. 
 
+";
+%feature("docstring") Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing "
+Mgx3D::Mesh::SurfacicSmoothing::SurfacicSmoothing(int nbIterations, eSurfacicMethod methodeLissage, eSolver solver, int nbPatches)
+
+Constructeur avec lissage par morceaux (nbPatches morceaux lissés 
+indépendamment, 1 pour un lissage global). 
+
 ";
 %feature("docstring") Mgx3D::Topo::TopoManagerIfc " 
 Interface de gestionnaire des opérations effectuées au niveau du module topologique. 
@@ -2518,6 +2614,11 @@ Mgx3D::Utils::Math::Vector::Vector(const Point &p1, const Point &p2)
 %feature("docstring") Mgx3D::Mesh::VolumicSmoothing " 
 
 Objet qui va modifier un maillage suivant un lissage volumique 
+
+Les méthodes laplace, tipton, jun, conditionNumber et inverseMeanRatio 
+utilisent Smooth3D, les méthodes coloredLaplace, coloredConditionNumber et 
+coloredInverseMeanRatio le lisseur natif (multithreadé si 
+allowThreadedCommandTasks, même résultat qu'en séquentiel). 
 ";
 
 %feature("docstring") Mgx3D::Mesh::VolumicSmoothing::getMethod "
@@ -0,0 +1,30 @@
+import os
+import shutil
+import pytest
+import pyMagix3D as Mgx3D
+
+# executable Magix3D pour les tests de l'application (IHM hors ecran) : donne
+# par la variable d'environnement MGX3D_EXE (renseignee par CMakeLists.txt),
+# sinon recherche dans le PATH puis dans l'installation de pyMagix3D
+# (prefix/lib/.../pyMagix3D.py et prefix/bin/Magix3D)
+
+def find_mgx3d_exe():
+    exe = os.environ.get("MGX3D_EXE")
+    if exe:
+        return exe
+    exe = shutil.which("Magix3D")
+    if exe:
+        return exe
+    path = os.path.dirname(os.path.abspath(Mgx3D.__file__))
+    while path != os.path.dirname(path):
+        exe = os.path.join(path, "bin", "Magix3D")
+        if os.access(exe, os.X_OK):
+            return exe
+        path = os.path.dirname(path)
+    return None
+
+@pytest.fixture(scope="session")
+def mgx3d_exe():
+    exe = find_mgx3d_exe()
+    assert exe, "executable Magix3D introuvable (MGX3D_EXE, PATH, installation de pyMagix3D)"
+    return exe
@@ -0,0 +1,143 @@
+import pytest
+import pyMagix3D as Mgx3D
+
+def xyz(pt):
+    return [pt.getX(), pt.getY(), pt.getZ()]
+
+def infos(tm, name, dim):
+    i = tm.getInfos(name, dim)
+    return (i.vertices(), i.coedges(), i.edges(), i.cofaces(), i.faces(),
+            i.blocks(), i.geomEntity(), i.groupsName())
+
+def edge_property(tm, name):
+    p = tm.getEdgeMeshingProperty(name)
+    return (p.getMeshLawName(), p.getNbEdges(), p.getDirect(),
+            p.isOrthogonal(), p.getNbLayers())
+
+# etat de la session, entite par entite : associations, relations
+# topologiques, groupes, proprietes de discretisation, coordonnees des
+# sommets et des noeuds du maillage
+def snapshot(ctx, groups, meshed):
+    gm = ctx.getGeomManager()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    grm = ctx.getGroupManager()
+    state = {}
+    for v in gm.getVertices():
+        state[("geom", v)] = xyz(gm.getCoord(v))
+    for g in groups:
+        for v in grm.getTopoVertices([g]):
+            state[(0, v)] = (infos(tm, v, 0), xyz(tm.getCoord(v)))
+        for e in grm.getTopoEdges([g]):
+            state[(1, e)] = (infos(tm, e, 1), edge_property(tm, e))
+        for f in grm.getTopoFaces([g]):
+            state[(2, f)] = infos(tm, f, 2)
+        for b in grm.getTopoBlocks([g]):
+            state[(3, b)] = infos(tm, b, 3)
+    for dim, getter in ((0, grm.getTopoVertices), (1, grm.getTopoEdges),
+                        (2, grm.getTopoFaces), (3, grm.getTopoBlocks)):
+        for name in getter(meshed):
+            state[("mesh", dim, name)] = list(mm.getTopoNodes(name, dim))
+    state["transfinite"] = (sorted(tm.getTransfiniteMeshLawFaces()),
+                            sorted(tm.getTransfiniteMeshLawBlocks()))
+    state["unstructured"] = (sorted(tm.getUnstructuredFaces()),
+                             sorted(tm.getUnstructuredBlocks()))
+    return state
+
+def assert_same(restored, saved):
+    assert sorted(restored.keys(), key=str) == sorted(saved.keys(), key=str)
+    for key, value in saved.items():
+        if key[0] == "geom":
+            assert restored[key] == pytest.approx(value), key
+        elif key[0] == 0:
+            assert restored[key][0] == value[0], key
+            assert restored[key][1] == pytest.approx(value[1]), key
+        elif key[0] == "mesh":
+            assert restored[key] == pytest.approx(value), key
+        else:
+            assert restored[key] == value, key
+
+# sauvegarde de la session dans un fichier de reprise et relecture dans une session vide
+def test_checkpoint_restore(tmp_path):
+    ctx = Mgx3D.getStdContext()
+    gm = ctx.getGeomManager()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    grm = ctx.getGroupManager()
+    # bloc structure maille, dont une arete suivant une progression geometrique
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10, "BOX")
+    topo_edges = grm.getTopoEdges(["BOX"])
+    tm.setNbMeshingEdges(topo_edges[0], 20, [])
+    # meme nombre de bras que les aretes paralleles
+    nb = tm.getNbMeshingEdges(topo_edges[1])
+    tm.setMeshingProperty(Mgx3D.EdgeMeshingPropertyGeometric(nb, 1.2), [topo_edges[1]])
+    # bloc non structure, non maille
+    tm.newBoxWithTopo(Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 4, 4, 4, "BOX2")
+    tm.setMeshingProperty(Mgx3D.FaceMeshingPropertyDelaunayGMSH(0.1, 0.2), grm.getTopoFaces(["BOX2"]))
+    tm.setMeshingProperty(Mgx3D.BlockMeshingPropertyDelaunayTetgen(), grm.getTopoBlocks(["BOX2"]))
+    mm.newBlocksMesh(grm.getTopoBlocks(["BOX"]))
+
+    saved = snapshot(ctx, ["BOX", "BOX2"], ["BOX"])
+    assert edge_property(tm, topo_edges[1])[0] != edge_property(tm, topo_edges[2])[0]
+    assert saved["unstructured"][1] == sorted(grm.getTopoBlocks(["BOX2"]))
+    volumes = gm.getVolumes()
+    nb_nodes = mm.getNbNodes()
+    nb_mesh_faces = mm.getNbFaces()
+    nb_regions = mm.getNbRegions()
+
+    file_name = str(tmp_path / "session.mgxckp")
+    ctx.saveCheckpoint(file_name)
+
+    # nom de la prochaine entité créée dans la session d'origine
+    tm.newBoxWithTopo(Mgx3D.Point(4, 0, 0), Mgx3D.Point(5, 1, 1), 2, 2, 2)
+    next_volumes = [v for v in gm.getVolumes() if v not in volumes]
+
+    ctx.clearSession()
+    ctx.restoreCheckpoint(file_name)
+
+    assert gm.getVolumes() == volumes
+    assert_same(snapshot(ctx, ["BOX", "BOX2"], ["BOX"]), saved)
+    assert mm.getNbNodes() == nb_nodes
+    assert mm.getNbFaces() == nb_mesh_faces
+    assert mm.getNbRegions() == nb_regions
+
+    # la suite du script crée des entités de mêmes noms
+    tm.newBoxWithTopo(Mgx3D.Point(4, 0, 0), Mgx3D.Point(5, 1, 1), 2, 2, 2)
+    assert [v for v in gm.getVolumes() if v not in volumes] == next_volumes
+
+    # la reprise ne peut se faire que dans une session vide
+    with pytest.raises(Exception):
+        ctx.restoreCheckpoint(file_name)
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+# fichier tronque ou dont une taille est corrompue : exception, sans
+# allocation demesuree
+def test_checkpoint_corrupted(tmp_path):
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 2, 2, 2)
+    file_name = tmp_path / "session.mgxckp"
+    ctx.saveCheckpoint(str(file_name))
+    ctx.clearSession()
+    data = file_name.read_bytes()
+
+    truncated = tmp_path / "truncated.mgxckp"
+    truncated.write_bytes(data[:len(data) // 2])
+    with pytest.raises(Exception, match="tronqué"):
+        ctx.restoreCheckpoint(str(truncated))
+    ctx.clearSession()
+
+    # taille de la premiere chaine (les formes geometriques) apres la marque
+    # (8 octets), la version (8), les options et les 3 parametres (4 x 4) et
+    # les statistiques de noms
+    nb_stats = int.from_bytes(data[32:40], "little")
+    offset = 40 + 8 * nb_stats
+    corrupted = tmp_path / "corrupted.mgxckp"
+    corrupted.write_bytes(data[:offset] + (1 << 62).to_bytes(8, "little") + data[offset + 8:])
+    with pytest.raises(Exception, match="tronqué"):
+        ctx.restoreCheckpoint(str(corrupted))
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
@@ -0,0 +1,68 @@
+import time
+import pytest
+import pyMagix3D as Mgx3D
+
+# collage d'un assemblage de NX x NY x NZ boites jointives : chaque entité
+# commune à deux boites doit être remplacée par une seule entité
+NX, NY, NZ = 8, 8, 5
+
+def test_geom_glue_assembly():
+    ctx = Mgx3D.getStdContext()
+    gm = ctx.getGeomManager()
+    for i in range(NX):
+        for j in range(NY):
+            for k in range(NZ):
+                gm.newBox(Mgx3D.Point(i, j, k), Mgx3D.Point(i+1, j+1, k+1))
+    assert gm.getNbVolumes() == NX * NY * NZ
+
+    start = time.time()
+    gm.glue(gm.getVolumes())
+    print("collage de {0} volumes : {1:.3f}s".format(NX * NY * NZ, time.time() - start))
+
+    assert gm.getNbVolumes() == NX * NY * NZ
+    assert gm.getNbSurfaces() == (NX+1)*NY*NZ + NX*(NY+1)*NZ + NX*NY*(NZ+1)
+    assert gm.getNbCurves() == NX*(NY+1)*(NZ+1) + (NX+1)*NY*(NZ+1) + (NX+1)*(NY+1)*NZ
+    assert gm.getNbVertices() == (NX+1)*(NY+1)*(NZ+1)
+
+    # l'annulation restaure les boites disjointes
+    ctx.undo()
+    assert gm.getNbVolumes() == NX * NY * NZ
+    assert gm.getNbSurfaces() == 6 * NX * NY * NZ
+    assert gm.getNbVertices() == 8 * NX * NY * NZ
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+@pytest.fixture
+def ctx():
+    ctx = Mgx3D.getStdContext()
+    yield ctx
+    # parametre par defaut pour les tests suivants
+    ctx.setGeomPairwiseSearch(False)
+
+def glued_assembly(ctx, pairwise, nx, ny, nz):
+    ctx.setGeomPairwiseSearch(pairwise)
+    gm = ctx.getGeomManager()
+    for i in range(nx):
+        for j in range(ny):
+            for k in range(nz):
+                gm.newBox(Mgx3D.Point(i, j, k), Mgx3D.Point(i+1, j+1, k+1))
+    gm.glue(gm.getVolumes())
+
+    # appariement des entites : chaque entite avec ses entites incidentes
+    pairing = {}
+    for dim, names in enumerate([gm.getVertices(), gm.getCurves(), gm.getSurfaces(), gm.getVolumes()]):
+        for name in names:
+            infos = gm.getInfos(name, dim)
+            pairing[name] = (sorted(infos.vertices()), sorted(infos.curves()),
+                             sorted(infos.surfaces()), sorted(infos.volumes()))
+    ctx.clearSession()
+    return pairing
+
+def test_geom_glue_index_vs_pairwise(ctx):
+    # memes entites remplacees ou conservees, avec les memes noms et les
+    # memes relations, qu'avec la recherche deux a deux sans index
+    indexed = glued_assembly(ctx, False, 4, 3, 2)
+    pairwise = glued_assembly(ctx, True, 4, 3, 2)
+    assert len(indexed) == 5*4*3 + (4*4*3 + 5*3*3 + 5*4*2) + (5*3*2 + 4*4*2 + 4*3*3) + 4*3*2
+    assert indexed == pairwise
@@ -0,0 +1,81 @@
+import stat
+import pytest
+import pyMagix3D as Mgx3D
+
+# triangulation des faces delaunayGMSH dans des processus mgx3dGmshWorker,
+# comparee a la triangulation faite dans le processus courant
+
+def box(tm):
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+
+def cylinder(tm):
+    tm.newCylinderWithTopo(Mgx3D.Point(0, 0, 0), 1, Mgx3D.Vector(2, 0, 0), 360, True, 0.5, 10, 10, 5)
+
+@pytest.fixture
+def ctx():
+    ctx = Mgx3D.getStdContext()
+    yield ctx
+    # parametres par defaut pour les tests suivants
+    ctx.setGmshWorkersNum(-1)
+    ctx.setGmshWorkerPath("")
+
+def logging_worker(ctx, tmp_path):
+    # executable qui trace chaque lancement puis execute le vrai mgx3dGmshWorker
+    worker = ctx.getGmshWorkerPath()
+    assert worker != ""
+    log = tmp_path / "workers.log"
+    script = tmp_path / "worker.sh"
+    script.write_text('#!/bin/sh\necho "$1" >> "%s"\nexec "%s" "$@"\n' % (log, worker))
+    script.chmod(script.stat().st_mode | stat.S_IXUSR)
+    return str(script), log
+
+def mesh_faces(ctx, build, workers):
+    ctx.setGmshWorkersNum(workers)
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    build(tm)
+    faces = tm.getBorderFaces()
+    assert len(faces) > 2
+    tm.setMeshingProperty(Mgx3D.FaceMeshingPropertyDelaunayGMSH(0.05, 0.1), faces)
+    mm.newFacesMesh(faces)
+    return mm
+
+def serial_mesh(ctx, tmp_path, build):
+    file_name = str(tmp_path / "serial.mli")
+    mm = mesh_faces(ctx, build, 0)
+    nb_nodes = mm.getNbNodes()
+    nb_faces = mm.getNbFaces()
+    assert nb_faces > 0
+    mm.writeMli(file_name)
+    ctx.clearSession()
+    return file_name, nb_nodes, nb_faces
+
+@pytest.mark.parametrize("build", [box, cylinder])
+def test_gmsh_workers_vs_serial(ctx, tmp_path, build):
+    worker, log = logging_worker(ctx, tmp_path)
+    ctx.setGmshWorkerPath(worker)
+    file_name, nb_nodes, nb_faces = serial_mesh(ctx, tmp_path, build)
+    # aucun processus pour le maillage dans le processus courant
+    assert not log.exists()
+
+    # memes noeuds (coordonnees, ordre de creation) et memes triangles
+    mm = mesh_faces(ctx, build, 3)
+    assert len(log.read_text().split()) == 3
+    assert mm.getNbNodes() == nb_nodes
+    assert mm.getNbFaces() == nb_faces
+    assert mm.compareWithMesh(file_name)
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_gmsh_workers_failure(ctx, tmp_path):
+    file_name, nb_nodes, nb_faces = serial_mesh(ctx, tmp_path, box)
+
+    # processus en echec sans resultat : les faces sont triangulees dans le
+    # processus courant
+    ctx.setGmshWorkerPath("/bin/false")
+    assert ctx.getGmshWorkerPath() == "/bin/false"
+    mm = mesh_faces(ctx, box, 3)
+    assert mm.getNbNodes() == nb_nodes
+    assert mm.compareWithMesh(file_name)
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
@@ -0,0 +1,109 @@
+import time
+import pytest
+import pyMagix3D as Mgx3D
+
+# qualité des mailles évaluée par lots (MeshQualityKernel), comparée aux
+# valeurs de référence pour des mailles cubiques et des mailles étirées, et
+# à l'évaluation maille par maille par Qualif (setMeshQualityPerCell)
+# sur un maillage quelconque
+NB_BRAS = 40
+CRITERES = ["ScaledJacobian", "Skew", "AspectRatio", "Volume"]
+
+def test_quality_cubes():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    # mailles cubiques de côté 1/NB_BRAS, plus de mailles que par tâche
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), NB_BRAS, NB_BRAS, NB_BRAS)
+    mm.newAllBlocksMesh()
+    nb = NB_BRAS ** 3
+
+    start = time.time()
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "ScaledJacobian")
+    print("{0} hexaèdres : {1:.3f}s".format(nb, time.time() - start))
+    assert nb_mailles == nb
+    assert abs(mini - 1) < 1e-9 and abs(maxi - 1) < 1e-9
+    assert invalides == 0
+
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "Skew")
+    assert maxi < 1e-9
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "AspectRatio")
+    assert abs(mini - 1) < 1e-9 and abs(maxi - 1) < 1e-9
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "Volume")
+    assert abs(moyenne * nb - 1) < 1e-9
+
+    histogramme = mm.getQualityHistogram("Hors_Groupe_3D", 3, "ScaledJacobian", 10)
+    assert len(histogramme) == 10
+    assert histogramme[-1] == nb
+    assert sum(histogramme) == nb
+
+    # les quadrangles du bord
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_2D", 2, "Volume")
+    assert nb_mailles == 6 * NB_BRAS ** 2
+    assert abs(moyenne * nb_mailles - 6) < 1e-9
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_quality_stretched():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    # mailles 0.1 x 0.1 x 0.2
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 5)
+    mm.newAllBlocksMesh()
+
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "AspectRatio")
+    assert nb_mailles == 500
+    assert abs(mini - 2) < 1e-9 and abs(maxi - 2) < 1e-9
+    # classes de largeur 1.5 sur [1, 10]
+    histogramme = mm.getQualityHistogram("Hors_Groupe_3D", 3, "AspectRatio", 6)
+    assert histogramme[0] == 500
+
+    nb_mailles, mini, maxi, moyenne, invalides = mm.getQualityStatistics("Hors_Groupe_3D", 3, "ScaledJacobian")
+    assert abs(mini - 1) < 1e-9
+    histogramme = mm.getQualityHistogram("Hors_Groupe_3D", 3, "Volume", 4)
+    assert sum(histogramme) == 500
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+@pytest.fixture
+def ctx():
+    ctx = Mgx3D.getStdContext()
+    yield ctx
+    # parametre par defaut pour les tests suivants
+    ctx.setMeshQualityPerCell(False)
+
+def quality(ctx, mm, per_cell, name, dim, critere):
+    ctx.setMeshQualityPerCell(per_cell)
+    return (mm.getQualityStatistics(name, dim, critere),
+            mm.getQualityHistogram(name, dim, critere, 10))
+
+@pytest.mark.parametrize("critere", CRITERES)
+def test_quality_batched_vs_per_cell(ctx, critere):
+    ctx.setAllowThreadedCommandTasks(True)
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    # o-grid : mailles déformées de qualités variées, plus de mailles que
+    # par tâche pour l'évaluation par lots
+    tm.newCylinderWithTopo(Mgx3D.Point(0, 0, 0), 1, Mgx3D.Vector(4, 0, 0), 360, True, 0.5, 20, 20, 40)
+    mm.newAllBlocksMesh()
+
+    for name, dim in (("Hors_Groupe_3D", 3), ("Hors_Groupe_2D", 2)):
+        (stats, histogramme) = quality(ctx, mm, False, name, dim, critere)
+        (ref_stats, ref_histogramme) = quality(ctx, mm, True, name, dim, critere)
+        # nombre de mailles et de mailles invalides
+        assert stats[0] == ref_stats[0] and stats[0] > 0
+        assert stats[4] == ref_stats[4]
+        # min, max et moyenne
+        for valeur, reference in zip(stats[1:4], ref_stats[1:4]):
+            assert abs(valeur - reference) <= 1e-9 * max(1., abs(reference))
+        assert sum(histogramme) == sum(ref_histogramme)
+        if critere != "Volume":
+            assert histogramme == ref_histogramme
+        # les mailles ne sont pas toutes identiques
+        assert stats[1] < stats[2]
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
@@ -0,0 +1,160 @@
+import array
+import math
+import time
+import pytest
+import pyMagix3D as Mgx3D
+
+# comparaison des perturbations par noeud et par lot sur un bloc maille
+NB_BRAS = 10
+calls = {"node": 0, "batch": 0, "batch_nodes": 0}
+
+def node_perturbation(x, y, z):
+    calls["node"] += 1
+    return [x + 0.01 * math.sin(10 * y), y, z]
+
+def batch_perturbation(coords):
+    calls["batch"] += 1
+    calls["batch_nodes"] += coords.shape[0]
+    flat = coords.cast('B').cast('d')
+    for i in range(0, len(flat), 3):
+        flat[i] = flat[i] + 0.01 * math.sin(10 * flat[i + 1])
+    return None
+
+def polar_node_perturbation(rho, theta, phi):
+    return [rho * (1 + 0.05 * math.cos(4 * phi)), theta, phi]
+
+def polar_batch_perturbation(coords):
+    flat = coords.cast('B').cast('d')
+    for i in range(0, len(flat), 3):
+        flat[i] = flat[i] * (1 + 0.05 * math.cos(4 * flat[i + 2]))
+    return None
+
+def bad_shape_perturbation(coords):
+    # N x 3 doubles, mais sous forme 3 x N
+    flat = coords.cast('B').cast('d')
+    return memoryview(bytearray(flat.tobytes())).cast('d', [3, coords.shape[0]])
+
+def float_batch_perturbation(coords):
+    # retour en simple precision : converti nombre par nombre
+    flat = coords.cast('B').cast('d')
+    values = array.array('f', [flat[i] + (0.25 if i % 3 == 2 else 0) for i in range(len(flat))])
+    return memoryview(values).cast('B').cast('f', [coords.shape[0], 3])
+
+def list_batch_perturbation(coords):
+    flat = coords.cast('B').cast('d')
+    return [[flat[i], flat[i + 1], flat[i + 2] + 0.25] for i in range(0, len(flat), 3)]
+
+def translation_perturbation(x, y, z):
+    return [x, y, z + 0.25]
+
+kept_views = []
+def keep_view_perturbation(coords):
+    kept_views.append(coords)
+    kept_views.append(coords.cast('B'))
+    return None
+
+def keep_array_perturbation(coords):
+    import numpy
+    kept_views.append(numpy.asarray(coords))
+    return None
+
+def raising_perturbation(coords):
+    raise ValueError("perturbation invalide")
+
+def mesh_box(add_perturbation = None, perturbation = None, nb_bras = NB_BRAS):
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    gr = ctx.getGroupManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0.5, 0.5, 0.5), Mgx3D.Point(1.5, 1.5, 1.5), nb_bras, nb_bras, nb_bras)
+    if add_perturbation:
+        getattr(gr, add_perturbation)("Hors_Groupe_3D", perturbation)
+    mm.newAllBlocksMesh()
+    return ctx, mm
+
+def compare_node_vs_batch(tmp_path, add_node, node, add_batch, batch):
+    file_name = str(tmp_path / "perturbation.mli")
+    ctx, mm = mesh_box(add_node, node)
+    mm.writeMli(file_name)
+    ctx.clearSession()
+
+    ctx, mm = mesh_box(add_batch, batch)
+    assert mm.getNbNodes() == (NB_BRAS + 1) ** 3
+    # mêmes coordonnées pour tous les noeuds
+    assert mm.compareWithMesh(file_name)
+    ctx.clearSession()
+
+    # la comparaison détecte bien la perturbation
+    ctx, mm = mesh_box()
+    assert not mm.compareWithMesh(file_name)
+    ctx.clearSession()
+
+def test_cartesian_perturbation_node_vs_batch(tmp_path):
+    calls.update(node = 0, batch = 0, batch_nodes = 0)
+    compare_node_vs_batch(tmp_path, "addCartesianPerturbation", node_perturbation,
+                          "addCartesianBatchPerturbation", batch_perturbation)
+    assert calls["batch"] == 1
+    assert calls["batch_nodes"] == calls["node"]
+
+def test_polar_perturbation_node_vs_batch(tmp_path):
+    compare_node_vs_batch(tmp_path, "addPolarPerturbation", polar_node_perturbation,
+                          "addPolarBatchPerturbation", polar_batch_perturbation)
+
+def test_batch_perturbation_bad_shape():
+    with pytest.raises(Exception):
+        mesh_box("addCartesianBatchPerturbation", bad_shape_perturbation)
+    Mgx3D.getStdContext().clearSession()
+
+@pytest.mark.parametrize("perturbation", [float_batch_perturbation, list_batch_perturbation])
+def test_batch_perturbation_converted_result(tmp_path, perturbation):
+    # coordonnees multiples de 1/8 : exactes en simple precision
+    file_name = str(tmp_path / "translation.mli")
+    ctx, mm = mesh_box("addCartesianPerturbation", translation_perturbation, 8)
+    mm.writeMli(file_name)
+    ctx.clearSession()
+
+    ctx, mm = mesh_box("addCartesianBatchPerturbation", perturbation, 8)
+    assert mm.compareWithMesh(file_name)
+    ctx.clearSession()
+
+def test_batch_perturbation_errors():
+    # l'erreur Python est remontee avec son message
+    with pytest.raises(Exception, match = "perturbation invalide"):
+        mesh_box("addCartesianBatchPerturbation", raising_perturbation)
+    Mgx3D.getStdContext().clearSession()
+
+    # les vues conservees apres l'appel restent sans danger : le memoryview
+    # transmis est libere, une vue derivee garde le tableau en vie
+    del kept_views[:]
+    ctx, mm = mesh_box("addCartesianBatchPerturbation", keep_view_perturbation)
+    with pytest.raises(ValueError):
+        kept_views[0].tolist()
+    assert len(kept_views[1]) == 3 * 8 * mm.getNbNodes()
+    del kept_views[:]
+    ctx.clearSession()
+
+def test_batch_perturbation_exported_view():
+    # un tableau qui exporte encore le memoryview empeche sa liberation
+    pytest.importorskip("numpy")
+    del kept_views[:]
+    with pytest.raises(Exception, match = "conserve une"):
+        mesh_box("addCartesianBatchPerturbation", keep_array_perturbation)
+    del kept_views[:]
+    Mgx3D.getStdContext().clearSession()
+
+def test_batch_perturbation_benchmark():
+    # bloc de 41^3 noeuds : un appel Python par noeud contre un seul appel
+    nb_bras = 40
+    start = time.perf_counter()
+    ctx, mm = mesh_box("addCartesianPerturbation", node_perturbation, nb_bras)
+    node_time = time.perf_counter() - start
+    ctx.clearSession()
+
+    start = time.perf_counter()
+    ctx, mm = mesh_box("addCartesianBatchPerturbation", batch_perturbation, nb_bras)
+    batch_time = time.perf_counter() - start
+    assert mm.getNbNodes() == (nb_bras + 1) ** 3
+    ctx.clearSession()
+
+    # temps de maillage compris, le mode par lot est plus rapide
+    assert batch_time < node_time, "par lot : %.2fs, par noeud : %.2fs" % (batch_time, node_time)
@@ -0,0 +1,78 @@
+import getpass
+import glob
+import os
+import re
+import subprocess
+
+# journal Python de Magix3D (plateforme Qt hors ecran) : 50000 commandes sont
+# journalisees par le thread d'ecriture (PythonJournal) puis, pour comparer,
+# directement par le thread des commandes (argument -pythonJournalSync). Le
+# script s'arrete brutalement (SIGTERM) : toutes les commandes doivent figurer
+# dans le script journal.
+# L'executable est donne par la fixture mgx3d_exe (conftest.py).
+
+NB_COMMANDS = 50000
+
+SCRIPT = """
+import os
+import signal
+import time
+import pyMagix3D as Mgx3D
+ctx = Mgx3D.getStdContext()
+gm = ctx.getGeomManager()
+start = time.perf_counter()
+for i in range({count}):
+    gm.newVertex(Mgx3D.Point(i, 0, 0))
+with open({result!r}, "w") as f:
+    f.write("%f" % (time.perf_counter() - start))
+os.kill(os.getpid(), signal.SIGTERM)
+"""
+
+def journals():
+    pattern = os.path.join("/tmp", getpass.getuser(), "mgx_*.py")
+    return set(f for f in glob.glob(pattern) if not f.endswith("_user.py"))
+
+def run(exe, tmp_path, name, synchronous):
+    result = tmp_path / (name + ".txt")
+    script = tmp_path / (name + ".py")
+    script.write_text(SCRIPT.format(count=NB_COMMANDS, result=str(result)))
+
+    env = dict(os.environ)
+    env["QT_QPA_PLATFORM"] = "offscreen"
+    args = [exe, "-script", str(script)]
+    if synchronous:
+        args.append("-pythonJournalSync")
+    before = journals()
+    process = subprocess.run(args, env=env,
+                             stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                             timeout=1800)
+    # arret brutal, le script n'est pas termine normalement
+    assert process.returncode != 0
+    created = journals() - before
+    assert len(created) == 1
+
+    with open(created.pop(), encoding="utf-8") as f:
+        xs = [float(m.group(1)) for m in
+              re.finditer(r"newVertex\(\w+\.Point\(([^,]+),", f.read())]
+    return float(result.read_text()), xs
+
+def test_python_journal(mgx3d_exe, tmp_path, record_property):
+    journal_time, journal_xs = run(mgx3d_exe, tmp_path, "journal", False)
+    sync_time, sync_xs = run(mgx3d_exe, tmp_path, "sync", True)
+    # mesure reprise dans le rapport junit (--junitxml)
+    record_property("journal_time", journal_time)
+    record_property("sync_time", sync_time)
+    print("%d commandes : %.2fs avec le journal, %.2fs en ecriture directe"
+          % (NB_COMMANDS, journal_time, sync_time))
+
+    # aucune commande perdue lors de l'arret brutal. Avec le journal, les
+    # lignes en cours d'ecriture par le thread dedie au moment du signal
+    # peuvent etre ecrites une seconde fois.
+    expected = [float(i) for i in range(NB_COMMANDS)]
+    assert sync_xs == expected
+    assert sorted(set(journal_xs)) == expected
+    assert journal_xs[-1] == expected[-1]
+
+    # les ecritures du script ne sont plus faites par le thread des
+    # commandes : le journal ne doit pas ralentir les commandes
+    assert journal_time < 1.2 * sync_time + 0.5
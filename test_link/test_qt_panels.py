@@ -0,0 +1,71 @@
+import os
+import subprocess
+
+# arborescences des panneaux "Entites" et "Groupes" de Magix3D (plateforme Qt
+# hors ecran) lors de la creation et de la destruction de nombreuses entites.
+# Avec l'argument -checkPanelsItems, Magix3D verifie apres chaque commande que
+# l'index des items par entite correspond a l'arborescence et s'arrete
+# (abort) en cas d'incoherence.
+# L'executable est donne par la fixture mgx3d_exe (conftest.py).
+
+SCRIPT = """
+import os
+import time
+import pyMagix3D as Mgx3D
+ctx = Mgx3D.getStdContext()
+gm = ctx.getGeomManager()
+tm = ctx.getTopoManager()
+start = time.perf_counter()
+for i in range({count}):
+    tm.newBoxWithTopo(Mgx3D.Point(2*i, 0, 0), Mgx3D.Point(2*i+1, 1, 1), 2, 2, 2, "G%d" % (i % 6))
+for i in range({count} // 3):
+    ctx.undo()
+for i in range({count} // 6):
+    ctx.redo()
+volumes = gm.getVolumes()
+gm.destroyWithTopo(volumes[::2], True)
+ctx.undo()
+ctx.redo()
+duree = time.perf_counter() - start
+with open({result!r}, "w") as f:
+    f.write("%d %d %f" % (gm.getNbVolumes(), tm.getNbBlocks(), duree))
+os._exit(0)
+"""
+
+def run(exe, tmp_path, count, check):
+    result = tmp_path / ("result_%d.txt" % count)
+    script = tmp_path / ("panels_%d.py" % count)
+    script.write_text(SCRIPT.format(count=count, result=str(result)))
+
+    env = dict(os.environ)
+    env["QT_QPA_PLATFORM"] = "offscreen"
+    args = [exe, "-script", str(script)]
+    if check:
+        args.append("-checkPanelsItems")
+    process = subprocess.run(args, env=env,
+                             stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                             timeout=1800)
+    assert process.returncode == 0, process.stderr.decode(errors="replace")
+    nb_volumes, nb_blocks, duree = result.read_text().split()
+    return int(nb_volumes), int(nb_blocks), float(duree)
+
+def remaining(count):
+    # count boites, count/3 annulees, count/6 rejouees, puis une sur deux
+    # detruite
+    created = count - count // 3 + count // 6
+    return created // 2, created // 2
+
+def test_qt_panels_items(mgx3d_exe, tmp_path):
+    nb_volumes, nb_blocks, duree = run(mgx3d_exe, tmp_path, 60, True)
+    assert (nb_volumes, nb_blocks) == remaining(60)
+
+def test_qt_panels_scaling(mgx3d_exe, tmp_path):
+    # sans verification (elle parcourt les arborescences apres chaque
+    # commande) : mises a jour des panneaux lineaires en le nombre
+    # d'entites, une recherche lineaire des items donnerait un rapport de
+    # l'ordre de 8 ** 2 = 64
+    petit = run(mgx3d_exe, tmp_path, 60, False)
+    grand = run(mgx3d_exe, tmp_path, 480, False)
+    assert petit[:2] == remaining(60)
+    assert grand[:2] == remaining(480)
+    assert grand[2] < 3 * 8 * petit[2] + 1.0
@@ -0,0 +1,76 @@
+import os
+import pyMagix3D as Mgx3D
+
+# maillage structure d'un bloc conserve sous forme IJK : les noeuds interieurs
+# et les hexaedres ne sont crees dans gmds qu'a la demande
+
+N = 30
+
+def corners(x0, x1):
+    return [Mgx3D.Point(x, y, z) for x in (x0, x1) for y in (0, 1) for z in (0, 1)]
+
+def test_structured_mesh_counts_and_export(tmp_path):
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), N, N, N)
+    mm.newAllBlocksMesh()
+    assert mm.getNbNodes() == (N+1)**3
+    assert mm.getNbFaces() == 6*N*N
+    assert mm.getNbRegions() == N**3
+
+    # export CGNS depuis la forme IJK
+    cgns = str(tmp_path / "bloc.cgns")
+    mm.writeCGNS(cgns)
+    assert os.path.getsize(cgns) >= 3*8*(N+1)**3
+    assert mm.getNbNodes() == (N+1)**3
+    assert mm.getNbRegions() == N**3
+
+    # les noeuds du bloc sont alors crees, sur la grille reguliere
+    v = mm.getTopoNodes(tm.getBlockAt(corners(0, 1)), 3)
+    assert len(v) == 4*(N+1)**3
+    ids = set(int(v[i]) for i in range(0, len(v), 4))
+    assert len(ids) == (N+1)**3
+    for i in range(0, len(v), 4):
+        for c in v[i+1:i+4]:
+            assert abs(c*N - round(c*N)) < 1e-9
+    assert mm.getNbNodes() == (N+1)**3
+    assert mm.getNbRegions() == N**3
+
+    vtk = str(tmp_path / "bloc.vtk")
+    mm.writeVTK(vtk)
+    assert os.path.getsize(vtk) > 0
+    assert mm.getNbRegions() == N**3
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_structured_mesh_undo():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), N, N, N)
+    tm.newBoxWithTopo(Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), N, N, N)
+    mm.newAllBlocksMesh()
+    assert mm.getNbNodes() == 2*(N+1)**3
+    assert mm.getNbRegions() == 2*N**3
+
+    # annulation sans que les noeuds interieurs n'aient ete crees
+    ctx.undo()
+    assert mm.getNbNodes() == 0
+    assert mm.getNbRegions() == 0
+    ctx.redo()
+    assert mm.getNbNodes() == 2*(N+1)**3
+    assert mm.getNbRegions() == 2*N**3
+
+    # annulation apres creation des noeuds interieurs d'un seul bloc
+    assert len(mm.getTopoNodes(tm.getBlockAt(corners(0, 1)), 3)) == 4*(N+1)**3
+    ctx.undo()
+    assert mm.getNbNodes() == 0
+    assert mm.getNbRegions() == 0
+    ctx.redo()
+    assert mm.getNbNodes() == 2*(N+1)**3
+    assert mm.getNbRegions() == 2*N**3
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
@@ -0,0 +1,50 @@
+import pytest
+import pyMagix3D as Mgx3D
+
+# lissage surfacique par morceaux : le decoupage ne depend que du maillage et
+# du nombre de morceaux demande, pas des threads, et la qualite obtenue est
+# proche de celle du lissage global
+
+def mesh_cylinder(nb_patches, threaded):
+    ctx = Mgx3D.getStdContext()
+    ctx.setAllowThreadedCommandTasks(threaded)
+    tm = ctx.getTopoManager()
+    gr = ctx.getGroupManager()
+    mm = ctx.getMeshManager()
+    # surface laterale de plus de 4 x 2000 polygones
+    tm.newCylinderWithTopo(Mgx3D.Point(0, 0, 0), 1, Mgx3D.Vector(4, 0, 0), 360, True, 0.5, 20, 20, 80)
+    gr.addSmoothing("Hors_Groupe_2D", Mgx3D.SurfacicSmoothing(5,
+        Mgx3D.SurfacicSmoothing.surfacicOrthogonalSmoothing,
+        Mgx3D.SurfacicSmoothing.gradientConjugue, nb_patches))
+    mm.newAllFacesMesh()
+    return ctx, mm
+
+def quality(mm):
+    return mm.getQualityStatistics("Hors_Groupe_2D", 2, "ScaledJacobian")
+
+def test_patches_threaded_vs_serial(tmp_path):
+    file_name = str(tmp_path / "serial.mli")
+    ctx, mm = mesh_cylinder(4, False)
+    serial_quality = quality(mm)
+    mm.writeMli(file_name)
+    ctx.clearSession()
+
+    ctx, mm = mesh_cylinder(4, True)
+    assert mm.compareWithMesh(file_name)
+    assert quality(mm) == serial_quality
+    ctx.setAllowThreadedCommandTasks(True)
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_patches_vs_global():
+    ctx, mm = mesh_cylinder(1, True)
+    nb_global, min_global, max_global, mean_global, invalid_global = quality(mm)
+    ctx.clearSession()
+
+    ctx, mm = mesh_cylinder(4, True)
+    nb_patches, min_patches, max_patches, mean_patches, invalid_patches = quality(mm)
+    assert nb_patches == nb_global
+    assert invalid_patches == invalid_global
+    assert mean_patches == pytest.approx(mean_global, rel=1e-2)
+    assert min_patches >= min_global - 0.05
+    ctx.clearSession()
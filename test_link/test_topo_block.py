@@ -12,3 +12,28 @@ def test_topo_box():
 
     #This last command is mandatory to clean the session for the next test
     ctx.clearSession()
+
+def test_topo_counts_undo():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager ()
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo (Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 10, 10, 10)
+    assert tm.getNbBlocks()==2
+    # découpage du premier bloc : les entités détruites ne sont plus comptées
+    tm.splitBlock ("B0000", tm.getEdgeAt(Mgx3D.Point(0, 0, 0), Mgx3D.Point(0, 0, 1)), 0.5)
+    assert tm.getNbBlocks()==3
+    assert tm.getNbFaces()==6+11
+    # les entités détruites le sont à nouveau après l'annulation
+    ctx.undo()
+    assert tm.getNbBlocks()==2
+    assert tm.getNbFaces()==12
+    ctx.redo()
+    assert tm.getNbBlocks()==3
+    ctx.undo()
+    # une nouvelle commande supprime les entités de la commande annulée
+    tm.newBoxWithTopo (Mgx3D.Point(4, 0, 0), Mgx3D.Point(5, 1, 1), 10, 10, 10)
+    assert tm.getNbBlocks()==3
+    assert tm.getNbFaces()==18
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
@@ -0,0 +1,139 @@
+import time
+import pytest
+import pyMagix3D as Mgx3D
+
+# micro-benchmark des parcours topologiques (TopoHelper) sur un réseau de blocs
+# obtenu en coupant NB_COUPES fois une boite dans chaque direction
+NB_COUPES = 7
+NB_BRAS = 2 ** NB_COUPES
+NB_REPETITIONS = 5
+
+def build_lattice(tm, nb_coupes=NB_COUPES):
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), NB_BRAS, NB_BRAS, NB_BRAS)
+    for direction in range(3):
+        longueur = 1.0
+        for i in range(nb_coupes):
+            extremite = [0.0, 0.0, 0.0]
+            extremite[direction] = longueur
+            # on coupe en deux la première tranche de blocs
+            arete = tm.getEdgeAt(Mgx3D.Point(0, 0, 0), Mgx3D.Point(extremite[0], extremite[1], extremite[2]))
+            tm.splitAllBlocks(arete, 0.5)
+            longueur /= 2.0
+
+def timed(fct, *args):
+    # meilleur temps sur plusieurs appels, moins sensible à la charge de la machine
+    best = None
+    for i in range(NB_REPETITIONS):
+        start = time.perf_counter()
+        result = fct(*args)
+        duree = time.perf_counter() - start
+        best = duree if best is None else min(best, duree)
+    return result, best
+
+def traversals(ctx, nb_coupes):
+    tm = ctx.getTopoManager()
+    gr = ctx.getGroupManager()
+    build_lattice(tm, nb_coupes)
+    n = nb_coupes + 1
+    assert tm.getNbBlocks() == n ** 3
+
+    groupes = ["Hors_Groupe_3D"]
+    blocs, t_blocs = timed(gr.getTopoBlocks, groupes)
+    faces, t_faces = timed(gr.getTopoFaces, groupes)
+    aretes, t_aretes = timed(gr.getTopoEdges, groupes)
+    sommets, t_sommets = timed(gr.getTopoVertices, groupes)
+
+    assert len(blocs) == n ** 3
+    assert len(faces) == 3 * n * n * (n + 1)
+    assert len(aretes) == 3 * n * (n + 1) ** 2
+    assert len(sommets) == (n + 1) ** 3
+    # pas de doublon
+    assert len(set(faces)) == len(faces)
+    assert len(set(aretes)) == len(aretes)
+    assert len(tm.getBorderFaces()) == 6 * n * n
+
+    ctx.clearSession()
+    return t_faces + t_aretes + t_sommets
+
+def test_topo_lattice():
+    ctx = Mgx3D.getStdContext()
+    # réseau de référence 8 fois plus petit (n / 2 blocs par direction)
+    t_petit = traversals(ctx, NB_COUPES // 2)
+    t_grand = traversals(ctx, NB_COUPES)
+    ratio = ((NB_COUPES + 1) / (NB_COUPES // 2 + 1)) ** 3
+
+    # parcours linéaires en le nombre d'entités : un filtrage quadratique
+    # donnerait un rapport de l'ordre de ratio ** 2 = 64
+    assert t_grand < 3 * ratio * t_petit + 0.05
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def split_time(ctx, nb_coupes):
+    tm = ctx.getTopoManager()
+    build_lattice(tm, nb_coupes)
+
+    n = nb_coupes + 1
+    # nouvelle coupe au milieu de la première tranche suivant z, elle se
+    # propage à travers les n x n blocs de la tranche
+    longueur = 1.0 / 2 ** nb_coupes
+    arete = tm.getEdgeAt(Mgx3D.Point(0, 0, 0), Mgx3D.Point(0, 0, longueur))
+    start = time.perf_counter()
+    tm.splitAllBlocks(arete, 0.5)
+    duree = time.perf_counter() - start
+
+    assert tm.getNbBlocks() == n ** 3 + n * n
+
+    # le rejeu donne le même découpage
+    ctx.undo()
+    assert tm.getNbBlocks() == n ** 3
+    ctx.redo()
+    assert tm.getNbBlocks() == n ** 3 + n * n
+
+    ctx.clearSession()
+    return duree
+
+@pytest.fixture
+def ctx():
+    ctx = Mgx3D.getStdContext()
+    yield ctx
+    # parametre par defaut pour les tests suivants
+    ctx.setSplitBlocksFullScan(False)
+
+def test_split_lattice(ctx):
+    # tranche de 16 blocs puis de 64 blocs : avec le front de propagation,
+    # la découpe est linéaire en le nombre de blocs découpés (un parcours
+    # complet à chaque étape donnerait un rapport de l'ordre de 16)
+    t_petit = split_time(ctx, NB_COUPES // 2)
+    t_grand = split_time(ctx, NB_COUPES)
+    ratio = ((NB_COUPES + 1) / (NB_COUPES // 2 + 1)) ** 2
+    assert t_grand < 3 * ratio * t_petit + 0.05
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def split_names(ctx, full_scan):
+    ctx.setSplitBlocksFullScan(full_scan)
+    tm = ctx.getTopoManager()
+    gr = ctx.getGroupManager()
+    # réseau de 4 x 4 x 4 blocs, coupé suivant chaque direction
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 8, 8, 8)
+    for direction in range(3):
+        for longueur in [1.0, 0.5]:
+            extremite = [0.0, 0.0, 0.0]
+            extremite[direction] = longueur
+            arete = tm.getEdgeAt(Mgx3D.Point(0, 0, 0), Mgx3D.Point(extremite[0], extremite[1], extremite[2]))
+            tm.splitAllBlocks(arete, 0.5)
+    groupes = ["Hors_Groupe_3D"]
+    names = (gr.getTopoBlocks(groupes), gr.getTopoFaces(groupes),
+             gr.getTopoEdges(groupes), gr.getTopoVertices(groupes))
+    ctx.clearSession()
+    return names
+
+def test_split_order(ctx):
+    # la file ordonnée découpe les blocs dans l'ordre du parcours complet :
+    # mêmes entités créées, avec les mêmes noms
+    front = split_names(ctx, False)
+    full_scan = split_names(ctx, True)
+    assert len(front[0]) == 4 ** 3
+    assert front == full_scan
@@ -0,0 +1,66 @@
+import pyMagix3D as Mgx3D
+
+# empreinte mémoire d'une grosse topologie : les entités topologiques d'un
+# même type ont toutes les mêmes attributs graphiques, qui ne sont alors
+# présents qu'une fois en mémoire, et les noms sont internés
+NB_BLOCS = 1000
+
+def test_topo_memory():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    noms = ctx.getInternedNamesCount()
+
+    for i in range(NB_BLOCS):
+        tm.newBoxWithTopo(Mgx3D.Point(2*i, 0, 0), Mgx3D.Point(2*i+1, 1, 1), 2, 2, 2)
+
+    assert tm.getNbBlocks() == NB_BLOCS
+    assert tm.getNbFaces() == 6 * NB_BLOCS
+
+    # un seul jeu d'attributs graphiques par type d'entité topologique
+    assert ctx.getDisplayAttributesSharingCount(Mgx3D.Entity.TopoBlock) >= NB_BLOCS
+    assert ctx.getDisplayAttributesSharingCount(Mgx3D.Entity.TopoCoFace) >= 6 * NB_BLOCS
+    assert ctx.getDisplayAttributesSharingCount(Mgx3D.Entity.TopoVertex) >= 8 * NB_BLOCS
+
+    # mémoire économisée : au moins un jeu d'attributs graphiques par bloc,
+    # coface et sommet (l'internement des noms, distincts et courts, n'est
+    # rentable que s'ils se répètent)
+    entites = 15 * NB_BLOCS
+    economie = ctx.getDisplayAttributesMemorySaved() + ctx.getNamesMemorySaved()
+    print("{0} entités topologiques : {1} octets économisés ({2:.0f} par entité)".format(
+        entites, economie, float(economie) / entites))
+    assert ctx.getDisplayAttributesMemorySaved() >= 15 * NB_BLOCS * 64
+    assert economie > 0
+
+    # les noms restent distincts malgré l'internement
+    faces = tm.getBorderFaces()
+    assert len(faces) == 6 * NB_BLOCS
+    assert len(set(faces)) == len(faces)
+
+    # le rejeu recrée les mêmes entités, qui partagent toujours leurs attributs
+    ctx.undo()
+    assert tm.getNbBlocks() == NB_BLOCS - 1
+    ctx.redo()
+    assert tm.getNbBlocks() == NB_BLOCS
+    assert ctx.getDisplayAttributesSharingCount(Mgx3D.Entity.TopoBlock) >= NB_BLOCS
+    assert ctx.getInternedNamesCount() > noms + 15 * NB_BLOCS
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+    # les noms des entités détruites sont libérés
+    assert ctx.getInternedNamesCount() < noms + NB_BLOCS
+
+def test_names_churn():
+    # créations et destructions répétées : le nombre de noms internés ne
+    # croît pas d'une session à l'autre
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    comptes = []
+    for session in range(4):
+        for i in range(100):
+            tm.newBoxWithTopo(Mgx3D.Point(2*i, 0, 0), Mgx3D.Point(2*i+1, 1, 1), 2, 2, 2)
+        ctx.clearSession()
+        comptes.append(ctx.getInternedNamesCount())
+    assert comptes[-1] <= comptes[0]
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
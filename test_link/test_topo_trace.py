@@ -0,0 +1,34 @@
+import pyMagix3D as Mgx3D
+
+# les traces detaillees (TRACE_3 a TRACE_5) emises pour chaque entite ou
+# commande ne sont construites que si elles sont affichees : avec le masque
+# par defaut (PRODUCTION), aucune n'est transmise au gestionnaire de flux
+
+def build(ctx):
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 2, 2, 2)
+    tm.newCylinderWithTopo(Mgx3D.Point(2, 0, 0), 1, Mgx3D.Vector(2, 0, 0), 360, True, 0.5, 4, 4, 4)
+    mm.newAllBlocksMesh()
+    ctx.undo()
+    ctx.redo()
+    assert mm.getNbRegions() > 0
+
+def test_topo_trace_masked():
+    ctx = Mgx3D.getStdContext()
+    assert not ctx.getTraceLogsEnabled()
+    count = ctx.getTraceLogsCount()
+    build(ctx)
+    assert ctx.getTraceLogsCount() == count
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_topo_trace_enabled():
+    ctx = Mgx3D.getStdContext()
+    ctx.setTraceLogsEnabled(True)
+    assert ctx.getTraceLogsEnabled()
+    count = ctx.getTraceLogsCount()
+    build(ctx)
+    assert ctx.getTraceLogsCount() > count
+    ctx.setTraceLogsEnabled(False)
+    ctx.clearSession()
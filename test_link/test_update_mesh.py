@@ -0,0 +1,103 @@
+import pytest
+import pyMagix3D as Mgx3D
+
+# mise à jour du maillage des seules entités modifiées après le maillage
+
+def nodes(mm, name, dim):
+    # (id, x, y, z) des noeuds du maillage d'une entité topologique
+    v = mm.getTopoNodes(name, dim)
+    return [(int(v[i]), v[i+1], v[i+2], v[i+3]) for i in range(0, len(v), 4)]
+
+def corners(x0, x1):
+    return [Mgx3D.Point(x, y, z) for x in (x0, x1) for y in (0, 1) for z in (0, 1)]
+
+def test_update_mesh_discretization():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo(Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 10, 10, 10)
+    mm.newAllBlocksMesh()
+    assert mm.getNbNodes() == 2*1331
+    assert mm.getNbRegions() == 2*1000
+    bloc = tm.getBlockAt(corners(0, 1))
+    avant = nodes(mm, bloc, 3)
+    assert len(avant) == 1331
+
+    # rien n'a été modifié
+    with pytest.raises(Exception):
+        mm.updateMesh()
+
+    # une direction du second bloc passe à 20 bras, le premier bloc est conservé
+    tm.setNbMeshingEdges("Ar0012", 20, [])
+    mm.updateMesh()
+    assert mm.getNbNodes() == 1331 + 21*11*11
+    assert mm.getNbFaces() == 600 + 4*20*10 + 2*10*10
+    assert mm.getNbRegions() == 1000 + 2000
+    assert nodes(mm, bloc, 3) == avant
+
+    with pytest.raises(Exception):
+        mm.updateMesh()
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_update_mesh_interface():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    # deux blocs de part et d'autre de l'interface x = 0.5
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.splitBlock("B0000", tm.getEdgeAt(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 0, 0)), 0.5)
+    mm.newAllBlocksMesh()
+    assert mm.getNbNodes() == 1331
+    assert mm.getNbRegions() == 1000
+
+    interface = tm.getFaceAt([Mgx3D.Point(0.5, y, z) for y in (0, 1) for z in (0, 1)])
+    bloc = tm.getBlockAt(corners(0, 0.5))
+    arete = tm.getEdgeAt(Mgx3D.Point(0, 1, 1), Mgx3D.Point(0.5, 1, 1))
+    avant = (nodes(mm, interface, 2), nodes(mm, bloc, 3), nodes(mm, arete, 1))
+    assert len(avant[0]) == 11*11
+
+    # le second bloc passe à 10 bras suivant x, l'interface n'est pas modifiée
+    tm.setNbMeshingEdges(tm.getEdgeAt(Mgx3D.Point(0.5, 0, 0), Mgx3D.Point(1, 0, 0)), 10, [])
+    mm.updateMesh()
+    assert mm.getNbNodes() == 6*11*11 + 11*11*11 - 11*11
+    assert mm.getNbRegions() == 500 + 1000
+
+    # mêmes noeuds (identifiants et coordonnées) pour les entités conservées
+    assert (nodes(mm, interface, 2), nodes(mm, bloc, 3), nodes(mm, arete, 1)) == avant
+    assert len(nodes(mm, tm.getBlockAt(corners(0.5, 1)), 3)) == 11*11*11
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
+
+def test_update_mesh_vertex_location():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    mm.newAllBlocksMesh()
+
+    sommet = tm.getVertexAt(Mgx3D.Point(0, 0, 0))
+    # face et arête sans ce sommet
+    face = tm.getFaceAt([Mgx3D.Point(1, y, z) for y in (0, 1) for z in (0, 1)])
+    arete = tm.getEdgeAt(Mgx3D.Point(1, 1, 0), Mgx3D.Point(1, 1, 1))
+    avant = (nodes(mm, face, 2), nodes(mm, arete, 1))
+    [(id_sommet, x, y, z)] = nodes(mm, sommet, 0)
+    assert (x, y, z) == (0, 0, 0)
+
+    # le déplacement d'un sommet rend obsolète le maillage des entités voisines
+    tm.setVertexLocation([sommet], True, -0.5, False, 0, False, 0)
+    mm.updateMesh()
+    assert mm.getNbNodes() == 1331
+    assert mm.getNbFaces() == 600
+    assert mm.getNbRegions() == 1000
+
+    # le noeud du sommet a été déplacé, les entités éloignées sont inchangées
+    [(id_sommet, x, y, z)] = nodes(mm, sommet, 0)
+    assert (x, y, z) == (-0.5, 0, 0)
+    assert (nodes(mm, face, 2), nodes(mm, arete, 1)) == avant
+
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()
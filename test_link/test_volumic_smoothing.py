@@ -0,0 +1,48 @@
+import pytest
+import pyMagix3D as Mgx3D
+
+# lissage volumique natif (ColoredVolumicSmoother) : le resultat avec les
+# taches du ThreadPool est le meme que le parcours sequentiel des couleurs
+
+COLORED_METHODS = [Mgx3D.VolumicSmoothing.coloredLaplace,
+                   Mgx3D.VolumicSmoothing.coloredConditionNumber,
+                   Mgx3D.VolumicSmoothing.coloredInverseMeanRatio]
+
+def mesh_cylinder(method, threaded):
+    ctx = Mgx3D.getStdContext()
+    ctx.setAllowThreadedCommandTasks(threaded)
+    tm = ctx.getTopoManager()
+    gr = ctx.getGroupManager()
+    mm = ctx.getMeshManager()
+    # o-grid : les noeuds proches des coins des blocs sont deplaces par le
+    # lissage, plus de noeuds par couleur que par tache
+    tm.newCylinderWithTopo(Mgx3D.Point(0, 0, 0), 1, Mgx3D.Vector(4, 0, 0), 360, True, 0.5, 20, 20, 40)
+    if method is not None:
+        gr.addSmoothing("Hors_Groupe_3D", Mgx3D.VolumicSmoothing(5, method))
+    mm.newAllBlocksMesh()
+    return ctx, mm
+
+def write_mesh(tmp_path, name, method, threaded):
+    file_name = str(tmp_path / name)
+    ctx, mm = mesh_cylinder(method, threaded)
+    stats = mm.getQualityStatistics("Hors_Groupe_3D", 3, "ScaledJacobian")
+    mm.writeMli(file_name)
+    ctx.clearSession()
+    return file_name, stats
+
+@pytest.mark.parametrize("method", COLORED_METHODS)
+def test_colored_smoothing_threaded_vs_serial(tmp_path, method):
+    raw_file, raw_stats = write_mesh(tmp_path, "raw.mli", None, False)
+    serial_file, serial_stats = write_mesh(tmp_path, "serial.mli", method, False)
+
+    ctx, mm = mesh_cylinder(method, True)
+    # memes coordonnees, donc exactement les memes qualites
+    assert mm.compareWithMesh(serial_file)
+    assert mm.getQualityStatistics("Hors_Groupe_3D", 3, "ScaledJacobian") == serial_stats
+    # le lissage a deplace des noeuds
+    assert not mm.compareWithMesh(raw_file)
+    assert serial_stats != raw_stats
+
+    ctx.setAllowThreadedCommandTasks(True)
+    #This last command is mandatory to clean the session for the next test
+    ctx.clearSession()